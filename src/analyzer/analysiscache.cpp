@@ -0,0 +1,271 @@
+#include "analyzer/analysiscache.h"
+
+#include <QCryptographicHash>
+#include <QSqlQuery>
+#include <QSqlRecord>
+
+#include "analyzer/analyzertrack.h"
+#include "analyzer/constants.h"
+#include "library/queryutil.h"
+#include "track/beats.h"
+#include "track/keyfactory.h"
+#include "track/replaygain.h"
+#include "track/track.h"
+#include "util/logger.h"
+#include "util/math.h"
+
+namespace {
+
+mixxx::Logger kLogger("AnalysisCache");
+
+// Hashing the whole track would double the decoding effort, so only
+// the leading seconds of the decoded signal are covered. Together with
+// the signal properties this is sufficient to distinguish different
+// audio content, while duplicate files trivially share the same prefix.
+constexpr SINT kContentHashSecondsToHash = 30;
+
+const QString kContentHashTableName = QStringLiteral("audio_content_hashes");
+
+} // anonymous namespace
+
+AnalysisCache::AnalysisCache(
+        UserSettingsPointer pConfig,
+        const QSqlDatabase& dbConnection)
+        : m_database(dbConnection),
+          m_analysisDao(pConfig) {
+    m_analysisDao.initialize(dbConnection);
+}
+
+void AnalysisCache::consultAndUpdate(
+        const AnalyzerTrack& track,
+        const mixxx::AudioSourcePointer& audioSource,
+        mixxx::SampleBuffer* pSampleBuffer) {
+    const TrackPointer pTrack = track.getTrack();
+    const TrackId trackId = pTrack->getId();
+    if (!trackId.isValid() || !m_database.isOpen()) {
+        return;
+    }
+
+    // Hashing requires decoding the leading seconds of the track, so
+    // don't bother if all cacheable results are already available and
+    // the track's hash has been stored before.
+    const bool missingBeats = !pTrack->getBeats();
+    const bool missingKeys =
+            pTrack->getKeys().getGlobalKey() == mixxx::track::io::key::INVALID;
+    const bool missingReplayGain = !pTrack->getReplayGain().hasRatio();
+    const bool missingWaveforms = pTrack->getWaveform().isNull() &&
+            !hasStoredWaveformAnalyses(trackId);
+    if (!missingBeats && !missingKeys && !missingReplayGain && !missingWaveforms) {
+        return;
+    }
+
+    const QString contentHash = computeContentHash(audioSource, pSampleBuffer);
+    if (contentHash.isEmpty()) {
+        return;
+    }
+
+    const TrackId duplicateTrackId = findDuplicateTrack(contentHash, trackId);
+    if (duplicateTrackId.isValid()) {
+        kLogger.debug()
+                << "Copying analysis results for track"
+                << trackId
+                << "from duplicate track"
+                << duplicateTrackId;
+        copyTrackResults(duplicateTrackId, track);
+        if (missingWaveforms) {
+            copyWaveformAnalyses(duplicateTrackId, trackId);
+        }
+    }
+
+    // Store the hash even on a cache miss so that this track becomes
+    // a potential duplicate for all following analyses.
+    storeContentHash(trackId, contentHash);
+}
+
+QString AnalysisCache::computeContentHash(
+        const mixxx::AudioSourcePointer& audioSource,
+        mixxx::SampleBuffer* pSampleBuffer) const {
+    QCryptographicHash hasher(QCryptographicHash::Sha256);
+
+    // Include the signal properties to distinguish audio content that
+    // happens to share a sample prefix, e.g. tracks with a long leading
+    // silence but different durations.
+    const QString signalHeader = QStringLiteral("%1:%2:%3")
+                                         .arg(audioSource->getSignalInfo().getSampleRate().value())
+                                         .arg(audioSource->getSignalInfo().getChannelCount().value())
+                                         .arg(audioSource->frameLength());
+    hasher.addData(signalHeader.toUtf8());
+
+    const SINT framesToHash = math_min(
+            audioSource->frameLength(),
+            kContentHashSecondsToHash *
+                    static_cast<SINT>(
+                            audioSource->getSignalInfo().getSampleRate()));
+    mixxx::IndexRange hashFrameRange =
+            audioSource->frameIndexRange().splitAndShrinkFront(framesToHash);
+    while (!hashFrameRange.empty()) {
+        const auto chunkFrameRange =
+                hashFrameRange.splitAndShrinkFront(
+                        math_min(mixxx::kAnalysisFramesPerChunk, hashFrameRange.length()));
+        const auto readableSampleFrames =
+                audioSource->readSampleFrames(
+                        mixxx::WritableSampleFrames(
+                                chunkFrameRange,
+                                mixxx::SampleBuffer::WritableSlice(*pSampleBuffer)));
+        if (readableSampleFrames.frameIndexRange() != chunkFrameRange) {
+            // Unreadable or shorter than expected audio content must
+            // not be mapped to a hash that a complete file would also
+            // produce.
+            kLogger.warning()
+                    << "Failed to read sample data for content hash";
+            return QString();
+        }
+        hasher.addData(QByteArray::fromRawData(
+                reinterpret_cast<const char*>(readableSampleFrames.readableData()),
+                readableSampleFrames.readableLength() * sizeof(CSAMPLE)));
+    }
+
+    return QString::fromLatin1(hasher.result().toHex());
+}
+
+TrackId AnalysisCache::findDuplicateTrack(
+        const QString& contentHash,
+        TrackId excludedTrackId) const {
+    QSqlQuery query(m_database);
+    query.prepare(QStringLiteral(
+            "SELECT track_id FROM %1 "
+            "WHERE hash=:hash AND track_id!=:trackId "
+            "ORDER BY track_id LIMIT 1")
+                          .arg(kContentHashTableName));
+    query.bindValue(":hash", contentHash);
+    query.bindValue(":trackId", excludedTrackId.toVariant());
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query) << "couldn't look up content hash";
+        return TrackId();
+    }
+    if (!query.next()) {
+        return TrackId();
+    }
+    return TrackId(query.value(0));
+}
+
+void AnalysisCache::storeContentHash(
+        TrackId trackId,
+        const QString& contentHash) const {
+    QSqlQuery query(m_database);
+    query.prepare(QStringLiteral(
+            "INSERT OR REPLACE INTO %1 (track_id, hash) "
+            "VALUES (:trackId,:hash)")
+                          .arg(kContentHashTableName));
+    query.bindValue(":trackId", trackId.toVariant());
+    query.bindValue(":hash", contentHash);
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query) << "couldn't store content hash";
+    }
+}
+
+void AnalysisCache::copyTrackResults(
+        TrackId duplicateTrackId,
+        const AnalyzerTrack& track) const {
+    QSqlQuery query(m_database);
+    query.prepare(QStringLiteral(
+            "SELECT beats_version, beats_sub_version, beats, bpm_lock, "
+            "keys_version, keys_sub_version, keys, "
+            "replaygain, replaygain_peak "
+            "FROM library WHERE id=:trackId"));
+    query.bindValue(":trackId", duplicateTrackId.toVariant());
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query) << "couldn't load analysis results of duplicate track";
+        return;
+    }
+    if (!query.next()) {
+        return;
+    }
+    const QSqlRecord record = query.record();
+
+    const TrackPointer pTrack = track.getTrack();
+
+    if (!pTrack->getBeats()) {
+        const QString beatsVersion = record.value(0).toString();
+        const QString beatsSubVersion = record.value(1).toString();
+        const QByteArray beatsBlob = record.value(2).toByteArray();
+        if (!beatsVersion.isEmpty()) {
+            const mixxx::BeatsPointer pBeats = mixxx::Beats::fromByteArray(
+                    pTrack->getSampleRate(),
+                    beatsVersion,
+                    beatsSubVersion,
+                    beatsBlob);
+            if (pBeats) {
+                if (record.value(3).toBool()) {
+                    pTrack->trySetAndLockBeats(pBeats);
+                } else {
+                    pTrack->trySetBeats(pBeats);
+                }
+            }
+        }
+    }
+
+    if (pTrack->getKeys().getGlobalKey() == mixxx::track::io::key::INVALID) {
+        const QString keysVersion = record.value(4).toString();
+        const QString keysSubVersion = record.value(5).toString();
+        QByteArray keysBlob = record.value(6).toByteArray();
+        if (!keysVersion.isEmpty()) {
+            pTrack->setKeys(KeyFactory::loadKeysFromByteArray(
+                    keysVersion,
+                    keysSubVersion,
+                    &keysBlob));
+        }
+    }
+
+    if (!pTrack->getReplayGain().hasRatio()) {
+        mixxx::ReplayGain replayGain;
+        replayGain.setRatio(record.value(7).toDouble());
+        replayGain.setPeak(static_cast<CSAMPLE>(record.value(8).toDouble()));
+        if (replayGain.hasRatio()) {
+            pTrack->setReplayGain(replayGain);
+        }
+    }
+}
+
+void AnalysisCache::copyWaveformAnalyses(
+        TrackId duplicateTrackId,
+        TrackId trackId) {
+    const QList<AnalysisDao::AnalysisInfo> analyses =
+            m_analysisDao.getAnalysesForTrack(duplicateTrackId);
+    for (const AnalysisDao::AnalysisInfo& analysis : analyses) {
+        if (analysis.data.isEmpty()) {
+            // Flat-file backed analyses are loaded without their
+            // serialized blob, re-serializing them is not worth the
+            // effort for a cache hit. AnalyzerWaveform will recompute
+            // the waveform in this (rare) case.
+            continue;
+        }
+        AnalysisDao::AnalysisInfo copiedAnalysis = analysis;
+        copiedAnalysis.analysisId = -1;
+        copiedAnalysis.trackId = trackId;
+        copiedAnalysis.flatDataPath = QString();
+        if (!m_analysisDao.saveAnalysis(&copiedAnalysis)) {
+            kLogger.warning()
+                    << "Failed to copy waveform analysis"
+                    << analysis.analysisId
+                    << "to track"
+                    << trackId;
+        }
+    }
+}
+
+bool AnalysisCache::hasStoredWaveformAnalyses(TrackId trackId) const {
+    QSqlQuery query(m_database);
+    query.prepare(QStringLiteral(
+            "SELECT COUNT(*) FROM %1 WHERE track_id=:trackId")
+                          .arg(AnalysisDao::s_analysisTableName));
+    query.bindValue(":trackId", trackId.toVariant());
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query) << "couldn't count stored analyses";
+        return false;
+    }
+    if (!query.next()) {
+        return false;
+    }
+    return query.value(0).toInt() > 0;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <QSqlDatabase>
+#include <QString>
+
+#include "library/dao/analysisdao.h"
+#include "preferences/usersettings.h"
+#include "sources/audiosource.h"
+#include "track/trackid.h"
+#include "util/samplebuffer.h"
+
+class AnalyzerTrack;
+
+/// Content-addressed cache of analysis results.
+///
+/// Each analyzed track is mapped to a hash of its decoded audio content
+/// (see schema table audio_content_hashes). Before a track is analyzed,
+/// the cache is consulted for another track with the same content hash.
+/// If such a duplicate is found, its stored beats, keys, ReplayGain and
+/// waveform analyses are copied to the current track so that the
+/// subsequent analyzers skip the corresponding (expensive) computations.
+///
+/// The hash covers the leading seconds of the decoded sample data and
+/// thereby identifies duplicate audio content independent of file names,
+/// tags or container formats. Since the hash is computed from decoder
+/// output it is not guaranteed to be stable across decoder versions,
+/// but a changed hash only costs a redundant re-analysis, never wrong
+/// results.
+///
+/// All functions must be called from the analyzer thread that owns the
+/// database connection.
+class AnalysisCache {
+  public:
+    AnalysisCache(
+            UserSettingsPointer pConfig,
+            const QSqlDatabase& dbConnection);
+
+    /// Computes the content hash of the audio source, copies analysis
+    /// results from a duplicate track if one is known and stores the
+    /// hash for the current track so that it can serve as a duplicate
+    /// for future analyses. The audio source is read from the beginning
+    /// and must be re-read by the caller afterwards, pSampleBuffer is
+    /// used as intermediate buffer for decoding.
+    void consultAndUpdate(
+            const AnalyzerTrack& track,
+            const mixxx::AudioSourcePointer& audioSource,
+            mixxx::SampleBuffer* pSampleBuffer);
+
+  private:
+    QString computeContentHash(
+            const mixxx::AudioSourcePointer& audioSource,
+            mixxx::SampleBuffer* pSampleBuffer) const;
+    TrackId findDuplicateTrack(
+            const QString& contentHash,
+            TrackId excludedTrackId) const;
+    void storeContentHash(
+            TrackId trackId,
+            const QString& contentHash) const;
+
+    void copyTrackResults(
+            TrackId duplicateTrackId,
+            const AnalyzerTrack& track) const;
+    void copyWaveformAnalyses(
+            TrackId duplicateTrackId,
+            TrackId trackId);
+
+    bool hasStoredWaveformAnalyses(TrackId trackId) const;
+
+    QSqlDatabase m_database;
+    AnalysisDao m_analysisDao;
+};
@@ -48,6 +48,10 @@ bool AnalyzerBeats::initialize(const AnalyzerTrack& track,
         return false;
     }
 
+    if (track.getOptions().loudnessOnly) {
+        return false;
+    }
+
     bool bPreferencesBeatDetectionEnabled =
             m_enforceBpmDetection || m_bpmSettings.getBpmDetectionEnabled();
     if (!bPreferencesBeatDetectionEnabled) {
@@ -0,0 +1,88 @@
+#include "analyzer/analyzerchunkfanout.h"
+
+#include "util/assert.h"
+#include "util/logger.h"
+
+namespace {
+
+mixxx::Logger kLogger("AnalyzerChunkFanout");
+
+} // anonymous namespace
+
+AnalyzerChunkFanout::AnalyzerChunkFanout(
+        std::vector<AnalyzerWithState>* pAnalyzers)
+        : m_pAnalyzers(pAnalyzers),
+          m_pChunkSamples(nullptr),
+          m_chunkSampleCount(0),
+          m_chunkGeneration(0),
+          m_pendingHelpers(0),
+          m_stopping(false) {
+    DEBUG_ASSERT(m_pAnalyzers);
+    DEBUG_ASSERT(m_pAnalyzers->size() > 1);
+    // The calling thread processes the analyzer at index 0 itself,
+    // every remaining analyzer gets a dedicated helper thread. The
+    // number of analyzers per track is small (<= 6), so one thread
+    // per analyzer does not oversubscribe the machine.
+    const std::size_t numHelpers = m_pAnalyzers->size() - 1;
+    m_helperThreads.reserve(numHelpers);
+    for (std::size_t i = 0; i < numHelpers; ++i) {
+        m_helperThreads.emplace_back(&AnalyzerChunkFanout::run, this, i + 1);
+    }
+    kLogger.debug()
+            << "Fanning out chunks to"
+            << numHelpers
+            << "helper thread(s)";
+}
+
+AnalyzerChunkFanout::~AnalyzerChunkFanout() {
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_chunkPublished.notify_all();
+    for (auto& helperThread : m_helperThreads) {
+        helperThread.join();
+    }
+}
+
+void AnalyzerChunkFanout::processChunk(
+        const CSAMPLE* pSamples, SINT sampleCount) {
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        DEBUG_ASSERT(m_pendingHelpers == 0);
+        m_pChunkSamples = pSamples;
+        m_chunkSampleCount = sampleCount;
+        m_pendingHelpers = m_helperThreads.size();
+        ++m_chunkGeneration;
+    }
+    m_chunkPublished.notify_all();
+    // Process our own share while the helpers are busy with theirs.
+    (*m_pAnalyzers)[0].processSamples(pSamples, sampleCount);
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_chunkConsumed.wait(lock, [this] {
+        return m_pendingHelpers == 0;
+    });
+}
+
+void AnalyzerChunkFanout::run(std::size_t analyzerIndex) {
+    quint64 lastChunkGeneration = 0;
+    std::unique_lock<std::mutex> lock(m_mutex);
+    for (;;) {
+        m_chunkPublished.wait(lock, [this, lastChunkGeneration] {
+            return m_stopping || m_chunkGeneration != lastChunkGeneration;
+        });
+        if (m_stopping) {
+            return;
+        }
+        lastChunkGeneration = m_chunkGeneration;
+        const CSAMPLE* pSamples = m_pChunkSamples;
+        const SINT sampleCount = m_chunkSampleCount;
+        lock.unlock();
+        (*m_pAnalyzers)[analyzerIndex].processSamples(pSamples, sampleCount);
+        lock.lock();
+        DEBUG_ASSERT(m_pendingHelpers > 0);
+        if (--m_pendingHelpers == 0) {
+            m_chunkConsumed.notify_one();
+        }
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "analyzer/analyzer.h"
+#include "util/types.h"
+
+/// Fans a single decoded chunk of sample frames out to all analyzers of an
+/// AnalyzerThread concurrently instead of invoking them serially. The track
+/// is still decoded exactly once; each helper thread runs one analyzer on
+/// the shared, read-only chunk and the calling thread blocks until every
+/// analyzer has consumed it (fork-join per chunk). This bounds the per-chunk
+/// processing time by the slowest individual analyzer instead of the sum of
+/// all analyzers.
+///
+/// The analyzers are owned by the caller. While a chunk is in flight they
+/// must not be accessed from anywhere else; all other lifecycle steps
+/// (initialize()/finish()/cancel()) remain on the calling thread, which is
+/// safe because processChunk() does not return before all helpers have
+/// finished with the current chunk.
+class AnalyzerChunkFanout {
+  public:
+    /// pAnalyzers must outlive this object and must not be resized
+    /// while it exists. Helper threads are spawned for all analyzers
+    /// but the first one, which is processed by the calling thread.
+    explicit AnalyzerChunkFanout(std::vector<AnalyzerWithState>* pAnalyzers);
+    ~AnalyzerChunkFanout();
+
+    AnalyzerChunkFanout(const AnalyzerChunkFanout&) = delete;
+    AnalyzerChunkFanout& operator=(const AnalyzerChunkFanout&) = delete;
+
+    /// Processes the given chunk with all analyzers concurrently and
+    /// blocks until every analyzer has finished with it. Must only be
+    /// called from the thread that owns the analyzers.
+    void processChunk(const CSAMPLE* pSamples, SINT sampleCount);
+
+  private:
+    void run(std::size_t analyzerIndex);
+
+    std::vector<AnalyzerWithState>* const m_pAnalyzers;
+
+    std::vector<std::thread> m_helperThreads;
+
+    // All following members are guarded by m_mutex.
+    std::mutex m_mutex;
+    std::condition_variable m_chunkPublished;
+    std::condition_variable m_chunkConsumed;
+    const CSAMPLE* m_pChunkSamples;
+    SINT m_chunkSampleCount;
+    // Incremented for every published chunk so helpers can detect
+    // a new chunk even after a spurious wakeup.
+    quint64 m_chunkGeneration;
+    std::size_t m_pendingHelpers;
+    bool m_stopping;
+};
@@ -4,6 +4,7 @@
 
 #include "analyzer/analyzertrack.h"
 #include "analyzer/constants.h"
+#include "track/loudnessenvelope.h"
 #include "track/track.h"
 #include "util/math.h"
 #include "util/timer.h"
@@ -12,9 +13,16 @@ namespace {
 constexpr double kReplayGain2ReferenceLUFS = -18;
 } // anonymous namespace
 
-AnalyzerEbur128::AnalyzerEbur128(UserSettingsPointer pConfig)
+AnalyzerEbur128::AnalyzerEbur128(UserSettingsPointer pConfig,
+        const QSqlDatabase& dbConnection)
         : m_rgSettings(pConfig),
-          m_pState(nullptr) {
+          m_analysisDao(pConfig),
+          m_pState(nullptr),
+          m_computeEnvelope(false),
+          m_processedFrames(0),
+          m_framesPerEnvelopeInterval(0),
+          m_nextEnvelopeIntervalEndFrame(0) {
+    m_analysisDao.initialize(dbConnection);
 }
 
 AnalyzerEbur128::~AnalyzerEbur128() {
@@ -26,15 +34,39 @@ bool AnalyzerEbur128::initialize(
         mixxx::audio::SampleRate sampleRate,
         mixxx::audio::ChannelCount channelCount,
         SINT frameLength) {
-    if (m_rgSettings.isAnalyzerDisabled(2, track.getTrack()) || frameLength <= 0) {
+    if (frameLength <= 0) {
         qDebug() << "Skipping AnalyzerEbur128";
         return false;
     }
+    if (track.getOptions().loudnessOnly) {
+        // A loudness-only rescan re-measures even if the track already has
+        // a gain value, but still respects the configured analyzer version.
+        if (!isEnabled(m_rgSettings)) {
+            qDebug() << "Skipping AnalyzerEbur128";
+            return false;
+        }
+    } else if (m_rgSettings.isAnalyzerDisabled(2, track.getTrack())) {
+        qDebug() << "Skipping AnalyzerEbur128";
+        // The gain is already known, but the track might still need its
+        // stored loudness envelope attached for the engine.
+        loadStoredLoudnessEnvelope(track.getTrack());
+        return false;
+    }
+    m_computeEnvelope = m_rgSettings.getLoudnessEnvelopeEnabled();
+    m_processedFrames = 0;
+    m_framesPerEnvelopeInterval = static_cast<SINT>(
+            sampleRate * mixxx::kLoudnessEnvelopeIntervalSeconds);
+    m_nextEnvelopeIntervalEndFrame = m_framesPerEnvelopeInterval;
+    m_shortTermLufs.clear();
     DEBUG_ASSERT(m_pState == nullptr);
+    int modes = EBUR128_MODE_I;
+    if (m_computeEnvelope) {
+        modes |= EBUR128_MODE_S;
+    }
     m_pState = ebur128_init(
             channelCount,
             sampleRate,
-            EBUR128_MODE_I);
+            modes);
     return m_pState != nullptr;
 }
 
@@ -44,6 +76,8 @@ void AnalyzerEbur128::cleanup() {
         // ebur128_destroy clears the pointer but let's not rely on that.
         m_pState = nullptr;
     }
+    m_shortTermLufs.clear();
+    m_shortTermLufs.shrink_to_fit();
 }
 
 bool AnalyzerEbur128::processSamples(const CSAMPLE* pIn, SINT count) {
@@ -57,6 +91,23 @@ bool AnalyzerEbur128::processSamples(const CSAMPLE* pIn, SINT count) {
         qWarning() << "AnalyzerEbur128::processSamples() failed with" << e;
         return false;
     }
+    if (m_computeEnvelope) {
+        // Sample the 3 s short-term loudness once per envelope interval.
+        // The sampling happens at block granularity, i.e. up to one
+        // block after the nominal interval end, which is insignificant
+        // relative to the short-term window.
+        m_processedFrames += static_cast<SINT>(frames);
+        while (m_processedFrames >= m_nextEnvelopeIntervalEndFrame) {
+            double shortTermLufs;
+            if (ebur128_loudness_shortterm(m_pState, &shortTermLufs) ==
+                    EBUR128_SUCCESS) {
+                m_shortTermLufs.push_back(shortTermLufs);
+            } else {
+                m_shortTermLufs.push_back(-HUGE_VAL);
+            }
+            m_nextEnvelopeIntervalEndFrame += m_framesPerEnvelopeInterval;
+        }
+    }
     return true;
 }
 
@@ -86,4 +137,63 @@ void AnalyzerEbur128::storeResults(TrackPointer pTrack) {
     pTrack->setReplayGain(replayGain);
     qDebug() << "ReplayGain 2.0 (libebur128) result is" << fReplayGain2
              << "dB for" << pTrack->getFileInfo();
+
+    if (!m_computeEnvelope || m_shortTermLufs.empty()) {
+        return;
+    }
+
+    // Correction of each segment towards the integrated loudness,
+    // limited so silence is not boosted to full level. Segments without
+    // a valid measurement (shorter tracks than the short-term window,
+    // digital silence) stay neutral.
+    std::vector<double> correctionsDb;
+    correctionsDb.reserve(m_shortTermLufs.size());
+    for (const double shortTermLufs : m_shortTermLufs) {
+        if (shortTermLufs == -HUGE_VAL || !util_isnormal(shortTermLufs)) {
+            correctionsDb.push_back(0.0);
+        } else {
+            correctionsDb.push_back(math_clamp(averageLufs - shortTermLufs,
+                    -mixxx::kLoudnessEnvelopeMaxCorrectionDb,
+                    mixxx::kLoudnessEnvelopeMaxCorrectionDb));
+        }
+    }
+
+    // Centered moving average so the gain does not chase single beats,
+    // then conversion to the linear factors the engine interpolates.
+    const int numEntries = static_cast<int>(correctionsDb.size());
+    const int halfWindow = mixxx::kLoudnessEnvelopeSmoothingEntries / 2;
+    QVector<float> gains(numEntries);
+    for (int i = 0; i < numEntries; ++i) {
+        const int first = math_max(0, i - halfWindow);
+        const int last = math_min(numEntries - 1, i + halfWindow);
+        double sum = 0.0;
+        for (int j = first; j <= last; ++j) {
+            sum += correctionsDb[j];
+        }
+        gains[i] = static_cast<float>(db2ratio(sum / (last - first + 1)));
+    }
+
+    auto pEnvelope = std::make_shared<mixxx::LoudnessEnvelope>(std::move(gains));
+    pTrack->setLoudnessEnvelope(pEnvelope);
+    m_analysisDao.saveLoudnessEnvelope(pTrack->getId(),
+            mixxx::kLoudnessEnvelopeVersion,
+            pEnvelope->toByteArray());
+}
+
+void AnalyzerEbur128::loadStoredLoudnessEnvelope(const TrackPointer& pTrack) {
+    if (!m_rgSettings.getLoudnessEnvelopeEnabled() ||
+            !pTrack ||
+            pTrack->getLoudnessEnvelope()) {
+        return;
+    }
+    const QByteArray data = m_analysisDao.loadLoudnessEnvelope(
+            pTrack->getId(), mixxx::kLoudnessEnvelopeVersion);
+    if (data.isEmpty()) {
+        return;
+    }
+    mixxx::LoudnessEnvelopePointer pEnvelope =
+            mixxx::LoudnessEnvelope::fromByteArray(data);
+    if (pEnvelope) {
+        pTrack->setLoudnessEnvelope(pEnvelope);
+    }
 }
@@ -2,12 +2,16 @@
 
 #include <ebur128.h>
 
+#include <vector>
+
 #include "analyzer/analyzer.h"
+#include "library/dao/analysisdao.h"
 #include "preferences/replaygainsettings.h"
 
 class AnalyzerEbur128 : public Analyzer {
   public:
-    AnalyzerEbur128(UserSettingsPointer pConfig);
+    AnalyzerEbur128(UserSettingsPointer pConfig,
+            const QSqlDatabase& dbConnection);
     ~AnalyzerEbur128() override;
 
     static bool isEnabled(const ReplayGainSettings& rgSettings) {
@@ -23,6 +27,17 @@ class AnalyzerEbur128 : public Analyzer {
     void cleanup() override;
 
   private:
+    void loadStoredLoudnessEnvelope(const TrackPointer& pTrack);
+
     ReplayGainSettings m_rgSettings;
+    mutable AnalysisDao m_analysisDao;
     ebur128_state* m_pState;
+
+    // State of the per-second short-term loudness sampling for the
+    // loudness normalization envelope, see track/loudnessenvelope.h.
+    bool m_computeEnvelope;
+    SINT m_processedFrames;
+    SINT m_framesPerEnvelopeInterval;
+    SINT m_nextEnvelopeIntervalEndFrame;
+    std::vector<double> m_shortTermLufs;
 };
@@ -21,7 +21,18 @@ bool AnalyzerGain::initialize(const AnalyzerTrack& track,
         mixxx::audio::SampleRate sampleRate,
         mixxx::audio::ChannelCount channelCount,
         SINT frameLength) {
-    if (m_rgSettings.isAnalyzerDisabled(1, track.getTrack()) || frameLength <= 0) {
+    if (frameLength <= 0) {
+        qDebug() << "Skipping AnalyzerGain";
+        return false;
+    }
+    if (track.getOptions().loudnessOnly) {
+        // A loudness-only rescan re-measures even if the track already has
+        // a gain value, but still respects the configured analyzer version.
+        if (!isEnabled(m_rgSettings)) {
+            qDebug() << "Skipping AnalyzerGain";
+            return false;
+        }
+    } else if (m_rgSettings.isAnalyzerDisabled(1, track.getTrack())) {
         qDebug() << "Skipping AnalyzerGain";
         return false;
     }
@@ -53,6 +53,10 @@ bool AnalyzerKey::initialize(const AnalyzerTrack& track,
         return false;
     }
 
+    if (track.getOptions().loudnessOnly) {
+        return false;
+    }
+
     m_bPreferencesKeyDetectionEnabled = m_keySettings.getKeyDetectionEnabled();
     if (!m_bPreferencesKeyDetectionEnabled) {
         qDebug() << "Key detection is deactivated";
@@ -169,7 +173,6 @@ bool AnalyzerKey::processSamples(const CSAMPLE* pIn, SINT count) {
     }
 
     const CSAMPLE* pKeyInput = pIn;
-    CSAMPLE* pHarmonicMixedChannel = nullptr;
 
     if (m_channelCount == mixxx::audio::ChannelCount::stem()) {
         // We have an 8 channel soundsource. The only implemented soundsource with
@@ -179,7 +182,10 @@ bool AnalyzerKey::processSamples(const CSAMPLE* pIn, SINT count) {
         // For NI STEM we mix all the stems together except the first one,
         // which contains drums or beats by convention.
         count = numFrames * mixxx::audio::ChannelCount::stereo();
-        pHarmonicMixedChannel = SampleUtil::alloc(count);
+        if (m_stemMixBuffer.size() < count) {
+            m_stemMixBuffer = mixxx::SampleBuffer(count);
+        }
+        CSAMPLE* pHarmonicMixedChannel = m_stemMixBuffer.data();
         VERIFY_OR_DEBUG_ASSERT(pHarmonicMixedChannel) {
             return false;
         }
@@ -201,15 +207,12 @@ bool AnalyzerKey::processSamples(const CSAMPLE* pIn, SINT count) {
         return false;
     }
 
-    bool ret = m_pPlugin->processSamples(pKeyInput, count);
-    if (pHarmonicMixedChannel) {
-        SampleUtil::free(pHarmonicMixedChannel);
-    }
-    return ret;
+    return m_pPlugin->processSamples(pKeyInput, count);
 }
 
 void AnalyzerKey::cleanup() {
     m_pPlugin.reset();
+    m_stemMixBuffer = mixxx::SampleBuffer();
 }
 
 void AnalyzerKey::storeResults(TrackPointer tio) {
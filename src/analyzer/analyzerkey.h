@@ -9,6 +9,7 @@
 #include "analyzer/plugins/analyzerplugin.h"
 #include "preferences/keydetectionsettings.h"
 #include "track/track_decl.h"
+#include "util/samplebuffer.h"
 
 class AnalyzerKey : public Analyzer {
   public:
@@ -34,6 +35,9 @@ class AnalyzerKey : public Analyzer {
 
     KeyDetectionSettings m_keySettings;
     std::unique_ptr<mixxx::AnalyzerKeyPlugin> m_pPlugin;
+    // Reused across processSamples() calls for downmixing stem
+    // sources to avoid an allocation per decoded block.
+    mixxx::SampleBuffer m_stemMixBuffer;
     QString m_pluginId;
     mixxx::audio::SampleRate m_sampleRate;
     mixxx::audio::ChannelCount m_channelCount;
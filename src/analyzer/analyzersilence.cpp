@@ -1,8 +1,13 @@
 #include "analyzer/analyzersilence.h"
 
+#include <algorithm>
+#include <cmath>
+
 #include "analyzer/analyzertrack.h"
 #include "analyzer/constants.h"
+#include "track/beats.h"
 #include "track/track.h"
+#include "util/assert.h"
 
 namespace {
 
@@ -12,6 +17,29 @@ constexpr CSAMPLE kSilenceThreshold = 0.001f; // -60 dB
 // TODO: Change the above line to:
 //constexpr CSAMPLE kSilenceThreshold = db2ratio(-60.0f);
 
+// Length of one window of the RMS energy profile. Half a second smooths
+// out the level fluctuations within a beat while still resolving intro
+// and outro boundaries finely enough for a fade suggestion.
+constexpr double kEnergyWindowSeconds = 0.5;
+
+// Number of consecutive windows that must stay at full level before the
+// signal counts as sustained. Two seconds of sustained level ignore
+// single loud hits within an intro or outro.
+constexpr SINT kEnergySustainWindows = 4;
+
+// A window counts as full level when its RMS reaches this ratio (-6 dB)
+// of the track's cruising level.
+constexpr float kEnergyThresholdRatio = 0.5f;
+
+// Percentile of the window RMS values that is taken as the cruising
+// level of the track. Robust against short peaks, unlike the maximum.
+constexpr double kEnergyReferencePercentile = 0.95;
+
+// Suggested boundaries closer than this to the first or last sound carry
+// no usable information for a fade (the profile found no actual intro
+// ramp or outro fade) and are discarded.
+constexpr SINT kMinBoundaryDistanceWindows = 10;
+
 bool shouldAnalyze(TrackPointer pTrack) {
     CuePointer pIntroCue = pTrack->findCueByType(mixxx::CueType::Intro);
     CuePointer pOutroCue = pTrack->findCueByType(mixxx::CueType::Outro);
@@ -36,17 +64,17 @@ AnalyzerSilence::AnalyzerSilence(UserSettingsPointer pConfig)
         : m_pConfig(pConfig),
           m_framesProcessed(0),
           m_signalStart(-1),
-          m_signalEnd(-1) {
+          m_signalEnd(-1),
+          m_windowFrames(0),
+          m_windowSumSquares(0.0),
+          m_windowFrameCount(0) {
 }
 
 bool AnalyzerSilence::initialize(const AnalyzerTrack& track,
         mixxx::audio::SampleRate sampleRate,
         mixxx::audio::ChannelCount channelCount,
         SINT frameLength) {
-    Q_UNUSED(sampleRate);
-    Q_UNUSED(frameLength);
-
-    if (!shouldAnalyze(track.getTrack())) {
+    if (track.getOptions().loudnessOnly || !shouldAnalyze(track.getTrack())) {
         return false;
     }
 
@@ -55,6 +83,14 @@ bool AnalyzerSilence::initialize(const AnalyzerTrack& track,
     m_signalEnd = -1;
     m_channelCount = channelCount;
 
+    m_windowRms.clear();
+    m_windowFrames = static_cast<SINT>(sampleRate.value() * kEnergyWindowSeconds);
+    m_windowSumSquares = 0.0;
+    m_windowFrameCount = 0;
+    if (m_windowFrames > 0 && frameLength > 0) {
+        m_windowRms.reserve(frameLength / m_windowFrames + 1);
+    }
+
     return true;
 }
 
@@ -100,11 +136,115 @@ bool AnalyzerSilence::processSamples(const CSAMPLE* pIn, SINT count) {
         }
     }
 
+    // Collect the windowed energy profile in the same pass. A window may
+    // span multiple buffers, so accumulate until one is complete.
+    if (m_windowFrames > 0) {
+        SINT offset = 0;
+        while (offset < count) {
+            const SINT samplesUntilWindowEnd =
+                    (m_windowFrames - m_windowFrameCount) * m_channelCount;
+            const SINT samplesToProcess =
+                    std::min(count - offset, samplesUntilWindowEnd);
+            for (SINT i = offset; i < offset + samplesToProcess; ++i) {
+                m_windowSumSquares +=
+                        static_cast<double>(pIn[i]) * static_cast<double>(pIn[i]);
+            }
+            offset += samplesToProcess;
+            m_windowFrameCount += samplesToProcess / m_channelCount;
+            if (m_windowFrameCount >= m_windowFrames) {
+                finishEnergyWindow();
+            }
+        }
+    }
+
     m_framesProcessed += numFrames;
     return true;
 }
 
+void AnalyzerSilence::finishEnergyWindow() {
+    DEBUG_ASSERT(m_windowFrameCount > 0);
+    m_windowRms.push_back(static_cast<float>(std::sqrt(
+            m_windowSumSquares / (m_windowFrameCount * m_channelCount))));
+    m_windowSumSquares = 0.0;
+    m_windowFrameCount = 0;
+}
+
+void AnalyzerSilence::deriveTransitionHints(
+        mixxx::audio::FramePos* pIntroEndPosition,
+        mixxx::audio::FramePos* pOutroStartPosition) const {
+    const SINT numWindows = static_cast<SINT>(m_windowRms.size());
+    if (numWindows < 2 * kMinBoundaryDistanceWindows) {
+        // Too short for both an intro ramp and an outro fade.
+        return;
+    }
+
+    std::vector<float> sortedRms = m_windowRms;
+    const SINT referenceIndex = static_cast<SINT>(
+            kEnergyReferencePercentile * (numWindows - 1));
+    std::nth_element(sortedRms.begin(),
+            sortedRms.begin() + referenceIndex,
+            sortedRms.end());
+    const float referenceRms = sortedRms[referenceIndex];
+    if (referenceRms < kSilenceThreshold) {
+        return;
+    }
+    const float thresholdRms = referenceRms * kEnergyThresholdRatio;
+
+    // The intro ends at the start of the first sustained run of windows
+    // at full level.
+    SINT introWindow = -1;
+    SINT run = 0;
+    for (SINT i = 0; i < numWindows; ++i) {
+        if (m_windowRms[i] >= thresholdRms) {
+            ++run;
+            if (run >= kEnergySustainWindows) {
+                introWindow = i - kEnergySustainWindows + 1;
+                break;
+            }
+        } else {
+            run = 0;
+        }
+    }
+
+    // The outro starts right after the end of the last sustained run.
+    SINT runEnd = -1;
+    run = 0;
+    for (SINT i = numWindows - 1; i >= 0; --i) {
+        if (m_windowRms[i] >= thresholdRms) {
+            if (run == 0) {
+                runEnd = i;
+            }
+            ++run;
+            if (run >= kEnergySustainWindows) {
+                break;
+            }
+        } else {
+            run = 0;
+        }
+    }
+    const SINT outroWindow = (run >= kEnergySustainWindows) ? runEnd + 1 : -1;
+
+    if (introWindow < 0 || outroWindow < 0) {
+        return;
+    }
+    const SINT introEndFrame = introWindow * m_windowFrames;
+    const SINT outroStartFrame = outroWindow * m_windowFrames;
+    if (introEndFrame >= outroStartFrame) {
+        return;
+    }
+    const SINT minBoundaryDistanceFrames =
+            kMinBoundaryDistanceWindows * m_windowFrames;
+    if (introEndFrame - m_signalStart >= minBoundaryDistanceFrames) {
+        *pIntroEndPosition = mixxx::audio::FramePos(introEndFrame);
+    }
+    if (m_signalEnd - outroStartFrame >= minBoundaryDistanceFrames) {
+        *pOutroStartPosition = mixxx::audio::FramePos(outroStartFrame);
+    }
+}
+
 void AnalyzerSilence::cleanup() {
+    m_windowRms.clear();
+    m_windowRms.shrink_to_fit();
 }
 
 void AnalyzerSilence::storeResults(TrackPointer pTrack) {
@@ -114,10 +254,37 @@ void AnalyzerSilence::storeResults(TrackPointer pTrack) {
     if (m_signalEnd < 0) {
         m_signalEnd = m_framesProcessed;
     }
+    if (m_windowFrameCount > 0) {
+        finishEnergyWindow();
+    }
 
     const auto firstSoundPosition = mixxx::audio::FramePos(m_signalStart);
     const auto lastSoundPosition = mixxx::audio::FramePos(m_signalEnd);
 
+    auto introEndPosition = mixxx::audio::kInvalidFramePos;
+    auto outroStartPosition = mixxx::audio::kInvalidFramePos;
+    deriveTransitionHints(&introEndPosition, &outroStartPosition);
+
+    // Snap the suggested boundaries to the nearest beat. The beats
+    // analyzer runs before this analyzer, so the beats are already stored
+    // on the track. Phrase-level quantization would need downbeat
+    // information that the beatgrid does not provide.
+    const mixxx::BeatsPointer pBeats = pTrack->getBeats();
+    if (pBeats) {
+        if (introEndPosition.isValid()) {
+            const auto snappedPosition = pBeats->findClosestBeat(introEndPosition);
+            if (snappedPosition.isValid() && snappedPosition > firstSoundPosition) {
+                introEndPosition = snappedPosition;
+            }
+        }
+        if (outroStartPosition.isValid()) {
+            const auto snappedPosition = pBeats->findClosestBeat(outroStartPosition);
+            if (snappedPosition.isValid() && snappedPosition < lastSoundPosition) {
+                outroStartPosition = snappedPosition;
+            }
+        }
+    }
+
     CuePointer pN60dBSound = pTrack->findCueByType(mixxx::CueType::N60dBSound);
     if (pN60dBSound == nullptr) {
         pN60dBSound = pTrack->createAndAddCue(
@@ -134,13 +301,25 @@ void AnalyzerSilence::storeResults(TrackPointer pTrack) {
         pN60dBSound->setStartAndEndPosition(firstSoundPosition, lastSoundPosition);
     }
 
-    setupMainAndIntroCue(pTrack.get(), firstSoundPosition, m_pConfig.data());
-    setupOutroCue(pTrack.get(), lastSoundPosition);
+    setupMainAndIntroCue(pTrack.get(), firstSoundPosition, introEndPosition, m_pConfig.data());
+    setupOutroCue(pTrack.get(), outroStartPosition, lastSoundPosition);
 }
 
 // static
 void AnalyzerSilence::setupMainAndIntroCue(
         Track* pTrack, mixxx::audio::FramePos firstSoundPosition, UserSettings* pConfig) {
+    setupMainAndIntroCue(pTrack,
+            firstSoundPosition,
+            mixxx::audio::kInvalidFramePos,
+            pConfig);
+}
+
+// static
+void AnalyzerSilence::setupMainAndIntroCue(
+        Track* pTrack,
+        mixxx::audio::FramePos firstSoundPosition,
+        mixxx::audio::FramePos introEndPosition,
+        UserSettings* pConfig) {
     CuePointer pIntroCue = pTrack->findCueByType(mixxx::CueType::Intro);
 
     mixxx::audio::FramePos mainCuePosition = pTrack->getMainCuePosition();
@@ -162,22 +341,37 @@ void AnalyzerSilence::setupMainAndIntroCue(
     }
 
     if (pIntroCue == nullptr) {
+        if (introEndPosition.isValid() &&
+                introEndPosition <= introStartPosition) {
+            introEndPosition = mixxx::audio::kInvalidFramePos;
+        }
         pIntroCue = pTrack->createAndAddCue(
                 mixxx::CueType::Intro,
                 Cue::kNoHotCue,
                 introStartPosition,
-                mixxx::audio::kInvalidFramePos);
+                introEndPosition);
     }
 }
 
 // static
 void AnalyzerSilence::setupOutroCue(Track* pTrack, mixxx::audio::FramePos lastSoundPosition) {
+    setupOutroCue(pTrack, mixxx::audio::kInvalidFramePos, lastSoundPosition);
+}
+
+// static
+void AnalyzerSilence::setupOutroCue(Track* pTrack,
+        mixxx::audio::FramePos outroStartPosition,
+        mixxx::audio::FramePos lastSoundPosition) {
     CuePointer pOutroCue = pTrack->findCueByType(mixxx::CueType::Outro);
     if (pOutroCue == nullptr) {
+        if (outroStartPosition.isValid() &&
+                outroStartPosition >= lastSoundPosition) {
+            outroStartPosition = mixxx::audio::kInvalidFramePos;
+        }
         pOutroCue = pTrack->createAndAddCue(
                 mixxx::CueType::Outro,
                 Cue::kNoHotCue,
-                mixxx::audio::kInvalidFramePos,
+                outroStartPosition,
                 lastSoundPosition);
     }
 }
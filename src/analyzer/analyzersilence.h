@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "analyzer/analyzer.h"
 #include "preferences/usersettings.h"
 #include "util/span.h"
@@ -32,7 +34,22 @@ class AnalyzerSilence : public Analyzer {
     static void setupMainAndIntroCue(Track* pTrack,
             mixxx::audio::FramePos firstSoundPosition,
             UserSettings* pConfig);
+    /// Same as above, but additionally stores the suggested intro end
+    /// position derived from the energy profile on a newly created intro
+    /// cue. May be invalid if no intro ramp has been detected. Existing
+    /// (user-placed) intro cues are never modified.
+    static void setupMainAndIntroCue(Track* pTrack,
+            mixxx::audio::FramePos firstSoundPosition,
+            mixxx::audio::FramePos introEndPosition,
+            UserSettings* pConfig);
     static void setupOutroCue(Track* pTrack, mixxx::audio::FramePos lastSoundPosition);
+    /// Same as above, but additionally stores the suggested outro start
+    /// position derived from the energy profile on a newly created outro
+    /// cue. May be invalid if no outro fade has been detected. Existing
+    /// (user-placed) outro cues are never modified.
+    static void setupOutroCue(Track* pTrack,
+            mixxx::audio::FramePos outroStartPosition,
+            mixxx::audio::FramePos lastSoundPosition);
 
     /// returns the index of the first sample in the buffer that is above -60 dB
     /// or samples.size() if no sample is found
@@ -51,9 +68,29 @@ class AnalyzerSilence : public Analyzer {
             mixxx::audio::ChannelCount channelCount);
 
   private:
+    // Closes the currently accumulated energy window and appends its RMS
+    // value to the energy profile.
+    void finishEnergyWindow();
+
+    // Derives the suggested intro end (where the signal first reaches its
+    // sustained full level) and outro start (where it drops for good) from
+    // the windowed energy profile. Leaves the positions untouched if the
+    // profile shows no pronounced intro ramp or outro fade.
+    void deriveTransitionHints(
+            mixxx::audio::FramePos* pIntroEndPosition,
+            mixxx::audio::FramePos* pOutroStartPosition) const;
+
     UserSettingsPointer m_pConfig;
     mixxx::audio::ChannelCount m_channelCount;
     SINT m_framesProcessed;
     SINT m_signalStart;
     SINT m_signalEnd;
+
+    // Windowed RMS energy profile of the analyzed signal, collected in the
+    // same pass as the silence detection and used to suggest intro end and
+    // outro start positions for AutoDJ's fade selection.
+    std::vector<float> m_windowRms;
+    SINT m_windowFrames;
+    double m_windowSumSquares;
+    SINT m_windowFrameCount;
 };
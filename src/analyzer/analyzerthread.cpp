@@ -2,6 +2,7 @@
 
 #include <mutex>
 
+#include "analyzer/analysiscache.h"
 #include "analyzer/analyzerbeats.h"
 #include "analyzer/analyzerebur128.h"
 #include "analyzer/analyzergain.h"
@@ -14,9 +15,11 @@
 #include "sources/audiosourcestereoproxy.h"
 #include "sources/soundsourceproxy.h"
 #include "track/track.h"
+#include "util/backgroundio.h"
 #include "util/db/dbconnectionpooled.h"
 #include "util/db/dbconnectionpooler.h"
 #include "util/logger.h"
+#include "util/threadtopology.h"
 
 namespace {
 
@@ -88,11 +91,27 @@ AnalyzerThread::AnalyzerThread(
 }
 
 void AnalyzerThread::doRun() {
+    if (m_modeFlags & AnalyzerModeFlags::LowPriority) {
+        // Batch analysis during a running set should not compete with
+        // the engine for the performance cores of a hybrid CPU. On
+        // homogeneous topologies this is a no-op.
+        mixxx::ThreadTopology::pinCurrentThread(
+                mixxx::ThreadTopology::CoreClass::Efficiency);
+        // The decoder reads of batch analysis must also not compete
+        // with the engine's deck decoders for the disk.
+        mixxx::BackgroundIo::lowerCurrentThreadDiskPriority();
+    }
+
     std::unique_ptr<AnalysisDao> pAnalysisDao;
+    std::unique_ptr<AnalysisCache> pAnalysisCache;
     // The thread-local database connection  must not be closed
     // before returning from this function.
     mixxx::DbConnectionPooler dbConnectionPooler;
 
+    // Stays invalid when no database connection is pooled; the DAOs of
+    // the analyzers then silently skip their load/store operations.
+    QSqlDatabase dbConnection;
+
     if (m_modeFlags & AnalyzerModeFlags::WithWaveform) {
         dbConnectionPooler = mixxx::DbConnectionPooler(m_dbConnectionPool); // move assignment
         if (!dbConnectionPooler.isPooling()) {
@@ -100,14 +119,16 @@ void AnalyzerThread::doRun() {
                     << "Failed to obtain database connection for analyzer thread";
             return;
         }
-        QSqlDatabase dbConnection = mixxx::DbConnectionPooled(m_dbConnectionPool);
+        dbConnection = mixxx::DbConnectionPooled(m_dbConnectionPool);
         m_analyzers.push_back(AnalyzerWithState(std::make_unique<AnalyzerWaveform>(m_pConfig, dbConnection)));
+        pAnalysisCache = std::make_unique<AnalysisCache>(m_pConfig, dbConnection);
     }
     if (AnalyzerGain::isEnabled(ReplayGainSettings(m_pConfig))) {
         m_analyzers.push_back(AnalyzerWithState(std::make_unique<AnalyzerGain>(m_pConfig)));
     }
     if (AnalyzerEbur128::isEnabled(ReplayGainSettings(m_pConfig))) {
-        m_analyzers.push_back(AnalyzerWithState(std::make_unique<AnalyzerEbur128>(m_pConfig)));
+        m_analyzers.push_back(AnalyzerWithState(
+                std::make_unique<AnalyzerEbur128>(m_pConfig, dbConnection)));
     }
     // BPM detection might be disabled in the config, but can be overridden
     // and enabled by explicitly setting the mode flag.
@@ -118,6 +139,11 @@ void AnalyzerThread::doRun() {
     DEBUG_ASSERT(!m_analyzers.empty());
     kLogger.debug() << "Activated" << m_analyzers.size() << "analyzers";
 
+    if ((m_modeFlags & AnalyzerModeFlags::ParallelAnalyzers) &&
+            m_analyzers.size() > 1) {
+        m_pChunkFanout = std::make_unique<AnalyzerChunkFanout>(&m_analyzers);
+    }
+
     m_lastBusyProgressEmittedTimer.start();
 
     mixxx::AudioSource::OpenParams openParams;
@@ -145,6 +171,14 @@ void AnalyzerThread::doRun() {
                     mixxx::kAnalysisFramesPerChunk);
         }
 
+        if (pAnalysisCache) {
+            // Copy stored analysis results from a previously analyzed
+            // duplicate of this track (if one is known) before the
+            // analyzers decide whether they need to run at all.
+            pAnalysisCache->consultAndUpdate(
+                    *m_currentTrack, audioSource, &m_sampleBuffer);
+        }
+
         bool processTrack = false;
         for (auto&& analyzer : m_analyzers) {
             // Make sure not to short-circuit initialize(...)
@@ -187,6 +221,8 @@ void AnalyzerThread::doRun() {
     DEBUG_ASSERT(!m_currentTrack);
     DEBUG_ASSERT(isStopping());
 
+    // Stop the helper threads before destroying the analyzers
+    m_pChunkFanout.reset();
     m_analyzers.clear();
 
     kLogger.debug() << "Exiting worker thread";
@@ -240,6 +276,12 @@ AnalyzerThread::AnalysisResult AnalyzerThread::analyzeAudioSource(
         if (isStopping()) {
             return AnalysisResult::Cancelled;
         }
+        if (m_modeFlags & AnalyzerModeFlags::LowPriority) {
+            // Batch analysis parks between chunks while a deck is
+            // audible, if enabled. Analysis of deck-loaded tracks runs
+            // with default priority and is never parked.
+            mixxx::BackgroundIo::throttle([this] { return isStopping(); });
+        }
 
         // 1st step: Decode next chunk of audio data
 
@@ -299,10 +341,16 @@ AnalyzerThread::AnalysisResult AnalyzerThread::analyzeAudioSource(
 
         // 2nd: step: Analyze chunk of decoded audio data
         if (!readableSampleFrames.frameIndexRange().empty()) {
-            for (auto&& analyzer : m_analyzers) {
-                analyzer.processSamples(
+            if (m_pChunkFanout) {
+                m_pChunkFanout->processChunk(
                         readableSampleFrames.readableData(),
                         readableSampleFrames.readableLength());
+            } else {
+                for (auto&& analyzer : m_analyzers) {
+                    analyzer.processSamples(
+                            readableSampleFrames.readableData(),
+                            readableSampleFrames.readableLength());
+                }
             }
         }
 
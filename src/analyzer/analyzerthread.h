@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "analyzer/analyzer.h"
+#include "analyzer/analyzerchunkfanout.h"
 #include "analyzer/analyzerprogress.h"
 #include "analyzer/analyzertrack.h"
 #include "preferences/usersettings.h"
@@ -22,6 +23,10 @@ enum AnalyzerModeFlags {
     WithBeats = 0x01,
     WithWaveform = 0x02,
     LowPriority = 0x04,
+    // Run the analyzers of each track concurrently on helper threads
+    // instead of serially (see AnalyzerChunkFanout). The track is still
+    // decoded only once.
+    ParallelAnalyzers = 0x08,
     All = WithBeats | WithWaveform,
 };
 
@@ -118,6 +123,10 @@ class AnalyzerThread : public WorkerThread {
 
     std::vector<AnalyzerWithState> m_analyzers;
 
+    // Only allocated with AnalyzerModeFlags::ParallelAnalyzers and
+    // more than one active analyzer
+    std::unique_ptr<AnalyzerChunkFanout> m_pChunkFanout;
+
     mixxx::SampleBuffer m_sampleBuffer;
 
     std::optional<AnalyzerTrack> m_currentTrack;
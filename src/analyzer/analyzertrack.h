@@ -10,6 +10,11 @@ class AnalyzerTrack {
     struct Options {
         /// If set, overrides whether the analysis should assume constant BPM.
         std::optional<bool> useFixedTempo;
+
+        /// If true, only measure the loudness for ReplayGain and skip all
+        /// other analyzers. The loudness is re-measured even if the track
+        /// already has a gain value.
+        bool loudnessOnly = false;
     };
 
     explicit AnalyzerTrack(TrackPointer track, Options options = Options());
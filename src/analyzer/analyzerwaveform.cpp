@@ -8,6 +8,8 @@
 #include "engine/filters/enginefilterbessel4.h"
 #include "track/track.h"
 #include "util/logger.h"
+#include "util/math.h"
+#include "waveform/overviewstrip.h"
 #include "waveform/waveform.h"
 #include "waveform/waveformfactory.h"
 
@@ -48,7 +50,7 @@ bool AnalyzerWaveform::initialize(const AnalyzerTrack& track,
     }
 
     // If we don't need to calculate the waveform/wavesummary, skip.
-    if (!shouldAnalyze(track.getTrack())) {
+    if (track.getOptions().loudnessOnly || !shouldAnalyze(track.getTrack())) {
         return false;
     }
 
@@ -233,46 +235,79 @@ bool AnalyzerWaveform::processSamples(const CSAMPLE* pIn, SINT count) {
     m_waveform->setSaveState(Waveform::SaveState::NotSaved);
     m_waveformSummary->setSaveState(Waveform::SaveState::NotSaved);
 
-    for (SINT i = 0; i < count; i += 2) {
-        // Take max value, not average of data
-        CSAMPLE cover[2] = {fabs(pWaveformInput[i]), fabs(pWaveformInput[i + 1])};
-        CSAMPLE clow[2] = {fabs(m_buffers.low[i]), fabs(m_buffers.low[i + 1])};
-        CSAMPLE cmid[2] = {fabs(m_buffers.mid[i]), fabs(m_buffers.mid[i + 1])};
-        CSAMPLE chigh[2] = {fabs(m_buffers.high[i]), fabs(m_buffers.high[i + 1])};
-
-        // This is for if you want to experiment with averaging instead of
-        // maxing.
-        // m_stride.m_overallData[Right] += buffer[i]*buffer[i];
-        // m_stride.m_overallData[Left] += buffer[i + 1]*buffer[i + 1];
-        // m_stride.m_filteredData[Right][Low] += m_buffers.low[i]*m_buffers.low[i];
-        // m_stride.m_filteredData[Left][Low] += m_buffers.low[i + 1]*m_buffers.low[i + 1];
-        // m_stride.m_filteredData[Right][Mid] += m_buffers.mid[i]*m_buffers.mid[i];
-        // m_stride.m_filteredData[Left][Mid] += m_buffers.mid[i + 1]*m_buffers.mid[i + 1];
-        // m_stride.m_filteredData[Right][High] += m_buffers.high[i]*m_buffers.high[i];
-        // m_stride.m_filteredData[Left][High] += m_buffers.high[i + 1]*m_buffers.high[i + 1];
-
-        // Record the max across this stride.
-        storeIfGreater(&m_stride.m_overallData[Left], cover[Left]);
-        storeIfGreater(&m_stride.m_overallData[Right], cover[Right]);
-        storeIfGreater(&m_stride.m_filteredData[Left][Low], clow[Left]);
-        storeIfGreater(&m_stride.m_filteredData[Right][Low], clow[Right]);
-        storeIfGreater(&m_stride.m_filteredData[Left][Mid], cmid[Left]);
-        storeIfGreater(&m_stride.m_filteredData[Right][Mid], cmid[Right]);
-        storeIfGreater(&m_stride.m_filteredData[Left][High], chigh[Left]);
-        storeIfGreater(&m_stride.m_filteredData[Right][High], chigh[Right]);
+    // Process the samples between two stride boundaries as one block: the
+    // per-channel max scans below run over contiguous memory in loops the
+    // compiler can vectorize, and the former per-sample fmod() boundary
+    // checks collapse into one boundary computation per block. The max of a
+    // stride is independent of how the samples are grouped, so the stored
+    // waveform is identical to the per-sample version (covered by the
+    // reference buffer comparison in analyserwaveformtest).
+    //
+    // This is for if you want to experiment with averaging instead of
+    // maxing.
+    // m_stride.m_overallData[Right] += buffer[i]*buffer[i];
+    // m_stride.m_overallData[Left] += buffer[i + 1]*buffer[i + 1];
+    // m_stride.m_filteredData[Right][Low] += m_buffers.low[i]*m_buffers.low[i];
+    // m_stride.m_filteredData[Left][Low] += m_buffers.low[i + 1]*m_buffers.low[i + 1];
+    // m_stride.m_filteredData[Right][Mid] += m_buffers.mid[i]*m_buffers.mid[i];
+    // m_stride.m_filteredData[Left][Mid] += m_buffers.mid[i + 1]*m_buffers.mid[i + 1];
+    // m_stride.m_filteredData[Right][High] += m_buffers.high[i]*m_buffers.high[i];
+    // m_stride.m_filteredData[Left][High] += m_buffers.high[i + 1]*m_buffers.high[i + 1];
+    const SINT totalFrames = count / 2;
+    SINT frame = 0;
+    while (frame < totalFrames) {
+        // The k-th stride ends at the first integer position >= k * length,
+        // which is where the former fmod(position, length) < 1 check fired.
+        // The max() keeps us advancing one frame at a time if a stride is
+        // shorter than one frame (very short tracks).
+        const SINT nextStrideBoundary = math_max<SINT>(m_stride.m_position + 1,
+                static_cast<SINT>(std::ceil(
+                        (m_currentStride / ChannelCount + 1) * m_stride.m_length)));
+        const SINT nextSummaryBoundary = math_max<SINT>(m_stride.m_position + 1,
+                static_cast<SINT>(std::ceil(
+                        (m_currentSummaryStride / ChannelCount + 1) *
+                        m_stride.m_averageLength)));
+        SINT blockFrames = totalFrames - frame;
+        blockFrames = math_min(blockFrames, nextStrideBoundary - m_stride.m_position);
+        blockFrames = math_min(blockFrames, nextSummaryBoundary - m_stride.m_position);
+        const SINT offset = frame * 2;
+        const SINT blockSamples = blockFrames * 2;
+
+        // Record the max across this block, not the average.
+        CSAMPLE maxL;
+        CSAMPLE maxR;
+        SampleUtil::maxAbsPerChannel(&maxL, &maxR, pWaveformInput + offset, blockSamples);
+        storeIfGreater(&m_stride.m_overallData[Left], maxL);
+        storeIfGreater(&m_stride.m_overallData[Right], maxR);
+        SampleUtil::maxAbsPerChannel(&maxL, &maxR, &m_buffers.low[offset], blockSamples);
+        storeIfGreater(&m_stride.m_filteredData[Left][Low], maxL);
+        storeIfGreater(&m_stride.m_filteredData[Right][Low], maxR);
+        SampleUtil::maxAbsPerChannel(&maxL, &maxR, &m_buffers.mid[offset], blockSamples);
+        storeIfGreater(&m_stride.m_filteredData[Left][Mid], maxL);
+        storeIfGreater(&m_stride.m_filteredData[Right][Mid], maxR);
+        SampleUtil::maxAbsPerChannel(&maxL, &maxR, &m_buffers.high[offset], blockSamples);
+        storeIfGreater(&m_stride.m_filteredData[Left][High], maxL);
+        storeIfGreater(&m_stride.m_filteredData[Right][High], maxR);
 
         for (int s = 0; s < stemCount; s++) {
-            CSAMPLE cstem[2] = {
-                    fabs(pIn[i * stemCount + s * mixxx::kAnalysisChannels]),
-                    fabs(pIn[i * stemCount + s * mixxx::kAnalysisChannels +
-                            1])};
-            storeIfGreater(&m_stride.m_stemData[Left][s], cstem[Left]);
-            storeIfGreater(&m_stride.m_stemData[Right][s], cstem[Right]);
+            const CSAMPLE* pStem = pIn + frame * m_channelCount +
+                    s * mixxx::kAnalysisChannels;
+            CSAMPLE stemMax[2] = {0.0f, 0.0f};
+            for (SINT f = 0; f < blockFrames; ++f) {
+                stemMax[Left] = math_max(stemMax[Left],
+                        static_cast<CSAMPLE>(fabs(pStem[f * m_channelCount])));
+                stemMax[Right] = math_max(stemMax[Right],
+                        static_cast<CSAMPLE>(
+                                fabs(pStem[f * m_channelCount + 1])));
+            }
+            storeIfGreater(&m_stride.m_stemData[Left][s], stemMax[Left]);
+            storeIfGreater(&m_stride.m_stemData[Right][s], stemMax[Right]);
         }
 
-        m_stride.m_position++;
+        m_stride.m_position += static_cast<int>(blockFrames);
+        frame += blockFrames;
 
-        if (fmod(m_stride.m_position, m_stride.m_length) < 1) {
+        if (m_stride.m_position == nextStrideBoundary) {
             VERIFY_OR_DEBUG_ASSERT(m_currentStride + ChannelCount <= m_waveform->getDataSize()) {
                 qWarning() << "AnalyzerWaveform::process - currentStride > waveform size";
                 return false;
@@ -282,7 +317,7 @@ bool AnalyzerWaveform::processSamples(const CSAMPLE* pIn, SINT count) {
             m_waveform->setCompletion(m_currentStride);
         }
 
-        if (fmod(m_stride.m_position, m_stride.m_averageLength) < 1) {
+        if (m_stride.m_position == nextSummaryBoundary) {
             VERIFY_OR_DEBUG_ASSERT(m_currentSummaryStride + ChannelCount <= m_waveformSummary->getDataSize()) {
                 qWarning() << "AnalyzerWaveform::process - current summary stride > waveform summary size";
                 return false;
@@ -324,6 +359,9 @@ void AnalyzerWaveform::storeResults(TrackPointer pTrack) {
     if (m_waveform) {
         m_waveform->setSaveState(Waveform::SaveState::SavePending);
         m_waveform->setCompletion(m_waveform->getDataSize());
+        // Now that all data elements are final, build the decimated summary
+        // pyramid so that renderers no longer have to scan the raw data.
+        m_waveform->rebuildSummaryPyramid();
         m_waveform->setVersion(WaveformFactory::currentWaveformVersion());
         m_waveform->setDescription(WaveformFactory::currentWaveformDescription());
     }
@@ -332,6 +370,7 @@ void AnalyzerWaveform::storeResults(TrackPointer pTrack) {
     if (m_waveformSummary) {
         m_waveformSummary->setSaveState(Waveform::SaveState::SavePending);
         m_waveformSummary->setCompletion(m_waveformSummary->getDataSize());
+        m_waveformSummary->rebuildSummaryPyramid();
         m_waveformSummary->setVersion(WaveformFactory::currentWaveformSummaryVersion());
         m_waveformSummary->setDescription(WaveformFactory::currentWaveformSummaryDescription());
     }
@@ -349,6 +388,15 @@ void AnalyzerWaveform::storeResults(TrackPointer pTrack) {
             m_waveform,
             m_waveformSummary);
 
+    if (m_waveformSummary) {
+        // Also store the compact overview strip for the library's
+        // overview column, so that it can be painted without loading
+        // the summary analysis again.
+        m_analysisDao.saveOverviewStrip(pTrack->getId(),
+                mixxx::kOverviewStripVersion,
+                mixxx::makeOverviewStrip(m_waveformSummary));
+    }
+
     // Set waveforms on track AFTER they'been written to disk in order to have
     // a consistency when OverviewCache asks AnalysisDAO for a waveform summary.
     pTrack->setWaveform(m_waveform);
@@ -22,6 +22,13 @@ constexpr float kStepSecs = 0.01161f;
 // results in 43 Hz @ 44.1 kHz / 47 Hz @ 48 kHz / 47 Hz @ 96 kHz
 constexpr int kMaximumBinSizeHz = 50; // Hz
 
+// The complex spectral difference detection function keeps one frame of
+// magnitude history and two frames of phase history. After this many
+// consecutive all-zero windows have been processed its state no longer
+// depends on the pre-silence signal, every further silent window yields
+// a detection value of exactly 0 and the FFT can be skipped for it.
+constexpr int kSilentWindowsToSettle = 3;
+
 DFConfig makeDetectionFunctionConfig(int stepSizeFrames, int windowSize) {
     // These are the defaults for the VAMP beat tracker plugin we used in Mixxx
     // 2.0.
@@ -40,7 +47,8 @@ DFConfig makeDetectionFunctionConfig(int stepSizeFrames, int windowSize) {
 
 AnalyzerQueenMaryBeats::AnalyzerQueenMaryBeats()
         : m_windowSize(0),
-          m_stepSizeFrames(0) {
+          m_stepSizeFrames(0),
+          m_consecutiveSilentWindows(0) {
 }
 
 AnalyzerQueenMaryBeats::~AnalyzerQueenMaryBeats() {
@@ -55,8 +63,23 @@ bool AnalyzerQueenMaryBeats::initialize(mixxx::audio::SampleRate sampleRate) {
             makeDetectionFunctionConfig(m_stepSizeFrames, m_windowSize));
     qDebug() << "input sample rate is " << m_sampleRate << ", step size is " << m_stepSizeFrames;
 
+    m_consecutiveSilentWindows = 0;
     m_helper.initialize(
-            m_windowSize, m_stepSizeFrames, [this](double* pWindow, size_t) {
+            m_windowSize, m_stepSizeFrames, [this](double* pWindow, size_t frames) {
+                if (DownmixAndOverlapHelper::isSilentWindow(pWindow, frames)) {
+                    if (m_consecutiveSilentWindows >= kSilentWindowsToSettle) {
+                        // Long silent regions (e.g. talk gaps in liveset or
+                        // podcast recordings) contribute a detection value
+                        // of exactly 0 per window once the detection
+                        // function state has settled, so the spectral
+                        // analysis can be skipped for them.
+                        m_detectionResults.push_back(0.0);
+                        return true;
+                    }
+                    ++m_consecutiveSilentWindows;
+                } else {
+                    m_consecutiveSilentWindows = 0;
+                }
                 // TODO(rryan) reserve?
                 m_detectionResults.push_back(
                         m_pDetectionFunction->processTimeDomain(pWindow));
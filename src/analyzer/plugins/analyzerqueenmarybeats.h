@@ -48,6 +48,10 @@ class AnalyzerQueenMaryBeats : public AnalyzerBeatsPlugin {
     mixxx::audio::SampleRate m_sampleRate;
     int m_windowSize;
     int m_stepSizeFrames;
+    // Number of consecutive all-zero analysis windows that have been
+    // processed, used to skip the detection function for long silent
+    // regions once its state has settled.
+    int m_consecutiveSilentWindows;
     std::vector<double> m_detectionResults;
     QVector<mixxx::audio::FramePos> m_resultBeats;
 };
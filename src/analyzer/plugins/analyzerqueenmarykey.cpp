@@ -16,10 +16,20 @@ namespace {
 // Tuning frequency of concert A in Hertz. Default value from VAMP plugin.
 constexpr int kTuningFrequencyHertz = 440;
 
+// GetKeyMode averages the chromagram over windows of this length (the
+// hpcpAverage/medianAverage values of its config, in seconds). After that
+// much consecutive digital silence has been processed, its internal state
+// is saturated with silence: every further silent window returns the same
+// key as the previous one and can be skipped without changing the
+// detected key changes.
+constexpr double kChromaAverageSeconds = 10.0;
+
 } // namespace
 
 AnalyzerQueenMaryKey::AnalyzerQueenMaryKey()
         : m_currentFrame(0),
+          m_consecutiveSilentWindows(0),
+          m_silentWindowsToSettle(0),
           m_prevKey(mixxx::track::io::key::INVALID) {
 }
 
@@ -56,8 +66,27 @@ bool AnalyzerQueenMaryKey::initialize(mixxx::audio::SampleRate sampleRate) {
     size_t windowSize = m_pKeyMode->getBlockSize();
     size_t stepSize = m_pKeyMode->getHopSize();
 
+    m_consecutiveSilentWindows = 0;
+    // Rounded up, one extra window for the rounding inside GetKeyMode.
+    m_silentWindowsToSettle =
+            static_cast<size_t>(kChromaAverageSeconds * sampleRate + stepSize - 1) /
+                    stepSize +
+            1;
+
     return m_helper.initialize(
-            windowSize, stepSize, [this](double* pWindow, size_t) {
+            windowSize, stepSize, [this](double* pWindow, size_t frames) {
+                if (DownmixAndOverlapHelper::isSilentWindow(pWindow, frames)) {
+                    if (m_consecutiveSilentWindows >= m_silentWindowsToSettle) {
+                        // The key mode state is saturated with silence and
+                        // would report the same key as for the previous
+                        // window, so the chromagram analysis can be skipped
+                        // for the remainder of the silent region.
+                        return true;
+                    }
+                    ++m_consecutiveSilentWindows;
+                } else {
+                    m_consecutiveSilentWindows = 0;
+                }
                 int iKey = m_pKeyMode->process(pWindow);
 
                 if (!ChromaticKey_IsValid(iKey)) {
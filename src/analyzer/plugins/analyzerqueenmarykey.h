@@ -42,6 +42,11 @@ class AnalyzerQueenMaryKey : public AnalyzerKeyPlugin {
     std::unique_ptr<GetKeyMode> m_pKeyMode;
     DownmixAndOverlapHelper m_helper;
     size_t m_currentFrame;
+    // Number of consecutive all-zero analysis windows that have been
+    // processed, used to skip the chromagram analysis for long silent
+    // regions once the key mode state is saturated with silence.
+    size_t m_consecutiveSilentWindows;
+    size_t m_silentWindowsToSettle;
     KeyChangeList m_resultKeys;
     mixxx::track::io::key::ChromaticKey m_prevKey;
 };
@@ -1,9 +1,20 @@
 #include "analyzer/plugins/buffering_utils.h"
 
+#include <algorithm>
+
 #include "util/math.h"
 
 namespace mixxx {
 
+namespace {
+
+// Input below this level is gated to digital silence before the analysis.
+// This matches the -60 dB threshold that AnalyzerSilence uses to decide
+// where the sound of a track starts and ends.
+constexpr double kSilenceGateThreshold = 0.001; // -60 dB
+
+} // namespace
+
 bool DownmixAndOverlapHelper::initialize(size_t windowSize,
         size_t stepSize,
         const WindowReadyCallback& callback) {
@@ -45,12 +56,24 @@ bool DownmixAndOverlapHelper::processInner(
         size_t writeAvailable = m_windowSize - m_bufferWritePosition;
         size_t numFrames = math_min(readAvailable, writeAvailable);
         if (pInput) {
+            double maxAbs = 0.0;
             for (size_t i = 0; i < numFrames; ++i) {
                 // We analyze a mono downmix of the signal since we don't think
                 // stereo does us any good.
-                pDownmix[m_bufferWritePosition + i] = (pInput[(inRead + i) * 2] +
-                                                              pInput[(inRead + i) * 2 + 1]) *
+                const double downmix = (pInput[(inRead + i) * 2] +
+                                               pInput[(inRead + i) * 2 + 1]) *
                         0.5;
+                pDownmix[m_bufferWritePosition + i] = downmix;
+                maxAbs = math_max(maxAbs, fabs(downmix));
+            }
+            if (maxAbs < kSilenceGateThreshold) {
+                // The block contains no audible sound. Gate it to digital
+                // silence so that entirely silent windows become detectable
+                // with isSilentWindow() and the decoder noise floor does not
+                // leak into the spectral analysis.
+                std::fill(pDownmix + m_bufferWritePosition,
+                        pDownmix + m_bufferWritePosition + numFrames,
+                        0.0);
             }
         } else {
             // we are in the finalize call. Add silence to
@@ -81,4 +104,14 @@ bool DownmixAndOverlapHelper::processInner(
     return true;
 }
 
+// static
+bool DownmixAndOverlapHelper::isSilentWindow(const double* pWindow, size_t frames) {
+    // The gate above turns sub-threshold blocks into exact zeros, so a
+    // simple comparison suffices here and a window that contains any
+    // audible block is detected as non-silent after a few elements.
+    return std::all_of(pWindow, pWindow + frames, [](double sample) {
+        return sample == 0.0;
+    });
+}
+
 } // namespace mixxx
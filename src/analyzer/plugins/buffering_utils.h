@@ -10,6 +10,12 @@ namespace mixxx {
 // This is used for downmixing a stereo buffer into mono and framing it into
 // overlapping windows as is typically necessary when taking a short-time
 // Fourier transform.
+//
+// Input that stays entirely below the -60 dB silence threshold (the same
+// level at which AnalyzerSilence considers the track silent) is gated to
+// digital silence during the downmix. This turns the residual noise floor
+// of lossy decoders into exact zeros, so that window callbacks can detect
+// silent windows with isSilentWindow() and skip their spectral analysis.
 class DownmixAndOverlapHelper {
   public:
     DownmixAndOverlapHelper() = default;
@@ -27,6 +33,10 @@ class DownmixAndOverlapHelper {
 
     bool finalize();
 
+    /// Returns true if the given analysis window contains only gated
+    /// (= digital) silence.
+    static bool isSilentWindow(const double* pWindow, size_t frames);
+
   private:
     bool processInner(const CSAMPLE* pInput, size_t numInputFrames);
 
@@ -1,15 +1,22 @@
 #include "analyzer/trackanalysisscheduler.h"
 
+#include <QSqlQuery>
+
 #include "analyzer/analyzerscheduledtrack.h"
 #include "analyzer/analyzertrack.h"
+#include "library/queryutil.h"
 #include "moc_trackanalysisscheduler.cpp"
 #include "track/trackid.h"
+#include "util/db/dbconnectionpooled.h"
+#include "util/db/sqltransaction.h"
 #include "util/logger.h"
 
 namespace {
 
 mixxx::Logger kLogger("TrackAnalysisScheduler");
 
+const QString kAnalysisQueueTableName = QStringLiteral("analysis_queue");
+
 constexpr QThread::Priority kWorkerThreadPriority = QThread::LowPriority;
 
 // Maximum frequency of progress updates
@@ -53,6 +60,7 @@ TrackAnalysisScheduler::TrackAnalysisScheduler(
         const UserSettingsPointer& pConfig,
         AnalyzerModeFlags modeFlags)
         : m_pEnvironment(std::move(pEnvironment)),
+          m_database(mixxx::DbConnectionPooled(pDbConnectionPool)),
           m_currentTrackProgress(kAnalyzerProgressUnknown),
           m_currentTrackNumber(0),
           m_dequeuedTracksCount(0),
@@ -220,6 +228,10 @@ void TrackAnalysisScheduler::onWorkerThreadProgress(
             DEBUG_ASSERT((analyzerProgress == kAnalyzerProgressDone) // success
                     || (analyzerProgress == kAnalyzerProgressUnknown)); // failure
             m_pendingTrackIds.erase(trackId);
+            // The analysis of this track is finished (or has failed
+            // unrecoverably) and must not be repeated when resuming an
+            // interrupted batch analysis.
+            removePersistedTrack(trackId);
             worker.onAnalyzerProgress(analyzerProgress);
             emit trackProgress(trackId, analyzerProgress);
         }
@@ -243,6 +255,7 @@ bool TrackAnalysisScheduler::scheduleTrack(AnalyzerScheduledTrack track) {
                 << track.getTrackId();
         return false;
     }
+    insertPersistedTrack(track);
     m_queuedTracks.push_back(track);
     // Don't wake up the suspended thread now to avoid race conditions
     // if multiple threads are added in a row by calling this function
@@ -252,15 +265,106 @@ bool TrackAnalysisScheduler::scheduleTrack(AnalyzerScheduledTrack track) {
 }
 
 int TrackAnalysisScheduler::scheduleTracks(const QList<AnalyzerScheduledTrack>& tracks) {
+    // Batch the queue persistence into a single transaction. Scheduling
+    // a whole library otherwise issues one implicit transaction per track.
+    SqlTransaction transaction(m_database);
     int scheduledCount = 0;
     for (auto track : tracks) {
         if (scheduleTrack(std::move(track))) {
             ++scheduledCount;
         }
     }
+    if (transaction) {
+        transaction.commit();
+    }
     return scheduledCount;
 }
 
+//static
+QList<AnalyzerScheduledTrack> TrackAnalysisScheduler::takePersistedTracks(
+        const QSqlDatabase& database) {
+    QList<AnalyzerScheduledTrack> tracks;
+    if (!database.isOpen()) {
+        return tracks;
+    }
+    QSqlQuery query(database);
+    query.prepare(QStringLiteral(
+            "SELECT track_id, use_fixed_tempo, loudness_only FROM %1 "
+            "ORDER BY position")
+                          .arg(kAnalysisQueueTableName));
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query) << "couldn't load persisted analysis queue";
+        return tracks;
+    }
+    while (query.next()) {
+        const TrackId trackId(query.value(0));
+        if (!trackId.isValid()) {
+            continue;
+        }
+        AnalyzerTrack::Options options;
+        if (!query.value(1).isNull()) {
+            options.useFixedTempo = query.value(1).toBool();
+        }
+        options.loudnessOnly = query.value(2).toBool();
+        tracks.append(AnalyzerScheduledTrack(trackId, options));
+    }
+    if (!tracks.isEmpty()) {
+        QSqlQuery deleteQuery(database);
+        deleteQuery.prepare(QStringLiteral("DELETE FROM %1")
+                                    .arg(kAnalysisQueueTableName));
+        if (!deleteQuery.exec()) {
+            LOG_FAILED_QUERY(deleteQuery) << "couldn't clear persisted analysis queue";
+        }
+    }
+    return tracks;
+}
+
+void TrackAnalysisScheduler::insertPersistedTrack(const AnalyzerScheduledTrack& track) {
+    if (!m_database.isOpen()) {
+        return;
+    }
+    QSqlQuery query(m_database);
+    query.prepare(QStringLiteral(
+            "INSERT INTO %1 (track_id, use_fixed_tempo, loudness_only) "
+            "VALUES (:trackId,:useFixedTempo,:loudnessOnly)")
+                          .arg(kAnalysisQueueTableName));
+    query.bindValue(":trackId", track.getTrackId().toVariant());
+    const AnalyzerTrack::Options& options = track.getOptions();
+    query.bindValue(":useFixedTempo",
+            options.useFixedTempo
+                    ? QVariant(*options.useFixedTempo)
+                    : QVariant(QMetaType(QMetaType::Bool)));
+    query.bindValue(":loudnessOnly", options.loudnessOnly);
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query) << "couldn't persist scheduled track";
+    }
+}
+
+void TrackAnalysisScheduler::removePersistedTrack(TrackId trackId) {
+    if (!m_database.isOpen()) {
+        return;
+    }
+    QSqlQuery query(m_database);
+    query.prepare(QStringLiteral("DELETE FROM %1 WHERE track_id=:trackId")
+                          .arg(kAnalysisQueueTableName));
+    query.bindValue(":trackId", trackId.toVariant());
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query) << "couldn't remove persisted track";
+    }
+}
+
+void TrackAnalysisScheduler::clearPersistedQueue() {
+    if (!m_database.isOpen()) {
+        return;
+    }
+    QSqlQuery query(m_database);
+    query.prepare(QStringLiteral("DELETE FROM %1")
+                          .arg(kAnalysisQueueTableName));
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query) << "couldn't clear persisted analysis queue";
+    }
+}
+
 void TrackAnalysisScheduler::suspend() {
     kLogger.debug() << "Suspending";
     for (auto& worker: m_workers) {
@@ -312,6 +416,7 @@ bool TrackAnalysisScheduler::submitNextTrack(Worker* worker) {
                 kLogger.warning()
                         << "Failed to load track by id"
                         << nextTrackId;
+                removePersistedTrack(nextTrackId);
             }
         } else {
             kLogger.warning()
@@ -334,5 +439,9 @@ void TrackAnalysisScheduler::stop() {
     // and m_workers must not be modified!
     m_queuedTracks.clear();
     m_pendingTrackIds.clear();
+    // Stopping discards all enqueued tracks, including the persisted
+    // copy of the queue. Only a crash or kill of the process leaves the
+    // persisted queue behind for resuming the next session.
+    clearPersistedQueue();
     DEBUG_ASSERT((allTracksFinished()));
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <QList>
+#include <QSqlDatabase>
 #include <deque>
 #include <memory>
 #include <set>
@@ -53,6 +54,14 @@ class TrackAnalysisScheduler : public QObject {
     bool scheduleTrack(AnalyzerScheduledTrack track);
     int scheduleTracks(const QList<AnalyzerScheduledTrack>& tracks);
 
+    // Loads and clears the analysis queue that a previous session has
+    // persisted in the database (see schema table analysis_queue), i.e.
+    // the tracks whose scheduled analysis never completed because the
+    // process was killed or crashed. Rescheduling the returned tracks
+    // with scheduleTracks() persists them again.
+    static QList<AnalyzerScheduledTrack> takePersistedTracks(
+            const QSqlDatabase& database);
+
   public slots:
     void suspend();
 
@@ -142,6 +151,14 @@ class TrackAnalysisScheduler : public QObject {
     bool submitNextTrack(Worker* worker);
     void emitProgressOrFinished();
 
+    // Mirror the in-memory queue and the pending tracks in the database
+    // so that an interrupted batch analysis survives a crash or kill of
+    // the process. A regular stop() discards the persisted queue along
+    // with the in-memory queue.
+    void insertPersistedTrack(const AnalyzerScheduledTrack& track);
+    void removePersistedTrack(TrackId trackId);
+    void clearPersistedQueue();
+
     bool allTracksFinished() const {
         return m_queuedTracks.empty() &&
                 m_pendingTrackIds.empty();
@@ -149,6 +166,9 @@ class TrackAnalysisScheduler : public QObject {
 
     const std::unique_ptr<const TrackAnalysisSchedulerEnvironment> m_pEnvironment;
 
+    // Database connection of the host thread for persisting the queue
+    QSqlDatabase m_database;
+
     std::vector<Worker> m_workers;
 
     std::deque<AnalyzerScheduledTrack> m_queuedTracks;
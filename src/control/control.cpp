@@ -1,7 +1,10 @@
 #include "control/control.h"
 
+#include <QVector>
+
 #include "control/controlobject.h"
 #include "moc_control.cpp"
+#include "util/memorylock.h"
 #include "util/mutex.h"
 #include "util/stat.h"
 
@@ -39,6 +42,41 @@ QHash<ConfigKey, ConfigKey> s_qCOAliasHash
 
 /// is used instead of a nullptr, helps to omit null checks everywhere
 QWeakPointer<ControlDoublePrivate> s_pDefaultCO;
+
+/// Flat, index-based table of control values for the engine hot path.
+/// Controls claim a slot at creation (single writer, guarded by
+/// s_qCOHashMutex) and release it on destruction; indices of deleted
+/// controls are recycled. Readers are lock-free: one acquire-load of the
+/// slot pointer plus the atomic value read, without touching s_qCOHash or
+/// comparing ConfigKeys. This keeps the engine callback latency flat even
+/// while skins or controller scripts create controls concurrently.
+constexpr int kControlIndexCapacity = 1 << 16;
+
+QAtomicPointer<ControlValueAtomic<double>> s_controlValueTable[kControlIndexCapacity];
+
+int s_nextControlIndex GUARDED_BY(s_qCOHashMutex) = 0;
+
+QVector<int> s_freeControlIndices GUARDED_BY(s_qCOHashMutex);
+
+int allocateControlIndex(ControlValueAtomic<double>* pValue) {
+    MMutexLocker locker(&s_qCOHashMutex);
+    int index;
+    if (!s_freeControlIndices.isEmpty()) {
+        index = s_freeControlIndices.takeLast();
+    } else if (s_nextControlIndex < kControlIndexCapacity) {
+        index = s_nextControlIndex++;
+    } else {
+        // The control falls back to the hash-only path; only its index
+        // based reads are affected.
+        qWarning() << "ControlIndex capacity exhausted, control not added"
+                   << "to the flat value table";
+        DEBUG_ASSERT(!"ControlIndex capacity exhausted");
+        return -1;
+    }
+    s_controlValueTable[index].storeRelease(pValue);
+    return index;
+}
+
 } // namespace
 
 // TODO: re-evaluate whether this is needed.
@@ -59,6 +97,7 @@ ControlDoublePrivate::ControlDoublePrivate(
           m_description(QString()),
           m_value(defaultValue),
           m_defaultValue(defaultValue),
+          m_index(allocateControlIndex(&m_value)),
           m_pCreatorCO(pCreatorCO),
           m_trackingKey(bTrack ? statTrackingKey.arg(key.group, key.item) : QString()),
           m_confirmRequired(confirmRequired),
@@ -83,6 +122,12 @@ ControlDoublePrivate::~ControlDoublePrivate() {
     s_qCOHashMutex.lock();
     //qDebug() << "ControlDoublePrivate::s_qCOHash.remove(" << m_key.group << "," << m_key.item << ")";
     s_qCOHash.remove(m_key);
+    // Release the flat value table slot for recycling. Readers holding a
+    // stale index see a cleared slot and get the default value.
+    if (m_index.valid()) {
+        s_controlValueTable[m_index.handle()].storeRelease(nullptr);
+        s_freeControlIndices.append(m_index.handle());
+    }
     s_qCOHashMutex.unlock();
 
     if (m_bPersistInConfiguration) {
@@ -247,6 +292,26 @@ QList<QSharedPointer<ControlDoublePrivate>> ControlDoublePrivate::takeAllInstanc
     return result;
 }
 
+//static
+double ControlDoublePrivate::getByIndex(ControlIndex index) {
+    if (!index.valid() || index.handle() >= kControlIndexCapacity) {
+        return kDefaultValue;
+    }
+    const ControlValueAtomic<double>* pValue =
+            s_controlValueTable[index.handle()].loadAcquire();
+    if (pValue == nullptr) {
+        return kDefaultValue;
+    }
+    return pValue->getValue();
+}
+
+//static
+void ControlDoublePrivate::lockValueTableMemory() {
+    mixxx::MemoryLock::lockAndPrefault(s_controlValueTable,
+            sizeof(s_controlValueTable),
+            "control value table");
+}
+
 //static
 QHash<ConfigKey, ConfigKey> ControlDoublePrivate::getControlAliases() {
     MMutexLocker locker(&s_qCOHashMutex);
@@ -7,6 +7,7 @@
 #include <QString>
 
 #include "control/controlbehavior.h"
+#include "control/controlindex.h"
 #include "control/controlvalue.h"
 #include "preferences/usersettings.h"
 
@@ -66,6 +67,17 @@ class ControlDoublePrivate : public QObject {
 
     static QHash<ConfigKey, ConfigKey> getControlAliases();
 
+    // Lock-free read of the value of the control with the given index,
+    // bypassing the s_qCOHash lookup and ConfigKey comparison entirely.
+    // Returns kDefaultValue for invalid or released indices. Safe to call
+    // from the engine callback; resolve the index once at creation time via
+    // getIndex() and keep the control alive while reading through it.
+    static double getByIndex(ControlIndex index);
+
+    // Locks the flat control value table into physical memory when
+    // memory locking is enabled. Called once at startup.
+    static void lockValueTableMemory();
+
     const QString& name() const {
         return m_name;
     }
@@ -143,6 +155,12 @@ class ControlDoublePrivate : public QObject {
         return m_key;
     }
 
+    // The dense index assigned to this control at creation. Valid for the
+    // lifetime of this control; see getByIndex().
+    ControlIndex getIndex() const {
+        return m_index;
+    }
+
     // Connects a slot to the ValueChange request for CO validation. All change
     // requests issued by set are routed though the connected slot. This can
     // decide with its own thread safe solution if the requested value can be
@@ -199,6 +217,10 @@ class ControlDoublePrivate : public QObject {
     // The default control value.
     ControlValueAtomic<double> m_defaultValue;
 
+    // The dense slot in the flat control value table (see control.cpp).
+    // Initialized after m_value because the table slot points at it.
+    const ControlIndex m_index;
+
     QAtomicPointer<ControlObject> m_pCreatorCO;
 
     // name of the key to track using stats framework, unless the m_trackingKey isNull().
@@ -0,0 +1,47 @@
+#pragma once
+
+// ControlIndex is a dense, process-wide identifier for a control value.
+// Every ControlDoublePrivate is assigned an index at creation, starting at 0
+// and recycling indices of deleted controls. The index addresses a slot in a
+// flat table of control values (see control.cpp), so the engine callback can
+// read a control with a single array load instead of a QHash lookup plus
+// ConfigKey (QString) comparison guarded by a mutex.
+//
+// This mirrors the ChannelHandle scheme used to identify engine channels
+// (see engine/channelhandle.h).
+//
+// An index stays valid as long as the control it was resolved from is alive.
+// Callers must keep the control alive (e.g. via a ControlObject or
+// ControlProxy member) while reading through its index; reads through a
+// released index return the default value.
+class ControlIndex {
+  public:
+    ControlIndex()
+            : m_iIndex(-1) {
+    }
+
+    inline bool valid() const {
+        return m_iIndex >= 0;
+    }
+
+    inline int handle() const {
+        return m_iIndex;
+    }
+
+  private:
+    explicit ControlIndex(int iIndex)
+            : m_iIndex(iIndex) {
+    }
+
+    int m_iIndex;
+
+    friend class ControlDoublePrivate;
+};
+
+inline bool operator==(const ControlIndex& index1, const ControlIndex& index2) {
+    return index1.handle() == index2.handle();
+}
+
+inline bool operator!=(const ControlIndex& index1, const ControlIndex& index2) {
+    return index1.handle() != index2.handle();
+}
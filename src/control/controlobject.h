@@ -85,6 +85,20 @@ class ControlObject : public QObject {
         return get() > 0.0;
     }
 
+    // Returns the dense index assigned to the underlying control at
+    // creation. The index stays valid while this ControlObject is alive and
+    // can be read via getByIndex() without any hash lookup or ConfigKey
+    // comparison, see control/controlindex.h.
+    ControlIndex getIndex() const {
+        return m_pControl ? m_pControl->getIndex() : ControlIndex();
+    }
+
+    // Lock-free read of the control value for an index resolved via
+    // getIndex(). Safe to call from the engine callback.
+    static double getByIndex(ControlIndex index) {
+        return ControlDoublePrivate::getByIndex(index);
+    }
+
     // Instantly returns the value of the ControlObject
     static double get(const ConfigKey& key);
 
@@ -113,6 +113,14 @@ class ControlProxy : public QObject {
         return m_pControl->get();
     }
 
+    /// Returns the dense index assigned to the underlying control at
+    /// creation. The index stays valid while this ControlProxy is alive and
+    /// can be read via ControlObject::getByIndex() without any hash lookup
+    /// or ConfigKey comparison, see control/controlindex.h.
+    ControlIndex getIndex() const {
+        return m_pControl ? m_pControl->getIndex() : ControlIndex();
+    }
+
     /// Returns the bool interpretation of the value. Thread safe, non-blocking.
     inline bool toBool() const {
         return get() > 0.0;
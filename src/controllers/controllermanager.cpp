@@ -8,6 +8,7 @@
 #include "controllers/controllermappinginfoenumerator.h"
 #include "controllers/defs_controllers.h"
 #include "controllers/legacycontrollermappingfilehandler.h"
+#include "controllers/scripting/controllerscriptenginebase.h"
 #include "moc_controllermanager.cpp"
 #include "preferences/usersettings.h"
 #include "util/cmdlineargs.h"
@@ -96,8 +97,7 @@ ControllerManager::ControllerManager(UserSettingsPointer pConfig)
           // ControllerManager because the CM is moved to its own thread and runs
           // its own event loop.
           m_pControllerLearningEventFilter(new ControllerLearningEventFilter()),
-          m_pollTimer(this),
-          m_skipPoll(false) {
+          m_pollTimer(this) {
     qRegisterMetaType<std::shared_ptr<LegacyControllerMapping>>(
             "std::shared_ptr<LegacyControllerMapping>");
 
@@ -168,6 +168,12 @@ void ControllerManager::slotInitialize() {
 #ifdef __HID__
     m_enumerators.append(new HidEnumerator());
 #endif
+
+    // Pre-construct a script engine on this thread so that the first
+    // mapping load does not pay for engine construction while polling
+    // is stalled.
+    ControllerScriptEngineBase::prewarmJSEngine();
+
     emit initialized();
 }
 
@@ -353,34 +359,37 @@ void ControllerManager::slotPollDevices() {
     // receive buffer is stacked up every call to insane values > 500 messages.
     //
     // To avoid this we pick here a strategies similar like the audio
-    // thread. In case pollDevice() takes longer than a call cycle
-    // we are cooperative a skip the next cycle to free at least some
-    // CPU time
+    // thread. In case polling a device takes longer than a call cycle
+    // we are cooperative and skip its next cycle to free at least some
+    // CPU time. The skip is tracked per device, so one controller with a
+    // busy mapping script cannot starve the input processing of the other
+    // controllers sharing this thread.
     //
     // Some random test data from a i5-3317U CPU @ 1.70GHz Running
     // Ubuntu Trusty:
     // * Idle poll: ~5 µs.
     // * 5 messages burst (full midi bandwidth): ~872 µs.
 
-    if (m_skipPoll) {
-        // skip poll in overload situation
-        m_skipPoll = false;
-        //qDebug() << "ControllerManager::pollDevices() skip";
-        return;
-    }
+    const QSet<Controller*> skipControllers = std::move(m_skipPollControllers);
+    m_skipPollControllers.clear();
 
-    mixxx::Duration start = mixxx::Time::elapsed();
+    mixxx::Duration lastPollEnd = mixxx::Time::elapsed();
     for (Controller* pDevice : std::as_const(m_controllers)) {
-        if (pDevice->isOpen() && pDevice->isPolling()) {
-            pDevice->poll();
+        if (!pDevice->isOpen() || !pDevice->isPolling()) {
+            continue;
         }
+        if (skipControllers.contains(pDevice)) {
+            // skip poll of this device in overload situation
+            //qDebug() << "ControllerManager::pollDevices() skip" << pDevice->getName();
+            continue;
+        }
+        pDevice->poll();
+        const mixxx::Duration pollEnd = mixxx::Time::elapsed();
+        if (pollEnd - lastPollEnd > kPollInterval) {
+            m_skipPollControllers.insert(pDevice);
+        }
+        lastPollEnd = pollEnd;
     }
-
-    mixxx::Duration duration = mixxx::Time::elapsed() - start;
-    if (duration > kPollInterval) {
-        m_skipPoll = true;
-    }
-    //qDebug() << "ControllerManager::pollDevices()" << duration << start;
 }
 
 void ControllerManager::openController(Controller* pController) {
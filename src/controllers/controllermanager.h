@@ -1,6 +1,7 @@
 #pragma once
 
 #include <QMutex>
+#include <QSet>
 #include <QSharedPointer>
 #include <QTimer>
 #include <memory>
@@ -86,5 +87,7 @@ class ControllerManager : public QObject {
     QThread* m_pThread;
     QSharedPointer<MappingInfoEnumerator> m_pMainThreadUserMappingEnumerator;
     QSharedPointer<MappingInfoEnumerator> m_pMainThreadSystemMappingEnumerator;
-    bool m_skipPoll;
+    // Controllers whose previous poll overran the polling interval and
+    // that sit out the next polling cycle.
+    QSet<Controller*> m_skipPollControllers;
 };
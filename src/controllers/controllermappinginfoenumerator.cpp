@@ -50,6 +50,11 @@ void MappingInfoEnumerator::loadSupportedMappings() {
     m_hidMappings.clear();
     m_bulkMappings.clear();
 
+    // Rebuilt from scratch on every enumeration so that entries of deleted
+    // mapping files do not accumulate; unchanged entries are moved over
+    // from the previous cache without re-parsing their XML.
+    QHash<QString, CachedMappingInfo> parsedMappings;
+
     for (const QString& dirPath : std::as_const(m_controllerDirPaths)) {
         QDirIterator it(dirPath);
         while (it.hasNext()) {
@@ -57,15 +62,37 @@ void MappingInfoEnumerator::loadSupportedMappings() {
             const QFileInfo fileInfo = it.fileInfo();
             const QString path = fileInfo.filePath();
 
+            QList<MappingInfo>* pMappings = nullptr;
             if (path.endsWith(MIDI_MAPPING_EXTENSION, Qt::CaseInsensitive)) {
-                m_midiMappings.append(MappingInfo(fileInfo));
+                pMappings = &m_midiMappings;
             } else if (path.endsWith(HID_MAPPING_EXTENSION, Qt::CaseInsensitive)) {
-                m_hidMappings.append(MappingInfo(fileInfo));
+                pMappings = &m_hidMappings;
             } else if (path.endsWith(BULK_MAPPING_EXTENSION, Qt::CaseInsensitive)) {
-                m_bulkMappings.append(MappingInfo(fileInfo));
+                pMappings = &m_bulkMappings;
+            } else {
+                continue;
+            }
+
+            // Only re-parse the info header if the file has changed since
+            // the last enumeration.
+            const auto cachedIt = m_parsedMappings.constFind(path);
+            if (cachedIt != m_parsedMappings.constEnd() &&
+                    cachedIt->lastModified == fileInfo.lastModified() &&
+                    cachedIt->size == fileInfo.size()) {
+                pMappings->append(cachedIt->info);
+                parsedMappings.insert(path, *cachedIt);
+                continue;
             }
+
+            const MappingInfo mappingInfo(fileInfo);
+            pMappings->append(mappingInfo);
+            parsedMappings.insert(path,
+                    CachedMappingInfo{fileInfo.lastModified(),
+                            fileInfo.size(),
+                            mappingInfo});
         }
     }
+    m_parsedMappings = std::move(parsedMappings);
 
     std::sort(m_midiMappings.begin(), m_midiMappings.end(), mappingInfoNameComparator);
     std::sort(m_hidMappings.begin(), m_hidMappings.end(), mappingInfoNameComparator);
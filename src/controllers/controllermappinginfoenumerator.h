@@ -1,5 +1,7 @@
 #pragma once
 
+#include <QDateTime>
+#include <QHash>
 #include <QList>
 #include <QString>
 #include <QStringList>
@@ -17,9 +19,21 @@ class MappingInfoEnumerator {
     void loadSupportedMappings();
 
   private:
+    // Parsed info header of a mapping file together with the file stamp
+    // it was parsed from, so that re-enumerations (e.g. on every open of
+    // the controller preferences) only have to stat the files and can
+    // skip re-parsing unchanged ones.
+    struct CachedMappingInfo {
+        QDateTime lastModified;
+        qint64 size;
+        MappingInfo info;
+    };
+
     // List of paths for controller mappings
     QList<QString> m_controllerDirPaths;
 
+    QHash<QString, CachedMappingInfo> m_parsedMappings;
+
     QList<MappingInfo> m_hidMappings;
     QList<MappingInfo> m_midiMappings;
     QList<MappingInfo> m_bulkMappings;
@@ -283,9 +283,9 @@ int HidController::open(const QString& resourcePath) {
     m_pHidIoThread->setObjectName(QStringLiteral("HidIoThread ") + getName());
 
     connect(m_pHidIoThread.get(),
-            &HidIoThread::receive,
+            &HidIoThread::inputReportsAvailable,
             this,
-            &HidController::receive,
+            &HidController::slotInputReportsAvailable,
             Qt::QueuedConnection);
 
     // Controller input needs to be prioritized since it can affect the
@@ -380,6 +380,18 @@ int HidController::close() {
     return 0;
 }
 
+void HidController::slotInputReportsAvailable() {
+    VERIFY_OR_DEBUG_ASSERT(m_pHidIoThread) {
+        return;
+    }
+    // Process all InputReports of the batch in one slot invocation instead
+    // of one queued signal dispatch per report.
+    HidIoInputReport report;
+    while (m_pHidIoThread->inputReportFifo()->readReportFromFifo(&report)) {
+        receive(report.data, report.timestamp);
+    }
+}
+
 /// This function is only for class compatibility with the (midi)controller
 /// and will not do the same as for MIDI devices,
 /// because sending of raw bytes is not a supported HIDAPI feature.
@@ -100,6 +100,11 @@ class HidController final : public Controller {
     // opened for real.
     void fetchReportDescriptorInBackground();
 
+  private slots:
+    /// Drains all InputReports the IO thread has batched into its lock-free
+    /// FIFO since the last wakeup and forwards them to the mapping.
+    void slotInputReportsAvailable();
+
   private:
     int open(const QString& resourcePath) override;
     int close() override;
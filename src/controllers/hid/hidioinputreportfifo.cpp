@@ -0,0 +1,64 @@
+#include "controllers/hid/hidioinputreportfifo.h"
+
+#include <utility>
+
+#include "controllers/hid/hiddevice.h"
+#include "util/runtimeloggingcategory.h"
+
+namespace {
+constexpr size_t kSizeOfFifoInReports = 128;
+} // namespace
+
+HidIoInputReportFifo::HidIoInputReportFifo()
+        : m_fifoQueue(kSizeOfFifoInReports),
+          m_wakeupPending(false),
+          m_fifoOverflowLogged(false) {
+}
+
+bool HidIoInputReportFifo::addReportToFifo(const QByteArray& data,
+        mixxx::Duration timestamp,
+        const mixxx::hid::DeviceInfo& deviceInfo,
+        const RuntimeLoggingCategory& logInput) {
+    const bool success = m_fifoQueue.try_emplace(HidIoInputReport{data, timestamp});
+
+    // Handle the case, that the FIFO queue is full - which is an error case
+    if (!success) {
+        // The FIFO is only full when the controller thread can not keep up
+        // with the rate of incoming InputReports. Skip the report instead of
+        // blocking the IO thread, to not delay OutputReport sending.
+        if (!m_fifoOverflowLogged) {
+            qCWarning(logInput)
+                    << "FIFO overflow: Skipping InputReport from"
+                    << deviceInfo.formatName()
+                    << "Note that, this message is only logged once and may "
+                       "not appear again until the controller thread has "
+                       "caught up.";
+            // Stop logging error messages while the FIFO stays full to avoid large log files
+            m_fifoOverflowLogged = true;
+        }
+        return false;
+    }
+    m_fifoOverflowLogged = false;
+
+    // Only request a wakeup of the controller thread for the first report of
+    // a batch. The controller thread drains the complete FIFO per wakeup, so
+    // further wakeups would only queue empty slot invocations.
+    return !m_wakeupPending.exchange(true);
+}
+
+bool HidIoInputReportFifo::readReportFromFifo(HidIoInputReport* pReport) {
+    HidIoInputReport* pFront = m_fifoQueue.front();
+    if (pFront == nullptr) {
+        m_wakeupPending.store(false);
+        // Re-check after clearing the wakeup flag: the IO thread may have
+        // added a report between the emptiness check above and clearing the
+        // flag, and then skipped the wakeup because the flag was still set.
+        pFront = m_fifoQueue.front();
+        if (pFront == nullptr) {
+            return false;
+        }
+    }
+    *pReport = std::move(*pFront);
+    m_fifoQueue.pop();
+    return true;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <QByteArray>
+#include <atomic>
+
+#include "rigtorp/SPSCQueue.h"
+#include "util/duration.h"
+
+struct RuntimeLoggingCategory;
+
+namespace mixxx {
+namespace hid {
+class DeviceInfo;
+} // namespace hid
+} // namespace mixxx
+
+/// A timestamped HID InputReport, as passed from the IO thread to the
+/// controller thread through HidIoInputReportFifo.
+struct HidIoInputReport {
+    QByteArray data;
+    mixxx::Duration timestamp;
+};
+
+/// Stores timestamped InputReports in First In / First Out (FIFO) order,
+/// for batched transfer from the IO thread to the controller thread.
+///
+/// Reports received in quick succession are delivered to the controller
+/// thread as one batch: the IO thread only requests a wakeup of the
+/// controller thread for the first report of a batch, and the controller
+/// thread drains the whole FIFO per wakeup. This avoids one queued signal
+/// dispatch per InputReport for high-rate input such as jog wheel reports.
+class HidIoInputReportFifo {
+  public:
+    HidIoInputReportFifo();
+
+    /// Appends a timestamped InputReport to the FIFO. Called from the IO
+    /// thread. Returns true if the controller thread has to be woken up to
+    /// process the batch, false if a wakeup is already pending.
+    bool addReportToFifo(const QByteArray& data,
+            mixxx::Duration timestamp,
+            const mixxx::hid::DeviceInfo& deviceInfo,
+            const RuntimeLoggingCategory& logInput);
+
+    /// Takes the oldest InputReport out of the FIFO. Called from the
+    /// controller thread. Returns false if the FIFO is empty.
+    bool readReportFromFifo(HidIoInputReport* pReport);
+
+  private:
+    // Lockless FIFO queue
+    rigtorp::SPSCQueue<HidIoInputReport> m_fifoQueue;
+    /// True while a wakeup of the controller thread is pending, i.e. from
+    /// the first report of a batch until the controller thread has drained
+    /// the FIFO.
+    std::atomic<bool> m_wakeupPending;
+    bool m_fifoOverflowLogged;
+};
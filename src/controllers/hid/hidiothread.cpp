@@ -160,11 +160,18 @@ void HidIoThread::processInputReport(int bytesRead) {
     m_pollingBufferIndex = (m_pollingBufferIndex + 1) % kNumBuffers;
     m_lastPollSize = bytesRead;
 
-    // Convert array of bytes read in a JavaScript compatible return type, this is emitted as deep-copy, for thread safety.
-    // This eexecute callback function in JavaScript mapping and print to stdout in case of --controllerDebug
-    emit receive(QByteArray(reinterpret_cast<const char*>(pCurrentBuffer),
-                         bytesRead),
-            mixxx::Time::elapsed());
+    // Convert array of bytes read in a JavaScript compatible return type, this is added as
+    // deep-copy to the lock-free input FIFO, for thread safety. The controller thread is only
+    // woken up for the first report of a batch and executes the callback function in the
+    // JavaScript mapping for all reports of the batch in one slot invocation.
+    if (m_inputReportFifo.addReportToFifo(
+                QByteArray(reinterpret_cast<const char*>(pCurrentBuffer),
+                        bytesRead),
+                mixxx::Time::elapsed(),
+                m_deviceInfo,
+                m_logInput)) {
+        emit inputReportsAvailable();
+    }
 
     if (m_deviceUsesReportIds.has_value() && bytesRead > 0) {
         if (m_deviceUsesReportIds.value()) {
@@ -6,6 +6,7 @@
 
 #include "controllers/hid/hiddevice.h"
 #include "controllers/hid/hidioglobaloutputreportfifo.h"
+#include "controllers/hid/hidioinputreportfifo.h"
 #include "controllers/hid/hidiooutputreport.h"
 #include "util/compatibility/qmutex.h"
 #include "util/duration.h"
@@ -50,6 +51,12 @@ class HidIoThread : public QThread {
     void sendFeatureReport(quint8 reportID, const QByteArray& reportData);
     QByteArray getFeatureReport(quint8 reportID);
 
+    /// Lock-free FIFO of timestamped InputReports, drained by the
+    /// controller thread on each inputReportsAvailable() wakeup.
+    HidIoInputReportFifo* inputReportFifo() {
+        return &m_inputReportFifo;
+    }
+
 #ifdef Q_OS_ANDROID
     // On Android, we open a connection to the device in JNI. we must keep the
     // object alive and referenced to prevent GC and file descriptor being
@@ -60,8 +67,11 @@ class HidIoThread : public QThread {
 #endif
 
   signals:
-    /// Signals that a HID InputReport received by Interrupt triggered from HID device
-    void receive(const QByteArray& data, mixxx::Duration timestamp);
+    /// Signals that one or more HID InputReports received by Interrupt
+    /// triggered from the HID device are available in inputReportFifo().
+    /// Only emitted for the first report of a batch, the receiver drains
+    /// the whole FIFO per invocation.
+    void inputReportsAvailable();
     void reportReceived(quint8 reportId, const QByteArray& data);
 
   private:
@@ -108,6 +118,8 @@ class HidIoThread : public QThread {
 
     HidIoGlobalOutputReportFifo m_globalOutputReportFifo;
 
+    HidIoInputReportFifo m_inputReportFifo;
+
     /// State of the HidIoThread lifecycle
     QAtomicInt m_state;
 
@@ -17,9 +17,11 @@ PortMidiController::PortMidiController(const PmDeviceInfo* inputDeviceInfo,
                                             : outputDeviceInfo->name)
                           : kUnknownControllerName),
           m_cReceiveMsg_index(0),
-          m_bInSysex(false) {
+          m_bInSysex(false),
+          m_outgoingIndex(0) {
     for (int k = 0; k < MIXXX_PORTMIDI_BUFFER_LEN; ++k) {
         m_midiBuffer[k] = {0, 0};
+        m_outgoingBuffer[k] = {0, 0};
     }
 
     // Note: We prepend the input stream's index to the device's name to prevent
@@ -93,6 +95,10 @@ int PortMidiController::close() {
     stopEngine();
     MidiController::close();
 
+    // The shutdown sequence of the mapping may have queued final messages
+    // (e.g. turning all LEDs off). Get them onto the wire before closing.
+    flushOutgoingMessages();
+
     int result = 0;
 
     if (m_pInputDevice && m_pInputDevice->isOpen()) {
@@ -116,6 +122,10 @@ int PortMidiController::close() {
 }
 
 bool PortMidiController::poll() {
+    // Send everything queued since the last tick as one batch. This runs
+    // before the input early-return so output-only devices are flushed, too.
+    flushOutgoingMessages();
+
     // Poll the controller for new data if it's an input device
     if (m_pInputDevice.isNull() || !m_pInputDevice->isOpen()) {
         return false;
@@ -200,26 +210,42 @@ void PortMidiController::sendShortMsg(unsigned char status, unsigned char byte1,
     unsigned int word = (((unsigned int)byte2) << 16) |
                          (((unsigned int)byte1) << 8) | status;
 
-    PmError err = m_pOutputDevice->writeShort(word);
-    if (err == pmNoError) {
-        qCDebug(m_logOutput) << QStringLiteral("outgoing: ")
-                             << MidiUtils::formatMidiOpCode(getName(),
-                                        status,
-                                        byte1,
-                                        byte2,
-                                        MidiUtils::channelFromStatus(status),
-                                        MidiUtils::opCodeFromStatus(status));
-    } else {
+    if (m_outgoingIndex >= MIXXX_PORTMIDI_BUFFER_LEN) {
+        // More messages queued up within a single tick than the device can
+        // take per tick anyway. Push them out now to make room.
+        flushOutgoingMessages();
+    }
+    m_outgoingBuffer[m_outgoingIndex].message = static_cast<PmMessage>(word);
+    m_outgoingBuffer[m_outgoingIndex].timestamp = 0;
+    m_outgoingIndex++;
+
+    qCDebug(m_logOutput) << QStringLiteral("outgoing: ")
+                         << MidiUtils::formatMidiOpCode(getName(),
+                                    status,
+                                    byte1,
+                                    byte2,
+                                    MidiUtils::channelFromStatus(status),
+                                    MidiUtils::opCodeFromStatus(status));
+}
+
+void PortMidiController::flushOutgoingMessages() {
+    if (m_outgoingIndex == 0) {
+        return;
+    }
+
+    if (m_pOutputDevice.isNull() || !m_pOutputDevice->isOpen()) {
+        m_outgoingIndex = 0;
+        return;
+    }
+
+    PmError err = m_pOutputDevice->write(m_outgoingBuffer, m_outgoingIndex);
+    if (err != pmNoError) {
         // Use two qWarnings() to ensure line break works on all operating systems
-        qCWarning(m_logOutput) << "Error sending short message"
-                               << MidiUtils::formatMidiOpCode(getName(),
-                                          status,
-                                          byte1,
-                                          byte2,
-                                          MidiUtils::channelFromStatus(status),
-                                          MidiUtils::opCodeFromStatus(status));
+        qCWarning(m_logOutput) << "Error sending" << m_outgoingIndex
+                               << "queued short messages";
         qCWarning(m_logOutput) << "PortMidi error:" << Pm_GetErrorText(err);
     }
+    m_outgoingIndex = 0;
 }
 
 bool PortMidiController::sendBytes(const QByteArray& data) {
@@ -236,6 +262,10 @@ bool PortMidiController::sendBytes(const QByteArray& data) {
         return false;
     }
 
+    // Keep the wire order: short messages queued before this SysEx must
+    // arrive before it.
+    flushOutgoingMessages();
+
     PmError err = m_pOutputDevice->writeSysEx((unsigned char*)data.constData());
     if (err == pmNoError) {
         qCDebug(m_logOutput) << QStringLiteral("outgoing: ")
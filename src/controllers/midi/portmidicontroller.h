@@ -90,6 +90,10 @@ class PortMidiController : public MidiController {
 
   protected:
     // MockPortMidiController needs this to not be private.
+    // Short messages are not written out immediately but collected in
+    // m_outgoingBuffer and sent as a single multi-event transfer on the next
+    // poll() tick. Dense LED/VU feedback otherwise degenerates into one USB
+    // transfer per message and saturates slow devices.
     void sendShortMsg(unsigned char status, unsigned char byte1,
                       unsigned char byte2) override;
 
@@ -105,6 +109,9 @@ class PortMidiController : public MidiController {
         return true;
     }
 
+    // Writes all queued outgoing short messages in one batch.
+    void flushOutgoingMessages();
+
     // For testing only so that test fixtures can install mock PortMidiDevices.
     void setPortMidiInputDevice(PortMidiDevice* device) {
         m_pInputDevice.reset(device);
@@ -118,6 +125,10 @@ class PortMidiController : public MidiController {
 
     PmEvent m_midiBuffer[MIXXX_PORTMIDI_BUFFER_LEN];
 
+    // Outgoing short messages queued since the last poll() tick
+    PmEvent m_outgoingBuffer[MIXXX_PORTMIDI_BUFFER_LEN];
+    int m_outgoingIndex;
+
     // Storage for SysEx messages
     unsigned char m_cReceiveMsg[MIXXX_SYSEX_BUFFER_LEN];
     int m_cReceiveMsg_index;
@@ -62,6 +62,10 @@ class PortMidiDevice {
         return Pm_WriteShort(m_pStream, 0, message);
     }
 
+    virtual PmError write(PmEvent* events, int32_t length) {
+        return Pm_Write(m_pStream, events, length);
+    }
+
     virtual PmError writeSysEx(unsigned char* message) {
         return Pm_WriteSysEx(m_pStream, 0, message);
     }
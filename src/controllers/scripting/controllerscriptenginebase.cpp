@@ -1,6 +1,7 @@
 #include "controllers/scripting/controllerscriptenginebase.h"
 
 #include <QJSEngine>
+#include <QTimer>
 
 #include "controllers/controller.h"
 #include "controllers/scripting/colormapperjsproxy.h"
@@ -15,6 +16,17 @@
 #endif
 #include "util/cmdlineargs.h"
 
+namespace {
+
+// One pre-constructed spare engine per thread. Constructing a QJSEngine
+// and installing its extensions takes a noticeable amount of time, and
+// while a mapping is being applied the controller thread cannot poll
+// any of the other attached devices. Keeping a warm spare moves the
+// construction cost out of the hotplug/apply path.
+thread_local std::unique_ptr<QJSEngine> s_pSpareJSEngine;
+
+} // namespace
+
 ControllerScriptEngineBase::ControllerScriptEngineBase(
         Controller* controller, const RuntimeLoggingCategory& logger)
         : m_bDisplayingExceptionDialog(false),
@@ -40,6 +52,16 @@ void ControllerScriptEngineBase::registerTrackCollectionManager(
     s_pTrackCollectionManager = std::move(pTrackCollectionManager);
 }
 
+// static
+void ControllerScriptEngineBase::prewarmJSEngine() {
+    if (s_pSpareJSEngine) {
+        return;
+    }
+    auto pEngine = std::make_unique<QJSEngine>();
+    pEngine->installExtensions(QJSEngine::ConsoleExtension);
+    s_pSpareJSEngine = std::move(pEngine);
+}
+
 #ifdef MIXXX_USE_QML
 void ControllerScriptEngineBase::handleQMLErrors(const QList<QQmlError>& qmlErrors) {
     for (const QQmlError& error : std::as_const(qmlErrors)) {
@@ -59,9 +81,18 @@ bool ControllerScriptEngineBase::initialize() {
 #ifdef MIXXX_USE_QML
     if (!m_bQmlMode) {
 #endif
-        m_pJSEngine = std::make_shared<QJSEngine>(this);
+        if (s_pSpareJSEngine) {
+            // Adopt the pre-constructed engine and replenish the spare
+            // once the event loop is idle again, i.e. after the mapping
+            // has been applied and the device has been opened.
+            s_pSpareJSEngine->setParent(this);
+            m_pJSEngine = std::shared_ptr<QJSEngine>(s_pSpareJSEngine.release());
+            QTimer::singleShot(0, this, [] { prewarmJSEngine(); });
+        } else {
+            m_pJSEngine = std::make_shared<QJSEngine>(this);
 
-        m_pJSEngine->installExtensions(QJSEngine::ConsoleExtension);
+            m_pJSEngine->installExtensions(QJSEngine::ConsoleExtension);
+        }
 #ifdef MIXXX_USE_QML
     } else {
         auto pQmlEngine = std::make_shared<QQmlEngine>(this);
@@ -60,6 +60,13 @@ class ControllerScriptEngineBase : public QObject {
     static void registerTrackCollectionManager(
             std::shared_ptr<TrackCollectionManager> pTrackCollectionManager);
 
+    /// Pre-constructs a spare QJSEngine on the calling thread so that the
+    /// next mapping load can adopt it instead of constructing its own.
+    /// Called from the controller thread once its event loop is running;
+    /// afterwards the spare is replenished automatically whenever a
+    /// mapping load has consumed it.
+    static void prewarmJSEngine();
+
   signals:
     void beforeShutdown();
 
@@ -1,13 +1,17 @@
 #include "controllerscriptinterfacelegacy.h"
 
 #include <QStringEncoder>
+#include <cstring>
 #include <gsl/pointers>
+#include <utility>
 
 #include "control/controlobject.h"
 #include "control/controlobjectscript.h"
 #include "control/controlpotmeter.h"
 #include "controllers/scripting/legacy/controllerscriptenginelegacy.h"
 #include "controllers/scripting/legacy/scriptconnectionjsproxy.h"
+#include "engine/controls/loopingcontrol.h"
+#include "engine/controls/macrocontrol.h"
 #include "mixer/playermanager.h"
 #include "moc_controllerscriptinterfacelegacy.cpp"
 #include "util/cmdlineargs.h"
@@ -30,7 +34,8 @@ constexpr double kBrakeRampToRate = 0.01;
 
 ControllerScriptInterfaceLegacy::ControllerScriptInterfaceLegacy(
         ControllerScriptEngineLegacy* m_pEngine, const RuntimeLoggingCategory& logger)
-        : m_pScriptEngineLegacy(m_pEngine),
+        : m_nextControlBatchId(1),
+          m_pScriptEngineLegacy(m_pEngine),
           m_logger(logger) {
     // Pre-allocate arrays for average number of virtual decks
     m_intervalAccumulator.resize(kDecks);
@@ -225,6 +230,230 @@ double ControllerScriptInterfaceLegacy::getParameterForValue(
     return coScript->getParameterForValue(value);
 }
 
+int ControllerScriptInterfaceLegacy::createControlBatch(const QJSValue& controls) {
+    if (!controls.isArray()) {
+        m_pScriptEngineLegacy->logOrThrowError(QStringLiteral(
+                "createControlBatch expects an array of {group, name} "
+                "objects, returning -1"));
+        return -1;
+    }
+
+    const int length = controls.property(QStringLiteral("length")).toInt();
+    ControlBatch batch;
+    batch.controls.reserve(length);
+    for (int i = 0; i < length; ++i) {
+        const QJSValue control = controls.property(i);
+        const QString group = control.property(QStringLiteral("group")).toString();
+        const QString name = control.property(QStringLiteral("name")).toString();
+        ControlObjectScript* coScript = getControlObjectScript(group, name);
+        if (coScript == nullptr) {
+            // The test setups do not run all of Mixxx, so ControlObjects not
+            // existing during tests is okay.
+            if (!m_pScriptEngineLegacy->isTesting()) {
+                m_pScriptEngineLegacy->logOrThrowError(
+                        QStringLiteral("createControlBatch: unknown control "
+                                       "(%1, %2), returning -1")
+                                .arg(group, name));
+            }
+            return -1;
+        }
+        batch.controls.append(coScript);
+    }
+    batch.snapshot.resize(length * static_cast<int>(sizeof(double)));
+
+    const int batchId = m_nextControlBatchId++;
+    m_controlBatches.insert(batchId, batch);
+    return batchId;
+}
+
+QJSValue ControllerScriptInterfaceLegacy::readControlBatch(int batchId) {
+    auto pJsEngine = m_pScriptEngineLegacy->jsEngine();
+    VERIFY_OR_DEBUG_ASSERT(pJsEngine) {
+        return QJSValue::UndefinedValue;
+    }
+
+    const auto it = m_controlBatches.find(batchId);
+    if (it == m_controlBatches.end()) {
+        m_pScriptEngineLegacy->logOrThrowError(
+                QStringLiteral("readControlBatch called with unknown batch id "
+                               "(%1), returning undefined")
+                        .arg(batchId));
+        return QJSValue::UndefinedValue;
+    }
+
+    // Snapshot all controls of the batch into the reused buffer and hand it
+    // to the script as a single ArrayBuffer instead of one getValue() call
+    // per control.
+    double* pValues = reinterpret_cast<double*>(it->snapshot.data());
+    for (ControlObjectScript* coScript : std::as_const(it->controls)) {
+        *pValues++ = coScript->get();
+    }
+    return pJsEngine->toScriptValue(it->snapshot);
+}
+
+void ControllerScriptInterfaceLegacy::writeControlBatch(
+        int batchId, const QJSValue& values) {
+    const auto it = m_controlBatches.constFind(batchId);
+    if (it == m_controlBatches.constEnd()) {
+        m_pScriptEngineLegacy->logOrThrowError(
+                QStringLiteral("writeControlBatch called with unknown batch id "
+                               "(%1)")
+                        .arg(batchId));
+        return;
+    }
+
+    // An ArrayBuffer converts to a QByteArray of raw float64 values.
+    // Float64Arrays and plain JS arrays are read element-wise through their
+    // length property. Either way the script engine boundary is only
+    // crossed once per flush instead of once per setValue() call.
+    const QVariant variant = values.toVariant();
+    QVarLengthArray<double, 64> newValues;
+    if (variant.metaType() == QMetaType::fromType<QByteArray>()) {
+        const QByteArray buffer = variant.toByteArray();
+        const int count = buffer.size() / static_cast<int>(sizeof(double));
+        newValues.resize(count);
+        memcpy(newValues.data(), buffer.constData(), count * sizeof(double));
+    } else if (values.property(QStringLiteral("length")).isNumber()) {
+        const int length = values.property(QStringLiteral("length")).toInt();
+        newValues.reserve(length);
+        for (int i = 0; i < length; ++i) {
+            newValues.append(values.property(i).toNumber());
+        }
+    } else {
+        m_pScriptEngineLegacy->logOrThrowError(QStringLiteral(
+                "writeControlBatch expects a Float64Array, an ArrayBuffer or "
+                "an array of numbers"));
+        return;
+    }
+
+    if (newValues.size() != it->controls.size()) {
+        m_pScriptEngineLegacy->logOrThrowError(
+                QStringLiteral("writeControlBatch called with %1 values for a "
+                               "batch of %2 controls")
+                        .arg(QString::number(newValues.size()),
+                                QString::number(it->controls.size())));
+        return;
+    }
+
+    for (int i = 0; i < newValues.size(); ++i) {
+        const double newValue = newValues.at(i);
+        if (util_isnan(newValue)) {
+            // NaN entries leave the control unchanged, so scripts can reuse
+            // one buffer per tick and only fill in the slots to write.
+            continue;
+        }
+        ControlObjectScript* coScript = it->controls.at(i);
+        ControlObject* pControl = ControlObject::getControl(
+                coScript->getKey(), ControlFlag::AllowMissingOrInvalid);
+        if (pControl &&
+                !m_st.ignore(
+                        pControl, coScript->getParameterForValue(newValue))) {
+            coScript->set(newValue);
+        }
+    }
+}
+
+void ControllerScriptInterfaceLegacy::deleteControlBatch(int batchId) {
+    if (m_controlBatches.remove(batchId) == 0) {
+        m_pScriptEngineLegacy->logOrThrowError(
+                QStringLiteral("deleteControlBatch called with unknown batch "
+                               "id (%1)")
+                        .arg(batchId));
+    }
+}
+
+bool ControllerScriptInterfaceLegacy::isBeatLoopSizeActive(
+        const QString& group, double size) {
+    static const QList<double> kBeatSizes = LoopingControl::getBeatSizes();
+    const int index = kBeatSizes.indexOf(size);
+    if (index < 0) {
+        m_pScriptEngineLegacy->logOrThrowError(
+                QStringLiteral("isBeatLoopSizeActive called with a size (%1) "
+                               "that has no beatloop control, returning false")
+                        .arg(size));
+        return false;
+    }
+    const auto bits = static_cast<quint64>(
+            getValue(group, QStringLiteral("beatloop_active_bits")));
+    return (bits & (quint64(1) << index)) != 0;
+}
+
+QJSValue ControllerScriptInterfaceLegacy::getBeatLoopSizes() {
+    auto pJsEngine = m_pScriptEngineLegacy->jsEngine();
+    VERIFY_OR_DEBUG_ASSERT(pJsEngine) {
+        return QJSValue();
+    }
+    return pJsEngine->toScriptValue(LoopingControl::getBeatSizes());
+}
+
+bool ControllerScriptInterfaceLegacy::startMacro(
+        const QString& group, const QJSValue& steps, double loopLengthBeats) {
+    MacroControl* pMacroControl = MacroControl::forGroup(group);
+    if (pMacroControl == nullptr) {
+        m_pScriptEngineLegacy->logOrThrowError(
+                QStringLiteral("startMacro: group (%1) has no macro control, "
+                               "returning false")
+                        .arg(group));
+        return false;
+    }
+    if (!steps.isArray()) {
+        m_pScriptEngineLegacy->logOrThrowError(QStringLiteral(
+                "startMacro expects an array of {beats, control, value} "
+                "objects, returning false"));
+        return false;
+    }
+
+    const int length = steps.property(QStringLiteral("length")).toInt();
+    MacroProgram program;
+    program.loopLengthBeats = loopLengthBeats;
+    program.steps.reserve(length);
+    for (int i = 0; i < length; ++i) {
+        const QJSValue step = steps.property(i);
+        QString stepGroup = step.property(QStringLiteral("group")).toString();
+        if (stepGroup.isEmpty() || stepGroup == QStringLiteral("undefined")) {
+            stepGroup = group;
+        }
+        const QString name = step.property(QStringLiteral("control")).toString();
+        // The control is resolved once at compile time so that the engine
+        // callback only performs an atomic write per step. Controls of
+        // decks and effect units exist for the lifetime of the
+        // application, so holding the bare pointer is safe.
+        ControlObject* pControl = ControlObject::getControl(
+                ConfigKey(stepGroup, name));
+        if (pControl == nullptr) {
+            m_pScriptEngineLegacy->logOrThrowError(
+                    QStringLiteral("startMacro: unknown control (%1, %2), "
+                                   "returning false")
+                            .arg(stepGroup, name));
+            return false;
+        }
+        const double beatOffset = step.property(QStringLiteral("beats")).toNumber();
+        if (util_isnan(beatOffset) || beatOffset < 0) {
+            m_pScriptEngineLegacy->logOrThrowError(
+                    QStringLiteral("startMacro: invalid beat offset of step "
+                                   "%1, returning false")
+                            .arg(i));
+            return false;
+        }
+        program.steps.append(MacroStep{beatOffset,
+                pControl,
+                step.property(QStringLiteral("value")).toNumber()});
+    }
+    pMacroControl->startMacro(std::move(program));
+    return true;
+}
+
+void ControllerScriptInterfaceLegacy::stopMacro(const QString& group) {
+    MacroControl* pMacroControl = MacroControl::forGroup(group);
+    if (pMacroControl == nullptr) {
+        m_pScriptEngineLegacy->logOrThrowError(
+                QStringLiteral("stopMacro: group (%1) has no macro control")
+                        .arg(group));
+        return;
+    }
+    pMacroControl->stopMacro();
+}
+
 void ControllerScriptInterfaceLegacy::reset(const QString& group, const QString& name) {
     ControlObjectScript* coScript = getControlObjectScript(group, name);
     if (coScript != nullptr) {
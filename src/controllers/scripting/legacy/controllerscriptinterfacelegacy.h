@@ -63,6 +63,52 @@ class ControllerScriptInterfaceLegacy : public QObject {
     Q_INVOKABLE void setParameter(const QString& group, const QString& name, double newValue);
     Q_INVOKABLE double getParameterForValue(
             const QString& group, const QString& name, double value);
+    /// Declares a set of controls for batched reads and writes. Takes an
+    /// array of {group, name} objects and returns a batch id, or -1 if any
+    /// of the controls does not exist. Busy mappings that poll or update
+    /// many controls per timer tick should declare them once and use
+    /// readControlBatch()/writeControlBatch() instead of crossing the
+    /// script engine boundary once per getValue()/setValue() call.
+    Q_INVOKABLE int createControlBatch(const QJSValue& controls);
+    /// Returns a snapshot of the current values of all controls of the
+    /// batch as an ArrayBuffer of float64 values in declaration order,
+    /// meant to be wrapped in a Float64Array by the script.
+    Q_INVOKABLE QJSValue readControlBatch(int batchId);
+    /// Flushes values to all controls of the batch in one call. Accepts a
+    /// Float64Array, an ArrayBuffer of float64 values or a plain array in
+    /// declaration order. NaN entries leave the respective control
+    /// unchanged, so scripts can reuse one buffer and only fill in the
+    /// slots they want to write.
+    Q_INVOKABLE void writeControlBatch(int batchId, const QJSValue& values);
+    Q_INVOKABLE void deleteControlBatch(int batchId);
+    /// Returns true if the beatloop of the given size is enabled on the
+    /// given deck group, decoded from the packed beatloop_active_bits
+    /// control. Mappings with loop-size LED pages should read that one
+    /// control (or put it in a control batch) and decode it with this
+    /// helper instead of polling every beatloop_X_enabled control
+    /// separately.
+    Q_INVOKABLE bool isBeatLoopSizeActive(const QString& group, double size);
+    /// Returns the beatloop sizes in the bit order used by
+    /// beatloop_active_bits: bit i of the packed value corresponds to
+    /// element i of the returned array.
+    Q_INVOKABLE QJSValue getBeatLoopSizes();
+    /// Compiles a declarative step sequence into a macro program and hands
+    /// it to the engine control of the given deck group for execution.
+    /// Takes an array of {beats, control, value} objects, where beats is
+    /// the offset in beats from the macro start at which the control of
+    /// the deck group is set to value. An optional group property on a
+    /// step targets another group, e.g. an effect unit. If loopLengthBeats
+    /// is greater than zero the sequence restarts after that many beats
+    /// until stopMacro() is called or another track is loaded. The steps
+    /// fire inside the engine callback aligned to the deck's beat grid,
+    /// without the timer granularity and message latency of per-step
+    /// script callbacks. Returns false if the group has no macro control
+    /// or any referenced control does not exist.
+    Q_INVOKABLE bool startMacro(const QString& group,
+            const QJSValue& steps,
+            double loopLengthBeats = 0);
+    /// Stops the running and any pending macro of the given deck group.
+    Q_INVOKABLE void stopMacro(const QString& group);
     Q_INVOKABLE void reset(const QString& group, const QString& name);
     Q_INVOKABLE double getDefaultValue(const QString& group, const QString& name);
     Q_INVOKABLE double getDefaultParameter(const QString& group, const QString& name);
@@ -132,6 +178,17 @@ class ControllerScriptInterfaceLegacy : public QObject {
     QHash<ConfigKey, ControlObjectScript*> m_controlCache;
     ControlObjectScript* getControlObjectScript(const QString& group, const QString& name);
 
+    /// A set of controls declared once by the script for batched reads and
+    /// writes. The controls are resolved at declaration time and the
+    /// snapshot buffer is reused across ticks to avoid per-tick
+    /// allocations. The ControlObjectScripts are owned by m_controlCache.
+    struct ControlBatch {
+        QVector<ControlObjectScript*> controls;
+        QByteArray snapshot;
+    };
+    QHash<int, ControlBatch> m_controlBatches;
+    int m_nextControlBatchId;
+
     SoftTakeoverCtrl m_st;
 
     struct TimerInfo {
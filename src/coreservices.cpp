@@ -2,25 +2,32 @@
 
 #include <QApplication>
 #include <QFileDialog>
+#include <QFuture>
+#include <QMessageBox>
 #include <QProcess>
 #include <QProcessEnvironment>
 #include <QStandardPaths>
+#include <QtConcurrentRun>
 #include <QtGlobal>
 #include <gsl/pointers>
 
 #ifdef __BROADCAST__
 #include "broadcast/broadcastmanager.h"
 #endif
+#include "control/control.h"
 #include "control/controlindicatortimer.h"
 #include "controllers/controllermanager.h"
 #include "controllers/keyboard/keyboardeventfilter.h"
 #include "controllers/scripting/controllerscriptenginebase.h"
 #include "database/mixxxdb.h"
 #include "effects/effectsmanager.h"
+#include "engine/audioloadgovernor.h"
 #include "engine/enginemixer.h"
 #ifdef __RUBBERBAND__
 #include "engine/bufferscalers/rubberbandworkerpool.h"
 #endif
+#include "engine/sidechain/enginesidechain.h"
+#include "engine/sidechain/enginespectrum.h"
 #include "library/coverartcache.h"
 #include "library/library.h"
 #include "library/library_decl.h"
@@ -31,6 +38,8 @@
 #include "mixer/playerinfo.h"
 #include "mixer/playermanager.h"
 #include "moc_coreservices.cpp"
+#include "network/lansync.h"
+#include "network/osctelemetry.h"
 #include "preferences/dialog/dlgpreferences.h"
 #include "preferences/settingsmanager.h"
 #ifdef __MODPLUG__
@@ -50,10 +59,14 @@
 #endif
 #include "soundio/soundmanager.h"
 #include "sources/soundsourceproxy.h"
+#include "util/backgroundio.h"
 #include "util/clipboard.h"
 #include "util/db/dbconnectionpooled.h"
+#include "util/db/dbconnectionpooler.h"
+#include "util/flightrecorder.h"
 #include "util/font.h"
 #include "util/logger.h"
+#include "util/memorylock.h"
 #include "util/screensavermanager.h"
 #include "util/statsmanager.h"
 #include "util/time.h"
@@ -371,6 +384,9 @@ CoreServices::CoreServices(const CmdlineArgs& args, QApplication* pApp)
     if (m_cmdlineArgs.getDeveloper()) {
         StatsManager::createInstance();
     }
+    // The flight recorder is always on so that the engine history leading
+    // up to an xrun can be dumped at a venue, not only in developer mode.
+    FlightRecorder::createInstance();
     mixxx::Translations::initializeTranslations(
             m_pSettingsManager->settings(), pApp, m_cmdlineArgs.getLocale());
     initializeKeyboard();
@@ -389,6 +405,7 @@ CoreServices::~CoreServices() {
     if (m_cmdlineArgs.getDeveloper()) {
         StatsManager::destroy();
     }
+    FlightRecorder::destroy();
 
     // HACK: Save config again. We saved it once before doing some dangerous
     // stuff. We only really want to save it here, but the first one was just
@@ -463,6 +480,11 @@ void CoreServices::initialize(QApplication* pApp) {
 
     ScopedTimer t(QStringLiteral("CoreServices::initialize"));
 
+    // Progressive per-stage timing, mirroring finalize(), so that cold-start
+    // regressions can be attributed to a single stage from the log.
+    Timer stageTimer("CoreServices::initialize stages");
+    stageTimer.start();
+
     VERIFY_OR_DEBUG_ASSERT(SoundSourceProxy::registerProviders()) {
         qCritical() << "Failed to register any SoundSource providers";
         return;
@@ -485,28 +507,48 @@ void CoreServices::initialize(QApplication* pApp) {
 
     Sandbox::setPermissionsFilePath(QDir(pConfig->getSettingsPath()).filePath("sandbox.cfg"));
 
+    // Lock the engine's large long-lived buffers into physical memory if
+    // requested. Must be enabled before the engine subsystems below
+    // allocate those buffers; the control value table is static and is
+    // locked right away.
+    MemoryLock::setEnabled(pConfig->getValue(
+            ConfigKey(QStringLiteral("[App]"), QStringLiteral("lock_engine_memory")),
+            false));
+    ControlDoublePrivate::lockValueTableMemory();
+
     QString resourcePath = pConfig->getResourcePath();
 
     emit initializationProgressUpdate(0, tr("fonts"));
+    qDebug() << stageTimer.elapsed(false).debugMillisWithUnit() << "initializing fonts";
 
     FontUtils::initializeFonts(resourcePath); // takes a long time
 
     emit initializationProgressUpdate(10, tr("database"));
-    m_pDbConnectionPool = MixxxDb(pConfig).connectionPool();
+    qDebug() << stageTimer.elapsed(false).debugMillisWithUnit() << "connecting to database";
+    const MixxxDb mixxxDb(pConfig);
+    m_pDbConnectionPool = mixxxDb.connectionPool();
     if (!m_pDbConnectionPool) {
         exit(-1);
     }
+    m_pReadOnlyDbConnectionPool = mixxxDb.readOnlyConnectionPool();
     // Create a connection for the main thread
     m_pDbConnectionPool->createThreadLocalConnection();
-    if (!initializeDatabase()) {
-        exit(-1);
-    }
+    // Check and upgrade the database schema on a worker thread while the
+    // effects, engine and sound subsystems are constructed below. Nothing
+    // touches the database until the library stage, which collects the
+    // result, so the disk-bound schema check overlaps with the CPU-bound
+    // construction work instead of serializing the startup.
+    QFuture<bool> databaseSchemaFuture = QtConcurrent::run([this] {
+        const mixxx::DbConnectionPooler dbConnectionPooler(m_pDbConnectionPool);
+        return initializeDatabase();
+    });
 
     m_pControlIndicatorTimer = std::make_shared<mixxx::ControlIndicatorTimer>(this);
 
     auto pChannelHandleFactory = std::make_shared<ChannelHandleFactory>();
 
     emit initializationProgressUpdate(20, tr("effects"));
+    qDebug() << stageTimer.elapsed(false).debugMillisWithUnit() << "initializing effects and engine";
     m_pEffectsManager = std::make_shared<EffectsManager>(pConfig, pChannelHandleFactory);
 
     m_pEngine = std::make_shared<EngineMixer>(
@@ -520,6 +562,7 @@ void CoreServices::initialize(QApplication* pApp) {
 #endif
 
     emit initializationProgressUpdate(30, tr("audio interface"));
+    qDebug() << stageTimer.elapsed(false).debugMillisWithUnit() << "initializing audio interface";
     // Although m_pSoundManager is created here, m_pSoundManager->setupDevices()
     // needs to be called after m_pPlayerManager registers sound IO for each EngineChannel.
     m_pSoundManager = std::make_shared<SoundManager>(pConfig, m_pEngine.get());
@@ -527,6 +570,17 @@ void CoreServices::initialize(QApplication* pApp) {
 
     m_pRecordingManager = std::make_shared<RecordingManager>(pConfig, m_pEngine.get());
 
+    // Register the spectrum tap with the engine sidechain. It stays
+    // idle until a consumer sets [App],spectrum_enabled.
+    if (EngineSideChain* pSidechain = m_pEngine->getSideChain()) {
+        pSidechain->addSideChainWorker(
+                new EngineSpectrum(), QStringLiteral("EngineSpectrum"));
+    }
+
+    // Steps down the keylock engine quality under sustained callback
+    // overload. Opt-in via [App],audio_load_governor.
+    m_pAudioLoadGovernor = std::make_unique<AudioLoadGovernor>();
+
 #ifdef __BROADCAST__
     m_pBroadcastManager = std::make_shared<BroadcastManager>(
             m_pSettingsManager.get(),
@@ -540,6 +594,7 @@ void CoreServices::initialize(QApplication* pApp) {
 #endif
 
     emit initializationProgressUpdate(40, tr("decks"));
+    qDebug() << stageTimer.elapsed(false).debugMillisWithUnit() << "initializing decks";
     // Create the player manager. (long)
     m_pPlayerManager = std::make_shared<PlayerManager>(
             pConfig,
@@ -549,6 +604,27 @@ void CoreServices::initialize(QApplication* pApp) {
     // TODO: connect input not configured error dialog slots
     PlayerInfo::create();
 
+    // Streams per-deck engine state to external visuals over OSC.
+    // Stays idle unless [Telemetry],OscEnabled is set.
+    m_pOscTelemetry = std::make_unique<OscTelemetry>(
+            pConfig, m_pPlayerManager.get());
+
+    // Replicates the internal clock between Mixxx instances on the
+    // local network. Stays idle unless a [LanSync],Mode is configured.
+    m_pLanSync = std::make_unique<LanSync>(pConfig);
+
+    // Optionally park all background file I/O (library scan, batch
+    // analysis) while a deck is audible, for single-disk machines
+    // where scans have caused dropouts.
+    BackgroundIo::setParkWhilePlaying(pConfig->getValue(
+            ConfigKey("[Library]", "ParkBackgroundIoWhilePlaying"), false));
+    connect(&PlayerInfo::instance(),
+            &PlayerInfo::currentPlayingDeckChanged,
+            this,
+            [](int deck) {
+                BackgroundIo::setAnyDeckAudible(deck >= 0);
+            });
+
     for (int i = 0; i < kMicrophoneCount; ++i) {
         m_pPlayerManager->addMicrophone();
     }
@@ -586,13 +662,35 @@ void CoreServices::initialize(QApplication* pApp) {
             &ScreensaverManager::slotCurrentPlayingDeckChanged);
 
     emit initializationProgressUpdate(50, tr("library"));
+    qDebug() << stageTimer.elapsed(false).debugMillisWithUnit() << "initializing library";
+
+    // The library is the first user of the database, so the schema check
+    // started during the database stage must have completed by now.
+    if (!databaseSchemaFuture.result()) {
+        QMessageBox::critical(nullptr,
+                tr("Cannot open database"),
+                tr("Unable to establish a database connection.\n"
+                   "Mixxx requires QT with SQLite support. Please read "
+                   "the Qt SQL driver documentation for information on how "
+                   "to build it.\n\n"
+                   "Click OK to exit."),
+                QMessageBox::Ok);
+        exit(-1);
+    }
+
     CoverArtCache::createInstance();
     Clipboard::createInstance();
 
+    // The database file exists and its schema is up-to-date now, so the
+    // read-only connection for GUI-driven queries can be opened. If this
+    // fails the library falls back to the writable connection.
+    m_pReadOnlyDbConnectionPool->createThreadLocalConnection();
+
     m_pTrackCollectionManager = std::make_shared<TrackCollectionManager>(
             this,
             pConfig,
-            m_pDbConnectionPool);
+            m_pDbConnectionPool,
+            m_pReadOnlyDbConnectionPool);
 
     m_pLibrary = std::make_shared<Library>(
             this,
@@ -688,6 +786,7 @@ void CoreServices::initialize(QApplication* pApp) {
     }
 
     emit initializationProgressUpdate(60, tr("controllers"));
+    qDebug() << stageTimer.elapsed(false).debugMillisWithUnit() << "initializing controllers";
     // Initialize controller sub-system,
     // but do not set up controllers until the end of the application startup
     // (long)
@@ -765,6 +864,9 @@ void CoreServices::initialize(QApplication* pApp) {
         }
     }
 
+    MemoryLock::logReport();
+
+    qDebug() << stageTimer.elapsed(false).debugMillisWithUnit() << "initialization complete";
     m_isInitialized = true;
 
     ControllerScriptEngineBase::registerPlayerManager(getPlayerManager());
@@ -863,18 +965,12 @@ void CoreServices::slotOptionsKeyboard(bool toggle) {
     }
 }
 
+// May be called from a worker thread, so the error dialog for a failed
+// initialization is raised by the caller on the main thread.
 bool CoreServices::initializeDatabase() {
     kLogger.info() << "Connecting to database";
     QSqlDatabase dbConnection = mixxx::DbConnectionPooled(m_pDbConnectionPool);
     if (!dbConnection.isOpen()) {
-        QMessageBox::critical(nullptr,
-                tr("Cannot open database"),
-                tr("Unable to establish a database connection.\n"
-                   "Mixxx requires QT with SQLite support. Please read "
-                   "the Qt SQL driver documentation for information on how "
-                   "to build it.\n\n"
-                   "Click OK to exit."),
-                QMessageBox::Ok);
         return false;
     }
 
@@ -927,6 +1023,13 @@ void CoreServices::finalize() {
     qDebug() << t.elapsed(false).debugMillisWithUnit() << "saving configuration";
     m_pSettingsManager->save();
 
+    // The telemetry service polls deck controls and VisualPlayPosition
+    // entries that go away with the player manager.
+    m_pOscTelemetry.reset();
+
+    // LAN sync proxies the internal clock controls owned by the engine.
+    m_pLanSync.reset();
+
     // SoundManager depend on Engine and Config
     qDebug() << t.elapsed(false).debugMillisWithUnit() << "deleting SoundManager";
     CLEAR_AND_CHECK_DELETED(m_pSoundManager);
@@ -969,6 +1072,9 @@ void CoreServices::finalize() {
     CLEAR_AND_CHECK_DELETED(m_pBroadcastManager);
 #endif
 
+    // The governor polls controls owned by EngineMixer and SoundManager.
+    m_pAudioLoadGovernor.reset();
+
     // EngineMixer depends on Config and m_pEffectsManager.
     qDebug() << t.elapsed(false).debugMillisWithUnit() << "deleting EngineMixer";
     CLEAR_AND_CHECK_DELETED(m_pEngine);
@@ -993,6 +1099,8 @@ void CoreServices::finalize() {
     CLEAR_AND_CHECK_DELETED(m_pTrackCollectionManager);
 
     qDebug() << t.elapsed(false).debugMillisWithUnit() << "closing database connection(s)";
+    m_pReadOnlyDbConnectionPool->destroyThreadLocalConnection();
+    m_pReadOnlyDbConnectionPool.reset(); // should drop the last reference
     m_pDbConnectionPool->destroyThreadLocalConnection();
     m_pDbConnectionPool.reset(); // should drop the last reference
 
@@ -22,12 +22,15 @@ class TrackCollectionManager;
 class Library;
 class SkinControls;
 class ControlPushButton;
+class AudioLoadGovernor;
 struct LibraryScanResultSummary;
 
 namespace mixxx {
 
 class ControlIndicatorTimer;
 class DbConnectionPool;
+class LanSync;
+class OscTelemetry;
 class ScreensaverManager;
 
 class CoreServices : public QObject {
@@ -131,6 +134,9 @@ class CoreServices : public QObject {
     std::shared_ptr<SoundManager> m_pSoundManager;
     std::shared_ptr<PlayerManager> m_pPlayerManager;
     std::shared_ptr<RecordingManager> m_pRecordingManager;
+    std::unique_ptr<AudioLoadGovernor> m_pAudioLoadGovernor;
+    std::unique_ptr<OscTelemetry> m_pOscTelemetry;
+    std::unique_ptr<LanSync> m_pLanSync;
 #ifdef __BROADCAST__
     std::shared_ptr<BroadcastManager> m_pBroadcastManager;
 #endif
@@ -139,6 +145,7 @@ class CoreServices : public QObject {
     std::shared_ptr<VinylControlManager> m_pVCManager;
 
     std::shared_ptr<DbConnectionPool> m_pDbConnectionPool;
+    std::shared_ptr<DbConnectionPool> m_pReadOnlyDbConnectionPool;
     std::shared_ptr<TrackCollectionManager> m_pTrackCollectionManager;
     std::shared_ptr<Library> m_pLibrary;
 
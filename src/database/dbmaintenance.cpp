@@ -0,0 +1,193 @@
+#include "database/dbmaintenance.h"
+
+#include <QSqlError>
+#include <QSqlQuery>
+
+#include "mixer/playerinfo.h"
+#include "moc_dbmaintenance.cpp"
+#include "util/logger.h"
+#include "util/math.h"
+#include "util/performancetimer.h"
+
+namespace {
+
+const mixxx::Logger kLogger("DbMaintenance");
+
+// Scheduler granularity. Coarse enough that an idle Mixxx does not
+// wake up noticeably, fine enough that maintenance progresses between
+// two tracks of a set.
+constexpr int kTickIntervalMillis = 10 * 1000;
+
+// Database time granted per tick and the cap of the bucket. With 25 ms
+// per 10 s tick the maintenance load stays below 0.25% of one core
+// even when there is always work to do.
+constexpr double kRefillMillisPerTick = 25.0;
+constexpr double kBucketCapacityMillis = 250.0;
+
+// Pages moved per incremental vacuum slice. With SQLite's default page
+// size this is about 1 MiB of reclaimed file space per slice.
+constexpr int kVacuumPagesPerSlice = 256;
+
+// WAL frames that are allowed to accumulate before a passive
+// checkpoint is attempted. Matches the order of magnitude of SQLite's
+// own auto-checkpoint threshold.
+constexpr int kWalCheckpointFrameThreshold = 1000;
+
+// PRAGMA optimize is cheap because it only re-analyzes tables whose
+// statistics have become stale, but there is no point in probing more
+// often than about once an hour.
+constexpr int kOptimizeIntervalTicks = 360;
+
+// Upper bound on the rows examined per index by ANALYZE, as
+// recommended by the SQLite documentation for online use.
+constexpr int kAnalysisLimit = 400;
+
+constexpr int kNumTasks = 3;
+
+} // anonymous namespace
+
+DbMaintenance::DbMaintenance(
+        QSqlDatabase database,
+        QObject* parent)
+        : QObject(parent),
+          m_database(std::move(database)),
+          m_tokenMillis(kBucketCapacityMillis),
+          m_nextTask(Task::IncrementalVacuum),
+          m_incrementalVacuumSupported(false),
+          m_ticksUntilOptimize(0) {
+    QSqlQuery query(m_database);
+    // Incremental vacuum requires auto_vacuum=INCREMENTAL, which is
+    // stored in the database file itself. Requesting it here is a
+    // no-op on existing databases (switching from NONE only takes
+    // effect after a full VACUUM, e.g. the repair on next restart),
+    // but newly created databases and repaired ones pick it up.
+    query.exec(QStringLiteral("PRAGMA auto_vacuum=INCREMENTAL"));
+    if (query.exec(QStringLiteral("PRAGMA auto_vacuum")) && query.next()) {
+        m_incrementalVacuumSupported = query.value(0).toInt() == 2;
+    }
+    if (!m_incrementalVacuumSupported) {
+        kLogger.info()
+                << "Database has no incremental auto_vacuum,"
+                << "free pages are only reclaimed by a full VACUUM";
+    }
+
+    connect(&m_timer,
+            &QTimer::timeout,
+            this,
+            &DbMaintenance::slotTick);
+    m_timer.start(kTickIntervalMillis);
+}
+
+void DbMaintenance::slotTick() {
+    m_tokenMillis = math_min(
+            m_tokenMillis + kRefillMillisPerTick, kBucketCapacityMillis);
+    if (m_tokenMillis <= 0.0) {
+        // Still paying off the debt of an overlong slice
+        return;
+    }
+    // Never compete with the engine's disk and page cache accesses
+    // while a deck is playing.
+    if (PlayerInfo::instance().getCurrentPlayingDeck() != -1) {
+        return;
+    }
+    if (!m_database.isOpen()) {
+        return;
+    }
+
+    PerformanceTimer timer;
+    timer.start();
+    // Round-robin over the tasks, at most one slice of actual work per
+    // tick. Tasks without pending work are skipped for free.
+    for (int i = 0; i < kNumTasks; ++i) {
+        bool didWork = false;
+        switch (m_nextTask) {
+        case Task::IncrementalVacuum:
+            didWork = runIncrementalVacuumSlice();
+            m_nextTask = Task::WalCheckpoint;
+            break;
+        case Task::WalCheckpoint:
+            didWork = runWalCheckpointSlice();
+            m_nextTask = Task::Optimize;
+            break;
+        case Task::Optimize:
+            didWork = runOptimize();
+            m_nextTask = Task::IncrementalVacuum;
+            break;
+        }
+        if (didWork) {
+            break;
+        }
+    }
+    m_tokenMillis -= timer.elapsed().toDoubleMillis();
+}
+
+bool DbMaintenance::runIncrementalVacuumSlice() {
+    if (!m_incrementalVacuumSupported) {
+        return false;
+    }
+    QSqlQuery query(m_database);
+    if (!query.exec(QStringLiteral("PRAGMA freelist_count")) ||
+            !query.next() ||
+            query.value(0).toLongLong() == 0) {
+        return false;
+    }
+    const auto freePages = query.value(0).toLongLong();
+    if (!query.exec(QStringLiteral("PRAGMA incremental_vacuum(%1)")
+                            .arg(kVacuumPagesPerSlice))) {
+        kLogger.warning()
+                << "Incremental vacuum failed:"
+                << query.lastError();
+        return false;
+    }
+    if (kLogger.debugEnabled()) {
+        kLogger.debug()
+                << "Vacuumed up to" << kVacuumPagesPerSlice
+                << "of" << freePages << "free pages";
+    }
+    return true;
+}
+
+bool DbMaintenance::runWalCheckpointSlice() {
+    QSqlQuery query(m_database);
+    // A passive checkpoint copies WAL frames back into the database
+    // without ever blocking concurrent readers or writers; it simply
+    // stops early when it would have to wait.
+    if (!query.exec(QStringLiteral("PRAGMA wal_checkpoint(PASSIVE)")) ||
+            !query.next()) {
+        return false;
+    }
+    // Columns: busy, log frames, checkpointed frames
+    const int logFrames = query.value(1).toInt();
+    if (logFrames < kWalCheckpointFrameThreshold) {
+        return false;
+    }
+    if (kLogger.debugEnabled()) {
+        kLogger.debug()
+                << "Checkpointed" << query.value(2).toInt()
+                << "of" << logFrames << "WAL frames";
+    }
+    return true;
+}
+
+bool DbMaintenance::runOptimize() {
+    if (m_ticksUntilOptimize > 0) {
+        m_ticksUntilOptimize--;
+        return false;
+    }
+    m_ticksUntilOptimize = kOptimizeIntervalTicks;
+    QSqlQuery query(m_database);
+    // Bounded online ANALYZE: only tables whose statistics have become
+    // stale are re-analyzed, examining at most kAnalysisLimit rows per
+    // index, which keeps the query planner fresh without a full scan.
+    query.exec(QStringLiteral("PRAGMA analysis_limit=%1").arg(kAnalysisLimit));
+    if (!query.exec(QStringLiteral("PRAGMA optimize"))) {
+        kLogger.warning()
+                << "PRAGMA optimize failed:"
+                << query.lastError();
+        return false;
+    }
+    if (kLogger.debugEnabled()) {
+        kLogger.debug() << "Refreshed query planner statistics";
+    }
+    return true;
+}
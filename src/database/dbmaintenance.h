@@ -0,0 +1,55 @@
+#pragma once
+
+#include <QObject>
+#include <QSqlDatabase>
+#include <QTimer>
+
+/// Online maintenance scheduler for the library database.
+///
+/// Over months of use the database accumulates free pages, the WAL file
+/// grows and the query planner statistics go stale, all of which slow
+/// down library queries. A manual VACUUM fixes this but locks the whole
+/// database for minutes. This scheduler instead runs small slices of
+/// maintenance (incremental vacuum, passive WAL checkpoints and ANALYZE
+/// via PRAGMA optimize) from the main thread while no deck is playing.
+///
+/// The work is metered by a token bucket: tokens accumulate at a fixed
+/// rate of database time per tick and each executed slice is charged
+/// with its measured duration. A slice that turns out more expensive
+/// than expected drives the bucket into debt, which throttles the
+/// following ticks, so the average maintenance load stays bounded no
+/// matter how the individual slices behave.
+class DbMaintenance : public QObject {
+    Q_OBJECT
+  public:
+    explicit DbMaintenance(
+            QSqlDatabase database,
+            QObject* parent = nullptr);
+    ~DbMaintenance() override = default;
+
+  private slots:
+    void slotTick();
+
+  private:
+    enum class Task {
+        IncrementalVacuum,
+        WalCheckpoint,
+        Optimize,
+    };
+
+    /// Each task runs one bounded slice of work and returns true, or
+    /// returns false when it currently has nothing to do so the tick
+    /// can move on to the next task.
+    bool runIncrementalVacuumSlice();
+    bool runWalCheckpointSlice();
+    bool runOptimize();
+
+    QSqlDatabase m_database;
+    QTimer m_timer;
+    double m_tokenMillis;
+    Task m_nextTask;
+    // Incremental vacuum only works on databases with
+    // auto_vacuum=INCREMENTAL, see the constructor.
+    bool m_incrementalVacuumSupported;
+    int m_ticksUntilOptimize;
+};
@@ -14,7 +14,7 @@
 const QString MixxxDb::kDefaultSchemaFile(":/schema.xml");
 
 //static
-const int MixxxDb::kRequiredSchemaVersion = 40;
+const int MixxxDb::kRequiredSchemaVersion = 47;
 
 namespace {
 
@@ -24,6 +24,12 @@ const QString kType = QStringLiteral("QSQLITE");
 
 const QString kConnectOptions = QStringLiteral("QSQLITE_OPEN_URI");
 
+// Connect options for the read-only connection pool. Opening read-only
+// ensures that these connections never take the write lock and in WAL
+// mode always read from a consistent snapshot of the database.
+const QString kConnectOptionsReadOnly =
+        QStringLiteral("QSQLITE_OPEN_URI;QSQLITE_OPEN_READONLY");
+
 const QString kUriPrefix = QStringLiteral("file://");
 
 const QString kDefaultFileName = QStringLiteral("mixxxdb.sqlite");
@@ -63,12 +69,26 @@ mixxx::DbConnection::Params dbConnectionParams(
     return params;
 }
 
+// The connection parameters for read-only connections to the main Mixxx DB
+mixxx::DbConnection::Params readOnlyDbConnectionParams(
+        const UserSettingsPointer& pConfig,
+        bool inMemoryConnection) {
+    mixxx::DbConnection::Params params =
+            dbConnectionParams(pConfig, inMemoryConnection);
+    params.connectOptions = kConnectOptionsReadOnly;
+    return params;
+}
+
 } // anonymous namespace
 
 MixxxDb::MixxxDb(
         const UserSettingsPointer& pConfig,
         bool inMemoryConnection)
-    : m_pDbConnectionPool(std::make_shared<mixxx::DbConnectionPool>(dbConnectionParams(pConfig, inMemoryConnection), "MIXXX")) {
+    : m_pDbConnectionPool(std::make_shared<mixxx::DbConnectionPool>(
+              dbConnectionParams(pConfig, inMemoryConnection), "MIXXX")),
+      m_pReadOnlyDbConnectionPool(std::make_shared<mixxx::DbConnectionPool>(
+              readOnlyDbConnectionParams(pConfig, inMemoryConnection),
+              "MIXXX_RO")) {
 }
 
 bool MixxxDb::initDatabaseSchema(
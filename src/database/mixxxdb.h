@@ -26,6 +26,18 @@ class MixxxDb : public QObject {
         return m_pDbConnectionPool;
     }
 
+    /// A second pool of read-only connections to the same database for
+    /// GUI-driven queries. In WAL mode these connections read from a
+    /// consistent snapshot and can neither take nor wait for the write
+    /// lock, so browsing and searching are never stalled by concurrent
+    /// writers like the library scanner. Connections from this pool must
+    /// only be created after the database schema has been initialized,
+    /// because a read-only connection cannot create the database file.
+    mixxx::DbConnectionPoolPtr readOnlyConnectionPool() const {
+        return m_pReadOnlyDbConnectionPool;
+    }
+
   private:
     mixxx::DbConnectionPoolPtr m_pDbConnectionPool;
+    mixxx::DbConnectionPoolPtr m_pReadOnlyDbConnectionPool;
 };
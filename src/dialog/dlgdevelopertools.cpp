@@ -49,6 +49,10 @@ DlgDeveloperTools::DlgDeveloperTools(QWidget* pParent,
             &QPushButton::clicked,
             this,
             &DlgDeveloperTools::slotControlDump);
+    connect(statsDump,
+            &QPushButton::clicked,
+            this,
+            &DlgDeveloperTools::slotStatsDump);
 
     // Set up the log search box
     connect(logSearch,
@@ -144,6 +148,18 @@ void DlgDeveloperTools::slotControlDump() {
     }
 }
 
+void DlgDeveloperTools::slotStatsDump() {
+    StatsManager* pManager = StatsManager::instance();
+    if (!pManager) {
+        return;
+    }
+    QString timestamp = QDateTime::currentDateTime()
+            .toString("yyyy-MM-dd_hh'h'mm'm'ss's'");
+    QString dumpFileName = m_pConfig->getSettingsPath() +
+            "/stats_dump_" + timestamp + ".csv";
+    pManager->writeStatsCsv(dumpFileName);
+}
+
 void DlgDeveloperTools::slotLogSearch() {
     QString textToFind = logSearch->text();
     m_logCursor = logTextView->document()->find(textToFind, m_logCursor);
@@ -23,6 +23,7 @@ class DlgDeveloperTools : public QDialog, public Ui::DlgDeveloperTools {
     void slotControlSearch(const QString& search);
     void slotLogSearch();
     void slotControlDump();
+    void slotStatsDump();
 
   private:
     UserSettingsPointer m_pConfig;
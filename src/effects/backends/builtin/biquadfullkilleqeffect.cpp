@@ -17,6 +17,9 @@ constexpr double kQLowKillShelve = 0.4;
 constexpr double kQHighKillShelve = 0.4;
 constexpr double kKillGain = -23;
 constexpr double kBesselStartRatio = 0.25;
+// Maximum value of the low/mid/high knobs as set up by
+// EqualizerUtil::createCommonParameters().
+constexpr double kMaxKnobGain = 4.0;
 
 double getCenterFrequency(double low, double high) {
     double scaleLow = log10(low);
@@ -142,6 +145,20 @@ void BiquadFullKillEQEffectGroupState::setFilters(
     m_highKill->setFrequencyCorners(
             sampleRate, highCenter / 2, kQHighKillShelve, m_oldHighKill);
 
+    // Precompute coefficient tables over the full gain range of the knobs
+    // so that the per-callback gain changes in processChannel() are table
+    // lookups with linear interpolation instead of full fidlib filter
+    // designs in the audio thread.
+    const double maxGainDb = ratio2db(kMaxKnobGain);
+    m_lowBoost->buildGainTable(sampleRate, lowCenter, kQBoost, kKillGain, maxGainDb);
+    m_midBoost->buildGainTable(sampleRate, midCenter, kQBoost, kKillGain, maxGainDb);
+    m_highBoost->buildGainTable(sampleRate, highCenter, kQBoost, kKillGain, maxGainDb);
+    m_lowKill->buildGainTable(
+            sampleRate, lowCenter * 2, kQLowKillShelve, kKillGain, maxGainDb);
+    m_midKill->buildGainTable(sampleRate, midCenter, kQKill, kKillGain, maxGainDb);
+    m_highKill->buildGainTable(
+            sampleRate, highCenter / 2, kQHighKillShelve, kKillGain, maxGainDb);
+
     m_lvMixIso->setFilters(sampleRate, lowFreqCorner, highFreqCorner);
 }
 
@@ -262,10 +279,7 @@ void BiquadFullKillEQEffect::processChannel(
 
     if (bqGainLow > 0.0 || pState->m_oldLowBoost > 0.0) {
         if (bqGainLow != pState->m_oldLowBoost) {
-            double lowCenter = getCenterFrequency(
-                    kMinimumFrequency, pState->m_loFreqCorner);
-            pState->m_lowBoost->setFrequencyCorners(
-                    engineParameters.sampleRate(), lowCenter, kQBoost, bqGainLow);
+            pState->m_lowBoost->setGain(bqGainLow);
             pState->m_oldLowBoost = bqGainLow;
         }
         if (bqGainLow > 0.0) {
@@ -282,10 +296,7 @@ void BiquadFullKillEQEffect::processChannel(
 
     if (bqGainLow < 0.0 || pState->m_oldLowKill < 0.0) {
         if (bqGainLow != pState->m_oldLowKill) {
-            double lowCenter = getCenterFrequency(
-                    kMinimumFrequency, pState->m_loFreqCorner);
-            pState->m_lowKill->setFrequencyCorners(
-                    engineParameters.sampleRate(), lowCenter * 2, kQLowKillShelve, bqGainLow);
+            pState->m_lowKill->setGain(bqGainLow);
             pState->m_oldLowKill = bqGainLow;
         }
         if (bqGainLow < 0.0) {
@@ -302,10 +313,7 @@ void BiquadFullKillEQEffect::processChannel(
 
     if (bqGainMid > 0.0 || pState->m_oldMidBoost > 0.0) {
         if (bqGainMid != pState->m_oldMidBoost) {
-            double midCenter = getCenterFrequency(
-                    pState->m_loFreqCorner, pState->m_highFreqCorner);
-            pState->m_midBoost->setFrequencyCorners(
-                    engineParameters.sampleRate(), midCenter, kQBoost, bqGainMid);
+            pState->m_midBoost->setGain(bqGainMid);
             pState->m_oldMidBoost = bqGainMid;
         }
         if (bqGainMid > 0.0) {
@@ -322,10 +330,7 @@ void BiquadFullKillEQEffect::processChannel(
 
     if (bqGainMid < 0.0 || pState->m_oldMidKill < 0.0) {
         if (bqGainMid != pState->m_oldMidKill) {
-            double midCenter = getCenterFrequency(
-                    pState->m_loFreqCorner, pState->m_highFreqCorner);
-            pState->m_midKill->setFrequencyCorners(
-                    engineParameters.sampleRate(), midCenter, kQKill, bqGainMid);
+            pState->m_midKill->setGain(bqGainMid);
             pState->m_oldMidKill = bqGainMid;
         }
         if (bqGainMid < 0.0) {
@@ -342,10 +347,7 @@ void BiquadFullKillEQEffect::processChannel(
 
     if (bqGainHigh > 0.0 || pState->m_oldHighBoost > 0.0) {
         if (bqGainHigh != pState->m_oldHighBoost) {
-            double highCenter = getCenterFrequency(
-                    pState->m_highFreqCorner, kMaximumFrequency);
-            pState->m_highBoost->setFrequencyCorners(
-                    engineParameters.sampleRate(), highCenter, kQBoost, bqGainHigh);
+            pState->m_highBoost->setGain(bqGainHigh);
             pState->m_oldHighBoost = bqGainHigh;
         }
         if (bqGainHigh > 0.0) {
@@ -362,10 +364,7 @@ void BiquadFullKillEQEffect::processChannel(
 
     if (bqGainHigh < 0.0 || pState->m_oldHighKill < 0.0) {
         if (bqGainHigh != pState->m_oldHighKill) {
-            double highCenter = getCenterFrequency(
-                    pState->m_highFreqCorner, kMaximumFrequency);
-            pState->m_highKill->setFrequencyCorners(
-                    engineParameters.sampleRate(), highCenter / 2, kQHighKillShelve, bqGainHigh);
+            pState->m_highKill->setGain(bqGainHigh);
             pState->m_oldHighKill = bqGainHigh;
         }
         if (bqGainHigh < 0.0) {
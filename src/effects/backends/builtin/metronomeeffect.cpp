@@ -34,11 +34,6 @@ std::span<T> subspan_clamped(std::span<T> in, typename std::span<T>::size_type o
     return in.subspan(std::min(offset, in.size()));
 }
 
-constexpr std::size_t framesPerBeat(
-        mixxx::audio::SampleRate framesPerSecond, double beatsPerMinute) {
-    double framesPerMinute = framesPerSecond * 60;
-    return static_cast<std::size_t>(framesPerMinute / beatsPerMinute);
-}
 // returns where in the output buffer to start playing the next click.
 // If there the span is empty, no click should be played yet.
 std::span<CSAMPLE> syncedClickOutput(double beatFractionBufferEnd,
@@ -55,8 +50,10 @@ std::span<CSAMPLE> syncedClickOutput(double beatFractionBufferEnd,
     double beatToBufferEndFrames = std::abs(beatLength) *
             (needsPreviousBeat ? (1 - beatFractionBufferEnd)
                                : beatFractionBufferEnd);
+    // Round to the nearest frame instead of truncating so that the
+    // click is placed at the frame closest to the actual beat.
     std::size_t beatToBufferEndSamples =
-            static_cast<std::size_t>(beatToBufferEndFrames) *
+            static_cast<std::size_t>(std::llround(beatToBufferEndFrames)) *
             mixxx::kEngineChannelOutputCount;
 
     if (beatToBufferEndSamples <= output.size()) {
@@ -66,12 +63,28 @@ std::span<CSAMPLE> syncedClickOutput(double beatFractionBufferEnd,
 }
 
 std::span<CSAMPLE> unsyncedClickOutput(mixxx::audio::SampleRate framesPerSecond,
-        std::size_t framesSinceLastClick,
+        double* pFramesSinceLastBeat,
         double bpm,
         std::span<CSAMPLE> output) {
-    std::size_t offset = framesSinceLastClick %
-            framesPerBeat(framesPerSecond, bpm);
-    return subspan_clamped(output, offset * mixxx::kEngineChannelOutputCount);
+    const double beatLengthFrames = framesPerSecond * 60 / bpm;
+    if (*pFramesSinceLastBeat < beatLengthFrames) {
+        // No beat inside this buffer.
+        return {};
+    }
+    // Keep the fractional phase so consecutive beats stay on the exact
+    // period instead of quantizing each beat to the previous click frame.
+    *pFramesSinceLastBeat = std::fmod(*pFramesSinceLastBeat, beatLengthFrames);
+    const std::size_t beatToBufferEndSamples =
+            static_cast<std::size_t>(std::llround(*pFramesSinceLastBeat)) *
+            mixxx::kEngineChannelOutputCount;
+    if (beatToBufferEndSamples > output.size()) {
+        // A bpm change moved the beat before this buffer, start the
+        // click right away.
+        return output;
+    }
+    // The beat is beatToBufferEndSamples before the end of the buffer,
+    // start the click exactly there.
+    return output.last(beatToBufferEndSamples);
 }
 
 } // namespace
@@ -164,31 +177,37 @@ void MetronomeEffect::processChannel(
     if (enableState == EffectEnableState::Enabling) {
         if (shouldSync && hasBeatInfo) {
             // Skip first click and sync phase
-            gs->framesSinceLastClick = click.size();
+            gs->framesSinceClickStart = click.size();
         } else {
-            gs->framesSinceLastClick = 0;
+            gs->framesSinceClickStart = 0;
         }
+        gs->framesSinceLastBeat = 0;
     }
 
     const CSAMPLE_GAIN gain = db2ratio(static_cast<float>(m_pGainParameter->value()));
 
-    playMonoSamplesWithGain(subspan_clamped(click, gs->framesSinceLastClick), output, gain);
-    gs->framesSinceLastClick += engineParameters.framesPerBuffer();
-
-    std::span<CSAMPLE> outputBufferOffset = shouldSync && hasBeatInfo
-            ? syncedClickOutput(*groupFeatures.beat_fraction_buffer_end,
-                      groupFeatures.beat_length,
-                      engineParameters,
-                      output)
-            : unsyncedClickOutput(
-                      engineParameters
-                              .sampleRate(), // engineParameters::sampleRate()
-                                             // in reality returns the frameRate
-                      gs->framesSinceLastClick,
-                      m_pBpmParameter->value(),
-                      output);
+    playMonoSamplesWithGain(subspan_clamped(click, gs->framesSinceClickStart), output, gain);
+    gs->framesSinceClickStart += engineParameters.framesPerBuffer();
+
+    std::span<CSAMPLE> outputBufferOffset;
+    if (shouldSync && hasBeatInfo) {
+        outputBufferOffset = syncedClickOutput(
+                *groupFeatures.beat_fraction_buffer_end,
+                groupFeatures.beat_length,
+                engineParameters,
+                output);
+    } else {
+        gs->framesSinceLastBeat += engineParameters.framesPerBuffer();
+        outputBufferOffset = unsyncedClickOutput(
+                engineParameters
+                        .sampleRate(), // engineParameters::sampleRate()
+                                       // in reality returns the frameRate
+                &gs->framesSinceLastBeat,
+                m_pBpmParameter->value(),
+                output);
+    }
 
     if (!outputBufferOffset.empty()) {
-        gs->framesSinceLastClick = playMonoSamplesWithGain(click, outputBufferOffset, gain);
+        gs->framesSinceClickStart = playMonoSamplesWithGain(click, outputBufferOffset, gain);
     }
 }
@@ -12,7 +12,13 @@ class MetronomeGroupState final : public EffectState {
             : EffectState(engineParameters) {};
     ~MetronomeGroupState() override = default;
 
-    std::size_t framesSinceLastClick = 0;
+    // Frames of the click already played, relative to the start of the
+    // click table. Values at or past the table length mean silence.
+    std::size_t framesSinceClickStart = 0;
+    // Frames since the last beat including the fractional part, so that
+    // the unsynced click period does not drift by the rounding error of
+    // up to one frame per beat.
+    double framesSinceLastBeat = 0.0;
 };
 
 class MetronomeEffect : public EffectProcessorImpl<MetronomeGroupState> {
@@ -10,6 +10,7 @@
 #include "engine/effects/groupfeaturestate.h"
 #include "engine/effects/message.h"
 #include "engine/engine.h"
+#include "util/realtimesafety.h"
 #include "util/sample.h"
 #include "util/types.h"
 #include "util/unique_ptr_vector.h"
@@ -97,7 +98,7 @@ class EffectProcessor {
             CSAMPLE* pOutput,
             const mixxx::EngineParameters& engineParameters,
             const EffectEnableState enableState,
-            const GroupFeatureState& groupFeatures) = 0;
+            const GroupFeatureState& groupFeatures) MIXXX_RT_NONBLOCKING = 0;
 
     /// This method is used for obtaining the delay of the output buffer
     /// compared to the input buffer based on the internal effect processing.
@@ -140,7 +141,7 @@ class EffectProcessorImpl : public EffectProcessor {
             CSAMPLE* pOutput,
             const mixxx::EngineParameters& engineParameters,
             const EffectEnableState enableState,
-            const GroupFeatureState& groupFeatures) = 0;
+            const GroupFeatureState& groupFeatures) MIXXX_RT_NONBLOCKING = 0;
 
     /// By default, the group delay for every effect is zero. The effect implementation
     /// can override this method and set actual number of frames for the effect delay.
@@ -247,13 +247,13 @@ void EffectChain::loadEmptyNamelessPreset() {
 }
 
 void EffectChain::sendParameterUpdate() {
-    EffectsRequest* pRequest = new EffectsRequest();
-    pRequest->type = EffectsRequest::SET_EFFECT_CHAIN_PARAMETERS;
-    pRequest->pTargetChain = m_pEngineEffectChain;
-    pRequest->SetEffectChainParameters.enabled = m_pControlChainEnabled->toBool();
-    pRequest->SetEffectChainParameters.mix_mode = mixMode();
-    pRequest->SetEffectChainParameters.mix = m_pControlChainMix->get();
-    m_pMessenger->writeRequest(pRequest);
+    EffectsRequest request;
+    request.type = EffectsRequest::SET_EFFECT_CHAIN_PARAMETERS;
+    request.pTargetChain = m_pEngineEffectChain;
+    request.SetEffectChainParameters.enabled = m_pControlChainEnabled->toBool();
+    request.SetEffectChainParameters.mix_mode = mixMode();
+    request.SetEffectChainParameters.mix = m_pControlChainMix->get();
+    m_pMessenger->writeParameterUpdate(request);
 }
 
 QString EffectChain::group() const {
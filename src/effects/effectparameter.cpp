@@ -64,14 +64,40 @@ void EffectParameter::setValue(double value) {
     updateEngineState();
 }
 
+void EffectParameter::setValueRamped(double targetValue, double durationFrames) {
+    // TODO(XXX) Handle inf, -inf, and nan
+    const double startValue = m_value;
+    m_value = targetValue;
+
+    if (clampValue()) {
+        qWarning() << debugString() << "WARNING: Value was outside of limits, clamped.";
+    }
+
+    if (!m_pEngineEffect) {
+        return;
+    }
+    if (durationFrames <= 0.0) {
+        updateEngineState();
+        return;
+    }
+    EffectsRequest request;
+    request.type = EffectsRequest::SET_PARAMETER_RAMP;
+    request.pTargetEffect = m_pEngineEffect;
+    request.SetParameterRamp.iParameter = m_pParameterManifest->index();
+    request.SetParameterRamp.startValue = startValue;
+    request.SetParameterRamp.rampDurationFrames = durationFrames;
+    request.value = m_value;
+    m_pMessenger->writeParameterUpdate(request);
+}
+
 void EffectParameter::updateEngineState() {
     if (!m_pEngineEffect) {
         return;
     }
-    EffectsRequest* pRequest = new EffectsRequest();
-    pRequest->type = EffectsRequest::SET_PARAMETER_PARAMETERS;
-    pRequest->pTargetEffect = m_pEngineEffect;
-    pRequest->SetParameterParameters.iParameter = m_pParameterManifest->index();
-    pRequest->value = m_value;
-    m_pMessenger->writeRequest(pRequest);
+    EffectsRequest request;
+    request.type = EffectsRequest::SET_PARAMETER_PARAMETERS;
+    request.pTargetEffect = m_pEngineEffect;
+    request.SetParameterParameters.iParameter = m_pParameterManifest->index();
+    request.value = m_value;
+    m_pMessenger->writeParameterUpdate(request);
 }
@@ -43,6 +43,10 @@ class EffectParameter {
 
     double getValue() const;
     void setValue(double value);
+    /// Like setValue(), but instructs the engine to sweep linearly from the
+    /// current value to the new value over durationFrames frames instead of
+    /// jumping to it. The whole sweep is a single message to the engine.
+    void setValueRamped(double targetValue, double durationFrames);
 
     void updateEngineState();
 
@@ -3,6 +3,7 @@
 #include <QDebug>
 
 #include "control/controlencoder.h"
+#include "control/controlobject.h"
 #include "control/controlpushbutton.h"
 #include "effects/backends/effectmanifest.h"
 #include "effects/defs.h"
@@ -183,11 +184,11 @@ void EffectSlot::updateEngineState() {
         return;
     }
 
-    EffectsRequest* pRequest = new EffectsRequest();
-    pRequest->type = EffectsRequest::SET_EFFECT_PARAMETERS;
-    pRequest->pTargetEffect = m_pEngineEffect;
-    pRequest->SetEffectParameters.enabled = m_pControlEnabled->toBool();
-    m_pMessenger->writeRequest(pRequest);
+    EffectsRequest request;
+    request.type = EffectsRequest::SET_EFFECT_PARAMETERS;
+    request.pTargetEffect = m_pEngineEffect;
+    request.SetEffectParameters.enabled = m_pControlEnabled->toBool();
+    m_pMessenger->writeParameterUpdate(request);
 
     for (const auto& parameterList : std::as_const(m_allParameters)) {
         for (auto const& pParameter : parameterList) {
@@ -271,6 +272,31 @@ void EffectSlot::loadEffectInner(const EffectManifestPointer pManifest,
             qDebug() << this << m_group << "unloading effect";
         }
     }
+    // If the newly loaded preset uses the effect that is already loaded,
+    // snapshot the current knob values so that the parameters can morph
+    // from the old to the new values instead of jumping. Buttons always
+    // switch discretely.
+    QHash<QString, double> morphStartValues;
+    double morphDurationFrames = 0.0;
+    if (pManifest && m_pManifest &&
+            pManifest->id() == m_pManifest->id() &&
+            pManifest->backendType() == m_pManifest->backendType() &&
+            m_pControlEnabled->toBool()) {
+        morphDurationFrames = presetMorphDurationFrames();
+        if (morphDurationFrames > 0.0) {
+            for (const auto& parameterList : std::as_const(m_allParameters)) {
+                for (const auto& pParameter : parameterList) {
+                    if (pParameter->manifest()->parameterType() ==
+                            EffectParameterType::Knob) {
+                        morphStartValues.insert(
+                                pParameter->manifest()->id(),
+                                pParameter->getValue());
+                    }
+                }
+            }
+        }
+    }
+
     unloadEffect();
     DEBUG_ASSERT(!m_pManifest);
 
@@ -311,6 +337,15 @@ void EffectSlot::loadEffectInner(const EffectManifestPointer pManifest,
                 m_pMessenger,
                 pManifestParameter,
                 parameterPreset));
+        const auto morphIt = morphStartValues.constFind(pManifestParameter->id());
+        if (morphIt != morphStartValues.constEnd() &&
+                *morphIt != pParameter->getValue()) {
+            // Sweep engine-side from the previous preset's value to the
+            // new one over the beat-synced morph duration.
+            const double targetValue = pParameter->getValue();
+            pParameter->setValue(*morphIt);
+            pParameter->setValueRamped(targetValue, morphDurationFrames);
+        }
         m_allParameters[pManifestParameter->parameterType()].append(pParameter);
     }
 
@@ -368,6 +403,21 @@ void EffectSlot::loadEffectInner(const EffectManifestPointer pManifest,
     updateEngineState();
 }
 
+double EffectSlot::presetMorphDurationFrames() const {
+    const double morphBeats = m_pEffectsManager->presetMorphBeats();
+    if (morphBeats <= 0.0) {
+        return 0.0;
+    }
+    const double bpm = ControlObject::get(
+            ConfigKey(QStringLiteral("[InternalClock]"), QStringLiteral("bpm")));
+    const double sampleRate = ControlObject::get(
+            ConfigKey(QStringLiteral("[App]"), QStringLiteral("samplerate")));
+    if (bpm <= 0.0 || sampleRate <= 0.0) {
+        return 0.0;
+    }
+    return morphBeats * 60.0 / bpm * sampleRate;
+}
+
 void EffectSlot::unloadEffect() {
     if (!isLoaded()) {
         return;
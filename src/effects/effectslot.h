@@ -159,6 +159,11 @@ class EffectSlot : public QObject {
     void loadParameters();
     void unloadEffect();
 
+    /// Duration of a beat-synced preset morph in engine frames, derived
+    /// from the configured beat count and the current tempo of the
+    /// internal clock. Returns 0 if morphing is disabled.
+    double presetMorphDurationFrames() const;
+
     const unsigned int m_iEffectNumber;
     QHash<EffectParameterType, unsigned int> m_iNumParameterSlots;
     const QString m_group;
@@ -229,6 +229,10 @@ bool EffectsManager::isAdoptMetaknobSettingEnabled() const {
     return m_pConfig->getValue(ConfigKey("[Effects]", "AdoptMetaknobValue"), true);
 }
 
+double EffectsManager::presetMorphBeats() const {
+    return m_pConfig->getValue(ConfigKey("[Effects]", "PresetMorphBeats"), 0.0);
+}
+
 void EffectsManager::readEffectsXml() {
     QDir settingsPath(m_pConfig->getSettingsPath());
     QFile file(settingsPath.absoluteFilePath(kEffectsXmlFile));
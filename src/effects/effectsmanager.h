@@ -81,6 +81,11 @@ class EffectsManager {
 
     bool isAdoptMetaknobSettingEnabled() const;
 
+    /// Number of beats over which knob parameters sweep from their current
+    /// values to the values of a newly loaded preset of the same effect.
+    /// 0 disables morphing, i.e. parameters jump to the preset values.
+    double presetMorphBeats() const;
+
   private:
     void addStandardEffectChains();
     void addOutputEffectChain();
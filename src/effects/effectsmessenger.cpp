@@ -4,6 +4,20 @@
 #include "engine/effects/engineeffectchain.h"
 #include "util/make_const_iterator.h"
 
+namespace {
+
+// request_ids of pooled parameter updates carry this flag plus the slot
+// index and the slot generation, so responses can be routed back to their
+// pool slot without a hash lookup. Regular request_ids count up from zero
+// and will never collide with the flag bit.
+constexpr qint64 kPooledRequestIdFlag = qint64(1) << 62;
+constexpr int kPooledSlotBits = 16;
+constexpr qint64 kPooledSlotMask = (qint64(1) << kPooledSlotBits) - 1;
+constexpr qint64 kPooledGenerationMask =
+        (qint64(1) << (62 - kPooledSlotBits)) - 1;
+
+} // anonymous namespace
+
 EffectsMessenger::EffectsMessenger(
         EffectsRequestPipe&& requestPipe)
         : m_requestPipe(std::move(requestPipe)),
@@ -32,8 +46,23 @@ bool EffectsMessenger::writeRequest(EffectsRequest* request) {
     // with responses when writing new requests.
     processEffectsResponses();
 
+    // Parameter updates that are still waiting for free capacity must not
+    // outlive the engine object they target. Otherwise a coalesced update
+    // could be delivered after the removal request that is written below.
+    if (request->type == EffectsRequest::REMOVE_EFFECT_FROM_CHAIN) {
+        m_pendingParameterUpdates.removeIf([&](const auto& it) {
+            return it.key().first ==
+                    reinterpret_cast<quintptr>(request->RemoveEffectFromChain.pEffect);
+        });
+    } else if (request->type == EffectsRequest::REMOVE_EFFECT_CHAIN) {
+        m_pendingParameterUpdates.removeIf([&](const auto& it) {
+            return it.key().first ==
+                    reinterpret_cast<quintptr>(request->RemoveEffectChain.pChain);
+        });
+    }
+    flushPendingParameterUpdates();
+
     request->request_id = m_nextRequestId++;
-    // TODO(XXX) use preallocated requests to avoid delete calls from engine
     if (m_requestPipe.writeMessage(request)) {
         m_activeRequests[request->request_id] = request;
         return true;
@@ -42,9 +71,119 @@ bool EffectsMessenger::writeRequest(EffectsRequest* request) {
     return false;
 }
 
+void EffectsMessenger::writeParameterUpdate(const EffectsRequest& request) {
+    DEBUG_ASSERT(isParameterUpdate(request));
+    if (m_bShuttingDown) {
+        // Parameter updates carry no ownership, so they can simply be
+        // dropped once the engine is down.
+        return;
+    }
+
+    processEffectsResponses();
+
+    const ParameterUpdateKey key = parameterUpdateKey(request);
+    const auto pendingIt = m_pendingParameterUpdates.find(key);
+    if (pendingIt != m_pendingParameterUpdates.end()) {
+        // An older update for the same parameter is still waiting for free
+        // capacity. Replace it instead of sending the new value directly,
+        // which would deliver the values out of order (latest-value-wins).
+        pendingIt.value() = request;
+        return;
+    }
+    if (!trySendParameterUpdate(request)) {
+        m_pendingParameterUpdates.insert(key, request);
+    }
+}
+
+// static
+bool EffectsMessenger::isParameterUpdate(const EffectsRequest& request) {
+    return request.type == EffectsRequest::SET_EFFECT_CHAIN_PARAMETERS ||
+            request.type == EffectsRequest::SET_EFFECT_PARAMETERS ||
+            request.type == EffectsRequest::SET_PARAMETER_PARAMETERS ||
+            request.type == EffectsRequest::SET_PARAMETER_RAMP;
+}
+
+// static
+EffectsMessenger::ParameterUpdateKey EffectsMessenger::parameterUpdateKey(
+        const EffectsRequest& request) {
+    DEBUG_ASSERT(isParameterUpdate(request));
+    if (request.type == EffectsRequest::SET_PARAMETER_PARAMETERS) {
+        return qMakePair(reinterpret_cast<quintptr>(request.pTargetEffect),
+                request.SetParameterParameters.iParameter);
+    }
+    if (request.type == EffectsRequest::SET_PARAMETER_RAMP) {
+        // Shares the key space with SET_PARAMETER_PARAMETERS on purpose:
+        // a newer direct update supersedes a pending ramp for the same
+        // parameter and vice versa.
+        return qMakePair(reinterpret_cast<quintptr>(request.pTargetEffect),
+                request.SetParameterRamp.iParameter);
+    }
+    // SET_EFFECT_CHAIN_PARAMETERS and SET_EFFECT_PARAMETERS update the whole
+    // chain respectively effect, the targets cannot collide because they are
+    // distinct engine objects.
+    return qMakePair(reinterpret_cast<quintptr>(request.pTargetChain), -1);
+}
+
+bool EffectsMessenger::trySendParameterUpdate(const EffectsRequest& request) {
+    for (int slotIndex = 0; slotIndex < kParameterUpdatePoolSize; ++slotIndex) {
+        ParameterUpdateSlot& slot = m_parameterUpdatePool[slotIndex];
+        if (slot.inUse) {
+            continue;
+        }
+        slot.generation = (slot.generation + 1) & kPooledGenerationMask;
+        slot.request = request;
+        slot.request.request_id = kPooledRequestIdFlag |
+                (slot.generation << kPooledSlotBits) |
+                slotIndex;
+        if (!m_requestPipe.writeMessage(&slot.request)) {
+            // Pipe is full, keep the slot free and let the caller coalesce
+            // the update until the engine has caught up.
+            return false;
+        }
+        slot.inUse = true;
+        return true;
+    }
+    // All slots are in-flight.
+    return false;
+}
+
+void EffectsMessenger::flushPendingParameterUpdates() {
+    auto it = m_pendingParameterUpdates.begin();
+    while (it != m_pendingParameterUpdates.end()) {
+        if (!trySendParameterUpdate(it.value())) {
+            // Still saturated, retry on the next response or write.
+            return;
+        }
+        it = m_pendingParameterUpdates.erase(it);
+    }
+}
+
+void EffectsMessenger::releasePooledParameterUpdate(qint64 requestId) {
+    DEBUG_ASSERT(requestId & kPooledRequestIdFlag);
+    const int slotIndex = static_cast<int>(requestId & kPooledSlotMask);
+    const qint64 generation = (requestId >> kPooledSlotBits) & kPooledGenerationMask;
+    VERIFY_OR_DEBUG_ASSERT(slotIndex < kParameterUpdatePoolSize) {
+        return;
+    }
+    ParameterUpdateSlot& slot = m_parameterUpdatePool[slotIndex];
+    VERIFY_OR_DEBUG_ASSERT(slot.inUse && slot.generation == generation) {
+        qWarning() << debugString()
+                   << "WARNING: EffectsResponse for a stale pooled request_id:"
+                   << requestId;
+        return;
+    }
+    slot.inUse = false;
+}
+
 void EffectsMessenger::processEffectsResponses() {
     EffectsResponse response;
     while (m_requestPipe.readMessage(&response)) {
+        if (response.request_id & kPooledRequestIdFlag) {
+            // Parameter updates carry no ownership, just recycle the slot.
+            releasePooledParameterUpdate(response.request_id);
+            continue;
+        }
+
         auto it = m_activeRequests.constFind(response.request_id);
 
         VERIFY_OR_DEBUG_ASSERT(it != m_activeRequests.constEnd()) {
@@ -67,6 +206,7 @@ void EffectsMessenger::processEffectsResponses() {
             it = constErase(&m_activeRequests, it);
         }
     }
+    flushPendingParameterUpdates();
 }
 
 void EffectsMessenger::collectGarbage(const EffectsRequest* pRequest) {
@@ -1,5 +1,9 @@
 #pragma once
 
+#include <QHash>
+#include <QPair>
+#include <array>
+
 #include "engine/effects/message.h"
 
 /// EffectsMessenger sends EffectsRequests from the main thread and receives
@@ -21,18 +25,56 @@ class EffectsMessenger {
     /// ownership of request and deletes it once a response is received.
     bool writeRequest(EffectsRequest* request);
 
+    /// Write a parameter update request (SET_EFFECT_CHAIN_PARAMETERS,
+    /// SET_EFFECT_PARAMETERS or SET_PARAMETER_PARAMETERS) to the
+    /// EngineEffectsManager. Unlike writeRequest, the request is copied into
+    /// a preallocated slot of a fixed-capacity pool, so bursts of parameter
+    /// automation do not allocate heap memory per message. When the pool or
+    /// the pipe is exhausted, updates are coalesced per parameter and only
+    /// the latest value is delivered once capacity is available again.
+    void writeParameterUpdate(const EffectsRequest& request);
+
     void initiateShutdown();
     void processEffectsResponses();
 
   private:
+    /// Preallocated slot for an in-flight parameter update request. The
+    /// generation is incremented each time the slot is acquired and encoded
+    /// into the request_id, so a stale or duplicated response cannot release
+    /// a slot that has already been reused.
+    struct ParameterUpdateSlot {
+        EffectsRequest request;
+        qint64 generation = 0;
+        bool inUse = false;
+    };
+
+    /// Identifies the target of a parameter update request for coalescing,
+    /// consisting of the target engine object and the parameter index
+    /// (or -1 for requests that update the whole chain or effect).
+    typedef QPair<quintptr, int> ParameterUpdateKey;
+
+    static bool isParameterUpdate(const EffectsRequest& request);
+    static ParameterUpdateKey parameterUpdateKey(const EffectsRequest& request);
+
+    bool trySendParameterUpdate(const EffectsRequest& request);
+    void flushPendingParameterUpdates();
+    void releasePooledParameterUpdate(qint64 requestId);
+
     void collectGarbage(const EffectsRequest* pRequest);
 
     QString debugString() const {
         return "EffectsMessenger";
     }
 
+    static constexpr int kParameterUpdatePoolSize = 256;
+
     QHash<qint64, EffectsRequest*> m_activeRequests;
     EffectsRequestPipe m_requestPipe;
     qint64 m_nextRequestId;
     bool m_bShuttingDown;
+
+    std::array<ParameterUpdateSlot, kParameterUpdatePoolSize> m_parameterUpdatePool;
+    /// Latest unsent parameter update per target, kept while the pool or
+    /// the pipe is saturated (latest-value-wins).
+    QHash<ParameterUpdateKey, EffectsRequest> m_pendingParameterUpdates;
 };
@@ -0,0 +1,98 @@
+#include "engine/audioloadgovernor.h"
+
+#include "control/controlproxy.h"
+#include "control/controlpushbutton.h"
+#include "engine/enginebuffer.h"
+#include "moc_audioloadgovernor.cpp"
+#include "util/logger.h"
+
+namespace {
+
+const mixxx::Logger kLogger("AudioLoadGovernor");
+
+const QString kAppGroup = QStringLiteral("[App]");
+
+// Polling faster than this would not help: the usage control is itself
+// a smoothed average and a step down takes a moment to show an effect.
+constexpr int kPollIntervalMillis = 1000;
+
+// Fraction of the callback budget above which the engine is considered
+// overloaded. Occasional spikes above this are normal, which is why a
+// single poll never triggers a step down.
+constexpr double kUsageThreshold = 0.9;
+
+// Number of consecutive overloaded polls before stepping down.
+constexpr int kOverloadedPollsBeforeStepDown = 3;
+
+} // namespace
+
+AudioLoadGovernor::AudioLoadGovernor(QObject* pParent)
+        : QObject(pParent),
+          m_pGovernorEnabled(std::make_unique<ControlPushButton>(
+                  ConfigKey(kAppGroup, QStringLiteral("audio_load_governor")),
+                  true,
+                  0.0)),
+          m_pAudioLatencyUsage(make_parented<ControlProxy>(
+                  kAppGroup, QStringLiteral("audio_latency_usage"), this)),
+          m_pAudioLatencyOverload(make_parented<ControlProxy>(
+                  kAppGroup, QStringLiteral("audio_latency_overload"), this)),
+          m_pKeylockEngine(make_parented<ControlProxy>(
+                  kAppGroup, QStringLiteral("keylock_engine"), this)),
+          m_overloadedPolls(0),
+          m_loggedNoFurtherStep(false) {
+    m_pGovernorEnabled->setButtonMode(mixxx::control::ButtonMode::Toggle);
+
+    connect(&m_pollTimer, &QTimer::timeout, this, &AudioLoadGovernor::slotPoll);
+    m_pollTimer.start(kPollIntervalMillis);
+}
+
+AudioLoadGovernor::~AudioLoadGovernor() = default;
+
+void AudioLoadGovernor::slotPoll() {
+    if (!m_pGovernorEnabled->toBool()) {
+        m_overloadedPolls = 0;
+        return;
+    }
+
+    // An actual underrun counts as overloaded regardless of the average
+    // usage, since a short DSP spike can blow the callback budget while
+    // the smoothed usage still looks harmless.
+    const bool overloaded = m_pAudioLatencyUsage->get() > kUsageThreshold ||
+            m_pAudioLatencyOverload->toBool();
+    if (!overloaded) {
+        m_overloadedPolls = 0;
+        return;
+    }
+
+    if (++m_overloadedPolls < kOverloadedPollsBeforeStepDown) {
+        return;
+    }
+    m_overloadedPolls = 0;
+
+    const auto engine = static_cast<EngineBuffer::KeylockEngine>(
+            m_pKeylockEngine->get());
+#ifdef __RUBBERBAND__
+    if (engine == EngineBuffer::KeylockEngine::RubberBandFiner) {
+        kLogger.warning()
+                << "Sustained audio callback overload, switching keylock"
+                << "engine from"
+                << EngineBuffer::getKeylockEngineName(engine)
+                << "to"
+                << EngineBuffer::getKeylockEngineName(
+                           EngineBuffer::KeylockEngine::RubberBandFaster)
+                << "for this session";
+        m_pKeylockEngine->set(static_cast<double>(
+                EngineBuffer::KeylockEngine::RubberBandFaster));
+        m_loggedNoFurtherStep = false;
+        return;
+    }
+#endif
+    if (!m_loggedNoFurtherStep) {
+        m_loggedNoFurtherStep = true;
+        kLogger.warning()
+                << "Sustained audio callback overload, but keylock engine"
+                << EngineBuffer::getKeylockEngineName(engine)
+                << "has no cheaper quality tier to step down to."
+                << "Consider increasing the audio buffer size.";
+    }
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <QObject>
+#include <QTimer>
+#include <memory>
+
+#include "util/parented_ptr.h"
+
+class ControlProxy;
+class ControlPushButton;
+
+/// Watches the audio callback load from the main thread and steps down
+/// expensive quality settings before the engine starts to underrun.
+///
+/// The engine already publishes its load as [App],audio_latency_usage
+/// (fraction of the callback budget consumed) and flags actual buffer
+/// underruns via [App],audio_latency_overload. The governor polls these
+/// controls at a slow rate and, when the load stays above the threshold
+/// for several consecutive polls, switches the keylock engine from
+/// RubberBand Finer to RubberBand Faster. The keylock engine is the one
+/// quality tier that every playing deck picks up immediately at runtime.
+///
+/// The step down is session-only: the [App],keylock_engine control is
+/// not persistent, so the configured engine is restored on the next
+/// start. There is no automatic step back up, since flapping between
+/// engines would be audible. Each step is logged as a warning so the
+/// user can find out why the sound quality changed.
+///
+/// The governor is off by default and enabled with the persistent
+/// [App],audio_load_governor control.
+class AudioLoadGovernor : public QObject {
+    Q_OBJECT
+  public:
+    explicit AudioLoadGovernor(QObject* pParent = nullptr);
+    ~AudioLoadGovernor() override;
+
+  private slots:
+    void slotPoll();
+
+  private:
+    std::unique_ptr<ControlPushButton> m_pGovernorEnabled;
+    parented_ptr<ControlProxy> m_pAudioLatencyUsage;
+    parented_ptr<ControlProxy> m_pAudioLatencyOverload;
+    parented_ptr<ControlProxy> m_pKeylockEngine;
+
+    QTimer m_pollTimer;
+    // Number of consecutive polls that found the engine overloaded.
+    int m_overloadedPolls;
+    // Avoid repeating the "no further step" warning on every poll.
+    bool m_loggedNoFurtherStep;
+};
@@ -183,7 +183,8 @@ SINT EngineBufferScaleLinear::do_copy(CSAMPLE* buf, SINT buf_size) {
     return read_samples;
 }
 
-// Stretch a specified buffer worth of audio using linear interpolation
+// Stretch a specified buffer worth of audio using 4-point Hermite
+// interpolation, falling back to linear interpolation at buffer edges
 double EngineBufferScaleLinear::do_scale(CSAMPLE* buf, SINT buf_size) {
     double rate_old = m_dOldRate;
     const double rate_new = m_dRate;
@@ -315,10 +316,30 @@ double EngineBufferScaleLinear::do_scale(CSAMPLE* buf, SINT buf_size) {
         // between the previous and the next?
         CSAMPLE frac = static_cast<CSAMPLE>(m_dCurrentFrame) - currentFrameFloor;
 
-        // Perform linear interpolation
-        for (int chIdx = 0; chIdx < chCount; chIdx++) {
-            buf[i + chIdx] = m_floorSample[chIdx] +
-                    frac * (m_ceilSample[chIdx] - m_floorSample[chIdx]);
+        if (sampleCount >= chCount &&
+                sampleCount + 3 * chCount - 1 < m_bufferIntSize) {
+            // The neighbor frames on both sides are buffered as well, so use
+            // 4-point Hermite interpolation. This removes most of the audible
+            // aliasing of plain linear interpolation when scratching at high
+            // rates. The direction does not matter here because the internal
+            // buffer always advances in playback order.
+            const CSAMPLE* pFloorSample = &m_bufferInt[sampleCount];
+            for (int chIdx = 0; chIdx < chCount; chIdx++) {
+                buf[i + chIdx] = hermite4(frac,
+                        pFloorSample[chIdx - chCount],
+                        pFloorSample[chIdx],
+                        pFloorSample[chIdx + chCount],
+                        pFloorSample[chIdx + 2 * chCount]);
+            }
+        } else {
+            // At the edges of the internal buffer one of the neighbor frames
+            // is missing, perform linear interpolation between the cached
+            // floor/ceil samples instead. Both interpolations agree on the
+            // frame positions themselves, so no discontinuity is introduced.
+            for (int chIdx = 0; chIdx < chCount; chIdx++) {
+                buf[i + chIdx] = m_floorSample[chIdx] +
+                        frac * (m_ceilSample[chIdx] - m_floorSample[chIdx]);
+            }
         }
 
         m_floorSampleOld.swap(m_floorSample);
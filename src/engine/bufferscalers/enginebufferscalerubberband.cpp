@@ -17,6 +17,22 @@ using RubberBand::RubberBandStretcher;
 #define RUBBERBANDV3 (RUBBERBAND_API_MAJOR_VERSION >= 3 || \
         (RUBBERBAND_API_MAJOR_VERSION == 2 && RUBBERBAND_API_MINOR_VERSION >= 7))
 
+namespace {
+
+// Fraction of the real-time budget of one callback that scaleBuffer() may
+// consume before the callback is counted as over budget. The remainder of
+// the budget is needed by the rest of the engine callback (EQs, effects,
+// mixing).
+constexpr double kOverBudgetFraction = 0.75;
+
+// Number of consecutive over-budget callbacks before the finer (R3)
+// engine is considered too expensive for this machine and the scaler
+// falls back to the faster (R2) engine. A single spike (e.g. caused by
+// scheduling jitter) must not trigger the fallback.
+constexpr int kMaxConsecutiveOverBudget = 8;
+
+} // anonymous namespace
+
 EngineBufferScaleRubberBand::EngineBufferScaleRubberBand(
         ReadAheadManager* pReadAheadManager)
         : m_pReadAheadManager(pReadAheadManager),
@@ -290,6 +306,8 @@ double EngineBufferScaleRubberBand::scaleBuffer(
         return 0.0;
     }
     ScopedTimer t(QStringLiteral("EngineBufferScaleRubberBand::scaleBuffer"));
+    PerformanceTimer budgetTimer;
+    budgetTimer.start();
     if (m_dBaseRate == 0.0 || m_dTempoRatio == 0.0) {
         SampleUtil::clear(pOutputBuffer, iOutputBufferSize);
         // No actual samples/frames have been read from the
@@ -320,18 +338,23 @@ double EngineBufferScaleRubberBand::scaleBuffer(
         if (remaining_frames > 0 && next_block_frames_required > 0) {
             // The requested setting becomes effective after all previous frames have been processed
             m_effectiveRate = m_dBaseRate * m_dTempoRatio;
-            const SINT available_samples = m_pReadAheadManager->getNextSamples(
+            SINT available_samples = 0;
+            // For the common forward read the samples are borrowed directly
+            // from the caching reader's chunk cache and deinterleaved from
+            // there, skipping the copy into m_interleavedReadBuffer.
+            const CSAMPLE* pReadBuffer = m_pReadAheadManager->getNextSamplesSpan(
                     // The value doesn't matter here. All that matters is we
                     // are going forward or backward.
                     (m_bBackwards ? -1.0 : 1.0) * m_dBaseRate * m_dTempoRatio,
                     m_interleavedReadBuffer.data(),
                     getOutputSignal().frames2samples(next_block_frames_required),
-                    getOutputSignal().getChannelCount());
+                    getOutputSignal().getChannelCount(),
+                    &available_samples);
             const SINT available_frames = getOutputSignal().samples2frames(available_samples);
 
             if (available_frames > 0) {
                 last_read_failed = false;
-                deinterleaveAndProcess(m_interleavedReadBuffer.data(), available_frames);
+                deinterleaveAndProcess(pReadBuffer, available_frames);
             } else {
                 // We may get 0 samples once if we just hit a loop trigger, e.g.
                 // when reloop_toggle jumps back to loop_in, or when moving a
@@ -359,6 +382,30 @@ double EngineBufferScaleRubberBand::scaleBuffer(
         counter.increment();
     }
 
+    // Track the measured stretch cost against the real-time budget of this
+    // callback. If the finer (R3) engine repeatedly cannot keep up with the
+    // callback deadline on this machine, fall back to the faster (R2)
+    // engine instead of producing audible dropouts.
+    if (m_useEngineFiner) {
+        const double budgetNanos = 1e9 *
+                getOutputSignal().samples2frames(iOutputBufferSize) /
+                getOutputSignal().getSampleRate();
+        if (budgetTimer.elapsed().toIntegerNanos() >
+                static_cast<qint64>(kOverBudgetFraction * budgetNanos)) {
+            Counter counter("EngineBufferScaleRubberBand::scaleBuffer over budget");
+            counter.increment();
+            if (++m_consecutiveOverBudgetCount >= kMaxConsecutiveOverBudget) {
+                qWarning() << "RubberBand R3 engine repeatedly exceeded the"
+                           << "real-time budget of the engine callback,"
+                           << "falling back to the faster R2 engine";
+                useEngineFiner(false);
+                m_consecutiveOverBudgetCount = 0;
+            }
+        } else {
+            m_consecutiveOverBudgetCount = 0;
+        }
+    }
+
     // readFramesProcessed is interpreted as the total number of frames
     // consumed to produce the scaled buffer. Due to this, we do not take into
     // account directionality or starting point.
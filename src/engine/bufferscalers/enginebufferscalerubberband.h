@@ -85,4 +85,7 @@ class EngineBufferScaleRubberBand final : public EngineBufferScale {
     SINT m_remainingPaddingInOutput = 0;
 
     bool m_useEngineFiner;
+    /// Number of consecutive engine callbacks in which the stretcher
+    /// exceeded its share of the real-time budget, see scaleBuffer()
+    int m_consecutiveOverBudgetCount = 0;
 };
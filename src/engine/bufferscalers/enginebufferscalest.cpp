@@ -148,18 +148,23 @@ double EngineBufferScaleST::scaleBuffer(
         if (remaining_frames > 0) {
             // The requested setting becomes effective after all previous frames have been processed
             m_effectiveRate = m_dBaseRate * m_dTempoRatio;
-            SINT iAvailSamples = m_pReadAheadManager->getNextSamples(
+            SINT iAvailSamples = 0;
+            // For the common forward read the samples are borrowed directly
+            // from the caching reader's chunk cache and handed to SoundTouch
+            // from there, skipping the copy into m_bufferBack.
+            const CSAMPLE* pReadBuffer = m_pReadAheadManager->getNextSamplesSpan(
                     // The value doesn't matter here. All that matters is we
                     // are going forward or backward.
                     (m_bBackwards ? -1.0 : 1.0) * m_effectiveRate,
                     m_bufferBack.data(),
                     m_bufferBack.size(),
-                    getOutputSignal().getChannelCount());
+                    getOutputSignal().getChannelCount(),
+                    &iAvailSamples);
             SINT iAvailFrames = getOutputSignal().samples2frames(iAvailSamples);
 
             if (iAvailFrames > 0) {
                 last_read_failed = false;
-                m_pSoundTouch->putSamples(m_bufferBack.data(), iAvailFrames);
+                m_pSoundTouch->putSamples(pReadBuffer, iAvailFrames);
             } else {
                 // We may get 0 samples once if we just hit a loop trigger, e.g.
                 // when reloop_toggle jumps back to loop_in, or when moving a
@@ -3,6 +3,8 @@
 #include "engine/engine.h"
 #include "util/assert.h"
 #include "util/compatibility/qmutex.h"
+#include "util/performancetimer.h"
+#include "util/timer.h"
 
 RubberBandTask::RubberBandTask(
         size_t sampleRate, size_t channels, Options options)
@@ -11,7 +13,8 @@ RubberBandTask::RubberBandTask(
           m_completedSema(0),
           m_input(nullptr),
           m_samples(0),
-          m_isFinal(false) {
+          m_isFinal(false),
+          m_lastProcessNanos(0) {
     setAutoDelete(false);
 }
 
@@ -35,8 +38,12 @@ void RubberBandTask::run() {
     VERIFY_OR_DEBUG_ASSERT(m_completedSema.available() == 0 && m_input && m_samples) {
         return;
     };
+    ScopedTimer t(QStringLiteral("RubberBandTask::run"));
+    PerformanceTimer timer;
+    timer.start();
     process(m_input,
             m_samples,
             m_isFinal);
+    m_lastProcessNanos = timer.elapsed().toIntegerNanos();
     m_completedSema.release();
 }
@@ -29,6 +29,13 @@ class RubberBandTask : public RubberBandStretcher, public QRunnable {
     // Wait for the current task to complete.
     void waitReady();
 
+    // Duration of the last run() in nanoseconds. Only valid after
+    // waitReady() has returned; the semaphore handshake makes the
+    // value visible to the waiting thread.
+    qint64 lastProcessNanos() const {
+        return m_lastProcessNanos;
+    }
+
     void run();
 
   private:
@@ -38,4 +45,5 @@ class RubberBandTask : public RubberBandStretcher, public QRunnable {
     const float* const* m_input;
     size_t m_samples;
     bool m_isFinal;
+    qint64 m_lastProcessNanos;
 };
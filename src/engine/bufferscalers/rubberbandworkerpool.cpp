@@ -22,15 +22,17 @@ RubberBandWorkerPool::RubberBandWorkerPool(UserSettingsPointer pConfig)
     qDebug() << "RubberBand will use" << numRBTasks << "tasks to scale the audio signal";
 
     setThreadPriority(QThread::HighPriority);
-    // The RB pool will only be used to scale n-1 buffer sample, so the engine
-    // thread takes care of the last buffer and doesn't have to be idle.
-    setMaxThreadCount(numRBTasks - 1);
-
     // We allocate one runner less than the total of maximum supported channel,
     // so the engine thread will also perform a stretching operation, instead of
     // waiting all workers to complete. During performance testing, this ahas
     // show better results
-    for (int w = 0; w < maxThreadCount(); w++) {
-        reserveThread();
-    }
+    setMaxThreadCount(numRBTasks - 1);
+
+    // Note that the pool must not reserveThread() its slots upfront:
+    // reserved threads count towards activeThreadCount(), which makes
+    // tryStart() in RubberBandWrapper::process() always fail and forces
+    // all stretching back onto the engine thread. The worker threads are
+    // created on demand by the first tryStart() calls and expired again
+    // after the default timeout when idle, so the pool effectively sizes
+    // itself with the number of decks that actively use keylock.
 }
@@ -3,6 +3,7 @@
 #include "engine/bufferscalers/rubberbandworkerpool.h"
 #include "engine/engine.h"
 #include "util/assert.h"
+#include "util/performancetimer.h"
 #include "util/sample.h"
 
 using RubberBand::RubberBandStretcher;
@@ -179,7 +180,11 @@ size_t RubberBandWrapper::getStartDelay() const {
 }
 void RubberBandWrapper::process(const float* const* input, size_t samples, bool isFinal) {
     if (m_pInstances.size() == 1) {
-        return m_pInstances[0]->process(input, samples, isFinal);
+        PerformanceTimer timer;
+        timer.start();
+        m_pInstances[0]->process(input, samples, isFinal);
+        m_lastProcessNanos = timer.elapsed().toIntegerNanos();
+        return;
     } else {
         RubberBandWorkerPool* pPool = RubberBandWorkerPool::instance();
         for (auto& pInstance : m_pInstances) {
@@ -197,6 +202,13 @@ void RubberBandWrapper::process(const float* const* input, size_t samples, bool
         for (auto& pInstance : m_pInstances) {
             pInstance->waitReady();
         }
+        // Record the critical path of this fan-out cycle for the budget
+        // tracking in EngineBufferScaleRubberBand
+        qint64 maxTaskNanos = 0;
+        for (const auto& pInstance : m_pInstances) {
+            maxTaskNanos = qMax(maxTaskNanos, pInstance->lastProcessNanos());
+        }
+        m_lastProcessNanos = maxTaskNanos;
     }
 }
 void RubberBandWrapper::reset() {
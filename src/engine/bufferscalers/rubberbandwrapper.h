@@ -22,6 +22,14 @@ class RubberBandWrapper {
     void setPitchScale(double scale);
     void reset();
 
+    /// Worst-case duration in nanoseconds that a single stretcher instance
+    /// spent in RubberBand during the last process() cycle. For the
+    /// multi-instance case this is the maximum across all tasks, i.e. the
+    /// critical path of the fan-out.
+    qint64 lastProcessNanos() const {
+        return m_lastProcessNanos;
+    }
+
     // The following method are helper function and do not wrap any RubberBand calls
     void clear();
     void setup(mixxx::audio::SampleRate sampleRate,
@@ -35,4 +43,6 @@ class RubberBandWrapper {
     // Number of channel used for each instance. This may vary whether the track
     // is a stereo track or a stem track
     mixxx::audio::ChannelCount m_channelPerWorker;
+    // See lastProcessNanos()
+    qint64 m_lastProcessNanos = 0;
 };
@@ -2,12 +2,18 @@
 
 #include <QtDebug>
 
+#include "mixer/playermanager.h"
 #include "moc_cachingreader.cpp"
 #include "util/assert.h"
 #include "util/compatibility/qatomic.h"
 #include "util/counter.h"
+#include "util/flightrecorder.h"
 #include "util/logger.h"
+#include "util/math.h"
+#include "util/memorylock.h"
 #include "util/sample.h"
+#include "util/stat.h"
+#include "util/time.h"
 
 namespace {
 
@@ -18,6 +24,30 @@ mixxx::Logger kLogger("CachingReader");
 // TODO() Do we suffer cache misses if we use an audio buffer of above 23 ms?
 constexpr SINT kDefaultHintFrames = 1024;
 
+// Hints for positions the user may jump to at any time (hotcues, the main
+// cue, inactive loop points and the intro/outro markers) warm a whole chunk
+// of audio after the target position. kDefaultHintFrames only covers 23 ms
+// after the jump, so a cue close to the end of its chunk would stall on the
+// following chunk right after punching it.
+constexpr SINT kJumpTargetHintFrames = CachingReaderChunk::kFrames;
+
+// One out of this many chunks of the pool is reserved for servicing
+// playback-critical hints (the current play and slip positions and the
+// boundaries of an active loop). When the free chunks run this low, jump
+// target hints stop allocating chunks, so they never expire chunks that
+// the linear read-ahead may still need.
+constexpr SINT kFreeChunksReservedForPlaybackDivisor = 8;
+
+// Playback stalls immediately when one of these hinted positions is not in
+// the cache, whereas the other hint types merely describe positions the
+// user might jump to soon.
+bool isPlaybackCriticalHint(Hint::Type type) {
+    return type == Hint::Type::CurrentPosition ||
+            type == Hint::Type::SlipPosition ||
+            type == Hint::Type::LoopStartEnabled ||
+            type == Hint::Type::LoopEndEnabled;
+}
+
 // With CachingReaderChunk::kFrames = 8192 each chunk consumes
 // 8192 frames * 2 channels/frame * 4-bytes per sample = 65 kB for stereo frame.
 //
@@ -27,7 +57,9 @@ constexpr SINT kDefaultHintFrames = 1024;
 // Consequently the total memory required for all allocated chunks depends
 // on the number of decks. The amount of memory reserved for a single
 // CachingReader must be multiplied by the number of decks to calculate
-// the total amount!
+// the total amount! Main decks use this full pool size, samplers and
+// preview decks use the smaller kNumberOfCachedChunksForSamplePlayers
+// pool (see below).
 //
 // NOTE(uklotzde, 2019-09-05): Reduce this number to just few chunks
 // (kNumberOfCachedChunksInMemory = 1, 2, 3, ...) for testing purposes
@@ -35,12 +67,58 @@ constexpr SINT kDefaultHintFrames = 1024;
 // massive drop outs are expected to occur Mixxx should run reliably!
 constexpr SINT kNumberOfCachedChunksInMemory = 80;
 
+// Baseline number of chunks to keep buffered ahead of the playhead.
+// SoundTouch can read up to 2 chunks ahead, so this is the minimum.
+constexpr SINT kMinReadAheadChunks = 2;
+
+// Upper bound of the adaptive read-ahead. Must stay well below the
+// cache size so that jump target hints are not starved of chunks.
+constexpr SINT kMaxReadAheadChunks = 8;
+
+// Nominal playback duration of one chunk (~170 ms for 8192 frames at
+// 48 kHz), used to relate the measured chunk read latency of a source
+// to the rate at which playback consumes chunks.
+constexpr int kNominalChunkDurationMicros = static_cast<int>(
+        CachingReaderChunk::kFrames * static_cast<qint64>(1000000) / 48000);
+
+// Samplers and preview decks use a smaller chunk pool than the main
+// decks. They mostly fire short one-shots from a fixed position, so a
+// full-size pool would only retain cold chunks: with 16 samplers loaded
+// the full-size pools alone pin more than 80 MB of mostly unused stereo
+// audio, and four times that when stem support raises the channel count.
+constexpr SINT kNumberOfCachedChunksForSamplePlayers = 20;
+
+// Number of chunks in the cache of a single reader. Main decks always
+// use the full pool. Sample players use the smaller pool, overridable
+// with the [App] sample_player_chunk_count config key for setups whose
+// samplers play long stems instead of one-shots.
+SINT cachedChunkCountForGroup(
+        const QString& group,
+        const UserSettingsPointer& pConfig) {
+    if (!PlayerManager::isSamplerGroup(group) &&
+            !PlayerManager::isPreviewDeckGroup(group)) {
+        return kNumberOfCachedChunksInMemory;
+    }
+    const int configuredChunkCount = pConfig
+            ? pConfig->getValue(
+                      ConfigKey(QStringLiteral("[App]"),
+                              QStringLiteral("sample_player_chunk_count")),
+                      static_cast<int>(kNumberOfCachedChunksForSamplePlayers))
+            : static_cast<int>(kNumberOfCachedChunksForSamplePlayers);
+    // The pool must cover the maximum read-ahead plus the playback
+    // reserve with room to spare and never exceeds a main deck pool.
+    return math_clamp<SINT>(configuredChunkCount,
+            2 * kMaxReadAheadChunks,
+            kNumberOfCachedChunksInMemory);
+}
+
 } // anonymous namespace
 
 CachingReader::CachingReader(const QString& group,
         UserSettingsPointer config,
         mixxx::audio::ChannelCount maxSupportedChannel)
         : m_pConfig(config),
+          m_chunkCount(cachedChunkCountForGroup(group, config)),
           // Limit the number of in-flight requests to the worker. This should
           // prevent to overload the worker when it is not able to fetch those
           // requests from the FIFO timely. Otherwise outdated requests pile up
@@ -50,25 +128,29 @@ CachingReader::CachingReader(const QString& group,
           // buffer, where new requests replace old requests when full. Those
           // old requests need to be returned immediately to the CachingReader
           // that must take ownership and free them!!!
-          m_chunkReadRequestFIFO(kNumberOfCachedChunksInMemory / 4),
+          m_chunkReadRequestFIFO(m_chunkCount / 4),
           // The capacity of the back channel must be equal to the number of
           // allocated chunks, because the worker use writeBlocking(). Otherwise
           // the worker could get stuck in a hot loop!!!
-          m_readerStatusUpdateFIFO(kNumberOfCachedChunksInMemory),
+          m_readerStatusUpdateFIFO(m_chunkCount),
           m_state(STATE_IDLE),
           m_mruCachingReaderChunk(nullptr),
           m_lruCachingReaderChunk(nullptr),
           m_sampleBuffer(CachingReaderChunk::kFrames * maxSupportedChannel *
-                  kNumberOfCachedChunksInMemory),
+                  m_chunkCount),
+          m_cachedChunksStatTag(QStringLiteral("CachingReader %1 cached chunks")
+                          .arg(group)),
+          m_lastRecommendedReadAheadChunks(0),
           m_worker(group,
                   &m_chunkReadRequestFIFO,
                   &m_readerStatusUpdateFIFO,
                   maxSupportedChannel) {
-    m_allocatedCachingReaderChunks.reserve(kNumberOfCachedChunksInMemory);
+    m_allocatedCachingReaderChunks.reserve(m_chunkCount);
+    m_accountedMemory.reset(m_sampleBuffer.size() * sizeof(CSAMPLE));
     // Divide up the allocated raw memory buffer into total_chunks
     // chunks. Initialize each chunk to hold nothing and add it to the free
     // list.
-    for (SINT i = 0; i < kNumberOfCachedChunksInMemory; ++i) {
+    for (SINT i = 0; i < m_chunkCount; ++i) {
         CachingReaderChunkForOwner* c =
                 new CachingReaderChunkForOwner(
                         mixxx::SampleBuffer::WritableSlice(
@@ -79,6 +161,12 @@ CachingReader::CachingReader(const QString& group,
         m_freeChunks.push_back(c);
     }
 
+    // When enabled, pin the chunk arena so that reading cached sample
+    // data in the audio callback never takes a page fault.
+    mixxx::MemoryLock::lockAndPrefault(m_sampleBuffer.data(),
+            sizeof(CSAMPLE) * m_sampleBuffer.size(),
+            "CachingReader chunk buffer");
+
     // Forward signals from worker
     connect(&m_worker, &CachingReaderWorker::trackLoading,
             this, &CachingReader::trackLoading,
@@ -104,6 +192,7 @@ void CachingReader::freeChunkFromList(CachingReaderChunkForOwner* pChunk) {
             &m_lruCachingReaderChunk);
     pChunk->free();
     m_freeChunks.push_back(pChunk);
+    trackCachedChunksStat();
 }
 
 void CachingReader::freeChunk(CachingReaderChunkForOwner* pChunk) {
@@ -148,9 +237,20 @@ CachingReaderChunkForOwner* CachingReader::allocateChunk(SINT chunkIndex) {
 
     m_allocatedCachingReaderChunks.insert(chunkIndex, pChunk);
 
+    trackCachedChunksStat();
+
     return pChunk;
 }
 
+void CachingReader::trackCachedChunksStat() const {
+    Stat::track(m_cachedChunksStatTag,
+            Stat::UNSPECIFIED,
+            Stat::experimentFlags(
+                    Stat::AVERAGE | Stat::MIN | Stat::MAX),
+            static_cast<double>(
+                    m_chunkCount - static_cast<SINT>(m_freeChunks.size())));
+}
+
 CachingReaderChunkForOwner* CachingReader::allocateChunkExpireLRU(SINT chunkIndex) {
     auto* pChunk = allocateChunk(chunkIndex);
     if (!pChunk) {
@@ -300,6 +400,53 @@ void CachingReader::process() {
     }
 }
 
+const CSAMPLE* CachingReader::borrowSampleFrames(SINT startSample,
+        SINT numSamples,
+        mixxx::audio::ChannelCount channelCount) {
+    // Bad inputs are not fatal here: the caller falls back to read(),
+    // which performs the noisy validation.
+    if (startSample < 0 || numSamples <= 0 ||
+            startSample % channelCount != 0 ||
+            numSamples % channelCount != 0) {
+        return nullptr;
+    }
+
+    // If no track is loaded, don't do anything.
+    if (atomicLoadRelaxed(m_state) != STATE_TRACK_LOADED) {
+        return nullptr;
+    }
+
+    // Process new messages from the reader thread before looking up
+    // the chunk and to update m_readableFrameIndexRange
+    process();
+
+    const auto frameIndexRange =
+            mixxx::IndexRange::forward(
+                    CachingReaderChunk::samples2frames(startSample, channelCount),
+                    CachingReaderChunk::samples2frames(numSamples, channelCount));
+    if (!frameIndexRange.isSubrangeOf(m_readableFrameIndexRange)) {
+        // Preroll/postroll or unreadable ranges require silence padding,
+        // which only the copying path provides.
+        return nullptr;
+    }
+
+    const SINT firstChunkIndex =
+            CachingReaderChunk::indexForFrame(frameIndexRange.start());
+    const SINT lastChunkIndex =
+            CachingReaderChunk::indexForFrame(frameIndexRange.end() - 1);
+    if (firstChunkIndex != lastChunkIndex) {
+        // Spans a chunk boundary; chunk buffers are not contiguous.
+        return nullptr;
+    }
+
+    const CachingReaderChunkForOwner* const pChunk =
+            lookupChunkAndFreshen(firstChunkIndex);
+    if (!pChunk || pChunk->getState() != CachingReaderChunkForOwner::READY) {
+        return nullptr;
+    }
+    return pChunk->bufferedSampleSpan(channelCount, frameIndexRange);
+}
+
 CachingReader::ReadResult CachingReader::read(SINT startSample,
         SINT numSamples,
         bool reverse,
@@ -470,6 +617,8 @@ CachingReader::ReadResult CachingReader::read(SINT startSample,
                     DEBUG_ASSERT(!pChunk ||
                             (pChunk->getState() == CachingReaderChunkForOwner::READ_PENDING));
                     Counter("CachingReader::read(): Failed to read chunk on cache miss")++;
+                    FlightRecorder::record("CachingReader::read() cache miss",
+                            FlightRecorderEventType::Marker);
                     if (kLogger.traceEnabled()) {
                         kLogger.trace()
                                 << "Cache miss for chunk with index"
@@ -536,6 +685,29 @@ CachingReader::ReadResult CachingReader::read(SINT startSample,
     return result;
 }
 
+SINT CachingReader::recommendedReadAheadChunks() const {
+    const int readLatencyMicros = m_worker.readLatencyMicros();
+    // Keep enough chunks buffered to bridge several worst-case reads:
+    // one extra chunk for every 1/8 chunk duration (~21 ms) of average
+    // read latency. Local SSDs decode a chunk within a few milliseconds
+    // and stay at the baseline, while NAS or USB-stick sources with tens
+    // of milliseconds per chunk read scale the read-ahead up.
+    const SINT readAheadChunks = math_clamp<SINT>(
+            kMinReadAheadChunks +
+                    readLatencyMicros * 8 / kNominalChunkDurationMicros,
+            kMinReadAheadChunks,
+            kMaxReadAheadChunks);
+    if (readAheadChunks != m_lastRecommendedReadAheadChunks) {
+        if (kLogger.debugEnabled()) {
+            kLogger.debug() << "Read-ahead adjusted to" << readAheadChunks
+                            << "chunks, average chunk read latency"
+                            << readLatencyMicros << "us";
+        }
+        m_lastRecommendedReadAheadChunks = readAheadChunks;
+    }
+    return readAheadChunks;
+}
+
 void CachingReader::hintAndMaybeWake(const HintVector& hintList) {
     // If no file is loaded, skip.
     if (atomicLoadRelaxed(m_state) != STATE_TRACK_LOADED) {
@@ -545,17 +717,31 @@ void CachingReader::hintAndMaybeWake(const HintVector& hintList) {
     // For every chunk that the hints indicated, check if it is in the cache. If
     // any are not, then wake.
     bool shouldWake = false;
+    // Whether one of the missing chunks covers the current play position,
+    // i.e. the next callback will stall without it.
+    bool urgentHint = false;
 
     for (const auto& hint: hintList) {
         SINT hintFrame = hint.frame;
         SINT hintFrameCount = hint.frameCount;
+        const bool playbackCritical = isPlaybackCriticalHint(hint.type);
+
+        // The slip position is a jump target as well: leaving slip mode
+        // seeks to it at any moment, so it gets the deep hint despite
+        // being playback-critical to guarantee a stall-free exit.
+        const SINT defaultFrameCount =
+                (playbackCritical && hint.type != Hint::Type::SlipPosition)
+                ? kDefaultHintFrames
+                : kJumpTargetHintFrames;
 
         // Handle some special length values
         if (hintFrameCount == Hint::kFrameCountForward) {
-        	hintFrameCount = kDefaultHintFrames;
+            // Jump targets warm a whole chunk so that punching a cue near
+            // a chunk boundary does not stall on the following chunk.
+            hintFrameCount = defaultFrameCount;
         } else if (hintFrameCount == Hint::kFrameCountBackward) {
-        	hintFrame -= kDefaultHintFrames;
-        	hintFrameCount = kDefaultHintFrames;
+        	hintFrame -= defaultFrameCount;
+        	hintFrameCount = defaultFrameCount;
             if (hintFrame < 0) {
             	hintFrameCount += hintFrame;
                 if (hintFrameCount <= 0) {
@@ -582,7 +768,20 @@ void CachingReader::hintAndMaybeWake(const HintVector& hintList) {
         for (int chunkIndex = firstChunkIndex; chunkIndex <= lastChunkIndex; ++chunkIndex) {
             CachingReaderChunkForOwner* pChunk = lookupChunk(chunkIndex);
             if (!pChunk) {
+                if (!playbackCritical &&
+                        static_cast<SINT>(m_freeChunks.size()) <=
+                                m_chunkCount / kFreeChunksReservedForPlaybackDivisor) {
+                    // Under memory pressure the remaining free chunks are
+                    // kept for the linear read-ahead. Skipping the hint is
+                    // safe, because it is repeated on every callback and
+                    // will be serviced as soon as chunks become available.
+                    continue;
+                }
                 shouldWake = true;
+                if (hint.type == Hint::Type::CurrentPosition ||
+                        hint.type == Hint::Type::SlipPosition) {
+                    urgentHint = true;
+                }
                 pChunk = allocateChunkExpireLRU(chunkIndex);
                 if (!pChunk) {
                     kLogger.warning()
@@ -618,6 +817,12 @@ void CachingReader::hintAndMaybeWake(const HintVector& hintList) {
 
     // If there are chunks to be read, wake up.
     if (shouldWake) {
-        m_worker.workReady();
+        if (urgentHint) {
+            // Pass the current time as deadline so the scheduler services
+            // this read before reads that merely refill lookahead caches.
+            m_worker.workReady(mixxx::Time::elapsed());
+        } else {
+            m_worker.workReady();
+        }
     }
 }
@@ -11,6 +11,7 @@
 #include "preferences/usersettings.h"
 #include "track/track_decl.h"
 #include "util/fifo.h"
+#include "util/memoryaccounting.h"
 #include "util/types.h"
 
 // A Hint is an indication to the CachingReader that a certain section of a
@@ -107,12 +108,34 @@ class CachingReader : public QObject {
             CSAMPLE* buffer,
             mixxx::audio::ChannelCount channelCount);
 
+    // Zero-copy variant of read() for the common forward case: If the
+    // requested range is entirely buffered within a single cached chunk,
+    // returns a read-only span directly into the chunk's sample buffer and
+    // freshens the chunk, avoiding the copy into a destination buffer.
+    // Returns nullptr on chunk boundaries, cache misses, preroll/postroll
+    // ranges and reverse reads; callers must then fall back to read().
+    // The span is only valid until the next call into this CachingReader
+    // (read, borrowSampleFrames, process or hintAndMaybeWake), since any of
+    // these may hand the chunk back to the worker or evict it. Must only be
+    // called from the engine callback.
+    virtual const CSAMPLE* borrowSampleFrames(SINT startSample,
+            SINT numSamples,
+            mixxx::audio::ChannelCount channelCount);
+
     // Issue a list of hints, but check whether any of the hints request a chunk
     // that is not in the cache. If any hints do request a chunk not in cache,
     // then wake the reader so that it can process them. Must only be called
     // from the engine callback.
     void hintAndMaybeWake(const HintVector& hintList);
 
+    // Recommended number of chunks to keep buffered ahead of the playhead,
+    // derived from the measured read latency of the current audio source.
+    // Fast local storage yields the baseline of 2 chunks; slow sources
+    // (NAS, USB sticks) scale the read-ahead up so that playback survives
+    // their slower and more erratic reads. Must only be called from the
+    // engine callback.
+    SINT recommendedReadAheadChunks() const;
+
     // Request that the CachingReader load a new track. These requests are
     // processed in the work thread, so the reader must be woken up via wake()
     // for this to take effect.
@@ -126,6 +149,13 @@ class CachingReader : public QObject {
         m_worker.setScheduler(pScheduler);
     }
 
+    // Priority lane used by the scheduler when waking the reader worker.
+    // Called from the engine callback whenever the urgency of this deck
+    // changes (e.g. it starts or stops playing).
+    void setWorkerPriority(EngineWorker::Priority priority) {
+        m_worker.setWorkerPriority(priority);
+    }
+
   signals:
     // Emitted once a new track is loaded and ready to be read from.
     void trackLoading();
@@ -138,6 +168,10 @@ class CachingReader : public QObject {
   private:
     const UserSettingsPointer m_pConfig;
 
+    // Number of chunks in this reader's cache, fixed at construction.
+    // Main decks use a larger pool than samplers and preview decks.
+    const SINT m_chunkCount;
+
     // Thread-safe FIFOs for communication between the engine callback and
     // reader thread.
     FIFO<CachingReaderChunkReadRequest> m_chunkReadRequestFIFO;
@@ -168,6 +202,11 @@ class CachingReader : public QObject {
     // Gets a chunk from the free list, frees the LRU CachingReaderChunk if none available.
     CachingReaderChunkForOwner* allocateChunkExpireLRU(SINT chunkIndex);
 
+    // Reports the current number of allocated chunks to the developer
+    // stats, tagged with the group of this reader. No-op unless stats
+    // collection is enabled (--developer).
+    void trackCachedChunksStat() const;
+
     enum State {
         STATE_IDLE,
         STATE_TRACK_LOADING,
@@ -194,8 +233,20 @@ class CachingReader : public QObject {
     // The raw memory buffer which is divided up into chunks.
     mixxx::SampleBuffer m_sampleBuffer;
 
+    // Reports the size of m_sampleBuffer to the memory accounting, see
+    // MemoryAccounting.
+    mixxx::AccountedMemory m_accountedMemory{mixxx::MemoryAccounting::Tag::Chunks};
+
+    // Tag for reporting the cache occupancy of this reader to the
+    // developer stats (see trackCachedChunksStat()).
+    const QString m_cachedChunksStatTag;
+
     // The readable frame index range as reported by the worker.
     mixxx::IndexRange m_readableFrameIndexRange;
 
+    // The read-ahead recommendation of the last engine callback, only
+    // kept to log policy changes. Engine thread only.
+    mutable SINT m_lastRecommendedReadAheadChunks;
+
     CachingReaderWorker m_worker;
 };
@@ -127,6 +127,41 @@ mixxx::IndexRange CachingReaderChunk::readBufferedSampleFramesReverse(
     return copyableFrameIndexRange;
 }
 
+const CSAMPLE* CachingReaderChunk::bufferedSampleSpan(
+        mixxx::audio::ChannelCount channelCount,
+        const mixxx::IndexRange& frameIndexRange) const {
+    DEBUG_ASSERT(m_index != kInvalidChunkIndex);
+    if (frameIndexRange.empty() ||
+            !frameIndexRange.isSubrangeOf(
+                    m_bufferedSampleFrames.frameIndexRange())) {
+        return nullptr;
+    }
+    const SINT srcSampleOffset = frames2samples(
+            frameIndexRange.start() -
+                    m_bufferedSampleFrames.frameIndexRange().start(),
+            channelCount);
+    return m_bufferedSampleFrames.readableData(srcSampleOffset);
+}
+
+void CachingReaderChunk::importBufferedSampleFrames(
+        const CSAMPLE* sampleData,
+        mixxx::audio::ChannelCount channelCount,
+        const mixxx::IndexRange& frameIndexRange) {
+    DEBUG_ASSERT(m_index != kInvalidChunkIndex);
+    DEBUG_ASSERT(sampleData);
+    const SINT sampleCount =
+            frames2samples(frameIndexRange.length(), channelCount);
+    VERIFY_OR_DEBUG_ASSERT(sampleCount <= m_sampleBuffer.length()) {
+        m_bufferedSampleFrames = mixxx::ReadableSampleFrames();
+        return;
+    }
+    SampleUtil::copy(m_sampleBuffer.data(), sampleData, sampleCount);
+    m_bufferedSampleFrames = mixxx::ReadableSampleFrames(
+            frameIndexRange,
+            mixxx::SampleBuffer::ReadableSlice(
+                    m_sampleBuffer.data(), sampleCount));
+}
+
 CachingReaderChunkForOwner::CachingReaderChunkForOwner(
         mixxx::SampleBuffer::WritableSlice sampleBuffer)
         : CachingReaderChunk(std::move(sampleBuffer)),
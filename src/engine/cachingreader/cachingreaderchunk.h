@@ -71,6 +71,23 @@ public:
             mixxx::audio::ChannelCount channelCount,
             const mixxx::IndexRange& frameIndexRange) const;
 
+    // Zero-copy access to buffered sample frames: Returns a pointer into
+    // the chunk's sample buffer for the given frame range or nullptr if the
+    // range is not entirely buffered in this chunk. The span stays valid as
+    // long as the chunk is neither given to the worker nor freed, which the
+    // cache as the owner has to guarantee.
+    const CSAMPLE* bufferedSampleSpan(
+            mixxx::audio::ChannelCount channelCount,
+            const mixxx::IndexRange& frameIndexRange) const;
+
+    // Fill this chunk from already decoded sample data instead of reading
+    // from the audio source. Used by the worker to share decoded chunks
+    // between readers that have the same track loaded.
+    void importBufferedSampleFrames(
+            const CSAMPLE* sampleData,
+            mixxx::audio::ChannelCount channelCount,
+            const mixxx::IndexRange& frameIndexRange);
+
   protected:
     explicit CachingReaderChunk(
             mixxx::SampleBuffer::WritableSlice sampleBuffer);
@@ -0,0 +1,136 @@
+#include "engine/cachingreader/cachingreadersharedcache.h"
+
+#include "engine/cachingreader/cachingreaderchunk.h"
+#include "util/compatibility/qmutex.h"
+#include "util/logger.h"
+
+namespace {
+
+mixxx::Logger kLogger("CachingReaderSharedCache");
+
+// Upper bound for the number of chunks that are retained per source, i.e.
+// about 47 s of stereo audio or 16 MB per track that is loaded on more
+// than one deck.
+constexpr SINT kMaxChunksPerSource = 256;
+
+// Sources with a single reader retain only a short ring of the most
+// recently decoded chunks, about 6 s of stereo audio or 2 MB per open
+// source. A deck that is cloned from this source (instant doubles)
+// starts right at the source deck's play position, and the chunks
+// around that position have been decoded recently, so the ring lets
+// the clone produce audio as soon as its own source is open.
+constexpr SINT kMaxChunksPerSingleReaderSource = 32;
+
+} // anonymous namespace
+
+// static
+CachingReaderSharedCache* CachingReaderSharedCache::instance() {
+    static CachingReaderSharedCache s_instance;
+    return &s_instance;
+}
+
+void CachingReaderSharedCache::openSource(const QString& key) {
+    DEBUG_ASSERT(!key.isEmpty());
+    const auto locker = lockMutex(&m_mutex);
+    SourceEntry& entry = m_sources[key];
+    ++entry.openCount;
+    if (kLogger.debugEnabled() && entry.openCount > 1) {
+        kLogger.debug()
+                << "Sharing decoded chunks between"
+                << entry.openCount
+                << "readers for"
+                << key;
+    }
+}
+
+void CachingReaderSharedCache::closeSource(const QString& key) {
+    DEBUG_ASSERT(!key.isEmpty());
+    const auto locker = lockMutex(&m_mutex);
+    const auto it = m_sources.find(key);
+    VERIFY_OR_DEBUG_ASSERT(it != m_sources.end()) {
+        return;
+    }
+    SourceEntry& entry = it.value();
+    DEBUG_ASSERT(entry.openCount > 0);
+    --entry.openCount;
+    if (entry.openCount <= 0) {
+        m_sources.erase(it);
+    } else if (entry.openCount == 1) {
+        // Drop back to the short single-reader ring, keeping the most
+        // recently decoded chunks for a potential future clone.
+        while (entry.chunks.size() > kMaxChunksPerSingleReaderSource) {
+            DEBUG_ASSERT(!entry.chunkEvictionOrder.isEmpty());
+            entry.chunks.remove(entry.chunkEvictionOrder.takeFirst());
+        }
+    }
+}
+
+bool CachingReaderSharedCache::tryReadChunk(
+        const QString& key,
+        SINT chunkIndex,
+        mixxx::audio::ChannelCount channelCount,
+        const mixxx::IndexRange& chunkFrameIndexRange,
+        CachingReaderChunk* pChunk) {
+    DEBUG_ASSERT(pChunk);
+    const auto locker = lockMutex(&m_mutex);
+    const auto sourceIt = m_sources.constFind(key);
+    if (sourceIt == m_sources.constEnd()) {
+        return false;
+    }
+    const auto chunkIt = sourceIt.value().chunks.constFind(chunkIndex);
+    if (chunkIt == sourceIt.value().chunks.constEnd()) {
+        return false;
+    }
+    const CachedChunk& cachedChunk = chunkIt.value();
+    const auto cachedFrameIndexRange = mixxx::IndexRange::between(
+            cachedChunk.frameIndexRangeStart,
+            cachedChunk.frameIndexRangeEnd);
+    if (cachedFrameIndexRange != chunkFrameIndexRange) {
+        // The readable range of the source has changed since the chunk
+        // has been published, e.g. after read errors. Decode it again.
+        return false;
+    }
+    DEBUG_ASSERT(static_cast<SINT>(cachedChunk.samples.size()) ==
+            CachingReaderChunk::frames2samples(
+                    cachedFrameIndexRange.length(), channelCount));
+    pChunk->importBufferedSampleFrames(
+            cachedChunk.samples.data(),
+            channelCount,
+            cachedFrameIndexRange);
+    return true;
+}
+
+void CachingReaderSharedCache::publishChunk(
+        const QString& key,
+        SINT chunkIndex,
+        mixxx::audio::ChannelCount channelCount,
+        const mixxx::IndexRange& chunkFrameIndexRange,
+        const CSAMPLE* sampleData) {
+    DEBUG_ASSERT(sampleData);
+    DEBUG_ASSERT(!chunkFrameIndexRange.empty());
+    const auto locker = lockMutex(&m_mutex);
+    const auto sourceIt = m_sources.find(key);
+    if (sourceIt == m_sources.end()) {
+        return;
+    }
+    SourceEntry& entry = sourceIt.value();
+    if (entry.chunks.contains(chunkIndex)) {
+        return;
+    }
+    const SINT maxChunks = entry.openCount >= 2
+            ? kMaxChunksPerSource
+            : kMaxChunksPerSingleReaderSource;
+    while (entry.chunks.size() >= maxChunks) {
+        DEBUG_ASSERT(!entry.chunkEvictionOrder.isEmpty());
+        entry.chunks.remove(entry.chunkEvictionOrder.takeFirst());
+    }
+    CachedChunk cachedChunk;
+    cachedChunk.samples.assign(sampleData,
+            sampleData +
+                    CachingReaderChunk::frames2samples(
+                            chunkFrameIndexRange.length(), channelCount));
+    cachedChunk.frameIndexRangeStart = chunkFrameIndexRange.start();
+    cachedChunk.frameIndexRangeEnd = chunkFrameIndexRange.end();
+    entry.chunks.insert(chunkIndex, std::move(cachedChunk));
+    entry.chunkEvictionOrder.append(chunkIndex);
+}
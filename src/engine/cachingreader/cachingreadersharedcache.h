@@ -0,0 +1,85 @@
+#pragma once
+
+#include <QHash>
+#include <QList>
+#include <QMutex>
+#include <QString>
+
+#include <vector>
+
+#include "audio/types.h"
+#include "util/indexrange.h"
+#include "util/types.h"
+
+class CachingReaderChunk;
+
+// Process-wide store of decoded chunk sample data that is shared between
+// the CachingReaderWorker instances of all decks, samplers and preview
+// decks. When the same track is loaded on more than one deck (doubles,
+// samplers firing the same one-shot) each worker consults this cache
+// before decoding a chunk from its own audio source, so every chunk is
+// decoded from file only once. The per-reader chunk caches and read
+// positions remain completely independent, only the decoded sample data
+// is shared.
+//
+// Sample data is retained in two tiers: sources that are currently open
+// by at least two workers share a generous number of chunks, sources
+// with a single reader only retain a small ring of their most recently
+// decoded chunks. The small ring is what makes deck cloning (instant
+// doubles) instant: when a second deck opens the same source, the chunks
+// around the source deck's play position have usually been decoded
+// recently and are served from the ring, so the clone produces audio as
+// soon as its own source is open instead of re-decoding the doubled
+// phrase from file. Older chunks are evicted first.
+//
+// All methods are thread-safe. They are called from the worker threads
+// only and never from the engine callback.
+class CachingReaderSharedCache {
+  public:
+    static CachingReaderSharedCache* instance();
+
+    // Register/unregister an open audio source. The key must identify the
+    // track content including all parameters that affect the decoded
+    // sample data (see CachingReaderWorker::loadTrack()).
+    void openSource(const QString& key);
+    void closeSource(const QString& key);
+
+    // Try to fill pChunk with the cached sample data of the given chunk
+    // index. Returns true and imports the data into pChunk on a hit.
+    // Only complete chunks whose cached frame range exactly matches
+    // chunkFrameIndexRange are served, partial reads near the end of a
+    // corrupt file are always decoded by each reader itself.
+    bool tryReadChunk(
+            const QString& key,
+            SINT chunkIndex,
+            mixxx::audio::ChannelCount channelCount,
+            const mixxx::IndexRange& chunkFrameIndexRange,
+            CachingReaderChunk* pChunk);
+
+    // Store a copy of the decoded sample data of a completely read chunk.
+    void publishChunk(
+            const QString& key,
+            SINT chunkIndex,
+            mixxx::audio::ChannelCount channelCount,
+            const mixxx::IndexRange& chunkFrameIndexRange,
+            const CSAMPLE* sampleData);
+
+  private:
+    CachingReaderSharedCache() = default;
+
+    struct CachedChunk {
+        std::vector<CSAMPLE> samples;
+        SINT frameIndexRangeStart;
+        SINT frameIndexRangeEnd;
+    };
+
+    struct SourceEntry {
+        int openCount = 0;
+        QHash<SINT, CachedChunk> chunks;
+        // Chunk indices in insertion order for eviction
+        QList<SINT> chunkEvictionOrder;
+    };
+
+    QMutex m_mutex;
+    QHash<QString, SourceEntry> m_sources;
+};
@@ -0,0 +1,202 @@
+#include "engine/cachingreader/cachingreaderspillcache.h"
+
+#include <QByteArray>
+#include <QDir>
+
+#include "engine/cachingreader/cachingreaderchunk.h"
+#include "util/compatibility/qmutex.h"
+#include "util/logger.h"
+
+namespace {
+
+mixxx::Logger kLogger("CachingReaderSpillCache");
+
+// Payload capacity of one slot: a complete stereo chunk. Decoded float
+// samples compress poorly, so compression never has to fit into less
+// than the raw size (incompressible chunks are stored raw instead).
+const SINT kSlotBytes = static_cast<SINT>(
+        CachingReaderChunk::frames2samples(
+                CachingReaderChunk::kFrames,
+                mixxx::audio::ChannelCount::stereo()) *
+        sizeof(CSAMPLE));
+
+// Number of slots in the scratch file ring. 20480 chunks of 8192 frames
+// cover a bit more than an hour of stereo audio at 48 kHz, bounding the
+// scratch file to 1.25 GiB. The file is written sparsely and most slots
+// are only partially filled due to compression, so the actual disk usage
+// stays well below the nominal bound.
+constexpr SINT kMaxSlots = 20480;
+
+// Lightest zlib level: decoded float PCM yields only modest ratios even
+// at high levels, so the cheapest setting gives most of the write
+// bandwidth reduction at a fraction of the CPU cost. (The higher levels
+// are not worth it here, cf. the analysis data compression in
+// AnalysisDao.)
+constexpr int kCompressionLevel = 1;
+
+} // anonymous namespace
+
+// static
+CachingReaderSpillCache* CachingReaderSpillCache::instance() {
+    static CachingReaderSpillCache s_instance;
+    return &s_instance;
+}
+
+CachingReaderSpillCache::CachingReaderSpillCache()
+        : m_spillFile(QDir::temp().absoluteFilePath(
+                  QStringLiteral("mixxx-spill-XXXXXX"))),
+          m_enabled(false),
+          m_nextSlot(0) {
+    // QTemporaryFile removes the scratch file when the process exits,
+    // which makes the cache session-scoped.
+    if (!m_spillFile.open()) {
+        kLogger.warning()
+                << "Failed to create scratch file in"
+                << QDir::tempPath()
+                << "- decoded chunks are not spilled to disk";
+        return;
+    }
+    m_slotOwners.resize(kMaxSlots);
+    m_enabled = true;
+    if (kLogger.debugEnabled()) {
+        kLogger.debug()
+                << "Spilling decoded chunks to"
+                << m_spillFile.fileName();
+    }
+}
+
+bool CachingReaderSpillCache::tryReadChunk(
+        const QString& key,
+        SINT chunkIndex,
+        mixxx::audio::ChannelCount channelCount,
+        const mixxx::IndexRange& chunkFrameIndexRange,
+        CachingReaderChunk* pChunk) {
+    DEBUG_ASSERT(pChunk);
+    const auto locker = lockMutex(&m_mutex);
+    if (!m_enabled) {
+        return false;
+    }
+    const auto sourceIt = m_sources.constFind(key);
+    if (sourceIt == m_sources.constEnd()) {
+        return false;
+    }
+    const auto chunkIt = sourceIt.value().constFind(chunkIndex);
+    if (chunkIt == sourceIt.value().constEnd()) {
+        return false;
+    }
+    const SpilledChunk& spilledChunk = chunkIt.value();
+    const auto spilledFrameIndexRange = mixxx::IndexRange::between(
+            spilledChunk.frameIndexRangeStart,
+            spilledChunk.frameIndexRangeEnd);
+    if (spilledFrameIndexRange != chunkFrameIndexRange) {
+        // The readable range of the source has changed since the chunk
+        // has been spilled, e.g. after read errors. Decode it again.
+        return false;
+    }
+    const SINT rawBytes = static_cast<SINT>(
+            CachingReaderChunk::frames2samples(
+                    spilledFrameIndexRange.length(), channelCount) *
+            sizeof(CSAMPLE));
+    if (!m_spillFile.seek(static_cast<qint64>(spilledChunk.slot) * kSlotBytes)) {
+        return false;
+    }
+    QByteArray storedData = m_spillFile.read(spilledChunk.storedBytes);
+    if (storedData.size() != spilledChunk.storedBytes) {
+        kLogger.warning()
+                << "Failed to read spilled chunk"
+                << chunkIndex
+                << "of"
+                << key;
+        return false;
+    }
+    if (spilledChunk.compressed) {
+        storedData = qUncompress(storedData);
+    }
+    VERIFY_OR_DEBUG_ASSERT(storedData.size() == rawBytes) {
+        return false;
+    }
+    pChunk->importBufferedSampleFrames(
+            reinterpret_cast<const CSAMPLE*>(storedData.constData()),
+            channelCount,
+            spilledFrameIndexRange);
+    return true;
+}
+
+void CachingReaderSpillCache::publishChunk(
+        const QString& key,
+        SINT chunkIndex,
+        mixxx::audio::ChannelCount channelCount,
+        const mixxx::IndexRange& chunkFrameIndexRange,
+        const CSAMPLE* sampleData) {
+    DEBUG_ASSERT(sampleData);
+    DEBUG_ASSERT(!chunkFrameIndexRange.empty());
+    const SINT rawBytes = static_cast<SINT>(
+            CachingReaderChunk::frames2samples(
+                    chunkFrameIndexRange.length(), channelCount) *
+            sizeof(CSAMPLE));
+    if (rawBytes > kSlotBytes) {
+        // Stem sources do not fit a slot and are not spilled.
+        return;
+    }
+    // Compress outside of the lock, it is the expensive part.
+    QByteArray storedData = qCompress(
+            reinterpret_cast<const uchar*>(sampleData),
+            rawBytes,
+            kCompressionLevel);
+    bool compressed = true;
+    if (storedData.size() >= rawBytes) {
+        // Incompressible, store raw to save the decompression on read.
+        storedData = QByteArray::fromRawData(
+                reinterpret_cast<const char*>(sampleData), rawBytes);
+        compressed = false;
+    }
+
+    const auto locker = lockMutex(&m_mutex);
+    if (!m_enabled) {
+        return;
+    }
+    auto& chunks = m_sources[key];
+    if (chunks.contains(chunkIndex)) {
+        return;
+    }
+
+    // Reclaim the slot that the ring allocation is about to overwrite.
+    const SINT slot = m_nextSlot;
+    m_nextSlot = (m_nextSlot + 1) % kMaxSlots;
+    SlotOwner& slotOwner = m_slotOwners[slot];
+    if (!slotOwner.key.isEmpty()) {
+        const auto ownerIt = m_sources.find(slotOwner.key);
+        if (ownerIt != m_sources.end()) {
+            ownerIt.value().remove(slotOwner.chunkIndex);
+            if (ownerIt.value().isEmpty()) {
+                m_sources.erase(ownerIt);
+            }
+        }
+    }
+
+    if (!m_spillFile.seek(static_cast<qint64>(slot) * kSlotBytes) ||
+            m_spillFile.write(storedData) != storedData.size()) {
+        kLogger.warning()
+                << "Failed to write spilled chunk"
+                << chunkIndex
+                << "of"
+                << key
+                << "- disabling the spill cache";
+        // Most likely the temp volume ran out of space. Writes would
+        // keep failing, so stop spilling for the rest of the session.
+        m_enabled = false;
+        m_sources.clear();
+        m_slotOwners.clear();
+        return;
+    }
+
+    slotOwner.key = key;
+    slotOwner.chunkIndex = chunkIndex;
+    SpilledChunk spilledChunk;
+    spilledChunk.slot = slot;
+    spilledChunk.storedBytes = storedData.size();
+    spilledChunk.frameIndexRangeStart = chunkFrameIndexRange.start();
+    spilledChunk.frameIndexRangeEnd = chunkFrameIndexRange.end();
+    spilledChunk.compressed = compressed;
+    chunks.insert(chunkIndex, spilledChunk);
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <QHash>
+#include <QMutex>
+#include <QString>
+#include <QTemporaryFile>
+
+#include <vector>
+
+#include "audio/types.h"
+#include "util/indexrange.h"
+#include "util/types.h"
+
+class CachingReaderChunk;
+
+// Session-scoped spill store of decoded chunk sample data on local disk,
+// shared between the CachingReaderWorker instances of all decks, samplers
+// and preview decks. While CachingReaderSharedCache avoids decoding the
+// same chunk twice while a track is open on multiple readers, the spill
+// cache keeps decoded chunks across track unloads: chunks are written to
+// a bounded scratch file in the temp directory when they are decoded, and
+// re-loading a recently played track hydrates its chunks from the scratch
+// file instead of decoding the source again. This matters most for tracks
+// on slow media (USB sticks, network shares), where re-decoding is
+// dominated by the storage and not by the codec.
+//
+// The scratch file is organized as a ring of fixed-size slots for stereo
+// chunks; the oldest spilled chunks are overwritten once the ring is
+// full, bounding the file to roughly the last hour of decoded audio.
+// Slots are written zlib-compressed at the lightest level to reduce write
+// bandwidth, or raw when the data is incompressible. Chunks with more
+// than two channels (stem sources) do not fit a slot and are not spilled.
+// The file is deleted when the session ends.
+//
+// All methods are thread-safe. They are called from the worker threads
+// only and never from the engine callback.
+class CachingReaderSpillCache {
+  public:
+    static CachingReaderSpillCache* instance();
+
+    // Try to fill pChunk with the spilled sample data of the given chunk
+    // index. Returns true and imports the data into pChunk on a hit. The
+    // key must identify the track content including all parameters that
+    // affect the decoded sample data as well as the file modification
+    // state, see CachingReaderWorker::loadTrack().
+    bool tryReadChunk(
+            const QString& key,
+            SINT chunkIndex,
+            mixxx::audio::ChannelCount channelCount,
+            const mixxx::IndexRange& chunkFrameIndexRange,
+            CachingReaderChunk* pChunk);
+
+    // Spill a copy of the decoded sample data of a completely read chunk
+    // to the scratch file.
+    void publishChunk(
+            const QString& key,
+            SINT chunkIndex,
+            mixxx::audio::ChannelCount channelCount,
+            const mixxx::IndexRange& chunkFrameIndexRange,
+            const CSAMPLE* sampleData);
+
+  private:
+    CachingReaderSpillCache();
+
+    struct SpilledChunk {
+        SINT slot;
+        SINT storedBytes;
+        SINT frameIndexRangeStart;
+        SINT frameIndexRangeEnd;
+        bool compressed;
+    };
+
+    // Reverse mapping for reclaiming a slot that is overwritten by the
+    // ring allocation.
+    struct SlotOwner {
+        QString key;
+        SINT chunkIndex;
+    };
+
+    QMutex m_mutex;
+    QTemporaryFile m_spillFile;
+    bool m_enabled;
+    SINT m_nextSlot;
+    QHash<QString, QHash<SINT, SpilledChunk>> m_sources;
+    std::vector<SlotOwner> m_slotOwners;
+};
@@ -1,9 +1,12 @@
 #include "engine/cachingreader/cachingreaderworker.h"
 
 #include <QAtomicInt>
+#include <QFileInfo>
 #include <QtDebug>
 
 #include "analyzer/analyzersilence.h"
+#include "engine/cachingreader/cachingreadersharedcache.h"
+#include "engine/cachingreader/cachingreaderspillcache.h"
 #include "moc_cachingreaderworker.cpp"
 #include "sources/soundsourceproxy.h"
 #include "track/track.h"
@@ -11,7 +14,10 @@
 #include "util/event.h"
 #include "util/fifo.h"
 #include "util/logger.h"
+#include "util/math.h"
+#include "util/performancetimer.h"
 #include "util/span.h"
+#include "util/timer.h"
 
 namespace {
 
@@ -20,6 +26,13 @@ mixxx::Logger kLogger("CachingReaderWorker");
 // we need the last silence frame and the first sound frame
 constexpr SINT kNumSoundFrameToVerify = 2;
 
+// When the first sound is not found at the stored position the source
+// is scanned from its beginning up to this many seconds beyond the
+// stored position. Offsets caused by re-encoding stem from codec delay
+// or trimmed/added leading silence and are small, so a short scan
+// window is sufficient and bounds the extra decoding work.
+constexpr SINT kFirstSoundScanMarginSeconds = 10;
+
 } // anonymous namespace
 
 CachingReaderWorker::CachingReaderWorker(
@@ -51,10 +64,55 @@ ReaderStatusUpdate CachingReaderWorker::processReadRequest(
         return result;
     }
 
+    // First try to fill the chunk from the shared cache to avoid decoding
+    // the same data multiple times when the track is loaded on more than
+    // one deck.
+    if (!m_sharedCacheKey.isEmpty() &&
+            CachingReaderSharedCache::instance()->tryReadChunk(
+                    m_sharedCacheKey,
+                    pChunk->getIndex(),
+                    m_sharedCacheChannelCount,
+                    chunkFrameIndexRange,
+                    pChunk)) {
+        verifyFirstSound(pChunk, m_pAudioSource->getSignalInfo().getChannelCount());
+        ReaderStatusUpdate result;
+        result.init(CHUNK_READ_SUCCESS, pChunk, m_pAudioSource->frameIndexRange());
+        return result;
+    }
+
+    // Next try the session spill cache on local disk, which retains
+    // decoded chunks of recently played tracks across track unloads.
+    // Spill reads are not counted into the read latency average, they
+    // reflect the speed of the local scratch volume and not of the
+    // source storage.
+    if (!m_spillCacheKey.isEmpty() &&
+            CachingReaderSpillCache::instance()->tryReadChunk(
+                    m_spillCacheKey,
+                    pChunk->getIndex(),
+                    m_sharedCacheChannelCount,
+                    chunkFrameIndexRange,
+                    pChunk)) {
+        verifyFirstSound(pChunk, m_pAudioSource->getSignalInfo().getChannelCount());
+        ReaderStatusUpdate result;
+        result.init(CHUNK_READ_SUCCESS, pChunk, m_pAudioSource->frameIndexRange());
+        return result;
+    }
+
     // Try to read the data required for the chunk from the audio source
+    ScopedTimer readScopedTimer(QStringLiteral("CachingReaderWorker::readChunk"));
+    PerformanceTimer readTimer;
+    readTimer.start();
     const mixxx::IndexRange bufferedFrameIndexRange = pChunk->bufferSampleFrames(
             m_pAudioSource,
             mixxx::SampleBuffer::WritableSlice(m_tempReadBuffer));
+    // Update the published read latency average of the current source.
+    // The worker thread is the only writer.
+    const int readMicros = static_cast<int>(
+            readTimer.elapsed().toIntegerMicros());
+    const int averageMicros = m_readLatencyMicros.loadAcquire();
+    m_readLatencyMicros.storeRelease(averageMicros > 0
+                    ? (7 * averageMicros + readMicros) / 8
+                    : readMicros);
     DEBUG_ASSERT(!m_pAudioSource ||
             bufferedFrameIndexRange.isSubrangeOf(m_pAudioSource->frameIndexRange()));
     // The readable frame range might have changed
@@ -86,6 +144,32 @@ ReaderStatusUpdate CachingReaderWorker::processReadRequest(
     // Failures of the sanity check only result in an entry into the log at the moment.
     verifyFirstSound(pChunk, m_pAudioSource->getSignalInfo().getChannelCount());
 
+    // Publish completely read chunks for other readers of the same track.
+    // Partially read chunks are not shared, see
+    // CachingReaderSharedCache::tryReadChunk().
+    if (status == CHUNK_READ_SUCCESS &&
+            !m_sharedCacheKey.isEmpty() &&
+            bufferedFrameIndexRange == chunkFrameIndexRange) {
+        const CSAMPLE* sampleData = pChunk->bufferedSampleSpan(
+                m_sharedCacheChannelCount, bufferedFrameIndexRange);
+        if (sampleData) {
+            CachingReaderSharedCache::instance()->publishChunk(
+                    m_sharedCacheKey,
+                    pChunk->getIndex(),
+                    m_sharedCacheChannelCount,
+                    bufferedFrameIndexRange,
+                    sampleData);
+            if (!m_spillCacheKey.isEmpty()) {
+                CachingReaderSpillCache::instance()->publishChunk(
+                        m_spillCacheKey,
+                        pChunk->getIndex(),
+                        m_sharedCacheChannelCount,
+                        bufferedFrameIndexRange,
+                        sampleData);
+            }
+        }
+    }
+
     ReaderStatusUpdate result;
     result.init(status, pChunk, m_pAudioSource ? m_pAudioSource->frameIndexRange() : mixxx::IndexRange());
     return result;
@@ -169,12 +253,28 @@ void CachingReaderWorker::discardAllPendingRequests() {
 void CachingReaderWorker::closeAudioSource() {
     discardAllPendingRequests();
 
+    if (!m_sharedCacheKey.isEmpty()) {
+        CachingReaderSharedCache::instance()->closeSource(m_sharedCacheKey);
+        m_sharedCacheKey.clear();
+    }
+    // The spilled chunks themselves are kept, re-loading the track later
+    // is the whole point of the spill cache.
+    m_spillCacheKey.clear();
+
     if (m_pAudioSource) {
         // Closes open file handles of the old track.
         m_pAudioSource->close();
         m_pAudioSource.reset();
     }
 
+    // The next source may live on entirely different storage,
+    // measure its read latency from scratch.
+    m_readLatencyMicros.storeRelease(0);
+
+    // Drop a pending first sound verification of the old track.
+    m_firstSoundFrameToVerify = mixxx::audio::FramePos();
+    m_pTrackToVerify.reset();
+
     // This function has to be called with the engine stopped only
     // to avoid collecting new requests for the old track
     DEBUG_ASSERT(!m_pChunkReadRequestFIFO->readAvailable());
@@ -267,6 +367,39 @@ void CachingReaderWorker::loadTrack(const TrackPointer& pTrack) {
         return;
     }
 
+    // Register the audio source with the shared cache so that readers
+    // with the same track loaded can share decoded chunks. The key must
+    // cover all parameters that affect the decoded sample data: chunks
+    // of mono sources are buffered as stereo (see
+    // CachingReaderChunk::bufferSampleFrames()).
+    m_sharedCacheChannelCount =
+            m_pAudioSource->getSignalInfo().getChannelCount() %
+                            mixxx::audio::ChannelCount::stereo() ==
+                    0
+            ? m_pAudioSource->getSignalInfo().getChannelCount()
+            : mixxx::audio::ChannelCount::stereo();
+#ifdef __STEM__
+    m_sharedCacheKey = QStringLiteral("%1|%2|%3")
+                               .arg(pTrack->getLocation(),
+                                       QString::number(m_sharedCacheChannelCount),
+                                       QString::number(static_cast<int>(stemMask)));
+#else
+    m_sharedCacheKey = QStringLiteral("%1|%2")
+                               .arg(pTrack->getLocation(),
+                                       QString::number(m_sharedCacheChannelCount));
+#endif
+    CachingReaderSharedCache::instance()->openSource(m_sharedCacheKey);
+
+    // The spill cache outlives the open source, so its key must also
+    // cover the file modification state: if the file is replaced during
+    // the session, the stale spilled chunks are simply never hit again.
+    const QFileInfo fileInfo(pTrack->getLocation());
+    m_spillCacheKey = QStringLiteral("%1|%2|%3")
+                              .arg(m_sharedCacheKey,
+                                      QString::number(fileInfo.lastModified()
+                                                      .toMSecsSinceEpoch()),
+                                      QString::number(fileInfo.size()));
+
     // Adjust the internal buffer
     const SINT tempReadBufferSize =
             m_pAudioSource->getSignalInfo().frames2samples(
@@ -288,6 +421,7 @@ void CachingReaderWorker::loadTrack(const TrackPointer& pTrack) {
             pTrack->findCueByType(mixxx::CueType::N60dBSound);
     if (pN60dBSound) {
         m_firstSoundFrameToVerify = pN60dBSound->getPosition();
+        m_pTrackToVerify = pTrack;
     }
 
     // The engine must not request any chunks before receiving the
@@ -330,10 +464,94 @@ void CachingReaderWorker::verifyFirstSound(const CachingReaderChunk* pChunk,
         } else {
             // This can happen in case of track edits or replacements, changed
             // encoders or encoding issues.
-            qWarning() << "First sound has been moved! The beatgrid and "
-                          "other annotations are no longer valid"
-                       << m_pAudioSource->getUrlString();
+            if (!tryCorrectFirstSoundOffset()) {
+                qWarning() << "First sound has been moved! The beatgrid and "
+                              "other annotations are no longer valid"
+                           << m_pAudioSource->getUrlString();
+            }
         }
         m_firstSoundFrameToVerify = mixxx::audio::FramePos();
+        m_pTrackToVerify.reset();
+    }
+}
+
+bool CachingReaderWorker::tryCorrectFirstSoundOffset() {
+    DEBUG_ASSERT(m_pAudioSource);
+    DEBUG_ASSERT(m_firstSoundFrameToVerify.isValid());
+    if (!m_pTrackToVerify) {
+        return false;
+    }
+
+    const auto& signalInfo = m_pAudioSource->getSignalInfo();
+    const SINT expectedFrame = static_cast<SINT>(
+            m_firstSoundFrameToVerify.toLowerFrameBoundary().value());
+    const SINT scanEndFrame = math_min(
+            expectedFrame +
+                    static_cast<SINT>(signalInfo.getSampleRate()) *
+                            kFirstSoundScanMarginSeconds,
+            m_pAudioSource->frameIndexMax());
+
+    // Scan block-wise from the beginning of the source for the actual
+    // first sound. The -60 dB threshold matches the definition of the
+    // stored position, see AnalyzerSilence.
+    mixxx::audio::FramePos actualFirstSoundPosition;
+    SINT blockStartFrame = m_pAudioSource->frameIndexMin();
+    while (blockStartFrame < scanEndFrame) {
+        const auto blockFrameIndexRange = intersect(
+                mixxx::IndexRange::forward(
+                        blockStartFrame, CachingReaderChunk::kFrames),
+                m_pAudioSource->frameIndexRange());
+        if (blockFrameIndexRange.empty()) {
+            break;
+        }
+        const auto readableSampleFrames = m_pAudioSource->readSampleFrames(
+                mixxx::WritableSampleFrames(
+                        blockFrameIndexRange,
+                        mixxx::SampleBuffer::WritableSlice(m_tempReadBuffer)));
+        if (readableSampleFrames.frameIndexRange().empty()) {
+            break;
+        }
+        const SINT firstSoundSample = AnalyzerSilence::findFirstSoundInChunk(
+                std::span<const CSAMPLE>(readableSampleFrames.readableData(),
+                        readableSampleFrames.readableLength()));
+        if (firstSoundSample < readableSampleFrames.readableLength()) {
+            actualFirstSoundPosition = mixxx::audio::FramePos(
+                    readableSampleFrames.frameIndexRange().start() +
+                    firstSoundSample / signalInfo.getChannelCount());
+            break;
+        }
+        blockStartFrame = readableSampleFrames.frameIndexRange().end();
+    }
+    if (!actualFirstSoundPosition.isValid()) {
+        return false;
+    }
+
+    const mixxx::audio::FrameDiff_t frameOffset =
+            actualFirstSoundPosition - m_firstSoundFrameToVerify.toLowerFrameBoundary();
+    if (frameOffset == 0) {
+        // The first sound is still where it was stored, but with
+        // different sample values around it. The audio itself has
+        // changed and shifting the annotations would not help.
+        return false;
+    }
+
+    const mixxx::BeatsPointer pBeats = m_pTrackToVerify->getBeats();
+    if (pBeats) {
+        const auto translatedBeats = pBeats->tryTranslate(frameOffset);
+        if (!translatedBeats ||
+                !m_pTrackToVerify->trySetBeats(*translatedBeats)) {
+            // Don't shift the cues either when the beatgrid could not
+            // follow (e.g. because the BPM is locked), otherwise cues
+            // and grid would run out of sync with each other.
+            return false;
+        }
     }
+    m_pTrackToVerify->shiftCuePositionsFrames(frameOffset);
+    kLogger.info()
+            << m_group
+            << "First sound has been moved by"
+            << frameOffset
+            << "frames, adjusted beatgrid and cues"
+            << m_pAudioSource->getUrlString();
+    return true;
 }
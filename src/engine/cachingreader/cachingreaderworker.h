@@ -116,6 +116,17 @@ class CachingReaderWorker : public EngineWorker {
 
     void quitWait();
 
+    /// Exponential moving average of the time one chunk read from the
+    /// current audio source takes, in microseconds. 0 until the first
+    /// chunk of the source has been read. Chunks served from the shared
+    /// cache are not counted, so the average reflects the speed of the
+    /// underlying storage (SSD vs. NAS vs. USB stick) and is used to
+    /// scale the read-ahead distance, see
+    /// CachingReader::recommendedReadAheadChunks().
+    int readLatencyMicros() const {
+        return m_readLatencyMicros.loadAcquire();
+    }
+
   signals:
     // Emitted once a new track is loaded and ready to be read from.
     void trackLoading();
@@ -173,11 +184,38 @@ class CachingReaderWorker : public EngineWorker {
     void verifyFirstSound(const CachingReaderChunk* pChunk,
             mixxx::audio::ChannelCount channelCount);
 
+    /// Called when the first sound is no longer found at the position
+    /// stored with the track. Scans the audio source for the actual
+    /// first sound and, if found, translates the beatgrid and shifts
+    /// all cues by the detected offset so that the annotations match
+    /// the re-encoded audio again. Returns false if the offset could
+    /// not be determined or the annotations could not be corrected.
+    bool tryCorrectFirstSoundOffset();
+
     // The current audio source of the track loaded
     mixxx::AudioSourcePointer m_pAudioSource;
 
+    // Identifies the open audio source in the shared chunk cache.
+    // Empty if no audio source is open.
+    QString m_sharedCacheKey;
+
+    // Identifies the open audio source in the session spill cache on
+    // disk. Extends the shared cache key by the file modification state,
+    // since spilled chunks outlive the open source. Empty if no audio
+    // source is open.
+    QString m_spillCacheKey;
+
+    // Channel count of the decoded sample data buffered in the chunks,
+    // i.e. the source channel count with mono upgraded to stereo.
+    mixxx::audio::ChannelCount m_sharedCacheChannelCount;
+
     mixxx::audio::FramePos m_firstSoundFrameToVerify;
 
+    // The track whose audio source is currently open. Only set while
+    // the first sound position still needs to be verified, so that a
+    // detected offset can be written back to the track's annotations.
+    TrackPointer m_pTrackToVerify;
+
     // Temporary buffer for reading samples from all channels
     // before conversion to a stereo signal.
     mixxx::SampleBuffer m_tempReadBuffer;
@@ -186,4 +224,7 @@ class CachingReaderWorker : public EngineWorker {
     mixxx::audio::ChannelCount m_maxSupportedChannel;
 
     QAtomicInt m_stop;
+
+    // Written by the worker thread, read by the engine thread.
+    QAtomicInt m_readLatencyMicros;
 };
@@ -5,7 +5,8 @@
 #include "util/timer.h"
 
 // static
-void ChannelMixer::applyEffectsAndMixChannels(const EngineMixer::GainCalculator& gainCalculator,
+template<typename GainCalculator>
+void ChannelMixer::applyEffectsAndMixChannels(const GainCalculator& gainCalculator,
         const QVarLengthArray<EngineMixer::ChannelInfo*, kPreallocatedChannels>& activeChannels,
         QVarLengthArray<EngineMixer::GainCache, kPreallocatedChannels>* channelGainCache,
         CSAMPLE* pOutput,
@@ -24,6 +25,13 @@ void ChannelMixer::applyEffectsAndMixChannels(const EngineMixer::GainCalculator&
     // The original channel input buffers are not modified.
     SampleUtil::clear(pOutput, bufferSize);
     ScopedTimer t(QStringLiteral("EngineMixer::applyEffectsAndMixChannels"));
+    // Structure-of-arrays gain state for the fused mix kernel. Channels
+    // without any active postfader effects are not routed through the
+    // per-channel effects processing, but mixed together in one
+    // cache-friendly pass over pOutput below.
+    QVarLengthArray<const CSAMPLE*, kPreallocatedChannels> fusedBuffers;
+    QVarLengthArray<CSAMPLE_GAIN, kPreallocatedChannels> fusedOldGains;
+    QVarLengthArray<CSAMPLE_GAIN, kPreallocatedChannels> fusedNewGains;
     for (auto* pChannelInfo : activeChannels) {
         EngineMixer::GainCache& gainCache = (*channelGainCache)[pChannelInfo->m_index];
         CSAMPLE_GAIN oldGain = gainCache.m_gain;
@@ -38,21 +46,37 @@ void ChannelMixer::applyEffectsAndMixChannels(const EngineMixer::GainCalculator&
             newGain = gainCalculator.getGain(pChannelInfo);
         }
         gainCache.m_gain = newGain;
-        pEngineEffectsManager->processPostFaderAndMix(pChannelInfo->m_handle,
-                outputHandle,
-                pChannelInfo->m_pBuffer.data(),
-                pOutput,
-                bufferSize,
-                sampleRate,
-                pChannelInfo->m_features,
-                oldGain,
-                newGain,
-                fadeout);
+        if (pEngineEffectsManager &&
+                pEngineEffectsManager->needsPostFaderProcessing(
+                        pChannelInfo->m_handle, outputHandle)) {
+            pEngineEffectsManager->processPostFaderAndMix(pChannelInfo->m_handle,
+                    outputHandle,
+                    pChannelInfo->m_pBuffer.data(),
+                    pOutput,
+                    bufferSize,
+                    sampleRate,
+                    pChannelInfo->m_features,
+                    oldGain,
+                    newGain,
+                    fadeout);
+        } else {
+            fusedBuffers.append(pChannelInfo->m_pBuffer.data());
+            fusedOldGains.append(oldGain);
+            fusedNewGains.append(newGain);
+        }
     }
+    SampleUtil::mixWithRampingGain(pOutput,
+            fusedBuffers.constData(),
+            fusedOldGains.constData(),
+            fusedNewGains.constData(),
+            fusedBuffers.size(),
+            bufferSize);
 }
 
+// static
+template<typename GainCalculator>
 void ChannelMixer::applyEffectsInPlaceAndMixChannels(
-        const EngineMixer::GainCalculator& gainCalculator,
+        const GainCalculator& gainCalculator,
         const QVarLengthArray<EngineMixer::ChannelInfo*, kPreallocatedChannels>&
                 activeChannels,
         QVarLengthArray<EngineMixer::GainCache, kPreallocatedChannels>*
@@ -70,6 +94,14 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(
     // 4. Mix the channel buffers together to make pOutput, overwriting the pOutput buffer from the last engine callback
     ScopedTimer t(QStringLiteral("EngineMixer::applyEffectsInPlaceAndMixChannels"));
     SampleUtil::clear(pOutput, bufferSize);
+    // Structure-of-arrays gain state for the fused mix kernel, see
+    // applyEffectsAndMixChannels(). Channels taking the fused path leave
+    // their input buffer untouched; the gained signal only exists in
+    // pOutput. That is fine because the channel buffers are not read
+    // again after the in-place mix stages of the engine callback.
+    QVarLengthArray<const CSAMPLE*, kPreallocatedChannels> fusedBuffers;
+    QVarLengthArray<CSAMPLE_GAIN, kPreallocatedChannels> fusedOldGains;
+    QVarLengthArray<CSAMPLE_GAIN, kPreallocatedChannels> fusedNewGains;
     for (auto* pChannelInfo : activeChannels) {
         EngineMixer::GainCache& gainCache = (*channelGainCache)[pChannelInfo->m_index];
         CSAMPLE_GAIN oldGain = gainCache.m_gain;
@@ -84,15 +116,66 @@ void ChannelMixer::applyEffectsInPlaceAndMixChannels(
             newGain = gainCalculator.getGain(pChannelInfo);
         }
         gainCache.m_gain = newGain;
-        pEngineEffectsManager->processPostFaderInPlace(pChannelInfo->m_handle,
-                outputHandle,
-                pChannelInfo->m_pBuffer.data(),
-                bufferSize,
-                sampleRate,
-                pChannelInfo->m_features,
-                oldGain,
-                newGain,
-                fadeout);
-        SampleUtil::add(pOutput, pChannelInfo->m_pBuffer.data(), bufferSize);
+        if (pEngineEffectsManager &&
+                pEngineEffectsManager->needsPostFaderProcessing(
+                        pChannelInfo->m_handle, outputHandle)) {
+            pEngineEffectsManager->processPostFaderInPlace(pChannelInfo->m_handle,
+                    outputHandle,
+                    pChannelInfo->m_pBuffer.data(),
+                    bufferSize,
+                    sampleRate,
+                    pChannelInfo->m_features,
+                    oldGain,
+                    newGain,
+                    fadeout);
+            SampleUtil::add(pOutput, pChannelInfo->m_pBuffer.data(), bufferSize);
+        } else {
+            fusedBuffers.append(pChannelInfo->m_pBuffer.data());
+            fusedOldGains.append(oldGain);
+            fusedNewGains.append(newGain);
+        }
     }
+    SampleUtil::mixWithRampingGain(pOutput,
+            fusedBuffers.constData(),
+            fusedOldGains.constData(),
+            fusedNewGains.constData(),
+            fusedBuffers.size(),
+            bufferSize);
 }
+
+// Explicit instantiations for the gain calculators used by EngineMixer.
+template void ChannelMixer::applyEffectsAndMixChannels<EngineMixer::PflGainCalculator>(
+        const EngineMixer::PflGainCalculator& gainCalculator,
+        const QVarLengthArray<EngineMixer::ChannelInfo*,
+                kPreallocatedChannels>& activeChannels,
+        QVarLengthArray<EngineMixer::GainCache, kPreallocatedChannels>*
+                channelGainCache,
+        CSAMPLE* pOutput,
+        const ChannelHandle& outputHandle,
+        std::size_t bufferSize,
+        mixxx::audio::SampleRate sampleRate,
+        EngineEffectsManager* pEngineEffectsManager);
+template void ChannelMixer::applyEffectsInPlaceAndMixChannels<
+        EngineMixer::TalkoverGainCalculator>(
+        const EngineMixer::TalkoverGainCalculator& gainCalculator,
+        const QVarLengthArray<EngineMixer::ChannelInfo*,
+                kPreallocatedChannels>& activeChannels,
+        QVarLengthArray<EngineMixer::GainCache, kPreallocatedChannels>*
+                channelGainCache,
+        CSAMPLE* pOutput,
+        const ChannelHandle& outputHandle,
+        std::size_t bufferSize,
+        mixxx::audio::SampleRate sampleRate,
+        EngineEffectsManager* pEngineEffectsManager);
+template void ChannelMixer::applyEffectsInPlaceAndMixChannels<
+        EngineMixer::OrientationVolumeGainCalculator>(
+        const EngineMixer::OrientationVolumeGainCalculator& gainCalculator,
+        const QVarLengthArray<EngineMixer::ChannelInfo*,
+                kPreallocatedChannels>& activeChannels,
+        QVarLengthArray<EngineMixer::GainCache, kPreallocatedChannels>*
+                channelGainCache,
+        CSAMPLE* pOutput,
+        const ChannelHandle& outputHandle,
+        std::size_t bufferSize,
+        mixxx::audio::SampleRate sampleRate,
+        EngineEffectsManager* pEngineEffectsManager);
@@ -8,11 +8,17 @@
 
 class ChannelMixer {
   public:
+    // The gain calculator is a template parameter so that the per-channel
+    // gain computation is statically dispatched and inlined into the mix
+    // loop. The explicit instantiations for the engine's calculator types
+    // live in channelmixer.cpp.
+
     // This does not modify the input channel buffers. All manipulation of the input
     // channel buffers is done after copying to a temporary buffer, then they are mixed
     // to make the output buffer.
+    template<typename GainCalculator>
     static void applyEffectsAndMixChannels(
-            const EngineMixer::GainCalculator& gainCalculator,
+            const GainCalculator& gainCalculator,
             const QVarLengthArray<EngineMixer::ChannelInfo*,
                     kPreallocatedChannels>& activeChannels,
             QVarLengthArray<EngineMixer::GainCache, kPreallocatedChannels>*
@@ -23,8 +29,9 @@ class ChannelMixer {
             mixxx::audio::SampleRate sampleRate,
             EngineEffectsManager* pEngineEffectsManager);
     // This does modify the input channel buffers, then mixes them to make the output buffer.
+    template<typename GainCalculator>
     static void applyEffectsInPlaceAndMixChannels(
-            const EngineMixer::GainCalculator& gainCalculator,
+            const GainCalculator& gainCalculator,
             const QVarLengthArray<EngineMixer::ChannelInfo*,
                     kPreallocatedChannels>& activeChannels,
             QVarLengthArray<EngineMixer::GainCache, kPreallocatedChannels>*
@@ -158,18 +158,28 @@ void EngineDeck::processStem(CSAMPLE* pOut, const std::size_t bufferSize) {
 
     // We will now mix each stem (stereo channel) into a single "output"
     // stereo channel. In order to mix the steam, we will use the engine
-    // effect manager so we can also apply the individual stem quick FX
+    // effect manager so we can also apply the individual stem quick FX.
+    // Each stem is deinterleaved into a stereo scratch buffer, processed
+    // there and summed straight into the output, so the processed frames
+    // never have to be scattered back into the interleaved stem buffer
+    // and downmixed with strided reads afterwards.
+    if (m_stemWorkBuffer.size() < static_cast<SINT>(bufferSize)) {
+        m_stemWorkBuffer = mixxx::SampleBuffer(bufferSize);
+    }
+    CSAMPLE* pStem = m_stemWorkBuffer.data();
+
     GroupFeatureState featureState;
     collectFeatures(&featureState);
+    SampleUtil::clear(pOut, bufferSize);
     for (unsigned int stemIdx = 0; stemIdx < stemCount;
             stemIdx++) {
         int chOffset = stemIdx * mixxx::audio::ChannelCount::stereo();
         float stemGain = m_stemMute[stemIdx]->toBool()
                 ? 0.0f
                 : static_cast<float>(m_stemGain[stemIdx]->get());
-        // Extract the stem frames into the output buffer (LR......LR...... -> LRLR)
+        // Extract the stem frames into the scratch buffer (LR......LR...... -> LRLR)
         SampleUtil::copyOneStereoFromMulti(
-                pOut,
+                pStem,
                 pIn,
                 numFrames,
                 chCount,
@@ -177,7 +187,7 @@ void EngineDeck::processStem(CSAMPLE* pOut, const std::size_t bufferSize) {
         // Mix the stem frames with the right gain after proceeding its effect.
         pEngineEffectsManager->processPostFaderInPlace(m_stems[stemIdx].handle(),
                 m_pEffectsManager->getMainHandle(),
-                pOut,
+                pStem,
                 bufferSize,
                 sampleRate,
                 featureState,
@@ -189,19 +199,11 @@ void EngineDeck::processStem(CSAMPLE* pOut, const std::size_t bufferSize) {
         // gain) gain changes will yield to audio cracks.
         m_stemsGainCache[stemIdx] = stemGain;
 
-        m_stemVuMeter[stemIdx]->process(pOut, bufferSize);
+        m_stemVuMeter[stemIdx]->process(pStem, bufferSize);
 
-        // Put back the stem frames into the steam buffer (LRLR -> LR......LR......)
-        SampleUtil::insertStereoToMulti(
-                pIn,
-                pOut,
-                numFrames,
-                chCount,
-                chOffset);
+        // Sum the processed stem into the output (sequential SIMD pass)
+        SampleUtil::add(pOut, pStem, bufferSize);
     }
-
-    // Mixxx all the stem tracks together
-    SampleUtil::mixMultichannelToStereo(pOut, pIn, numFrames, chCount);
 }
 
 void EngineDeck::cloneStemState(const EngineDeck* deckToClone) {
@@ -254,7 +256,20 @@ void EngineDeck::process(CSAMPLE* pOut, const std::size_t bufferSize) {
             processStem(pOut, bufferSize);
         }
 #endif
-        m_pPregain->setSpeedAndScratching(m_pBuffer->getSpeed(), m_pBuffer->getScratching());
+        double speed = m_pBuffer->getSpeed();
+        if (speed == 0.0 && m_pBuffer->isPreviewVoiceActive()) {
+            // Keep the vinyl-style speed gain open while the preview
+            // voice is audible; the main render path is silent anyway
+            // when the deck is paused.
+            speed = 1.0;
+        }
+        m_pPregain->setSpeedAndScratching(speed, m_pBuffer->getScratching());
+        const mixxx::audio::SampleRate trackSampleRate = m_pBuffer->getTrackSampleRate();
+        const mixxx::audio::FramePos playPos = m_pBuffer->getPlayPos();
+        m_pPregain->setTrackPositionSeconds(
+                trackSampleRate.isValid() && playPos.isValid()
+                        ? playPos.value() / trackSampleRate
+                        : 0.0);
         m_bPassthroughWasActive = false;
     }
 
@@ -274,6 +289,10 @@ void EngineDeck::process(CSAMPLE* pOut, const std::size_t bufferSize) {
     m_vuMeter.process(pOut, bufferSize);
 }
 
+void EngineDeck::setLoudnessEnvelope(mixxx::LoudnessEnvelopePointer pLoudnessEnvelope) {
+    m_pPregain->setLoudnessEnvelope(std::move(pLoudnessEnvelope));
+}
+
 void EngineDeck::collectFeatures(GroupFeatureState* pGroupFeatures) const {
     m_pBuffer->collectFeatures(pGroupFeatures);
     m_vuMeter.collectFeatures(pGroupFeatures);
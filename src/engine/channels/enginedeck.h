@@ -5,6 +5,7 @@
 #include "engine/channels/enginechannel.h"
 #include "preferences/usersettings.h"
 #include "soundio/soundmanagerutil.h"
+#include "track/loudnessenvelope.h"
 #include "track/track_decl.h"
 #include "util/samplebuffer.h"
 
@@ -65,6 +66,11 @@ class EngineDeck : public EngineChannel, public AudioDestination {
     // Return whether or not passthrough is active
     bool isPassthroughActive() const;
 
+    // Hands the loudness normalization envelope of the loaded track over
+    // to the pregain, or nullptr when the track is unloaded. Called from
+    // the main thread by BaseTrackPlayerImpl.
+    void setLoudnessEnvelope(mixxx::LoudnessEnvelopePointer pLoudnessEnvelope);
+
 #ifdef __STEM__
     // Clone the stem state (gain and volume) from deckToClone to this. Doesn't
     // check if the loaded track is a stem so this should only be used in case
@@ -100,6 +106,9 @@ class EngineDeck : public EngineChannel, public AudioDestination {
 #ifdef __STEM__
     // Stem buffer used to retrieve all the channel to mix together
     mixxx::SampleBuffer m_stemBuffer;
+    // Scratch buffer holding the deinterleaved stereo frames of the stem
+    // currently being processed
+    mixxx::SampleBuffer m_stemWorkBuffer;
     std::unique_ptr<ControlObject> m_pStemCount;
     std::vector<std::unique_ptr<ControlPotmeter>> m_stemGain;
     std::vector<std::unique_ptr<ControlPushButton>> m_stemMute;
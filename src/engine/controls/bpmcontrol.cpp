@@ -77,9 +77,9 @@ BpmControl::BpmControl(const QString& group,
     m_pRateRatio->connectValueChanged(this, &BpmControl::slotUpdateEngineBpm,
                                       Qt::DirectConnection);
 
-    m_pLocalBpm = std::make_unique<ControlObject>(ConfigKey(group, "local_bpm"));
+    m_pLocalBpm = std::make_unique<ControlObject>(ConfigKey(group, QStringLiteral("local_bpm")));
     m_pAdjustBeatsFaster = std::make_unique<ControlPushButton>(
-            ConfigKey(group, "beats_adjust_faster"), false);
+            ConfigKey(group, QStringLiteral("beats_adjust_faster")), false);
     m_pAdjustBeatsFaster->setKbdRepeatable(true);
     connect(m_pAdjustBeatsFaster.get(),
             &ControlObject::valueChanged,
@@ -87,7 +87,7 @@ BpmControl::BpmControl(const QString& group,
             &BpmControl::slotAdjustBeatsFaster,
             Qt::DirectConnection);
     m_pAdjustBeatsSlower = std::make_unique<ControlPushButton>(
-            ConfigKey(group, "beats_adjust_slower"), false);
+            ConfigKey(group, QStringLiteral("beats_adjust_slower")), false);
     m_pAdjustBeatsSlower->setKbdRepeatable(true);
     connect(m_pAdjustBeatsSlower.get(),
             &ControlObject::valueChanged,
@@ -95,7 +95,7 @@ BpmControl::BpmControl(const QString& group,
             &BpmControl::slotAdjustBeatsSlower,
             Qt::DirectConnection);
     m_pTranslateBeatsEarlier = std::make_unique<ControlPushButton>(
-            ConfigKey(group, "beats_translate_earlier"), false);
+            ConfigKey(group, QStringLiteral("beats_translate_earlier")), false);
     m_pTranslateBeatsEarlier->setKbdRepeatable(true);
     connect(m_pTranslateBeatsEarlier.get(),
             &ControlObject::valueChanged,
@@ -103,7 +103,7 @@ BpmControl::BpmControl(const QString& group,
             &BpmControl::slotTranslateBeatsEarlier,
             Qt::DirectConnection);
     m_pTranslateBeatsLater = std::make_unique<ControlPushButton>(
-            ConfigKey(group, "beats_translate_later"), false);
+            ConfigKey(group, QStringLiteral("beats_translate_later")), false);
     m_pTranslateBeatsLater->setKbdRepeatable(true);
     connect(m_pTranslateBeatsLater.get(),
             &ControlObject::valueChanged,
@@ -111,21 +111,22 @@ BpmControl::BpmControl(const QString& group,
             &BpmControl::slotTranslateBeatsLater,
             Qt::DirectConnection);
     m_pTranslateBeatsHalf = std::make_unique<ControlPushButton>(
-            ConfigKey(group, "beats_translate_half"), false);
+            ConfigKey(group, QStringLiteral("beats_translate_half")), false);
     connect(m_pTranslateBeatsHalf.get(),
             &ControlObject::valueChanged,
             this,
             &BpmControl::slotTranslateBeatsHalf,
             Qt::DirectConnection);
     m_pTranslateBeatsMove = std::make_unique<ControlEncoder>(
-            ConfigKey(group, "beats_translate_move"), false);
+            ConfigKey(group, QStringLiteral("beats_translate_move")), false);
     connect(m_pTranslateBeatsMove.get(),
             &ControlObject::valueChanged,
             this,
             &BpmControl::slotTranslateBeatsMove,
             Qt::DirectConnection);
 
-    m_pBeatsHalve = std::make_unique<ControlPushButton>(ConfigKey(group, "beats_set_halve"), false);
+    m_pBeatsHalve = std::make_unique<ControlPushButton>(
+            ConfigKey(group, QStringLiteral("beats_set_halve")), false);
     connect(m_pBeatsHalve.get(),
             &ControlObject::valueChanged,
             this,
@@ -135,7 +136,7 @@ BpmControl::BpmControl(const QString& group,
                 }
             });
     m_pBeatsTwoThirds = std::make_unique<ControlPushButton>(
-            ConfigKey(group, "beats_set_twothirds"), false);
+            ConfigKey(group, QStringLiteral("beats_set_twothirds")), false);
     connect(m_pBeatsTwoThirds.get(),
             &ControlObject::valueChanged,
             this,
@@ -145,7 +146,7 @@ BpmControl::BpmControl(const QString& group,
                 }
             });
     m_pBeatsThreeFourths = std::make_unique<ControlPushButton>(
-            ConfigKey(group, "beats_set_threefourths"), false);
+            ConfigKey(group, QStringLiteral("beats_set_threefourths")), false);
     connect(m_pBeatsThreeFourths.get(),
             &ControlObject::valueChanged,
             this,
@@ -155,7 +156,7 @@ BpmControl::BpmControl(const QString& group,
                 }
             });
     m_pBeatsFourThirds = std::make_unique<ControlPushButton>(
-            ConfigKey(group, "beats_set_fourthirds"), false);
+            ConfigKey(group, QStringLiteral("beats_set_fourthirds")), false);
     connect(m_pBeatsFourThirds.get(),
             &ControlObject::valueChanged,
             this,
@@ -165,7 +166,7 @@ BpmControl::BpmControl(const QString& group,
                 }
             });
     m_pBeatsThreeHalves = std::make_unique<ControlPushButton>(
-            ConfigKey(group, "beats_set_threehalves"), false);
+            ConfigKey(group, QStringLiteral("beats_set_threehalves")), false);
     connect(m_pBeatsThreeHalves.get(),
             &ControlObject::valueChanged,
             this,
@@ -175,7 +176,7 @@ BpmControl::BpmControl(const QString& group,
                 }
             });
     m_pBeatsDouble = std::make_unique<ControlPushButton>(
-            ConfigKey(group, "beats_set_double"), false);
+            ConfigKey(group, QStringLiteral("beats_set_double")), false);
     connect(m_pBeatsDouble.get(),
             &ControlObject::valueChanged,
             this,
@@ -191,7 +192,7 @@ BpmControl::BpmControl(const QString& group,
     // bpm_up / bpm_down steps by kBpmRangeStep
     // bpm_up_small / bpm_down_small steps by kBpmRangeSmallStep
     m_pEngineBpm = std::make_unique<ControlLinPotmeter>(
-            ConfigKey(group, "bpm"),
+            ConfigKey(group, QStringLiteral("bpm")),
             kBpmRangeMin,
             kBpmRangeMax,
             kBpmRangeStep,
@@ -205,7 +206,7 @@ BpmControl::BpmControl(const QString& group,
             Qt::DirectConnection);
 
     // Tap the (file) BPM
-    m_pBpmTap = std::make_unique<ControlPushButton>(ConfigKey(group, "bpm_tap"));
+    m_pBpmTap = std::make_unique<ControlPushButton>(ConfigKey(group, QStringLiteral("bpm_tap")));
     connect(m_pBpmTap.get(),
             &ControlObject::valueChanged,
             this,
@@ -218,7 +219,7 @@ BpmControl::BpmControl(const QString& group,
             Qt::DirectConnection);
 
     // Tap the tempo (playback speed)
-    m_pTempoTap = std::make_unique<ControlPushButton>(ConfigKey(group, "tempo_tap"));
+    m_pTempoTap = std::make_unique<ControlPushButton>(ConfigKey(group, QStringLiteral("tempo_tap")));
     connect(m_pTempoTap.get(),
             &ControlObject::valueChanged,
             this,
@@ -231,7 +232,7 @@ BpmControl::BpmControl(const QString& group,
             Qt::DirectConnection);
 
     m_pTranslateBeats = std::make_unique<ControlPushButton>(
-            ConfigKey(group, "beats_translate_curpos"));
+            ConfigKey(group, QStringLiteral("beats_translate_curpos")));
     connect(m_pTranslateBeats.get(),
             &ControlObject::valueChanged,
             this,
@@ -239,7 +240,7 @@ BpmControl::BpmControl(const QString& group,
             Qt::DirectConnection);
 
     m_pBeatsTranslateMatchAlignment = std::make_unique<ControlPushButton>(
-            ConfigKey(group, "beats_translate_match_alignment"));
+            ConfigKey(group, QStringLiteral("beats_translate_match_alignment")));
     connect(m_pBeatsTranslateMatchAlignment.get(),
             &ControlObject::valueChanged,
             this,
@@ -247,7 +248,7 @@ BpmControl::BpmControl(const QString& group,
             Qt::DirectConnection);
 
     m_pBpmLock = std::make_unique<ControlPushButton>(
-            ConfigKey(group, "bpmlock"), false);
+            ConfigKey(group, QStringLiteral("bpmlock")), false);
     m_pBpmLock->setButtonMode(mixxx::control::ButtonMode::Toggle);
     m_pBpmLock->connectValueChangeRequest(
             this,
@@ -255,7 +256,7 @@ BpmControl::BpmControl(const QString& group,
             Qt::DirectConnection);
 
     m_pBeatsUndo = std::make_unique<ControlPushButton>(
-            ConfigKey(group, "beats_undo_adjustment"));
+            ConfigKey(group, QStringLiteral("beats_undo_adjustment")));
     connect(m_pBeatsUndo.get(),
             &ControlObject::valueChanged,
             this,
@@ -263,7 +264,7 @@ BpmControl::BpmControl(const QString& group,
             Qt::DirectConnection);
 
     m_pBeatsUndoPossible = std::make_unique<ControlObject>(
-            ConfigKey(group, "beats_undo_possible"));
+            ConfigKey(group, QStringLiteral("beats_undo_possible")));
     m_pBeatsUndoPossible->setReadOnly();
 }
 
@@ -681,14 +682,20 @@ bool BpmControl::getBeatContext(
         mixxx::audio::FramePos* pPrevBeatPosition,
         mixxx::audio::FramePos* pNextBeatPosition,
         mixxx::audio::FrameDiff_t* pBeatLengthFrames,
-        double* pBeatPercentage) {
+        double* pBeatPercentage,
+        mixxx::Beats::Cursor* pCursor) {
     if (!pBeats) {
         return false;
     }
 
     mixxx::audio::FramePos prevBeatPosition;
     mixxx::audio::FramePos nextBeatPosition;
-    if (!pBeats->findPrevNextBeats(position, &prevBeatPosition, &nextBeatPosition, false)) {
+    const bool foundBeats = pCursor
+            ? pCursor->findPrevNextBeats(
+                      pBeats, position, &prevBeatPosition, &nextBeatPosition, false)
+            : pBeats->findPrevNextBeats(
+                      position, &prevBeatPosition, &nextBeatPosition, false);
+    if (!foundBeats) {
         return false;
     }
 
@@ -764,7 +771,8 @@ mixxx::audio::FramePos BpmControl::getNearestPositionInPhase(
                     &thisPrevBeatPosition,
                     &thisNextBeatPosition,
                     &thisBeatLengthFrames,
-                    nullptr)) {
+                    nullptr,
+                    &m_beatCursor)) {
             return thisPosition;
         }
     } else {
@@ -955,18 +963,39 @@ mixxx::audio::FramePos BpmControl::getBeatMatchPosition(
                             << thisPrevBeatPosition << thisPosition << thisNextBeatPosition;
         }
         // This happens if thisPosition is the target position of a requested
-        // seek command.  Get new prev and next beats for the calculation.
-        getBeatContext(
-                m_pBeats,
-                thisPosition,
-                &thisPrevBeatPosition,
-                &thisNextBeatPosition,
-                &thisBeatLengthFrames,
-                nullptr);
-        // now we either have a useful next beat or there is none
-        if (!thisNextBeatPosition.isValid()) {
-            // We can't match the next beat, give up.
-            return thisPosition;
+        // seek command. If a beat context for the target has been published
+        // together with the seek (precomputed off the audio thread, e.g. for
+        // quantized hotcue jumps) and it still brackets the position, use it
+        // instead of querying the beatgrid here. The hint is only cleared on
+        // beatgrid changes, so it stays correct for repeated presses of the
+        // same hotcue.
+        const SeekBeatContextHint hint = m_seekBeatContextHint.getValue();
+        if (hint.prevBeatPosition.isValid() && hint.nextBeatPosition.isValid() &&
+                hint.prevBeatPosition <= thisPosition &&
+                thisPosition <= hint.nextBeatPosition) {
+            thisPrevBeatPosition = hint.prevBeatPosition;
+            thisNextBeatPosition = hint.nextBeatPosition;
+            getBeatContextNoLookup(
+                    thisPosition,
+                    thisPrevBeatPosition,
+                    thisNextBeatPosition,
+                    &thisBeatLengthFrames,
+                    nullptr);
+        } else {
+            // Get new prev and next beats for the calculation.
+            getBeatContext(
+                    m_pBeats,
+                    thisPosition,
+                    &thisPrevBeatPosition,
+                    &thisNextBeatPosition,
+                    &thisBeatLengthFrames,
+                    nullptr,
+                    &m_beatCursor);
+            // now we either have a useful next beat or there is none
+            if (!thisNextBeatPosition.isValid()) {
+                // We can't match the next beat, give up.
+                return thisPosition;
+            }
         }
     } else {
         if (kLogger.traceEnabled()) {
@@ -1147,6 +1176,13 @@ void BpmControl::slotUpdateRateSlider(double value) {
 }
 
 // called from an engine worker thread
+void BpmControl::setSeekBeatContextHint(
+        mixxx::audio::FramePos prevBeatPosition,
+        mixxx::audio::FramePos nextBeatPosition) {
+    m_seekBeatContextHint.setValue(
+            SeekBeatContextHint{prevBeatPosition, nextBeatPosition});
+}
+
 void BpmControl::trackLoaded(TrackPointer pNewTrack) {
     mixxx::BeatsPointer pBeats;
     if (pNewTrack) {
@@ -1164,6 +1200,11 @@ void BpmControl::trackBeatsUpdated(mixxx::BeatsPointer pBeats) {
                                    : mixxx::Bpm());
     }
     m_pBeats = pBeats;
+    // Do not keep the previous Beats object alive through the cached
+    // local BPM interval.
+    m_pLocalBpmIntervalBeats = nullptr;
+    // Beat contexts precomputed for the old beatgrid are no longer valid.
+    m_seekBeatContextHint.setValue(SeekBeatContextHint{});
     updateLocalBpm();
     resetSyncAdjustment();
     TrackPointer pTrack = getEngineBuffer()->getLoadedTrack();
@@ -1244,11 +1285,38 @@ mixxx::Bpm BpmControl::updateLocalBpm() {
     const FrameInfo info = frameInfo();
     if (pBeats) {
         if (info.currentPosition.isValid() && info.currentPosition != kInitialPlayPosition) {
+            // This runs on every engine callback via postProcessLocalBpm().
+            // The local BPM estimate is anchored at the next beat at or
+            // after the current position, so it stays the same while
+            // playback remains strictly between the same pair of beats
+            // and the beat lookup can be skipped.
+            if (pBeats == m_pLocalBpmIntervalBeats &&
+                    info.currentPosition > m_localBpmIntervalStart &&
+                    info.currentPosition < m_localBpmIntervalEnd) {
+                return prevLocalBpm;
+            }
             localBpm = pBeats->getBpmAroundPosition(info.currentPosition, kLocalBpmSpan);
             if (!localBpm.isValid()) {
                 localBpm = pBeats->getBpmInRange(
                         mixxx::audio::kStartFramePos, info.trackEndPosition);
             }
+            mixxx::audio::FramePos prevBeatPosition;
+            mixxx::audio::FramePos nextBeatPosition;
+            if (m_beatCursor.findPrevNextBeats(pBeats,
+                        info.currentPosition,
+                        &prevBeatPosition,
+                        &nextBeatPosition,
+                        false) &&
+                    prevBeatPosition != info.currentPosition) {
+                // Do not cache when the current position falls exactly on
+                // a beat. The estimate is anchored at that beat then,
+                // while all following positions anchor at the next one.
+                m_pLocalBpmIntervalBeats = pBeats;
+                m_localBpmIntervalStart = prevBeatPosition;
+                m_localBpmIntervalEnd = nextBeatPosition;
+            } else {
+                m_pLocalBpmIntervalBeats = nullptr;
+            }
         }
     }
     if (localBpm != prevLocalBpm) {
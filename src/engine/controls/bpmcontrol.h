@@ -70,13 +70,16 @@ class BpmControl : public EngineControl {
     // Calculates contextual information about beats: the previous beat, the
     // next beat, the current beat length, and the beat ratio (how far dPosition
     // lies within the current beat). Returns false if a previous or next beat
-    // does not exist. NULL arguments are safe and ignored.
+    // does not exist. NULL arguments are safe and ignored. Callers that query
+    // repeatedly for (mostly) monotonic positions can pass a beat cursor to
+    // skip the repeated lookup from scratch.
     static bool getBeatContext(const mixxx::BeatsPointer& pBeats,
             mixxx::audio::FramePos position,
             mixxx::audio::FramePos* pPrevBeatPosition,
             mixxx::audio::FramePos* pNextBeatPosition,
             mixxx::audio::FrameDiff_t* pBeatLengthFrames,
-            double* pBeatPercentage);
+            double* pBeatPercentage,
+            mixxx::Beats::Cursor* pCursor = nullptr);
 
     // Alternative version that works if the next and previous beat positions
     // are already known.
@@ -92,6 +95,15 @@ class BpmControl : public EngineControl {
     static double shortestPercentageChange(const double& current_percentage,
                                            const double& target_percentage);
     double getRateRatio() const;
+
+    // Publishes the beat positions bracketing the target of an upcoming
+    // seek, precomputed off the audio thread. getBeatMatchPosition() uses
+    // the hint instead of querying the beatgrid from inside the audio
+    // callback if it still brackets the seek position. Pass invalid
+    // positions to clear the hint.
+    void setSeekBeatContextHint(mixxx::audio::FramePos prevBeatPosition,
+            mixxx::audio::FramePos nextBeatPosition);
+
     void trackLoaded(TrackPointer pNewTrack) override;
     void trackBeatsUpdated(mixxx::BeatsPointer pBeats) override;
     void trackBpmLockChanged(bool locked);
@@ -178,6 +190,12 @@ class BpmControl : public EngineControl {
     std::unique_ptr<ControlPushButton> m_pBeatsTranslateMatchAlignment;
 
     PollingControlProxy m_pThisBeatDistance;
+    // Beat context of an upcoming seek target, see setSeekBeatContextHint().
+    struct SeekBeatContextHint {
+        mixxx::audio::FramePos prevBeatPosition;
+        mixxx::audio::FramePos nextBeatPosition;
+    };
+    ControlValueAtomic<SeekBeatContextHint> m_seekBeatContextHint;
     ControlValueAtomic<double> m_dSyncTargetBeatDistance;
     // The user offset is a beat distance percentage value that the user has tweaked a deck
     // to bring it in sync with the other decks. This value is added to the reported beat
@@ -195,6 +213,17 @@ class BpmControl : public EngineControl {
 
     // m_pBeats is written from an engine worker thread
     mixxx::BeatsPointer m_pBeats;
+    // Caches the beat interval of the last lookup for this deck's beats,
+    // only used from the engine thread
+    mixxx::Beats::Cursor m_beatCursor;
+
+    // Beat interval for which the local BPM published by updateLocalBpm()
+    // stays constant. While playback remains strictly between these two
+    // beats, the per-callback beat lookup can be skipped. Invalidated by
+    // resetting the Beats pointer, only used from the engine thread.
+    mixxx::BeatsPointer m_pLocalBpmIntervalBeats;
+    mixxx::audio::FramePos m_localBpmIntervalStart;
+    mixxx::audio::FramePos m_localBpmIntervalEnd;
 
     FRIEND_TEST(EngineSyncTest, UserTweakPreservedInSeek);
     FRIEND_TEST(EngineSyncTest, FollowerUserTweakPreservedInLeaderChange);
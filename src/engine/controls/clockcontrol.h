@@ -59,4 +59,7 @@ class ClockControl: public EngineControl {
 
     // m_pBeats is written from an engine worker thread
     mixxx::BeatsPointer m_pBeats;
+    // Caches the beat interval of the last lookup, only used from the
+    // engine thread
+    mixxx::Beats::Cursor m_beatCursor;
 };
@@ -3,6 +3,7 @@
 #include "control/controlindicator.h"
 #include "control/controlobject.h"
 #include "control/controlpushbutton.h"
+#include "engine/controls/bpmcontrol.h"
 #include "engine/enginebuffer.h"
 #include "mixer/playermanager.h"
 #include "moc_cuecontrol.cpp"
@@ -96,6 +97,9 @@ CueControl::CueControl(const QString& group,
           m_pConfig(pConfig),
           m_colorPaletteSettings(ColorPaletteSettings(pConfig)),
           m_currentlyPreviewingIndex(Cue::kNoHotCue),
+          m_previewVoiceEnabled(pConfig->getValue(
+                  ConfigKey("[Controls]", "HotcuePreviewVoice"), false)),
+          m_previewVoiceIndex(Cue::kNoHotCue),
           m_pPlay(ControlObject::getControl(ConfigKey(group, "play"))),
           m_pStopButton(ControlObject::getControl(ConfigKey(group, "stop"))),
           m_bypassCueSetByPlay(false),
@@ -584,6 +588,11 @@ void CueControl::trackLoaded(TrackPointer pNewTrack) {
         disconnect(m_pLoadedTrack.get(), nullptr, this, nullptr);
 
         updateCurrentlyPreviewingIndex(Cue::kNoHotCue);
+        if (m_previewVoiceIndex.fetchAndStoreRelease(Cue::kNoHotCue) !=
+                        Cue::kNoHotCue &&
+                getEngineBuffer() != nullptr) {
+            getEngineBuffer()->stopPreviewVoice();
+        }
 
         for (const auto& pControl : std::as_const(m_hotcueControls)) {
             detachCue(pControl);
@@ -803,6 +812,11 @@ void CueControl::loadCuesFromTrack() {
         }
     }
 
+    // Refresh the precomputed beat contexts of all hotcues. This runs here,
+    // off the audio thread, for every cue or beatgrid change, so quantized
+    // hotcue presses only need to read the cached context.
+    updateHotcueBeatContexts();
+
     if (pIntroCue) {
         const auto startPosition = quantizeCuePoint(pIntroCue->getPosition());
         const auto endPosition = quantizeCuePoint(pIntroCue->getEndPosition());
@@ -902,6 +916,38 @@ void CueControl::trackAnalyzed() {
     }
 }
 
+void CueControl::updateHotcueBeatContexts() {
+    const mixxx::BeatsPointer pBeats =
+            m_pLoadedTrack ? m_pLoadedTrack->getBeats() : nullptr;
+    for (const auto& pControl : std::as_const(m_hotcueControls)) {
+        HotcueControl::BeatContext beatContext;
+        const mixxx::audio::FramePos position = pControl->getPosition();
+        if (pBeats && position.isValid()) {
+            BpmControl::getBeatContext(pBeats,
+                    position,
+                    &beatContext.prevBeatPosition,
+                    &beatContext.nextBeatPosition,
+                    nullptr,
+                    nullptr);
+        }
+        pControl->setBeatContext(beatContext);
+    }
+}
+
+// Seeks like seekAbs(), but first publishes the hotcue's precomputed beat
+// context to the engine so the quantizing phase seek does not have to look
+// up the seek target in the beatgrid from inside the audio callback.
+void CueControl::seekAbsWithBeatContextHint(
+        HotcueControl* pControl, mixxx::audio::FramePos position) {
+    EngineBuffer* pEngineBuffer = getEngineBuffer();
+    if (pEngineBuffer != nullptr && m_pQuantizeEnabled->toBool()) {
+        const HotcueControl::BeatContext beatContext = pControl->getBeatContext();
+        pEngineBuffer->setSeekBeatContextHint(
+                beatContext.prevBeatPosition, beatContext.nextBeatPosition);
+    }
+    seekAbs(position);
+}
+
 void CueControl::trackCuesUpdated() {
     loadCuesFromTrack();
 }
@@ -963,12 +1009,6 @@ void CueControl::hotcueSet(HotcueControl* pControl, double value, HotcueSetMode
         return;
     }
 
-    // Note: the cue is just detached from the hotcue control
-    // It remains in the database for later use
-    // TODO: find a rule, that allows us to delete the cue as well
-    // https://github.com/mixxxdj/mixxx/issues/8740
-    hotcueClear(pControl, value);
-
     mixxx::audio::FramePos cueStartPosition;
     mixxx::audio::FramePos cueEndPosition;
     mixxx::CueType cueType = mixxx::CueType::Invalid;
@@ -980,7 +1020,9 @@ void CueControl::hotcueSet(HotcueControl* pControl, double value, HotcueSetMode
             // This allows to set a hotuce inside an active, saved loop with
             // 'hotcue_X_activate'.
             auto* pSavedLoopControl = m_pCurrentSavedLoopControl.loadAcquire();
-            if (pSavedLoopControl &&
+            // Re-placing the hotcue of the active saved loop itself always
+            // re-saves the loop (pSavedLoopControl != pControl below).
+            if (pSavedLoopControl && pSavedLoopControl != pControl &&
                     pSavedLoopControl->getPosition() ==
                             mixxx::audio::FramePos::fromEngineSamplePosMaybeInvalid(
                                     m_pLoopStartPosition->get()) &&
@@ -1069,15 +1111,32 @@ void CueControl::hotcueSet(HotcueControl* pControl, double value, HotcueSetMode
         }
     }
 
-    CuePointer pCue = m_pLoadedTrack->createAndAddCue(
-            cueType,
-            hotcueIndex,
-            cueStartPosition,
-            cueEndPosition,
-            color);
+    CuePointer pCue = pControl->getCue();
+    if (pCue) {
+        // Re-place the already attached cue in place instead of removing it
+        // and allocating a new one. This keeps the database id (a single row
+        // update on save instead of delete + insert) and the control
+        // attachment alive, and the diff-based cue setters only signal the
+        // fields that actually changed instead of two full cue list updates.
+        if (cueType != mixxx::CueType::Loop) {
+            // The cue is no longer a saved loop, so drop the active saved
+            // loop status that detaching the old cue used to reset.
+            m_pCurrentSavedLoopControl.testAndSetRelease(pControl, nullptr);
+        }
+        pCue->setType(cueType);
+        pCue->setStartAndEndPosition(cueStartPosition, cueEndPosition);
+        pCue->setColor(color);
+    } else {
+        pCue = m_pLoadedTrack->createAndAddCue(
+                cueType,
+                hotcueIndex,
+                cueStartPosition,
+                cueEndPosition,
+                color);
 
-    // TODO(XXX) deal with spurious signals
-    attachCue(pCue, pControl);
+        // TODO(XXX) deal with spurious signals
+        attachCue(pCue, pControl);
+    }
 
     if (cueType == mixxx::CueType::Loop) {
         setCurrentSavedLoopControlAndActivate(pControl);
@@ -1100,7 +1159,7 @@ void CueControl::hotcueGoto(HotcueControl* pControl, double value) {
     }
     const mixxx::audio::FramePos position = pControl->getPosition();
     if (position.isValid()) {
-        seekAbs(position);
+        seekAbsWithBeatContextHint(pControl, position);
     }
 }
 
@@ -1129,7 +1188,7 @@ void CueControl::hotcueGotoAndPlay(HotcueControl* pControl, double value) {
     }
     const mixxx::audio::FramePos position = pControl->getPosition();
     if (position.isValid()) {
-        seekAbs(position);
+        seekAbsWithBeatContextHint(pControl, position);
         // End previewing to not jump back if a sticking finger on a cue
         // button is released (just in case)
         updateCurrentlyPreviewingIndex(Cue::kNoHotCue);
@@ -1158,10 +1217,10 @@ void CueControl::hotcueGotoAndLoop(HotcueControl* pControl, double value) {
     }
 
     if (pCue->getType() == mixxx::CueType::Loop) {
-        seekAbs(startPosition);
+        seekAbsWithBeatContextHint(pControl, startPosition);
         setCurrentSavedLoopControlAndActivate(pControl);
     } else if (pCue->getType() == mixxx::CueType::HotCue) {
-        seekAbs(startPosition);
+        seekAbsWithBeatContextHint(pControl, startPosition);
         setBeatLoop(startPosition, true);
     } else {
         return;
@@ -1293,7 +1352,28 @@ void CueControl::hotcueActivatePreview(HotcueControl* pControl, double value) {
             pControl->cachePreviewingStartState();
             const mixxx::audio::FramePos position = pControl->getPreviewingPosition();
             mixxx::CueType type = pControl->getPreviewingType();
-            if (type != mixxx::CueType::Invalid && position.isValid()) {
+            if (m_previewVoiceEnabled && type == mixxx::CueType::HotCue &&
+                    position.isValid() && !m_pPlay->toBool() &&
+                    m_currentlyPreviewingIndex == Cue::kNoHotCue &&
+                    getEngineBuffer() != nullptr) {
+                // Play the preview through the dedicated preview voice
+                // instead of seeking the main playposition. This keeps the
+                // scaler and reader state of the main render path
+                // untouched, so the release neither glitches nor needs a
+                // second seek back to the hotcue.
+                const int oldIndex = m_previewVoiceIndex.fetchAndStoreRelease(index);
+                if (oldIndex >= 0 && oldIndex < kMaxNumberOfHotcues) {
+                    HotcueControl* pLastControl = m_hotcueControls.at(oldIndex);
+                    CuePointer pLastCue(pLastControl->getCue());
+                    if (pLastCue && pLastCue->getType() != mixxx::CueType::Invalid) {
+                        pLastControl->setStatus(HotcueControl::Status::Set);
+                    }
+                }
+                if (pControl->getStatus() == HotcueControl::Status::Set) {
+                    pControl->setStatus(HotcueControl::Status::Active);
+                }
+                getEngineBuffer()->startPreviewVoice(position);
+            } else if (type != mixxx::CueType::Invalid && position.isValid()) {
                 updateCurrentlyPreviewingIndex(index);
                 m_bypassCueSetByPlay = true;
                 if (type == mixxx::CueType::Loop) {
@@ -1301,10 +1381,19 @@ void CueControl::hotcueActivatePreview(HotcueControl* pControl, double value) {
                 } else if (pControl->getStatus() == HotcueControl::Status::Set) {
                     pControl->setStatus(HotcueControl::Status::Active);
                 }
-                seekAbs(position);
+                seekAbsWithBeatContextHint(pControl, position);
                 m_pPlay->set(1.0);
             }
         }
+    } else if (m_previewVoiceIndex == index) {
+        // This is a release of a hotcue previewed through the preview voice
+        m_previewVoiceIndex = Cue::kNoHotCue;
+        if (getEngineBuffer() != nullptr) {
+            getEngineBuffer()->stopPreviewVoice();
+        }
+        if (pCue && pCue->getType() != mixxx::CueType::Invalid) {
+            pControl->setStatus(HotcueControl::Status::Set);
+        }
     } else if (m_currentlyPreviewingIndex == index) {
         // This is a release of a previewing hotcue
         const mixxx::audio::FramePos position = pControl->getPreviewingPosition();
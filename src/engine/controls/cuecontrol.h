@@ -121,6 +121,24 @@ class HotcueControl : public QObject {
         }
     }
 
+    /// The beat positions bracketing this hotcue's position, precomputed
+    /// off the audio thread whenever the cue positions or the beatgrid
+    /// change. Quantized hotcue seeks pass this to the engine so the
+    /// phase seek in the audio callback does not have to query the
+    /// beatgrid. Invalid positions mean no context is available.
+    struct BeatContext {
+        mixxx::audio::FramePos prevBeatPosition;
+        mixxx::audio::FramePos nextBeatPosition;
+    };
+
+    BeatContext getBeatContext() const {
+        return m_beatContext.getValue();
+    }
+
+    void setBeatContext(BeatContext beatContext) {
+        m_beatContext.setValue(beatContext);
+    }
+
   private slots:
     void slotHotcueSet(double v);
     void slotHotcueSetCue(double v);
@@ -187,6 +205,7 @@ class HotcueControl : public QObject {
 
     ControlValueAtomic<mixxx::CueType> m_previewingType;
     ControlValueAtomic<mixxx::audio::FramePos> m_previewingPosition;
+    ControlValueAtomic<BeatContext> m_beatContext;
 };
 
 class CueControl : public EngineControl {
@@ -297,6 +316,9 @@ class CueControl : public EngineControl {
     void detachCue(HotcueControl* pControl);
     void setCurrentSavedLoopControlAndActivate(HotcueControl* pControl);
     void loadCuesFromTrack();
+    void updateHotcueBeatContexts();
+    void seekAbsWithBeatContextHint(HotcueControl* pControl,
+            mixxx::audio::FramePos position);
     mixxx::audio::FramePos quantizeCuePoint(mixxx::audio::FramePos position);
     mixxx::audio::FramePos getQuantizedCurrentPosition();
     TrackAt getTrackAt() const;
@@ -312,6 +334,13 @@ class CueControl : public EngineControl {
     UserSettingsPointer m_pConfig;
     ColorPaletteSettings m_colorPaletteSettings;
     QAtomicInt m_currentlyPreviewingIndex;
+    // True if plain hotcue previews are played through the dedicated
+    // preview voice of the EngineBuffer instead of seeking the main
+    // playposition, see hotcueActivatePreview(). Opt-in via config.
+    const bool m_previewVoiceEnabled;
+    // Index of the hotcue currently previewed through the preview voice,
+    // or Cue::kNoHotCue.
+    QAtomicInt m_previewVoiceIndex;
     ControlObject* m_pPlay;
     ControlObject* m_pStopButton;
     ControlObject* m_pQuantizeEnabled;
@@ -458,11 +458,24 @@ bool KeyControl::syncKey(EngineBuffer* pOtherEngineBuffer) {
             KeyUtils::keyFromNumericValue(m_pFileKey->get());
 
     // Get the sync target's effective key, since that is what we aim to match.
-    double dKey = ControlObject::get(ConfigKey(pOtherEngineBuffer->getGroup(), "key"));
+    SyncKeyTarget& target = m_syncKeyTargets[pOtherEngineBuffer->getGroup()];
+    if (!target.keyIndex.valid()) {
+        // First sync against this deck; resolve the controls once so
+        // subsequent calls read through the flat index table instead of a
+        // ConfigKey hash lookup per call.
+        target.pKey = std::make_unique<ControlProxy>(
+                pOtherEngineBuffer->getGroup(), QStringLiteral("key"));
+        target.pVisualKeyDistance = std::make_unique<ControlProxy>(
+                pOtherEngineBuffer->getGroup(),
+                QStringLiteral("visual_key_distance"));
+        target.keyIndex = target.pKey->getIndex();
+        target.visualKeyDistanceIndex = target.pVisualKeyDistance->getIndex();
+    }
+    double dKey = ControlObject::getByIndex(target.keyIndex);
     mixxx::track::io::key::ChromaticKey otherKey =
             KeyUtils::keyFromNumericValue(dKey);
-    double otherDistance = ControlObject::get(
-            ConfigKey(pOtherEngineBuffer->getGroup(), "visual_key_distance"));
+    double otherDistance =
+            ControlObject::getByIndex(target.visualKeyDistanceIndex);
 
     if (thisFileKey == mixxx::track::io::key::INVALID ||
         otherKey == mixxx::track::io::key::INVALID) {
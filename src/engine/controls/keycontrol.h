@@ -1,5 +1,8 @@
 #pragma once
 
+#include <QHash>
+
+#include "control/controlindex.h"
 #include "engine/controls/enginecontrol.h"
 #include "util/parented_ptr.h"
 
@@ -70,6 +73,18 @@ class KeyControl : public EngineControl {
     std::unique_ptr<ControlObject> m_pEngineKey;
     std::unique_ptr<ControlPotmeter> m_pEngineKeyDistance;
 
+    // Controls of a sync_key target deck, resolved once per group and then
+    // read through the flat index table (see control/controlindex.h) on
+    // subsequent engine-thread calls. The proxies keep the controls alive
+    // while their indices are cached.
+    struct SyncKeyTarget {
+        std::unique_ptr<ControlProxy> pKey;
+        std::unique_ptr<ControlProxy> pVisualKeyDistance;
+        ControlIndex keyIndex;
+        ControlIndex visualKeyDistanceIndex;
+    };
+    QHash<QString, SyncKeyTarget> m_syncKeyTargets;
+
     struct PitchTempoRatio m_pitchRateInfo;
     QAtomicInt m_updatePitchRequest;
     QAtomicInt m_updatePitchAdjustRequest;
@@ -62,34 +62,34 @@ LoopingControl::LoopingControl(const QString& group,
     m_pActiveBeatLoop = nullptr;
     m_pRateControl = nullptr;
     //Create loop-in, loop-out, loop-exit, and reloop/exit ControlObjects
-    m_pLoopInButton = new ControlPushButton(ConfigKey(group, "loop_in"));
+    m_pLoopInButton = new ControlPushButton(ConfigKey(group, QStringLiteral("loop_in")));
     connect(m_pLoopInButton, &ControlObject::valueChanged,
             this, &LoopingControl::slotLoopIn,
             Qt::DirectConnection);
     m_pLoopInButton->set(0);
 
-    m_pLoopInGotoButton = new ControlPushButton(ConfigKey(group, "loop_in_goto"));
+    m_pLoopInGotoButton = new ControlPushButton(ConfigKey(group, QStringLiteral("loop_in_goto")));
     connect(m_pLoopInGotoButton, &ControlObject::valueChanged,
             this, &LoopingControl::slotLoopInGoto);
 
-    m_pLoopOutButton = new ControlPushButton(ConfigKey(group, "loop_out"));
+    m_pLoopOutButton = new ControlPushButton(ConfigKey(group, QStringLiteral("loop_out")));
     connect(m_pLoopOutButton, &ControlObject::valueChanged,
             this, &LoopingControl::slotLoopOut,
             Qt::DirectConnection);
     m_pLoopOutButton->set(0);
 
-    m_pLoopOutGotoButton = new ControlPushButton(ConfigKey(group, "loop_out_goto"));
+    m_pLoopOutGotoButton = new ControlPushButton(ConfigKey(group, QStringLiteral("loop_out_goto")));
     connect(m_pLoopOutGotoButton, &ControlObject::valueChanged,
             this, &LoopingControl::slotLoopOutGoto);
 
 
-    m_pLoopExitButton = new ControlPushButton(ConfigKey(group, "loop_exit"));
+    m_pLoopExitButton = new ControlPushButton(ConfigKey(group, QStringLiteral("loop_exit")));
     connect(m_pLoopExitButton, &ControlObject::valueChanged,
             this, &LoopingControl::slotLoopExit,
             Qt::DirectConnection);
     m_pLoopExitButton->set(0);
 
-    m_pReloopToggleButton = new ControlPushButton(ConfigKey(group, "reloop_toggle"));
+    m_pReloopToggleButton = new ControlPushButton(ConfigKey(group, QStringLiteral("reloop_toggle")));
     connect(m_pReloopToggleButton, &ControlObject::valueChanged,
             this, &LoopingControl::slotReloopToggle,
             Qt::DirectConnection);
@@ -97,56 +97,57 @@ LoopingControl::LoopingControl(const QString& group,
     // The old reloop_exit name was confusing. This CO does both entering and exiting.
     m_pReloopToggleButton->addAlias(ConfigKey(group, QStringLiteral("reloop_exit")));
 
-    m_pReloopAndStopButton = new ControlPushButton(ConfigKey(group, "reloop_andstop"));
+    m_pReloopAndStopButton = new ControlPushButton(ConfigKey(group, QStringLiteral("reloop_andstop")));
     connect(m_pReloopAndStopButton, &ControlObject::valueChanged,
             this, &LoopingControl::slotReloopAndStop,
             Qt::DirectConnection);
 
-    m_pCOLoopEnabled = new ControlObject(ConfigKey(group, "loop_enabled"));
+    m_pCOLoopEnabled = new ControlObject(ConfigKey(group, QStringLiteral("loop_enabled")));
     m_pCOLoopEnabled->set(0.0);
     m_pCOLoopEnabled->connectValueChangeRequest(this,
             &LoopingControl::slotLoopEnabledValueChangeRequest,
             Qt::DirectConnection);
 
     m_pCOLoopStartPosition =
-            new ControlObject(ConfigKey(group, "loop_start_position"));
+            new ControlObject(ConfigKey(group, QStringLiteral("loop_start_position")));
     m_pCOLoopStartPosition->set(kNoTrigger);
     connect(m_pCOLoopStartPosition, &ControlObject::valueChanged,
             this, &LoopingControl::slotLoopStartPos,
             Qt::DirectConnection);
 
     m_pCOLoopEndPosition =
-            new ControlObject(ConfigKey(group, "loop_end_position"));
+            new ControlObject(ConfigKey(group, QStringLiteral("loop_end_position")));
     m_pCOLoopEndPosition->set(kNoTrigger);
     connect(m_pCOLoopEndPosition, &ControlObject::valueChanged,
             this, &LoopingControl::slotLoopEndPos,
             Qt::DirectConnection);
 
-    m_pQuantizeEnabled = ControlObject::getControl(ConfigKey(group, "quantize"));
-    m_pSlipEnabled = ControlObject::getControl(ConfigKey(group, "slip_enabled"));
+    m_pQuantizeEnabled = ControlObject::getControl(ConfigKey(group, QStringLiteral("quantize")));
+    m_pSlipEnabled = ControlObject::getControl(ConfigKey(group, QStringLiteral("slip_enabled")));
 
     // DEPRECATED: Use beatloop_size and beatloop_set instead.
     // Activates a beatloop of a specified number of beats.
-    m_pCOBeatLoop = new ControlObject(ConfigKey(group, "beatloop"), false);
+    m_pCOBeatLoop = new ControlObject(ConfigKey(group, QStringLiteral("beatloop")), false);
     connect(
             m_pCOBeatLoop,
             &ControlObject::valueChanged,
             this,
             [this](double value) { slotBeatLoop(value); },
             Qt::DirectConnection);
-    m_pCOLoopAnchor = new ControlPushButton(ConfigKey(group, "loop_anchor"),
+    m_pCOLoopAnchor = new ControlPushButton(ConfigKey(group, QStringLiteral("loop_anchor")),
             true,
             static_cast<double>(LoopAnchorPoint::Start));
     m_pCOLoopAnchor->setButtonMode(mixxx::control::ButtonMode::Toggle);
 
-    m_pCOBeatLoopSize = new ControlObject(ConfigKey(group, "beatloop_size"),
+    m_pCOBeatLoopSize = new ControlObject(ConfigKey(group, QStringLiteral("beatloop_size")),
                                           true, false, false, 4.0);
     m_pCOBeatLoopSize->connectValueChangeRequest(this,
             &LoopingControl::slotBeatLoopSizeChangeRequest, Qt::DirectConnection);
-    m_pCOBeatLoopActivate = new ControlPushButton(ConfigKey(group, "beatloop_activate"));
+    m_pCOBeatLoopActivate = new ControlPushButton(ConfigKey(group, QStringLiteral("beatloop_activate")));
     connect(m_pCOBeatLoopActivate, &ControlObject::valueChanged,
             this, &LoopingControl::slotBeatLoopToggle);
-    m_pCOBeatLoopRollActivate = new ControlPushButton(ConfigKey(group, "beatlooproll_activate"));
+    m_pCOBeatLoopRollActivate = new ControlPushButton(
+            ConfigKey(group, QStringLiteral("beatlooproll_activate")));
     connect(m_pCOBeatLoopRollActivate, &ControlObject::valueChanged,
             this, &LoopingControl::slotBeatLoopRollActivate);
 
@@ -166,36 +167,49 @@ LoopingControl::LoopingControl(const QString& group,
         connect(pBeatLoop,  &BeatLoopingControl::deactivateBeatLoopRoll,
                 this, &LoopingControl::slotBeatLoopDeactivateRoll,
                 Qt::DirectConnection);
+        connect(pBeatLoop,
+                &BeatLoopingControl::activeChanged,
+                this,
+                &LoopingControl::slotUpdateBeatLoopActiveBits,
+                Qt::DirectConnection);
         m_beatLoops.append(pBeatLoop);
     }
 
-    m_pCOBeatJump = new ControlObject(ConfigKey(group, "beatjump"), false);
+    // One bit per entry of s_dBeatSizes, so the sizes must fit into the
+    // integer-exact range of the control's double value.
+    static_assert(sizeof(s_dBeatSizes) / sizeof(s_dBeatSizes[0]) <= 53);
+    m_pCOBeatLoopActiveBits = new ControlObject(
+            ConfigKey(group, QStringLiteral("beatloop_active_bits")));
+    m_pCOBeatLoopActiveBits->setReadOnly();
+
+    m_pCOBeatJump = new ControlObject(ConfigKey(group, QStringLiteral("beatjump")), false);
     connect(m_pCOBeatJump, &ControlObject::valueChanged,
             this, &LoopingControl::slotBeatJump, Qt::DirectConnection);
-    m_pCOBeatJumpSize = new ControlObject(ConfigKey(group, "beatjump_size"),
+    m_pCOBeatJumpSize = new ControlObject(ConfigKey(group, QStringLiteral("beatjump_size")),
                                           true, false, false, 4.0);
     m_pCOBeatJumpSize->connectValueChangeRequest(this,
             &LoopingControl::slotBeatJumpSizeChangeRequest,
             Qt::DirectConnection);
 
-    m_pCOBeatJumpSizeHalve = new ControlPushButton(ConfigKey(group, "beatjump_size_halve"));
+    m_pCOBeatJumpSizeHalve = new ControlPushButton(ConfigKey(group, QStringLiteral("beatjump_size_halve")));
     m_pCOBeatJumpSizeHalve->setKbdRepeatable(true);
     connect(m_pCOBeatJumpSizeHalve,
             &ControlObject::valueChanged,
             this,
             &LoopingControl::slotBeatJumpSizeHalve);
-    m_pCOBeatJumpSizeDouble = new ControlPushButton(ConfigKey(group, "beatjump_size_double"));
+    m_pCOBeatJumpSizeDouble = new ControlPushButton(
+            ConfigKey(group, QStringLiteral("beatjump_size_double")));
     m_pCOBeatJumpSizeDouble->setKbdRepeatable(true);
     connect(m_pCOBeatJumpSizeDouble,
             &ControlObject::valueChanged,
             this,
             &LoopingControl::slotBeatJumpSizeDouble);
 
-    m_pCOBeatJumpForward = new ControlPushButton(ConfigKey(group, "beatjump_forward"));
+    m_pCOBeatJumpForward = new ControlPushButton(ConfigKey(group, QStringLiteral("beatjump_forward")));
     m_pCOBeatJumpForward->setKbdRepeatable(true);
     connect(m_pCOBeatJumpForward, &ControlObject::valueChanged,
             this, &LoopingControl::slotBeatJumpForward);
-    m_pCOBeatJumpBackward = new ControlPushButton(ConfigKey(group, "beatjump_backward"));
+    m_pCOBeatJumpBackward = new ControlPushButton(ConfigKey(group, QStringLiteral("beatjump_backward")));
     m_pCOBeatJumpBackward->setKbdRepeatable(true);
     connect(m_pCOBeatJumpBackward, &ControlObject::valueChanged,
             this, &LoopingControl::slotBeatJumpBackward);
@@ -210,7 +224,7 @@ LoopingControl::LoopingControl(const QString& group,
         m_beatJumps.append(pBeatJump);
     }
 
-    m_pCOLoopMove = new ControlObject(ConfigKey(group, "loop_move"), false);
+    m_pCOLoopMove = new ControlObject(ConfigKey(group, QStringLiteral("loop_move")), false);
     connect(m_pCOLoopMove, &ControlObject::valueChanged,
             this, &LoopingControl::slotLoopMove, Qt::DirectConnection);
 
@@ -224,28 +238,28 @@ LoopingControl::LoopingControl(const QString& group,
         m_loopMoves.append(pLoopMove);
     }
 
-    m_pCOLoopScale = new ControlObject(ConfigKey(group, "loop_scale"), false);
+    m_pCOLoopScale = new ControlObject(ConfigKey(group, QStringLiteral("loop_scale")), false);
     connect(m_pCOLoopScale, &ControlObject::valueChanged,
             this, &LoopingControl::slotLoopScale);
-    m_pLoopHalveButton = new ControlPushButton(ConfigKey(group, "loop_halve"));
+    m_pLoopHalveButton = new ControlPushButton(ConfigKey(group, QStringLiteral("loop_halve")));
     m_pLoopHalveButton->setKbdRepeatable(true);
     connect(m_pLoopHalveButton, &ControlObject::valueChanged,
             this, &LoopingControl::slotLoopHalve);
-    m_pLoopDoubleButton = new ControlPushButton(ConfigKey(group, "loop_double"));
+    m_pLoopDoubleButton = new ControlPushButton(ConfigKey(group, QStringLiteral("loop_double")));
     m_pLoopDoubleButton->setKbdRepeatable(true);
     connect(m_pLoopDoubleButton, &ControlObject::valueChanged,
             this, &LoopingControl::slotLoopDouble);
 
-    m_pLoopRemoveButton = new ControlPushButton(ConfigKey(group, "loop_remove"));
+    m_pLoopRemoveButton = new ControlPushButton(ConfigKey(group, QStringLiteral("loop_remove")));
     m_pLoopRemoveButton->setButtonMode(mixxx::control::ButtonMode::Trigger);
     connect(m_pLoopRemoveButton,
             &ControlObject::valueChanged,
             this,
             &LoopingControl::slotLoopRemove);
 
-    m_pPlayButton = ControlObject::getControl(ConfigKey(group, "play"));
+    m_pPlayButton = ControlObject::getControl(ConfigKey(group, QStringLiteral("play")));
 
-    m_pRepeatButton = ControlObject::getControl(ConfigKey(group, "repeat"));
+    m_pRepeatButton = ControlObject::getControl(ConfigKey(group, QStringLiteral("repeat")));
 }
 
 LoopingControl::~LoopingControl() {
@@ -271,6 +285,7 @@ LoopingControl::~LoopingControl() {
         delete pBeatLoop;
     }
     delete m_pCOBeatLoopSize;
+    delete m_pCOBeatLoopActiveBits;
     delete m_pCOLoopAnchor;
     delete m_pCOBeatLoopActivate;
     delete m_pCOBeatLoopRollActivate;
@@ -721,7 +736,8 @@ void LoopingControl::setLoopInToCurrentPosition() {
     if (quantizeEnabledAndHasTrueTrackBeats()) {
         mixxx::audio::FramePos prevBeatPosition;
         mixxx::audio::FramePos nextBeatPosition;
-        if (pBeats->findPrevNextBeats(position, &prevBeatPosition, &nextBeatPosition, false)) {
+        if (m_beatCursor.findPrevNextBeats(
+                    pBeats, position, &prevBeatPosition, &nextBeatPosition, false)) {
             // both beat positions are valid
             mixxx::audio::FramePos closestBeatPosition =
                     (nextBeatPosition - position > position - prevBeatPosition)
@@ -881,7 +897,8 @@ void LoopingControl::setLoopOutToCurrentPosition() {
     if (quantizeEnabledAndHasTrueTrackBeats()) {
         mixxx::audio::FramePos prevBeatPosition;
         mixxx::audio::FramePos nextBeatPosition;
-        if (pBeats->findPrevNextBeats(position, &prevBeatPosition, &nextBeatPosition, false)) {
+        if (m_beatCursor.findPrevNextBeats(
+                    pBeats, position, &prevBeatPosition, &nextBeatPosition, false)) {
             // both beat positions are valid
             const mixxx::audio::FramePos closestBeatPosition =
                     (nextBeatPosition - position > position - prevBeatPosition)
@@ -1432,6 +1449,16 @@ double LoopingControl::findBeatloopSizeForLoop(
     return -1;
 }
 
+void LoopingControl::slotUpdateBeatLoopActiveBits() {
+    quint64 bits = 0;
+    for (int i = 0; i < m_beatLoops.size(); ++i) {
+        if (m_beatLoops[i]->isActive()) {
+            bits |= quint64(1) << i;
+        }
+    }
+    m_pCOBeatLoopActiveBits->forceSet(static_cast<double>(bits));
+}
+
 void LoopingControl::updateBeatLoopingControls() {
     // O(n) search, but there are only ~10-ish beatloop controls so this is
     // fine.
@@ -1461,7 +1488,11 @@ mixxx::audio::FramePos LoopingControl::findQuantizedBeatloopStart(
     // The closest beat might be ahead of play position and will cause a catching loop.
     mixxx::audio::FramePos prevBeatPosition;
     mixxx::audio::FramePos nextBeatPosition;
-    if (!pBeats->findPrevNextBeats(currentPosition, &prevBeatPosition, &nextBeatPosition, false)) {
+    if (!m_beatCursor.findPrevNextBeats(pBeats,
+                currentPosition,
+                &prevBeatPosition,
+                &nextBeatPosition,
+                false)) {
         return currentPosition;
     }
 
@@ -1836,7 +1867,8 @@ void LoopingControl::slotLoopMove(double beats) {
                 nullptr,
                 nullptr,
                 nullptr,
-                nullptr)) {
+                nullptr,
+                &m_beatCursor)) {
         const auto newLoopStartPosition =
                 pBeats->findNBeatsFromPosition(loopInfo.startPosition, beats);
         const auto newLoopEndPosition = currentLoopMatchesBeatloopSize(loopInfo)
@@ -2114,6 +2146,7 @@ void BeatLoopingControl::deactivate() {
         m_bActive = false;
         m_pEnabled->forceSet(0);
         m_pLegacy->set(0);
+        emit activeChanged();
     }
 }
 
@@ -2122,6 +2155,7 @@ void BeatLoopingControl::activate() {
         m_bActive = true;
         m_pEnabled->forceSet(1);
         m_pLegacy->set(1);
+        emit activeChanged();
     }
 }
 
@@ -158,6 +158,7 @@ class LoopingControl : public EngineControl {
 
   private slots:
     void slotLoopEnabledValueChangeRequest(double enabled);
+    void slotUpdateBeatLoopActiveBits();
 
   private:
     void setLoopingEnabled(bool enabled);
@@ -248,6 +249,11 @@ class LoopingControl : public EngineControl {
     static double s_dBeatSizes[];
     // Array of BeatLoopingControls, one for each size.
     QList<BeatLoopingControl*> m_beatLoops;
+    // Packed bitfield of all beatloop_X_enabled states: bit i corresponds
+    // to s_dBeatSizes[i] (the order returned by getBeatSizes()). Lets
+    // controller mappings with loop-size LED pages read one control per
+    // deck and tick instead of one per size.
+    ControlObject* m_pCOBeatLoopActiveBits;
 
     ControlObject* m_pCOBeatJump;
     ControlObject* m_pCOBeatJumpSize;
@@ -263,6 +269,9 @@ class LoopingControl : public EngineControl {
     // objects below are written from an engine worker thread
     TrackPointer m_pTrack;
     mixxx::BeatsPointer m_pBeats;
+    // Caches the beat interval of the last lookup, only used from the
+    // engine thread
+    mutable mixxx::Beats::Cursor m_beatCursor;
     // Flag that allows to act quantized only if we have true track beats.
     // See quantizeEnabledAndHasTrueTrackBeats()
     bool m_trueTrackBeats;
@@ -324,6 +333,9 @@ class BeatLoopingControl : public QObject {
     inline double getSize() {
         return m_dBeatLoopSize;
     }
+    inline bool isActive() const {
+        return m_bActive;
+    }
   public slots:
     void slotLegacy(double value);
     void slotActivate(double value, LoopingControl::LoopAnchorPoint forcedAnchor);
@@ -339,6 +351,9 @@ class BeatLoopingControl : public QObject {
     void deactivateBeatLoop(BeatLoopingControl*);
     void activateBeatLoopRoll(BeatLoopingControl*, LoopingControl::LoopAnchorPoint forcedAnchor);
     void deactivateBeatLoopRoll(BeatLoopingControl*);
+    // Emitted whenever the beatloop_X_enabled state of this size flips,
+    // see LoopingControl::slotUpdateBeatLoopActiveBits().
+    void activeChanged();
 
   private:
     double m_dBeatLoopSize;
@@ -0,0 +1,199 @@
+#include "engine/controls/macrocontrol.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include <QHash>
+
+#include "control/controlobject.h"
+#include "control/controlpushbutton.h"
+#include "moc_macrocontrol.cpp"
+#include "track/track.h"
+#include "util/compatibility/qmutex.h"
+
+namespace {
+
+// Registry of all MacroControl instances by deck group, used by the
+// controller script interface to hand over compiled programs.
+QMutex s_registryLock;
+QHash<QString, MacroControl*> s_registry;
+
+} // namespace
+
+MacroControl::MacroControl(const QString& group, UserSettingsPointer pConfig)
+        : EngineControl(group, pConfig),
+          m_pCOMacroRunning(std::make_unique<ControlObject>(
+                  ConfigKey(group, QStringLiteral("macro_running")))),
+          m_pMacroStop(std::make_unique<ControlPushButton>(
+                  ConfigKey(group, QStringLiteral("macro_stop")))),
+          m_running(false),
+          m_nextStepIndex(0),
+          m_beatsElapsed(0.0),
+          m_lastPosition(mixxx::audio::kStartFramePos),
+          m_prevBeatPosition(mixxx::audio::kInvalidFramePos),
+          m_nextBeatPosition(mixxx::audio::kInvalidFramePos) {
+    m_pCOMacroRunning->setReadOnly();
+    m_pCOMacroRunning->forceSet(0.0);
+    connect(m_pMacroStop.get(),
+            &ControlObject::valueChanged,
+            this,
+            &MacroControl::slotMacroStop,
+            Qt::DirectConnection);
+
+    const auto locked = lockMutex(&s_registryLock);
+    s_registry.insert(group, this);
+}
+
+MacroControl::~MacroControl() {
+    const auto locked = lockMutex(&s_registryLock);
+    if (s_registry.value(m_group) == this) {
+        s_registry.remove(m_group);
+    }
+}
+
+// static
+MacroControl* MacroControl::forGroup(const QString& group) {
+    const auto locked = lockMutex(&s_registryLock);
+    return s_registry.value(group, nullptr);
+}
+
+void MacroControl::startMacro(MacroProgram program) {
+    std::stable_sort(program.steps.begin(),
+            program.steps.end(),
+            [](const MacroStep& lhs, const MacroStep& rhs) {
+                return lhs.beatOffset < rhs.beatOffset;
+            });
+    const auto locked = lockMutex(&m_pendingLock);
+    m_pendingProgram = std::move(program);
+    m_hasPendingProgram.storeRelease(1);
+}
+
+void MacroControl::stopMacro() {
+    {
+        const auto locked = lockMutex(&m_pendingLock);
+        m_pendingProgram.steps.clear();
+        m_hasPendingProgram.storeRelease(0);
+    }
+    m_stopRequested.storeRelease(1);
+}
+
+void MacroControl::slotMacroStop(double value) {
+    if (value > 0) {
+        stopMacro();
+    }
+}
+
+// called from an engine worker thread
+void MacroControl::trackLoaded(TrackPointer pNewTrack) {
+    mixxx::BeatsPointer pBeats;
+    if (pNewTrack) {
+        pBeats = pNewTrack->getBeats();
+    }
+    trackBeatsUpdated(pBeats);
+    // A macro scheduled against the previous track's beat grid must not
+    // keep firing into the new track.
+    m_stopRequested.storeRelease(1);
+}
+
+void MacroControl::trackBeatsUpdated(mixxx::BeatsPointer pBeats) {
+    m_pBeats = pBeats;
+}
+
+void MacroControl::notifySeek(mixxx::audio::FramePos position) {
+    // Seeks are instantaneous and must not advance the musical clock,
+    // otherwise macros that jump backwards (rolls, stutters) would stall
+    // or rush. Re-anchor the played distance measurement instead.
+    m_lastPosition = position;
+    m_prevBeatPosition = mixxx::audio::kInvalidFramePos;
+    m_nextBeatPosition = mixxx::audio::kInvalidFramePos;
+}
+
+void MacroControl::process(const double rate,
+        mixxx::audio::FramePos currentPosition,
+        const std::size_t bufferSize) {
+    Q_UNUSED(rate);
+    Q_UNUSED(bufferSize);
+
+    if (m_stopRequested.fetchAndStoreAcquire(0)) {
+        m_running = false;
+        // clear() keeps the capacity, no allocation happens here
+        m_activeProgram.steps.clear();
+        m_pCOMacroRunning->forceSet(0.0);
+    }
+
+    // Pick up a program handed over by the controller thread. tryLock
+    // keeps the engine callback from blocking on the handover mutex, a
+    // missed attempt is retried on the next callback.
+    if (m_hasPendingProgram.loadAcquire() && m_pendingLock.tryLock()) {
+        m_activeProgram.steps.swap(m_pendingProgram.steps);
+        m_activeProgram.loopLengthBeats = m_pendingProgram.loopLengthBeats;
+        m_pendingProgram.steps.clear();
+        m_hasPendingProgram.storeRelease(0);
+        m_pendingLock.unlock();
+        m_nextStepIndex = 0;
+        m_beatsElapsed = 0.0;
+        m_lastPosition = currentPosition;
+        m_prevBeatPosition = mixxx::audio::kInvalidFramePos;
+        m_nextBeatPosition = mixxx::audio::kInvalidFramePos;
+        m_running = !m_activeProgram.steps.isEmpty();
+        m_pCOMacroRunning->forceSet(m_running ? 1.0 : 0.0);
+    }
+
+    if (!m_running) {
+        return;
+    }
+    const mixxx::BeatsPointer pBeats = m_pBeats;
+    if (!pBeats) {
+        // Without a beat grid there is no musical time to schedule against.
+        return;
+    }
+
+    // Advance the musical clock by the distance played since the last
+    // callback, measured in lengths of the local beat. Seeks re-anchor
+    // m_lastPosition in notifySeek() and do not contribute.
+    if (currentPosition != m_lastPosition) {
+        if (!m_prevBeatPosition.isValid() || !m_nextBeatPosition.isValid() ||
+                currentPosition >= m_nextBeatPosition ||
+                currentPosition <= m_prevBeatPosition) {
+            m_beatCursor.findPrevNextBeats(pBeats,
+                    currentPosition,
+                    &m_prevBeatPosition,
+                    &m_nextBeatPosition,
+                    false); // Precise compare without tolerance needed
+        }
+        if (m_prevBeatPosition.isValid() && m_nextBeatPosition.isValid() &&
+                m_nextBeatPosition > m_prevBeatPosition) {
+            const mixxx::audio::FrameDiff_t framesPerBeat =
+                    m_nextBeatPosition - m_prevBeatPosition;
+            m_beatsElapsed +=
+                    fabs(currentPosition - m_lastPosition) / framesPerBeat;
+        }
+        m_lastPosition = currentPosition;
+    }
+
+    // Wrap completed iterations of a looping program. The wrap must only
+    // happen once the full iteration length has played, otherwise a step
+    // at offset 0 would re-fire on every callback.
+    if (m_nextStepIndex >= m_activeProgram.steps.size() &&
+            m_activeProgram.loopLengthBeats > 0 &&
+            m_beatsElapsed >= m_activeProgram.loopLengthBeats) {
+        m_beatsElapsed = fmod(m_beatsElapsed, m_activeProgram.loopLengthBeats);
+        m_nextStepIndex = 0;
+    }
+
+    // Fire all steps that are due by now
+    while (m_nextStepIndex < m_activeProgram.steps.size() &&
+            m_activeProgram.steps.at(m_nextStepIndex).beatOffset <=
+                    m_beatsElapsed) {
+        const MacroStep& step = m_activeProgram.steps.at(m_nextStepIndex);
+        step.pControl->set(step.value);
+        ++m_nextStepIndex;
+    }
+
+    if (m_nextStepIndex >= m_activeProgram.steps.size() &&
+            m_activeProgram.loopLengthBeats <= 0) {
+        // One-shot program completed
+        m_running = false;
+        m_pCOMacroRunning->forceSet(0.0);
+    }
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <QMutex>
+#include <QString>
+#include <QVector>
+#include <memory>
+
+#include "audio/frame.h"
+#include "engine/controls/enginecontrol.h"
+#include "preferences/usersettings.h"
+#include "track/beats.h"
+#include "track/track_decl.h"
+
+class ControlObject;
+class ControlPushButton;
+
+/// A single step of a compiled macro program. The referenced control is
+/// set to the given value once playback has musically advanced beatOffset
+/// beats since the macro (or the current loop iteration) was started.
+struct MacroStep {
+    double beatOffset;
+    ControlObject* pControl;
+    double value;
+};
+
+/// A macro program compiled from a declarative step sequence. Steps are
+/// sorted by ascending beat offset before execution.
+struct MacroProgram {
+    QVector<MacroStep> steps;
+    /// Length of one iteration in beats. If greater than zero the program
+    /// restarts after this many beats until it is stopped explicitly or a
+    /// new track is loaded, otherwise it runs once.
+    double loopLengthBeats;
+};
+
+/// Executes compiled macro programs inside the engine callback. Controller
+/// scripts hand over a program via startMacro() and the steps then fire
+/// with buffer accuracy against the local beat grid, without the timer
+/// granularity and message latency of per-step script callbacks. Seeks
+/// (including beat jumps triggered by the macro itself) are treated as
+/// instantaneous and do not advance the musical clock, so jump-back rolls
+/// and stutters keep their programmed timing.
+class MacroControl : public EngineControl {
+    Q_OBJECT
+  public:
+    MacroControl(const QString& group,
+            UserSettingsPointer pConfig);
+    ~MacroControl() override;
+
+    /// Looks up the MacroControl of a deck group.
+    /// Returns nullptr if the group has none.
+    static MacroControl* forGroup(const QString& group);
+
+    /// Schedules a program for execution. The program is picked up by the
+    /// next engine callback and replaces a currently running program.
+    /// May be called from any thread.
+    void startMacro(MacroProgram program);
+
+    /// Requests the running and any pending program to be stopped.
+    /// May be called from any thread.
+    void stopMacro();
+
+    void process(const double rate,
+            mixxx::audio::FramePos currentPosition,
+            const std::size_t bufferSize) override;
+    void trackLoaded(TrackPointer pNewTrack) override;
+    void trackBeatsUpdated(mixxx::BeatsPointer pBeats) override;
+    void notifySeek(mixxx::audio::FramePos position) override;
+
+  private slots:
+    void slotMacroStop(double value);
+
+  private:
+    std::unique_ptr<ControlObject> m_pCOMacroRunning;
+    std::unique_ptr<ControlPushButton> m_pMacroStop;
+
+    // m_pBeats is written from an engine worker thread
+    mixxx::BeatsPointer m_pBeats;
+
+    // Program handed over from the controller thread, guarded by
+    // m_pendingLock. The engine callback only ever tryLocks the mutex.
+    QMutex m_pendingLock;
+    MacroProgram m_pendingProgram;
+    QAtomicInt m_hasPendingProgram;
+    QAtomicInt m_stopRequested;
+
+    // Execution state, only touched by the engine callback.
+    MacroProgram m_activeProgram;
+    bool m_running;
+    int m_nextStepIndex;
+    // Beats played since the current (loop iteration of the) program
+    // started, advanced by the played distance relative to the local
+    // beat length.
+    double m_beatsElapsed;
+    mixxx::audio::FramePos m_lastPosition;
+    mixxx::audio::FramePos m_prevBeatPosition;
+    mixxx::audio::FramePos m_nextBeatPosition;
+    // Caches the beat interval of the last lookup, only used from the
+    // engine thread
+    mixxx::Beats::Cursor m_beatCursor;
+};
@@ -108,6 +108,7 @@ RateControl::RateControl(const QString& group, UserSettingsPointer pConfig)
           m_wrapAroundCount(0),
           m_jumpPos(mixxx::audio::FramePos()),
           m_targetPos(mixxx::audio::FramePos()),
+          m_rampDirection(RampDirection::None),
           m_bTempStarted(false),
           m_tempRateRatio(0.0),
           m_dRateTempRampChange(0.0) {
@@ -199,6 +200,30 @@ RateControl::RateControl(const QString& group, UserSettingsPointer pConfig)
             &RateControl::slotControlRatePermUpSmall,
             Qt::DirectConnection);
 
+    // Temporary rate-change buttons. The active ramp direction is tracked
+    // event-driven so that the engine callback does not have to poll all
+    // four buttons, see processTempRate().
+    connect(m_pButtonRateTempDown.get(),
+            &ControlObject::valueChanged,
+            this,
+            &RateControl::slotRateTempButtonChanged,
+            Qt::DirectConnection);
+    connect(m_pButtonRateTempDownSmall.get(),
+            &ControlObject::valueChanged,
+            this,
+            &RateControl::slotRateTempButtonChanged,
+            Qt::DirectConnection);
+    connect(m_pButtonRateTempUp.get(),
+            &ControlObject::valueChanged,
+            this,
+            &RateControl::slotRateTempButtonChanged,
+            Qt::DirectConnection);
+    connect(m_pButtonRateTempUpSmall.get(),
+            &ControlObject::valueChanged,
+            this,
+            &RateControl::slotRateTempButtonChanged,
+            Qt::DirectConnection);
+
     // Scratch enable toggle
     m_pScratch2Enable->set(0);
 
@@ -369,6 +394,22 @@ void RateControl::slotControlRatePermUpSmall(double v) {
     }
 }
 
+void RateControl::slotRateTempButtonChanged(double) {
+    // Evaluate the buttons in the same priority order as the former
+    // polling code in processTempRate.
+    RampDirection rampDirection = RampDirection::None;
+    if (m_pButtonRateTempUp->toBool()) {
+        rampDirection = RampDirection::Up;
+    } else if (m_pButtonRateTempDown->toBool()) {
+        rampDirection = RampDirection::Down;
+    } else if (m_pButtonRateTempUpSmall->toBool()) {
+        rampDirection = RampDirection::UpSmall;
+    } else if (m_pButtonRateTempDownSmall->toBool()) {
+        rampDirection = RampDirection::DownSmall;
+    }
+    m_rampDirection.store(rampDirection, std::memory_order_relaxed);
+}
+
 double RateControl::getWheelFactor() const {
     return m_pWheel->get();
 }
@@ -520,16 +561,11 @@ void RateControl::processTempRate(const std::size_t bufferSamples) {
     // We support two behaviors, the standard ramped pitch bending
     // and pitch shift stepping, which is the old behavior.
 
-    RampDirection rampDirection = RampDirection::None;
-    if (m_pButtonRateTempUp->toBool()) {
-        rampDirection = RampDirection::Up;
-    } else if (m_pButtonRateTempDown->toBool()) {
-        rampDirection = RampDirection::Down;
-    } else if (m_pButtonRateTempUpSmall->toBool()) {
-        rampDirection = RampDirection::UpSmall;
-    } else if (m_pButtonRateTempDownSmall->toBool()) {
-        rampDirection = RampDirection::DownSmall;
-    }
+    // The active ramp direction is updated event-driven by
+    // slotRateTempButtonChanged, so the common case of no bend button
+    // being held costs a single atomic read here.
+    const RampDirection rampDirection =
+            m_rampDirection.load(std::memory_order_relaxed);
 
     if (rampDirection != RampDirection::None) {
         if (m_eRateRampMode == RampMode::Stepping) {
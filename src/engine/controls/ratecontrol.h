@@ -1,6 +1,7 @@
 #pragma once
 
 #include <QObject>
+#include <atomic>
 
 #include "control/pollingcontrolproxy.h"
 #include "engine/controls/enginecontrol.h"
@@ -88,6 +89,7 @@ public slots:
   void slotControlRatePermDownSmall(double);
   void slotControlRatePermUp(double);
   void slotControlRatePermUpSmall(double);
+  void slotRateTempButtonChanged(double);
   void slotControlFastForward(double);
   void slotControlFastBack(double);
 
@@ -160,6 +162,11 @@ private:
   mixxx::audio::FramePos m_jumpPos;
   mixxx::audio::FramePos m_targetPos;
 
+  // The currently active ramp direction. Updated event-driven by
+  // slotRateTempButtonChanged when one of the temporary rate-change
+  // buttons changes, so that the engine callback only has to perform a
+  // single atomic read instead of polling all four buttons.
+  std::atomic<RampDirection> m_rampDirection;
   // This is true if we've already started to ramp the rate
   bool m_bTempStarted;
   // Set the Temporary Rate Change Mode
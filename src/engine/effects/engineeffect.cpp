@@ -5,6 +5,7 @@
 #include "engine/engine.h"
 #include "util/defs.h"
 #include "util/sample.h"
+#include "util/timer.h"
 
 namespace {
 
@@ -117,12 +118,39 @@ bool EngineEffect::processEffectsRequest(const EffectsRequest& message,
         }
         pResponsePipe->writeMessage(response);
         return true;
+    case EffectsRequest::SET_PARAMETER_RAMP:
+        if (kEffectDebugOutput) {
+            qDebug() << debugString() << "SET_PARAMETER_RAMP"
+                     << "parameter" << message.SetParameterRamp.iParameter
+                     << "start" << message.SetParameterRamp.startValue
+                     << "target" << message.value
+                     << "duration" << message.SetParameterRamp.rampDurationFrames;
+        }
+        pParameter = m_parameters.value(
+                message.SetParameterRamp.iParameter, EngineEffectParameterPointer());
+        if (pParameter) {
+            pParameter->startRamp(message.SetParameterRamp.startValue,
+                    message.value,
+                    message.SetParameterRamp.rampDurationFrames);
+            response.success = true;
+        } else {
+            response.success = false;
+            response.status = EffectsResponse::NO_SUCH_PARAMETER;
+        }
+        pResponsePipe->writeMessage(response);
+        return true;
     default:
         break;
     }
     return false;
 }
 
+void EngineEffect::advanceParameterRamps(std::size_t numFrames) {
+    for (const auto& pParameter : std::as_const(m_parameters)) {
+        pParameter->advanceRamp(static_cast<double>(numFrames));
+    }
+}
+
 bool EngineEffect::process(const ChannelHandle& inputHandle,
         const ChannelHandle& outputHandle,
         const CSAMPLE* pInput,
@@ -182,6 +210,13 @@ bool EngineEffect::process(const ChannelHandle& inputHandle,
                 sampleRate,
                 numSamples / mixxx::kEngineChannelOutputCount);
 
+        // Account the DSP cost per effect. The samples are aggregated
+        // off the audio thread by the StatsManager and show up in the
+        // developer stats, which makes it easy to spot the effect that
+        // eats the callback budget.
+        ScopedTimer processTimer(
+                QStringLiteral("EngineEffect::process %1"), name());
+
         m_pProcessor->process(inputHandle,
                 outputHandle,
                 pInput,
@@ -11,6 +11,7 @@
 #include "effects/backends/effectprocessor.h"
 #include "engine/channelhandle.h"
 #include "engine/effects/message.h"
+#include "util/realtimesafety.h"
 #include "util/types.h"
 
 /// EngineEffect is a generic wrapper around an EffectProcessor which intermediates
@@ -37,6 +38,10 @@ class EngineEffect final : public EffectsRequestHandler {
             const EffectsRequest& message,
             EffectsResponsePipe* pResponsePipe) override;
 
+    /// Called in audio thread once per callback, before any channel is
+    /// processed, to advance scheduled parameter ramps by numFrames frames.
+    void advanceParameterRamps(std::size_t numFrames);
+
     /// Called in audio thread
     bool process(const ChannelHandle& inputHandle,
             const ChannelHandle& outputHandle,
@@ -45,7 +50,7 @@ class EngineEffect final : public EffectsRequestHandler {
             const std::size_t numSamples,
             const mixxx::audio::SampleRate sampleRate,
             const EffectEnableState chainEnableState,
-            const GroupFeatureState& groupFeatures);
+            const GroupFeatureState& groupFeatures) MIXXX_RT_NONBLOCKING;
 
     const EffectManifestPointer getManifest() const {
         return m_pManifest;
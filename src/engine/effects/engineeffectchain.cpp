@@ -1,6 +1,7 @@
 #include "engine/effects/engineeffectchain.h"
 
 #include "engine/effects/engineeffect.h"
+#include "engine/enginecallbackarena.h"
 #include "util/defs.h"
 #include "util/sample.h"
 
@@ -11,8 +12,9 @@ EngineEffectChain::EngineEffectChain(const QString& group,
           m_enableState(true),
           m_mixMode(EffectChainMixMode::DrySlashWet),
           m_dMix(0),
-          m_buffer1(kMaxEngineSamples),
-          m_buffer2(kMaxEngineSamples) {
+          m_scrubbedSampleCounter(
+                  QStringLiteral("EngineEffectChain(%1) scrubbed samples")
+                          .arg(group)) {
     // Try to prevent memory allocation.
     m_effects.reserve(256);
 
@@ -173,7 +175,8 @@ bool EngineEffectChain::process(const ChannelHandle& inputHandle,
         const std::size_t numSamples,
         const mixxx::audio::SampleRate sampleRate,
         const GroupFeatureState& groupFeatures,
-        bool fadeout) {
+        bool fadeout,
+        bool mixIntoOutput) {
     DEBUG_ASSERT(numSamples <= kMaxEngineSamples);
 
     // Compute the effective enable state from the channel input routing switch and
@@ -217,6 +220,12 @@ bool EngineEffectChain::process(const ChannelHandle& inputHandle,
         // after writing to the output buffer. This requires not to use the same buffer
         // for in and output: Also, ChannelMixer::applyEffectsAndMixChannels
         // requires that the input buffer does not get modified.
+        EngineCallbackArena::Scope arenaScope;
+        CSAMPLE* pBuffer1 = arenaScope.allocate(static_cast<SINT>(numSamples));
+        CSAMPLE* pBuffer2 = arenaScope.allocate(static_cast<SINT>(numSamples));
+        VERIFY_OR_DEBUG_ASSERT(pBuffer1 && pBuffer2) {
+            return false;
+        }
         CSAMPLE* pIntermediateInput = pIn;
         CSAMPLE* pIntermediateOutput;
         SINT effectChainGroupDelayFrames = 0;
@@ -225,10 +234,10 @@ bool EngineEffectChain::process(const ChannelHandle& inputHandle,
         for (EngineEffect* pEffect : std::as_const(m_effects)) {
             if (pEffect != nullptr) {
                 // Select an unused intermediate buffer for the next output
-                if (pIntermediateInput == m_buffer1.data()) {
-                    pIntermediateOutput = m_buffer2.data();
+                if (pIntermediateInput == pBuffer1) {
+                    pIntermediateOutput = pBuffer2;
                 } else {
-                    pIntermediateOutput = m_buffer1.data();
+                    pIntermediateOutput = pBuffer1;
                 }
 
                 if (pEffect->process(inputHandle,
@@ -254,9 +263,9 @@ bool EngineEffectChain::process(const ChannelHandle& inputHandle,
                                 m_mixMode == EffectChainMixMode::DryPlusWet;
 
                         if (!skipAddingDry) {
-                            for (SINT i = 0; i <= static_cast<SINT>(numSamples); ++i) {
-                                pIntermediateOutput[i] += pIntermediateInput[i];
-                            }
+                            SampleUtil::add(pIntermediateOutput,
+                                    pIntermediateInput,
+                                    static_cast<SINT>(numSamples));
                         }
 
                         firstAddDryToWetEffectProcessed = true;
@@ -275,26 +284,45 @@ bool EngineEffectChain::process(const ChannelHandle& inputHandle,
         m_effectsDelay.process(pIn, numSamples);
 
         if (processingOccured) {
+            // Scrub the wet output once at the chain boundary. The audio
+            // threads run with denormals flushed to zero, but a NaN or
+            // infinity escaping from a buggy effect would propagate into the
+            // mix and into the delay lines of downstream effects forever.
+            // The counter identifies the offending chain in the stats.
+            const SINT scrubbed = SampleUtil::scrubDenormalsAndNaNs(
+                    pIntermediateInput, static_cast<SINT>(numSamples));
+            if (scrubbed > 0) {
+                m_scrubbedSampleCounter.increment(static_cast<int>(scrubbed));
+            }
+
             // pIntermediateInput is the output of the last processed effect. It would be the
             // intermediate input of the next effect if there was one.
+            // Dry/Wet mode: output = (input * (1-mix knob)) + (wet * mix knob)
+            // Dry+Wet mode: output = input + (wet * mix knob)
+            CSAMPLE_GAIN dryGainIn = 1.0f;
+            CSAMPLE_GAIN dryGainOut = 1.0f;
             if (m_mixMode == EffectChainMixMode::DrySlashWet) {
-                // Dry/Wet mode: output = (input * (1-mix knob)) + (wet * mix knob)
-                SampleUtil::copy2WithRampingGain(
+                dryGainIn = 1.0f - lastCallbackMixKnob;
+                dryGainOut = 1.0f - currentMixKnob;
+            }
+            if (mixIntoOutput) {
+                // Accumulate into pOut, fusing the caller's output summing
+                // into the dry/wet pass.
+                SampleUtil::add2WithRampingGain(
                         pOut,
                         pIn,
-                        1.0f - lastCallbackMixKnob,
-                        1.0f - currentMixKnob,
+                        dryGainIn,
+                        dryGainOut,
                         pIntermediateInput,
                         lastCallbackMixKnob,
                         currentMixKnob,
                         static_cast<int>(numSamples));
             } else {
-                // Dry+Wet mode: output = input + (wet * mix knob)
                 SampleUtil::copy2WithRampingGain(
                         pOut,
                         pIn,
-                        1.0f,
-                        1.0f,
+                        dryGainIn,
+                        dryGainOut,
                         pIntermediateInput,
                         lastCallbackMixKnob,
                         currentMixKnob,
@@ -307,3 +335,22 @@ bool EngineEffectChain::process(const ChannelHandle& inputHandle,
 
     return processingOccured;
 }
+
+bool EngineEffectChain::appliesToChannel(const ChannelHandle& inputHandle,
+        const ChannelHandle& outputHandle) const {
+    if (static_cast<int>(inputHandle) >= m_chainStatusForChannelMatrix.size()) {
+        // This routing has never been enabled
+        return false;
+    }
+    const auto& statusMap = m_chainStatusForChannelMatrix.at(inputHandle);
+    if (static_cast<int>(outputHandle) >= statusMap.size()) {
+        return false;
+    }
+    const ChannelStatus& status = statusMap.at(outputHandle);
+    // While the chain is disabled for the channel, process() only keeps the
+    // stored mix knob position up to date. Request a process() call in that
+    // case, so that skipped channels never ramp from a stale knob position
+    // when the chain is enabled again.
+    return status.enableState != EffectEnableState::Disabled ||
+            status.oldMixKnob != m_dMix;
+}
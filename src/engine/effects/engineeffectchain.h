@@ -8,7 +8,8 @@
 #include "engine/effects/engineeffectsdelay.h"
 #include "engine/effects/message.h"
 #include "util/class.h"
-#include "util/samplebuffer.h"
+#include "util/counter.h"
+#include "util/realtimesafety.h"
 #include "util/types.h"
 
 class EngineEffect;
@@ -35,6 +36,10 @@ class EngineEffectChain final : public EffectsRequestHandler {
             const EffectsRequest& message,
             EffectsResponsePipe* pResponsePipe) override;
 
+    /// Processes the chain's effects and writes the dry/wet mix to pOut.
+    /// With mixIntoOutput the dry/wet mix is added to pOut instead of
+    /// overwriting it, fusing the caller's output summing into the
+    /// dry/wet pass. pOut is not touched at all when false is returned.
     /// called from audio thread
     bool process(const ChannelHandle& inputHandle,
             const ChannelHandle& outputHandle,
@@ -43,7 +48,17 @@ class EngineEffectChain final : public EffectsRequestHandler {
             const std::size_t numSamples,
             const mixxx::audio::SampleRate sampleRate,
             const GroupFeatureState& groupFeatures,
-            bool fadeout);
+            bool fadeout,
+            bool mixIntoOutput = false) MIXXX_RT_NONBLOCKING;
+
+    /// Returns true if process() may modify the signal or internal state of
+    /// the given channel routing, i.e. the chain is not disabled for it or
+    /// the stored mix knob position is outdated. Used by ChannelMixer to
+    /// route channels without any active effects through the fused mix
+    /// kernel instead of calling process() per channel.
+    /// called from audio thread
+    bool appliesToChannel(const ChannelHandle& inputHandle,
+            const ChannelHandle& outputHandle) const;
 
   private:
     struct ChannelStatus {
@@ -70,10 +85,12 @@ class EngineEffectChain final : public EffectsRequestHandler {
     EffectChainMixMode::Type m_mixMode;
     CSAMPLE m_dMix;
     QList<EngineEffect*> m_effects;
-    mixxx::SampleBuffer m_buffer1;
-    mixxx::SampleBuffer m_buffer2;
     ChannelHandleMap<ChannelHandleMap<ChannelStatus>> m_chainStatusForChannelMatrix;
     EngineEffectsDelay m_effectsDelay;
+    // Counts NaN, infinity and denormal samples scrubbed from this chain's
+    // wet output, see process(). Only reported when the stats manager is
+    // enabled (--developer).
+    Counter m_scrubbedSampleCounter;
 
     DISALLOW_COPY_AND_ASSIGN(EngineEffectChain);
 };
@@ -29,8 +29,50 @@ class EngineEffectParameter {
                 value <= m_pParameterManifest->getMaximum()) {
             return;
         }
+        // Setting the value directly supersedes a scheduled ramp.
+        m_rampFramesRemaining = 0.0;
         m_value = value;
     }
+    /// Schedules a linear ramp of the value from startValue to targetValue
+    /// over durationFrames frames. The ramp is advanced by advanceRamp()
+    /// once per engine callback.
+    void startRamp(double startValue, double targetValue, double durationFrames) {
+        // Values should be clamped by EffectParameter before sending to the engine.
+        VERIFY_OR_DEBUG_ASSERT(
+                startValue >= m_pParameterManifest->getMinimum() &&
+                startValue <= m_pParameterManifest->getMaximum() &&
+                targetValue >= m_pParameterManifest->getMinimum() &&
+                targetValue <= m_pParameterManifest->getMaximum()) {
+            return;
+        }
+        VERIFY_OR_DEBUG_ASSERT(durationFrames > 0.0) {
+            setValue(targetValue);
+            return;
+        }
+        m_value = startValue;
+        m_rampTargetValue = targetValue;
+        m_rampFramesRemaining = durationFrames;
+        m_rampIncrementPerFrame = (targetValue - startValue) / durationFrames;
+    }
+    /// Advances an active ramp by numFrames frames. Called from the engine
+    /// thread once per callback before any channel is processed, so every
+    /// channel routing of the effect sees the same value within a callback.
+    void advanceRamp(const double numFrames) {
+        if (m_rampFramesRemaining <= 0.0) {
+            return;
+        }
+        if (numFrames >= m_rampFramesRemaining) {
+            // Snap to the target to avoid accumulated rounding errors.
+            m_rampFramesRemaining = 0.0;
+            m_value = m_rampTargetValue;
+            return;
+        }
+        m_rampFramesRemaining -= numFrames;
+        m_value += m_rampIncrementPerFrame * numFrames;
+    }
+    inline bool isRamping() const {
+        return m_rampFramesRemaining > 0.0;
+    }
     inline int toInt() const {
         return static_cast<int>(m_value);
     }
@@ -41,6 +83,9 @@ class EngineEffectParameter {
   private:
     EffectManifestParameterPointer m_pParameterManifest;
     double m_value;
+    double m_rampTargetValue = 0.0;
+    double m_rampIncrementPerFrame = 0.0;
+    double m_rampFramesRemaining = 0.0;
 
     DISALLOW_COPY_AND_ASSIGN(EngineEffectParameter);
 };
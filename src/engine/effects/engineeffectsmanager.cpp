@@ -3,18 +3,18 @@
 #include "audio/types.h"
 #include "engine/effects/engineeffect.h"
 #include "engine/effects/engineeffectchain.h"
-#include "util/defs.h"
+#include "engine/enginecallbackarena.h"
+#include "util/flightrecorder.h"
 #include "util/sample.h"
+#include "util/timer.h"
 
 EngineEffectsManager::EngineEffectsManager(EffectsResponsePipe&& responsePipe)
-        : m_responsePipe(std::move(responsePipe)),
-          m_buffer1(kMaxEngineSamples),
-          m_buffer2(kMaxEngineSamples) {
+        : m_responsePipe(std::move(responsePipe)) {
     // Try to prevent memory allocation.
     m_effects.reserve(256);
 }
 
-void EngineEffectsManager::onCallbackStart() {
+void EngineEffectsManager::onCallbackStart(std::size_t framesPerCallback) {
     EffectsRequest* request = nullptr;
     while (m_responsePipe.readMessage(&request)) {
         EffectsResponse response(*request);
@@ -64,6 +64,7 @@ void EngineEffectsManager::onCallbackStart() {
         }
         case EffectsRequest::SET_EFFECT_PARAMETERS:
         case EffectsRequest::SET_PARAMETER_PARAMETERS:
+        case EffectsRequest::SET_PARAMETER_RAMP:
             VERIFY_OR_DEBUG_ASSERT(m_effects.contains(request->pTargetEffect)) {
                 response.success = false;
                 response.status = EffectsResponse::NO_SUCH_EFFECT;
@@ -90,6 +91,13 @@ void EngineEffectsManager::onCallbackStart() {
             m_responsePipe.writeMessage(response);
         }
     }
+
+    // Advance scheduled parameter ramps exactly once per callback. This must
+    // not happen in EngineEffect::process(), which runs once per enabled
+    // channel routing of an effect.
+    for (EngineEffect* pEffect : std::as_const(m_effects)) {
+        pEffect->advanceParameterRamps(framesPerCallback);
+    }
 }
 
 void EngineEffectsManager::processPreFaderInPlace(const ChannelHandle& inputHandle,
@@ -120,6 +128,8 @@ void EngineEffectsManager::processPostFaderInPlace(
         CSAMPLE_GAIN oldGain,
         CSAMPLE_GAIN newGain,
         bool fadeout) {
+    ScopedTimer timer(kHistogramComputeFlags,
+            QStringLiteral("EngineEffectsManager::processPostFaderInPlace"));
     processInner(SignalProcessingStage::Postfader,
             inputHandle,
             outputHandle,
@@ -144,6 +154,8 @@ void EngineEffectsManager::processPostFaderAndMix(
         CSAMPLE_GAIN oldGain,
         CSAMPLE_GAIN newGain,
         bool fadeout) {
+    ScopedTimer timer(kHistogramComputeFlags,
+            QStringLiteral("EngineEffectsManager::processPostFaderAndMix"));
     processInner(SignalProcessingStage::Postfader,
             inputHandle,
             outputHandle,
@@ -157,6 +169,19 @@ void EngineEffectsManager::processPostFaderAndMix(
             fadeout);
 }
 
+bool EngineEffectsManager::needsPostFaderProcessing(
+        const ChannelHandle& inputHandle,
+        const ChannelHandle& outputHandle) const {
+    const QList<EngineEffectChain*>& chains =
+            m_chainsByStage.value(SignalProcessingStage::Postfader);
+    for (const EngineEffectChain* pChain : chains) {
+        if (pChain && pChain->appliesToChannel(inputHandle, outputHandle)) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void EngineEffectsManager::processInner(
         const SignalProcessingStage stage,
         const ChannelHandle& inputHandle,
@@ -169,6 +194,7 @@ void EngineEffectsManager::processInner(
         CSAMPLE_GAIN oldGain,
         CSAMPLE_GAIN newGain,
         bool fadeout) {
+    FlightRecorderScope flightScope("EngineEffectsManager::processInner");
     const QList<EngineEffectChain*>& chains = m_chainsByStage.value(stage);
 
     if (pIn == pOut) {
@@ -196,7 +222,13 @@ void EngineEffectsManager::processInner(
         // 3. Mix the temporary buffer into pOut
         //    ChannelMixer::applyEffectsAndMixChannels use
         //    this to mix channels into pOut regardless of whether any effects were processed.
-        CSAMPLE* pIntermediateInput = m_buffer1.data();
+        EngineCallbackArena::Scope arenaScope;
+        CSAMPLE* pBuffer1 = arenaScope.allocate(static_cast<SINT>(numSamples));
+        CSAMPLE* pBuffer2 = arenaScope.allocate(static_cast<SINT>(numSamples));
+        VERIFY_OR_DEBUG_ASSERT(pBuffer1 && pBuffer2) {
+            return;
+        }
+        CSAMPLE* pIntermediateInput = pBuffer1;
         if (oldGain == CSAMPLE_GAIN_ONE && newGain == CSAMPLE_GAIN_ONE) {
             // Avoid an unnecessary copy. EngineEffectChain::process does not modify the
             // input buffer when its input & output buffers are different, so this is okay.
@@ -205,14 +237,30 @@ void EngineEffectsManager::processInner(
             SampleUtil::copyWithRampingGain(pIntermediateInput, pIn, oldGain, newGain, numSamples);
         }
 
+        // Resolve the routing switchboard to the last chain that applies
+        // to this input/output pairing before touching any samples. That
+        // chain can mix its dry/wet output straight into pOut, fusing the
+        // final output summing into its dry/wet pass instead of sweeping
+        // the whole buffer once more below.
+        EngineEffectChain* pLastApplicableChain = nullptr;
+        for (EngineEffectChain* pChain : chains) {
+            if (pChain && pChain->appliesToChannel(inputHandle, outputHandle)) {
+                pLastApplicableChain = pChain;
+            }
+        }
+
         CSAMPLE* pIntermediateOutput;
+        bool mixedIntoOutput = false;
         for (EngineEffectChain* pChain : chains) {
             if (pChain) {
-                // Select an unused intermediate buffer for the next output
-                if (pIntermediateInput == m_buffer1.data()) {
-                    pIntermediateOutput = m_buffer2.data();
+                const bool mixIntoOutput = pChain == pLastApplicableChain;
+                if (mixIntoOutput) {
+                    pIntermediateOutput = pOut;
+                } else if (pIntermediateInput == pBuffer1) {
+                    // Select an unused intermediate buffer for the next output
+                    pIntermediateOutput = pBuffer2;
                 } else {
-                    pIntermediateOutput = m_buffer1.data();
+                    pIntermediateOutput = pBuffer1;
                 }
 
                 if (pChain->process(inputHandle,
@@ -222,15 +270,24 @@ void EngineEffectsManager::processInner(
                             numSamples,
                             sampleRate,
                             groupFeatures,
-                            fadeout)) {
-                    // Output of this chain becomes the input of the next chain.
-                    pIntermediateInput = pIntermediateOutput;
+                            fadeout,
+                            mixIntoOutput)) {
+                    if (mixIntoOutput) {
+                        mixedIntoOutput = true;
+                    } else {
+                        // Output of this chain becomes the input of the next chain.
+                        pIntermediateInput = pIntermediateOutput;
+                    }
                 }
             }
         }
-        // pIntermediateInput is the output of the last processed chain. It would
-        // be the intermediate input of the next chain if there was one.
-        SampleUtil::add(pOut, pIntermediateInput, numSamples);
+        if (!mixedIntoOutput) {
+            // No chain mixed into pOut, e.g. because no chain applied to
+            // this routing or the applicable chain had nothing to process.
+            // pIntermediateInput is the output of the last processed chain
+            // or the gain-adjusted input if no chain processed.
+            SampleUtil::add(pOut, pIntermediateInput, numSamples);
+        }
     }
 }
 
@@ -3,7 +3,6 @@
 #include "audio/types.h"
 #include "engine/channelhandle.h"
 #include "engine/effects/message.h"
-#include "util/samplebuffer.h"
 #include "util/types.h"
 
 class EngineEffectChain;
@@ -24,7 +23,10 @@ class EngineEffectsManager final : public EffectsRequestHandler {
     EngineEffectsManager(EffectsResponsePipe&& responsePipe);
     ~EngineEffectsManager() override = default;
 
-    void onCallbackStart();
+    /// Processes pending EffectsRequests and advances scheduled parameter
+    /// ramps by framesPerCallback frames. Called once at the beginning of
+    /// every audio callback, before any channel is processed.
+    void onCallbackStart(std::size_t framesPerCallback);
 
     /// Process the prefader EngineEffectChains on the pInOut buffer, modifying
     /// the contents of the input buffer.
@@ -49,10 +51,11 @@ class EngineEffectsManager final : public EffectsRequestHandler {
             bool fadeout = false);
 
     /// Process the postfader EngineEffectChains, leaving the pIn buffer unmodified
-    /// and mixing the output into the pOut buffer. Using EngineEffectsManager's
-    /// temporary buffers for this avoids the need for ChannelMixer to allocate a
-    /// buffer for every channel, which would potentially require allocation on the
-    /// audio thread because ChannelMixer supports an arbitrary number of channels.
+    /// and mixing the output into the pOut buffer. Using temporary buffers from
+    /// the EngineCallbackArena for this avoids the need for ChannelMixer to
+    /// allocate a buffer for every channel, which would potentially require
+    /// allocation on the audio thread because ChannelMixer supports an arbitrary
+    /// number of channels.
     void processPostFaderAndMix(
             const ChannelHandle& inputHandle,
             const ChannelHandle& outputHandle,
@@ -65,6 +68,14 @@ class EngineEffectsManager final : public EffectsRequestHandler {
             CSAMPLE_GAIN newGain = CSAMPLE_GAIN_ONE,
             bool fadeout = false);
 
+    /// Returns true if any postfader EngineEffectChain may modify the signal
+    /// of the given channel routing. Channels for which this returns false
+    /// can be mixed with plain gain ramping, bypassing the per-channel
+    /// effects processing entirely; see ChannelMixer.
+    bool needsPostFaderProcessing(
+            const ChannelHandle& inputHandle,
+            const ChannelHandle& outputHandle) const;
+
     bool processEffectsRequest(
             const EffectsRequest& message,
             EffectsResponsePipe* pResponsePipe) override;
@@ -99,7 +110,4 @@ class EngineEffectsManager final : public EffectsRequestHandler {
     EffectsResponsePipe m_responsePipe;
     QHash<SignalProcessingStage, QList<EngineEffectChain*>> m_chainsByStage;
     QList<EngineEffect*> m_effects;
-
-    mixxx::SampleBuffer m_buffer1;
-    mixxx::SampleBuffer m_buffer2;
 };
@@ -29,6 +29,7 @@ struct EffectsRequest {
         // Messages for EngineEffect
         SET_EFFECT_PARAMETERS,
         SET_PARAMETER_PARAMETERS,
+        SET_PARAMETER_RAMP,
 
         // Must come last.
         NUM_REQUEST_TYPES
@@ -96,9 +97,16 @@ struct EffectsRequest {
         struct {
             int iParameter;
         } SetParameterParameters;
+        struct {
+            int iParameter;
+            // Value the ramp starts from; the target value is carried in
+            // the shared value field below.
+            double startValue;
+            double rampDurationFrames;
+        } SetParameterRamp;
     };
 
-    // Used by SET_EFFECT_PARAMETER.
+    // Used by SET_EFFECT_PARAMETER and SET_PARAMETER_RAMP (target value).
     double value;
 };
 
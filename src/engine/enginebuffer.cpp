@@ -1,6 +1,7 @@
 #include "engine/enginebuffer.h"
 
 #include <QtDebug>
+#include <cmath>
 
 #include "control/controllinpotmeter.h"
 #include "control/controlpotmeter.h"
@@ -16,6 +17,7 @@
 #include "engine/controls/enginecontrol.h"
 #include "engine/controls/keycontrol.h"
 #include "engine/controls/loopingcontrol.h"
+#include "engine/controls/macrocontrol.h"
 #include "engine/controls/quantizecontrol.h"
 #include "engine/controls/ratecontrol.h"
 #include "engine/enginemixer.h"
@@ -29,8 +31,11 @@
 #include "util/assert.h"
 #include "util/compatibility/qatomic.h"
 #include "util/defs.h"
+#include "util/flightrecorder.h"
 #include "util/logger.h"
+#include "util/memorylock.h"
 #include "util/sample.h"
+#include "util/time.h"
 #include "util/timer.h"
 #include "waveform/visualplayposition.h"
 
@@ -53,6 +58,11 @@ constexpr int kPlaypositionUpdateRate = 15; // updates per second
 
 const QString kAppGroup = QStringLiteral("[App]");
 
+// Upper bound for latency-compensated seeks. Requests that have been
+// waiting longer than this (e.g. while the engine was stalled) are
+// executed at their unmodified position.
+constexpr double kMaxSeekCompensationSeconds = 0.1;
+
 } // anonymous namespace
 
 EngineBuffer::EngineBuffer(const QString& group,
@@ -92,7 +102,17 @@ EngineBuffer::EngineBuffer(const QString& group,
           m_iSeekPhaseQueued(0),
           m_iEnableSyncQueued(SYNC_REQUEST_NONE),
           m_iSyncModeQueued(static_cast<int>(SyncMode::Invalid)),
+          m_supersededSeekCounter(
+                  QStringLiteral("EngineBuffer(%1) superseded seeks").arg(group)),
+          m_latencyCompensatedSeeks(pConfig->getValue(
+                  ConfigKey(kAppGroup, QStringLiteral("latency_compensated_seeks")),
+                  false)),
           m_slipQuitAndAdopt(0),
+          m_previewVoiceState(PreviewVoiceState::Off),
+          m_previewVoicePos(0.0),
+          m_previewVoiceGainOld(CSAMPLE_GAIN_ZERO),
+          m_pPreviewVoiceBuffer(SampleUtil::alloc(
+                  kMaxEngineFrames * mixxx::kMaxEngineChannelInputCount)),
           m_bPlayAfterLoading(false),
           m_channelCount(mixxx::kEngineChannelOutputCount),
           m_pCrossfadeBuffer(SampleUtil::alloc(
@@ -108,11 +128,28 @@ EngineBuffer::EngineBuffer(const QString& group,
     DEBUG_ASSERT(kInitialPlayPosition.isValid());
 
     m_queuedSeek.setValue(kNoQueuedSeek);
+    m_queuedPreviewVoice.setValue(kNoQueuedPreviewVoice);
 
     // zero out crossfade buffer
     SampleUtil::clear(m_pCrossfadeBuffer, kMaxEngineFrames * mixxx::kMaxEngineChannelInputCount);
 
+    mixxx::MemoryLock::lockAndPrefault(m_pCrossfadeBuffer,
+            sizeof(CSAMPLE) * kMaxEngineFrames * mixxx::kMaxEngineChannelInputCount,
+            "EngineBuffer crossfade buffer");
+    mixxx::MemoryLock::lockAndPrefault(m_pPreviewVoiceBuffer,
+            sizeof(CSAMPLE) * kMaxEngineFrames * mixxx::kMaxEngineChannelInputCount,
+            "EngineBuffer preview voice buffer");
+
     m_pReader = new CachingReader(group, pConfig, maxSupportedChannel);
+    if (PlayerManager::isSamplerGroup(group) ||
+            PlayerManager::isPreviewDeckGroup(group)) {
+        m_playingWorkerPriority = EngineWorker::Priority::Sampler;
+        m_stoppedWorkerPriority = EngineWorker::Priority::BackgroundPrefetch;
+    } else {
+        m_playingWorkerPriority = EngineWorker::Priority::AudibleDeck;
+        m_stoppedWorkerPriority = EngineWorker::Priority::CuedDeck;
+    }
+    m_pReader->setWorkerPriority(m_stoppedWorkerPriority);
     connect(m_pReader, &CachingReader::trackLoading,
             this, &EngineBuffer::slotTrackLoading,
             Qt::DirectConnection);
@@ -124,48 +161,48 @@ EngineBuffer::EngineBuffer(const QString& group,
             Qt::DirectConnection);
 
     // Play button
-    m_playButton = new ControlPushButton(ConfigKey(m_group, "play"));
+    m_playButton = new ControlPushButton(ConfigKey(m_group, QStringLiteral("play")));
     m_playButton->setButtonMode(mixxx::control::ButtonMode::Toggle);
     m_playButton->connectValueChangeRequest(
             this, &EngineBuffer::slotControlPlayRequest,
             Qt::DirectConnection);
 
     //Play from Start Button (for sampler)
-    m_playStartButton = new ControlPushButton(ConfigKey(m_group, "start_play"));
+    m_playStartButton = new ControlPushButton(ConfigKey(m_group, QStringLiteral("start_play")));
     connect(m_playStartButton, &ControlObject::valueChanged,
             this, &EngineBuffer::slotControlPlayFromStart,
             Qt::DirectConnection);
 
     // Jump to start and stop button
-    m_stopStartButton = new ControlPushButton(ConfigKey(m_group, "start_stop"));
+    m_stopStartButton = new ControlPushButton(ConfigKey(m_group, QStringLiteral("start_stop")));
     connect(m_stopStartButton, &ControlObject::valueChanged,
             this, &EngineBuffer::slotControlJumpToStartAndStop,
             Qt::DirectConnection);
 
     //Stop playback (for sampler)
-    m_stopButton = new ControlPushButton(ConfigKey(m_group, "stop"));
+    m_stopButton = new ControlPushButton(ConfigKey(m_group, QStringLiteral("stop")));
     connect(m_stopButton, &ControlObject::valueChanged,
             this, &EngineBuffer::slotControlStop,
             Qt::DirectConnection);
 
     // Start button
-    m_startButton = new ControlPushButton(ConfigKey(m_group, "start"));
+    m_startButton = new ControlPushButton(ConfigKey(m_group, QStringLiteral("start")));
     m_startButton->setButtonMode(mixxx::control::ButtonMode::Trigger);
     connect(m_startButton, &ControlObject::valueChanged,
             this, &EngineBuffer::slotControlStart,
             Qt::DirectConnection);
 
     // End button
-    m_endButton = new ControlPushButton(ConfigKey(m_group, "end"));
+    m_endButton = new ControlPushButton(ConfigKey(m_group, QStringLiteral("end")));
     connect(m_endButton, &ControlObject::valueChanged,
             this, &EngineBuffer::slotControlEnd,
             Qt::DirectConnection);
 
-    m_pSlipButton = new ControlPushButton(ConfigKey(m_group, "slip_enabled"));
+    m_pSlipButton = new ControlPushButton(ConfigKey(m_group, QStringLiteral("slip_enabled")));
     m_pSlipButton->setButtonMode(mixxx::control::ButtonMode::Toggle);
 
     m_playposSlider = new ControlLinPotmeter(
-        ConfigKey(m_group, "playposition"), 0.0, 1.0, 0, 0, true);
+        ConfigKey(m_group, QStringLiteral("playposition")), 0.0, 1.0, 0, 0, true);
     connect(m_playposSlider, &ControlObject::valueChanged,
             this, &EngineBuffer::slotControlSeek,
             Qt::DirectConnection);
@@ -173,20 +210,20 @@ EngineBuffer::EngineBuffer(const QString& group,
     // Control used to communicate ratio playpos to GUI thread
     m_visualPlayPos = VisualPlayPosition::getVisualPlayPosition(m_group);
 
-    m_pRepeat = new ControlPushButton(ConfigKey(m_group, "repeat"));
+    m_pRepeat = new ControlPushButton(ConfigKey(m_group, QStringLiteral("repeat")));
     m_pRepeat->setButtonMode(mixxx::control::ButtonMode::Toggle);
 
     m_pSampleRate = new ControlProxy(kAppGroup, QStringLiteral("samplerate"), this);
 
-    m_pTrackSamples = new ControlObject(ConfigKey(m_group, "track_samples"));
-    m_pTrackSampleRate = new ControlObject(ConfigKey(m_group, "track_samplerate"));
+    m_pTrackSamples = new ControlObject(ConfigKey(m_group, QStringLiteral("track_samples")));
+    m_pTrackSampleRate = new ControlObject(ConfigKey(m_group, QStringLiteral("track_samplerate")));
 
-    m_pKeylock = new ControlPushButton(ConfigKey(m_group, "keylock"), true);
+    m_pKeylock = new ControlPushButton(ConfigKey(m_group, QStringLiteral("keylock")), true);
     m_pKeylock->setButtonMode(mixxx::control::ButtonMode::Toggle);
 
     m_pReplayGain = new ControlProxy(m_group, QStringLiteral("replaygain"), this);
 
-    m_pTrackLoaded = new ControlObject(ConfigKey(m_group, "track_loaded"), false);
+    m_pTrackLoaded = new ControlObject(ConfigKey(m_group, QStringLiteral("track_loaded")), false);
     m_pTrackLoaded->setReadOnly();
 
     // Quantization Controller for enabling and disabling the
@@ -194,7 +231,7 @@ EngineBuffer::EngineBuffer(const QString& group,
     // beats.
     QuantizeControl* pQuantize_control = new QuantizeControl(group, pConfig);
     addControl(pQuantize_control);
-    m_quantize = PollingControlProxy(ConfigKey(group, "quantize"));
+    m_quantize = PollingControlProxy(ConfigKey(group, QStringLiteral("quantize")));
 
     // Create the Loop Controller
     m_pLoopingControl = new LoopingControl(group, pConfig);
@@ -240,6 +277,10 @@ EngineBuffer::EngineBuffer(const QString& group,
     m_pClockControl = new ClockControl(group, pConfig);
     addControl(m_pClockControl);
 
+    // Create the macro controller
+    m_pMacroControl = new MacroControl(group, pConfig);
+    addControl(m_pMacroControl);
+
     // Create the cue controller
     m_pCueControl = new CueControl(group, pConfig);
     addControl(m_pCueControl);
@@ -341,6 +382,7 @@ EngineBuffer::~EngineBuffer() {
     delete m_pReplayGain;
 
     SampleUtil::free(m_pCrossfadeBuffer);
+    SampleUtil::free(m_pPreviewVoiceBuffer);
 }
 
 void EngineBuffer::bindWorkers(EngineWorkerScheduler* pWorkerScheduler) {
@@ -415,7 +457,33 @@ void EngineBuffer::queueNewPlaypos(mixxx::audio::FramePos position, enum SeekReq
         // use SEEK_STANDARD for that
         seekType = SEEK_STANDARD;
     }
-    m_queuedSeek.setValue({position, seekType});
+    const QueuedSeek previousSeek = m_queuedSeek.getValue();
+    // The timestamp allows the engine thread to compensate for the time
+    // the request spent in the mailbox, see processSeek().
+    const qint64 requestedAtNanos = m_latencyCompensatedSeeks
+            ? mixxx::Time::elapsed().toIntegerNanos()
+            : 0;
+    m_queuedSeek.setValue({position, seekType, requestedAtNanos});
+    if (previousSeek.seekType != SEEK_NONE) {
+        // The previous request is replaced before the engine thread picked it
+        // up, so rapid seeking settles on the latest position instead of
+        // replaying every intermediate one. A request consumed between the
+        // read and the write above is falsely counted as superseded, which is
+        // acceptable for the statistics.
+        m_supersededSeekCounter.increment();
+    }
+}
+
+void EngineBuffer::startPreviewVoice(mixxx::audio::FramePos startPosition) {
+    VERIFY_OR_DEBUG_ASSERT(startPosition.isValid()) {
+        return;
+    }
+    m_queuedPreviewVoice.setValue({startPosition, PreviewVoiceRequest::Start});
+}
+
+void EngineBuffer::stopPreviewVoice() {
+    m_queuedPreviewVoice.setValue(
+            {mixxx::audio::kInvalidFramePos, PreviewVoiceRequest::Stop});
 }
 
 void EngineBuffer::requestSyncPhase() {
@@ -641,6 +709,8 @@ void EngineBuffer::ejectTrack() {
             0.0,
             0.0,
             0.0,
+            0.0,
+            -1.0,
             0.0);
     doSeekPlayPos(mixxx::audio::kStartFramePos, SEEK_EXACT);
 
@@ -743,6 +813,12 @@ void EngineBuffer::seekExact(mixxx::audio::FramePos position) {
     doSeekPlayPos(position, SEEK_EXACT);
 }
 
+void EngineBuffer::setSeekBeatContextHint(
+        mixxx::audio::FramePos prevBeatPosition,
+        mixxx::audio::FramePos nextBeatPosition) {
+    m_pBpmControl->setSeekBeatContextHint(prevBeatPosition, nextBeatPosition);
+}
+
 double EngineBuffer::fractionalPlayposFromAbsolute(mixxx::audio::FramePos absolutePlaypos) {
     if (!m_trackEndPositionOld.isValid()) {
         return 0.0;
@@ -1123,7 +1199,14 @@ void EngineBuffer::processTrackLocked(
     // If the buffer is not paused, then scale the audio.
     if (!bCurBufferPaused) {
         // Perform scaling of Reader buffer into buffer.
-        const double framesRead = m_pScale->scaleBuffer(pOutput, bufferSize);
+        double framesRead;
+        {
+            ScopedTimer scaleTimer(kHistogramComputeFlags,
+                    QStringLiteral("EngineBuffer::scaleBuffer %1"),
+                    getGroup());
+            FlightRecorderScope flightScope("EngineBuffer::scaleBuffer");
+            framesRead = m_pScale->scaleBuffer(pOutput, bufferSize);
+        }
 
         // TODO(XXX): The result framesRead might not be an integer value.
         // Converting to samples here does not make sense. All positional
@@ -1211,6 +1294,10 @@ void EngineBuffer::process(CSAMPLE* pOutput, const std::size_t bufferSize) {
     VERIFY_OR_DEBUG_ASSERT((bufferSize % m_channelCount) == 0) {
         return;
     }
+    ScopedTimer timer(kHistogramComputeFlags,
+            QStringLiteral("EngineBuffer::process %1"),
+            getGroup());
+    FlightRecorderScope flightScope("EngineBuffer::process");
     m_pReader->process();
     // Steps:
     // - Lookup new reader information
@@ -1236,6 +1323,7 @@ void EngineBuffer::process(CSAMPLE* pOutput, const std::size_t bufferSize) {
     bool hasStableTrack = m_pTrackLoaded->toBool() && m_iTrackLoading.loadAcquire() == 0;
     if (hasStableTrack && m_pause.tryLock()) {
         processTrackLocked(pOutput, bufferSize, m_sampleRate);
+        processPreviewVoice(pOutput, bufferSize);
         // release the pauselock
         m_pause.unlock();
     } else {
@@ -1261,6 +1349,8 @@ void EngineBuffer::process(CSAMPLE* pOutput, const std::size_t bufferSize) {
         m_speed_old = 0;
         m_actual_speed = 0;
         m_scratching_old = false;
+        m_previewVoiceState = PreviewVoiceState::Off;
+        m_previewVoiceGainOld = CSAMPLE_GAIN_ZERO;
     }
 
 #ifdef __SCALER_DEBUG__
@@ -1275,6 +1365,95 @@ void EngineBuffer::process(CSAMPLE* pOutput, const std::size_t bufferSize) {
     m_bCrossfadeReady = false;
 }
 
+void EngineBuffer::processPreviewVoice(CSAMPLE* pOutput, std::size_t bufferSize) {
+    const QueuedPreviewVoice queued = m_queuedPreviewVoice.getValue();
+    if (queued.request != PreviewVoiceRequest::None) {
+        m_queuedPreviewVoice.setValue(kNoQueuedPreviewVoice);
+        if (queued.request == PreviewVoiceRequest::Start &&
+                queued.position.isValid()) {
+            m_previewVoicePos = queued.position.value();
+            m_previewVoiceState = PreviewVoiceState::Playing;
+        } else if (m_previewVoiceState == PreviewVoiceState::Playing) {
+            m_previewVoiceState = PreviewVoiceState::RampOut;
+        }
+    }
+    if (m_previewVoiceState == PreviewVoiceState::Off) {
+        return;
+    }
+    if (!m_trackSampleRateOld.isValid() || !m_sampleRate.isValid()) {
+        m_previewVoiceState = PreviewVoiceState::Off;
+        m_previewVoiceGainOld = CSAMPLE_GAIN_ZERO;
+        return;
+    }
+
+    // The preview voice plays at the deck's tempo but bypasses the
+    // scalers; sample rate conversion is done with plain linear
+    // interpolation, like the vinyl scaler at constant speed.
+    double step = m_trackSampleRateOld / m_sampleRate;
+    if (m_tempo_ratio_old > 0) {
+        step *= m_tempo_ratio_old;
+    }
+
+    const SINT outFrames = static_cast<SINT>(bufferSize / m_channelCount);
+    const SINT readStartFrame = static_cast<SINT>(std::floor(m_previewVoicePos));
+    // One frame more than covered by the last output frame, for its
+    // interpolation neighbor.
+    const SINT readFrames = static_cast<SINT>(std::ceil(
+                                    m_previewVoicePos - readStartFrame +
+                                    outFrames * step)) +
+            1;
+    const SINT readSamples = readFrames * m_channelCount;
+    VERIFY_OR_DEBUG_ASSERT(readSamples <=
+            static_cast<SINT>(
+                    kMaxEngineFrames * mixxx::kMaxEngineChannelInputCount)) {
+        m_previewVoiceState = PreviewVoiceState::Off;
+        m_previewVoiceGainOld = CSAMPLE_GAIN_ZERO;
+        return;
+    }
+    const auto readResult = m_pReader->read(
+            readStartFrame * m_channelCount,
+            readSamples,
+            /*reverse*/ false,
+            m_pPreviewVoiceBuffer,
+            m_channelCount);
+    if (readResult == CachingReader::ReadResult::UNAVAILABLE) {
+        // Keep the current position and gain and try again in the next
+        // callback once the reader has caught up.
+        return;
+    }
+
+    const CSAMPLE_GAIN targetGain =
+            (m_previewVoiceState == PreviewVoiceState::Playing)
+            ? CSAMPLE_GAIN_ONE
+            : CSAMPLE_GAIN_ZERO;
+    const CSAMPLE_GAIN gainStep =
+            (targetGain - m_previewVoiceGainOld) / outFrames;
+    CSAMPLE_GAIN gain = m_previewVoiceGainOld;
+    double frameOffset = m_previewVoicePos - readStartFrame;
+    for (SINT i = 0; i < outFrames; ++i) {
+        gain += gainStep;
+        const SINT frame = static_cast<SINT>(frameOffset);
+        const CSAMPLE frac = static_cast<CSAMPLE>(frameOffset - frame);
+        const CSAMPLE* pFrame = m_pPreviewVoiceBuffer + frame * m_channelCount;
+        CSAMPLE* pOutFrame = pOutput + i * m_channelCount;
+        for (int ch = 0; ch < m_channelCount; ++ch) {
+            pOutFrame[ch] += gain *
+                    (pFrame[ch] +
+                            frac * (pFrame[ch + m_channelCount] - pFrame[ch]));
+        }
+        frameOffset += step;
+    }
+    m_previewVoiceGainOld = targetGain;
+    m_previewVoicePos += outFrames * step;
+
+    if (m_previewVoiceState == PreviewVoiceState::RampOut ||
+            (m_trackEndPositionOld.isValid() &&
+                    m_previewVoicePos >= m_trackEndPositionOld.value())) {
+        m_previewVoiceState = PreviewVoiceState::Off;
+        m_previewVoiceGainOld = CSAMPLE_GAIN_ZERO;
+    }
+}
+
 void EngineBuffer::processSlip(std::size_t bufferSize) {
     // Do a single read from m_bSlipEnabled so we don't run in to race conditions.
     bool enabled = m_pSlipButton->toBool();
@@ -1401,6 +1580,20 @@ void EngineBuffer::processSeek(bool paused) {
         return;
     }
 
+    if (!paused && queuedSeek.requestedAtNanos != 0 && m_rate_old != 0.0) {
+        // Advance the target by the time the request spent in the
+        // mailbox, so that the total input-to-audio latency of cue
+        // presses is constant instead of jittering by up to one buffer
+        // period depending on where in the callback cycle the request
+        // arrived.
+        const double elapsedSeconds =
+                (mixxx::Time::elapsed().toIntegerNanos() - queuedSeek.requestedAtNanos) /
+                1e9;
+        if (elapsedSeconds > 0 && elapsedSeconds < kMaxSeekCompensationSeconds) {
+            position += elapsedSeconds * m_sampleRate.toDouble() * m_rate_old;
+        }
+    }
+
     // Don't allow the playposition to go past the end.
     position = std::min<mixxx::audio::FramePos>(position, m_trackEndPositionOld);
 
@@ -1529,6 +1722,24 @@ void EngineBuffer::updateIndicators(double speed, std::size_t bufferSize) {
         m_pCueControl->updateIndicators();
     }
 
+    // Beat clock for animated widgets, extrapolated between the audio
+    // callbacks by VisualPlayPosition. The bpm control already reflects
+    // the current tempo, only the play direction needs to be applied.
+    double beatDistance = -1.0;
+    double beatsPerBuffer = 0.0;
+    const mixxx::Bpm visualBpm = m_pBpmControl->getBpm();
+    if (visualBpm.isValid()) {
+        beatDistance = m_pBpmControl->getBeatDistance(m_playPos);
+        if (speed != 0.0) {
+            const double bufferSeconds = static_cast<double>(bufferSize) /
+                    mixxx::kEngineChannelOutputCount / m_sampleRate.toDouble();
+            beatsPerBuffer = visualBpm.value() / 60.0 * bufferSeconds;
+            if (speed < 0.0) {
+                beatsPerBuffer = -beatsPerBuffer;
+            }
+        }
+    }
+
     // Update visual control object, this needs to be done more often than the
     // playpos slider
     m_visualPlayPos->set(
@@ -1545,7 +1756,9 @@ void EngineBuffer::updateIndicators(double speed, std::size_t bufferSize) {
             fFractionalLoopStartPos,
             fFractionalLoopEndPos,
             tempoTrackSeconds,
-            bufferSize / mixxx::kEngineChannelOutputCount / m_sampleRate.toDouble() * 1000000.0);
+            bufferSize / mixxx::kEngineChannelOutputCount / m_sampleRate.toDouble() * 1000000.0,
+            beatDistance,
+            beatsPerBuffer);
 
     // TODO: Especially with long audio buffers, jitter is visible. This can be fixed by moving the
     // ClockControl::updateIndicators into the waveform update loop which is synced with the display refresh rate.
@@ -1556,7 +1769,10 @@ void EngineBuffer::updateIndicators(double speed, std::size_t bufferSize) {
 
 void EngineBuffer::hintReader(const double dRate) {
     m_hintList.clear();
-    m_pReadAheadManager->hintReader(dRate, &m_hintList, m_channelCount);
+    m_pReadAheadManager->hintReader(dRate,
+            &m_hintList,
+            m_channelCount,
+            m_pReader->recommendedReadAheadChunks());
 
     //if slipping, hint about virtual position so we're ready for it
     if (m_bSlipEnabledProcessing) {
@@ -1571,9 +1787,24 @@ void EngineBuffer::hintReader(const double dRate) {
         m_hintList.append(hint);
     }
 
+    // If the preview voice is active, hint its position so the reader
+    // keeps the chunks ahead of it fresh during long press-and-holds.
+    if (m_previewVoiceState != PreviewVoiceState::Off) {
+        Hint hint;
+        hint.frame = static_cast<SINT>(m_previewVoicePos);
+        hint.type = Hint::Type::HotCue;
+        hint.frameCount = Hint::kFrameCountForward;
+        m_hintList.append(hint);
+    }
+
     for (const auto& pControl : std::as_const(m_engineControls)) {
         pControl->hintReader(&m_hintList);
     }
+    // Keep the reader worker's priority lane in sync with the deck state so
+    // that the scheduler services audible decks first.
+    m_pReader->setWorkerPriority(m_playButton->toBool()
+                    ? m_playingWorkerPriority
+                    : m_stoppedWorkerPriority);
     m_pReader->hintAndMaybeWake(m_hintList);
 }
 
@@ -17,6 +17,7 @@
 #include "preferences/usersettings.h"
 #include "track/bpm.h"
 #include "track/track_decl.h"
+#include "util/counter.h"
 #include "util/types.h"
 
 #ifdef __RUBBERBAND__
@@ -39,6 +40,7 @@ class VinylControlControl;
 class LoopingControl;
 class ClockControl;
 class CueControl;
+class MacroControl;
 class ReadAheadManager;
 class ControlObject;
 class ControlProxy;
@@ -119,6 +121,10 @@ class EngineBuffer : public EngineObject {
     mixxx::audio::FramePos getPlayPos() const {
         return m_playPos;
     }
+    // Return the sample rate of the loaded track (not thread-safe)
+    mixxx::audio::SampleRate getTrackSampleRate() const {
+        return m_trackSampleRateOld;
+    }
     bool getScratching() const;
     bool isReverse() const;
     /// Returns current bpm value (not thread-safe)
@@ -136,6 +142,23 @@ class EngineBuffer : public EngineObject {
 
     // Queues a new seek position. Use SEEK_EXACT or SEEK_STANDARD as seekType
     void queueNewPlaypos(mixxx::audio::FramePos newpos, enum SeekRequest seekType);
+
+    /// Starts the preview voice at the given track position. The preview
+    /// voice is a lightweight secondary render path that reads from the
+    /// shared CachingReader at its own position and is mixed additively
+    /// into the deck output, leaving the main playposition and the
+    /// scalers untouched. Used for audible hotcue previews. Thread-safe.
+    void startPreviewVoice(mixxx::audio::FramePos startPosition);
+    /// Requests a ramped stop of the preview voice. Thread-safe.
+    void stopPreviewVoice();
+
+    /// Returns true if the preview voice is currently audible. Only
+    /// valid within the audio callback (used by EngineDeck to keep the
+    /// vinyl-style speed gain open while the deck is paused).
+    bool isPreviewVoiceActive() const {
+        return m_previewVoiceState != PreviewVoiceState::Off;
+    }
+
     void requestSyncPhase();
     void requestEnableSync(bool enabled);
     void requestSyncMode(SyncMode mode);
@@ -241,6 +264,10 @@ class EngineBuffer : public EngineObject {
 
     void seekAbs(mixxx::audio::FramePos);
     void seekExact(mixxx::audio::FramePos);
+    // Publishes the beat context of an upcoming seek target to BpmControl,
+    // see BpmControl::setSeekBeatContextHint().
+    void setSeekBeatContextHint(mixxx::audio::FramePos prevBeatPosition,
+            mixxx::audio::FramePos nextBeatPosition);
 
     void verifyPlay();
 
@@ -278,6 +305,25 @@ class EngineBuffer : public EngineObject {
     struct QueuedSeek {
         mixxx::audio::FramePos position;
         enum SeekRequest seekType;
+        // Monotonic timestamp of the requesting thread taken when the
+        // seek was posted, in nanoseconds since startup. Zero if latency
+        // compensation is disabled or not applicable for this request.
+        qint64 requestedAtNanos;
+    };
+
+    enum class PreviewVoiceRequest {
+        None,
+        Start,
+        Stop,
+    };
+    struct QueuedPreviewVoice {
+        mixxx::audio::FramePos position;
+        PreviewVoiceRequest request;
+    };
+    enum class PreviewVoiceState {
+        Off,
+        Playing,
+        RampOut,
     };
 
     // Add an engine control to the EngineBuffer
@@ -306,6 +352,9 @@ class EngineBuffer : public EngineObject {
 
     void processSyncRequests();
     void processSeek(bool paused);
+    // Renders the preview voice (if active) additively into the output
+    // buffer. Runs in the audio callback after the main render path.
+    void processPreviewVoice(CSAMPLE* pOutput, std::size_t bufferSize);
     // For debugging / testing -- returns true if the previous buffer call resulted in a seek.
     FRIEND_TEST(EngineSyncTest, FollowerUserTweakPreservedInSyncDisable);
     bool previousBufferSeek() const {
@@ -344,6 +393,7 @@ class EngineBuffer : public EngineObject {
     BpmControl* m_pBpmControl;
     KeyControl* m_pKeyControl;
     ClockControl* m_pClockControl;
+    MacroControl* m_pMacroControl;
     FRIEND_TEST(CueControlTest, SeekOnSetCueCDJ);
     FRIEND_TEST(CueControlTest, SeekOnSetCuePlay);
     CueControl* m_pCueControl;
@@ -356,6 +406,12 @@ class EngineBuffer : public EngineObject {
     // The reader used to read audio files
     CachingReader* m_pReader;
 
+    // Priority lanes for the reader worker depending on whether this deck
+    // is playing, computed once from the group name. Sampler and preview
+    // decks yield to the primary decks in the worker scheduler.
+    EngineWorker::Priority m_playingWorkerPriority;
+    EngineWorker::Priority m_stoppedWorkerPriority;
+
     // List of hints to provide to the CachingReader
     HintVector m_hintList;
 
@@ -475,15 +531,42 @@ class EngineBuffer : public EngineObject {
     QAtomicInt m_iEnableSyncQueued;
     QAtomicInt m_iSyncModeQueued;
     ControlValueAtomic<QueuedSeek> m_queuedSeek;
+    // Counts seek requests that were overwritten in m_queuedSeek before the
+    // engine thread picked them up. Rapid jog or scratch seeking is expected
+    // to coalesce this way (latest-wins); the counter makes the drop rate
+    // visible in the developer stats (--developer).
+    Counter m_supersededSeekCounter;
+    // Advance picked-up seek targets by the time that passed since the
+    // request was posted, so that cue presses have a constant total
+    // latency instead of jittering by up to one buffer period. Opt-in
+    // via [App] latency_compensated_seeks.
+    const bool m_latencyCompensatedSeeks;
     bool m_previousBufferSeek = false;
 
     QAtomicInt m_slipQuitAndAdopt;
     /// Indicates that no seek is queued
-    static constexpr QueuedSeek kNoQueuedSeek = {mixxx::audio::kInvalidFramePos, SEEK_NONE};
+    static constexpr QueuedSeek kNoQueuedSeek = {
+            mixxx::audio::kInvalidFramePos, SEEK_NONE, 0};
     /// indicates a clone seek on a bosition from another deck
-    static constexpr QueuedSeek kCloneSeek = {mixxx::audio::kInvalidFramePos, SEEK_CLONE};
+    static constexpr QueuedSeek kCloneSeek = {
+            mixxx::audio::kInvalidFramePos, SEEK_CLONE, 0};
     QAtomicPointer<EngineChannel> m_pChannelToCloneFrom;
 
+    // Preview voice, see startPreviewVoice(). All fields except the
+    // queued request are only touched by the engine thread.
+    ControlValueAtomic<QueuedPreviewVoice> m_queuedPreviewVoice;
+    static constexpr QueuedPreviewVoice kNoQueuedPreviewVoice = {
+            mixxx::audio::kInvalidFramePos, PreviewVoiceRequest::None};
+    PreviewVoiceState m_previewVoiceState;
+    // Read position of the preview voice in (fractional) track frames.
+    double m_previewVoicePos;
+    // Preview voice gain at the end of the previous callback, used for
+    // click-free ramps on start and stop.
+    CSAMPLE_GAIN m_previewVoiceGainOld;
+    // Scratch buffer holding the frames read for the preview voice at
+    // the track's native sample rate before resampling.
+    CSAMPLE* m_pPreviewVoiceBuffer;
+
     // Is true if the previous buffer was silent due to pausing
     QAtomicInt m_iTrackLoading;
     bool m_bPlayAfterLoading;
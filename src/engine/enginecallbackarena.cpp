@@ -0,0 +1,63 @@
+#include "engine/enginecallbackarena.h"
+
+#include "util/assert.h"
+#include "util/defs.h"
+#include "util/memorylock.h"
+#include "util/sample.h"
+
+namespace {
+
+// Keep allocations on cache line boundaries so that consecutive arena
+// buffers do not share a cache line.
+constexpr SINT kAlignmentSamples = 64 / sizeof(CSAMPLE);
+
+// Upper bound for the sum of all temporaries that are alive at the same
+// time. The deepest processing call graph (effects manager and effect
+// chain, two full-length intermediate buffers each) needs four times
+// kMaxEngineSamples; the remainder is headroom for future callers.
+constexpr SINT kCapacitySamples = 16 * kMaxEngineSamples;
+
+// The arena block is confined to the thread that processes the audio
+// callback. It is allocated on first use, which happens once during the
+// first callback and is therefore harmless, and freed on thread exit.
+struct ArenaStorage {
+    ~ArenaStorage() {
+        SampleUtil::free(pBlock);
+    }
+
+    CSAMPLE* pBlock = nullptr;
+    SINT offset = 0;
+};
+
+thread_local ArenaStorage s_arena;
+
+} // namespace
+
+EngineCallbackArena::Scope::Scope()
+        : m_savedOffset(s_arena.offset) {
+}
+
+EngineCallbackArena::Scope::~Scope() {
+    s_arena.offset = m_savedOffset;
+}
+
+CSAMPLE* EngineCallbackArena::Scope::allocate(SINT numSamples) {
+    DEBUG_ASSERT(numSamples >= 0);
+    if (!s_arena.pBlock) {
+        s_arena.pBlock = SampleUtil::alloc(kCapacitySamples);
+        // One-time syscall during the first callback of the thread;
+        // afterwards the arena never faults.
+        mixxx::MemoryLock::lockAndPrefault(s_arena.pBlock,
+                sizeof(CSAMPLE) * kCapacitySamples,
+                "engine callback arena");
+    }
+    const SINT alignedSamples =
+            (numSamples + kAlignmentSamples - 1) & ~(kAlignmentSamples - 1);
+    VERIFY_OR_DEBUG_ASSERT(
+            s_arena.offset + alignedSamples <= kCapacitySamples) {
+        return nullptr;
+    }
+    CSAMPLE* pBuffer = s_arena.pBlock + s_arena.offset;
+    s_arena.offset += alignedSamples;
+    return pBuffer;
+}
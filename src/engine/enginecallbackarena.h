@@ -0,0 +1,43 @@
+#pragma once
+
+#include "util/types.h"
+
+/// Bump allocator for temporary sample buffers that only live for the
+/// duration of a single processing call inside the audio callback.
+///
+/// Without it, every effects unit holds its own full-length member
+/// buffers, scattering the callback's scratch working set across the
+/// heap. The arena hands out all temporaries from one contiguous,
+/// SIMD-aligned, thread-local block and sizes them to the actual
+/// buffer length, so the scratch memory touched per callback shrinks
+/// to a few contiguous pages.
+///
+/// Usage:
+///     EngineCallbackArena::Scope scope;
+///     CSAMPLE* pTemp = scope.allocate(numSamples);
+///
+/// Buffers are valid until the scope is destroyed, which rewinds the
+/// arena to its state at scope construction. Scopes may nest, e.g.
+/// when an effect chain allocates inside the effects manager's
+/// processing call. The arena is confined to the calling thread; the
+/// backing block is allocated on first use and sized so that the
+/// engine's processing call graph can never exhaust it.
+class EngineCallbackArena {
+  public:
+    class Scope {
+      public:
+        Scope();
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+
+        /// Returns a SIMD-aligned, uninitialized buffer of numSamples
+        /// samples that is valid until this scope is destroyed, or
+        /// nullptr if the arena is exhausted (which indicates a bug,
+        /// see kCapacitySamples).
+        CSAMPLE* allocate(SINT numSamples);
+
+      private:
+        const SINT m_savedOffset;
+    };
+};
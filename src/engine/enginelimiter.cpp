@@ -0,0 +1,162 @@
+#include "engine/enginelimiter.h"
+
+#include <cmath>
+
+#include "control/controlproxy.h"
+#include "engine/engine.h"
+#include "moc_enginelimiter.cpp"
+#include "util/math.h"
+#include "util/sample.h"
+
+namespace {
+
+// Lookahead of the gain envelope. The main output is delayed by this amount
+// while the limiter is enabled. Short enough to stay unnoticeable on top of
+// the output latency, long enough to span the transient of a kick drum.
+constexpr double kLookaheadMs = 2.5;
+
+// Release time constant of the gain envelope. Short enough to recover
+// quickly after a single overshoot, long enough to avoid audible pumping
+// on sustained program material.
+constexpr double kReleaseMs = 50.0;
+
+// Frames the lookahead ring buffer must be able to hold at the maximum
+// supported sample rate.
+constexpr int kMaxLookaheadFrames = static_cast<int>(
+                                            kLookaheadMs / 1000 * mixxx::audio::SampleRate::kValueMax) +
+        1;
+const int kMaxLookaheadSamples = kMaxLookaheadFrames * mixxx::kEngineChannelOutputCount;
+
+// While releasing, the envelope is snapped back to unity once it has come
+// this close to 1.0, so that the cheap delay-only path can be taken again.
+constexpr CSAMPLE_GAIN kUnityGainEpsilon = 1e-4f;
+
+// Epsilon for publishing the gain reduction control. Like the vu meter
+// controls, the value changes on almost every callback while limiting, so
+// an exact no-op check in ControlObject would rarely apply.
+constexpr double kGainReductionEpsilon = 1e-4;
+
+const QString kAppGroup = QStringLiteral("[App]");
+
+} // namespace
+
+EngineLimiter::EngineLimiter(const QString& group)
+        : m_limiterEnabled(ConfigKey(group, QStringLiteral("limiter_enabled")), true, 0.0),
+          m_gainReduction(ConfigKey(group, QStringLiteral("limiter_gain_reduction"))),
+          m_lookaheadBuffer(kMaxLookaheadSamples),
+          m_ringPos(0),
+          m_lookaheadSamples(0),
+          m_gain(CSAMPLE_GAIN_ONE),
+          m_releasePerFrame(0.0f),
+          m_gainReductionOld(0.0),
+          m_wasProcessing(false) {
+    m_limiterEnabled.setButtonMode(mixxx::control::ButtonMode::Toggle);
+    m_lookaheadBuffer.clear();
+
+    m_pSampleRate = new ControlProxy(kAppGroup, QStringLiteral("samplerate"), this);
+    m_pSampleRate->connectValueChanged(this,
+            &EngineLimiter::slotSampleRateChanged,
+            Qt::DirectConnection);
+    slotSampleRateChanged();
+}
+
+void EngineLimiter::slotSampleRateChanged() {
+    const double sampleRate = m_pSampleRate->get();
+    if (sampleRate <= 0) {
+        return;
+    }
+
+    int lookaheadFrames = static_cast<int>(sampleRate * kLookaheadMs / 1000);
+    if (lookaheadFrames > kMaxLookaheadFrames) {
+        lookaheadFrames = kMaxLookaheadFrames;
+    }
+    m_lookaheadSamples = lookaheadFrames * mixxx::kEngineChannelOutputCount;
+    // One-pole release towards unity, evaluated once per frame.
+    m_releasePerFrame = static_cast<CSAMPLE_GAIN>(
+            1.0 - std::exp(-1000.0 / (kReleaseMs * sampleRate)));
+    reset();
+}
+
+void EngineLimiter::reset() {
+    m_lookaheadBuffer.clear();
+    m_ringPos = 0;
+    m_gain = CSAMPLE_GAIN_ONE;
+    publishGainReduction(0.0);
+}
+
+void EngineLimiter::publishGainReduction(double gainReduction) {
+    if (fabs(gainReduction - m_gainReductionOld) > kGainReductionEpsilon) {
+        m_gainReductionOld = gainReduction;
+        m_gainReduction.set(gainReduction);
+    }
+}
+
+void EngineLimiter::process(CSAMPLE* pInOut, const std::size_t bufferSize) {
+    if (!m_limiterEnabled.toBool()) {
+        if (m_wasProcessing) {
+            // Drop the lookahead delay together with the leftover ring
+            // buffer contents when the limiter is switched off.
+            reset();
+            m_wasProcessing = false;
+        }
+        return;
+    }
+    m_wasProcessing = true;
+    if (m_lookaheadSamples <= 0) {
+        return;
+    }
+
+    // The "+ kMaxLookaheadSamples" addition ensures positive values for the
+    // modulo calculation, see EngineDelay::process.
+    int ringSourcePos = (m_ringPos + kMaxLookaheadSamples - m_lookaheadSamples) %
+            kMaxLookaheadSamples;
+
+    const CSAMPLE blockMax = SampleUtil::maxAbsAmplitude(
+            pInOut, static_cast<SINT>(bufferSize));
+    if (blockMax <= CSAMPLE_PEAK && m_gain > CSAMPLE_GAIN_ONE - kUnityGainEpsilon) {
+        // Nothing to limit and the envelope has fully released: only the
+        // lookahead delay has to be maintained. The block peak scan above
+        // is vectorized, so this path adds close to no CPU cost.
+        m_gain = CSAMPLE_GAIN_ONE;
+        for (std::size_t i = 0; i < bufferSize; ++i) {
+            m_lookaheadBuffer[m_ringPos] = pInOut[i];
+            m_ringPos = (m_ringPos + 1) % kMaxLookaheadSamples;
+            pInOut[i] = m_lookaheadBuffer[ringSourcePos];
+            ringSourcePos = (ringSourcePos + 1) % kMaxLookaheadSamples;
+        }
+        publishGainReduction(0.0);
+        return;
+    }
+
+    CSAMPLE_GAIN minGain = m_gain;
+    for (std::size_t i = 0; i + 1 < bufferSize; i += 2) {
+        const CSAMPLE framePeak = math_max(
+                std::abs(pInOut[i]), std::abs(pInOut[i + 1]));
+        if (framePeak > CSAMPLE_PEAK) {
+            const CSAMPLE_GAIN targetGain = CSAMPLE_PEAK / framePeak;
+            if (targetGain < m_gain) {
+                // Attack instantly; the lookahead delay below makes the
+                // reduction effective before the peak reaches the output.
+                m_gain = targetGain;
+            }
+        } else {
+            m_gain += m_releasePerFrame * (CSAMPLE_GAIN_ONE - m_gain);
+        }
+        minGain = math_min(minGain, m_gain);
+
+        m_lookaheadBuffer[m_ringPos] = pInOut[i];
+        m_lookaheadBuffer[m_ringPos + 1] = pInOut[i + 1];
+        m_ringPos = (m_ringPos + 2) % kMaxLookaheadSamples;
+        // While the envelope is still releasing after an overshoot, the
+        // delayed peak leaves the ring buffer with marginally less
+        // reduction than it triggered. Clamping catches this residual,
+        // which stays well below the audibility threshold.
+        pInOut[i] = SampleUtil::clampSample(
+                m_lookaheadBuffer[ringSourcePos] * m_gain);
+        pInOut[i + 1] = SampleUtil::clampSample(
+                m_lookaheadBuffer[ringSourcePos + 1] * m_gain);
+        ringSourcePos = (ringSourcePos + 2) % kMaxLookaheadSamples;
+    }
+
+    publishGainReduction(static_cast<double>(CSAMPLE_GAIN_ONE - minGain));
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "control/controlobject.h"
+#include "control/controlpushbutton.h"
+#include "engine/engineobject.h"
+#include "util/samplebuffer.h"
+
+class ControlProxy;
+
+/// Optional brickwall limiter for the main output.
+///
+/// The signal is delayed by a fixed lookahead so that the gain envelope can
+/// react to a peak before it reaches the output. The envelope attacks
+/// instantly and releases with a short time constant, which keeps the
+/// limiting transparent for the occasional overshoot while a constant
+/// overdrive results in a plain gain reduction instead of clipping
+/// distortion.
+///
+/// While the limiter is enabled the output latency grows by the lookahead
+/// time, independent of whether the limiter is currently reducing gain.
+/// When it is disabled the signal passes through untouched.
+///
+/// The current gain reduction (1.0 - gain, range [0, 1]) is published via
+/// the "limiter_gain_reduction" control for skin meters, analogous to the
+/// vu meter controls.
+class EngineLimiter : public EngineObject {
+    Q_OBJECT
+  public:
+    EngineLimiter(const QString& group);
+    ~EngineLimiter() override = default;
+
+    void process(CSAMPLE* pInOut, const std::size_t bufferSize) override;
+
+  public slots:
+    void slotSampleRateChanged();
+
+  private:
+    void reset();
+    void publishGainReduction(double gainReduction);
+
+    ControlPushButton m_limiterEnabled;
+    ControlObject m_gainReduction;
+    ControlProxy* m_pSampleRate;
+
+    mixxx::SampleBuffer m_lookaheadBuffer;
+    int m_ringPos;
+    int m_lookaheadSamples;
+    CSAMPLE_GAIN m_gain;
+    CSAMPLE_GAIN m_releasePerFrame;
+    // Mirrors the published control so it is only touched when the value
+    // actually changes (see EngineVuMeter).
+    double m_gainReductionOld;
+    bool m_wasProcessing;
+};
@@ -13,6 +13,7 @@
 #include "engine/effects/engineeffectsmanager.h"
 #include "engine/enginebuffer.h"
 #include "engine/enginedelay.h"
+#include "engine/enginelimiter.h"
 #include "engine/enginetalkoverducking.h"
 #include "engine/enginevumeter.h"
 #include "engine/engineworkerscheduler.h"
@@ -27,6 +28,7 @@
 #include "util/parented_ptr.h"
 #include "util/sample.h"
 #include "util/samplebuffer.h"
+#include "util/timer.h"
 
 namespace {
 const QString kAppGroup = QStringLiteral("[App]");
@@ -93,6 +95,7 @@ EngineMixer::EngineMixer(UserSettingsPointer pConfig,
                   ConfigKey(group, "boothDelay"))),
           m_pLatencyCompensationDelay(std::make_unique<EngineDelay>(
                   ConfigKey(group, "microphoneLatencyCompensation"))),
+          m_pLimiter(std::make_unique<EngineLimiter>(group)),
           m_pVumeter(std::make_unique<EngineVuMeter>(kMainGroup, kLegacyGroup)),
           // Starts a thread for recording and broadcast
           m_pEngineSideChain(bEnableSidechain
@@ -121,6 +124,8 @@ EngineMixer::EngineMixer(UserSettingsPointer pConfig,
                   ConfigKey(EngineXfader::kXfaderConfigKey, "xFaderReverse"))),
           m_pHeadSplitEnabled(std::make_unique<ControlPushButton>(
                   ConfigKey(group, "headSplit"), true, 0.0)),
+          m_pBusCrossfaderBypass(std::make_unique<ControlPushButton>(
+                  ConfigKey(group, "busCrossfaderBypass"), true, 0.0)),
 
           m_pKeylockEngine(std::make_unique<ControlObject>(
                   ConfigKey(kAppGroup, QStringLiteral("keylock_engine")),
@@ -136,6 +141,8 @@ EngineMixer::EngineMixer(UserSettingsPointer pConfig,
           m_duckingGainOld(1.0),
           m_balleftOld(1.0),
           m_balrightOld(1.0),
+          m_busCrossfaderLeftGainOld(1.0),
+          m_busCrossfaderRightGainOld(1.0),
           m_numMicsConfigured(0),
           m_mainHandle(registerChannelGroup(group)),
           m_headphoneHandle(registerChannelGroup("[Headphone]")),
@@ -205,6 +212,7 @@ EngineMixer::EngineMixer(UserSettingsPointer pConfig,
     // X-Fader Setup
     m_pXFaderMode->setButtonMode(mixxx::control::ButtonMode::Toggle);
     m_pXFaderReverse->setButtonMode(mixxx::control::ButtonMode::Toggle);
+    m_pBusCrossfaderBypass->setButtonMode(mixxx::control::ButtonMode::Toggle);
 
     m_pBoothEnabled->setReadOnly();
     m_pHeadphoneEnabled->setReadOnly();
@@ -214,6 +222,10 @@ EngineMixer::EngineMixer(UserSettingsPointer pConfig,
 
 EngineMixer::~EngineMixer() = default;
 
+std::span<CSAMPLE> EngineMixer::getWritableMainBuffer() {
+    return m_main.span();
+}
+
 std::span<const CSAMPLE> EngineMixer::getMainBuffer() const {
     return m_main.span();
 }
@@ -367,6 +379,7 @@ void EngineMixer::process(const std::size_t bufferSize) {
         haveSetName = true;
     }
     // Trace t("EngineMixer::process");
+    ScopedTimer timer(kHistogramComputeFlags, QStringLiteral("EngineMixer::process"));
 
     bool mainEnabled = m_pMainEnabled->toBool();
     bool boothEnabled = m_pBoothEnabled->toBool();
@@ -378,7 +391,7 @@ void EngineMixer::process(const std::size_t bufferSize) {
     const unsigned int iFrames = static_cast<unsigned int>(bufferSize) / kChannels;
 
     if (m_pEngineEffectsManager) {
-        m_pEngineEffectsManager->onCallbackStart();
+        m_pEngineEffectsManager->onCallbackStart(iFrames);
     }
 
     // Prepare all channels for output
@@ -467,7 +480,20 @@ void EngineMixer::process(const std::size_t bufferSize) {
         m_pTalkoverDucking->setAboveThreshold(false);
         break;
     case EngineTalkoverDucking::AUTO:
-        m_pTalkoverDucking->processKey(m_talkover.data(), bufferSize);
+        if (m_activeTalkoverChannels.isEmpty() &&
+                (!m_pEngineEffectsManager ||
+                        !m_pEngineEffectsManager->needsPostFaderProcessing(
+                                m_busTalkoverHandle.handle(),
+                                m_mainHandle.handle()))) {
+            // Without an active or fading out talkover channel the talkover
+            // buffer contains only silence, so there is no need to scan it
+            // for a signal above the ducking threshold. An effect on the
+            // talkover bus could still leave a tail in the buffer, in which
+            // case the scan must run as usual.
+            m_pTalkoverDucking->setAboveThreshold(false);
+        } else {
+            m_pTalkoverDucking->processKey(m_talkover.data(), bufferSize);
+        }
         break;
     case EngineTalkoverDucking::MANUAL:
         m_pTalkoverDucking->setAboveThreshold(!m_activeTalkoverChannels.isEmpty());
@@ -480,16 +506,32 @@ void EngineMixer::process(const std::size_t bufferSize) {
 
     // Calculate the crossfader gains for left and right side of the crossfader
     CSAMPLE_GAIN crossfaderLeftGain, crossfaderRightGain;
-    EngineXfader::getXfadeGains(m_pCrossfader->get(), m_pXFaderCurve->get(),
-                                m_pXFaderCalibration->get(),
-                                m_pXFaderMode->get(),
-                                m_pXFaderReverse->toBool(),
-                                &crossfaderLeftGain, &crossfaderRightGain);
+    EngineXfader::getXfadeGains(&m_xfadeGainCache,
+            m_pCrossfader->get(),
+            m_pXFaderCurve->get(),
+            m_pXFaderCalibration->get(),
+            m_pXFaderMode->get(),
+            m_pXFaderReverse->toBool(),
+            &crossfaderLeftGain,
+            &crossfaderRightGain);
 
     // Make the mix for each crossfader orientation output bus.
     // m_mainGain takes care of applying the attenuation from
     // channel volume faders and crossfader.
-    m_mainGain.setGains(crossfaderLeftGain, 1.0f, crossfaderRightGain);
+    //
+    // With the crossfader bypass enabled the crossfader attenuation is
+    // deferred until the buses are summed into the main mix below. Each
+    // bus output then carries the full-volume mix of its assigned decks,
+    // which makes the three buses usable as independent zone mixes on
+    // separate (clock reference synchronized) sound devices, e.g. for
+    // multi-zone silent disco rigs, while the main, booth and
+    // record/broadcast outputs still follow the crossfader.
+    const bool busCrossfaderBypass = m_pBusCrossfaderBypass->toBool();
+    if (busCrossfaderBypass) {
+        m_mainGain.setGains(1.0f, 1.0f, 1.0f);
+    } else {
+        m_mainGain.setGains(crossfaderLeftGain, 1.0f, crossfaderRightGain);
+    }
 
     for (int o = EngineChannel::LEFT; o <= EngineChannel::RIGHT; o++) {
         ChannelMixer::applyEffectsInPlaceAndMixChannels(m_mainGain,
@@ -535,15 +577,26 @@ void EngineMixer::process(const std::size_t bufferSize) {
     }
 
     if (mainEnabled) {
-        // Mix the crossfader orientation buffers together into the main mix
-        SampleUtil::copy3WithGain(m_main.data(),
+        // Mix the crossfader orientation buffers together into the main mix.
+        // If the bus outputs bypass the crossfader, its attenuation is
+        // applied here instead, see above.
+        const CSAMPLE_GAIN busLeftGain =
+                busCrossfaderBypass ? crossfaderLeftGain : 1.0f;
+        const CSAMPLE_GAIN busRightGain =
+                busCrossfaderBypass ? crossfaderRightGain : 1.0f;
+        SampleUtil::copy3WithRampingGain(m_main.data(),
                 m_outputBusBuffers[EngineChannel::LEFT].data(),
-                1.0,
+                m_busCrossfaderLeftGainOld,
+                busLeftGain,
                 m_outputBusBuffers[EngineChannel::CENTER].data(),
                 1.0,
-                m_outputBusBuffers[EngineChannel::RIGHT].data(),
                 1.0,
+                m_outputBusBuffers[EngineChannel::RIGHT].data(),
+                m_busCrossfaderRightGainOld,
+                busRightGain,
                 static_cast<int>(bufferSize));
+        m_busCrossfaderLeftGainOld = busLeftGain;
+        m_busCrossfaderRightGainOld = busRightGain;
 
         MicMonitorMode configuredMicMonitorMode = static_cast<MicMonitorMode>(
             static_cast<int>(m_pMicMonitorMode->get()));
@@ -777,6 +830,10 @@ void EngineMixer::process(const std::size_t bufferSize) {
 
     if (mainEnabled) {
         m_pMainDelay->process(m_main.data(), bufferSize);
+        // Optional final-stage limiter after all gain, effect, balance and
+        // delay processing. Runs on the hardware output only, so the
+        // record/broadcast mix taken above is not affected.
+        m_pLimiter->process(m_main.data(), bufferSize);
     } else {
         m_main.clear(bufferSize);
     }
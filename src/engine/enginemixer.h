@@ -13,11 +13,13 @@
 #include "engine/channels/enginechannel.h"
 #include "engine/effects/groupfeaturestate.h"
 #include "engine/engineobject.h"
+#include "engine/enginexfader.h"
 #include "preferences/usersettings.h"
 #include "recording/recordingmanager.h"
 #include "soundio/soundmanager.h"
 #include "soundio/soundmanagerutil.h"
 #include "util/parented_ptr.h"
+#include "util/realtimesafety.h"
 #include "util/samplebuffer.h"
 #include "util/types.h"
 
@@ -31,6 +33,7 @@ class EngineEffectsManager;
 class EngineSync;
 class EngineTalkoverDucking;
 class EngineDelay;
+class EngineLimiter;
 
 // The number of channels to pre-allocate in various structures in the
 // engine. Prevents memory allocation in EngineMixer::addChannel.
@@ -73,7 +76,7 @@ class EngineMixer : public QObject, public AudioSource {
     void onInputConnected(const AudioInput& input);
     void onInputDisconnected(const AudioInput& input);
 
-    void process(const std::size_t bufferSize);
+    void process(const std::size_t bufferSize) MIXXX_RT_NONBLOCKING;
 
     // Add an EngineChannel to the mixing engine. This is not thread safe --
     // only call it before the engine has started mixing.
@@ -99,6 +102,10 @@ class EngineMixer : public QObject, public AudioSource {
         return m_pEngineSync.get();
     }
 
+    // Writable view of the main output buffer. SoundManager overlays the
+    // loopback latency test signal here after mixing.
+    std::span<CSAMPLE> getWritableMainBuffer();
+
     // These are really only exposed for tests to use.
     std::span<const CSAMPLE> getMainBuffer() const;
     std::span<const CSAMPLE> getBoothBuffer() const;
@@ -132,14 +139,15 @@ class EngineMixer : public QObject, public AudioSource {
         bool m_fadeout;
     };
 
-    class GainCalculator {
-      public:
-        virtual ~GainCalculator() = default;
-        virtual CSAMPLE_GAIN getGain(ChannelInfo* pChannelInfo) const = 0;
-    };
-    class PflGainCalculator final : public GainCalculator {
+    // The gain calculators all provide
+    //     CSAMPLE_GAIN getGain(ChannelInfo* pChannelInfo) const
+    // and are passed to the ChannelMixer mix loops as a template
+    // parameter, so the per-channel gain computation is statically
+    // dispatched and inlined instead of going through a virtual call
+    // per channel per callback.
+    class PflGainCalculator {
       public:
-        inline CSAMPLE_GAIN getGain(ChannelInfo* pChannelInfo) const override {
+        inline CSAMPLE_GAIN getGain(ChannelInfo* pChannelInfo) const {
             Q_UNUSED(pChannelInfo);
             return m_dGain;
         }
@@ -150,13 +158,13 @@ class EngineMixer : public QObject, public AudioSource {
       private:
         CSAMPLE_GAIN m_dGain;
     };
-    class TalkoverGainCalculator final : public GainCalculator {
+    class TalkoverGainCalculator {
       public:
-        inline CSAMPLE_GAIN getGain(ChannelInfo* pChannelInfo) const override {
+        inline CSAMPLE_GAIN getGain(ChannelInfo* pChannelInfo) const {
             return static_cast<CSAMPLE_GAIN>(pChannelInfo->m_pVolumeControl->get());
         }
     };
-    class OrientationVolumeGainCalculator final : public GainCalculator {
+    class OrientationVolumeGainCalculator {
       public:
         OrientationVolumeGainCalculator()
                 : m_dLeftGain(1.0),
@@ -164,7 +172,7 @@ class EngineMixer : public QObject, public AudioSource {
                   m_dRightGain(1.0) {
         }
 
-        inline CSAMPLE_GAIN getGain(ChannelInfo* pChannelInfo) const override {
+        inline CSAMPLE_GAIN getGain(ChannelInfo* pChannelInfo) const {
             const CSAMPLE_GAIN channelVolume = static_cast<CSAMPLE_GAIN>(
                     pChannelInfo->m_pVolumeControl->get());
             const CSAMPLE_GAIN orientationGain = EngineMixer::gainForOrientation(
@@ -311,6 +319,7 @@ class EngineMixer : public QObject, public AudioSource {
     std::unique_ptr<EngineDelay> m_pHeadDelay;
     std::unique_ptr<EngineDelay> m_pBoothDelay;
     std::unique_ptr<EngineDelay> m_pLatencyCompensationDelay;
+    std::unique_ptr<EngineLimiter> m_pLimiter;
 
     std::unique_ptr<EngineVuMeter> m_pVumeter;
     std::unique_ptr<EngineSideChain> m_pEngineSideChain;
@@ -323,11 +332,13 @@ class EngineMixer : public QObject, public AudioSource {
     std::unique_ptr<ControlPotmeter> m_pXFaderCalibration;
     std::unique_ptr<ControlPushButton> m_pXFaderReverse;
     std::unique_ptr<ControlPushButton> m_pHeadSplitEnabled;
+    std::unique_ptr<ControlPushButton> m_pBusCrossfaderBypass;
     std::unique_ptr<ControlObject> m_pKeylockEngine;
 
     PflGainCalculator m_headphoneGain;
     TalkoverGainCalculator m_talkoverGain;
     OrientationVolumeGainCalculator m_mainGain;
+    EngineXfader::GainCache m_xfadeGainCache{};
     CSAMPLE_GAIN m_mainGainOld;
     CSAMPLE_GAIN m_boothGainOld;
     CSAMPLE_GAIN m_headphoneMainGainOld;
@@ -335,6 +346,8 @@ class EngineMixer : public QObject, public AudioSource {
     CSAMPLE_GAIN m_duckingGainOld;
     CSAMPLE_GAIN m_balleftOld;
     CSAMPLE_GAIN m_balrightOld;
+    CSAMPLE_GAIN m_busCrossfaderLeftGainOld;
+    CSAMPLE_GAIN m_busCrossfaderRightGainOld;
     std::atomic<unsigned int> m_numMicsConfigured;
     const ChannelHandleAndGroup m_mainHandle;
     const ChannelHandleAndGroup m_headphoneHandle;
@@ -2,6 +2,7 @@
 
 #include <QObject>
 
+#include "util/realtimesafety.h"
 #include "util/types.h"
 
 struct GroupFeatureState;
@@ -12,7 +13,7 @@ class EngineObject : public QObject {
     EngineObject();
     ~EngineObject() override;
     virtual void process(CSAMPLE* pInOut,
-            const std::size_t bufferSize) = 0;
+            const std::size_t bufferSize) MIXXX_RT_NONBLOCKING = 0;
 
     // Sub-classes re-implement and populate GroupFeatureState with the features
     // they extract.
@@ -27,5 +28,7 @@ class EngineObjectConstIn : public QObject {
     EngineObjectConstIn();
     ~EngineObjectConstIn() override;
 
-    virtual void process(const CSAMPLE* pIn, CSAMPLE* pOut, const std::size_t bufferSize) = 0;
+    virtual void process(const CSAMPLE* pIn,
+            CSAMPLE* pOut,
+            const std::size_t bufferSize) MIXXX_RT_NONBLOCKING = 0;
 };
@@ -27,8 +27,10 @@ EnginePregain::EnginePregain(const QString& group)
           m_dOldSpeed(0.0),
           m_dNonScratchSpeed(1.0),
           m_scratching(false),
+          m_dTrackPositionSeconds(0.0),
           m_fPrevGain(1.0),
-          m_bSmoothFade(false) {
+          m_bSmoothFade(false),
+          m_loudnessEnvelopePending(false) {
     m_pPotmeterPregain = new ControlAudioTaperPot(ConfigKey(group, "pregain"), -12, 12, 0.5);
     //Replay Gain things
     m_pCOReplayGain = new ControlObject(ConfigKey(group, "replaygain"));
@@ -64,7 +66,28 @@ void EnginePregain::setSpeedAndScratching(double speed, bool scratching) {
     m_scratching = scratching;
 }
 
+void EnginePregain::setLoudnessEnvelope(
+        mixxx::LoudnessEnvelopePointer pLoudnessEnvelope) {
+    const auto locked = lockMutex(&m_loudnessEnvelopeMutex);
+    m_pPendingLoudnessEnvelope = std::move(pLoudnessEnvelope);
+    m_loudnessEnvelopePending.store(true, std::memory_order_release);
+}
+
+void EnginePregain::setTrackPositionSeconds(double seconds) {
+    m_dTrackPositionSeconds = seconds;
+}
+
 void EnginePregain::process(CSAMPLE* pInOut, const std::size_t bufferSize) {
+    if (m_loudnessEnvelopePending.load(std::memory_order_acquire) &&
+            m_loudnessEnvelopeMutex.tryLock()) {
+        // Swapping instead of assigning leaves the previous envelope in
+        // the pending slot, where the main thread releases it on the
+        // next handover. A missed tryLock() just retries next callback.
+        m_pLoudnessEnvelope.swap(m_pPendingLoudnessEnvelope);
+        m_loudnessEnvelopePending.store(false, std::memory_order_release);
+        m_loudnessEnvelopeMutex.unlock();
+    }
+
     const auto fReplayGain = static_cast<CSAMPLE_GAIN>(m_pCOReplayGain->get());
     CSAMPLE_GAIN fReplayGainCorrection;
     if (!s_pEnableReplayGain->toBool() || m_pPassthroughEnabled->toBool()) {
@@ -88,8 +111,16 @@ void EnginePregain::process(CSAMPLE* pInOut, const std::size_t bufferSize) {
         // full process for one second.
         // So we need to alter gain each time ::process is called.
 
-        const CSAMPLE_GAIN fullReplayGainBoost =
+        CSAMPLE_GAIN fullReplayGainBoost =
                 fReplayGain * static_cast<CSAMPLE_GAIN>(s_pReplayGainBoost->get());
+        if (m_pLoudnessEnvelope) {
+            // Time-varying loudness normalization on top of the static
+            // ReplayGain value. All curve math happened at analysis
+            // time, this is a single table lerp per buffer; the ramping
+            // gain branch below smooths the step between buffers.
+            fullReplayGainBoost *=
+                    m_pLoudnessEnvelope->gainAtSeconds(m_dTrackPositionSeconds);
+        }
 
         // This means that a ReplayGain value has been calculated after the
         // track has been loaded
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <atomic>
+
 #include "engine/engineobject.h"
+#include "track/loudnessenvelope.h"
+#include "util/compatibility/qmutex.h"
 #include "util/performancetimer.h"
 
 class ControlAudioTaperPot;
@@ -23,6 +27,15 @@ class EnginePregain : public EngineObject {
     // reversed without a ramp to zero.
     void setSpeedAndScratching(double speed, bool scratching);
 
+    // Called from the main thread when a track or its loudness analysis is
+    // loaded or unloaded. The envelope is handed over to the audio thread
+    // without ever blocking it.
+    void setLoudnessEnvelope(mixxx::LoudnessEnvelopePointer pLoudnessEnvelope);
+
+    // Called once per callback from EngineDeck::process with the current
+    // play position, used to look up the envelope gain.
+    void setTrackPositionSeconds(double seconds);
+
     void process(CSAMPLE* pInOut, const std::size_t bufferSize) override;
 
     void collectFeatures(GroupFeatureState* pGroupFeatures) const override;
@@ -32,6 +45,7 @@ class EnginePregain : public EngineObject {
     double m_dOldSpeed;
     double m_dNonScratchSpeed;
     bool m_scratching;
+    double m_dTrackPositionSeconds;
     CSAMPLE_GAIN m_fPrevGain;
     ControlAudioTaperPot* m_pPotmeterPregain;
     ControlObject* m_pTotalGain;
@@ -42,4 +56,13 @@ class EnginePregain : public EngineObject {
     static ControlObject* s_pEnableReplayGain;
     bool m_bSmoothFade;
     PerformanceTimer m_timer;
+
+    // Only touched by the audio thread.
+    mixxx::LoudnessEnvelopePointer m_pLoudnessEnvelope;
+    // Handover slot guarded by m_loudnessEnvelopeMutex. After a swap in
+    // process() it holds the previous envelope, so the last reference is
+    // never dropped on the audio thread.
+    mixxx::LoudnessEnvelopePointer m_pPendingLoudnessEnvelope;
+    QMutex m_loudnessEnvelopeMutex;
+    std::atomic<bool> m_loudnessEnvelopePending;
 };
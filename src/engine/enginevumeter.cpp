@@ -87,28 +87,42 @@ void EngineVuMeter::process(CSAMPLE* pIn, const std::size_t bufferSize) {
         m_fRMSvolumeSumR = 0;
     }
 
+    // Only publish peak indicator transitions. Setting the controls once
+    // per callback is a no-op most of the time, but still fans out through
+    // the control value atomics for every vu meter in the engine.
+    bool peakActiveL = m_peakActiveL;
     if (clipped & SampleUtil::CLIPPING_LEFT) {
-        m_peakIndicatorLeft.set(1.0);
+        peakActiveL = true;
         m_peakDurationL = static_cast<int>(kPeakDuration * sampleRate / bufferSize / 2000);
     } else if (m_peakDurationL <= 0) {
-        m_peakIndicatorLeft.set(0.0);
+        peakActiveL = false;
     } else {
         --m_peakDurationL;
     }
+    if (peakActiveL != m_peakActiveL) {
+        m_peakActiveL = peakActiveL;
+        m_peakIndicatorLeft.set(peakActiveL ? 1.0 : 0.0);
+    }
 
+    bool peakActiveR = m_peakActiveR;
     if (clipped & SampleUtil::CLIPPING_RIGHT) {
-        m_peakIndicatorRight.set(1.0);
+        peakActiveR = true;
         m_peakDurationR = static_cast<int>(kPeakDuration * sampleRate / bufferSize / 2000);
     } else if (m_peakDurationR <= 0) {
-        m_peakIndicatorRight.set(0.0);
+        peakActiveR = false;
     } else {
         --m_peakDurationR;
     }
+    if (peakActiveR != m_peakActiveR) {
+        m_peakActiveR = peakActiveR;
+        m_peakIndicatorRight.set(peakActiveR ? 1.0 : 0.0);
+    }
 
-    m_peakIndicator.set(
-            (m_peakIndicatorRight.toBool() || m_peakIndicatorLeft.toBool())
-                    ? 1.0
-                    : 0.0);
+    const bool peakActive = m_peakActiveL || m_peakActiveR;
+    if (peakActive != m_peakActive) {
+        m_peakActive = peakActive;
+        m_peakIndicator.set(peakActive ? 1.0 : 0.0);
+    }
 }
 
 void EngineVuMeter::doSmooth(CSAMPLE& currentVolume, CSAMPLE newVolume) {
@@ -138,6 +152,9 @@ void EngineVuMeter::reset() {
     m_fRMSvolumeSumL = 0;
     m_fRMSvolumeR = 0;
     m_fRMSvolumeSumR = 0;
+    m_peakActive = false;
+    m_peakActiveL = false;
+    m_peakActiveR = false;
     m_peakDurationL = 0;
     m_peakDurationR = 0;
 }
@@ -30,6 +30,11 @@ class EngineVuMeter : public EngineObject {
     ControlObject m_peakIndicator;
     ControlObject m_peakIndicatorLeft;
     ControlObject m_peakIndicatorRight;
+    // Mirror the published peak indicator states so that the controls are
+    // only touched on transitions instead of once per callback.
+    bool m_peakActive;
+    bool m_peakActiveL;
+    bool m_peakActiveR;
     int m_peakDurationL;
     int m_peakDurationR;
 
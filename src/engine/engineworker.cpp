@@ -5,7 +5,9 @@
 #include "util/assert.h"
 
 EngineWorker::EngineWorker()
-    : m_pScheduler(nullptr) {
+        : m_pScheduler(nullptr),
+          m_priority(static_cast<int>(Priority::BackgroundPrefetch)),
+          m_deadlineNanos(kNoDeadlineNanos) {
     m_notReady.test_and_set();
 }
 
@@ -24,13 +26,24 @@ void EngineWorker::setScheduler(EngineWorkerScheduler* pScheduler) {
 void EngineWorker::workReady() {
     m_notReady.clear();
     VERIFY_OR_DEBUG_ASSERT(m_pScheduler) {
-        return;     
+        return;
     }
     m_pScheduler->workerReady();
 }
 
+void EngineWorker::workReady(mixxx::Duration deadline) {
+    // Keep the earliest pending deadline. Only the engine callback writes
+    // the deadline, so a plain load/store is sufficient here.
+    const qint64 deadlineNanos = deadline.toIntegerNanos();
+    if (deadlineNanos < m_deadlineNanos.load(std::memory_order_relaxed)) {
+        m_deadlineNanos.store(deadlineNanos, std::memory_order_relaxed);
+    }
+    workReady();
+}
+
 void EngineWorker::wakeIfReady() {
     if (!m_notReady.test_and_set()) {
+        m_deadlineNanos.store(kNoDeadlineNanos, std::memory_order_relaxed);
         m_semaRun.release();
     }
 }
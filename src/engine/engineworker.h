@@ -1,10 +1,13 @@
 #pragma once
 
 #include <atomic>
+#include <limits>
 #include <QObject>
 #include <QSemaphore>
 #include <QThread>
 
+#include "util/duration.h"
+
 // EngineWorker is an interface for running background processing work when the
 // audio callback is not active. While the audio callback is active, an
 // EngineWorker can emit its workReady signal, and an EngineWorkerManager will
@@ -15,19 +18,53 @@ class EngineWorkerScheduler;
 class EngineWorker : public QThread {
     Q_OBJECT
   public:
+    // Priority lanes used by EngineWorkerScheduler to decide the order in
+    // which ready workers are woken up. Workers serving an audible deck are
+    // woken before workers prefetching for idle samplers, so a seek on the
+    // live deck is not queued behind background reads.
+    enum class Priority : int {
+        BackgroundPrefetch = 0,
+        Sampler = 1,
+        CuedDeck = 2,
+        AudibleDeck = 3,
+    };
+
+    static constexpr qint64 kNoDeadlineNanos = std::numeric_limits<qint64>::max();
+
     EngineWorker();
     virtual ~EngineWorker();
 
     virtual void run();
 
     void setScheduler(EngineWorkerScheduler* pScheduler);
+
+    // Both callable from the engine callback. The overload with a deadline
+    // (an absolute time as reported by mixxx::Time::elapsed()) marks work
+    // that the next callback actually needs; within the same priority lane
+    // the scheduler services the earliest deadline first, ahead of workers
+    // that became ready without a deadline.
     void workReady();
+    void workReady(mixxx::Duration deadline);
     void wakeIfReady();
 
+    void setWorkerPriority(Priority priority) {
+        m_priority.store(static_cast<int>(priority), std::memory_order_relaxed);
+    }
+    Priority workerPriority() const {
+        return static_cast<Priority>(m_priority.load(std::memory_order_relaxed));
+    }
+    // Deadline of the pending work in nanoseconds since application start,
+    // kNoDeadlineNanos if the pending work has no deadline.
+    qint64 deadlineNanos() const {
+        return m_deadlineNanos.load(std::memory_order_relaxed);
+    }
+
   protected:
     QSemaphore m_semaRun;
 
   private:
     EngineWorkerScheduler* m_pScheduler;
     std::atomic_flag m_notReady;
+    std::atomic<int> m_priority;
+    std::atomic<qint64> m_deadlineNanos;
 };
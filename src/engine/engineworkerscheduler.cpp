@@ -1,5 +1,7 @@
 #include "engine/engineworkerscheduler.h"
 
+#include <algorithm>
+
 #include "engine/engineworker.h"
 #include "moc_engineworkerscheduler.cpp"
 #include "util/compatibility/qmutex.h"
@@ -48,7 +50,20 @@ void EngineWorkerScheduler::run() {
         Event::start(tag);
         {
             const auto lock = lockMutex(&m_mutex);
-            for(const auto& pWorker: m_workers) {
+            // Wake workers in priority lane order, earliest deadline first
+            // within a lane, so reads that the next callback actually needs
+            // (e.g. a seek on an audible deck) are serviced before prefetch
+            // for idle samplers.
+            m_sortedWorkers = m_workers;
+            std::stable_sort(m_sortedWorkers.begin(),
+                    m_sortedWorkers.end(),
+                    [](const EngineWorker* pLhs, const EngineWorker* pRhs) {
+                        if (pLhs->workerPriority() != pRhs->workerPriority()) {
+                            return pLhs->workerPriority() > pRhs->workerPriority();
+                        }
+                        return pLhs->deadlineNanos() < pRhs->deadlineNanos();
+                    });
+            for (const auto& pWorker : m_sortedWorkers) {
                 pWorker->wakeIfReady();
             }
         }
@@ -30,5 +30,8 @@ class EngineWorkerScheduler : public QThread {
     QMutex m_mutex;
     // containing pointers are non-owning
     std::vector<EngineWorker*> m_workers;
+    // scratch copy of m_workers sorted by priority lane and deadline,
+    // only touched by the scheduler thread
+    std::vector<EngineWorker*> m_sortedWorkers;
     std::atomic<bool> m_bQuit;
 };
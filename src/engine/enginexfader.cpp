@@ -82,3 +82,46 @@ void EngineXfader::getXfadeGains(double xfadePosition,
         *gain2 = gain_temp;
     }
 }
+
+void EngineXfader::getXfadeGains(GainCache* pCache,
+        double xfadePosition,
+        double transform,
+        double powerCalibration,
+        double curve,
+        bool reverse,
+        CSAMPLE_GAIN* gain1,
+        CSAMPLE_GAIN* gain2) {
+    if (gain1 == nullptr || gain2 == nullptr) {
+        return;
+    }
+
+    if (pCache != nullptr && pCache->valid &&
+            pCache->xfadePosition == xfadePosition &&
+            pCache->transform == transform &&
+            pCache->powerCalibration == powerCalibration &&
+            pCache->curve == curve &&
+            pCache->reverse == reverse) {
+        *gain1 = pCache->gain1;
+        *gain2 = pCache->gain2;
+        return;
+    }
+
+    getXfadeGains(xfadePosition,
+            transform,
+            powerCalibration,
+            curve,
+            reverse,
+            gain1,
+            gain2);
+
+    if (pCache != nullptr) {
+        pCache->xfadePosition = xfadePosition;
+        pCache->transform = transform;
+        pCache->powerCalibration = powerCalibration;
+        pCache->curve = curve;
+        pCache->reverse = reverse;
+        pCache->valid = true;
+        pCache->gain1 = *gain1;
+        pCache->gain2 = *gain2;
+    }
+}
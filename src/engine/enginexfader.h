@@ -8,6 +8,21 @@
 
 class EngineXfader {
   public:
+    // Memoizes the gains computed for the last parameter set. The
+    // crossfader rests at the same position for the vast majority of
+    // engine callbacks, so keeping the previous result around avoids
+    // recomputing the transcendental curve math per callback.
+    struct GainCache {
+        double xfadePosition;
+        double transform;
+        double powerCalibration;
+        double curve;
+        bool reverse;
+        bool valid;
+        CSAMPLE_GAIN gain1;
+        CSAMPLE_GAIN gain2;
+    };
+
     static double getPowerCalibration(double transform);
     static void getXfadeGains(double xfadePosition,
             double transform,
@@ -16,6 +31,16 @@ class EngineXfader {
             bool reverse,
             CSAMPLE_GAIN* gain1,
             CSAMPLE_GAIN* gain2);
+    // Same as above, but serves repeated calls with unchanged
+    // parameters from pCache.
+    static void getXfadeGains(GainCache* pCache,
+            double xfadePosition,
+            double transform,
+            double powerCalibration,
+            double curve,
+            bool reverse,
+            CSAMPLE_GAIN* gain1,
+            CSAMPLE_GAIN* gain2);
 
     static const char* kXfaderConfigKey;
     static const double kTransformDefault;
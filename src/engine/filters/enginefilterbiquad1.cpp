@@ -1,6 +1,18 @@
 #include "engine/filters/enginefilterbiquad1.h"
 
+#include <cmath>
+
 #include "moc_enginefilterbiquad1.cpp"
+#include "util/math.h"
+
+namespace {
+
+// Gain resolution of the tables built by buildGainTable(). Linear
+// interpolation between biquad designs this close together is inaudible
+// and keeps the coefficients well within the stable region.
+constexpr double kGainTableStepDb = 0.5;
+
+} // anonymous namespace
 
 EngineFilterBiquad1LowShelving::EngineFilterBiquad1LowShelving(mixxx::audio::SampleRate sampleRate,
         double centerFreq,
@@ -17,6 +29,44 @@ void EngineFilterBiquad1LowShelving::setFrequencyCorners(mixxx::audio::SampleRat
     setCoefs(m_spec, sizeof(m_spec), sampleRate, centerFreq);
 }
 
+void EngineFilterBiquad1LowShelving::buildGainTable(mixxx::audio::SampleRate sampleRate,
+        double centerFreq,
+        double Q,
+        double minDb,
+        double maxDb) {
+    const int entryCount =
+            static_cast<int>(std::ceil((maxDb - minDb) / kGainTableStepDb)) + 1;
+    m_gainTable.resize(entryCount * kCoefCount);
+    m_gainTableMinDb = minDb;
+    for (int i = 0; i < entryCount; ++i) {
+        char spec[FIDSPEC_LENGTH];
+        format_fidspec(spec,
+                sizeof(spec),
+                "LsBq/%.10f/%.10f",
+                Q,
+                minDb + i * kGainTableStepDb);
+        designCoefs(m_gainTable.data() + i * kCoefCount,
+                spec,
+                sizeof(spec),
+                sampleRate,
+                centerFreq);
+    }
+}
+
+void EngineFilterBiquad1LowShelving::setGain(double dBgain) {
+    VERIFY_OR_DEBUG_ASSERT(!m_gainTable.empty()) {
+        return;
+    }
+    const int lastEntry = static_cast<int>(m_gainTable.size() / kCoefCount) - 1;
+    const double pos = math_clamp((dBgain - m_gainTableMinDb) / kGainTableStepDb,
+            0.0,
+            static_cast<double>(lastEntry));
+    const int index = math_min(static_cast<int>(pos), lastEntry - 1);
+    setInterpolatedCoefs(m_gainTable.data() + index * kCoefCount,
+            m_gainTable.data() + (index + 1) * kCoefCount,
+            pos - index);
+}
+
 EngineFilterBiquad1Peaking::EngineFilterBiquad1Peaking(mixxx::audio::SampleRate sampleRate,
         double centerFreq,
         double Q) {
@@ -32,6 +82,44 @@ void EngineFilterBiquad1Peaking::setFrequencyCorners(mixxx::audio::SampleRate sa
     setCoefs(m_spec, sizeof(m_spec), sampleRate, centerFreq);
 }
 
+void EngineFilterBiquad1Peaking::buildGainTable(mixxx::audio::SampleRate sampleRate,
+        double centerFreq,
+        double Q,
+        double minDb,
+        double maxDb) {
+    const int entryCount =
+            static_cast<int>(std::ceil((maxDb - minDb) / kGainTableStepDb)) + 1;
+    m_gainTable.resize(entryCount * kCoefCount);
+    m_gainTableMinDb = minDb;
+    for (int i = 0; i < entryCount; ++i) {
+        char spec[FIDSPEC_LENGTH];
+        format_fidspec(spec,
+                sizeof(spec),
+                "PkBq/%.10f/%.10f",
+                Q,
+                minDb + i * kGainTableStepDb);
+        designCoefs(m_gainTable.data() + i * kCoefCount,
+                spec,
+                sizeof(spec),
+                sampleRate,
+                centerFreq);
+    }
+}
+
+void EngineFilterBiquad1Peaking::setGain(double dBgain) {
+    VERIFY_OR_DEBUG_ASSERT(!m_gainTable.empty()) {
+        return;
+    }
+    const int lastEntry = static_cast<int>(m_gainTable.size() / kCoefCount) - 1;
+    const double pos = math_clamp((dBgain - m_gainTableMinDb) / kGainTableStepDb,
+            0.0,
+            static_cast<double>(lastEntry));
+    const int index = math_min(static_cast<int>(pos), lastEntry - 1);
+    setInterpolatedCoefs(m_gainTable.data() + index * kCoefCount,
+            m_gainTable.data() + (index + 1) * kCoefCount,
+            pos - index);
+}
+
 EngineFilterBiquad1HighShelving::EngineFilterBiquad1HighShelving(
         mixxx::audio::SampleRate sampleRate, double centerFreq, double Q) {
     m_startFromDry = true;
@@ -46,6 +134,44 @@ void EngineFilterBiquad1HighShelving::setFrequencyCorners(mixxx::audio::SampleRa
     setCoefs(m_spec, sizeof(m_spec), sampleRate, centerFreq);
 }
 
+void EngineFilterBiquad1HighShelving::buildGainTable(mixxx::audio::SampleRate sampleRate,
+        double centerFreq,
+        double Q,
+        double minDb,
+        double maxDb) {
+    const int entryCount =
+            static_cast<int>(std::ceil((maxDb - minDb) / kGainTableStepDb)) + 1;
+    m_gainTable.resize(entryCount * kCoefCount);
+    m_gainTableMinDb = minDb;
+    for (int i = 0; i < entryCount; ++i) {
+        char spec[FIDSPEC_LENGTH];
+        format_fidspec(spec,
+                sizeof(spec),
+                "HsBq/%.10f/%.10f",
+                Q,
+                minDb + i * kGainTableStepDb);
+        designCoefs(m_gainTable.data() + i * kCoefCount,
+                spec,
+                sizeof(spec),
+                sampleRate,
+                centerFreq);
+    }
+}
+
+void EngineFilterBiquad1HighShelving::setGain(double dBgain) {
+    VERIFY_OR_DEBUG_ASSERT(!m_gainTable.empty()) {
+        return;
+    }
+    const int lastEntry = static_cast<int>(m_gainTable.size() / kCoefCount) - 1;
+    const double pos = math_clamp((dBgain - m_gainTableMinDb) / kGainTableStepDb,
+            0.0,
+            static_cast<double>(lastEntry));
+    const int index = math_min(static_cast<int>(pos), lastEntry - 1);
+    setInterpolatedCoefs(m_gainTable.data() + index * kCoefCount,
+            m_gainTable.data() + (index + 1) * kCoefCount,
+            pos - index);
+}
+
 EngineFilterBiquad1Low::EngineFilterBiquad1Low(mixxx::audio::SampleRate sampleRate,
         double centerFreq,
         double Q,
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <vector>
+
 #include "audio/types.h"
 #include "engine/filters/enginefilteriir.h"
 
@@ -19,9 +21,21 @@ class EngineFilterBiquad1LowShelving : public EngineFilterIIR<5, IIR_BP> {
             double centerFreq,
             double Q,
             double dBgain);
+    // Precomputes the coefficients over the given gain range so that
+    // subsequent setGain() calls are table lookups with linear
+    // interpolation instead of full fidlib filter designs.
+    void buildGainTable(mixxx::audio::SampleRate sampleRate,
+            double centerFreq,
+            double Q,
+            double minDb,
+            double maxDb);
+    // Applies a gain from the table built by buildGainTable().
+    void setGain(double dBgain);
 
   private:
     char m_spec[FIDSPEC_LENGTH];
+    std::vector<double> m_gainTable;
+    double m_gainTableMinDb = 0;
 };
 
 class EngineFilterBiquad1Peaking : public EngineFilterIIR<5, IIR_BP> {
@@ -32,9 +46,21 @@ class EngineFilterBiquad1Peaking : public EngineFilterIIR<5, IIR_BP> {
             double centerFreq,
             double Q,
             double dBgain);
+    // Precomputes the coefficients over the given gain range so that
+    // subsequent setGain() calls are table lookups with linear
+    // interpolation instead of full fidlib filter designs.
+    void buildGainTable(mixxx::audio::SampleRate sampleRate,
+            double centerFreq,
+            double Q,
+            double minDb,
+            double maxDb);
+    // Applies a gain from the table built by buildGainTable().
+    void setGain(double dBgain);
 
   private:
     char m_spec[FIDSPEC_LENGTH];
+    std::vector<double> m_gainTable;
+    double m_gainTableMinDb = 0;
 };
 
 class EngineFilterBiquad1HighShelving : public EngineFilterIIR<5, IIR_BP> {
@@ -46,9 +72,21 @@ class EngineFilterBiquad1HighShelving : public EngineFilterIIR<5, IIR_BP> {
             double centerFreq,
             double Q,
             double dBgain);
+    // Precomputes the coefficients over the given gain range so that
+    // subsequent setGain() calls are table lookups with linear
+    // interpolation instead of full fidlib filter designs.
+    void buildGainTable(mixxx::audio::SampleRate sampleRate,
+            double centerFreq,
+            double Q,
+            double minDb,
+            double maxDb);
+    // Applies a gain from the table built by buildGainTable().
+    void setGain(double dBgain);
 
   private:
     char m_spec[FIDSPEC_LENGTH];
+    std::vector<double> m_gainTable;
+    double m_gainTableMinDb = 0;
 };
 
 class EngineFilterBiquad1Low : public EngineFilterIIR<2, IIR_LP> {
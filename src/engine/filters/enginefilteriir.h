@@ -39,6 +39,8 @@ class EngineFilterIIRBase : public EngineObjectConstIn {
 template<unsigned int SIZE, enum IIRPass PASS>
 class EngineFilterIIR : public EngineFilterIIRBase {
   public:
+    static constexpr unsigned int kCoefCount = SIZE + 1;
+
     EngineFilterIIR()
             : m_doRamping(false),
               m_doStart(false),
@@ -231,6 +233,40 @@ class EngineFilterIIR : public EngineFilterIIRBase {
 #endif
     }
 
+    // Designs the coefficients for the given spec into pCoef, which must
+    // hold kCoefCount values, without touching the filter state. This is
+    // used to precompute coefficient tables ahead of the audio callback.
+    void designCoefs(double* pCoef,
+            const char* spec,
+            std::size_t bufsize,
+            double sampleRate,
+            double freq0,
+            double freq1 = 0,
+            int adj = 0) {
+        char spec_d[FIDSPEC_LENGTH];
+        VERIFY_OR_DEBUG_ASSERT(bufsize <= sizeof(spec_d)) {
+            return;
+        }
+        // Copy to dynamic-ish memory to prevent fidlib API breakage.
+        std::strncpy(spec_d, spec, bufsize);
+
+        pCoef[0] = fid_design_coef(pCoef + 1, SIZE, spec_d, sampleRate, freq0, freq1, adj);
+    }
+
+    // Replaces the current coefficients with a linear interpolation between
+    // two precomputed coefficient sets and ramps to them click-free, just
+    // like setCoefs() does after a fresh design.
+    void setInterpolatedCoefs(const double* pCoefA, const double* pCoefB, double frac) {
+        // Copy the old coefficients into m_oldCoef
+        memcpy(m_oldCoef, m_coef, sizeof(m_coef));
+
+        for (unsigned int i = 0; i < kCoefCount; ++i) {
+            m_coef[i] = pCoefA[i] + (pCoefB[i] - pCoefA[i]) * frac;
+        }
+
+        initBuffers();
+    }
+
     virtual void assumeSettled() {
         m_doRamping = false;
         m_doStart = false;
@@ -238,10 +274,25 @@ class EngineFilterIIR : public EngineFilterIIRBase {
 
     virtual void process(const CSAMPLE* pIn, CSAMPLE* pOutput, const std::size_t bufferSize) {
         if (!m_doRamping) {
+            // Process the whole block on local copies of the coefficients
+            // and the per-channel state. The locals never have their
+            // address taken beyond the inlined processSample() calls, so
+            // the compiler can keep the state of both channels in
+            // registers across the loop instead of reloading and spilling
+            // the member arrays once per sample, which it must assume may
+            // alias through the this pointer.
+            double coef[SIZE + 1];
+            double buf1[SIZE];
+            double buf2[SIZE];
+            memcpy(coef, m_coef, sizeof(coef));
+            memcpy(buf1, m_buf1, sizeof(buf1));
+            memcpy(buf2, m_buf2, sizeof(buf2));
             for (std::size_t i = 0; i < bufferSize; i += 2) {
-                pOutput[i] = static_cast<CSAMPLE>(processSample(m_coef, m_buf1, pIn[i]));
-                pOutput[i + 1] = static_cast<CSAMPLE>(processSample(m_coef, m_buf2, pIn[i + 1]));
+                pOutput[i] = static_cast<CSAMPLE>(processSample(coef, buf1, pIn[i]));
+                pOutput[i + 1] = static_cast<CSAMPLE>(processSample(coef, buf2, pIn[i + 1]));
             }
+            memcpy(m_buf1, buf1, sizeof(m_buf1));
+            memcpy(m_buf2, buf2, sizeof(m_buf2));
         } else {
             double cross_mix = 0.0;
             double cross_inc = 4.0 / static_cast<double>(bufferSize);
@@ -68,6 +68,14 @@ class RateIIFilter {
 
 namespace {
 
+// The fixed timestep of the scratch physics. The controller state is
+// advanced in whole steps of this size with the remainder carried over
+// to the next callback, so the response is identical for all buffer
+// sizes. The step matches the mouse sampling window: the position input
+// updates every ~8 ms at best, so finer steps would only re-evaluate
+// stale input. Normally the Mouse is sampled every 8 ms so with this
+// 16 ms window we have 0 ... 3 samples. The remaining jitter is ironed
+// by the following IIR lowpass filter.
 constexpr double kDefaultSampleInterval = 0.016;
 // The max wait time when no new position has been set
 // TODO Make threshold configurable for controller use?
@@ -105,8 +113,7 @@ PositionScratchController::PositionScratchController(const QString& group)
           m_scratchPosSampleTime(0),
           m_bufferSize(-1),
           m_dt(1),
-          m_callsPerDt(1),
-          m_callsToStop(1),
+          m_stepSamples(1),
           m_p(1),
           m_d(1),
           m_f(0.4) {
@@ -121,22 +128,16 @@ void PositionScratchController::slotUpdateFilterParameters(double sampleRate) {
     // The latency or time difference between process calls.
     m_dt = static_cast<double>(m_bufferSize) / sampleRate / 2;
 
-    // Sample Mouse with fixed timing intervals to iron out significant jitters
-    // that are added on the way from mouse to engine thread
-    // Normally the Mouse is sampled every 8 ms so with this 16 ms window we
-    // have 0 ... 3 samples. The remaining jitter is ironed by the following IIR
-    // lowpass filter
-    m_callsPerDt = static_cast<int>(ceil(kDefaultSampleInterval / m_dt));
+    // Engine sample positions traveled per fixed step at unity rate.
+    // Positions and deltas are normalized by this, so all controller
+    // state is in per-step units independent of the buffer size.
+    m_stepSamples = kDefaultSampleInterval * sampleRate * 2;
 
-    m_callsToStop = m_dt / kTimeToStop;
-
-    // Tweak PD controller for different latencies
+    // The fixed timestep keeps the effective controller response the
+    // same at all latencies, so the gains are plain constants.
     m_p = 0.3;
     m_d = m_p / -2;
     m_f = 0.4;
-    if (m_dt > kDefaultSampleInterval * 2) {
-        m_f = 1;
-    }
 
     m_pVelocityController->setPD(m_p, m_d);
     m_pRateIIFilter->setFactor(m_f);
@@ -176,7 +177,8 @@ void PositionScratchController::process(double currentSamplePos,
             // decayThreshold = kMaxVelocity * alpha ^ (# callbacks to stop in)
             // # callbacks = kTimeToStop / m_dt
             // alpha = (decayThreshold / kMaxVelocity) ^ (m_dt / kTimeToStop)
-            const double kExponentialDecay = pow(decayThreshold / kMaxVelocity, m_callsToStop);
+            const double kExponentialDecay =
+                    pow(decayThreshold / kMaxVelocity, m_dt / kTimeToStop);
 
             m_rate *= kExponentialDecay;
 
@@ -216,20 +218,22 @@ void PositionScratchController::process(double currentSamplePos,
 
             // Measure the total distance traveled since last frame and add
             // it to the running total. This is required to scratch within loop
-            // boundaries. And normalize to one buffer
-            m_samplePosDeltaSum += (sampleDelta) / (bufferSize * baseSampleRate);
+            // boundaries. And normalize to one step
+            m_samplePosDeltaSum += (sampleDelta) / (m_stepSamples * baseSampleRate);
 
             m_scratchPosSampleTime += m_dt;
-            // If the kDefaultSampleInterval has expired, calculate scratch parameters and
-            // eventually the new rate.
-            // Else, continue with the last rate.
-            if (m_scratchPosSampleTime >= kDefaultSampleInterval) {
-                m_scratchPosSampleTime = 0;
+            // Advance the controller in whole fixed steps and carry the
+            // remainder over to the next callback. Large buffers run
+            // several steps per callback, small buffers skip callbacks;
+            // either way the controller sees the same step cadence.
+            // In between, continue with the last rate.
+            while (m_scratchPosSampleTime >= kDefaultSampleInterval) {
+                m_scratchPosSampleTime -= kDefaultSampleInterval;
 
                 // Set the scratch target to the current set position
-                // and normalize to one buffer
+                // and normalize to one step
                 double scratchTargetDelta = (m_pScratchPos->get() - m_scratchStartPos) /
-                        (bufferSize * baseSampleRate);
+                        (m_stepSamples * baseSampleRate);
 
                 bool calcRate = true;
 
@@ -237,7 +241,7 @@ void PositionScratchController::process(double currentSamplePos,
                     // We get here if the next mouse position is delayed, the
                     // mouse is stopped or moves very slowly. Since we don't
                     // know the case we assume delayed mouse updates for 40 ms.
-                    m_moveDelay += m_dt * m_callsPerDt;
+                    m_moveDelay += kDefaultSampleInterval;
                     if (m_moveDelay < kMoveDelayMax) {
                         // Assume a missing Mouse Update and continue with the
                         // previously calculated rate.
@@ -267,7 +271,6 @@ void PositionScratchController::process(double currentSamplePos,
                     double ctrlError = m_pRateIIFilter->filter(
                             scratchTargetDelta - m_samplePosDeltaSum);
                     m_rate = m_pVelocityController->observation(ctrlError);
-                    m_rate /= m_callsPerDt;
                     if (fabs(m_rate) < MIN_SEEK_SPEED) {
                         // we cannot get closer
                         m_rate = 0;
@@ -296,7 +299,7 @@ void PositionScratchController::process(double currentSamplePos,
         // Set up initial values, in a way that the system is settled
         m_rate = releaseRate;
         // Set to the remaining error of a p controller
-        m_samplePosDeltaSum = -(releaseRate / m_p) * m_callsPerDt;
+        m_samplePosDeltaSum = -(releaseRate / m_p);
         m_pVelocityController->reset(-m_samplePosDeltaSum);
         m_pRateIIFilter->reset(-m_samplePosDeltaSum);
         // The "scratch_position" CO contains the distance traveled. We use this
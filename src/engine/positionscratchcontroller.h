@@ -59,8 +59,9 @@ class PositionScratchController : public QObject {
     std::size_t m_bufferSize;
 
     double m_dt;
-    double m_callsPerDt;
-    double m_callsToStop;
+    // Engine sample positions traveled per fixed timestep at unity rate,
+    // used to normalize all controller state to per-step units.
+    double m_stepSamples;
 
     double m_p;
     double m_d;
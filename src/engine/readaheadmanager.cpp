@@ -8,15 +8,43 @@
 #include "util/defs.h"
 #include "util/sample.h"
 
+namespace {
+
+// Loops up to this many samples long (~0.75 s of stereo audio at
+// 44.1 kHz, e.g. any beatloop 1/4 or shorter at common tempos) are
+// rendered once into the loop cache, so that the rapid wrap-around and
+// crossfade reads of tight loop rolls become plain copies instead of
+// per-wrap chunk lookups in the caching reader.
+constexpr SINT kMaxCachedLoopSamples = 65536;
+
+// Cached margin around the loop body. The crossfade read at a wrap
+// point starts up to one engine buffer before the seek target, which
+// can be up to kMaxEngineFrames frames of a multi-channel (stem) read.
+constexpr SINT kLoopCacheMarginSamples = 65536;
+
+// Worst-case allocation of the loop cache, padded for frame alignment
+// of the clamped region bounds.
+constexpr SINT kLoopCacheBufferSamples =
+        kMaxCachedLoopSamples + 2 * kLoopCacheMarginSamples + 16;
+
+} // anonymous namespace
+
 ReadAheadManager::ReadAheadManager()
         : m_pLoopingControl(nullptr),
           m_pCueControl(nullptr),
           m_pRateControl(nullptr),
+          m_readAheadLogFront(0),
+          m_readAheadLogSize(0),
           m_currentPosition(0),
           m_pReader(nullptr),
           m_pCrossFadeBuffer(SampleUtil::alloc(MAX_BUFFER_LEN)),
           m_cacheMissCount(0),
-          m_cacheMissExpected(false) {
+          m_cacheMissExpected(false),
+          m_loopCacheStart(0),
+          m_loopCacheEnd(0),
+          m_loopCacheKeyStart(kNoTrigger),
+          m_loopCacheKeyEnd(kNoTrigger),
+          m_loopCacheValid(false) {
     // For testing only: ReadAheadManagerMock
 }
 
@@ -26,11 +54,18 @@ ReadAheadManager::ReadAheadManager(CachingReader* pReader,
         : m_pLoopingControl(pLoopingControl),
           m_pCueControl(pCueControl),
           m_pRateControl(nullptr),
+          m_readAheadLogFront(0),
+          m_readAheadLogSize(0),
           m_currentPosition(0),
           m_pReader(pReader),
           m_pCrossFadeBuffer(SampleUtil::alloc(MAX_BUFFER_LEN)),
           m_cacheMissCount(0),
-          m_cacheMissExpected(false) {
+          m_cacheMissExpected(false),
+          m_loopCacheStart(0),
+          m_loopCacheEnd(0),
+          m_loopCacheKeyStart(kNoTrigger),
+          m_loopCacheKeyEnd(kNoTrigger),
+          m_loopCacheValid(false) {
     DEBUG_ASSERT(m_pLoopingControl != nullptr);
     DEBUG_ASSERT(m_pCueControl != nullptr);
     DEBUG_ASSERT(m_pReader != nullptr);
@@ -44,6 +79,29 @@ SINT ReadAheadManager::getNextSamples(double dRate,
         CSAMPLE* pOutput,
         SINT requested_samples,
         mixxx::audio::ChannelCount channelCount) {
+    return getNextSamplesInternal(
+            dRate, pOutput, requested_samples, channelCount, nullptr);
+}
+
+const CSAMPLE* ReadAheadManager::getNextSamplesSpan(double dRate,
+        CSAMPLE* pFallbackBuffer,
+        SINT requested_samples,
+        mixxx::audio::ChannelCount channelCount,
+        SINT* pSamplesRead) {
+    const CSAMPLE* pBorrowedSpan = nullptr;
+    *pSamplesRead = getNextSamplesInternal(dRate,
+            pFallbackBuffer,
+            requested_samples,
+            channelCount,
+            &pBorrowedSpan);
+    return pBorrowedSpan ? pBorrowedSpan : pFallbackBuffer;
+}
+
+SINT ReadAheadManager::getNextSamplesInternal(double dRate,
+        CSAMPLE* pOutput,
+        SINT requested_samples,
+        mixxx::audio::ChannelCount channelCount,
+        const CSAMPLE** ppBorrowedSpan) {
     // qDebug() << "getNextSamples:" << m_currentPosition << requested_samples;
 
     int modSamples = requested_samples % channelCount;
@@ -87,6 +145,12 @@ SINT ReadAheadManager::getNextSamples(double dRate,
         }
     }
 
+    if (loop_trigger != kNoTrigger && target != kNoTrigger) {
+        // Render the body of a short loop once, so the reads below are
+        // served from the loop cache on every subsequent wrap.
+        updateLoopCache(loop_trigger, target, reachedTrigger, channelCount);
+    }
+
     mixxx::audio::FramePos jumpTargetPosition;
     // A saved jump cue will only limit the amount we can read in one shot.
     const mixxx::audio::FramePos jumpTriggerPosition =
@@ -142,28 +206,42 @@ SINT ReadAheadManager::getNextSamples(double dRate,
     SINT start_sample = SampleUtil::roundPlayPosToFrameStart(
             m_currentPosition, channelCount);
 
-    const auto readResult = m_pReader->read(
-            start_sample, samples_from_reader, in_reverse, pOutput, channelCount);
-    if (readResult == CachingReader::ReadResult::UNAVAILABLE) {
-        // Cache miss - no samples written
-        SampleUtil::clear(pOutput, samples_from_reader);
-        // Set the cache miss flag to decide when to apply ramping
-        // after the following read attempts.
-        m_cacheMissCount++;
-    } else if (m_cacheMissCount > 0) {
-        // Previous read was a cache miss, but now we got something back.
-        // Apply ramping gain, because the last buffer has unwanted silence
-        // and new samples without fading are causing a pop.
-        SampleUtil::applyRampingGain(pOutput,
-                CSAMPLE_GAIN_ZERO,
-                CSAMPLE_GAIN_ONE,
-                samples_from_reader);
-        // Reset the cache miss flag, because we are now back on track.
-        if (!m_cacheMissExpected) {
-            qDebug() << "ReadAheadManager: continue after number cache misses:" << m_cacheMissCount;
+    if (ppBorrowedSpan != nullptr) {
+        // Try the zero-copy path first. Borrowing is only applicable for
+        // plain forward reads: triggers need the crossfade/ramping below to
+        // modify the output samples in place and a pending cache miss
+        // requires ramping in the writable buffer as well.
+        *ppBorrowedSpan = nullptr;
+        if (!in_reverse && !reachedTrigger && m_cacheMissCount == 0) {
+            *ppBorrowedSpan = m_pReader->borrowSampleFrames(
+                    start_sample, samples_from_reader, channelCount);
+        }
+    }
+    if (ppBorrowedSpan == nullptr || *ppBorrowedSpan == nullptr) {
+        const auto readResult = readCachedOrFromReader(
+                start_sample, samples_from_reader, in_reverse, pOutput, channelCount);
+        if (readResult == CachingReader::ReadResult::UNAVAILABLE) {
+            // Cache miss - no samples written
+            SampleUtil::clear(pOutput, samples_from_reader);
+            // Set the cache miss flag to decide when to apply ramping
+            // after the following read attempts.
+            m_cacheMissCount++;
+        } else if (m_cacheMissCount > 0) {
+            // Previous read was a cache miss, but now we got something back.
+            // Apply ramping gain, because the last buffer has unwanted silence
+            // and new samples without fading are causing a pop.
+            SampleUtil::applyRampingGain(pOutput,
+                    CSAMPLE_GAIN_ZERO,
+                    CSAMPLE_GAIN_ONE,
+                    samples_from_reader);
+            // Reset the cache miss flag, because we are now back on track.
+            if (!m_cacheMissExpected) {
+                qDebug() << "ReadAheadManager: continue after number cache misses:"
+                         << m_cacheMissCount;
+            }
+            m_cacheMissCount = 0;
+            m_cacheMissExpected = false;
         }
-        m_cacheMissCount = 0;
-        m_cacheMissExpected = false;
     }
 
     // Increment or decrement current read-ahead position
@@ -233,7 +311,7 @@ SINT ReadAheadManager::getNextSamples(double dRate,
         }
 
         if (crossFadeSamples > 0) {
-            const auto readResult = m_pReader->read(seek_read_position +
+            const auto readResult = readCachedOrFromReader(seek_read_position +
                             (in_reverse ? crossFadeStart : -crossFadeStart),
                     crossFadeSamples,
                     in_reverse,
@@ -278,18 +356,109 @@ void ReadAheadManager::notifySeek(double seekPosition) {
     m_currentPosition = seekPosition;
     m_cacheMissCount = 0;
     m_cacheMissExpected = true;
-    m_readAheadLog.clear();
+    m_readAheadLogFront = 0;
+    m_readAheadLogSize = 0;
+    // A seek may be caused by loading another track, which makes the
+    // cached loop body stale. Refilled on the next wrap if still looping.
+    m_loopCacheValid = false;
+    m_loopCacheKeyStart = kNoTrigger;
+    m_loopCacheKeyEnd = kNoTrigger;
+}
+
+CachingReader::ReadResult ReadAheadManager::readCachedOrFromReader(
+        SINT startSample,
+        SINT numSamples,
+        bool reverse,
+        CSAMPLE* pOutput,
+        mixxx::audio::ChannelCount channelCount) {
+    if (m_loopCacheValid && channelCount == m_loopCacheChannelCount) {
+        // A reverse read covers the samples before startSample
+        const SINT firstSample = reverse ? startSample - numSamples : startSample;
+        if (firstSample >= m_loopCacheStart &&
+                firstSample + numSamples <= m_loopCacheEnd) {
+            const CSAMPLE* pCached =
+                    m_loopCacheBuffer.data() + (firstSample - m_loopCacheStart);
+            if (reverse) {
+                SampleUtil::copyReverse(pOutput, pCached, numSamples, channelCount);
+            } else {
+                SampleUtil::copy(pOutput, pCached, numSamples);
+            }
+            return CachingReader::ReadResult::AVAILABLE;
+        }
+    }
+    return m_pReader->read(startSample, numSamples, reverse, pOutput, channelCount);
+}
+
+void ReadAheadManager::updateLoopCache(double loopTriggerSample,
+        double loopTargetSample,
+        bool reachedTrigger,
+        mixxx::audio::ChannelCount channelCount) {
+    const double loopStart = math_min(loopTriggerSample, loopTargetSample);
+    const double loopEnd = math_max(loopTriggerSample, loopTargetSample);
+    if (loopEnd - loopStart <= 0 || loopEnd - loopStart > kMaxCachedLoopSamples) {
+        m_loopCacheValid = false;
+        return;
+    }
+    if (loopStart == m_loopCacheKeyStart &&
+            loopEnd == m_loopCacheKeyEnd &&
+            channelCount == m_loopCacheChannelCount &&
+            (m_loopCacheValid || !reachedTrigger)) {
+        // Already cached, or the last fill failed and is only retried
+        // once per wrap instead of once per buffer.
+        return;
+    }
+    m_loopCacheKeyStart = loopStart;
+    m_loopCacheKeyEnd = loopEnd;
+    m_loopCacheChannelCount = channelCount;
+    m_loopCacheValid = false;
+
+    // The margins around the loop body are clamped to the available
+    // track samples; reads into the pre/post-roll beyond the clamped
+    // region simply fall back to the reader.
+    const auto trackSamples = static_cast<SINT>(
+            m_pLoopingControl->getTrackFrame().toSamplePos(channelCount));
+    const SINT cacheStart = math_max<SINT>(0,
+            SampleUtil::roundPlayPosToFrameStart(
+                    loopStart - kLoopCacheMarginSamples, channelCount));
+    const SINT cacheEnd = math_min<SINT>(trackSamples,
+            SampleUtil::ceilPlayPosToFrameStart(
+                    loopEnd + kLoopCacheMarginSamples, channelCount));
+    if (cacheEnd <= cacheStart) {
+        return;
+    }
+    const SINT cacheSamples = cacheEnd - cacheStart;
+    DEBUG_ASSERT(cacheSamples <= kLoopCacheBufferSamples);
+    if (m_loopCacheBuffer.size() < cacheSamples) {
+        // One-time allocation on the first short loop of this deck,
+        // analogous to the lazily grown stem buffers in
+        // EngineDeck::process().
+        m_loopCacheBuffer = mixxx::SampleBuffer(kLoopCacheBufferSamples);
+    }
+    if (m_pReader->read(cacheStart,
+                cacheSamples,
+                false,
+                m_loopCacheBuffer.data(),
+                channelCount) != CachingReader::ReadResult::AVAILABLE) {
+        // Chunks not cached yet, retry at the next wrap
+        return;
+    }
+    m_loopCacheStart = cacheStart;
+    m_loopCacheEnd = cacheEnd;
+    m_loopCacheValid = true;
 }
 
 void ReadAheadManager::hintReader(double dRate,
         gsl::not_null<HintVector*> pHintList,
-        mixxx::audio::ChannelCount channelCount) {
+        mixxx::audio::ChannelCount channelCount,
+        SINT readAheadChunks) {
     bool in_reverse = dRate < 0;
     Hint current_position;
 
-    // SoundTouch can read up to 2 chunks ahead. Always keep 2 chunks ahead in
-    // cache.
-    SINT frameCountToCache = 2 * CachingReaderChunk::kFrames;
+    // SoundTouch can read up to 2 chunks ahead, so the reader never
+    // recommends keeping less than 2 chunks cached. Slow sources
+    // raise the recommendation.
+    DEBUG_ASSERT(readAheadChunks >= 2);
+    SINT frameCountToCache = readAheadChunks * CachingReaderChunk::kFrames;
     current_position.frameCount = frameCountToCache;
 
     // this called after the precious chunk was consumed
@@ -320,13 +489,23 @@ void ReadAheadManager::addReadLogEntry(double virtualPlaypositionStart,
                                        double virtualPlaypositionEndNonInclusive) {
     ReadLogEntry newEntry(virtualPlaypositionStart,
                           virtualPlaypositionEndNonInclusive);
-    if (m_readAheadLog.size() > 0) {
-        ReadLogEntry& last = m_readAheadLog.back();
+    if (m_readAheadLogSize > 0) {
+        ReadLogEntry& last = m_readAheadLog[
+                (m_readAheadLogFront + m_readAheadLogSize - 1) % kReadLogCapacity];
         if (last.merge(newEntry)) {
             return;
         }
     }
-    m_readAheadLog.push_back(newEntry);
+    if (m_readAheadLogSize == kReadLogCapacity) {
+        // Only reachable if the position queries stop consuming the log
+        // while reads keep wrapping or changing direction. Drop the oldest
+        // entry; the reported position catches up on the next query.
+        qDebug() << "ReadAheadManager: read log overflow, dropping oldest entry";
+        m_readAheadLogFront = (m_readAheadLogFront + 1) % kReadLogCapacity;
+        --m_readAheadLogSize;
+    }
+    m_readAheadLog[(m_readAheadLogFront + m_readAheadLogSize) % kReadLogCapacity] = newEntry;
+    ++m_readAheadLogSize;
 }
 
 // Not thread-save, call from engine thread only
@@ -337,7 +516,7 @@ double ReadAheadManager::getFilePlaypositionFromLog(
         return currentFilePlayposition;
     }
 
-    if (m_readAheadLog.size() == 0) {
+    if (m_readAheadLogSize == 0) {
         // No log entries to read from.
         qDebug() << this << "No read ahead log entries to read from. Case not currently handled.";
         // TODO(rryan) log through a stats pipe eventually
@@ -345,15 +524,16 @@ double ReadAheadManager::getFilePlaypositionFromLog(
     }
 
     double filePlayposition = 0;
-    while (m_readAheadLog.size() > 0 && numConsumedSamples > 0) {
-        ReadLogEntry& entry = m_readAheadLog.front();
+    while (m_readAheadLogSize > 0 && numConsumedSamples > 0) {
+        ReadLogEntry& entry = m_readAheadLog[m_readAheadLogFront];
         // Advance our idea of the current virtual playposition to this
         // ReadLogEntry's start position.
         filePlayposition = entry.advancePlayposition(&numConsumedSamples);
 
         if (entry.length() == 0) {
             // This entry is empty now.
-            m_readAheadLog.pop_front();
+            m_readAheadLogFront = (m_readAheadLogFront + 1) % kReadLogCapacity;
+            --m_readAheadLogSize;
         }
     }
 
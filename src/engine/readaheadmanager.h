@@ -1,11 +1,13 @@
 #pragma once
 
 #include <gsl/pointers>
-#include <list>
+
+#include <array>
 
 #include "audio/frame.h"
 #include "engine/cachingreader/cachingreader.h"
 #include "util/math.h"
+#include "util/samplebuffer.h"
 #include "util/types.h"
 
 class LoopingControl;
@@ -39,6 +41,20 @@ class ReadAheadManager {
             SINT requested_samples,
             mixxx::audio::ChannelCount channelCount);
 
+    /// Zero-copy variant of getNextSamples(): For the common forward read
+    /// without a pending loop/jump trigger the samples are borrowed directly
+    /// from the caching reader's chunk cache instead of being copied into
+    /// pFallbackBuffer. Returns the buffer holding the samples -- either the
+    /// borrowed span or pFallbackBuffer -- and stores the number of samples
+    /// read in *pSamplesRead. A borrowed span is only valid until the next
+    /// call into this ReadAheadManager or the underlying CachingReader, so
+    /// consume it immediately.
+    virtual const CSAMPLE* getNextSamplesSpan(double dRate,
+            CSAMPLE* pFallbackBuffer,
+            SINT requested_samples,
+            mixxx::audio::ChannelCount channelCount,
+            SINT* pSamplesRead);
+
     /// Used to add a new EngineControls that ReadAheadManager will use to decide
     /// which samples to return.
     void addLoopingControl();
@@ -54,9 +70,13 @@ class ReadAheadManager {
 
     /// hintReader allows the ReadAheadManager to provide hints to the reader to
     /// indicate that the given portion of a song is about to be read.
+    /// readAheadChunks is the number of chunks to keep cached in the
+    /// playback direction, see
+    /// CachingReader::recommendedReadAheadChunks().
     virtual void hintReader(double dRate,
             gsl::not_null<HintVector*> pHintList,
-            mixxx::audio::ChannelCount channelCount);
+            mixxx::audio::ChannelCount channelCount,
+            SINT readAheadChunks);
 
     /// Return the position in sample
     virtual double getFilePlaypositionFromLog(
@@ -75,6 +95,11 @@ class ReadAheadManager {
         double virtualPlaypositionStart;
         double virtualPlaypositionEndNonInclusive;
 
+        // Required for the preallocated ring buffer slots.
+        ReadLogEntry()
+                : ReadLogEntry(0.0, 0.0) {
+        }
+
         ReadLogEntry(double virtualPlaypositionStart,
                      double virtualPlaypositionEndNonInclusive) {
             this->virtualPlaypositionStart = virtualPlaypositionStart;
@@ -119,18 +144,71 @@ class ReadAheadManager {
         }
     };
 
+    /// Serves the read from the loop-body cache when the requested range
+    /// is covered, otherwise falls back to the caching reader. Used for
+    /// the wrap-around and crossfade reads of short loops, which would
+    /// otherwise hit the reader's chunk lookup on every wrap.
+    CachingReader::ReadResult readCachedOrFromReader(SINT startSample,
+            SINT numSamples,
+            bool reverse,
+            CSAMPLE* pOutput,
+            mixxx::audio::ChannelCount channelCount);
+
+    /// Renders the body of a short active loop (plus a margin for the
+    /// crossfade reads around the wrap points) once into the loop cache.
+    /// No-op while the cache already covers the loop; failed fills are
+    /// retried once per wrap (reachedTrigger).
+    void updateLoopCache(double loopTriggerSample,
+            double loopTargetSample,
+            bool reachedTrigger,
+            mixxx::audio::ChannelCount channelCount);
+
+    /// Shared implementation of getNextSamples() and getNextSamplesSpan().
+    /// If ppBorrowedSpan is non-null, a zero-copy read is attempted first
+    /// and the borrowed span (or nullptr) is stored there; pOutput is left
+    /// untouched when borrowing succeeded.
+    SINT getNextSamplesInternal(double dRate,
+            CSAMPLE* pOutput,
+            SINT requested_samples,
+            mixxx::audio::ChannelCount channelCount,
+            const CSAMPLE** ppBorrowedSpan);
+
     /// virtualPlaypositionEnd is the first sample in the direction that was
     /// read that was NOT read as part of this log entry.
     void addReadLogEntry(double virtualPlaypositionStart,
                          double virtualPlaypositionEndNonInclusive);
 
+    /// Upper bound for pending read log entries. Entries are merged
+    /// whenever consecutive reads continue in the same direction, so the
+    /// log only grows by loop wraps, jumps and direction changes between
+    /// two position queries and stays far below this in practice.
+    static constexpr int kReadLogCapacity = 64;
+
     LoopingControl* m_pLoopingControl;
     CueControl* m_pCueControl;
     RateControl* m_pRateControl;
-    std::list<ReadLogEntry> m_readAheadLog;
+    /// Fixed-size ring buffer of read log entries, preallocated to keep
+    /// the audio callback free of heap allocation. m_readAheadLogFront
+    /// indexes the oldest entry, m_readAheadLogSize counts the occupied
+    /// slots.
+    std::array<ReadLogEntry, kReadLogCapacity> m_readAheadLog;
+    int m_readAheadLogFront;
+    int m_readAheadLogSize;
     double m_currentPosition; // In absolute samples
     CachingReader* m_pReader;
     CSAMPLE* m_pCrossFadeBuffer;
     int m_cacheMissCount;
     bool m_cacheMissExpected;
+
+    // Loop-body cache for short loops (e.g. beatloop rolls), see
+    // readCachedOrFromReader(). The buffer is grown lazily on the first
+    // short loop of this deck, like the stem buffers in
+    // EngineDeck::process(), so decks that never roll pay nothing.
+    mixxx::SampleBuffer m_loopCacheBuffer;
+    SINT m_loopCacheStart;
+    SINT m_loopCacheEnd;
+    double m_loopCacheKeyStart;
+    double m_loopCacheKeyEnd;
+    mixxx::audio::ChannelCount m_loopCacheChannelCount;
+    bool m_loopCacheValid;
 };
@@ -1,5 +1,9 @@
 #include "engine/sidechain/enginerecord.h"
 
+#ifdef __LINUX__
+#include <fcntl.h>
+#endif
+
 #include "control/controlproxy.h"
 #include "encoder/encoder.h"
 #include "mixer/playerinfo.h"
@@ -12,8 +16,15 @@
 
 constexpr int kMetaDataLifeTimeout = 16;
 
+// Recorded data is evicted from the page cache in chunks of this size.
+// 8 MiB is about 46 s of 44.1 kHz stereo WAV, so by the time a chunk is
+// dropped the kernel's periodic writeback (30 s by default) has already
+// flushed its pages to disk and the eviction is a cheap cache release.
+constexpr qint64 kCacheDropChunkBytes = 8 << 20;
+
 EngineRecord::EngineRecord(UserSettingsPointer pConfig)
         : m_pConfig(pConfig),
+          m_cacheDropOffset(0),
           m_sampleRateControl(
                   QStringLiteral("[App]"), QStringLiteral("samplerate")),
           m_frames(0),
@@ -306,6 +317,45 @@ void EngineRecord::write(const unsigned char *header, const unsigned char *body,
     m_dataStream.writeRawData((const char*) body, bodyLen);
     emit bytesRecorded((headerLen+bodyLen));
 
+    if (m_dataStream.device()->pos() >=
+            m_cacheDropOffset + 2 * kCacheDropChunkBytes) {
+        dropWrittenFromPageCache(false);
+    }
+}
+
+// The recorded file is written once and never read back while recording.
+// Without this, a long session accumulates gigabytes of its audio in the
+// page cache, displacing the library and waveform caches, and the kernel
+// eventually flushes the dirty pages in large bursts that can stall our
+// writes right at a file split. Evicting everything but the most recent
+// chunk keeps the cache footprint flat; the dropped pages are old enough
+// to have been written back by the kernel's periodic writeback already,
+// see kCacheDropChunkBytes.
+void EngineRecord::dropWrittenFromPageCache(bool closing) {
+#ifdef __LINUX__
+    // Push data buffered by QFile to the kernel first
+    m_file.flush();
+    const int fd = m_file.handle();
+    if (fd == -1) {
+        return;
+    }
+    if (closing) {
+        // Best effort: pages that are still dirty stay cached until the
+        // kernel has written them back
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        m_cacheDropOffset = 0;
+        return;
+    }
+    const qint64 pos = m_file.pos();
+    if (pos <= kCacheDropChunkBytes) {
+        return;
+    }
+    const qint64 dropEnd = pos - kCacheDropChunkBytes;
+    posix_fadvise(fd, 0, dropEnd, POSIX_FADV_DONTNEED);
+    m_cacheDropOffset = dropEnd;
+#else
+    Q_UNUSED(closing);
+#endif
 }
 // Encoder calls this method to write compressed audio
 int EngineRecord::tell() {
@@ -345,6 +395,7 @@ bool EngineRecord::openFile() {
         }
         if (m_file.handle() != -1) {
             m_dataStream.setDevice(&m_file);
+            m_cacheDropOffset = 0;
         }
     } else {
         return false;
@@ -405,6 +456,7 @@ void EngineRecord::closeFile() {
             m_pEncoder->flush();
             m_pEncoder.reset();
         }
+        dropWrittenFromPageCache(true);
         m_file.close();
     }
 }
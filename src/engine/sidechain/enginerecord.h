@@ -61,6 +61,11 @@ class EngineRecord : public QObject, public EncoderCallback, public SideChainWor
 
     void writeCueLine();
 
+    // Advises the kernel to evict the already recorded data from the page
+    // cache (Linux only), so long sessions do not displace the rest of the
+    // system's cache and splits do not stall on a large writeback burst.
+    void dropWrittenFromPageCache(bool closing);
+
     UserSettingsPointer m_pConfig;
     EncoderPointer m_pEncoder;
     QString m_encoding;
@@ -72,6 +77,8 @@ class EngineRecord : public QObject, public EncoderCallback, public SideChainWor
     QFile m_file;
     QFile m_cueFile;
     QDataStream m_dataStream;
+    // File offset up to which the page cache has been dropped already
+    qint64 m_cacheDropOffset;
 
     PollingControlProxy m_sampleRateControl;
     ControlProxy* m_pRecReady;
@@ -12,14 +12,13 @@
 
 #include "engine/engine.h"
 #include "engine/sidechain/sidechainworker.h"
+#include "engine/sidechain/sidechainworkerlane.h"
 #include "moc_enginesidechain.cpp"
 #include "util/counter.h"
 #include "util/event.h"
 #include "util/sample.h"
 #include "util/trace.h"
 
-#define SIDECHAIN_BUFFER_SIZE 65536
-
 EngineSideChain::EngineSideChain(
         UserSettingsPointer pConfig,
         CSAMPLE* sidechainMix)
@@ -47,19 +46,24 @@ EngineSideChain::~EngineSideChain() {
     wait();
 
     MMutexLocker locker(&m_workerLock);
-    while (!m_workers.empty()) {
-        SideChainWorker* pWorker = m_workers.takeLast();
+    while (!m_workerLanes.empty()) {
+        SideChainWorkerLane* pLane = m_workerLanes.takeLast();
+        // Stop the lane thread before shutting down its worker so that
+        // no process() call is in flight anymore.
+        pLane->stop();
+        SideChainWorker* pWorker = pLane->worker();
         pWorker->shutdown();
         delete pWorker;
+        delete pLane;
     }
     locker.unlock();
 
     SampleUtil::free(m_pWorkBuffer);
 }
 
-void EngineSideChain::addSideChainWorker(SideChainWorker* pWorker) {
+void EngineSideChain::addSideChainWorker(SideChainWorker* pWorker, const QString& name) {
     MMutexLocker locker(&m_workerLock);
-    m_workers.append(pWorker);
+    m_workerLanes.append(new SideChainWorkerLane(pWorker, name));
 }
 
 void EngineSideChain::receiveBuffer(const AudioInput& input,
@@ -111,9 +115,12 @@ void EngineSideChain::run() {
         while ((samples_read = m_sampleFifo.read(m_pWorkBuffer,
                                                  SIDECHAIN_BUFFER_SIZE))) {
             Trace process("EngineSideChain::process");
+            // Fan the raw frames out to the per-worker lanes. Submitting
+            // is wait-free, a lane whose encoder has fallen behind drops
+            // samples for its own sink instead of delaying the others.
             MMutexLocker locker(&m_workerLock);
-            foreach (SideChainWorker* pWorker, m_workers) {
-                pWorker->process(m_pWorkBuffer, samples_read);
+            foreach (SideChainWorkerLane* pLane, m_workerLanes) {
+                pLane->submitSamples(m_pWorkBuffer, samples_read);
             }
         }
 
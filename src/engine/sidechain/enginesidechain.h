@@ -12,6 +12,7 @@
 #include "util/types.h"
 
 class SideChainWorker;
+class SideChainWorkerLane;
 
 class EngineSideChain : public QThread, public AudioDestination {
     Q_OBJECT
@@ -30,8 +31,11 @@ class EngineSideChain : public QThread, public AudioDestination {
             const CSAMPLE* pBuffer,
             unsigned int iFrames) override;
 
-    // Thread-safe, blocking.
-    void addSideChainWorker(SideChainWorker* pWorker);
+    // Thread-safe, blocking. Takes ownership of pWorker and runs it in
+    // a dedicated lane thread behind its own PCM ring, see
+    // SideChainWorkerLane. The name identifies the lane in logs and
+    // drop counters.
+    void addSideChainWorker(SideChainWorker* pWorker, const QString& name);
 
     static constexpr int SIDECHAIN_BUFFER_SIZE = 65536;
 
@@ -51,7 +55,9 @@ class EngineSideChain : public QThread, public AudioDestination {
     // Allows sleeping until we have samples to process.
     QWaitCondition m_waitForSamples;
 
-    // Sidechain workers registered with EngineSideChain.
+    // One lane per registered sidechain worker. Each lane runs its
+    // worker in a separate thread so the encoders cannot block each
+    // other or the fan-out below.
     MMutex m_workerLock;
-    QList<SideChainWorker*> m_workers GUARDED_BY(m_workerLock);
+    QList<SideChainWorkerLane*> m_workerLanes GUARDED_BY(m_workerLock);
 };
@@ -0,0 +1,133 @@
+#include "engine/sidechain/enginespectrum.h"
+
+#include <dsp/transforms/FFT.h>
+
+#include <cmath>
+
+#include "control/controlobject.h"
+#include "control/controlpushbutton.h"
+#include "util/math.h"
+
+namespace {
+
+const QString kAppGroup = QStringLiteral("[App]");
+
+// Mono transform size. At 48 kHz one frame covers ~43 ms with a bin
+// width of ~23 Hz, which is plenty of resolution for visualization
+// while keeping the transform cheap on the sidechain lane. The FFT
+// tables and window coefficients are precomputed once in the ctor.
+constexpr int kFftSize = 2048;
+
+// 50% overlap between consecutive transforms.
+constexpr int kHopSize = kFftSize / 2;
+
+// Range covered by the logarithmically spaced bands. The upper limit
+// is additionally clamped to the Nyquist frequency.
+constexpr double kMinBandHz = 40.0;
+constexpr double kMaxBandHz = 20000.0;
+
+// Band magnitudes are published normalized to [0.0, 1.0] with 0.0 at
+// or below this level and 1.0 at full scale.
+constexpr double kMinDb = -60.0;
+
+} // anonymous namespace
+
+EngineSpectrum::EngineSpectrum()
+        : m_fft(std::make_unique<FFTReal>(kFftSize)),
+          m_window(kFftSize),
+          m_windowedBuffer(kFftSize),
+          m_magnitudeBuffer(kFftSize),
+          m_bandEdgesSampleRate(0.0) {
+    m_pSpectrumEnabled = std::make_unique<ControlPushButton>(
+            ConfigKey(kAppGroup, QStringLiteral("spectrum_enabled")));
+    m_pSpectrumEnabled->setButtonMode(mixxx::control::ButtonMode::Toggle);
+    m_bands.reserve(kNumBands);
+    for (int band = 0; band < kNumBands; ++band) {
+        m_bands.push_back(std::make_unique<ControlObject>(ConfigKey(kAppGroup,
+                QStringLiteral("spectrum_band_%1").arg(band))));
+    }
+    for (int i = 0; i < kFftSize; ++i) {
+        m_window[i] = 0.5 - 0.5 * std::cos(2.0 * M_PI * i / kFftSize);
+    }
+    m_monoBuffer.reserve(kFftSize + kHopSize);
+}
+
+EngineSpectrum::~EngineSpectrum() = default;
+
+void EngineSpectrum::process(const CSAMPLE* pBuffer, const std::size_t bufferSize) {
+    if (!m_pSpectrumEnabled->toBool()) {
+        // Skip all work and drop stale input while nobody consumes the
+        // spectrum.
+        m_monoBuffer.clear();
+        return;
+    }
+
+    const double sampleRate = ControlObject::get(
+            ConfigKey(kAppGroup, QStringLiteral("samplerate")));
+    if (sampleRate <= 0) {
+        return;
+    }
+
+    // Fold the interleaved stereo mix into mono.
+    DEBUG_ASSERT(bufferSize % 2 == 0);
+    for (std::size_t i = 0; i + 1 < bufferSize; i += 2) {
+        m_monoBuffer.push_back(0.5 * (pBuffer[i] + pBuffer[i + 1]));
+    }
+
+    while (m_monoBuffer.size() >= static_cast<std::size_t>(kFftSize)) {
+        publishFrame(sampleRate);
+        m_monoBuffer.erase(m_monoBuffer.begin(), m_monoBuffer.begin() + kHopSize);
+    }
+}
+
+void EngineSpectrum::shutdown() {
+    for (const auto& pBand : m_bands) {
+        pBand->set(0.0);
+    }
+    m_monoBuffer.clear();
+}
+
+void EngineSpectrum::publishFrame(double sampleRate) {
+    updateBandEdges(sampleRate);
+
+    for (int i = 0; i < kFftSize; ++i) {
+        m_windowedBuffer[i] = m_monoBuffer[i] * m_window[i];
+    }
+    m_fft->forwardMagnitude(m_windowedBuffer.data(), m_magnitudeBuffer.data());
+
+    for (int band = 0; band < kNumBands; ++band) {
+        double peak = 0.0;
+        const int firstBin = math_min(m_bandEdges[band], kFftSize / 2);
+        const int endBin = math_min(m_bandEdges[band + 1], kFftSize / 2);
+        for (int bin = firstBin; bin < endBin; ++bin) {
+            peak = math_max(peak, m_magnitudeBuffer[bin]);
+        }
+        // Undo the FFT scaling and the coherent gain of the Hann
+        // window (0.5) so that a full scale sine peaks at 1.0, then
+        // map [kMinDb, 0 dB] onto [0.0, 1.0].
+        const double level = peak * 4.0 / kFftSize;
+        const double db = 20.0 * std::log10(math_max(level, 1e-10));
+        m_bands[band]->set(math_clamp((db - kMinDb) / -kMinDb, 0.0, 1.0));
+    }
+}
+
+void EngineSpectrum::updateBandEdges(double sampleRate) {
+    if (sampleRate == m_bandEdgesSampleRate) {
+        return;
+    }
+    m_bandEdgesSampleRate = sampleRate;
+    m_bandEdges.resize(kNumBands + 1);
+    const double binHz = sampleRate / kFftSize;
+    const double maxHz = math_min(kMaxBandHz, sampleRate / 2);
+    for (int band = 0; band <= kNumBands; ++band) {
+        const double hz = kMinBandHz *
+                std::pow(maxHz / kMinBandHz,
+                        static_cast<double>(band) / kNumBands);
+        m_bandEdges[band] = static_cast<int>(hz / binHz);
+    }
+    // Ensure each band covers at least one bin. Bands pushed beyond the
+    // Nyquist bin this way stay silent, see publishFrame().
+    for (int band = 1; band <= kNumBands; ++band) {
+        m_bandEdges[band] = math_max(m_bandEdges[band], m_bandEdges[band - 1] + 1);
+    }
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "engine/sidechain/sidechainworker.h"
+#include "util/types.h"
+
+class ControlObject;
+class ControlPushButton;
+class FFTReal;
+
+/// Sidechain worker that computes a coarse spectrum of the main mix for
+/// consumers outside of the audio pipeline, e.g. lighting controllers or
+/// skin visualizations.
+///
+/// The transform runs on the worker's sidechain lane, strictly off the
+/// engine callback. The band magnitudes are published through plain
+/// ControlObjects ([App],spectrum_band_0 .. spectrum_band_N), i.e. as
+/// lock-free atomic values that skins, controller mappings and the
+/// broadcast metadata layer can read without touching the worker.
+///
+/// The worker is idle unless a consumer sets [App],spectrum_enabled.
+class EngineSpectrum : public SideChainWorker {
+  public:
+    /// Number of published frequency bands.
+    static constexpr int kNumBands = 16;
+
+    EngineSpectrum();
+    ~EngineSpectrum() override;
+
+    void process(const CSAMPLE* pBuffer, const std::size_t bufferSize) override;
+    void shutdown() override;
+
+  private:
+    void publishFrame(double sampleRate);
+    void updateBandEdges(double sampleRate);
+
+    std::unique_ptr<ControlPushButton> m_pSpectrumEnabled;
+    std::vector<std::unique_ptr<ControlObject>> m_bands;
+
+    std::unique_ptr<FFTReal> m_fft;
+    // Precomputed Hann window coefficients.
+    std::vector<double> m_window;
+    // Mono samples pending analysis, sliding window with 50% overlap.
+    std::vector<double> m_monoBuffer;
+    std::vector<double> m_windowedBuffer;
+    std::vector<double> m_magnitudeBuffer;
+    // First FFT bin of each band plus an end sentinel, derived from the
+    // sample rate the buffered samples were captured at.
+    std::vector<int> m_bandEdges;
+    double m_bandEdgesSampleRate;
+};
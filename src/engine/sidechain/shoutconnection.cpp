@@ -33,6 +33,13 @@ constexpr int kMaxNetworkCache = 491520; // 10 s mp3 @ 192 kbit/s
 // Shoutcast default receive buffer 1048576 and autodumpsourcetime 30 s
 // http://wiki.shoutcast.com/wiki/SHOUTcast_DNAS_Server_2
 constexpr int kMaxShoutFailures = 3;
+// Give up a pending shout_open() after this long, matching the
+// kConnectRetries polls of 500 ms during the initial connect.
+constexpr double kReconnectTimeoutSeconds = 15.0;
+// Upper bound for the exponentially growing delay between reconnect
+// attempts, so a server that is down for long is not hammered while
+// brief drops are still retried quickly.
+constexpr double kMaxRetryDelaySeconds = 60.0;
 
 const mixxx::Logger kLogger("ShoutConnection");
 
@@ -64,6 +71,9 @@ ShoutConnection::ShoutConnection(BroadcastProfilePtr profile,
           m_ogg_dynamic_update(false),
           m_threadWaiting(false),
           m_retryCount(0),
+          m_reconnectState(ReconnectState::None),
+          m_currentRetryDelay(0.0),
+          m_jitterBuffer(kMaxNetworkCache),
           m_reconnectFirstDelay(0.0),
           m_reconnectPeriod(5.0),
           m_noDelayFirstReconnect(true),
@@ -587,10 +597,16 @@ bool ShoutConnection::processConnect() {
             kLogger.debug() << "***********Connected to streaming server...";
 
             m_retryCount = 0;
+            m_reconnectState = ReconnectState::None;
 
             if(m_pOutputFifo->readAvailable()) {
             	m_pOutputFifo->flushReadData(m_pOutputFifo->readAvailable());
             }
+            // Drop frames buffered by a previous connection, this is a
+            // fresh stream
+            if (m_jitterBuffer.readAvailable()) {
+                m_jitterBuffer.flushReadData(m_jitterBuffer.readAvailable());
+            }
             m_threadWaiting = true;
 
             setStatus(BroadcastProfile::STATUS_CONNECTED);
@@ -633,6 +649,7 @@ bool ShoutConnection::processConnect() {
 
 bool ShoutConnection::processDisconnect() {
     kLogger.debug() << "processDisconnect()";
+    m_reconnectState = ReconnectState::None;
     bool disconnected = false;
     if (isConnected()) {
     	m_threadWaiting = false;
@@ -653,9 +670,18 @@ bool ShoutConnection::processDisconnect() {
 void ShoutConnection::write(const unsigned char* header, const unsigned char* body,
                             int headerLen, int bodyLen) {
     setFunctionCode(7);
-	if (!m_pShout || m_iShoutStatus != SHOUTERR_CONNECTED) {
-        // This happens when the decoder calls flush() and the connection is
-        // already down
+    if (!m_pShout) {
+        return;
+    }
+	if (m_iShoutStatus != SHOUTERR_CONNECTED) {
+        if (m_reconnectState != ReconnectState::None) {
+            // Keep the encoded frames while a reconnect is pending, they
+            // are sent by finishReconnect() once the connection is back
+            bufferEncodedFrames(header, headerLen);
+            bufferEncodedFrames(body, bodyLen);
+        }
+        // Otherwise this happens when the decoder calls flush() and the
+        // connection is already down
         return;
     }
 
@@ -675,7 +701,7 @@ void ShoutConnection::write(const unsigned char* header, const unsigned char* bo
         kLogger.debug() << "shout_queuelen" << queuelen;
         if (queuelen > kMaxNetworkCache) {
             m_lastErrorStr = tr("Network cache overflow");
-            tryReconnect();
+            scheduleReconnect();
         }
     }
 }
@@ -712,7 +738,7 @@ bool ShoutConnection::writeSingle(const unsigned char* data, std::size_t len) {
                 << "writeSingle() error:"
                 << ret << m_lastErrorStr;
         if (++m_iShoutFailures > kMaxShoutFailures) {
-            tryReconnect();
+            scheduleReconnect();
         }
         return false;
     } else {
@@ -729,8 +755,11 @@ void ShoutConnection::process(const CSAMPLE* pBuffer, const std::size_t bufferSi
 
     setState(NETWORKSTREAMWORKER_STATE_BUSY);
 
-    // If we aren't connected, bail.
-    if (m_iShoutStatus != SHOUTERR_CONNECTED) {
+    // If we aren't connected and no reconnect is under way, bail.
+    // While reconnecting the encoder keeps running, so the frames
+    // pile up in the jitter buffer instead of being thrown away.
+    if (m_iShoutStatus != SHOUTERR_CONNECTED &&
+            m_reconnectState == ReconnectState::None) {
         return;
     }
 
@@ -747,7 +776,7 @@ void ShoutConnection::process(const CSAMPLE* pBuffer, const std::size_t bufferSi
     }
 
     // Check if track metadata has changed and if so, update.
-    if (metaDataHasChanged()) {
+    if (m_iShoutStatus == SHOUTERR_CONNECTED && metaDataHasChanged()) {
         updateMetaData();
     }
     setState(NETWORKSTREAMWORKER_STATE_READY);
@@ -900,57 +929,192 @@ void ShoutConnection::infoDialog(const QString& text, const QString& detailedInf
     ErrorDialogHandler::instance()->requestErrorDialog(props);
 }
 
-bool ShoutConnection::waitForRetry() {
+bool ShoutConnection::scheduleNextRetry() {
     if (m_limitReconnects &&
             m_retryCount >= m_maximumRetries) {
         return false;
     }
     ++m_retryCount;
 
-    kLogger.debug() << "waitForRetry()" << m_retryCount << "/" << m_maximumRetries;
+    kLogger.debug() << "scheduleNextRetry()" << m_retryCount << "/" << m_maximumRetries;
 
-    double delay;
     if (m_retryCount == 1) {
-        delay = m_reconnectFirstDelay;
+        m_currentRetryDelay = m_noDelayFirstReconnect ? 0.0 : m_reconnectFirstDelay;
+    } else if (m_retryCount == 2) {
+        m_currentRetryDelay = m_reconnectPeriod;
     } else {
-        delay = m_reconnectPeriod;
+        // Exponential backoff, brief drops reconnect after the configured
+        // period while a server that stays down is probed less and less
+        m_currentRetryDelay = math_min(
+                m_currentRetryDelay * 2.0, kMaxRetryDelaySeconds);
     }
+    m_reconnectTimer.start();
+    return true;
+}
 
-    if (delay > 0) {
-        m_enabledMutex.lock();
-        m_waitEnabled.wait(&m_enabledMutex, static_cast<unsigned long>(delay * 1000));
-        m_enabledMutex.unlock();
-        if (!m_pProfile->getEnabled()) {
-            return false;
+void ShoutConnection::scheduleReconnect() {
+    if (m_reconnectState != ReconnectState::None) {
+        return;
+    }
+    kLogger.debug() << "scheduleReconnect()";
+    m_reconnectErrorStr = m_lastErrorStr;
+    setStatus(BroadcastProfile::STATUS_CONNECTING);
+
+    // Close the dead connection, but unlike processDisconnect() keep the
+    // encoder alive and the engine feeding the FIFO: the encoded frames
+    // pile up in the jitter buffer until the connection is back.
+    shout_close(m_pShout);
+    m_iShoutStatus = SHOUTERR_UNCONNECTED;
+    emit broadcastDisconnected();
+
+    if (scheduleNextRetry()) {
+        m_reconnectState = ReconnectState::Backoff;
+    } else {
+        // Reconnecting is disabled in the preferences
+        failReconnect();
+    }
+}
+
+void ShoutConnection::processReconnect() {
+    switch (m_reconnectState) {
+    case ReconnectState::None:
+        return;
+    case ReconnectState::Backoff: {
+        if (m_reconnectTimer.elapsed().toDoubleSeconds() < m_currentRetryDelay) {
+            // Still backing off
+            return;
         }
+        shout_close(m_pShout);
+        m_iShoutStatus = shout_open(m_pShout);
+        if (m_iShoutStatus == SHOUTERR_SUCCESS) {
+            m_iShoutStatus = SHOUTERR_CONNECTED;
+        }
+        if (m_iShoutStatus == SHOUTERR_CONNECTED) {
+            finishReconnect();
+            return;
+        }
+        if (m_iShoutStatus == SHOUTERR_BUSY) {
+            m_reconnectState = ReconnectState::Connecting;
+            m_reconnectTimer.start();
+            return;
+        }
+        m_lastErrorStr = shout_get_error(m_pShout);
+        // see processConnect() for the fatal error codes
+        if (m_iShoutStatus == SHOUTERR_INSANE ||
+                m_iShoutStatus == SHOUTERR_UNSUPPORTED ||
+                m_iShoutStatus == SHOUTERR_NOLOGIN ||
+                m_iShoutStatus == SHOUTERR_MALLOC) {
+            qWarning() << "Streaming server made fatal error. Can't continue reconnecting:"
+                       << m_lastErrorStr;
+            failReconnect();
+            return;
+        }
+        kLogger.warning()
+                << "processReconnect() attempt failed:"
+                << m_iShoutStatus << m_lastErrorStr;
+        if (!scheduleNextRetry()) {
+            failReconnect();
+        }
+        return;
     }
-    return true;
+    case ReconnectState::Connecting: {
+        m_iShoutStatus = shout_get_connected(m_pShout);
+        if (m_iShoutStatus == SHOUTERR_CONNECTED) {
+            finishReconnect();
+            return;
+        }
+        if (m_iShoutStatus == SHOUTERR_BUSY &&
+                m_reconnectTimer.elapsed().toDoubleSeconds() <
+                        kReconnectTimeoutSeconds) {
+            // Connection pending, check again on the next round
+            return;
+        }
+        if (m_iShoutStatus == SHOUTERR_BUSY) {
+            // Not translated, because shout_get_error() returns also English only
+            m_lastErrorStr = QStringLiteral("Connection establishment time-out");
+        } else {
+            m_lastErrorStr = shout_get_error(m_pShout);
+        }
+        kLogger.warning()
+                << "processReconnect() error:"
+                << m_iShoutStatus << m_lastErrorStr;
+        if (scheduleNextRetry()) {
+            m_reconnectState = ReconnectState::Backoff;
+        } else {
+            failReconnect();
+        }
+        return;
+    }
+    }
+}
+
+void ShoutConnection::finishReconnect() {
+    kLogger.debug() << "***********Reconnected to streaming server...";
+    setState(NETWORKSTREAMWORKER_STATE_READY);
+    m_iShoutFailures = 0;
+    m_retryCount = 0;
+    m_reconnectState = ReconnectState::None;
+    setStatus(BroadcastProfile::STATUS_CONNECTED);
+    emit broadcastConnected();
+    // Send the frames that were encoded while the connection was down
+    // before any new ones, so the listeners resume without a hole
+    drainJitterBuffer();
 }
 
-void ShoutConnection::tryReconnect() {
-    QString originalErrorStr = m_lastErrorStr;
+void ShoutConnection::failReconnect() {
+    m_reconnectState = ReconnectState::None;
     setStatus(BroadcastProfile::STATUS_FAILURE);
 
-    processDisconnect();
-    while (waitForRetry()) {
-        if (processConnect()) {
-            break;
-        }
+    QString errorText;
+    if (m_retryCount > 0) {
+        errorText = tr("Lost connection to streaming server and %1 attempts to reconnect have failed.")
+                .arg(m_retryCount);
+    } else {
+        errorText = tr("Lost connection to streaming server.");
     }
+    errorDialog(errorText,
+                m_reconnectErrorStr + "\n" +
+                m_lastErrorStr + "\n" +
+                tr("Please check your connection to the Internet."));
+}
 
-    if (getStatus() == BroadcastProfile::STATUS_FAILURE) {
-        QString errorText;
-        if (m_retryCount > 0) {
-            errorText = tr("Lost connection to streaming server and %1 attempts to reconnect have failed.")
-                    .arg(m_retryCount);
-        } else {
-            errorText = tr("Lost connection to streaming server.");
-        }
-        errorDialog(errorText,
-                    originalErrorStr + "\n" +
-                    m_lastErrorStr + "\n" +
-                    tr("Please check your connection to the Internet."));
+void ShoutConnection::bufferEncodedFrames(const unsigned char* pData, int len) {
+    if (len <= 0) {
+        return;
+    }
+    if (m_jitterBuffer.writeAvailable() < len) {
+        // The reconnect takes longer than the buffer can bridge. Drop all
+        // buffered frames instead of just the oldest bytes: the new data
+        // starts at an encoder frame boundary whereas a cut in the middle
+        // of a frame would corrupt the stream.
+        kLogger.warning()
+                << "Jitter buffer overflow, dropping"
+                << m_jitterBuffer.readAvailable()
+                << "buffered bytes";
+        m_jitterBuffer.flushReadData(m_jitterBuffer.readAvailable());
+    }
+    m_jitterBuffer.write(pData, len);
+}
+
+void ShoutConnection::drainJitterBuffer() {
+    const int readAvailable = m_jitterBuffer.readAvailable();
+    if (readAvailable == 0) {
+        return;
+    }
+    kLogger.debug() << "drainJitterBuffer: sending" << readAvailable << "buffered bytes";
+
+    unsigned char* dataPtr1;
+    ring_buffer_size_t size1;
+    unsigned char* dataPtr2;
+    ring_buffer_size_t size2;
+
+    // We use size1 and size2, so we can ignore the return value
+    (void)m_jitterBuffer.aquireReadRegions(readAvailable, &dataPtr1, &size1,
+            &dataPtr2, &size2);
+    if (writeSingle(dataPtr1, size1) && size2 > 0) {
+        writeSingle(dataPtr2, size2);
     }
+    m_jitterBuffer.releaseReadRegions(readAvailable);
 }
 
 void ShoutConnection::outputAvailable() {
@@ -1010,6 +1174,10 @@ void ShoutConnection::run() {
 
         setFunctionCode(1);
         incRunCount();
+        // Advance a pending reconnect by one step. This runs in the loop
+        // instead of blocking, so the thread keeps draining the engine
+        // FIFO into the encoder while the connection is down.
+        processReconnect();
         if(!m_readSema.tryAcquire(1, 1000)) {
             continue;
         }
@@ -16,6 +16,7 @@
 #include "preferences/usersettings.h"
 #include "track/track_decl.h"
 #include "util/fifo.h"
+#include "util/performancetimer.h"
 
 // Forward declare libshout structures to prevent leaking shout.h definitions
 // beyond where they are needed.
@@ -105,9 +106,22 @@ class ShoutConnection
 
     QByteArray encodeString(const QString& string);
 
-    bool waitForRetry();
+    // Closes the dead connection and arms the reconnect state machine.
+    // Unlike a disconnect the encoder is kept alive, so the frames encoded
+    // while the connection is down pile up in the jitter buffer.
+    void scheduleReconnect();
+    // Advances a pending reconnect by one non-blocking step. Called from
+    // the run() loop, which keeps draining the engine FIFO in between.
+    void processReconnect();
+    void finishReconnect();
+    // Bumps the retry counter and starts the backoff delay before the next
+    // attempt. Returns false when the retries are exhausted.
+    bool scheduleNextRetry();
+    void failReconnect();
+
+    void bufferEncodedFrames(const unsigned char* pData, int len);
+    void drainJitterBuffer();
 
-    void tryReconnect();
     void insertMetaData(const char *name, const char *value);
 
     QTextCodec* m_pTextCodec;
@@ -147,6 +161,23 @@ class ShoutConnection
     QString m_lastErrorStr;
     int m_retryCount;
 
+    // A lost connection is re-established in small non-blocking steps
+    // interleaved with draining the engine FIFO, see processReconnect().
+    enum class ReconnectState {
+        None,       // connected, or given up
+        Backoff,    // waiting for the retry delay to pass
+        Connecting, // waiting for a pending shout_open() to complete
+    };
+    ReconnectState m_reconnectState;
+    double m_currentRetryDelay;
+    PerformanceTimer m_reconnectTimer;
+    QString m_reconnectErrorStr;
+
+    // Encoded frames that pile up while the connection is down. The content
+    // survives the reconnect and is sent before any freshly encoded frames,
+    // so brief network drops stay inaudible to the stream listeners.
+    FIFO<unsigned char> m_jitterBuffer;
+
     double m_reconnectFirstDelay;
     double m_reconnectPeriod;
     bool m_noDelayFirstReconnect;
@@ -0,0 +1,87 @@
+#include "engine/sidechain/sidechainworkerlane.h"
+
+#include <QtDebug>
+
+#include "engine/sidechain/enginesidechain.h"
+#include "engine/sidechain/sidechainworker.h"
+#include "moc_sidechainworkerlane.cpp"
+#include "util/counter.h"
+#include "util/event.h"
+#include "util/sample.h"
+#include "util/trace.h"
+
+SideChainWorkerLane::SideChainWorkerLane(
+        SideChainWorker* pWorker, const QString& name)
+        : m_pWorker(pWorker),
+          m_name(name),
+          m_bStopThread(false),
+          m_sampleFifo(EngineSideChain::SIDECHAIN_BUFFER_SIZE),
+          m_pWorkBuffer(SampleUtil::alloc(EngineSideChain::SIDECHAIN_BUFFER_SIZE)),
+          m_droppedSamples(0) {
+    // Encoding is semi-realtime work just like the sidechain fan-out
+    // itself, see the priority discussion in EngineSideChain.
+    start(QThread::HighPriority);
+}
+
+SideChainWorkerLane::~SideChainWorkerLane() {
+    stop();
+    SampleUtil::free(m_pWorkBuffer);
+}
+
+void SideChainWorkerLane::submitSamples(const CSAMPLE* pBuffer, int numSamples) {
+    const int numSamplesWritten = m_sampleFifo.write(pBuffer, numSamples);
+
+    if (numSamplesWritten != numSamples) {
+        // The worker cannot keep up with the incoming frames. Drop the
+        // remainder for this sink only instead of blocking the fan-out
+        // thread and starving the other sinks.
+        const int numSamplesDropped = numSamples - numSamplesWritten;
+        m_droppedSamples += numSamplesDropped;
+        Counter(QStringLiteral("SideChainWorkerLane %1 dropped samples")
+                        .arg(m_name))
+                .increment(numSamplesDropped);
+        qWarning() << "SideChainWorkerLane" << m_name
+                   << "fell behind, dropped" << numSamplesDropped
+                   << "samples (" << m_droppedSamples << "total )";
+    }
+
+    m_waitForSamples.wakeAll();
+}
+
+void SideChainWorkerLane::stop() {
+    m_waitLock.lock();
+    m_bStopThread = true;
+    m_waitForSamples.wakeAll();
+    m_waitLock.unlock();
+
+    // Wait until the thread has finished.
+    wait();
+}
+
+void SideChainWorkerLane::run() {
+    QThread::currentThread()->setObjectName(
+            QStringLiteral("SideChainWorkerLane %1").arg(m_name));
+    const QString tag = QStringLiteral("SideChainWorkerLane %1").arg(m_name);
+    Event::start(tag);
+    while (!m_bStopThread) {
+        // Sleep until samples are available.
+        m_waitLock.lock();
+
+        Event::end(tag);
+        m_waitForSamples.wait(&m_waitLock);
+        m_waitLock.unlock();
+        Event::start(tag);
+
+        int samples_read;
+        while ((samples_read = m_sampleFifo.read(m_pWorkBuffer,
+                        EngineSideChain::SIDECHAIN_BUFFER_SIZE))) {
+            Trace process("SideChainWorkerLane::process");
+            m_pWorker->process(m_pWorkBuffer, samples_read);
+        }
+
+        // Check to see if we're supposed to exit/stop this thread.
+        if (m_bStopThread) {
+            return;
+        }
+    }
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <QMutex>
+#include <QString>
+#include <QThread>
+#include <QWaitCondition>
+
+#include "util/fifo.h"
+#include "util/types.h"
+
+class SideChainWorker;
+
+// Runs a single SideChainWorker (recording or broadcast encoder) in its
+// own thread behind a lock-free PCM ring. The sidechain fan-out thread
+// submits raw frames wait-free and never blocks on an encoder, so a
+// stalling encoder (e.g. a broadcast connection with a congested network
+// link) can no longer hold up the other sinks. When an encoder falls
+// behind, samples are dropped for that sink only and the drops are
+// counted per lane.
+class SideChainWorkerLane : public QThread {
+    Q_OBJECT
+  public:
+    SideChainWorkerLane(SideChainWorker* pWorker, const QString& name);
+    ~SideChainWorkerLane() override;
+
+    // Not thread-safe, wait-free. Should only be called from a single
+    // writer thread (the sidechain fan-out thread).
+    void submitSamples(const CSAMPLE* pBuffer, int numSamples);
+
+    // Thread-safe, blocking. Stops the lane thread. The worker itself is
+    // not shut down, that remains the responsibility of the owner.
+    void stop();
+
+    SideChainWorker* worker() const {
+        return m_pWorker;
+    }
+
+  private:
+    void run() override;
+
+    SideChainWorker* m_pWorker;
+    const QString m_name;
+    // Indicates that the thread should exit.
+    volatile bool m_bStopThread;
+
+    FIFO<CSAMPLE> m_sampleFifo;
+    CSAMPLE* m_pWorkBuffer;
+
+    // Total number of samples dropped because the worker fell behind.
+    qint64 m_droppedSamples;
+
+    // Provides thread safety around the wait condition below.
+    QMutex m_waitLock;
+    // Allows sleeping until we have samples to process.
+    QWaitCondition m_waitForSamples;
+};
@@ -17,7 +17,8 @@ constexpr mixxx::Bpm kDefaultBpm = mixxx::Bpm(124.0);
 EngineSync::EngineSync(UserSettingsPointer pConfig)
         : m_pConfig(pConfig),
           m_pInternalClock(new InternalClock(kInternalClockGroup, this)),
-          m_pLeaderSyncable(nullptr) {
+          m_pLeaderSyncable(nullptr),
+          m_pUniquePlayingSyncable(nullptr) {
     qRegisterMetaType<SyncMode>("SyncMode");
     m_pInternalClock->updateLeaderBpm(kDefaultBpm);
 }
@@ -142,6 +143,7 @@ void EngineSync::activateFollower(Syncable* pSyncable) {
     }
 
     pSyncable->setSyncMode(SyncMode::Follower);
+    updateUniquePlayingSyncedDeck();
 }
 
 void EngineSync::activateLeader(Syncable* pSyncable, SyncMode leaderType) {
@@ -183,6 +185,7 @@ void EngineSync::activateLeader(Syncable* pSyncable, SyncMode leaderType) {
         // new deck.
         activateFollower(m_pInternalClock);
     }
+    updateUniquePlayingSyncedDeck();
 
     // It is up to callers of this function to initialize bpm and beat_distance
     // if necessary.
@@ -199,6 +202,7 @@ void EngineSync::deactivateSync(Syncable* pSyncable) {
 
     // Notifications happen after-the-fact.
     pSyncable->setSyncMode(SyncMode::None);
+    updateUniquePlayingSyncedDeck();
 
     bool bSyncDeckExists = syncDeckExists();
     if (pSyncable != m_pInternalClock && !bSyncDeckExists) {
@@ -405,6 +409,7 @@ void EngineSync::notifyPlayingAudible(Syncable* pSyncable, bool playingAudible)
     if (!pSyncable->isSynchronized()) {
         return;
     }
+    updateUniquePlayingSyncedDeck();
 
     // similar to enablesync -- we pick a new leader and maybe reinit.
     Syncable* newLeader = pickLeader(pSyncable, playingAudible);
@@ -753,9 +758,9 @@ void EngineSync::reinitLeaderParams(Syncable* pSource) {
     }
 }
 
-Syncable* EngineSync::getUniquePlayingSyncedDeck() const {
+void EngineSync::updateUniquePlayingSyncedDeck() {
     Syncable* onlyPlaying = nullptr;
-    for (Syncable* pSyncable : m_syncables) {
+    for (Syncable* pSyncable : std::as_const(m_syncables)) {
         if (!pSyncable->isSynchronized()) {
             continue;
         }
@@ -764,9 +769,10 @@ Syncable* EngineSync::getUniquePlayingSyncedDeck() const {
             if (!onlyPlaying) {
                 onlyPlaying = pSyncable;
             } else {
-                return nullptr;
+                onlyPlaying = nullptr;
+                break;
             }
         }
     }
-    return onlyPlaying;
+    m_pUniquePlayingSyncable = onlyPlaying;
 }
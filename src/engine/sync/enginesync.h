@@ -133,8 +133,18 @@ class EngineSync : public SyncableListener {
     void reinitLeaderParams(Syncable* pSource);
 
     /// Iff there is a single playing syncable in sync mode, return it.
-    /// This is used to initialize leader params.
-    Syncable* getUniquePlayingSyncedDeck() const;
+    /// This is used to initialize leader params. The value is recomputed
+    /// by updateUniquePlayingSyncedDeck() whenever a sync mode or playing
+    /// state changes, so reading it here is free for the per-callback
+    /// beat distance updates.
+    Syncable* getUniquePlayingSyncedDeck() const {
+        return m_pUniquePlayingSyncable;
+    }
+
+    /// Recompute the cached unique playing synced deck. Must be called
+    /// after every change of a Syncable's sync mode or playing/audible
+    /// state.
+    void updateUniquePlayingSyncedDeck();
 
     /// Only for testing. Do not use.
     Syncable* getSyncableForGroup(const QString& group);
@@ -165,6 +175,9 @@ class EngineSync : public SyncableListener {
     InternalClock* m_pInternalClock;
     /// The current Syncable that is the leader.
     Syncable* m_pLeaderSyncable;
+    /// Cached result of updateUniquePlayingSyncedDeck(), see
+    /// getUniquePlayingSyncedDeck().
+    Syncable* m_pUniquePlayingSyncable;
     /// The list of all Syncables registered via addSyncableDeck.
     QList<Syncable*> m_syncables;
 };
@@ -33,6 +33,7 @@ SyncControl::SyncControl(const QString& group,
           m_pBpmControl(nullptr),
           m_pRateControl(nullptr),
           m_bOldScratching(false),
+          m_mode(SyncMode::None),
           m_leaderBpmAdjustFactor(kBpmUnity),
           m_unmultipliedTargetBeatDistance(0.0),
           m_pBpm(nullptr),
@@ -140,7 +141,7 @@ void SyncControl::setEngineControls(RateControl* pRateControl,
 }
 
 SyncMode SyncControl::getSyncMode() const {
-    return syncModeFromDouble(m_pSyncMode->get());
+    return m_mode;
 }
 
 void SyncControl::setSyncMode(SyncMode mode) {
@@ -149,6 +150,7 @@ void SyncControl::setSyncMode(SyncMode mode) {
     }
     // SyncControl has absolutely no say in the matter. This is what EngineSync
     // requires. Bypass confirmation by using setAndConfirm.
+    m_mode = mode;
     m_pSyncMode->setAndConfirm(static_cast<double>(mode));
     m_pSyncEnabled->setAndConfirm(mode != SyncMode::None);
     m_pSyncLeaderEnabled->setAndConfirm(static_cast<double>(SyncModeToLeaderLight(mode)));
@@ -122,6 +122,12 @@ class SyncControl : public EngineControl, public Syncable {
     BpmControl* m_pBpmControl;
     RateControl* m_pRateControl;
     bool m_bOldScratching;
+    // Cached copy of the sync_mode control. The control only ever changes
+    // through setSyncMode(), so the cache is always consistent and spares
+    // the engine callback a control read plus double-to-enum conversion
+    // for every getSyncMode()/isSynchronized() call (the same scheme as
+    // InternalClock::m_mode).
+    SyncMode m_mode;
 
     // When syncing, sometimes it's better to match half or double the
     // leader bpm.
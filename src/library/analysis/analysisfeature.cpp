@@ -10,6 +10,7 @@
 #include "library/trackcollectionmanager.h"
 #include "moc_analysisfeature.cpp"
 #include "sources/soundsourceproxy.h"
+#include "util/db/dbconnectionpooled.h"
 #include "util/dnd.h"
 #include "util/logger.h"
 #include "widget/wlibrary.h"
@@ -40,6 +41,9 @@ AnalyzerModeFlags getAnalyzerModeFlags(
     if (pConfig->getValue<bool>(ConfigKey("[Library]", "EnableWaveformGenerationWithAnalysis"), true)) {
         modeFlags |= AnalyzerModeFlags::WithWaveform;
     }
+    if (pConfig->getValue<bool>(ConfigKey("[Library]", "ParallelTrackAnalysis"), false)) {
+        modeFlags |= AnalyzerModeFlags::ParallelAnalyzers;
+    }
     return static_cast<AnalyzerModeFlags>(modeFlags);
 }
 
@@ -113,6 +117,21 @@ void AnalysisFeature::bindLibraryWidget(WLibrary* libraryWidget,
     emit analysisActive(static_cast<bool>(m_pTrackAnalysisScheduler));
 
     libraryWidget->registerView(kViewName, m_pAnalysisView);
+
+    // Resume a batch analysis that a previous session left unfinished,
+    // e.g. because Mixxx crashed or was killed. The persisted queue only
+    // contains tracks whose scheduled analysis never completed, stopping
+    // or finishing a batch analysis clears it.
+    const QList<AnalyzerScheduledTrack> persistedTracks =
+            TrackAnalysisScheduler::takePersistedTracks(
+                    mixxx::DbConnectionPooled(m_pLibrary->dbConnectionPool()));
+    if (!persistedTracks.isEmpty()) {
+        kLogger.info()
+                << "Resuming analysis of"
+                << persistedTracks.size()
+                << "tracks scheduled by the previous session";
+        analyzeTracks(persistedTracks);
+    }
 }
 
 TreeItemModel* AnalysisFeature::sidebarModel() const {
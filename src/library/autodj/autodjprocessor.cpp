@@ -17,6 +17,13 @@ constexpr double kKeepPosition = -1.0;
 // A track needs to be longer than two callbacks to not stop AutoDJ
 constexpr double kMinimumTrackDurationSec = 0.2;
 
+// Delay before refilling the queue with random tracks after a track has
+// been consumed during a transition. The refill issues database queries
+// and file system checks that must not run while the fade and the track
+// load of the next deck are in progress. Tracks added by the refill are
+// not needed before the following transition, minutes later.
+constexpr int kRandomRefillDelayMillis = 2000;
+
 constexpr bool sDebug = false;
 } // anonymous namespace
 
@@ -140,6 +147,12 @@ AutoDJProcessor::AutoDJProcessor(
             this,
             &AutoDJProcessor::controlAddRandomTrack);
     connect(&m_fadeNow, &ControlObject::valueChanged, this, &AutoDJProcessor::controlFadeNow);
+
+    m_randomRefillTimer.setSingleShot(true);
+    connect(&m_randomRefillTimer,
+            &QTimer::timeout,
+            this,
+            &AutoDJProcessor::maybeFillRandomTracks);
     m_enabledAutoDJ.setButtonMode(mixxx::control::ButtonMode::Toggle);
     m_enabledAutoDJ.connectValueChangeRequest(this,
             &AutoDJProcessor::controlEnableChangeRequest);
@@ -348,7 +361,7 @@ AutoDJProcessor::AutoDJError AutoDJProcessor::skipNext() {
         } else {
             m_pAutoDJTableModel->removeTrack(m_pAutoDJTableModel->index(0, 0));
         }
-        maybeFillRandomTracks();
+        scheduleRandomRefill();
     }
     return ADJ_OK;
 }
@@ -971,11 +984,17 @@ bool AutoDJProcessor::removeTrackFromTopOfQueue(TrackPointer pTrack) {
         m_pAutoDJTableModel->appendTrack(nextId);
     }
 
-    maybeFillRandomTracks();
+    scheduleRandomRefill();
     return true;
 }
 
+void AutoDJProcessor::scheduleRandomRefill() {
+    m_randomRefillTimer.start(kRandomRefillDelayMillis);
+}
+
 void AutoDJProcessor::maybeFillRandomTracks() {
+    // A direct invocation supersedes a pending deferred refill.
+    m_randomRefillTimer.stop();
     int minAutoDJCrateTracks = m_pConfig->getValueString(
             ConfigKey(kConfigKey, "RandomQueueMinimumAllowed")).toInt();
     bool randomQueueEnabled = (((m_pConfig->getValueString(
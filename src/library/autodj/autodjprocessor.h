@@ -2,6 +2,7 @@
 
 #include <QObject>
 #include <QString>
+#include <QTimer>
 #include <memory>
 #include <vector>
 
@@ -296,6 +297,11 @@ class AutoDJProcessor : public QObject {
     // present.
     bool removeTrackFromTopOfQueue(TrackPointer pTrack);
     void maybeFillRandomTracks();
+    // Schedules maybeFillRandomTracks() on a single-shot timer. Used on the
+    // transition path, where the random track query and file checks must not
+    // delay the fade and track load work. Bursts of queue changes are
+    // coalesced into a single refill.
+    void scheduleRandomRefill();
     UserSettingsPointer m_pConfig;
     parented_ptr<PlaylistTableModel> m_pAutoDJTableModel;
 
@@ -317,5 +323,7 @@ class AutoDJProcessor : public QObject {
     ControlPushButton m_fadeNow;
     ControlPushButton m_enabledAutoDJ;
 
+    QTimer m_randomRefillTimer;
+
     DISALLOW_COPY_AND_ASSIGN(AutoDJProcessor);
 };
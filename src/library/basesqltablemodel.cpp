@@ -1,5 +1,6 @@
 #include "library/basesqltablemodel.h"
 
+#include <QTimer>
 #include <QUrl>
 #include <QtDebug>
 #include <algorithm>
@@ -44,8 +45,12 @@ BaseSqlTableModel::BaseSqlTableModel(
         const char* settingsNamespace)
         : BaseTrackTableModel(parent, pTrackCollectionManager, settingsNamespace),
           m_pTrackCollectionManager(pTrackCollectionManager),
-          m_database(pTrackCollectionManager->internalCollection()->database()),
-          m_bInitialized(false) {
+          // Table models only ever select and may be refreshed while the
+          // library scanner is committing, so they read through the
+          // read-only snapshot connection that writers cannot block.
+          m_database(pTrackCollectionManager->internalCollection()->readOnlyDatabase()),
+          m_bInitialized(false),
+          m_firstSelectPreviewRows(0) {
 }
 
 BaseSqlTableModel::~BaseSqlTableModel() {
@@ -191,6 +196,80 @@ void BaseSqlTableModel::replaceRows(
     }
 }
 
+void BaseSqlTableModel::applyRowChanges(
+        QVector<RowInfo>&& rows,
+        TrackId2Rows&& trackIdToRows,
+        TrackPos2Row&& trackPosToRows) {
+    const int oldSize = m_rowInfo.size();
+    const int newSize = rows.size();
+
+    // Match the new rows against the current rows by their track id
+    // sequence from both ends. The unmatched middle section is the only
+    // part that needs to be removed and/or inserted.
+    int prefix = 0;
+    while (prefix < oldSize && prefix < newSize &&
+            m_rowInfo[prefix].trackId == rows[prefix].trackId) {
+        ++prefix;
+    }
+    int suffix = 0;
+    while (suffix < oldSize - prefix && suffix < newSize - prefix &&
+            m_rowInfo[oldSize - 1 - suffix].trackId ==
+                    rows[newSize - 1 - suffix].trackId) {
+        ++suffix;
+    }
+
+    if (prefix + suffix == 0 && oldSize > 0 && newSize > 0) {
+        // Nothing matches, e.g. after changing the sort order or the
+        // search. Replacing all rows at once is cheaper than patching
+        // and the view state would be meaningless anyway.
+        clearRows();
+        replaceRows(
+                std::move(rows),
+                std::move(trackIdToRows),
+                std::move(trackPosToRows));
+        return;
+    }
+
+    const int removedCount = oldSize - prefix - suffix;
+    DEBUG_ASSERT(removedCount >= 0);
+    if (removedCount > 0) {
+        beginRemoveRows(QModelIndex(), prefix, prefix + removedCount - 1);
+        m_rowInfo.remove(prefix, removedCount);
+        endRemoveRows();
+    }
+
+    const int insertedCount = newSize - prefix - suffix;
+    DEBUG_ASSERT(insertedCount >= 0);
+    if (insertedCount > 0) {
+        beginInsertRows(QModelIndex(), prefix, prefix + insertedCount - 1);
+        for (int i = 0; i < insertedCount; ++i) {
+            m_rowInfo.insert(prefix + i, rows[prefix + i]);
+        }
+        endInsertRows();
+    }
+    DEBUG_ASSERT(m_rowInfo.size() == newSize);
+
+    // The values of the retained rows may have changed even though their
+    // track ids match, e.g. the positions of all subsequent tracks shift
+    // when removing a track from a playlist. Patch them in place.
+    for (int i = 0; i < prefix; ++i) {
+        m_rowInfo[i] = rows[i];
+    }
+    for (int i = newSize - suffix; i < newSize; ++i) {
+        m_rowInfo[i] = rows[i];
+    }
+
+    // The lookup tables always refer to the new row indices.
+    m_trackIdToRows = std::move(trackIdToRows);
+    m_trackPosToRow = std::move(trackPosToRows);
+
+    if (newSize > 0 && prefix + suffix > 0) {
+        emit dataChanged(
+                index(0, 0),
+                index(newSize - 1, columnCount() - 1));
+    }
+}
+
 void BaseSqlTableModel::select() {
     if (!m_bInitialized) {
         return;
@@ -217,6 +296,16 @@ void BaseSqlTableModel::select() {
     QString queryString = QString("SELECT %1 FROM %2 %3")
                                   .arg(m_tableColumns.join(","), m_tableName, m_tableOrderBy);
 
+    // If a preview row count has been set, only fetch the first few rows
+    // now so the view paints immediately and schedule the unlimited
+    // select right behind it on the event loop. See
+    // setFirstSelectPreviewRowCount().
+    const bool previewSelect = m_firstSelectPreviewRows > 0;
+    if (previewSelect) {
+        queryString += QString(" LIMIT %1").arg(m_firstSelectPreviewRows);
+        m_firstSelectPreviewRows = 0;
+    }
+
     if (sDebug) {
         qDebug() << this << "select() executing:" << queryString;
     }
@@ -234,10 +323,10 @@ void BaseSqlTableModel::select() {
         return;
     }
 
-    // Remove all the rows from the table after(!) the query has been
-    // executed successfully. See issue #6782.
-    // TODO(rryan) we could edit the table in place instead of clearing it?
-    clearRows();
+    // Note: The current rows are kept in place until the end, where the
+    // new result set is diffed against them. Clearing the model before
+    // the query has been executed successfully must be avoided anyway,
+    // see issue #6782.
 
     // The size of the result set is not known in advance for a
     // forward-only query, so we cannot reserve memory for rows
@@ -286,7 +375,16 @@ void BaseSqlTableModel::select() {
         qDebug() << "Rows actually received:" << rowInfos.size();
     }
 
-    if (m_trackSource) {
+    if (previewSelect) {
+        // Skip filtering and sorting: filterAndSort() would build the full
+        // track source index, which is exactly the cost the preview pass
+        // defers. Indexing only the fetched tracks lets data() serve their
+        // values; the rows keep the query order until the unlimited select
+        // lands and is merged in by applyRowChanges().
+        if (m_trackSource) {
+            m_trackSource->buildPartialIndex(trackIds);
+        }
+    } else if (m_trackSource) {
         m_trackSource->filterAndSort(trackIds,
                 m_currentSearch,
                 m_currentSearchFilter,
@@ -344,8 +442,9 @@ void BaseSqlTableModel::select() {
         DEBUG_ASSERT(trackPosToRows.size() == rowInfos.size());
     }
 
-    // We're done! Issue the update signals and replace the main maps.
-    replaceRows(
+    // We're done! Patch the current rows in place where possible and
+    // issue the update signals.
+    applyRowChanges(
             std::move(rowInfos),
             std::move(trackIdToRows),
             std::move(trackPosToRows));
@@ -354,6 +453,12 @@ void BaseSqlTableModel::select() {
 
     qDebug() << this << "select() returned" << m_rowInfo.size()
              << "results in" << time.elapsed().debugMillisWithUnit();
+
+    if (previewSelect) {
+        QTimer::singleShot(0, this, [this] {
+            select();
+        });
+    }
 }
 
 void BaseSqlTableModel::setTable(QString tableName,
@@ -897,8 +1002,7 @@ void BaseSqlTableModel::removeTrackRows(const QSet<TrackId>& trackIdsToRemove) {
         trackIdToRows[rowInfo.trackId].push_back(i);
     }
 
-    clearRows();
-    replaceRows(
+    applyRowChanges(
             std::move(rowInfos),
             std::move(trackIdToRows),
             std::move(trackPosToRows));
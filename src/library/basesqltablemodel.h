@@ -71,6 +71,17 @@ class BaseSqlTableModel : public BaseTrackTableModel {
 
     void select() override;
 
+    // Limit the next select() to the given number of rows and schedule the
+    // unlimited select right behind it on the event loop. The limited
+    // result set paints immediately and is replaced seamlessly by
+    // applyRowChanges()'s in-place diff, which makes the default view
+    // usable while the full query and track source index are still being
+    // built. Call before the first select(), e.g. right after constructing
+    // the model at startup.
+    void setFirstSelectPreviewRowCount(int rowCount) {
+        m_firstSelectPreviewRows = rowCount;
+    }
+
     ///////////////////////////////////////////////////////////////////////////
     // Inherited from BaseTrackTableModel
     ///////////////////////////////////////////////////////////////////////////
@@ -163,6 +174,14 @@ class BaseSqlTableModel : public BaseTrackTableModel {
             QVector<RowInfo>&& rows,
             TrackId2Rows&& trackIdToRows,
             TrackPos2Row&& trackPosToRows);
+    // Diffs the new rows against the current rows and patches the model
+    // in place where possible, so that requeries which only modify a few
+    // rows preserve the scroll position and selection of the views.
+    // Falls back to replacing all rows when the row sets are disjoint.
+    void applyRowChanges(
+            QVector<RowInfo>&& rows,
+            TrackId2Rows&& trackIdToRows,
+            TrackPos2Row&& trackPosToRows);
 
     QVector<RowInfo> m_rowInfo;
 
@@ -171,6 +190,7 @@ class BaseSqlTableModel : public BaseTrackTableModel {
     QStringList m_tableColumns;
     QList<SortColumn> m_sortColumns;
     bool m_bInitialized;
+    int m_firstSelectPreviewRows;
     QHash<TrackId, int> m_trackSortOrder;
     TrackId2Rows m_trackIdToRows;
     TrackPos2Row m_trackPosToRow;
@@ -1,5 +1,11 @@
 #include "library/basetrackcache.h"
 
+#include <QVarLengthArray>
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 #include "library/queryutil.h"
 #include "library/searchquery.h"
 #include "library/searchqueryparser.h"
@@ -9,11 +15,17 @@
 #include "track/keyutils.h"
 #include "track/track.h"
 #include "util/performancetimer.h"
+#include "util/stringinterner.h"
 
 namespace {
 
 constexpr bool sDebug = false;
 
+// Upper bound for the number of candidate ids that are inlined into the
+// narrowed search query in filterAndSort(). Beyond this the IN expression
+// itself becomes so large that a plain table scan is just as fast.
+constexpr int kMaxSearchNarrowingCandidates = 100000;
+
 }  // namespace
 
 BaseTrackCache::BaseTrackCache(TrackCollection* pTrackCollection,
@@ -29,7 +41,9 @@ BaseTrackCache::BaseTrackCache(TrackCollection* pTrackCollection,
           m_columnCache(std::move(columns)),
           m_pQueryParser(std::make_unique<SearchQueryParser>(
                   pTrackCollection, std::move(searchColumns))),
+          m_bPrevSearchResultsValid(false),
           m_bIndexBuilt(false),
+          m_bIndexComplete(false),
           m_bIsCaching(isCaching),
           m_database(pTrackCollection->database()) {
 }
@@ -67,6 +81,7 @@ void BaseTrackCache::slotTracksAddedOrChanged(const QSet<TrackId>& trackIds) {
     if (sDebug) {
         qDebug() << this << "slotTracksAddedOrChanged" << trackIds.size();
     }
+    m_bPrevSearchResultsValid = false;
     updateTracksInIndex(trackIds);
 }
 
@@ -74,6 +89,7 @@ void BaseTrackCache::slotScanTrackAdded(TrackPointer pTrack) {
     if (sDebug) {
         qDebug() << this << "slotScanTrackAdded";
     }
+    m_bPrevSearchResultsValid = false;
     updateTrackInIndex(pTrack);
 }
 
@@ -81,6 +97,7 @@ void BaseTrackCache::slotTracksRemoved(const QSet<TrackId>& trackIds) {
     if (sDebug) {
         qDebug() << this << "slotTracksRemoved" << trackIds.size();
     }
+    m_bPrevSearchResultsValid = false;
     for (const auto& trackId : std::as_const(trackIds)) {
         m_trackInfo.remove(trackId);
         m_dirtyTracks.remove(trackId);
@@ -99,6 +116,7 @@ void BaseTrackCache::slotTrackClean(TrackId trackId) {
         qDebug() << this << "slotTrackClean" << trackId;
     }
     m_dirtyTracks.remove(trackId);
+    m_bPrevSearchResultsValid = false;
     // The track might have been reloaded from the database
     updateTrackInIndex(trackId);
 }
@@ -209,6 +227,27 @@ bool BaseTrackCache::updateIndexWithQuery(const QString& queryString) {
     int numColumns = columnCount();
     int idColumn = query.record().indexOf(m_idColumn);
 
+    // Values of these columns repeat across many rows, so the cached rows
+    // share their storage through the string interning pool instead of
+    // keeping one copy per track.
+    QVarLengthArray<int, 9> internColumns;
+    for (ColumnCache::Column column : {
+                 ColumnCache::COLUMN_LIBRARYTABLE_ARTIST,
+                 ColumnCache::COLUMN_LIBRARYTABLE_ALBUM,
+                 ColumnCache::COLUMN_LIBRARYTABLE_ALBUMARTIST,
+                 ColumnCache::COLUMN_LIBRARYTABLE_YEAR,
+                 ColumnCache::COLUMN_LIBRARYTABLE_GENRE,
+                 ColumnCache::COLUMN_LIBRARYTABLE_COMPOSER,
+                 ColumnCache::COLUMN_LIBRARYTABLE_GROUPING,
+                 ColumnCache::COLUMN_LIBRARYTABLE_TRACKNUMBER,
+                 ColumnCache::COLUMN_LIBRARYTABLE_FILETYPE,
+         }) {
+        const int internFieldIndex = fieldIndex(column);
+        if (internFieldIndex >= 0) {
+            internColumns.append(internFieldIndex);
+        }
+    }
+
     while (query.next()) {
         TrackId trackId(query.value(idColumn));
 
@@ -223,6 +262,9 @@ bool BaseTrackCache::updateIndexWithQuery(const QString& queryString) {
                 // Here we want to cache the display string with native separators.
                 QString location = query.value(i).toString();
                 record[i] = QDir::toNativeSeparators(location);
+            } else if (internColumns.contains(i)) {
+                record[i] = QVariant(
+                        mixxx::StringInterner::intern(query.value(i).toString()));
             } else {
                 record[i] = query.value(i);
             }
@@ -238,6 +280,8 @@ void BaseTrackCache::buildIndex() {
         qDebug() << this << "buildIndex()";
     }
 
+    m_bPrevSearchResultsValid = false;
+
     QString queryString = QString("SELECT %1 FROM %2")
             .arg(m_columnsJoined, m_tableName);
 
@@ -258,6 +302,20 @@ void BaseTrackCache::buildIndex() {
     }
 
     m_bIndexBuilt = true;
+    m_bIndexComplete = true;
+}
+
+void BaseTrackCache::buildPartialIndex(const QSet<TrackId>& trackIds) {
+    if (m_bIndexComplete) {
+        return;
+    }
+    if (sDebug) {
+        qDebug() << this << "buildPartialIndex()" << trackIds.size();
+    }
+    updateTracksInIndex(trackIds);
+    // data() may now serve values for the given tracks. The full index is
+    // still built by the next filterAndSort() call.
+    m_bIndexBuilt = true;
 }
 
 void BaseTrackCache::updateTrackInIndex(TrackId trackId) {
@@ -458,7 +516,7 @@ void BaseTrackCache::filterAndSort(const QSet<TrackId>& trackIds,
         return;
     }
 
-    if (!m_bIndexBuilt) {
+    if (!m_bIndexComplete) {
         buildIndex();
     }
 
@@ -477,6 +535,26 @@ void BaseTrackCache::filterAndSort(const QSet<TrackId>& trackIds,
         }
     }
 
+    // When neither the search query nor the extra filter changed, the
+    // membership of the previous result set is still valid and a sort
+    // column change can be served by re-sorting the previous results in
+    // memory with precomputed collation keys. This avoids the SQL round
+    // trip that invokes the collator once per pairwise comparison inside
+    // SQLite on every re-sort of the full library view.
+    if (dirtyTracks.isEmpty() &&
+            m_bPrevSearchResultsValid &&
+            searchQuery == m_prevSearchQuery &&
+            extraFilter == m_prevExtraFilter &&
+            !m_trackOrder.isEmpty() &&
+            sortTracksInMemory(sortColumns, columnOffset)) {
+        trackToIndex->clear();
+        trackToIndex->reserve(m_trackOrder.size());
+        for (int i = 0; i < m_trackOrder.size(); ++i) {
+            (*trackToIndex)[m_trackOrder[i]] = i;
+        }
+        return;
+    }
+
     // Note: don't use the extraFilter for m_pQueryParser->parseQuery(), just
     // append it to searchQuery if not empty and let the parser construct
     // a SQL query from it.
@@ -492,7 +570,36 @@ void BaseTrackCache::filterAndSort(const QSet<TrackId>& trackIds,
     const std::unique_ptr<QueryNode> pQuery =
             m_pQueryParser->parseQuery(searchPlusExtraFilter, QString());
 
+    // If the new search query merely refines the previous one, the matching
+    // rows are a subset of the previous results that are still stored in
+    // m_trackOrder and the table scan can be restricted to those candidate
+    // rows. This keeps search-as-you-type responsive on large libraries,
+    // because each keystroke narrows down the previous result set instead
+    // of re-evaluating the LIKE expressions against the whole table.
+    QString candidateFilter;
+    if (m_bPrevSearchResultsValid &&
+            !m_trackOrder.isEmpty() &&
+            m_trackOrder.size() <= kMaxSearchNarrowingCandidates &&
+            extraFilter == m_prevExtraFilter &&
+            SearchQueryParser::queryIsRefinement(m_prevSearchQuery, searchQuery)) {
+        QStringList candidateIdStrings;
+        candidateIdStrings.reserve(m_trackOrder.size());
+        for (const TrackId& trackId : std::as_const(m_trackOrder)) {
+            candidateIdStrings << trackId.toString();
+        }
+        candidateFilter = QString("%1 IN (%2)")
+                                  .arg(m_idColumn, candidateIdStrings.join(","));
+    }
+
     QString filter = pQuery->toSql();
+    if (!candidateFilter.isEmpty()) {
+        if (filter.isEmpty()) {
+            filter = candidateFilter;
+        } else {
+            filter += QStringLiteral(" AND ");
+            filter += candidateFilter;
+        }
+    }
     if (!filter.isEmpty()) {
         filter.prepend("WHERE ");
     }
@@ -534,6 +641,13 @@ void BaseTrackCache::filterAndSort(const QSet<TrackId>& trackIds,
         m_trackOrder.append(trackId);
     }
 
+    // Remember the search query that produced m_trackOrder for narrowing
+    // down the next search. The dirty track corrections below modify
+    // m_trackOrder in place and keep it consistent with this query.
+    m_prevSearchQuery = searchQuery;
+    m_prevExtraFilter = extraFilter;
+    m_bPrevSearchResultsValid = true;
+
     // At this point, the original set of tracks have been divided into two
     // pieces: those that should be in the result set and those that should
     // not. Unfortunately, due to TrackDAO caching, there may be tracks in
@@ -611,6 +725,98 @@ void BaseTrackCache::filterAndSort(const QSet<TrackId>& trackIds,
     }
 }
 
+bool BaseTrackCache::sortTracksInMemory(
+        const QList<SortColumn>& sortColumns,
+        const int columnOffset) {
+    if (sortColumns.isEmpty()) {
+        return false;
+    }
+
+    PerformanceTimer timer;
+    timer.start();
+
+    // Precompute one comparison key per row and sort column instead of
+    // collating the strings again for every pairwise comparison. The
+    // binary collation keys compare byte-wise, so after O(n) key
+    // computations the O(n log n) comparisons of the sort become cheap.
+    struct ColumnKeys {
+        bool descending;
+        bool numeric;
+        QVector<double> numericKeys;
+        std::vector<QCollatorSortKey> stringKeys;
+    };
+    const int numRows = m_trackOrder.size();
+    std::vector<ColumnKeys> keysByColumn;
+    keysByColumn.reserve(sortColumns.size());
+    for (const auto& sc : std::as_const(sortColumns)) {
+        const int column = sc.m_column - columnOffset;
+        if (column < 0 || column >= columnCount()) {
+            // Not a track source column (e.g. a random or playlist
+            // position sort), needs the SQL code path.
+            return false;
+        }
+        const bool isKeyColumn =
+                column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_KEY);
+        ColumnKeys keys;
+        keys.descending = sc.m_order == Qt::DescendingOrder;
+        keys.numeric = isKeyColumn || isNumericColumn(column);
+        if (keys.numeric) {
+            keys.numericKeys.reserve(numRows);
+        } else {
+            keys.stringKeys.reserve(numRows);
+        }
+        for (const TrackId& trackId : std::as_const(m_trackOrder)) {
+            const QVariant value = data(trackId, column);
+            if (isKeyColumn) {
+                keys.numericKeys.append(KeyUtils::keyToCircleOfFifthsOrder(
+                        KeyUtils::guessKeyFromText(value.toString()),
+                        m_columnCache.keyNotation()));
+            } else if (keys.numeric) {
+                keys.numericKeys.append(value.toDouble());
+            } else {
+                keys.stringKeys.push_back(m_collator.sortKey(value.toString()));
+            }
+        }
+        keysByColumn.push_back(std::move(keys));
+    }
+
+    QVector<int> rowOrder(numRows);
+    std::iota(rowOrder.begin(), rowOrder.end(), 0);
+    std::stable_sort(rowOrder.begin(),
+            rowOrder.end(),
+            [&keysByColumn](int lhs, int rhs) {
+                for (const auto& keys : keysByColumn) {
+                    int result;
+                    if (keys.numeric) {
+                        const double delta =
+                                keys.numericKeys[lhs] - keys.numericKeys[rhs];
+                        result = delta < 0 ? -1 : (delta > 0 ? 1 : 0);
+                    } else {
+                        result = keys.stringKeys[lhs].compare(
+                                keys.stringKeys[rhs]);
+                    }
+                    if (keys.descending) {
+                        result = -result;
+                    }
+                    if (result != 0) {
+                        return result < 0;
+                    }
+                }
+                return false;
+            });
+
+    QVector<TrackId> sortedOrder;
+    sortedOrder.reserve(numRows);
+    for (int row : std::as_const(rowOrder)) {
+        sortedOrder.append(m_trackOrder[row]);
+    }
+    m_trackOrder = std::move(sortedOrder);
+
+    qDebug() << this << "sortTracksInMemory sorted" << numRows
+             << "rows in" << timer.elapsed().debugMillisWithUnit();
+    return true;
+}
+
 int BaseTrackCache::findSortInsertionPoint(TrackPointer pTrack,
         const QList<SortColumn>& sortColumns,
         const int columnOffset,
@@ -674,24 +880,27 @@ int BaseTrackCache::findSortInsertionPoint(TrackPointer pTrack,
     return min;
 }
 
+bool BaseTrackCache::isNumericColumn(int column) const {
+    return column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_YEAR) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_TRACKNUMBER) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_DURATION) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_BITRATE) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_BPM) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_REPLAYGAIN) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_SAMPLERATE) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_CHANNELS) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_TIMESPLAYED) ||
+            column == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_RATING) ||
+            column == fieldIndex(ColumnCache::COLUMN_PLAYLISTTRACKSTABLE_POSITION);
+}
+
 int BaseTrackCache::compareColumnValues(int sortColumn,
         Qt::SortOrder sortOrder,
         const QVariant& val1,
         const QVariant& val2) const {
     int result = 0;
 
-    if (sortColumn == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_YEAR) ||
-            sortColumn == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_TRACKNUMBER) ||
-            sortColumn == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_DURATION) ||
-            sortColumn == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_BITRATE) ||
-            sortColumn == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_BPM) ||
-            sortColumn == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_REPLAYGAIN) ||
-            sortColumn == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_SAMPLERATE) ||
-            sortColumn == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_CHANNELS) ||
-            sortColumn == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_TIMESPLAYED) ||
-            sortColumn == fieldIndex(ColumnCache::COLUMN_LIBRARYTABLE_RATING) ||
-            sortColumn == fieldIndex(ColumnCache::COLUMN_PLAYLISTTRACKSTABLE_POSITION)
-    ) {
+    if (isNumericColumn(sortColumn)) {
         // Sort as floats.
         double delta = val1.toDouble() - val2.toDouble();
 
@@ -54,6 +54,12 @@ class BaseTrackCache : public QObject {
     // expensive on large tables.
     virtual void buildIndex();
 
+    // Populate the index with only the given tracks so that their values
+    // can be served by data() before the full index has been built. Used
+    // by the preview pass of the first library select at startup; the
+    // full index is still built by the first filterAndSort() call.
+    void buildPartialIndex(const QSet<TrackId>& trackIds);
+
     ////////////////////////////////////////////////////////////////////////////
     // Data access methods
     ////////////////////////////////////////////////////////////////////////////
@@ -106,6 +112,13 @@ class BaseTrackCache : public QObject {
             Qt::SortOrder sortOrder,
             const QVariant& val1,
             const QVariant& val2) const;
+    bool isNumericColumn(int column) const;
+
+    // Re-sort m_trackOrder in memory with precomputed collation keys.
+    // Returns false if any of the sort columns is not a track source
+    // column, in which case the caller must fall back to sorting in SQL.
+    bool sortTracksInMemory(const QList<SortColumn>& sortColumns,
+            const int columnOffset);
 
     const QString m_tableName;
     const QString m_idColumn;
@@ -122,6 +135,17 @@ class BaseTrackCache : public QObject {
 
     QVector<TrackId> m_trackOrder;
 
+    // Search state of the previous filterAndSort() call. When the next
+    // search query merely refines the previous one, the matching rows are
+    // a subset of the previous results in m_trackOrder and the table scan
+    // can be restricted to those candidates. This makes search-as-you-type
+    // narrow down the previous result set instead of re-scanning the whole
+    // table with LIKE expressions on every keystroke. The state is
+    // invalidated whenever the underlying table may have changed.
+    QString m_prevSearchQuery;
+    QString m_prevExtraFilter;
+    bool m_bPrevSearchResultsValid;
+
     // Remember key and value of the most recent cache lookup to avoid querying
     // the global track cache again and again while populating the columns
     // of a single row. These members serve as a single-valued private cache.
@@ -135,6 +159,10 @@ class BaseTrackCache : public QObject {
     mutable QSet<TrackId> m_dirtyTracks;
 
     bool m_bIndexBuilt;
+    // m_bIndexBuilt only indicates that data() may serve values; after a
+    // buildPartialIndex() call the index covers just a subset of the table
+    // and m_bIndexComplete stays false until buildIndex() has run.
+    bool m_bIndexComplete;
     bool m_bIsCaching;
     QHash<TrackId, QVector<QVariant>> m_trackInfo;
     QSqlDatabase m_database;
@@ -47,6 +47,10 @@ constexpr double kRelativeHeightOfCoverartToolTip =
 
 constexpr int kReplayGainPrecision = 2;
 
+// Number of materialized display rows kept in the row cache, i.e. a few
+// screens worth of rows while scrolling through the table.
+constexpr int kRowCacheCapacity = 512;
+
 inline QSqlDatabase cloneDatabase(
         const QSqlDatabase& prototype) {
     const auto connectionName =
@@ -125,7 +129,35 @@ BaseTrackTableModel::BaseTrackTableModel(
           m_previewDeckGroup(PlayerManager::groupForPreviewDeck(0)),
           m_backgroundColorOpacity(WLibrary::kDefaultTrackTableBackgroundColorOpacity),
           m_trackPlayedColor(QColor(WTrackTableView::kDefaultTrackPlayedColor)),
-          m_trackMissingColor(QColor(WTrackTableView::kDefaultTrackMissingColor)) {
+          m_trackMissingColor(QColor(WTrackTableView::kDefaultTrackMissingColor)),
+          m_rowCache(kRowCacheCapacity) {
+    // All modifications of the underlying table data are announced through
+    // the model's own change signals. Listening to those signals keeps the
+    // row cache consistent without wiring up every data source separately.
+    connect(this,
+            &BaseTrackTableModel::modelReset,
+            this,
+            &BaseTrackTableModel::slotClearRowCache);
+    connect(this,
+            &BaseTrackTableModel::layoutChanged,
+            this,
+            &BaseTrackTableModel::slotClearRowCache);
+    connect(this,
+            &BaseTrackTableModel::rowsInserted,
+            this,
+            &BaseTrackTableModel::slotClearRowCache);
+    connect(this,
+            &BaseTrackTableModel::rowsRemoved,
+            this,
+            &BaseTrackTableModel::slotClearRowCache);
+    connect(this,
+            &BaseTrackTableModel::rowsMoved,
+            this,
+            &BaseTrackTableModel::slotClearRowCache);
+    connect(this,
+            &BaseTrackTableModel::dataChanged,
+            this,
+            &BaseTrackTableModel::slotInvalidateRowCache);
     connect(&pTrackCollectionManager->internalCollection()->getTrackDAO(),
             &TrackDAO::tracksRemoved,
             this,
@@ -484,9 +516,56 @@ QVariant BaseTrackTableModel::data(
         return QVariant();
     }
 
+    if (role == Qt::DisplayRole) {
+        // The view requests the display value of every visible cell on each
+        // repaint. Materialize the whole row once and serve the remaining
+        // cells from the cache without repeated QVariant conversions.
+        const QVector<QVariant>* pCachedRow = m_rowCache.object(index.row());
+        if (pCachedRow) {
+            VERIFY_OR_DEBUG_ASSERT(index.column() < pCachedRow->size()) {
+                return roleValue(index, rawValue(index), role);
+            }
+            return pCachedRow->at(index.column());
+        }
+        const int numColumns = columnCount();
+        auto* pNewRow = new QVector<QVariant>();
+        pNewRow->reserve(numColumns);
+        for (int column = 0; column < numColumns; ++column) {
+            const QModelIndex cellIndex = index.siblingAtColumn(column);
+            pNewRow->append(roleValue(cellIndex, rawValue(cellIndex), Qt::DisplayRole));
+        }
+        // Read the requested cell before handing the row over to the cache,
+        // because QCache deletes the row immediately if the insertion fails.
+        DEBUG_ASSERT(index.column() < pNewRow->size());
+        const QVariant cellValue = pNewRow->at(index.column());
+        m_rowCache.insert(index.row(), pNewRow);
+        return cellValue;
+    }
+
     return roleValue(index, rawValue(index), role);
 }
 
+void BaseTrackTableModel::slotClearRowCache() {
+    m_rowCache.clear();
+}
+
+void BaseTrackTableModel::slotInvalidateRowCache(
+        const QModelIndex& topLeft,
+        const QModelIndex& bottomRight,
+        const QList<int>& roles) {
+    Q_UNUSED(roles);
+    // Drop the affected rows independent of the reported roles. Rebuilding
+    // a row is cheap and this keeps derived display values consistent with
+    // whatever raw column has changed.
+    if (!topLeft.isValid() || !bottomRight.isValid()) {
+        m_rowCache.clear();
+        return;
+    }
+    for (int row = topLeft.row(); row <= bottomRight.row(); ++row) {
+        m_rowCache.remove(row);
+    }
+}
+
 QVariant BaseTrackTableModel::rawSiblingValue(
         const QModelIndex& index,
         ColumnCache::Column siblingField) const {
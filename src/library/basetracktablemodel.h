@@ -1,6 +1,7 @@
 #pragma once
 
 #include <QAbstractTableModel>
+#include <QCache>
 #include <QList>
 #include <QPointer>
 #include <optional>
@@ -264,6 +265,13 @@ class BaseTrackTableModel : public QAbstractTableModel, public TrackModel {
             const CoverInfo& coverInfo,
             const QPixmap& pixmap);
 
+    void slotClearRowCache();
+
+    void slotInvalidateRowCache(
+            const QModelIndex& topLeft,
+            const QModelIndex& bottomRight,
+            const QList<int>& roles);
+
   private:
     QVariant rawSiblingValue(
             const QModelIndex& index,
@@ -300,6 +308,16 @@ class BaseTrackTableModel : public QAbstractTableModel, public TrackModel {
 
     TrackId m_previewDeckTrackId;
 
+    // Fixed-capacity cache of completely materialized display rows, keyed
+    // by row number. Scrolling and sorting request all visible cells row by
+    // row, so each row is composed once and the remaining cells are served
+    // as plain values without repeated QVariant conversions. The cache is
+    // invalidated through the model's own change signals, which all track
+    // and layout modifications (including the TrackDAO change slots above)
+    // funnel through. Mutable because it is filled lazily from the const
+    // data() accessor.
+    mutable QCache<int, QVector<QVariant>> m_rowCache;
+
     mutable QModelIndex m_toolTipIndex;
 
     static int s_bpmColumnPrecision;
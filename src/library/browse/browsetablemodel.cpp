@@ -220,14 +220,7 @@ TrackPointer BrowseTableModel::getTrack(const QModelIndex& index) const {
 }
 
 TrackPointer BrowseTableModel::getTrackByRef(const TrackRef& trackRef) const {
-    if (m_pRecordingManager &&
-            m_pRecordingManager->getRecordingLocation() ==
-                    trackRef.getLocation()) {
-        QMessageBox::critical(nullptr,
-                tr("Mixxx Library"),
-                tr("Could not load the following file because it is in use by "
-                   "Mixxx or another application.") +
-                        "\n" + trackRef.getLocation());
+    if (isRecordingInProgress(trackRef)) {
         return TrackPointer();
     }
     // NOTE(uklotzde, 2015-12-08): Accessing tracks from the browse view
@@ -241,6 +234,33 @@ TrackPointer BrowseTableModel::getTrackByRef(const TrackRef& trackRef) const {
     return m_pTrackCollectionManager->getOrAddTrack(trackRef);
 }
 
+TrackPointer BrowseTableModel::getTrackForPreview(const QModelIndex& index) const {
+    const auto trackRef = TrackRef::fromFilePath(getTrackLocation(index));
+    if (isRecordingInProgress(trackRef)) {
+        return TrackPointer();
+    }
+    // Unlike getTrack(), auditioning a file in the preview deck does not
+    // implicitly add it to the library. The track object is resolved
+    // through the GlobalTrackCache without a database row and is promoted
+    // to a library row as soon as it is accessed through getTrack(),
+    // e.g. when it is loaded into a regular deck or edited.
+    return m_pTrackCollectionManager->getOrCreatePreviewTrack(trackRef);
+}
+
+bool BrowseTableModel::isRecordingInProgress(const TrackRef& trackRef) const {
+    if (m_pRecordingManager &&
+            m_pRecordingManager->getRecordingLocation() ==
+                    trackRef.getLocation()) {
+        QMessageBox::critical(nullptr,
+                tr("Mixxx Library"),
+                tr("Could not load the following file because it is in use by "
+                   "Mixxx or another application.") +
+                        "\n" + trackRef.getLocation());
+        return true;
+    }
+    return false;
+}
+
 QString BrowseTableModel::getTrackLocation(const QModelIndex& index) const {
     int row = index.row();
 
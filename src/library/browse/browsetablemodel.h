@@ -66,6 +66,7 @@ class BrowseTableModel final : public QStandardItemModel, public virtual TrackMo
 
     TrackPointer getTrack(const QModelIndex& index) const override;
     TrackPointer getTrackByRef(const TrackRef& trackRef) const override;
+    TrackPointer getTrackForPreview(const QModelIndex& index) const override;
     TrackModel::Capabilities getCapabilities() const override;
 
     QString getTrackLocation(const QModelIndex& index) const override;
@@ -112,6 +113,10 @@ class BrowseTableModel final : public QStandardItemModel, public virtual TrackMo
     void trackChanged(const QString& group, TrackPointer pNewTrack, TrackPointer pOldTrack);
 
   private:
+    // Returns true and warns the user if the given file is currently
+    // being written by the recording manager and must not be loaded.
+    bool isRecordingInProgress(const TrackRef& trackRef) const;
+
     TrackCollectionManager* const m_pTrackCollectionManager;
 
     QList<int> m_searchColumns;
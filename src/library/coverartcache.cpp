@@ -1,7 +1,10 @@
 #include "library/coverartcache.h"
 
+#include <QDir>
+#include <QFile>
 #include <QFutureWatcher>
 #include <QPixmapCache>
+#include <QStandardPaths>
 #include <QtConcurrentRun>
 #include <QtDebug>
 
@@ -27,6 +30,76 @@ inline QImage resizeImageWidth(const QImage& image, int width) {
     return image.scaledToWidth(width, kTransformationMode);
 }
 
+// Widths of the pre-scaled thumbnails kept in the disk-backed cache.
+// These are the mip levels that cover the sizes the UI actually requests:
+// the library table requests covers at the row height (typically well
+// below 128px, up to 256px on high-DPI screens with large rows). Requests
+// are served from the smallest level that is at least as wide as the
+// requested width, so the expensive full-size decode only ever happens
+// once per cover.
+constexpr int kThumbnailMipWidths[] = {64, 128, 256};
+
+// Redirected by setThumbnailCacheDirForTests() to keep tests from
+// polluting the user's cache directory.
+QString s_thumbnailCacheDirOverride;
+
+QString thumbnailCacheDir() {
+    if (!s_thumbnailCacheDirOverride.isEmpty()) {
+        return s_thumbnailCacheDirOverride;
+    }
+    return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) +
+            QStringLiteral("/cover-thumbnails");
+}
+
+QString thumbnailFilePath(mixxx::cache_key_t cacheKey, int mipWidth) {
+    return thumbnailCacheDir() +
+            QStringLiteral("/%1_%2.png")
+                    .arg(QString::number(cacheKey, 16), QString::number(mipWidth));
+}
+
+// Returns the smallest mip width that is sufficient for the desired
+// width or 0 if the request is larger than the largest mip level.
+int thumbnailMipWidth(int desiredWidth) {
+    for (int mipWidth : kThumbnailMipWidths) {
+        if (mipWidth >= desiredWidth) {
+            return mipWidth;
+        }
+    }
+    return 0;
+}
+
+QImage loadCachedThumbnail(mixxx::cache_key_t cacheKey, int mipWidth) {
+    QImage thumbnail;
+    // A corrupt or torn file simply fails to load and we fall back
+    // to decoding the full-size image.
+    thumbnail.load(thumbnailFilePath(cacheKey, mipWidth));
+    return thumbnail;
+}
+
+void saveCachedThumbnail(
+        const QImage& thumbnail, mixxx::cache_key_t cacheKey, int mipWidth) {
+    const QString filePath = thumbnailFilePath(cacheKey, mipWidth);
+    if (!QDir().mkpath(thumbnailCacheDir())) {
+        kLogger.warning()
+                << "Failed to create thumbnail cache directory"
+                << thumbnailCacheDir();
+        return;
+    }
+    // Write to a temporary file first and rename it into place to avoid
+    // publishing partially written thumbnails to concurrent readers.
+    const QString tmpFilePath = filePath + QStringLiteral(".tmp");
+    if (!thumbnail.save(tmpFilePath, "PNG")) {
+        kLogger.warning()
+                << "Failed to save cover thumbnail"
+                << tmpFilePath;
+        return;
+    }
+    if (!QFile::rename(tmpFilePath, filePath)) {
+        // Another thread has won the race and stored the same thumbnail
+        QFile::remove(tmpFilePath);
+    }
+}
+
 } // anonymous namespace
 
 CoverArtCache::CoverArtCache() {
@@ -200,6 +273,38 @@ CoverArtCache::FutureResult CoverArtCache::loadCover(
     auto res = FutureResult(
             coverInfo.cacheKey());
 
+    // Serve downscaled requests from the disk-backed thumbnail cache if
+    // possible, i.e. without decoding the full-size image. Covers that
+    // are only identified by their legacy hash are excluded, because
+    // their cache key changes once the image digest has been calculated.
+    const int mipWidth = desiredWidth > 0 && !coverInfo.imageDigest().isEmpty()
+            ? thumbnailMipWidth(desiredWidth)
+            : 0;
+    if (mipWidth > 0) {
+        QImage thumbnail = loadCachedThumbnail(res.requestedCacheKey, mipWidth);
+        if (!thumbnail.isNull()) {
+            if (kLogger.traceEnabled()) {
+                kLogger.trace()
+                        << "loadCover thumbnail cache hit"
+                        << coverInfo
+                        << desiredWidth;
+            }
+            if (thumbnail.width() != desiredWidth) {
+                thumbnail = resizeImageWidth(thumbnail, desiredWidth);
+            }
+            CoverInfo::LoadedImage thumbnailImage(
+                    CoverInfo::LoadedImage::Result::Ok);
+            thumbnailImage.image = std::move(thumbnail);
+            thumbnailImage.location =
+                    thumbnailFilePath(res.requestedCacheKey, mipWidth);
+            res.coverArt = CoverArt(
+                    std::move(coverInfo),
+                    std::move(thumbnailImage),
+                    desiredWidth);
+            return res;
+        }
+    }
+
     CoverInfo::LoadedImage loadedImage = coverInfo.loadImage(pTrack);
     if (!loadedImage.image.isNull()) {
         if (coverInfo.imageDigest().isEmpty()) {
@@ -218,9 +323,23 @@ CoverArtCache::FutureResult CoverArtCache::loadCover(
 
         // Resize image to requested size
         if (desiredWidth > 0) {
-            // Adjust the cover size according to the request
-            // or downsize the image for efficiency.
-            loadedImage.image = resizeImageWidth(loadedImage.image, desiredWidth);
+            if (mipWidth > 0) {
+                // Store the pre-scaled mip level for this request in the
+                // disk-backed thumbnail cache. The requested size is then
+                // derived from the mip level instead of the original image
+                // to get pixel-identical results on subsequent cache hits.
+                QImage mipImage = loadedImage.image.width() > mipWidth
+                        ? resizeImageWidth(loadedImage.image, mipWidth)
+                        : loadedImage.image;
+                saveCachedThumbnail(mipImage, res.requestedCacheKey, mipWidth);
+                loadedImage.image = mipImage.width() != desiredWidth
+                        ? resizeImageWidth(mipImage, desiredWidth)
+                        : mipImage;
+            } else {
+                // Adjust the cover size according to the request
+                // or downsize the image for efficiency.
+                loadedImage.image = resizeImageWidth(loadedImage.image, desiredWidth);
+            }
         }
     } else {
         kLogger.warning() << "loaded image is NULL";
@@ -246,6 +365,57 @@ CoverArtCache::FutureResult CoverArtCache::loadCover(
     return res;
 }
 
+// static
+void CoverArtCache::prefetchThumbnails(
+        const CoverInfo& coverInfo,
+        const QImage& loadedImage) {
+    if (!coverInfo.hasImage() || coverInfo.imageDigest().isEmpty()) {
+        return;
+    }
+    const mixxx::cache_key_t cacheKey = coverInfo.cacheKey();
+    bool missingThumbnails = false;
+    for (int mipWidth : kThumbnailMipWidths) {
+        if (!QFile::exists(thumbnailFilePath(cacheKey, mipWidth))) {
+            missingThumbnails = true;
+            break;
+        }
+    }
+    if (!missingThumbnails) {
+        return;
+    }
+    QImage image = loadedImage;
+    if (image.isNull()) {
+        image = coverInfo.loadImage().image;
+        if (image.isNull()) {
+            return;
+        }
+    }
+    if (kLogger.traceEnabled()) {
+        kLogger.trace()
+                << "prefetchThumbnails"
+                << coverInfo;
+    }
+    for (int mipWidth : kThumbnailMipWidths) {
+        if (QFile::exists(thumbnailFilePath(cacheKey, mipWidth))) {
+            continue;
+        }
+        // Images that are smaller than the mip level are stored as-is
+        // instead of upscaled, i.e. requests scale them up on demand
+        // just like they would from the original image.
+        saveCachedThumbnail(
+                image.width() > mipWidth
+                        ? resizeImageWidth(image, mipWidth)
+                        : image,
+                cacheKey,
+                mipWidth);
+    }
+}
+
+// static
+void CoverArtCache::setThumbnailCacheDirForTests(const QString& dirPath) {
+    s_thumbnailCacheDirOverride = dirPath;
+}
+
 // watcher
 void CoverArtCache::coverLoaded() {
     FutureResult res;
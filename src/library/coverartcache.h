@@ -56,6 +56,20 @@ class CoverArtCache : public QObject, public Singleton<CoverArtCache> {
             CoverInfo coverInfo,
             int desiredWidth);
 
+    // Pre-scale and store thumbnails of the given cover in the disk-backed
+    // thumbnail cache, so that subsequent requests are served without
+    // decoding the full-size image. If loadedImage is non-null it is used
+    // directly, otherwise the image is loaded from the path indicated in
+    // coverInfo. Covers without an image digest are skipped, because their
+    // cache key is not stable. WARNING: This is run in a worker thread.
+    static void prefetchThumbnails(
+            const CoverInfo& coverInfo,
+            const QImage& loadedImage = QImage());
+
+    // Only for testing: Redirect the disk-backed thumbnail cache into the
+    // given directory. Pass an empty string to restore the default location.
+    static void setThumbnailCacheDirForTests(const QString& dirPath);
+
   private slots:
     // Called when loadCover is complete in the main thread.
     void coverLoaded();
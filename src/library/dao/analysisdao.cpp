@@ -10,6 +10,8 @@
 #include "waveform/waveform.h"
 
 const QString AnalysisDao::s_analysisTableName = "track_analysis";
+const QString AnalysisDao::s_overviewStripTableName = "track_overview_strip";
+const QString AnalysisDao::s_loudnessEnvelopeTableName = "track_loudness_envelope";
 
 // For a track that takes 1.2MB to store the big waveform, the default
 // compression level (-1) takes the size down to about 600KB. The difference
@@ -17,6 +19,10 @@ const QString AnalysisDao::s_analysisTableName = "track_analysis";
 // CPU time so I think we should stick with the default. rryan 4/3/2012
 constexpr int kCompressionLevel = -1;
 
+// Suffix of the memory-mappable flat binary waveform files stored
+// beside the serialized blobs, see Waveform::saveToFlatFile().
+const QString kFlatWaveformFileSuffix = QStringLiteral(".wfm");
+
 AnalysisDao::AnalysisDao(UserSettingsPointer pConfig)
         : m_pConfig(pConfig) {
     QDir storagePath = getAnalysisStoragePath();
@@ -84,6 +90,14 @@ QList<AnalysisDao::AnalysisInfo> AnalysisDao::loadAnalysesFromQuery(TrackId trac
         int checksum = query->value(dataChecksumColumn).toInt();
         QString dataPath = analysisPath.absoluteFilePath(
             QString::number(info.analysisId));
+        const QString flatDataPath = dataPath + kFlatWaveformFileSuffix;
+        if (Waveform::isValidFlatFile(flatDataPath)) {
+            // The waveform can be memory-mapped from the flat binary file,
+            // so don't load and decompress the serialized blob at all.
+            info.flatDataPath = flatDataPath;
+            analyses.append(info);
+            continue;
+        }
         const QByteArray compressedData = loadDataFromFile(dataPath);
 #if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
         const int file_checksum = qChecksum(
@@ -185,6 +199,105 @@ bool AnalysisDao::saveAnalysis(AnalysisDao::AnalysisInfo* info) {
     return true;
 }
 
+bool AnalysisDao::saveOverviewStrip(
+        TrackId trackId, int version, const QByteArray& strip) {
+    if (!m_database.isOpen() || !trackId.isValid() || strip.isEmpty()) {
+        return false;
+    }
+    QSqlQuery query(m_database);
+    query.prepare(QString(
+            "INSERT OR REPLACE INTO %1 (track_id, version, data) "
+            "VALUES (:trackId,:version,:data)")
+                          .arg(s_overviewStripTableName));
+    query.bindValue(":trackId", trackId.toVariant());
+    query.bindValue(":version", version);
+    query.bindValue(":data", strip);
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query) << "couldn't save overview strip for track" << trackId;
+        return false;
+    }
+    return true;
+}
+
+void AnalysisDao::loadAllOverviewStrips(
+        int version,
+        int stripNumBytes,
+        QByteArray* pPackedStrips,
+        QHash<TrackId, int>* pStripOffsetByTrackId) {
+    DEBUG_ASSERT(pPackedStrips);
+    DEBUG_ASSERT(pStripOffsetByTrackId);
+    if (!m_database.isOpen()) {
+        return;
+    }
+    PerformanceTimer time;
+    time.start();
+
+    QSqlQuery query(m_database);
+    query.prepare(QString(
+            "SELECT track_id, data FROM %1 WHERE version=:version")
+                          .arg(s_overviewStripTableName));
+    query.bindValue(":version", version);
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query) << "couldn't load overview strips";
+        return;
+    }
+
+    const int trackIdColumn = query.record().indexOf("track_id");
+    const int dataColumn = query.record().indexOf("data");
+    while (query.next()) {
+        const QByteArray strip = query.value(dataColumn).toByteArray();
+        if (strip.size() != stripNumBytes) {
+            continue;
+        }
+        const TrackId trackId(query.value(trackIdColumn));
+        pStripOffsetByTrackId->insert(trackId, pPackedStrips->size());
+        pPackedStrips->append(strip);
+    }
+    qDebug() << "AnalysisDAO fetched" << pStripOffsetByTrackId->size()
+             << "overview strips," << pPackedStrips->size() << "bytes in"
+             << time.elapsed().debugMillisWithUnit();
+}
+
+bool AnalysisDao::saveLoudnessEnvelope(
+        TrackId trackId, int version, const QByteArray& envelope) {
+    if (!m_database.isOpen() || !trackId.isValid() || envelope.isEmpty()) {
+        return false;
+    }
+    QSqlQuery query(m_database);
+    query.prepare(QString(
+            "INSERT OR REPLACE INTO %1 (track_id, version, data) "
+            "VALUES (:trackId,:version,:data)")
+                          .arg(s_loudnessEnvelopeTableName));
+    query.bindValue(":trackId", trackId.toVariant());
+    query.bindValue(":version", version);
+    query.bindValue(":data", envelope);
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query) << "couldn't save loudness envelope for track" << trackId;
+        return false;
+    }
+    return true;
+}
+
+QByteArray AnalysisDao::loadLoudnessEnvelope(TrackId trackId, int version) {
+    if (!m_database.isOpen() || !trackId.isValid()) {
+        return QByteArray();
+    }
+    QSqlQuery query(m_database);
+    query.prepare(QString(
+            "SELECT data FROM %1 WHERE track_id=:trackId AND version=:version")
+                          .arg(s_loudnessEnvelopeTableName));
+    query.bindValue(":trackId", trackId.toVariant());
+    query.bindValue(":version", version);
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query) << "couldn't load loudness envelope for track" << trackId;
+        return QByteArray();
+    }
+    if (!query.next()) {
+        return QByteArray();
+    }
+    return query.value(0).toByteArray();
+}
+
 bool AnalysisDao::deleteAnalysis(const int analysisId) {
     if (analysisId == -1) {
         return false;
@@ -202,6 +315,7 @@ bool AnalysisDao::deleteAnalysis(const int analysisId) {
     QString dataPath = getAnalysisStoragePath().absoluteFilePath(
         QString::number(analysisId));
     deleteFile(dataPath);
+    deleteFile(dataPath + kFlatWaveformFileSuffix);
     return true;
 }
 
@@ -222,12 +336,25 @@ void AnalysisDao::deleteAnalyses(const QList<TrackId>& trackIds) {
         int id = query.value(idColumn).toInt();
         QString dataPath = analysisPath.absoluteFilePath(QString::number(id));
         deleteFile(dataPath);
+        deleteFile(dataPath + kFlatWaveformFileSuffix);
     }
     query.prepare(QString("DELETE FROM track_analysis "
                           "WHERE track_id in (%1)").arg(idList.join(",")));
     if (!query.exec()) {
         LOG_FAILED_QUERY(query) << "couldn't delete analysis";
     }
+    query.prepare(QString("DELETE FROM %1 "
+                          "WHERE track_id in (%2)")
+                          .arg(s_overviewStripTableName, idList.join(",")));
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query) << "couldn't delete overview strips";
+    }
+    query.prepare(QString("DELETE FROM %1 "
+                          "WHERE track_id in (%2)")
+                          .arg(s_loudnessEnvelopeTableName, idList.join(",")));
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query) << "couldn't delete loudness envelopes";
+    }
 }
 
 bool AnalysisDao::deleteAnalysesForTrack(TrackId trackId) {
@@ -253,6 +380,20 @@ bool AnalysisDao::deleteAnalysesForTrack(TrackId trackId) {
     foreach (int analysisId, analysesToDelete) {
         deleteAnalysis(analysisId);
     }
+    query.prepare(QString(
+            "DELETE FROM %1 WHERE track_id = :track_id")
+                          .arg(s_overviewStripTableName));
+    query.bindValue(":track_id", trackId.toVariant());
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query) << "couldn't delete overview strip for track" << trackId;
+    }
+    query.prepare(QString(
+            "DELETE FROM %1 WHERE track_id = :track_id")
+                          .arg(s_loudnessEnvelopeTableName));
+    query.bindValue(":track_id", trackId.toVariant());
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query) << "couldn't delete loudness envelope for track" << trackId;
+    }
     return true;
 }
 
@@ -344,6 +485,10 @@ void AnalysisDao::saveTrackAnalyses(
     bool success = saveAnalysis(&analysis);
     if (success) {
         pWaveform->setSaveState(Waveform::SaveState::Saved);
+        // Also store the flat binary file that allows loading the
+        // waveform later by memory-mapping it without deserialization.
+        pWaveform->saveToFlatFile(getAnalysisStoragePath().absoluteFilePath(
+                QString::number(analysis.analysisId) + kFlatWaveformFileSuffix));
     }
 
     qDebug() << (success ? "Saved" : "Failed to save")
@@ -360,6 +505,8 @@ void AnalysisDao::saveTrackAnalyses(
     success = saveAnalysis(&analysis);
     if (success) {
         pWaveSummary->setSaveState(Waveform::SaveState::Saved);
+        pWaveSummary->saveToFlatFile(getAnalysisStoragePath().absoluteFilePath(
+                QString::number(analysis.analysisId) + kFlatWaveformFileSuffix));
     }
     qDebug() << (success ? "Saved" : "Failed to save")
              << "waveform summary analysis for trackId" << trackId
@@ -383,8 +530,10 @@ size_t AnalysisDao::getDiskUsageInBytes(
     const int idColumn = query.record().indexOf("id");
     size_t total = 0;
     while (query.next()) {
-        total += QFileInfo(analysisPath.absoluteFilePath(
-                query.value(idColumn).toString())).size();
+        const QString dataPath = analysisPath.absoluteFilePath(
+                query.value(idColumn).toString());
+        total += QFileInfo(dataPath).size();
+        total += QFileInfo(dataPath + kFlatWaveformFileSuffix).size();
     }
     return total;
 }
@@ -407,6 +556,7 @@ bool AnalysisDao::deleteAnalysesByType(
     while (query.next()) {
         QString dataPath = analysisPath.absoluteFilePath(query.value(idColumn).toString());
         deleteFile(dataPath);
+        deleteFile(dataPath + kFlatWaveformFileSuffix);
     }
     query.prepare(QString("DELETE FROM %1 WHERE type=:type").arg(s_analysisTableName));
     query.bindValue(":type", type);
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <QDir>
+#include <QHash>
 
 #include "preferences/usersettings.h"
 #include "library/dao/dao.h"
@@ -12,6 +13,8 @@ class QSqlDatabase;
 class AnalysisDao : public DAO {
   public:
     static const QString s_analysisTableName;
+    static const QString s_overviewStripTableName;
+    static const QString s_loudnessEnvelopeTableName;
 
     enum AnalysisType {
         TYPE_UNKNOWN = 0,
@@ -30,6 +33,10 @@ class AnalysisDao : public DAO {
         QString description;
         QString version;
         QByteArray data;
+        // Path of a valid flat binary waveform file for this analysis,
+        // empty if none exists. When set, data is left empty and the
+        // waveform should be memory-mapped from this file instead.
+        QString flatDataPath;
     };
 
     explicit AnalysisDao(UserSettingsPointer pConfig);
@@ -57,6 +64,28 @@ class AnalysisDao : public DAO {
             ConstWaveformPointer pWaveform,
             ConstWaveformPointer pWaveSummary);
 
+    /// Stores or replaces the compact overview strip of a track,
+    /// see waveform/overviewstrip.h.
+    bool saveOverviewStrip(TrackId trackId, int version, const QByteArray& strip);
+
+    /// Bulk-loads the overview strips of all tracks with the given
+    /// version in a single query. The fixed-size strips are appended
+    /// to the packed array and indexed by their byte offset; strips
+    /// whose size differs from stripNumBytes are skipped.
+    void loadAllOverviewStrips(
+            int version,
+            int stripNumBytes,
+            QByteArray* pPackedStrips,
+            QHash<TrackId, int>* pStripOffsetByTrackId);
+
+    /// Stores or replaces the loudness normalization envelope of a
+    /// track, see track/loudnessenvelope.h.
+    bool saveLoudnessEnvelope(TrackId trackId, int version, const QByteArray& envelope);
+
+    /// Loads the stored loudness envelope of a track. Returns an empty
+    /// array if no envelope with the given version is stored.
+    QByteArray loadLoudnessEnvelope(TrackId trackId, int version);
+
   private:
     QDir getAnalysisStoragePath() const;
     QByteArray loadDataFromFile(const QString& fileName) const;
@@ -38,6 +38,11 @@
 // The same table like above, but of all tracks that not already queued into Auto DJ
 // ordered by TimesPlayed.
 
+#define AUTODJACTIVETRACKS_INDEX "temp_autodj_activetracks_index"
+// A covering index on AUTODJCRATES_TABLE matching the filter and sort order of
+// the active-tracks view, so that the counts and random picks issued against
+// the view don't re-sort the whole table on every query.
+
 namespace {
 // Percentage of most and least played tracks to ignore [0,50)
 constexpr int kLeastPreferredPercent = 15;
@@ -322,6 +327,30 @@ bool AutoDJCratesDAO::createActiveTracksView (bool a_bUseIgnoreTime) {
         LOG_FAILED_QUERY(oQuery);
         return false;
     }
+
+    // Create a covering index matching the view.  The counts and the random
+    // OFFSET pick only ever ask the view for COUNT(*) or the track ID, so with
+    // this index SQLite can answer them with an index scan instead of sorting
+    // the whole auto-DJ-crates table on every query.  The index is recreated
+    // together with the view, since its column order depends on the
+    // ignore-time setting.
+    // DROP INDEX IF EXISTS temp_autodj_activetracks_index;
+    oQuery.prepare("DROP INDEX IF EXISTS " AUTODJACTIVETRACKS_INDEX);
+    if (!oQuery.exec()) {
+        LOG_FAILED_QUERY(oQuery);
+        return false;
+    }
+
+    // CREATE INDEX temp_autodj_activetracks_index ON temp_autodj_crates
+    //     (autodjrefs, timesplayed, lastplayed, track_id);
+    oQuery.prepare(QString("CREATE INDEX " AUTODJACTIVETRACKS_INDEX " ON "
+            AUTODJCRATES_TABLE " (" AUTODJCRATESTABLE_AUTODJREFS ", %1"
+            AUTODJCRATESTABLE_LASTPLAYED ", " AUTODJCRATESTABLE_TRACKID ")")
+            .arg(strTimesPlayed)); // %1
+    if (!oQuery.exec()) {
+        LOG_FAILED_QUERY(oQuery);
+        return false;
+    }
     return true;
 }
 
@@ -868,26 +868,35 @@ int PlaylistDAO::insertTracksIntoPlaylist(const QList<TrackId>& trackIds,
     insertQuery.prepare(QStringLiteral(
             "INSERT INTO PlaylistTracks (playlist_id, track_id, position)"
             "VALUES (:playlist_id, :track_id, :position)"));
-    QSqlQuery query(m_database);
-    int insertPositon = position;
+    int numValidTrackIds = 0;
     for (const auto& trackId : trackIds) {
-        if (!trackId.isValid()) {
-            continue;
+        if (trackId.isValid()) {
+            ++numValidTrackIds;
         }
-        // Move all tracks in playlist up by 1.
-        // TODO(XXX) We could do this in one query before the for loop.
+    }
+
+    // Move the tail of the playlist down in a single sweep instead of
+    // shifting it by one position for every inserted track.
+    if (numValidTrackIds > 0) {
+        QSqlQuery query(m_database);
         query.prepare(QStringLiteral(
-                "UPDATE PlaylistTracks SET position=position+1 "
+                "UPDATE PlaylistTracks SET position=position+:count "
                 "WHERE position>=:position AND "
                 "playlist_id=:id"));
+        query.bindValue(":count", numValidTrackIds);
         query.bindValue(":id", playlistId);
-        query.bindValue(":position", insertPositon);
+        query.bindValue(":position", position);
 
         if (!query.exec()) {
             LOG_FAILED_QUERY(query);
-            continue;
         }
+    }
 
+    int insertPositon = position;
+    for (const auto& trackId : trackIds) {
+        if (!trackId.isValid()) {
+            continue;
+        }
         // Insert the track at the given position
         insertQuery.bindValue(":playlist_id", playlistId);
         insertQuery.bindValue(":track_id", trackId.toVariant());
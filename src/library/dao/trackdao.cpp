@@ -4,6 +4,7 @@
 #include <QDir>
 #include <QFileInfo>
 #include <QThread>
+#include <QtConcurrentRun>
 #include <QtDebug>
 
 #ifdef __SQLITE3__
@@ -11,6 +12,7 @@
 #endif // __SQLITE3__
 
 #include "library/coverart.h"
+#include "library/coverartcache.h"
 #include "library/coverartutils.h"
 #include "library/dao/analysisdao.h"
 #include "library/dao/cuedao.h"
@@ -37,6 +39,7 @@
 #include "util/logger.h"
 #include "util/math.h"
 #include "util/qt.h"
+#include "util/stringinterner.h"
 #include "util/timer.h"
 
 namespace {
@@ -45,6 +48,10 @@ mixxx::Logger kLogger("TrackDAO");
 
 enum { UndefinedRecordIndex = -2 };
 
+// Number of newly added tracks that are committed together in a single
+// transaction during a library scan, see addTracksCommitBatch().
+constexpr int kAddTracksBatchSize = 512;
+
 void markTrackLocationsAsDeleted(const QSqlDatabase& database, const QString& directory) {
     // kLogger.debug()<< "markTrackLocationsAsDeleted" <<
     // QThread::currentThread() << m_database.connectionName();
@@ -544,9 +551,27 @@ void TrackDAO::addTracksPrepare() {
             "WHERE location=:location");
 }
 
+void TrackDAO::addTracksCommitBatch() {
+    DEBUG_ASSERT(m_pTransaction);
+    m_pTransaction->commit();
+    // Reopen a transaction for the next batch. The prepared statements
+    // are bound to the connection and not to the transaction, so they
+    // survive the commit.
+    m_pTransaction = std::make_unique<SqlTransaction>(m_database);
+    // Stream the added tracks of the committed batch to listeners
+    // instead of accumulating all of them until addTracksFinish().
+    if (!m_tracksAddedSet.isEmpty()) {
+        emit tracksAdded(m_tracksAddedSet);
+        m_tracksAddedSet.clear();
+    }
+}
+
 void TrackDAO::addTracksFinish(bool rollback) {
     if (m_pTransaction) {
         if (rollback) {
+            // This only discards the batch that has not been committed
+            // by addTracksCommitBatch(), yet. Tracks from previously
+            // committed batches remain in the database.
             m_pTransaction->rollback();
             m_tracksAddedSet.clear();
         } else {
@@ -865,6 +890,9 @@ TrackId TrackDAO::addTracksAddTrack(const TrackPointer& pTrack, bool unremove) {
 
         DEBUG_ASSERT(!m_tracksAddedSet.contains(trackId));
         m_tracksAddedSet.insert(trackId);
+        if (m_tracksAddedSet.size() >= kAddTracksBatchSize) {
+            addTracksCommitBatch();
+        }
     }
 
     return trackId;
@@ -1059,6 +1087,28 @@ QList<TrackRef> TrackDAO::getAllTrackRefs(const QDir& rootDir) const {
     return trackRefs;
 }
 
+QList<TrackId> TrackDAO::getAllTrackIds() const {
+    QSqlQuery query(m_database);
+    query.prepare(
+            QStringLiteral("SELECT library.id "
+                           "FROM library INNER JOIN track_locations "
+                           "ON library.location=track_locations.id "
+                           "WHERE library.mixxx_deleted=0 "
+                           "AND track_locations.fs_deleted=0"));
+    if (!query.exec()) {
+        LOG_FAILED_QUERY(query) << "could not get all library tracks";
+        DEBUG_ASSERT(!"Failed query");
+    }
+
+    QList<TrackId> trackIds;
+    const int idColumn = query.record().indexOf(LIBRARYTABLE_ID);
+    while (query.next()) {
+        trackIds.append(TrackId(query.value(idColumn)));
+    }
+
+    return trackIds;
+}
+
 bool TrackDAO::onPurgingTracks(
         const QList<TrackId>& trackIds) const {
     if (trackIds.empty()) {
@@ -1158,8 +1208,13 @@ typedef void (*TrackPopulatorFn)(
         const int column,
         Track* pTrack);
 
+// Many tracks share the same artist, album, genre, ... values. Interning
+// these fields during hydration lets all Track objects reference a single
+// allocation per distinct value instead of one copy per track. Unique
+// fields like the title or the comment are deliberately not interned,
+// pooling them would only add lookup overhead without any sharing.
 void setTrackArtist(const QSqlRecord& record, const int column, Track* pTrack) {
-    pTrack->setArtist(record.value(column).toString());
+    pTrack->setArtist(mixxx::StringInterner::intern(record.value(column).toString()));
 }
 
 void setTrackTitle(const QSqlRecord& record, const int column, Track* pTrack) {
@@ -1167,35 +1222,36 @@ void setTrackTitle(const QSqlRecord& record, const int column, Track* pTrack) {
 }
 
 void setTrackAlbum(const QSqlRecord& record, const int column, Track* pTrack) {
-    pTrack->setAlbum(record.value(column).toString());
+    pTrack->setAlbum(mixxx::StringInterner::intern(record.value(column).toString()));
 }
 
 void setTrackAlbumArtist(const QSqlRecord& record, const int column, Track* pTrack) {
-    pTrack->setAlbumArtist(record.value(column).toString());
+    pTrack->setAlbumArtist(mixxx::StringInterner::intern(record.value(column).toString()));
 }
 
 void setTrackYear(const QSqlRecord& record, const int column, Track* pTrack) {
-    pTrack->setYear(record.value(column).toString());
+    pTrack->setYear(mixxx::StringInterner::intern(record.value(column).toString()));
 }
 
 void setTrackGenre(const QSqlRecord& record, const int column, Track* pTrack) {
-    TrackDAO::setTrackGenreInternal(pTrack, record.value(column).toString());
+    TrackDAO::setTrackGenreInternal(pTrack,
+            mixxx::StringInterner::intern(record.value(column).toString()));
 }
 
 void setTrackComposer(const QSqlRecord& record, const int column, Track* pTrack) {
-    pTrack->setComposer(record.value(column).toString());
+    pTrack->setComposer(mixxx::StringInterner::intern(record.value(column).toString()));
 }
 
 void setTrackGrouping(const QSqlRecord& record, const int column, Track* pTrack) {
-    pTrack->setGrouping(record.value(column).toString());
+    pTrack->setGrouping(mixxx::StringInterner::intern(record.value(column).toString()));
 }
 
 void setTrackNumber(const QSqlRecord& record, const int column, Track* pTrack) {
-    pTrack->setTrackNumber(record.value(column).toString());
+    pTrack->setTrackNumber(mixxx::StringInterner::intern(record.value(column).toString()));
 }
 
 void setTrackTotal(const QSqlRecord& record, const int column, Track* pTrack) {
-    pTrack->setTrackTotal(record.value(column).toString());
+    pTrack->setTrackTotal(mixxx::StringInterner::intern(record.value(column).toString()));
 }
 
 void setTrackColor(const QSqlRecord& record, const int column, Track* pTrack) {
@@ -1256,7 +1312,7 @@ void setTrackDateAdded(const QSqlRecord& record, const int column, Track* pTrack
 }
 
 void setTrackFiletype(const QSqlRecord& record, const int column, Track* pTrack) {
-    pTrack->setType(record.value(column).toString());
+    pTrack->setType(mixxx::StringInterner::intern(record.value(column).toString()));
 }
 
 void setTrackHeaderParsed(const QSqlRecord& record, const int column, Track* pTrack) {
@@ -1593,27 +1649,53 @@ TrackPointer TrackDAO::getTrackById(TrackId trackId) const {
     }
     DEBUG_ASSERT(!pTrack->isDirty());
     const auto sourceSynchronizedAtBefore = pTrack->getSourceSynchronizedAt();
-    const auto result =
+    const auto syncParams =
+            SyncTrackMetadataParams::readFromUserSettings(*m_pConfig);
+    if (updateTrackFromSourceMode ==
+                    SoundSourceProxy::UpdateTrackFromSourceMode::Once &&
+            sourceSynchronizedAtBefore.isValid()) {
+        // The file tags of this track have already been imported into the
+        // database. In this mode parsing them again only merges extra
+        // metadata that might still be missing in the database, i.e. the
+        // outcome does not affect anything the caller needs immediately.
+        // Tracks are materialized from the database on the main thread,
+        // both while browsing and when loading a track into a deck, and
+        // opening the file to parse its tags is by far the most expensive
+        // part of it. Deferring the partial import to a worker thread
+        // makes the deck playable without waiting for the file access.
+        // The captured TrackPointer keeps the track object alive and
+        // Track is internally synchronized, so merging the imported
+        // metadata from another thread is safe. Any resulting change
+        // is relayed through the dirty/changed connections below once
+        // the merge has completed.
+        QtConcurrent::run([pTrack, syncParams] {
             SoundSourceProxy(pTrack).updateTrackFromSource(
-                    updateTrackFromSourceMode,
-                    SyncTrackMetadataParams::readFromUserSettings(*m_pConfig));
-    if (result == SoundSourceProxy::UpdateTrackFromSourceResult::MetadataImportedAndUpdated) {
-        // At least the source synchronization time stamp must have changed
-        DEBUG_ASSERT(pTrack->isDirty());
-        const auto sourceSynchronizedAtAfter = pTrack->getSourceSynchronizedAt();
-        DEBUG_ASSERT(sourceSynchronizedAtAfter.isValid());
-        if (sourceSynchronizedAtBefore.isValid()) {
-            // Only log subsequent re-imports but not the initial import of metadata
-            DEBUG_ASSERT(updateTrackFromSourceMode ==
-                    SoundSourceProxy::UpdateTrackFromSourceMode::Newer);
-            DEBUG_ASSERT(sourceSynchronizedAtBefore < sourceSynchronizedAtAfter);
-            kLogger.info()
-                    << "Re-imported and updated outdated track metadata in library ("
-                    << sourceSynchronizedAtBefore.toString(Qt::ISODateWithMs)
-                    << ") with tags from modified file ("
-                    << sourceSynchronizedAtAfter.toString(Qt::ISODateWithMs)
-                    << "):"
-                    << pTrack->getMetadata();
+                    SoundSourceProxy::UpdateTrackFromSourceMode::Once,
+                    syncParams);
+        });
+    } else {
+        const auto result =
+                SoundSourceProxy(pTrack).updateTrackFromSource(
+                        updateTrackFromSourceMode,
+                        syncParams);
+        if (result == SoundSourceProxy::UpdateTrackFromSourceResult::MetadataImportedAndUpdated) {
+            // At least the source synchronization time stamp must have changed
+            DEBUG_ASSERT(pTrack->isDirty());
+            const auto sourceSynchronizedAtAfter = pTrack->getSourceSynchronizedAt();
+            DEBUG_ASSERT(sourceSynchronizedAtAfter.isValid());
+            if (sourceSynchronizedAtBefore.isValid()) {
+                // Only log subsequent re-imports but not the initial import of metadata
+                DEBUG_ASSERT(updateTrackFromSourceMode ==
+                        SoundSourceProxy::UpdateTrackFromSourceMode::Newer);
+                DEBUG_ASSERT(sourceSynchronizedAtBefore < sourceSynchronizedAtAfter);
+                kLogger.info()
+                        << "Re-imported and updated outdated track metadata in library ("
+                        << sourceSynchronizedAtBefore.toString(Qt::ISODateWithMs)
+                        << ") with tags from modified file ("
+                        << sourceSynchronizedAtAfter.toString(Qt::ISODateWithMs)
+                        << "):"
+                        << pTrack->getMetadata();
+            }
         }
     }
 
@@ -2303,6 +2385,13 @@ void TrackDAO::detectCoverArtForTracksWithoutCover(volatile const bool* pCancel,
         } else {
             pTracksChanged->insert(track.trackId);
         }
+
+        // Populate the disk-backed thumbnail cache while we still have
+        // the embedded image decoded, so that the library table doesn't
+        // need to hit the image decoder when the track is first painted.
+        CoverArtCache::prefetchThumbnails(
+                CoverInfo(coverInfo, track.trackLocation),
+                embeddedCover);
     }
 }
 
@@ -2359,6 +2448,72 @@ TrackPointer TrackDAO::getOrAddTrack(
     return pAddedTrack;
 }
 
+TrackPointer TrackDAO::getOrCreatePreviewTrack(
+        const TrackRef& trackRef) {
+    DEBUG_ASSERT(!trackRef.hasId());
+    VERIFY_OR_DEBUG_ASSERT(trackRef.hasLocation()) {
+        return {};
+    }
+    TrackPointer pTrack = GlobalTrackCacheLocker().lookupTrackByRef(trackRef);
+    if (!pTrack) {
+        const TrackId trackId = getTrackIdByLocation(trackRef.getLocation());
+        if (trackId.isValid()) {
+            // The track is in the library, load it from there as usual.
+            pTrack = getTrackById(trackId);
+        }
+    }
+    if (pTrack) {
+        return pTrack;
+    }
+
+    const auto fileAccess = mixxx::FileAccess(mixxx::FileInfo(trackRef.getLocation()));
+    if (!SoundSourceProxy::isFileSupported(fileAccess.info())) {
+        kLogger.warning() << "getOrCreatePreviewTrack:"
+                          << "Unsupported file type"
+                          << fileAccess.info().location();
+        return {};
+    }
+    {
+        auto cacheResolver = GlobalTrackCacheResolver(fileAccess);
+        pTrack = cacheResolver.getTrack();
+        if (cacheResolver.getLookupResult() ==
+                GlobalTrackCacheLookupResult::ConflictCanonicalLocation) {
+            DEBUG_ASSERT(!pTrack);
+            kLogger.warning()
+                    << "getOrCreatePreviewTrack:"
+                    << "Failed to resolve track"
+                    << fileAccess.info().location()
+                    << "because another track referencing the same file is"
+                    << "already loaded.";
+            return {};
+        }
+        VERIFY_OR_DEBUG_ASSERT(pTrack) {
+            return {};
+        }
+        if (pTrack->getId().isValid()) {
+            // Unlike in addTracksAddFile() no id needs to be assigned to
+            // the cache entry, so the cache can be unlocked before the
+            // metadata is imported from the file.
+            return pTrack;
+        }
+    }
+    // Import the metadata for the newly created track from the file.
+    // The track is deliberately NOT added to the library; a later
+    // getOrAddTrack() for the same location finds this object in the
+    // GlobalTrackCache and promotes it to a library row.
+    SoundSourceProxy(pTrack).updateTrackFromSource(
+            SoundSourceProxy::UpdateTrackFromSourceMode::Once,
+            SyncTrackMetadataParams::readFromUserSettings(*m_pConfig));
+    if (!pTrack->checkSourceSynchronized()) {
+        kLogger.warning() << "getOrCreatePreviewTrack:"
+                          << "Failed to parse track metadata from file"
+                          << pTrack->getLocation();
+        // Continue with the bare track object, no matter if parsing
+        // the metadata from file succeeded or failed.
+    }
+    return pTrack;
+}
+
 mixxx::FileAccess TrackDAO::relocateCachedTrack(TrackId trackId) {
     QString trackLocation = getTrackLocation(trackId);
     if (trackLocation.isEmpty()) {
@@ -57,6 +57,10 @@ class TrackDAO : public QObject, public virtual DAO, public virtual GlobalTrackC
     QList<TrackRef> getAllTrackRefs(
             const QDir& rootDir) const;
 
+    // Returns the ids of all tracks in the library that are neither
+    // hidden nor missing from the file system.
+    QList<TrackId> getAllTrackIds() const;
+
     TrackPointer getTrackByRef(
             const TrackRef& trackRef) const;
 
@@ -155,6 +159,16 @@ class TrackDAO : public QObject, public virtual DAO, public virtual GlobalTrackC
             const TrackRef& trackRef,
             bool* pAlreadyInLibrary = nullptr);
 
+    // Loads a track from the database like getOrAddTrack(), but resolves
+    // tracks that are not in the library through the GlobalTrackCache
+    // without adding them, i.e. without any database writes. The returned
+    // track object is deduplicated with all other references to the same
+    // file and gets promoted to a library row by a later getOrAddTrack()
+    // for the same location. Intended for auditioning files from the
+    // browse view in the preview deck.
+    TrackPointer getOrCreatePreviewTrack(
+            const TrackRef& trackRef);
+
     void addTracksPrepare();
     TrackId addTracksAddTrack(
             const TrackPointer& pTrack,
@@ -163,6 +177,12 @@ class TrackDAO : public QObject, public virtual DAO, public virtual GlobalTrackC
             const QString& filePath,
             bool unremove);
     void addTracksFinish(bool rollback = false);
+    // Commits the currently open batch of added tracks, emits
+    // tracksAdded() for them and starts a new transaction for the
+    // next batch. Called periodically from addTracksAddTrack() so
+    // that a long library scan streams its progress instead of
+    // accumulating one huge transaction.
+    void addTracksCommitBatch();
 
     bool updateTrack(const Track& track) const;
 
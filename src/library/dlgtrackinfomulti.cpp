@@ -9,6 +9,7 @@
 #include "library/coverartcache.h"
 #include "library/coverartutils.h"
 #include "library/library_prefs.h"
+#include "library/trackoperationjournal.h"
 #include "moc_dlgtrackinfomulti.cpp"
 #include "preferences/colorpalettesettings.h"
 #include "sources/soundsourceproxy.h"
@@ -733,9 +734,16 @@ void DlgTrackInfoMulti::saveTracks() {
     // First, disconnect the track changed signal. Otherwise we signal ourselves
     // and repopulate all these fields.
     disconnectTracksChanged();
+    if (m_pTrackOperationJournal) {
+        m_pTrackOperationJournal->beginGesture(
+                tr("Editing properties of %n track(s)", "", m_pLoadedTracks.size()));
+    }
     // Update the cached tracks
     for (const auto& rec : std::as_const(m_trackRecords)) {
         auto pTrack = m_pLoadedTracks.value(rec.getId());
+        if (m_pTrackOperationJournal) {
+            m_pTrackOperationJournal->recordTrackState(pTrack);
+        }
         // If replaceRecord() returns true then both m_trackRecord and m_pBeatsClone
         // will be updated by the subsequent Track::changed() signal to keep them
         // synchronized with the track. Otherwise the track has not been modified and
@@ -743,6 +751,9 @@ void DlgTrackInfoMulti::saveTracks() {
         // See https://github.com/mixxxdj/mixxx/issues/12963
         pTrack->replaceRecord(rec);
     }
+    if (m_pTrackOperationJournal) {
+        m_pTrackOperationJournal->commitGesture();
+    }
 
     connectTracksChanged();
 
@@ -19,6 +19,10 @@ class WStarRating;
 class WCoverArtMenu;
 class WCoverArtLabel;
 
+namespace mixxx {
+class TrackOperationJournal;
+} // namespace mixxx
+
 /// A dialog box to display and edit properties of multiple tracks.
 /// Use TrackPointers to load a track into the dialog.
 /// Only invoked from WTrackTbelView's WTrackMenu.
@@ -31,6 +35,13 @@ class DlgTrackInfoMulti : public QDialog, public Ui::DlgTrackInfoMulti {
     void loadTracks(const QList<TrackPointer>& pTracks);
     void focusField(const QString& property);
 
+    /// Optionally set the journal for recording the state of the loaded
+    /// tracks before applying the edited properties, so that applying
+    /// the dialog can be undone as a single gesture.
+    void setTrackOperationJournal(mixxx::TrackOperationJournal* pJournal) {
+        m_pTrackOperationJournal = pJournal;
+    }
+
   protected:
     /// We need this to set the max width of the comment QComboBox which has
     /// issues with long lines / multi-line content. See init() for details.
@@ -105,6 +116,8 @@ class DlgTrackInfoMulti : public QDialog, public Ui::DlgTrackInfoMulti {
 
     const UserSettingsPointer m_pUserSettings;
 
+    mixxx::TrackOperationJournal* m_pTrackOperationJournal{nullptr};
+
     QHash<TrackId, TrackPointer> m_pLoadedTracks;
     QList<mixxx::TrackRecord> m_trackRecords;
 
@@ -0,0 +1,152 @@
+#include "library/export/stemgenerationworker.h"
+
+#include <QDir>
+#include <QFileInfo>
+#include <QProcess>
+
+#include "moc_stemgenerationworker.cpp"
+#include "track/steminfoimporter.h"
+#include "track/track.h"
+#include "util/logger.h"
+
+namespace {
+
+const mixxx::Logger kLogger("StemGenerationWorker");
+
+const ConfigKey kSeparatorCommandKey("[StemGeneration]", "SeparatorCommand");
+
+const QString kInputPlaceholder = QStringLiteral("%INPUT%");
+const QString kOutputPlaceholder = QStringLiteral("%OUTPUT%");
+
+const QString kStemFileSuffix = QStringLiteral("stem.mp4");
+
+// Poll interval for checking the stop flag while the separation
+// process is running. Separating a track takes in the order of
+// minutes, so a coarse interval is sufficient.
+constexpr int kWaitForProcessMillis = 500;
+
+QString stemFileName(const mixxx::FileInfo& sourceFileInfo) {
+    return sourceFileInfo.baseName() + QChar('.') + kStemFileSuffix;
+}
+
+} // namespace
+
+// static
+bool StemGenerationWorker::isSeparatorConfigured(const UserSettingsPointer& pConfig) {
+    return !pConfig->getValue(kSeparatorCommandKey, QString()).trimmed().isEmpty();
+}
+
+void StemGenerationWorker::run() {
+    int i = 0;
+    for (const auto& pTrack : m_tracks) {
+        VERIFY_OR_DEBUG_ASSERT(pTrack != nullptr) {
+            continue;
+        }
+        auto fileInfo = pTrack->getFileInfo();
+        if (fileInfo.resolveCanonicalLocation().isEmpty()) {
+            kLogger.warning()
+                    << "File not found or inaccessible while generating stems"
+                    << fileInfo;
+            // Skip file
+            continue;
+        }
+        // We emit progress twice per loop, which may seem excessive, but it
+        // guarantees that we emit a sane progress before we start and after
+        // we end.  In between, each filename will get its own visible tick
+        // on the bar, which looks really nice.
+        emit progress(fileInfo.fileName(), i, m_tracks.size());
+        generateStemFile(fileInfo);
+        if (m_bStop.loadAcquire()) {
+            emit canceled();
+            return;
+        }
+        ++i;
+        emit progress(fileInfo.fileName(), i, m_tracks.size());
+    }
+}
+
+void StemGenerationWorker::generateStemFile(const mixxx::FileInfo& sourceFileInfo) {
+    const QString sourceFilename = sourceFileInfo.canonicalLocation();
+    if (mixxx::StemInfoImporter::maybeStemFile(sourceFilename)) {
+        kLogger.debug() << "skipping stem file" << sourceFilename;
+        return;
+    }
+    const QString destPath = QDir(m_destDir).filePath(stemFileName(sourceFileInfo));
+    if (QFileInfo::exists(destPath)) {
+        // Separating a track is expensive, never redo it implicitly.
+        // The user can delete the stale stem file to regenerate it.
+        kLogger.debug() << "skipping" << sourceFilename
+                        << "- stem file" << destPath << "already exists";
+        return;
+    }
+
+    QString commandLine = m_pConfig->getValue(kSeparatorCommandKey, QString());
+    commandLine.replace(kInputPlaceholder, sourceFilename);
+    commandLine.replace(kOutputPlaceholder, destPath);
+    QStringList arguments = QProcess::splitCommand(commandLine);
+    VERIFY_OR_DEBUG_ASSERT(!arguments.isEmpty()) {
+        m_errorMessage = tr("No stem separation command configured.");
+        stop();
+        return;
+    }
+    const QString program = arguments.takeFirst();
+
+    kLogger.debug() << "separating" << sourceFilename << "into" << destPath;
+    QProcess process;
+    // Discard the tool's output instead of buffering it in the pipe
+    process.setStandardOutputFile(QProcess::nullDevice());
+    process.setStandardErrorFile(QProcess::nullDevice());
+    process.start(program, arguments);
+    if (!process.waitForStarted()) {
+        const QString errorMessage = tr(
+                "Failed to start the stem separation command %1: %2. Stopping.")
+                                             .arg(program, process.errorString());
+        kLogger.warning() << errorMessage;
+        m_errorMessage = errorMessage;
+        stop();
+        return;
+    }
+    while (!process.waitForFinished(kWaitForProcessMillis)) {
+        if (process.error() != QProcess::Timedout) {
+            break;
+        }
+        if (m_bStop.loadAcquire()) {
+            kLogger.debug() << "killing separation process for" << sourceFilename;
+            process.kill();
+            process.waitForFinished();
+            // Don't leave a partially written stem file behind
+            QFile::remove(destPath);
+            return;
+        }
+    }
+
+    if (process.exitStatus() != QProcess::NormalExit || process.exitCode() != 0) {
+        const QString errorMessage = tr(
+                "Stem separation of %1 failed with exit code %2. Stopping.")
+                                             .arg(sourceFilename)
+                                             .arg(process.exitCode());
+        kLogger.warning() << errorMessage;
+        m_errorMessage = errorMessage;
+        QFile::remove(destPath);
+        stop();
+        return;
+    }
+    // Verify that the tool actually produced a readable stem file before
+    // reporting success. A plain MP4 without the stem atom would load as
+    // an ordinary track.
+    if (!mixxx::StemInfoImporter::hasStemAtom(destPath)) {
+        const QString errorMessage = tr(
+                "The stem separation command did not produce a valid stem "
+                "file at %1. Stopping.")
+                                             .arg(destPath);
+        kLogger.warning() << errorMessage;
+        m_errorMessage = errorMessage;
+        stop();
+        return;
+    }
+}
+
+void StemGenerationWorker::stop() {
+    // We'll kill a running separation process, then stop.
+    m_bStop = true;
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <QString>
+#include <QThread>
+
+#include "preferences/usersettings.h"
+#include "track/track_decl.h"
+
+namespace mixxx {
+class FileInfo;
+} // namespace mixxx
+
+// A QThread class for generating STEM files for a list of tracks by running
+// a user-configured external separation tool (e.g. demucs or spleeter with a
+// stem muxer) over each track in turn. The separation model itself is not
+// embedded: the heavy lifting happens in the child process, which streams
+// the audio with its own bounded buffers, while this thread only supervises
+// it. Exactly one separation process runs at a time, so the memory footprint
+// stays bounded regardless of how many tracks are queued. May be canceled
+// from another thread, which kills the running child process.
+//
+// The command line is read from the "[StemGeneration]" "SeparatorCommand"
+// config value. The placeholders %INPUT% and %OUTPUT% are replaced with the
+// track file and the destination stem file before the process is started.
+class StemGenerationWorker : public QThread {
+    Q_OBJECT
+  public:
+    // Constructor does not validate the destination directory.  Calling classes
+    // should do that.
+    StemGenerationWorker(UserSettingsPointer pConfig,
+            const QString& destDir,
+            const TrackPointerList& tracks)
+            : m_pConfig(pConfig), m_destDir(destDir), m_tracks(tracks) {
+    }
+    ~StemGenerationWorker() override = default;
+
+    // Whether a separator command has been configured. Calling classes
+    // should not offer stem generation otherwise.
+    static bool isSeparatorConfigured(const UserSettingsPointer& pConfig);
+
+    // Generates stems for ALL the tracks.  Thread joins on success or failure.
+    void run() override;
+
+    // Calling classes can call errorMessage after a failure for a user-friendly
+    // message about what happened.
+    QString errorMessage() const {
+        return m_errorMessage;
+    }
+
+    // Cancels the generation and kills a running separation process.
+    // May be called from another thread.
+    void stop();
+
+  signals:
+    void progress(const QString& filename, int progress, int count);
+    void canceled();
+
+  private:
+    // Runs the configured separator over the given track file, writing the
+    // stem file into the destination directory. Tracks that already have a
+    // stem file at the destination are skipped. On unrecoverable error,
+    // sets the error message and stops the generation process entirely.
+    void generateStemFile(const mixxx::FileInfo& sourceFileInfo);
+
+    QAtomicInt m_bStop = false;
+    QString m_errorMessage;
+
+    const UserSettingsPointer m_pConfig;
+    const QString m_destDir;
+    const TrackPointerList m_tracks;
+};
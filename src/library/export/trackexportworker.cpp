@@ -2,15 +2,34 @@
 
 #include <QDebug>
 #include <QFileInfo>
+#include <QSemaphore>
+#include <QThreadPool>
 
+#include <vector>
+
+#include "mixer/playerinfo.h"
 #include "moc_trackexportworker.cpp"
 #include "track/track.h"
+#include "util/compatibility/qmutex.h"
 #include "util/logger.h"
 
 namespace {
 
 const mixxx::Logger kLogger("TrackExportWorker");
 
+// Upper bound on concurrent copies. Exports are I/O bound, so a few
+// concurrent streams are enough to saturate a USB stick or SSD while
+// keeping the seek pressure on the source disk reasonable.
+constexpr int kMaxCopyThreads = 4;
+
+// A fully resolved copy, produced after all overwrite questions have
+// been answered.
+struct CopyJob {
+    QString sourcePath;
+    QString destPath;
+    QString destFileName;
+};
+
 QString rewriteFilename(const mixxx::FileInfo& fileinfo, int index) {
     // We don't have total control over the inputs, so definitely
     // don't use .arg().arg().arg().
@@ -74,25 +93,89 @@ QMap<QString, mixxx::FileInfo> createCopylist(const TrackPointerList& tracks) {
 }  // namespace
 
 void TrackExportWorker::run() {
-    int i = 0;
-    QMap<QString, mixxx::FileInfo> copy_list = createCopylist(m_tracks);
+    const QMap<QString, mixxx::FileInfo> copy_list = createCopylist(m_tracks);
+    const int count = copy_list.size();
+    int completed = 0;
+
+    // Resolve all overwrite conflicts serially first. The questions
+    // have to be answered by the user one at a time anyway, and
+    // removing stale destination files up front keeps the parallel
+    // stage free of any interaction.
+    std::vector<CopyJob> jobs;
+    jobs.reserve(count);
     for (auto it = copy_list.constBegin(); it != copy_list.constEnd(); ++it) {
-        // We emit progress twice per loop, which may seem excessive, but it
-        // guarantees that we emit a sane progress before we start and after
-        // we end.  In between, each filename will get its own visible tick
-        // on the bar, which looks really nice.
-        emit progress(it->fileName(), i, copy_list.size());
-        copyFile(*it, it.key());
+        if (!prepareDestination(*it, it.key())) {
+            if (m_bStop.loadAcquire()) {
+                emit canceled();
+                return;
+            }
+            // File skipped, count it as done right away.
+            emit progress(it->fileName(), ++completed, count);
+            continue;
+        }
+        jobs.push_back(CopyJob{
+                it->canonicalLocation(),
+                QDir(m_destDir).filePath(it.key()),
+                it->fileName()});
+    }
+
+    // The copy threads only record what they finished; all progress is
+    // emitted from this thread so that signal delivery works the same
+    // as with the old serial loop.
+    QMutex doneMutex;
+    QStringList doneNames;
+    const auto drainFinished = [&] {
+        QStringList finished;
+        {
+            const auto lock = lockMutex(&doneMutex);
+            finished.swap(doneNames);
+        }
+        for (const QString& fileName : finished) {
+            emit progress(fileName, ++completed, count);
+        }
+    };
+
+    QThreadPool pool;
+    pool.setMaxThreadCount(kMaxCopyThreads);
+    QSemaphore freeSlots(kMaxCopyThreads);
+    for (const CopyJob& job : jobs) {
         if (m_bStop.loadAcquire()) {
-            emit canceled();
-            return;
+            break;
         }
-        ++i;
-        emit progress(it->fileName(), i, copy_list.size());
+        // Throttle the pool down to a single copy stream while a deck
+        // is playing, so that the export cannot starve the engine's own
+        // disk reads. Full parallelism resumes once playback stops.
+        const int slotsNeeded = PlayerInfo::exists() &&
+                        PlayerInfo::instance().getCurrentPlayingDeck() >= 0
+                ? kMaxCopyThreads
+                : 1;
+        freeSlots.acquire(slotsNeeded);
+        drainFinished();
+        emit progress(job.destFileName, completed, count);
+        pool.start([this, job, slotsNeeded, &freeSlots, &doneMutex, &doneNames] {
+            if (!m_bStop.loadAcquire()) {
+                kLogger.debug() << "copying" << job.sourcePath << "to" << job.destPath;
+                QFile source_file(job.sourcePath);
+                if (source_file.copy(job.destPath)) {
+                    const auto lock = lockMutex(&doneMutex);
+                    doneNames.append(job.destFileName);
+                } else {
+                    reportError(tr(
+                            "Error exporting track %1 to %2: %3. Stopping.").arg(
+                            job.sourcePath, job.destPath, source_file.errorString()));
+                }
+            }
+            freeSlots.release(slotsNeeded);
+        });
+    }
+    pool.waitForDone();
+    drainFinished();
+    if (m_bStop.loadAcquire()) {
+        emit canceled();
     }
 }
 
-void TrackExportWorker::copyFile(
+bool TrackExportWorker::prepareDestination(
         const mixxx::FileInfo& source_fileinfo,
         const QString& dest_filename) {
     QString sourceFilename = source_fileinfo.canonicalLocation();
@@ -107,19 +190,19 @@ void TrackExportWorker::copyFile(
             case OverwriteAnswer::SKIP:
             case OverwriteAnswer::SKIP_ALL:
                 kLogger.debug() << "skipping" << sourceFilename;
-                return;
+                return false;
             case OverwriteAnswer::OVERWRITE:
             case OverwriteAnswer::OVERWRITE_ALL:
                 break;
             case OverwriteAnswer::CANCEL:
                 m_errorMessage = tr("Export process was canceled");
                 stop();
-                return;
+                return false;
             }
             break;
         case OverwriteMode::SKIP_ALL:
             kLogger.debug() << "skipping" << sourceFilename;
-            return;
+            return false;
         case OverwriteMode::OVERWRITE_ALL:;
         }
 
@@ -133,21 +216,21 @@ void TrackExportWorker::copyFile(
             kLogger.warning() << error_message;
             m_errorMessage = error_message;
             stop();
-            return;
+            return false;
         }
     }
 
-    kLogger.debug() << "copying" << sourceFilename << "to" << dest_path;
-    QFile source_file(sourceFilename);
-    if (!source_file.copy(dest_path)) {
-        const QString error_message = tr(
-                "Error exporting track %1 to %2: %3. Stopping.").arg(
-                sourceFilename, dest_path, source_file.errorString());
-        kLogger.warning() << error_message;
-        m_errorMessage = error_message;
-        stop();
-        return;
+    return true;
+}
+
+void TrackExportWorker::reportError(const QString& message) {
+    kLogger.warning() << message;
+    const auto lock = lockMutex(&m_errorMutex);
+    // Keep the first error, it is the one that triggered the stop.
+    if (m_errorMessage.isEmpty()) {
+        m_errorMessage = message;
     }
+    stop();
 }
 
 TrackExportWorker::OverwriteAnswer TrackExportWorker::makeOverwriteRequest(
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <QMutex>
 #include <QString>
 #include <QThread>
 #include <future>
@@ -11,9 +12,9 @@ class FileInfo;
 } // namespace mixxx
 
 // A QThread class for copying a list of files to a single destination directory.
-// Currently does not preserve subdirectory relationships.  This class performs
-// all copies in a blocking style within its own thread.  May be canceled from
-// another thread.
+// Currently does not preserve subdirectory relationships.  Overwrite conflicts
+// are resolved serially within this thread, the copies themselves run on a
+// small thread pool.  May be canceled from another thread.
 class TrackExportWorker : public QThread {
     Q_OBJECT
   public:
@@ -66,19 +67,25 @@ class TrackExportWorker : public QThread {
     void canceled();
 
   private:
-    // Copies the file at source_fileinfo to the destination directory with the
-    // name given by dest_filename (not a full path).  If the destination file
-    // exists, will emit an overwrite request signal to ask how to proceed.
-    // On unrecoverable error, sets the error message and stops the export
-    // process entirely.
-    void copyFile(const mixxx::FileInfo& source_fileinfo,
+    // Decides whether the file named dest_filename (not a full path) can be
+    // copied into the destination directory.  If the destination file exists,
+    // will emit an overwrite request signal to ask how to proceed and remove
+    // the existing file when it is to be overwritten.  Returns false if the
+    // file is skipped or, on unrecoverable error, after setting the error
+    // message and stopping the export process entirely.
+    bool prepareDestination(const mixxx::FileInfo& source_fileinfo,
             const QString& dest_filename);
 
+    // Records the first error message and stops the export.  Safe to call
+    // from several copy threads at once.
+    void reportError(const QString& message);
+
     // Emit a signal requesting overwrite mode, and block until we get an
     // answer.  Updates m_overwriteMode appropriately.
     OverwriteAnswer makeOverwriteRequest(const QString& filename);
 
     QAtomicInt m_bStop = false;
+    QMutex m_errorMutex;
     QString m_errorMessage;
 
     OverwriteMode m_overwriteMode = OverwriteMode::ASK;
@@ -3,6 +3,8 @@
 #include <QApplication>
 #include <QDir>
 #include <QMessageBox>
+#include <QTimer>
+#include <algorithm>
 
 #include "control/controlobject.h"
 #include "controllers/keyboard/keyboardeventfilter.h"
@@ -27,6 +29,7 @@
 #include "library/trackcollection.h"
 #include "library/trackcollectionmanager.h"
 #include "library/trackmodel.h"
+#include "library/trackoperationjournal.h"
 #include "library/trackset/crate/cratefeature.h"
 #include "library/trackset/playlistfeature.h"
 #include "library/trackset/setlogfeature.h"
@@ -45,6 +48,13 @@ namespace {
 
 const mixxx::Logger kLogger("Library");
 
+// Delay before the first lazily initialized feature is warmed up after
+// startup, leaving the startup phase and the initial skin rendering
+// undisturbed, and the pause between two warmups so that the GUI thread
+// stays responsive while the queue is drained.
+constexpr int kFeatureWarmupDelayMillis = 5000;
+constexpr int kFeatureWarmupIntervalMillis = 500;
+
 } // namespace
 
 using namespace mixxx::library::prefs;
@@ -71,6 +81,7 @@ Library::Library(
           m_pTrackCollectionManager(pTrackCollectionManager),
           m_pSidebarModel(make_parented<SidebarModel>(this)),
           m_pLibraryControl(make_parented<LibraryControl>(this)),
+          m_pTrackOperationJournal(make_parented<mixxx::TrackOperationJournal>(this)),
           m_pLibraryWidget(nullptr),
           m_pKeyNotation(std::make_unique<ControlObject>(
                   mixxx::library::prefs::kKeyNotationConfigKey)) {
@@ -267,6 +278,17 @@ Library::Library(
     m_editMetadataSelectedClick = m_pConfig->getValue(
             kEditMetadataSelectedClickConfigKey,
             kEditMetadataSelectedClickDefault);
+
+    // Warm up lazily initialized features during idle time after startup,
+    // most frequently used features first, so that the first click on them
+    // does not pay their initialization cost.
+    m_featureWarmupQueue = m_features;
+    std::stable_sort(m_featureWarmupQueue.begin(),
+            m_featureWarmupQueue.end(),
+            [](LibraryFeature* pFeature1, LibraryFeature* pFeature2) {
+                return pFeature1->usageCount() > pFeature2->usageCount();
+            });
+    QTimer::singleShot(kFeatureWarmupDelayMillis, this, &Library::warmUpFeatures);
 }
 
 Library::~Library() = default;
@@ -528,6 +550,16 @@ void Library::addFeature(LibraryFeature* feature) {
             &Library::restoreModelState);
 }
 
+void Library::warmUpFeatures() {
+    if (m_featureWarmupQueue.isEmpty()) {
+        return;
+    }
+    m_featureWarmupQueue.takeFirst()->warmUp();
+    if (!m_featureWarmupQueue.isEmpty()) {
+        QTimer::singleShot(kFeatureWarmupIntervalMillis, this, &Library::warmUpFeatures);
+    }
+}
+
 void Library::onPlayerManagerTrackAnalyzerProgress(
         TrackId /*trackId*/, AnalyzerProgress /*analyzerProgress*/) {
     if (m_pAnalysisFeature) {
@@ -767,6 +799,7 @@ void Library::searchTracksInCollection(const QString& query) {
 }
 
 void Library::showAutoDJ() {
+    m_pAutoDJFeature->ensureInitialized();
     m_pAutoDJFeature->activate();
     emit switchToView(kAutoDJViewName);
     // Select it but don't scroll there
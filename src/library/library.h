@@ -35,11 +35,12 @@ class WLibrarySidebar;
 class WLibrary;
 class QAbstractItemModel;
 
-#ifdef __ENGINEPRIME__
 namespace mixxx {
+#ifdef __ENGINEPRIME__
 class LibraryExporter;
-} // namespace mixxx
 #endif
+class TrackOperationJournal;
+} // namespace mixxx
 
 // A Library class is a container for all the model-side aspects of the library.
 // A library widget can be attached to the Library object by calling bindLibraryWidget.
@@ -63,6 +64,12 @@ class Library: public QObject {
 
     TrackCollectionManager* trackCollectionManager() const;
 
+    /// Journal of reversible bulk track edits for undoing complete
+    /// user gestures.
+    mixxx::TrackOperationJournal* trackOperationJournal() const {
+        return m_pTrackOperationJournal;
+    }
+
     TrackAnalysisScheduler::Pointer createTrackAnalysisScheduler(
             int numWorkerThreads,
             AnalyzerModeFlags modeFlags) const;
@@ -182,6 +189,12 @@ class Library: public QObject {
       void onPlayerManagerTrackAnalyzerIdle();
 
   private:
+    /// Initializes one lazily initialized feature per invocation and
+    /// reschedules itself until all features are warmed up. Features are
+    /// processed in descending order of usage frequency so that the
+    /// features the user is most likely to open are ready first.
+    void warmUpFeatures();
+
     const UserSettingsPointer m_pConfig;
 
     // The Mixxx database connection pool
@@ -191,8 +204,10 @@ class Library: public QObject {
 
     parented_ptr<SidebarModel> m_pSidebarModel;
     parented_ptr<LibraryControl> m_pLibraryControl;
+    parented_ptr<mixxx::TrackOperationJournal> m_pTrackOperationJournal;
 
     QList<LibraryFeature*> m_features;
+    QList<LibraryFeature*> m_featureWarmupQueue;
     const static QString m_sTrackViewName;
     WLibrary* m_pLibraryWidget;
     parented_ptr<MixxxLibraryFeature> m_pMixxxLibraryFeature;
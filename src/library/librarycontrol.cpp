@@ -11,8 +11,11 @@
 #include "control/controlpushbutton.h"
 #include "library/library.h"
 #include "library/libraryview.h"
+#include "library/searchquery.h"
+#include "mixer/playerinfo.h"
 #include "mixer/playermanager.h"
 #include "moc_librarycontrol.cpp"
+#include "track/keyutils.h"
 #include "util/cmdlineargs.h"
 #include "widget/wlibrary.h"
 #include "widget/wlibrarysidebar.h"
@@ -453,6 +456,16 @@ LibraryControl::LibraryControl(Library* pLibrary)
                 }
             });
 
+    // Search the library for tracks that mix with the deck that is
+    // currently playing, i.e. tracks in a harmonically compatible key
+    // within the configured fuzzy BPM range
+    m_pSearchCompatibleTracks = std::make_unique<ControlPushButton>(
+            ConfigKey("[Library]", "search_compatible_tracks"));
+    connect(m_pSearchCompatibleTracks.get(),
+            &ControlPushButton::valueChanged,
+            this,
+            &LibraryControl::slotSearchCompatibleTracks);
+
     // Show the track context menu for selected tracks, or hide it
     // if it is the current active window
     // The control is updated in slotUpdateTrackMenuControl with the actual state
@@ -1182,6 +1195,45 @@ void LibraryControl::slotDecrementFontSize(double v) {
     }
 }
 
+void LibraryControl::slotSearchCompatibleTracks(double v) {
+    if (v <= 0.0) {
+        return;
+    }
+    int deck = PlayerInfo::instance().getCurrentPlayingDeck();
+    if (deck < 0) {
+        return;
+    }
+    // Use the deck's effective key and BPM instead of the loaded track's
+    // metadata, so that pitch faders and key shifts are taken into account.
+    const QString group = PlayerManager::groupForDeck(deck);
+    const auto key = KeyUtils::keyFromNumericValue(
+            ControlObject::get(ConfigKey(group, QStringLiteral("key"))));
+    const double bpm = ControlObject::get(ConfigKey(group, QStringLiteral("bpm")));
+
+    QStringList queries;
+    if (key != mixxx::track::io::key::INVALID) {
+        queries.append(QStringLiteral("~key:\"") +
+                KeyUtils::keyToString(key) + QChar('"'));
+    }
+    if (bpm > 0) {
+        // BpmFilterNode expands the BPM to the fuzzy search range
+        // configured in the library preferences
+        QString bpmStr = QString::number(bpm);
+        BpmFilterNode bpmNode(bpmStr, true /* fuzzy search */);
+        double bpmLowerBound = 0.0;
+        double bpmUpperBound = 0.0;
+        std::tie(bpmLowerBound, bpmUpperBound) = bpmNode.getBpmRange();
+        queries.append(QStringLiteral("bpm:>=") +
+                QString::number(bpmLowerBound) +
+                QStringLiteral(" bpm:<=") +
+                QString::number(bpmUpperBound));
+    }
+    if (queries.isEmpty()) {
+        return;
+    }
+    m_pLibrary->searchTracksInCollection(queries.join(QChar(' ')));
+}
+
 void LibraryControl::slotTrackColorPrev(double v) {
     if (!m_pLibraryWidget || v <= 0) {
         return;
@@ -135,6 +135,8 @@ class LibraryControl : public QObject {
     void slotIncrementFontSize(double v);
     void slotDecrementFontSize(double v);
 
+    void slotSearchCompatibleTracks(double v);
+
   private:
     Library* m_pLibrary;
 
@@ -201,6 +203,9 @@ class LibraryControl : public QObject {
     std::unique_ptr<ControlPushButton> m_pClearSearch;
     std::unique_ptr<ControlPushButton> m_pDeleteSearchQuery;
 
+    // Control to search for tracks compatible with the playing deck
+    std::unique_ptr<ControlPushButton> m_pSearchCompatibleTracks;
+
     // Font sizes
     std::unique_ptr<ControlPushButton> m_pFontSizeIncrement;
     std::unique_ptr<ControlPushButton> m_pFontSizeDecrement;
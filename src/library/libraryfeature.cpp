@@ -7,6 +7,7 @@
 #include "library/parserpls.h"
 #include "moc_libraryfeature.cpp"
 #include "util/logger.h"
+#include "util/performancetimer.h"
 
 // KEEP THIS cpp file to tell scons that moc should be called on the class!!!
 // The reason for this is that LibraryFeature uses slots/signals and for this
@@ -17,6 +18,11 @@ namespace {
 const mixxx::Logger kLogger("LibraryFeature");
 const QString kIconPath = QStringLiteral(":/images/library/ic_library_%1.svg");
 
+// Stores one counter per feature (keyed by icon name) that tracks in how
+// many sessions the feature has been opened. Used to order the idle-time
+// warmup of lazily initialized features by usage frequency.
+const QString kUsageConfigGroup = QStringLiteral("[LibraryFeatureUsage]");
+
 } // anonymous namespace
 
 LibraryFeature::LibraryFeature(
@@ -26,13 +32,49 @@ LibraryFeature::LibraryFeature(
         : QObject(pLibrary),
           m_pLibrary(pLibrary),
           m_pConfig(pConfig),
-          m_iconName(iconName) {
+          m_iconName(iconName),
+          m_initialized(false),
+          m_usageRecorded(false) {
     if (!m_iconName.isEmpty()) {
         m_icon = QIcon(kIconPath.arg(m_iconName));
     }
 }
 
+void LibraryFeature::ensureInitialized() {
+    if (!m_usageRecorded && !m_iconName.isEmpty()) {
+        // Count each feature at most once per session so that the counter
+        // reflects in how many sessions the feature has been opened.
+        m_usageRecorded = true;
+        const ConfigKey usageKey(kUsageConfigGroup, m_iconName);
+        m_pConfig->setValue(usageKey, m_pConfig->getValue(usageKey, 0) + 1);
+    }
+    warmUp();
+}
+
+void LibraryFeature::warmUp() {
+    if (m_initialized) {
+        return;
+    }
+    m_initialized = true;
+    PerformanceTimer timer;
+    timer.start();
+    initialize();
+    kLogger.debug()
+            << "Initialized feature"
+            << m_iconName
+            << "in"
+            << timer.elapsed().formatMillisWithUnit();
+}
+
+int LibraryFeature::usageCount() const {
+    if (m_iconName.isEmpty()) {
+        return 0;
+    }
+    return m_pConfig->getValue(ConfigKey(kUsageConfigGroup, m_iconName), 0);
+}
+
 void LibraryFeature::selectAndActivate(const QModelIndex& index) {
+    ensureInitialized();
     if (index.isValid()) {
         emit featureSelect(this, index);
         activateChild(index);
@@ -48,6 +48,24 @@ class LibraryFeature : public QObject {
         return m_icon;
     }
 
+    /// Runs the deferred initialization (see initialize()) if it has not
+    /// happened yet and counts the feature as used for prioritizing the
+    /// idle-time warmup in future sessions. Called before the first user
+    /// interaction with this feature reaches it.
+    void ensureInitialized();
+
+    /// Runs the deferred initialization without counting the feature as
+    /// used. Called by Library's idle-time warmup.
+    void warmUp();
+
+    bool isInitialized() const {
+        return m_initialized;
+    }
+
+    /// Returns how many sessions this feature has been opened in. Used by
+    /// Library to order the idle-time warmup by usage frequency.
+    int usageCount() const;
+
     virtual bool dropAccept(const QList<QUrl>& urls, QObject* pSource) {
         Q_UNUSED(urls);
         Q_UNUSED(pSource);
@@ -89,6 +107,16 @@ class LibraryFeature : public QObject {
     }
 
   protected:
+    /// Override this to defer expensive model/DAO construction out of the
+    /// feature's constructor. It is called at most once, either right
+    /// before the first user interaction with the feature or from the
+    /// idle-time warmup after startup, so features that are never opened
+    /// do not pay their initialization cost at startup. Everything needed
+    /// to render the sidebar entry (title, icon, sidebar model) must
+    /// still be set up in the constructor.
+    virtual void initialize() {
+    }
+
     QStringList getPlaylistFiles() const {
         return getPlaylistFiles(QFileDialog::ExistingFiles);
     }
@@ -183,4 +211,6 @@ class LibraryFeature : public QObject {
 
     QString m_iconName;
     QIcon m_icon;
+    bool m_initialized;
+    bool m_usageRecorded;
 };
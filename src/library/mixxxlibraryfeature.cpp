@@ -24,6 +24,15 @@
 #include "widget/wlibrarysidebar.h"
 #endif
 
+namespace {
+
+// The first select() of the library model only fetches this many rows so
+// that the track table paints immediately at startup, while the unlimited
+// select follows right behind it on the event loop.
+constexpr int kFirstSelectPreviewRowCount = 500;
+
+} // anonymous namespace
+
 MixxxLibraryFeature::MixxxLibraryFeature(Library* pLibrary,
         UserSettingsPointer pConfig)
         : LibraryFeature(pLibrary, pConfig, QStringLiteral("tracks")),
@@ -118,6 +127,7 @@ MixxxLibraryFeature::MixxxLibraryFeature(Library* pLibrary,
     m_pLibraryTableModel = new LibraryTableModel(this,
             pLibrary->trackCollectionManager(),
             "mixxx.db.model.library");
+    m_pLibraryTableModel->setFirstSelectPreviewRowCount(kFirstSelectPreviewRowCount);
 
     connect(m_pLibraryTableModel,
             &LibraryTableModel::updateTrackCount,
@@ -10,6 +10,7 @@
 #include "util/db/dbconnectionpooled.h"
 #include "util/db/dbconnectionpooler.h"
 #include "util/logger.h"
+#include "waveform/overviewstrip.h"
 #include "waveform/renderers/waveformoverviewrenderer.h"
 #include "waveform/renderers/waveformsignalcolors.h"
 #include "waveform/waveformfactory.h"
@@ -38,6 +39,16 @@ OverviewCache::OverviewCache(UserSettingsPointer pConfig,
         mixxx::DbConnectionPoolPtr pDbConnectionPool)
         : m_pConfig(pConfig),
           m_pDbConnectionPool(std::move(pDbConnectionPool)) {
+    // Bulk-load the compact overview strips of the whole library, so
+    // that painting the overview column usually neither touches the
+    // database nor any per-track analysis file.
+    AnalysisDao analysisDao(m_pConfig);
+    analysisDao.initialize(mixxx::DbConnectionPooled(m_pDbConnectionPool));
+    analysisDao.loadAllOverviewStrips(
+            mixxx::kOverviewStripVersion,
+            mixxx::kOverviewStripNumBytes,
+            &m_packedStrips,
+            &m_stripOffsetByTrackId);
 }
 
 void OverviewCache::onTrackAnalysisProgress(TrackId trackId, AnalyzerProgress analyzerProgress) {
@@ -45,6 +56,9 @@ void OverviewCache::onTrackAnalysisProgress(TrackId trackId, AnalyzerProgress an
         return;
     }
     m_tracksWithoutOverview.remove(trackId);
+    // The analyzer has stored a fresh strip, drop the stale in-memory
+    // copy. The next paint recreates it from the new waveform summary.
+    m_stripOffsetByTrackId.remove(trackId);
     // request update independent from paint events
     emit overviewChanged(trackId);
 }
@@ -60,6 +74,8 @@ void OverviewCache::onTrackSummaryChanged(TrackId trackId) {
     }
     // try remove the id from the ignore list
     m_tracksWithoutOverview.remove(trackId);
+    // drop the stale in-memory strip as well
+    m_stripOffsetByTrackId.remove(trackId);
     // then let users request an update independent from paint events
     emit overviewChanged(trackId);
 }
@@ -120,6 +136,14 @@ QPixmap OverviewCache::requestUncachedOverview(
     // no cached overview, request preparation
     m_currentlyLoading.insert(trackId);
 
+    // Hand the bulk-loaded strip of this track (if any) to the
+    // preparation task, which then renders without any database access.
+    QByteArray strip;
+    const auto stripOffsetIt = m_stripOffsetByTrackId.constFind(trackId);
+    if (stripOffsetIt != m_stripOffsetByTrackId.constEnd()) {
+        strip = m_packedStrips.mid(*stripOffsetIt, mixxx::kOverviewStripNumBytes);
+    }
+
     QFutureWatcher<FutureResult>* watcher = new QFutureWatcher<FutureResult>(this);
     QFuture<FutureResult> future = QtConcurrent::run(
             &OverviewCache::prepareOverview,
@@ -128,6 +152,7 @@ QPixmap OverviewCache::requestUncachedOverview(
             type,
             signalColors,
             trackId,
+            strip,
             pRequester,
             desiredSize);
     connect(watcher,
@@ -146,6 +171,7 @@ OverviewCache::FutureResult OverviewCache::prepareOverview(
         mixxx::OverviewType type,
         const WaveformSignalColors& signalColors,
         TrackId trackId,
+        const QByteArray& strip,
         const QObject* pRequester,
         QSize desiredSize) {
     // kLogger.warning() << "prepareOverview" << trackId;
@@ -160,6 +186,16 @@ OverviewCache::FutureResult OverviewCache::prepareOverview(
         return result;
     }
 
+    if (!strip.isEmpty()) {
+        // Fast path: render from the compact strip without touching
+        // the database or the full waveform summary.
+        const QImage image = mixxx::renderOverviewStrip(strip, type, signalColors);
+        if (!image.isNull()) {
+            result.image = resizeImageSize(image, desiredSize);
+            return result;
+        }
+    }
+
     mixxx::DbConnectionPooler dbConnectionPooler(pDbConnectionPool);
 
     AnalysisDao analysisDao(pConfig);
@@ -184,6 +220,14 @@ OverviewCache::FutureResult OverviewCache::prepareOverview(
                 image = resizeImageSize(image, desiredSize);
             }
             result.image = image;
+
+            // Backfill the compact strip for tracks that were analyzed
+            // before strips existed, so that subsequent paints take the
+            // fast path.
+            result.strip = mixxx::makeOverviewStrip(pLoadedTrackWaveformSummary);
+            analysisDao.saveOverviewStrip(trackId,
+                    mixxx::kOverviewStripVersion,
+                    result.strip);
         }
     }
 
@@ -212,6 +256,13 @@ void OverviewCache::overviewPrepared() {
         m_cacheKeysByTrackId.insert(res.trackId, cacheKey);
     }
 
+    if (res.strip.size() == mixxx::kOverviewStripNumBytes &&
+            !m_stripOffsetByTrackId.contains(res.trackId)) {
+        // Add the backfilled strip to the in-memory index
+        m_stripOffsetByTrackId.insert(res.trackId, m_packedStrips.size());
+        m_packedStrips.append(res.strip);
+    }
+
     if (pixmap.isNull()) {
         // Avoid (too many) repeated lookups.
         // (there may still be identical request be processed due to
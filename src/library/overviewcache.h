@@ -1,5 +1,7 @@
 #pragma once
 
+#include <QByteArray>
+#include <QHash>
 #include <QSqlDatabase>
 
 #include "analyzer/analyzerprogress.h"
@@ -38,6 +40,10 @@ class OverviewCache : public QObject, public Singleton<OverviewCache> {
         QImage image;
         QSize resizedToSize;
         const QObject* requester;
+        // Overview strip that was backfilled for a track that had none
+        // yet, to be added to the in-memory strip index. Empty if the
+        // strip index already covered the track.
+        QByteArray strip;
     };
 
   public slots:
@@ -64,6 +70,7 @@ class OverviewCache : public QObject, public Singleton<OverviewCache> {
             mixxx::OverviewType type,
             const WaveformSignalColors& signalColors,
             TrackId trackId,
+            const QByteArray& strip,
             const QObject* pRequester,
             QSize desiredSize);
 
@@ -74,4 +81,12 @@ class OverviewCache : public QObject, public Singleton<OverviewCache> {
     QSet<TrackId> m_currentlyLoading;
     QSet<TrackId> m_tracksWithoutOverview;
     QMultiHash<TrackId, QString> m_cacheKeysByTrackId;
+
+    // All overview strips of the library packed back to back, bulk-loaded
+    // once at startup and indexed by the byte offset of each track's
+    // strip, see waveform/overviewstrip.h. Strips of tracks that get
+    // re-analyzed are only dropped from the index; the orphaned bytes
+    // are reclaimed on the next startup.
+    QByteArray m_packedStrips;
+    QHash<TrackId, int> m_stripOffsetByTrackId;
 };
@@ -4,6 +4,7 @@
 #include <rekordbox_anlz.h>
 #include <rekordbox_pdb.h>
 
+#include <QHash>
 #include <QMap>
 #include <QMessageBox>
 #include <QSettings>
@@ -294,8 +295,6 @@ QString getText(rekordbox_pdb_t::device_sql_string_t* deviceString) {
 }
 
 int createDevicePlaylist(QSqlDatabase& database, const QString& devicePath) {
-    int playlistID = kInvalidPlaylistId;
-
     QSqlQuery queryInsertIntoDevicePlaylist(database);
     queryInsertIntoDevicePlaylist.prepare(
             "INSERT INTO " + kRekordboxPlaylistsTable +
@@ -307,24 +306,10 @@ int createDevicePlaylist(QSqlDatabase& database, const QString& devicePath) {
     if (!queryInsertIntoDevicePlaylist.exec()) {
         LOG_FAILED_QUERY(queryInsertIntoDevicePlaylist)
                 << "devicePath: " << devicePath;
-        return playlistID;
+        return kInvalidPlaylistId;
     }
 
-    QSqlQuery idQuery(database);
-    idQuery.prepare("select id from " + kRekordboxPlaylistsTable + " where name=:path");
-    idQuery.bindValue(":path", devicePath);
-
-    if (!idQuery.exec()) {
-        LOG_FAILED_QUERY(idQuery)
-                << "devicePath: " << devicePath;
-        return playlistID;
-    }
-
-    while (idQuery.next()) {
-        playlistID = idQuery.value(idQuery.record().indexOf("id")).toInt();
-    }
-
-    return playlistID;
+    return queryInsertIntoDevicePlaylist.lastInsertId().toInt();
 }
 
 mixxx::RgbColor colorFromID(int colorID) {
@@ -350,7 +335,6 @@ mixxx::RgbColor colorFromID(int colorID) {
 }
 
 void insertTrack(
-        QSqlDatabase& database,
         rekordbox_pdb_t::track_row_t* track,
         QSqlQuery& query,
         QSqlQuery& queryInsertIntoDevicePlaylistTracks,
@@ -358,6 +342,7 @@ void insertTrack(
         QMap<uint32_t, QString>& albumsMap,
         QMap<uint32_t, QString>& genresMap,
         QMap<uint32_t, QString>& keysMap,
+        QHash<uint32_t, int>& trackIdMap,
         const QString& devicePath,
         const QString& device,
         int audioFilesCount) {
@@ -397,25 +382,16 @@ void insertTrack(
             mixxx::RgbColor::toQVariant(
                     colorFromID(static_cast<int>(track->color_id()))));
 
+    int trackID = -1;
     if (!query.exec()) {
         LOG_FAILED_QUERY(query);
+    } else {
+        trackID = query.lastInsertId().toInt();
     }
 
-    int trackID = -1;
-    QSqlQuery finderQuery(database);
-    finderQuery.prepare("select id from " + kRekordboxLibraryTable +
-            " where rb_id=:rb_id and device=:device");
-    finderQuery.bindValue(":rb_id", rbID);
-    finderQuery.bindValue(":device", device);
-
-    if (!finderQuery.exec()) {
-        LOG_FAILED_QUERY(finderQuery)
-                << "rbID:" << rbID;
-    }
-
-    if (finderQuery.next()) {
-        trackID = finderQuery.value(finderQuery.record().indexOf("id")).toInt();
-    }
+    // Remember the inserted id so playlist entries can be resolved without
+    // a SELECT round trip per track.
+    trackIdMap.insert(static_cast<uint32_t>(track->id()), trackID);
 
     // Insert into device all tracks playlist
     queryInsertIntoDevicePlaylistTracks.bindValue(":track_id", trackID);
@@ -436,8 +412,8 @@ void buildPlaylistTree(
         QMap<uint32_t, bool>& playlistIsFolderMap,
         QMap<uint32_t, QMap<uint32_t, uint32_t>>& playlistTreeMap,
         QMap<uint32_t, QMap<uint32_t, uint32_t>>& playlistTrackMap,
-        const QString& playlistPath,
-        const QString& device);
+        const QHash<uint32_t, int>& trackIdMap,
+        const QString& playlistPath);
 
 QString parseDeviceDB(mixxx::DbConnectionPoolPtr dbConnectionPool, TreeItem* deviceItem) {
     QString device = deviceItem->getLabel();
@@ -527,6 +503,7 @@ QString parseDeviceDB(mixxx::DbConnectionPoolPtr dbConnectionPool, TreeItem* dev
     QMap<uint32_t, bool> playlistIsFolderMap;
     QMap<uint32_t, QMap<uint32_t, uint32_t>> playlistTreeMap;
     QMap<uint32_t, QMap<uint32_t, uint32_t>> playlistTrackMap;
+    QHash<uint32_t, int> trackIdMap;
 
     bool folderOrPlaylistFound = false;
 
@@ -579,7 +556,7 @@ QString parseDeviceDB(mixxx::DbConnectionPoolPtr dbConnectionPool, TreeItem* dev
                                                                 ->track_id();
                                     } break;
                                     case rekordbox_pdb_t::PAGE_TYPE_TRACKS: {
-                                        insertTrack(database,
+                                        insertTrack(
                                                 static_cast<rekordbox_pdb_t::track_row_t*>(
                                                         rowRef->body()),
                                                 query,
@@ -588,6 +565,7 @@ QString parseDeviceDB(mixxx::DbConnectionPoolPtr dbConnectionPool, TreeItem* dev
                                                 albumsMap,
                                                 genresMap,
                                                 keysMap,
+                                                trackIdMap,
                                                 devicePath,
                                                 device,
                                                 audioFilesCount);
@@ -641,8 +619,8 @@ QString parseDeviceDB(mixxx::DbConnectionPoolPtr dbConnectionPool, TreeItem* dev
                 playlistIsFolderMap,
                 playlistTreeMap,
                 playlistTrackMap,
-                devicePath,
-                device);
+                trackIdMap,
+                devicePath);
     }
 
     qDebug() << "Found: " << audioFilesCount << " audio files in Rekordbox device " << device;
@@ -660,8 +638,8 @@ void buildPlaylistTree(
         QMap<uint32_t, bool>& playlistIsFolderMap,
         QMap<uint32_t, QMap<uint32_t, uint32_t>>& playlistTreeMap,
         QMap<uint32_t, QMap<uint32_t, uint32_t>>& playlistTrackMap,
-        const QString& playlistPath,
-        const QString& device) {
+        const QHash<uint32_t, int>& trackIdMap,
+        const QString& playlistPath) {
     for (uint32_t childIndex = 0;
             childIndex < (uint32_t)playlistTreeMap[parentID].size();
             childIndex++) {
@@ -691,20 +669,7 @@ void buildPlaylistTree(
             return;
         }
 
-        QSqlQuery idQuery(database);
-        idQuery.prepare("select id from " + kRekordboxPlaylistsTable + " where name=:path");
-        idQuery.bindValue(":path", currentPath);
-
-        if (!idQuery.exec()) {
-            LOG_FAILED_QUERY(idQuery)
-                    << "currentPath" << currentPath;
-            return;
-        }
-
-        int playlistID = kInvalidPlaylistId;
-        while (idQuery.next()) {
-            playlistID = idQuery.value(idQuery.record().indexOf("id")).toInt();
-        }
+        int playlistID = queryInsertIntoPlaylist.lastInsertId().toInt();
 
         QSqlQuery queryInsertIntoPlaylistTracks(database);
         queryInsertIntoPlaylistTracks.prepare(
@@ -719,23 +684,9 @@ void buildPlaylistTree(
                     trackIndex++) {
                 uint32_t rbTrackID = playlistTrackMap[childID][trackIndex];
 
-                int trackID = -1;
-                QSqlQuery finderQuery(database);
-                finderQuery.prepare("select id from " + kRekordboxLibraryTable +
-                        " where rb_id=:rb_id and device=:device");
-                finderQuery.bindValue(":rb_id", rbTrackID);
-                finderQuery.bindValue(":device", device);
-
-                if (!finderQuery.exec()) {
-                    LOG_FAILED_QUERY(finderQuery)
-                            << "rbTrackID:" << rbTrackID
-                            << "device:" << device;
-                    return;
-                }
-
-                if (finderQuery.next()) {
-                    trackID = finderQuery.value(finderQuery.record().indexOf("id")).toInt();
-                }
+                // The ids were recorded while inserting the tracks table, so
+                // no SELECT round trip per playlist entry is needed.
+                int trackID = trackIdMap.value(rbTrackID, -1);
 
                 queryInsertIntoPlaylistTracks.bindValue(":playlist_id", playlistID);
                 queryInsertIntoPlaylistTracks.bindValue(":track_id", trackID);
@@ -761,8 +712,8 @@ void buildPlaylistTree(
                     playlistIsFolderMap,
                     playlistTreeMap,
                     playlistTrackMap,
-                    currentPath,
-                    device);
+                    trackIdMap,
+                    currentPath);
         }
     }
 }
@@ -18,8 +18,19 @@
 
 RhythmboxFeature::RhythmboxFeature(Library* pLibrary, UserSettingsPointer pConfig)
         : BaseExternalLibraryFeature(pLibrary, pConfig, QStringLiteral("rhythmbox")),
+          m_pRhythmboxTrackModel(nullptr),
+          m_pRhythmboxPlaylistModel(nullptr),
+          m_isActivated(false),
+          m_title(tr("Rhythmbox")),
           m_pSidebarModel(make_parented<TreeItemModel>(this)),
           m_cancelImport(false) {
+}
+
+// Deferred out of the constructor so that users who never open the
+// Rhythmbox feature do not pay for the track cache, the models and the
+// extra database connection at startup. Called lazily before the first
+// interaction with this feature or from Library's idle-time warmup.
+void RhythmboxFeature::initialize() {
     QString tableName = "rhythmbox_library";
     QString idColumn = "id";
     QStringList columns = {
@@ -53,22 +64,19 @@ RhythmboxFeature::RhythmboxFeature(Library* pLibrary, UserSettingsPointer pConfi
             false);
 
     m_pRhythmboxTrackModel = new BaseExternalTrackModel(this,
-            pLibrary->trackCollectionManager(),
+            m_pLibrary->trackCollectionManager(),
             "mixxx.db.model.rhythmbox",
             "rhythmbox_library",
             m_trackSource);
     m_pRhythmboxPlaylistModel = new BaseExternalPlaylistModel(this,
-            pLibrary->trackCollectionManager(),
+            m_pLibrary->trackCollectionManager(),
             "mixxx.db.model.rhythmbox_playlist",
             "rhythmbox_playlists",
             "rhythmbox_playlist_tracks",
             m_trackSource);
 
-    m_isActivated =  false;
-    m_title = tr("Rhythmbox");
-
     m_database =
-            QSqlDatabase::cloneDatabase(pLibrary->trackCollectionManager()
+            QSqlDatabase::cloneDatabase(m_pLibrary->trackCollectionManager()
                                                 ->internalCollection()
                                                 ->database(),
                     "RHYTHMBOX_SCANNER");
@@ -102,7 +110,7 @@ RhythmboxFeature::createPlaylistModelForPlaylist(const QVariant& playlist_name)
         return {};
     }
     auto pModel = std::make_unique<BaseExternalPlaylistModel>(this,
-            m_pLibrary->trackCollectionManager(),
+            m_m_pLibrary->trackCollectionManager(),
             "mixxx.db.model.rhythmbox_playlist",
             "rhythmbox_playlists",
             "rhythmbox_playlist_tracks",
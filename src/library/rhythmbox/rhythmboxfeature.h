@@ -32,6 +32,8 @@ class RhythmboxFeature : public BaseExternalLibraryFeature {
     void onTrackCollectionLoaded();
 
   protected:
+    void initialize() override;
+
     std::unique_ptr<BaseSqlTableModel> createPlaylistModelForPlaylist(
             const QVariant& playlist_name) override;
 
@@ -1,6 +1,7 @@
 #include "library/scanner/importfilestask.h"
 
 #include "moc_importfilestask.cpp"
+#include "util/backgroundio.h"
 #include "util/timer.h"
 
 ImportFilesTask::ImportFilesTask(LibraryScanner* pScanner,
@@ -22,6 +23,10 @@ ImportFilesTask::ImportFilesTask(LibraryScanner* pScanner,
 
 void ImportFilesTask::run() {
     ScopedTimer timer(QStringLiteral("ImportFilesTask::run"));
+    mixxx::BackgroundIo::lowerCurrentThreadDiskPriority();
+    mixxx::BackgroundIo::throttle([this] {
+        return m_scannerGlobal->shouldCancel();
+    });
     for (const QFileInfo& fileInfo: m_filesToImport) {
         // If a flag was raised telling us to cancel the library scan then stop.
         if (m_scannerGlobal->shouldCancel()) {
@@ -11,18 +11,38 @@
 #include "moc_libraryscanner.cpp"
 #include "sources/soundsourceproxy.h"
 #include "track/track.h"
+#include "util/backgroundio.h"
 #include "util/db/dbconnectionpooled.h"
 #include "util/db/dbconnectionpooler.h"
 #include "util/db/fwdsqlquery.h"
 #include "util/logger.h"
+#include "util/math.h"
 #include "util/performancetimer.h"
 #include "util/timer.h"
 #include "util/trace.h"
 
 namespace {
 
-// TODO(rryan) make configurable
-constexpr int kScannerThreadPoolSize = 1;
+// Scanning a directory is mostly I/O latency bound (stat/readdir and
+// hashing of directory listings), so on high-latency (network) file
+// systems running multiple scanner threads hides most of the round-trip
+// time. All database mutations are marshalled to the LibraryScanner
+// thread via queued signals and the state shared between tasks in
+// ScannerGlobal is either immutable or mutex-protected, so the tasks
+// themselves are free to run concurrently. The pool size can be tuned
+// with the [Library] ScannerThreadPoolSize config key, e.g. increased
+// beyond the core count for NAS-mounted libraries.
+constexpr int kMaxScannerThreadPoolSize = 64;
+
+int scannerThreadPoolSize(const UserSettingsPointer& pConfig) {
+    const int defaultPoolSize = math_clamp(QThread::idealThreadCount(), 1, 8);
+    return math_clamp(
+            pConfig->getValue(
+                    ConfigKey("[Library]", "ScannerThreadPoolSize"),
+                    defaultPoolSize),
+            1,
+            kMaxScannerThreadPoolSize);
+}
 
 mixxx::Logger kLogger("LibraryScanner");
 
@@ -115,7 +135,7 @@ LibraryScanner::LibraryScanner(
     const int instanceId = s_instanceCounter.fetchAndAddAcquire(1) + 1;
     setObjectName(QString("LibraryScanner %1").arg(instanceId));
 
-    m_pool.setMaxThreadCount(kScannerThreadPoolSize);
+    m_pool.setMaxThreadCount(scannerThreadPoolSize(pConfig));
 
     // Listen to signals from our public methods (invoked by other threads) and
     // connect them to our slots to run the command on the scanner thread.
@@ -161,6 +181,10 @@ void LibraryScanner::run() {
     {
         Trace trace("LibraryScanner");
 
+        // All metadata imports run on this thread, their reads must not
+        // compete with the audio decoder for the disk.
+        mixxx::BackgroundIo::lowerCurrentThreadDiskPriority();
+
         const mixxx::DbConnectionPooler dbConnectionPooler(m_pDbConnectionPool);
         QSqlDatabase dbConnection = mixxx::DbConnectionPooled(m_pDbConnectionPool);
         if (!dbConnection.isOpen()) {
@@ -645,11 +669,20 @@ void LibraryScanner::slotAddNewTrack(const QString& trackPath) {
         // Simply abort here does the trick.
         return;
     }
+    // Park the metadata import while a deck is audible, if enabled.
+    // Queued addNewTrack() signals simply pile up in the event queue
+    // meanwhile. Cancelling the scan aborts the wait.
+    mixxx::BackgroundIo::throttle([this] {
+        return !m_scannerGlobal || m_scannerGlobal->shouldCancel();
+    });
     ScopedTimer timer(QStringLiteral("LibraryScanner::addNewTrack"));
     // For statistics tracking and to detect moved tracks
     TrackPointer pTrack = m_trackDao.addTracksAddFile(
             trackPath,
             false);
+    // The imported file is not needed again soon, keep its pages from
+    // evicting the decoder's working set.
+    mixxx::BackgroundIo::dropFileFromPageCache(trackPath);
     if (!pTrack) {
         // This happens only when there is an issue with the database which
         // has been logged already. No need for yet another warning here.
@@ -7,6 +7,7 @@
 #include "library/scanner/importfilestask.h"
 #include "library/scanner/libraryscanner.h"
 #include "moc_recursivescandirectorytask.cpp"
+#include "util/backgroundio.h"
 #include "util/timer.h"
 
 RecursiveScanDirectoryTask::RecursiveScanDirectoryTask(
@@ -21,6 +22,12 @@ RecursiveScanDirectoryTask::RecursiveScanDirectoryTask(
 
 void RecursiveScanDirectoryTask::run() {
     ScopedTimer timer(QStringLiteral("RecursiveScanDirectoryTask::run"));
+    // The pool threads are reused, lowering the priority is a one-time
+    // operation per thread.
+    mixxx::BackgroundIo::lowerCurrentThreadDiskPriority();
+    mixxx::BackgroundIo::throttle([this] {
+        return m_scannerGlobal->shouldCancel();
+    });
     if (m_scannerGlobal->shouldCancel()) {
         setSuccess(false);
         return;
@@ -11,6 +11,11 @@
 
 namespace {
 
+// Upper bound for the memoized token classifications. Generously covers
+// the tokens of the query being typed including all of its intermediate
+// editing states.
+constexpr int kMaxCachedTokenClassifications = 1024;
+
 enum class Quoted : bool {
     Incomplete,
     Complete,
@@ -190,6 +195,44 @@ SearchQueryParser::TextArgumentResult SearchQueryParser::getTextArgument(QString
     return {argument, mode};
 }
 
+SearchQueryParser::TokenClassification SearchQueryParser::classifyToken(
+        const QString& token) const {
+    const auto it = m_tokenClassificationCache.constFind(token);
+    if (it != m_tokenClassificationCache.constEnd()) {
+        return *it;
+    }
+    TokenClassification classification{
+            TokenClassification::Kind::PlainTerm, QString(), QString()};
+    const QRegularExpressionMatch textFilterMatch = m_textFilterMatcher.match(token);
+    if (textFilterMatch.hasMatch()) {
+        classification = {TokenClassification::Kind::TextFilter,
+                textFilterMatch.captured(1),
+                textFilterMatch.captured(2)};
+    } else {
+        const QRegularExpressionMatch numericFilterMatch = m_numericFilterMatcher.match(token);
+        if (numericFilterMatch.hasMatch()) {
+            classification = {TokenClassification::Kind::NumericFilter,
+                    numericFilterMatch.captured(1),
+                    numericFilterMatch.captured(2)};
+        } else {
+            const QRegularExpressionMatch specialFilterMatch = m_specialFilterMatcher.match(token);
+            if (specialFilterMatch.hasMatch()) {
+                classification = {TokenClassification::Kind::SpecialFilter,
+                        specialFilterMatch.captured(1),
+                        specialFilterMatch.captured(2)};
+            }
+        }
+    }
+    // The cache only needs to cover the tokens of the query currently
+    // being typed; flushing it entirely when it grows beyond that keeps
+    // it from accumulating every token ever searched for.
+    if (m_tokenClassificationCache.size() >= kMaxCachedTokenClassifications) {
+        m_tokenClassificationCache.clear();
+    }
+    m_tokenClassificationCache.insert(token, classification);
+    return classification;
+}
+
 void SearchQueryParser::parseTokens(QStringList tokens,
                                     AndNode* pQuery) const {
     while (tokens.size() > 0) {
@@ -201,12 +244,10 @@ void SearchQueryParser::parseTokens(QStringList tokens,
         bool negate = token.startsWith(kNegatePrefix);
         std::unique_ptr<QueryNode> pNode;
 
-        const QRegularExpressionMatch textFilterMatch = m_textFilterMatcher.match(token);
-        const QRegularExpressionMatch numericFilterMatch = m_numericFilterMatcher.match(token);
-        const QRegularExpressionMatch specialFilterMatch = m_specialFilterMatcher.match(token);
-        if (textFilterMatch.hasMatch()) {
-            QString field = textFilterMatch.captured(1);
-            auto [argument, matchMode] = getTextArgument(textFilterMatch.captured(2), &tokens);
+        const TokenClassification classification = classifyToken(token);
+        if (classification.kind == TokenClassification::Kind::TextFilter) {
+            const QString& field = classification.field;
+            auto [argument, matchMode] = getTextArgument(classification.argument, &tokens);
 
             if (argument == kMissingFieldSearchTerm) {
                 qDebug() << "argument explicit empty";
@@ -231,9 +272,9 @@ void SearchQueryParser::parseTokens(QStringList tokens,
                             matchMode);
                 }
             }
-        } else if (numericFilterMatch.hasMatch()) {
-            QString field = numericFilterMatch.captured(1);
-            QString argument = getTextArgument(numericFilterMatch.captured(2), &tokens).argument;
+        } else if (classification.kind == TokenClassification::Kind::NumericFilter) {
+            const QString& field = classification.field;
+            QString argument = getTextArgument(classification.argument, &tokens).argument;
 
             if (!argument.isEmpty()) {
                 if (argument == kMissingFieldSearchTerm) {
@@ -244,12 +285,12 @@ void SearchQueryParser::parseTokens(QStringList tokens,
                          m_fieldToSqlColumns[field], argument);
                 }
             }
-        } else if (specialFilterMatch.hasMatch()) {
+        } else if (classification.kind == TokenClassification::Kind::SpecialFilter) {
             bool fuzzy = token.startsWith(kFuzzyPrefix);
             bool negate = token.startsWith(kNegatePrefix);
-            QString field = specialFilterMatch.captured(1);
+            QString field = classification.field;
             auto [argument, matchMode] = getTextArgument(
-                    specialFilterMatch.captured(2), &tokens);
+                    classification.argument, &tokens);
 
             if (!argument.isEmpty()) {
                 if (field == "key") {
@@ -376,6 +417,57 @@ QStringList SearchQueryParser::splitQueryIntoWords(const QString& query) {
     return queryWordList;
 }
 
+bool SearchQueryParser::queryIsRefinement(const QString& previous, const QString& current) {
+    const QStringList previousWords = splitQueryIntoWords(previous);
+    const QStringList currentWords = splitQueryIntoWords(current);
+
+    if (previousWords.isEmpty()) {
+        // An unfiltered previous result set covers the whole table and
+        // reusing it as a candidate set would not narrow anything down.
+        return false;
+    }
+
+    // Only plain conjunctive text terms qualify. Appending characters to
+    // a negated term, an OR group, a fuzzy term or a field filter (e.g.
+    // bpm:<120) may widen the matched set instead of narrowing it.
+    const auto isPlainTextTerm = [](const QString& word) {
+        return !word.startsWith(QChar('-')) &&
+                !word.startsWith(QChar('~')) &&
+                !word.contains(QChar(':')) &&
+                !word.contains(QChar('|')) &&
+                word != QStringLiteral("OR");
+    };
+    for (const QString& word : previousWords) {
+        if (!isPlainTextTerm(word)) {
+            return false;
+        }
+    }
+    for (const QString& word : currentWords) {
+        if (!isPlainTextTerm(word)) {
+            return false;
+        }
+    }
+
+    // Every previous term must be contained in at least one current term.
+    // Then any row that matches all current terms (substring matching is
+    // case insensitive) also matches all previous terms, i.e. the current
+    // result set is a subset of the previous one. Additional current
+    // terms only narrow the conjunction further.
+    for (const QString& previousWord : previousWords) {
+        bool contained = false;
+        for (const QString& currentWord : currentWords) {
+            if (currentWord.contains(previousWord, Qt::CaseInsensitive)) {
+                contained = true;
+                break;
+            }
+        }
+        if (!contained) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool SearchQueryParser::queryIsLessSpecific(const QString& original, const QString& changed) {
     // separate search query into tokens
     QStringList oldWordList = SearchQueryParser::splitQueryIntoWords(original);
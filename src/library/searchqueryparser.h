@@ -1,5 +1,6 @@
 #pragma once
 
+#include <QHash>
 #include <QRegularExpression>
 #include <QString>
 #include <memory>
@@ -25,6 +26,15 @@ class SearchQueryParser {
     static QStringList splitQueryIntoWords(const QString& query);
     /// checks if the changed search query is less specific then the original term
     static bool queryIsLessSpecific(const QString& original, const QString& changed);
+    /// Checks if the current search query is guaranteed to match only a
+    /// subset of the rows matched by the previous query, i.e. whether the
+    /// previous result set can be reused as the candidate set for the
+    /// current query. Unlike queryIsLessSpecific() this is a conservative
+    /// predicate that is safe for filtering: it only considers plain
+    /// conjunctive text terms and returns false for any query containing
+    /// operators (negation, OR, fuzzy matching or field filters) whose
+    /// matched set may grow when characters are appended.
+    static bool queryIsRefinement(const QString& previous, const QString& current);
 
   private:
     void parseTokens(QStringList tokens,
@@ -42,6 +52,25 @@ class SearchQueryParser {
             QStringList* tokens,
             bool removeLeadingEqualsSign = true) const;
 
+    /// Result of matching one raw token against the filter matchers.
+    /// The classification of a token is a pure function of the token
+    /// text, so it is memoized: while typing, all tokens except the one
+    /// being edited hit the cache and skip the regular expression
+    /// matching entirely.
+    struct TokenClassification {
+        enum class Kind {
+            PlainTerm,
+            TextFilter,
+            NumericFilter,
+            SpecialFilter,
+        };
+        Kind kind;
+        QString field;
+        QString argument;
+    };
+
+    TokenClassification classifyToken(const QString& token) const;
+
     TrackCollection* m_pTrackCollection;
     QStringList m_queryColumns;
     bool m_searchCrates;
@@ -55,5 +84,7 @@ class SearchQueryParser {
     QRegularExpression m_numericFilterMatcher;
     QRegularExpression m_specialFilterMatcher;
 
+    mutable QHash<QString, TokenClassification> m_tokenClassificationCache;
+
     DISALLOW_COPY_AND_ASSIGN(SearchQueryParser);
 };
@@ -98,6 +98,7 @@ void SidebarModel::activateDefaultSelection() {
             static_cast<unsigned int>(m_sFeatures.size())) {
         emit selectIndex(getDefaultSelection(), true /* scrollTo */);
         // Selecting an index does not activate it.
+        m_sFeatures[m_iDefaultSelectedIndex]->ensureInitialized();
         m_sFeatures[m_iDefaultSelectedIndex]->activate();
     }
 }
@@ -355,12 +356,14 @@ void SidebarModel::clicked(const QModelIndex& index) {
     stopPressedUntilClickedTimer();
     if (index.isValid()) {
         if (index.internalPointer() == this) {
+            m_sFeatures[index.row()]->ensureInitialized();
             m_sFeatures[index.row()]->activate();
         } else {
             TreeItem* pTreeItem = static_cast<TreeItem*>(index.internalPointer());
             if (pTreeItem) {
                 LibraryFeature* pFeature = pTreeItem->feature();
                 DEBUG_ASSERT(pFeature);
+                pFeature->ensureInitialized();
                 pFeature->activateChild(index);
             }
         }
@@ -377,6 +380,7 @@ void SidebarModel::doubleClicked(const QModelIndex& index) {
             TreeItem* pTreeItem = static_cast<TreeItem*>(index.internalPointer());
             if (pTreeItem) {
                 LibraryFeature* pFeature = pTreeItem->feature();
+                pFeature->ensureInitialized();
                 pFeature->onLazyChildExpandation(index);
             }
         }
@@ -387,11 +391,13 @@ void SidebarModel::rightClicked(const QPoint& globalPos, const QModelIndex& inde
     stopPressedUntilClickedTimer();
     if (index.isValid()) {
         if (index.internalPointer() == this) {
+            m_sFeatures[index.row()]->ensureInitialized();
             m_sFeatures[index.row()]->onRightClick(globalPos);
         } else {
             TreeItem* pTreeItem = static_cast<TreeItem*>(index.internalPointer());
             if (pTreeItem) {
                 LibraryFeature* pFeature = pTreeItem->feature();
+                pFeature->ensureInitialized();
                 pFeature->onRightClickChild(globalPos, index);
             }
         }
@@ -446,6 +452,7 @@ bool SidebarModel::dropAccept(const QModelIndex& index, const QList<QUrl>& urls,
     }
 
     if (index.internalPointer() == this) {
+        m_sFeatures[index.row()]->ensureInitialized();
         return m_sFeatures[index.row()]->dropAccept(urls, pSource);
     } else {
         TreeItem* pTreeItem = static_cast<TreeItem*>(index.internalPointer());
@@ -453,6 +460,7 @@ bool SidebarModel::dropAccept(const QModelIndex& index, const QList<QUrl>& urls,
             return false;
         }
         LibraryFeature* pFeature = pTreeItem->feature();
+        pFeature->ensureInitialized();
         return pFeature->dropAcceptChild(index, urls, pSource);
     }
 }
@@ -217,7 +217,7 @@ void PreviewButtonDelegate::buttonClicked() {
     TrackPointer pOldTrack = PlayerInfo::instance().getTrackInfo(kPreviewDeckGroup);
 
     bool startedPlaying = false;
-    TrackPointer pTrack = pTrackModel->getTrack(m_currentEditedCellIndex);
+    TrackPointer pTrack = pTrackModel->getTrackForPreview(m_currentEditedCellIndex);
     if (pTrack && pTrack != pOldTrack) {
         // Load to preview deck and start playing
         emit loadTrackToPlayer(pTrack, kPreviewDeckGroup,
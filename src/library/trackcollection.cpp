@@ -80,11 +80,20 @@ void TrackCollection::connectDatabase(const QSqlDatabase& database) {
     m_crates.connectDatabase(database);
 }
 
+void TrackCollection::connectReadOnlyDatabase(const QSqlDatabase& database) {
+    DEBUG_ASSERT_QOBJECT_THREAD_AFFINITY(this);
+
+    kLogger.info() << "Connecting read-only database";
+    DEBUG_ASSERT(database.isOpen());
+    m_readOnlyDatabase = database;
+}
+
 void TrackCollection::disconnectDatabase() {
     DEBUG_ASSERT_QOBJECT_THREAD_AFFINITY(this);
 
     kLogger.info() << "Disconnecting database";
     m_database = QSqlDatabase();
+    m_readOnlyDatabase = QSqlDatabase();
     m_trackDao.finish();
     m_crates.disconnectDatabase();
 }
@@ -587,6 +596,13 @@ TrackPointer TrackCollection::getOrAddTrack(
     return m_trackDao.getOrAddTrack(trackRef, pAlreadyInLibrary);
 }
 
+TrackPointer TrackCollection::getOrCreatePreviewTrack(
+        const TrackRef& trackRef) {
+    DEBUG_ASSERT_QOBJECT_THREAD_AFFINITY(this);
+
+    return m_trackDao.getOrCreatePreviewTrack(trackRef);
+}
+
 TrackId TrackCollection::addTrack(
         const TrackPointer& pTrack,
         bool unremove) {
@@ -36,6 +36,8 @@ class TrackCollection : public QObject,
 
     void connectDatabase(
             const QSqlDatabase& database) override;
+    void connectReadOnlyDatabase(
+            const QSqlDatabase& database);
     void disconnectDatabase() override;
 
     QSqlDatabase database() const {
@@ -43,6 +45,19 @@ class TrackCollection : public QObject,
         return m_database;
     }
 
+    /// Returns a read-only connection to the database for GUI-driven
+    /// queries. Read-only connections read from a consistent WAL snapshot
+    /// and are never blocked by concurrent writers like the library
+    /// scanner. Falls back to the writable connection if no read-only
+    /// connection has been provided, e.g. in tests.
+    QSqlDatabase readOnlyDatabase() const {
+        DEBUG_ASSERT_QOBJECT_THREAD_AFFINITY(this);
+        if (m_readOnlyDatabase.isOpen()) {
+            return m_readOnlyDatabase;
+        }
+        return m_database;
+    }
+
     QList<mixxx::FileInfo> loadRootDirs(
             bool skipInvalidOrMissing = false) const;
     QStringList getRootDirStrings() const;
@@ -148,6 +163,8 @@ class TrackCollection : public QObject,
     TrackPointer getOrAddTrack(
             const TrackRef& trackRef,
             bool* pAlreadyInLibrary = nullptr);
+    TrackPointer getOrCreatePreviewTrack(
+            const TrackRef& trackRef);
     FRIEND_TEST(DirectoryDAOTest, relocateDirectory);
     FRIEND_TEST(TrackDAOTest, detectMovedTracks);
     TrackId addTrack(
@@ -168,6 +185,7 @@ class TrackCollection : public QObject,
     bool saveTrack(Track* pTrack) const;
 
     QSqlDatabase m_database;
+    QSqlDatabase m_readOnlyDatabase;
 
     PlaylistDAO m_playlistDao;
     CrateStorage m_crates;
@@ -2,6 +2,7 @@
 
 #include <utility>
 
+#include "database/dbmaintenance.h"
 #include "library/externaltrackcollection.h"
 #include "library/library_decl.h"
 #include "library/library_prefs.h"
@@ -22,6 +23,11 @@ const QString kConfigGroup = QStringLiteral("[TrackCollection]");
 
 const ConfigKey kConfigKeyRepairDatabaseOnNextRestart(kConfigGroup, "RepairDatabaseOnNextRestart");
 
+// Debounce interval for write-behind track saves. Long enough to
+// coalesce a burst of modifications, short enough that pending
+// changes do not survive unsaved for a noticeable amount of time.
+constexpr int kDeferredSaveTimeoutMillis = 500;
+
 inline
 parented_ptr<TrackCollection> createInternalTrackCollection(
         TrackCollectionManager* parent,
@@ -39,6 +45,7 @@ TrackCollectionManager::TrackCollectionManager(
         QObject* parent,
         UserSettingsPointer pConfig,
         mixxx::DbConnectionPoolPtr pDbConnectionPool,
+        mixxx::DbConnectionPoolPtr pReadOnlyDbConnectionPool,
         deleteTrackFn_t /*only-needed-for-testing*/ deleteTrackForTestingFn)
     : QObject(parent),
       m_pConfig(pConfig),
@@ -55,6 +62,29 @@ TrackCollectionManager::TrackCollectionManager(
 
     m_pInternalCollection->connectDatabase(dbConnection);
 
+    // GUI-driven queries read through a separate read-only connection
+    // that is never blocked by concurrent writers. Optional, tests and
+    // the batch analyzer only use the writable connection.
+    const QSqlDatabase readOnlyDbConnection =
+            mixxx::DbConnectionPooled(pReadOnlyDbConnectionPool);
+    if (readOnlyDbConnection.isOpen()) {
+        m_pInternalCollection->connectReadOnlyDatabase(readOnlyDbConnection);
+    }
+
+    m_deferredSaveTimer.setSingleShot(true);
+    connect(&m_deferredSaveTimer,
+            &QTimer::timeout,
+            this,
+            &TrackCollectionManager::flushDeferredTrackSaves);
+
+    if (deleteTrackForTestingFn) {
+        // Tests have neither a PlayerInfo instance for the playing
+        // state nor a long-lived database worth maintaining.
+        kLogger.info() << "Database maintenance is disabled in test mode";
+    } else {
+        m_pDbMaintenance = std::make_unique<DbMaintenance>(dbConnection);
+    }
+
     if (deleteTrackForTestingFn) {
         kLogger.info() << "External collections are disabled in test mode";
     } else {
@@ -147,6 +177,14 @@ TrackCollectionManager::~TrackCollectionManager() {
         m_pScanner.reset();
     }
 
+    // Stop scheduling maintenance slices before the database
+    // connection goes away.
+    m_pDbMaintenance.reset();
+
+    // Persist any pending write-behind saves while the database
+    // connection is still available.
+    flushDeferredTrackSaves();
+
     const auto pWeakTrackSource = m_pInternalCollection->disconnectTrackSource();
     VERIFY_OR_DEBUG_ASSERT(pWeakTrackSource.isNull()) {
         kLogger.warning() << "BaseTrackCache is still in use";
@@ -202,6 +240,45 @@ TrackCollectionManager::SaveTrackResult TrackCollectionManager::saveTrack(
     return res;
 }
 
+void TrackCollectionManager::saveTrackDeferred(TrackPointer pTrack) {
+    DEBUG_ASSERT_QOBJECT_THREAD_AFFINITY(this);
+    VERIFY_OR_DEBUG_ASSERT(pTrack) {
+        return;
+    }
+    if (!pTrack->getId().isValid()) {
+        // Tracks that are not (or no longer) in the library cannot be
+        // coalesced by their id. Save them immediately instead.
+        saveTrack(pTrack);
+        return;
+    }
+    // Coalesce repeated requests per track. Keeping the TrackPointer
+    // in the queue also keeps the track cached, so it cannot be
+    // evicted and saved through saveEvictedTrack() before the flush.
+    m_deferredSaveTracks.insert(pTrack->getId(), std::move(pTrack));
+    // Restart the timer so that a burst of modifications results in
+    // a single flush after the burst has settled.
+    m_deferredSaveTimer.start(kDeferredSaveTimeoutMillis);
+}
+
+void TrackCollectionManager::flushDeferredTrackSaves() {
+    DEBUG_ASSERT_QOBJECT_THREAD_AFFINITY(this);
+    m_deferredSaveTimer.stop();
+    if (m_deferredSaveTracks.isEmpty()) {
+        return;
+    }
+    const auto deferredSaveTracks =
+            std::exchange(m_deferredSaveTracks, {});
+    if (kLogger.debugEnabled()) {
+        kLogger.debug()
+                << "Flushing"
+                << deferredSaveTracks.size()
+                << "deferred track save(s)";
+    }
+    for (const auto& pTrack : deferredSaveTracks) {
+        saveTrack(pTrack.get(), TrackMetadataExportMode::Deferred);
+    }
+}
+
 // Export metadata and save the track in both the internal database
 // and external libraries.
 void TrackCollectionManager::saveEvictedTrack(Track* pTrack) noexcept {
@@ -502,6 +579,15 @@ TrackPointer TrackCollectionManager::getOrAddTrack(
     return pTrack;
 }
 
+TrackPointer TrackCollectionManager::getOrCreatePreviewTrack(
+        const TrackRef& trackRef) const {
+    DEBUG_ASSERT_QOBJECT_THREAD_AFFINITY(this);
+
+    // Nothing is added to the internal collection, so external
+    // collections must not be notified either.
+    return m_pInternalCollection->getOrCreatePreviewTrack(trackRef);
+}
+
 void TrackCollectionManager::afterTrackAdded(const TrackPointer& pTrack) const {
     DEBUG_ASSERT(pTrack);
     DEBUG_ASSERT(pTrack->getDateAdded().isValid());
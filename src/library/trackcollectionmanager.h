@@ -1,8 +1,10 @@
 #pragma once
 
 #include <QDir>
+#include <QHash>
 #include <QList>
 #include <QSet>
+#include <QTimer>
 #include <memory>
 
 #include "library/dao/directorydao.h"
@@ -12,6 +14,7 @@
 #include "util/parented_ptr.h"
 #include "util/thread_affinity.h"
 
+class DbMaintenance;
 class LibraryScanner;
 class TrackCollection;
 class ExternalTrackCollection;
@@ -35,6 +38,7 @@ class TrackCollectionManager: public QObject,
             QObject* parent,
             UserSettingsPointer pConfig,
             mixxx::DbConnectionPoolPtr pDbConnectionPool,
+            mixxx::DbConnectionPoolPtr pReadOnlyDbConnectionPool = nullptr,
             deleteTrackFn_t deleteTrackForTestingFn = nullptr);
     ~TrackCollectionManager() override;
 
@@ -86,6 +90,12 @@ class TrackCollectionManager: public QObject,
             const TrackRef& trackRef,
             bool* pAlreadyInLibrary = nullptr) const;
 
+    // Like getOrAddTrack(), but tracks that are not in the library are
+    // resolved through the GlobalTrackCache without being added, i.e.
+    // without any database writes. See TrackDAO::getOrCreatePreviewTrack().
+    TrackPointer getOrCreatePreviewTrack(
+            const TrackRef& trackRef) const;
+
     // Save the track in both the internal database and external collections.
     // Export of metadata is deferred until the track is evicted from the
     // cache to prevent file corruption due to concurrent access.
@@ -95,6 +105,20 @@ class TrackCollectionManager: public QObject,
         Failed,
     };
     SaveTrackResult saveTrack(const TrackPointer& pTrack) const;
+
+    // Write-behind variant of saveTrack(): the track is queued and
+    // persisted slightly deferred, coalescing repeated save requests
+    // for the same track into a single database update. Use this for
+    // bursts of small modifications where a synchronous write per
+    // request would stall the caller. The queued TrackPointer keeps
+    // the track cached until the queue has been flushed.
+    void saveTrackDeferred(TrackPointer pTrack);
+
+    // Synchronously persists all tracks with pending deferred saves.
+    // Invoked automatically after the debounce timeout and before the
+    // database connection is dropped on shutdown.
+    void flushDeferredTrackSaves();
+
     // Same as startLibraryScan() but don't emit the scan summary.
     void startLibraryAutoScan();
 
@@ -135,4 +159,11 @@ class TrackCollectionManager: public QObject,
 
     // TODO: Extract and decouple LibraryScanner from TrackCollectionManager
     std::unique_ptr<LibraryScanner> m_pScanner;
+
+    // Token-bucketed online database maintenance during idle periods
+    std::unique_ptr<DbMaintenance> m_pDbMaintenance;
+
+    // Tracks with pending write-behind saves, coalesced per TrackId.
+    QHash<TrackId, TrackPointer> m_deferredSaveTracks;
+    QTimer m_deferredSaveTimer;
 };
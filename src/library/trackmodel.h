@@ -110,6 +110,15 @@ class TrackModel {
     virtual TrackPointer getTrack(const QModelIndex& index) const = 0;
     virtual TrackPointer getTrackByRef(const TrackRef& trackRef) const = 0;
 
+    /// Deserialize and return the track at the given QModelIndex for
+    /// loading it into the preview deck. Models that browse files outside
+    /// of the library may override this to resolve an ephemeral track
+    /// object without implicitly adding the file to the library like
+    /// getTrack() does.
+    virtual TrackPointer getTrackForPreview(const QModelIndex& index) const {
+        return getTrack(index);
+    }
+
     /// Get the URL of the track at the given QModelIndex.
     ///
     /// This function should be used in favor of getTrackId() to allow
@@ -0,0 +1,197 @@
+#include "library/trackoperationjournal.h"
+
+#include <QHash>
+
+#include "library/trackcollectionmanager.h"
+#include "library/trackprocessing.h"
+#include "moc_trackoperationjournal.cpp"
+#include "track/cue.h"
+#include "track/track.h"
+#include "track/trackiterator.h"
+#include "util/assert.h"
+#include "util/logger.h"
+
+namespace mixxx {
+
+namespace {
+
+const Logger kLogger("TrackOperationJournal");
+
+// Upper bound for the number of journaled gestures. Each entry holds a
+// metadata snapshot of every affected track, so the journal depth is
+// kept small to bound the memory usage after large batch edits.
+constexpr int kMaxJournalDepth = 10;
+
+} // anonymous namespace
+
+class TrackOperationJournal::RestoreOperation
+        : public TrackPointerOperation {
+  public:
+    RestoreOperation(
+            TrackOperationJournal* pJournal,
+            const JournalEntry& entry)
+            : m_pJournal(pJournal) {
+        m_trackStatesById.reserve(entry.trackStates.size());
+        for (const TrackStateSnapshot& state : entry.trackStates) {
+            m_trackStatesById.insert(state.trackId, &state);
+        }
+    }
+
+  private:
+    void doApply(
+            const TrackPointer& pTrack) const override {
+        const auto it = m_trackStatesById.constFind(pTrack->getId());
+        VERIFY_OR_DEBUG_ASSERT(it != m_trackStatesById.constEnd()) {
+            return;
+        }
+        // Record the current state as the inverse, i.e. as the
+        // redo of the gesture that is being undone.
+        m_pJournal->recordTrackState(pTrack);
+        restoreTrackState(*it.value(), pTrack);
+    }
+
+    TrackOperationJournal* const m_pJournal;
+    QHash<TrackId, const TrackStateSnapshot*> m_trackStatesById;
+};
+
+TrackOperationJournal::TrackOperationJournal(QObject* parent)
+        : QObject(parent),
+          m_gestureOpen(false) {
+}
+
+void TrackOperationJournal::beginGesture(const QString& labelText) {
+    DEBUG_ASSERT(!m_gestureOpen);
+    m_pendingEntry = JournalEntry{};
+    m_pendingEntry.labelText = labelText;
+    m_gestureOpen = true;
+}
+
+void TrackOperationJournal::recordTrackState(const TrackPointer& pTrack) {
+    VERIFY_OR_DEBUG_ASSERT(m_gestureOpen) {
+        return;
+    }
+    VERIFY_OR_DEBUG_ASSERT(pTrack) {
+        return;
+    }
+    TrackStateSnapshot state;
+    state.trackId = pTrack->getId();
+    if (!state.trackId.isValid()) {
+        // Tracks without an id cannot be reloaded for undoing
+        return;
+    }
+    state.record = pTrack->getRecord();
+    state.pBeats = pTrack->getBeats();
+    state.sampleRate = pTrack->getSampleRate();
+    if (state.sampleRate.isValid()) {
+        const QList<CuePointer> cuePoints = pTrack->getCuePoints();
+        state.cueInfos.reserve(cuePoints.size());
+        for (const CuePointer& pCue : cuePoints) {
+            state.cueInfos.append(pCue->getCueInfo(state.sampleRate));
+        }
+        state.cuesSnapshotted = true;
+    }
+    m_pendingEntry.trackStates.append(std::move(state));
+}
+
+void TrackOperationJournal::commitGesture() {
+    VERIFY_OR_DEBUG_ASSERT(m_gestureOpen) {
+        return;
+    }
+    m_gestureOpen = false;
+    if (m_pendingEntry.trackStates.isEmpty()) {
+        // Nothing has been modified, e.g. the operation has been
+        // aborted before processing the first track.
+        return;
+    }
+    m_entries.append(std::move(m_pendingEntry));
+    m_pendingEntry = JournalEntry{};
+    while (m_entries.size() > kMaxJournalDepth) {
+        m_entries.removeFirst();
+    }
+    emit journalChanged();
+}
+
+QString TrackOperationJournal::undoActionText() const {
+    if (m_entries.isEmpty()) {
+        return QString();
+    }
+    const JournalEntry& entry = m_entries.last();
+    if (entry.isUndo) {
+        return tr("Redo: %1").arg(entry.labelText);
+    }
+    return tr("Undo: %1").arg(entry.labelText);
+}
+
+int TrackOperationJournal::undo(TrackCollectionManager* pTrackCollectionManager) {
+    VERIFY_OR_DEBUG_ASSERT(pTrackCollectionManager) {
+        return 0;
+    }
+    if (m_entries.isEmpty()) {
+        return 0;
+    }
+    const JournalEntry entry = m_entries.takeLast();
+
+    // Resolve the affected tracks before restoring anything. Tracks
+    // that have been purged from the library in the meantime are
+    // silently skipped.
+    TrackPointerList trackPointers;
+    trackPointers.reserve(entry.trackStates.size());
+    for (const TrackStateSnapshot& state : entry.trackStates) {
+        const TrackPointer pTrack =
+                pTrackCollectionManager->getTrackById(state.trackId);
+        if (pTrack) {
+            trackPointers.append(pTrack);
+        } else {
+            kLogger.info()
+                    << "Skipping purged track"
+                    << state.trackId
+                    << "while undoing"
+                    << entry.labelText;
+        }
+    }
+
+    // The undo is journaled itself with the inverted direction, so
+    // that undoing it redoes the gesture.
+    beginGesture(entry.labelText);
+    m_pendingEntry.isUndo = !entry.isUndo;
+
+    RestoreOperation restoreOperation(this, entry);
+    ModalTrackBatchOperationProcessor processor(
+            &restoreOperation,
+            ModalTrackBatchOperationProcessor::Mode::ApplyAndSave);
+    TrackPointerListIterator trackPointerIterator(trackPointers);
+    const int restoredTrackCount = processor.processTracks(
+            entry.isUndo
+                    ? tr("Redoing: %1").arg(entry.labelText)
+                    : tr("Undoing: %1").arg(entry.labelText),
+            pTrackCollectionManager,
+            &trackPointerIterator);
+    commitGesture();
+    emit journalChanged();
+    return restoredTrackCount;
+}
+
+// static
+void TrackOperationJournal::restoreTrackState(
+        const TrackStateSnapshot& state,
+        const TrackPointer& pTrack) {
+    pTrack->replaceRecord(state.record, state.pBeats);
+    if (!state.pBeats) {
+        // replaceRecord() keeps the current beats when none are given,
+        // but the snapshot has been taken without any.
+        pTrack->trySetBeats(nullptr);
+    }
+    if (state.cuesSnapshotted) {
+        QList<CuePointer> cuePoints;
+        cuePoints.reserve(state.cueInfos.size());
+        for (const CueInfo& cueInfo : state.cueInfos) {
+            cuePoints.append(CuePointer(new Cue(
+                    cueInfo,
+                    state.sampleRate,
+                    /*setDirty*/ true)));
+        }
+        pTrack->setCuePoints(cuePoints);
+    }
+}
+
+} // namespace mixxx
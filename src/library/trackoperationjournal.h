@@ -0,0 +1,115 @@
+/// Journal of reversible bulk edits applied to library tracks.
+
+#pragma once
+
+#include <QList>
+#include <QObject>
+#include <QString>
+
+#include "audio/types.h"
+#include "track/beats.h"
+#include "track/cueinfo.h"
+#include "track/track_decl.h"
+#include "track/trackid.h"
+#include "track/trackrecord.h"
+
+class TrackCollectionManager;
+
+namespace mixxx {
+
+/// Selects whether a bulk edit is captured in the journal.
+enum class JournalMode {
+    /// Snapshot the affected tracks so that the gesture can be undone.
+    Journaled,
+
+    /// The gesture has side effects outside of the track objects (files
+    /// on disk, analysis data) that a snapshot cannot restore. It is
+    /// executed without journaling.
+    NotJournaled,
+};
+
+/// Journal for undoing bulk library edits gesture by gesture.
+///
+/// Every gesture (one context menu action or one apply of the batch
+/// property editor) is recorded as a single journal entry that holds a
+/// snapshot of the metadata, beats and cues of each affected track,
+/// taken immediately before the edit. Undoing restores the snapshots of
+/// the most recent entry as one batch with the same modal progress
+/// handling as the forward operation. The undo itself is journaled
+/// again, so undoing an undo redoes the original gesture.
+///
+/// All methods must be called from the main thread.
+class TrackOperationJournal : public QObject {
+    Q_OBJECT
+
+  public:
+    explicit TrackOperationJournal(QObject* parent = nullptr);
+    ~TrackOperationJournal() override = default;
+
+    /// Opens a new gesture. Track states recorded afterwards belong to
+    /// this gesture until it is committed.
+    void beginGesture(const QString& labelText);
+
+    /// Snapshots the current state of the given track into the pending
+    /// gesture. Must be called before the track is modified.
+    void recordTrackState(const TrackPointer& pTrack);
+
+    /// Closes the pending gesture and adds it to the journal if any
+    /// track state has been recorded. The oldest entry is dropped when
+    /// the journal exceeds its depth limit.
+    void commitGesture();
+
+    bool canUndo() const {
+        return !m_entries.isEmpty();
+    }
+
+    /// Text for an undo menu action describing the most recent
+    /// journaled gesture, e.g. "Undo: Resetting keys of 13 tracks".
+    /// Returns an empty string if the journal is empty.
+    QString undoActionText() const;
+
+    /// Restores the snapshots of the most recent journaled gesture and
+    /// removes the entry from the journal. Returns the number of
+    /// restored tracks.
+    int undo(TrackCollectionManager* pTrackCollectionManager);
+
+  signals:
+    /// Emitted whenever the result of canUndo() or undoActionText()
+    /// may have changed.
+    void journalChanged();
+
+  private:
+    struct TrackStateSnapshot {
+        TrackId trackId;
+        TrackRecord record;
+        BeatsPointer pBeats;
+        QList<CueInfo> cueInfos;
+        audio::SampleRate sampleRate;
+        // Cues can only be snapshotted (and restored) with a valid
+        // sample rate for the position conversion.
+        bool cuesSnapshotted{false};
+    };
+
+    struct JournalEntry {
+        QString labelText;
+        // Entries recorded by undo() describe a redo of the
+        // original gesture.
+        bool isUndo{false};
+        QList<TrackStateSnapshot> trackStates;
+    };
+
+    /// Applies the snapshots of a journal entry to the loaded tracks
+    /// while recording the inverse into the pending gesture.
+    class RestoreOperation;
+
+    static void restoreTrackState(
+            const TrackStateSnapshot& state,
+            const TrackPointer& pTrack);
+
+    QList<JournalEntry> m_entries;
+
+    JournalEntry m_pendingEntry;
+    bool m_gestureOpen;
+};
+
+} // namespace mixxx
@@ -67,7 +67,9 @@ int ModalTrackBatchProcessor::processTracks(
         case ProcessNextTrackResult::ContinueProcessing:
             break;
         case ProcessNextTrackResult::SaveTrackAndContinueProcessing:
-            pTrackCollectionManager->saveTrack(pTrack);
+            // Write-behind to avoid a synchronous database update per
+            // track while iterating over the whole batch.
+            pTrackCollectionManager->saveTrackDeferred(pTrack);
             break;
         }
         ++finishedTrackCount;
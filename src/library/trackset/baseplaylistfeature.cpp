@@ -747,44 +747,60 @@ void BasePlaylistFeature::htmlLinkClicked(const QUrl& link) {
     }
 }
 
-QString BasePlaylistFeature::fetchPlaylistLabel(int playlistId) {
+QHash<int, QString> BasePlaylistFeature::fetchPlaylistLabels(
+        const QSet<int>& playlistIds) {
+    QHash<int, QString> labels;
+    if (playlistIds.isEmpty()) {
+        return labels;
+    }
     // This queries the temporary id/count/duration table that was has been created
-    // by the features' createPlaylistLabels() (updated each time playlists are added/removed)
+    // by the features' createPlaylistLabels() (updated each time playlists are
+    // added/removed). All requested labels are fetched with a single query in
+    // order to avoid one database round trip per playlist.
     QSqlDatabase database =
             m_pLibrary->trackCollectionManager()->internalCollection()->database();
     VERIFY_OR_DEBUG_ASSERT(database.tables(QSql::Views).contains(m_countsDurationTableName)) {
         qWarning() << "BasePlaylistFeature: view" << m_countsDurationTableName
-                   << "does not exist! Can't fetch label for playlist" << playlistId;
-        return QString();
+                   << "does not exist! Can't fetch playlist labels";
+        return labels;
+    }
+    QStringList idStrings;
+    idStrings.reserve(playlistIds.size());
+    for (const int playlistId : playlistIds) {
+        idStrings.append(QString::number(playlistId));
     }
     QSqlTableModel playlistTableModel(this, database);
     playlistTableModel.setTable(m_countsDurationTableName);
-    const QString filter = "id=" + QString::number(playlistId);
+    const QString filter = "id IN (" + idStrings.join(',') + ')';
     playlistTableModel.setFilter(filter);
     playlistTableModel.select();
     while (playlistTableModel.canFetchMore()) {
         playlistTableModel.fetchMore();
     }
     QSqlRecord record = playlistTableModel.record();
+    int idColumn = record.indexOf("id");
     int nameColumn = record.indexOf("name");
     int countColumn = record.indexOf("count");
     int durationColumn = record.indexOf("durationSeconds");
 
-    DEBUG_ASSERT(playlistTableModel.rowCount() <= 1);
-    if (playlistTableModel.rowCount() > 0) {
+    for (int row = 0; row < playlistTableModel.rowCount(); ++row) {
+        int id = playlistTableModel
+                         .data(playlistTableModel.index(row, idColumn))
+                         .toInt();
         QString name =
-                playlistTableModel.data(playlistTableModel.index(0, nameColumn))
+                playlistTableModel
+                        .data(playlistTableModel.index(row, nameColumn))
                         .toString();
         int count = playlistTableModel
-                            .data(playlistTableModel.index(0, countColumn))
+                            .data(playlistTableModel.index(row, countColumn))
                             .toInt();
         int duration =
                 playlistTableModel
-                        .data(playlistTableModel.index(0, durationColumn))
+                        .data(playlistTableModel.index(row, durationColumn))
                         .toInt();
-        return createPlaylistLabel(name, count, duration);
+        labels.insert(id, createPlaylistLabel(name, count, duration));
     }
-    return QString();
+    return labels;
 }
 
 void BasePlaylistFeature::updateChildModel(const QSet<int>& playlistIds) {
@@ -795,8 +811,8 @@ void BasePlaylistFeature::updateChildModel(const QSet<int>& playlistIds) {
     }
 
     int id = kInvalidPlaylistId;
-    QString label;
     bool ok = false;
+    const QHash<int, QString> labels = fetchPlaylistLabels(playlistIds);
 
     for (int row = 0; row < m_pSidebarModel->rowCount(); ++row) {
         QModelIndex index = m_pSidebarModel->index(row, 0);
@@ -806,8 +822,7 @@ void BasePlaylistFeature::updateChildModel(const QSet<int>& playlistIds) {
             for (TreeItem* pChild : pTreeItem->children()) {
                 id = pChild->getData().toInt(&ok);
                 if (ok && id != kInvalidPlaylistId && playlistIds.contains(id)) {
-                    label = fetchPlaylistLabel(id);
-                    pChild->setLabel(label);
+                    pChild->setLabel(labels.value(id));
                     decorateChild(pChild, id);
                     markTreeItem(pChild);
                 }
@@ -815,8 +830,7 @@ void BasePlaylistFeature::updateChildModel(const QSet<int>& playlistIds) {
         } else {
             id = pTreeItem->getData().toInt(&ok);
             if (ok && id != kInvalidPlaylistId && playlistIds.contains(id)) {
-                label = fetchPlaylistLabel(id);
-                pTreeItem->setLabel(label);
+                pTreeItem->setLabel(labels.value(id));
                 decorateChild(pTreeItem, id);
                 markTreeItem(pTreeItem);
             }
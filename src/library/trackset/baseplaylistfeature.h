@@ -1,5 +1,6 @@
 #pragma once
 
+#include <QHash>
 #include <QModelIndex>
 #include <QPointer>
 #include <QSet>
@@ -140,7 +141,7 @@ class BasePlaylistFeature : public BaseTrackSetFeature {
     void connectPlaylistDAO();
     virtual QString getRootViewHtml() const = 0;
     void markTreeItem(TreeItem* pTreeItem);
-    QString fetchPlaylistLabel(int playlistId);
+    QHash<int, QString> fetchPlaylistLabels(const QSet<int>& playlistIds);
 
 
     const bool m_keepHiddenTracks;
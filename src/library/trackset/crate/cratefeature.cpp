@@ -587,17 +587,19 @@ QModelIndex CrateFeature::rebuildChildModel(CrateId selectedCrateId) {
 }
 
 void CrateFeature::updateChildModel(const QSet<CrateId>& updatedCrateIds) {
-    const CrateStorage& crateStorage = m_pTrackCollection->crates();
-    for (const CrateId& crateId : updatedCrateIds) {
-        QModelIndex index = indexFromCrateId(crateId);
+    // Fetch all updated summaries with a single query instead of one
+    // query per crate. Library change signals may affect hundreds of
+    // crates at once and the per-crate round trips used to dominate the
+    // update time for large sidebars.
+    CrateSummarySelectResult crateSummaries(
+            m_pTrackCollection->crates().selectCrateSummariesByIds(
+                    updatedCrateIds));
+    CrateSummary crateSummary;
+    while (crateSummaries.populateNext(&crateSummary)) {
+        QModelIndex index = indexFromCrateId(crateSummary.getId());
         VERIFY_OR_DEBUG_ASSERT(index.isValid()) {
             continue;
         }
-        CrateSummary crateSummary;
-        VERIFY_OR_DEBUG_ASSERT(
-                crateStorage.readCrateSummaryById(crateId, &crateSummary)) {
-            continue;
-        }
         updateTreeItemForCrateSummary(
                 m_pSidebarModel->getItem(index), crateSummary);
         m_pSidebarModel->triggerRepaint(index);
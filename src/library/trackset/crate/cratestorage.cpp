@@ -97,6 +97,21 @@ QString joinSqlStringList(const QList<TrackId>& trackIds) {
     return joinedTrackIds;
 }
 
+QString joinSqlStringList(const QSet<CrateId>& crateIds) {
+    QString joinedCrateIds;
+    // Reserve memory up front to prevent reallocation. Here we
+    // assume that all crate ids fit into 6 decimal digits and
+    // add 1 character for the list separator.
+    joinedCrateIds.reserve((6 + 1) * crateIds.size());
+    for (const auto& crateId : crateIds) {
+        if (!joinedCrateIds.isEmpty()) {
+            joinedCrateIds += kSqlListSeparator;
+        }
+        joinedCrateIds += crateId.toString();
+    }
+    return joinedCrateIds;
+}
+
 } // anonymous namespace
 
 CrateQueryFields::CrateQueryFields(const FwdSqlQuery& query)
@@ -373,6 +388,28 @@ CrateSummarySelectResult CrateStorage::selectCrateSummaries() const {
     }
 }
 
+CrateSummarySelectResult CrateStorage::selectCrateSummariesByIds(
+        const QSet<CrateId>& crateIds) const {
+    if (crateIds.isEmpty()) {
+        // edge case: no crates
+        return CrateSummarySelectResult();
+    }
+    FwdSqlQuery query(m_database,
+            mixxx::DbConnection::collateLexicographically(
+                    QStringLiteral("SELECT * FROM %1 "
+                                   "WHERE %2 IN (%3) "
+                                   "ORDER BY %4")
+                            .arg(CRATE_SUMMARY_VIEW,
+                                    CRATETABLE_ID,
+                                    joinSqlStringList(crateIds),
+                                    CRATETABLE_NAME)));
+    if (query.execPrepared()) {
+        return CrateSummarySelectResult(std::move(query));
+    } else {
+        return CrateSummarySelectResult();
+    }
+}
+
 bool CrateStorage::readCrateSummaryById(
         CrateId id, CrateSummary* pCrateSummary) const {
     FwdSqlQuery query(m_database,
@@ -334,6 +334,12 @@ class CrateStorage : public virtual /*implements*/ SqlStorage {
     //     - locale-aware
     CrateSummarySelectResult selectCrateSummaries() const; // all crates
 
+    // Track summaries of the given crates, fetched with a single query
+    // to avoid one database round trip per crate. The result list is
+    // ordered by crate name like selectCrateSummaries().
+    CrateSummarySelectResult selectCrateSummariesByIds(
+            const QSet<CrateId>& crateIds) const;
+
     // Omit the pCrate parameter for checking if the corresponding crate exists.
     bool readCrateSummaryById(CrateId id, CrateSummary* pCrateSummary = nullptr) const;
 
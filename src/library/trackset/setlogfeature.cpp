@@ -21,6 +21,12 @@
 
 namespace {
 constexpr int kNumToplevelHistoryEntries = 5;
+
+// Delay between marking a track played and appending it to the history
+// playlist. A track change coincides with the busiest moment of a
+// transition (waveform setup, cover loading), so the database insert is
+// deferred until the spike has passed.
+constexpr int kHistoryFlushDelayMillis = 5 * 1000;
 } // namespace
 
 using namespace mixxx::library::prefs;
@@ -105,11 +111,19 @@ SetlogFeature::SetlogFeature(
             this,
             &SetlogFeature::slotDeleteAllUnlockedChildPlaylists);
 
+    m_historyFlushTimer.setSingleShot(true);
+    m_historyFlushTimer.setInterval(kHistoryFlushDelayMillis);
+    connect(&m_historyFlushTimer,
+            &QTimer::timeout,
+            this,
+            &SetlogFeature::flushPendingHistoryAppends);
+
     // initialized in a new generic slot(get new history playlist purpose)
     slotGetNewPlaylist();
 }
 
 SetlogFeature::~SetlogFeature() {
+    flushPendingHistoryAppends();
     // Clean up history when shutting down in case the track threshold changed,
     // incl. potentially empty current playlist
     deleteAllUnlockedPlaylistsWithFewerTracks();
@@ -132,6 +146,8 @@ void SetlogFeature::bindLibraryWidget(
 }
 
 void SetlogFeature::deleteAllUnlockedPlaylistsWithFewerTracks() {
+    // Tracks still queued for the current playlist count towards its size
+    flushPendingHistoryAppends();
     ScopedTransaction transaction(m_pLibrary->trackCollectionManager()
                                           ->internalCollection()
                                           ->database());
@@ -360,6 +376,9 @@ void SetlogFeature::decorateChild(TreeItem* item, int playlistId) {
 void SetlogFeature::slotGetNewPlaylist() {
     //qDebug() << "slotGetNewPlaylist() successfully triggered !";
 
+    // Queued plays still belong to the playlist that is being finished
+    flushPendingHistoryAppends();
+
     // create a new playlist for today
     QString set_log_name_format;
     QString set_log_name;
@@ -396,6 +415,9 @@ void SetlogFeature::slotJoinWithPrevious() {
     if (!m_lastRightClickedIndex.isValid()) {
         return;
     }
+    // Queued plays must land in the playlist they were recorded for
+    // before its tracks are moved
+    flushPendingHistoryAppends();
 
     int clickedPlaylistId = playlistIdFromIndex(m_lastRightClickedIndex);
     if (clickedPlaylistId == kInvalidPlaylistId) {
@@ -631,6 +653,22 @@ void SetlogFeature::slotPlayingTrackChanged(TrackPointer currentPlayingTrack) {
         return;
     }
 
+    // Defer the actual history insert: it would otherwise run during
+    // the busiest moment of a transition. The queue is flushed once the
+    // spike has passed, or immediately when the current playlist is
+    // about to change.
+    m_pendingHistoryTrackIds.append(currentPlayingTrackId);
+    m_historyFlushTimer.start();
+}
+
+void SetlogFeature::flushPendingHistoryAppends() {
+    m_historyFlushTimer.stop();
+    if (m_pendingHistoryTrackIds.isEmpty()) {
+        return;
+    }
+    const QList<TrackId> trackIds = std::move(m_pendingHistoryTrackIds);
+    m_pendingHistoryTrackIds = QList<TrackId>();
+
     if (m_pPlaylistTableModel->getPlaylist() == m_currentPlaylistId) {
         // View needs a refresh
 
@@ -644,19 +682,24 @@ void SetlogFeature::slotPlayingTrackChanged(TrackPointer currentPlayingTrack) {
                 // while the song changes through autodj. The selection is then lost
                 // and dataloss occurs
                 hasActiveView = true;
-                const QList<TrackId> trackIds = view->getSelectedTrackIds();
-                m_pPlaylistTableModel->appendTrack(currentPlayingTrackId);
-                view->setSelectedTracks(trackIds);
+                const QList<TrackId> selectedTrackIds = view->getSelectedTrackIds();
+                for (const TrackId& trackId : trackIds) {
+                    m_pPlaylistTableModel->appendTrack(trackId);
+                }
+                view->setSelectedTracks(selectedTrackIds);
             }
         }
 
         if (!hasActiveView) {
-            m_pPlaylistTableModel->appendTrack(currentPlayingTrackId);
+            for (const TrackId& trackId : trackIds) {
+                m_pPlaylistTableModel->appendTrack(trackId);
+            }
         }
     } else {
-        // TODO(XXX): Care whether the append succeeded.
-        m_playlistDao.appendTrackToPlaylist(
-                currentPlayingTrackId, m_currentPlaylistId);
+        for (const TrackId& trackId : trackIds) {
+            // TODO(XXX): Care whether the append succeeded.
+            m_playlistDao.appendTrackToPlaylist(trackId, m_currentPlaylistId);
+        }
     }
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <QPointer>
+#include <QTimer>
 
 #include "library/trackset/baseplaylistfeature.h"
 #include "preferences/usersettings.h"
@@ -50,7 +51,14 @@ class SetlogFeature : public BasePlaylistFeature {
     void lockOrUnlockAllChildPlaylists(bool lock);
     QString getRootViewHtml() const override;
 
+    /// Appends the queued played tracks to the current history playlist.
+    /// Called by m_historyFlushTimer shortly after a track change and by
+    /// every operation that switches or rewrites the current playlist.
+    void flushPendingHistoryAppends();
+
     std::list<TrackId> m_recentTracks;
+    QList<TrackId> m_pendingHistoryTrackIds;
+    QTimer m_historyFlushTimer;
     QAction* m_pJoinWithPreviousAction;
     QAction* m_pMarkTracksPlayedAction;
     QAction* m_pStartNewPlaylist;
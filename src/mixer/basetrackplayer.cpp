@@ -15,6 +15,7 @@
 #include "mixer/playerinfo.h"
 #include "mixer/playermanager.h"
 #include "moc_basetrackplayer.cpp"
+#include "preferences/replaygainsettings.h"
 #include "track/track.h"
 #include "util/sandbox.h"
 #include "vinylcontrol/defs_vinylcontrol.h"
@@ -52,7 +53,8 @@ BaseTrackPlayerImpl::BaseTrackPlayerImpl(
           m_pLoadedTrack(),
           m_pPrevFailedTrackId(),
           m_replaygainPending(false),
-          m_pChannelToCloneFrom(nullptr) {
+          m_pChannelToCloneFrom(nullptr),
+          m_bCaptureLoopOnLoad(false) {
     auto channel = std::make_unique<EngineDeck>(handleGroup,
             pConfig,
             pMixingEngine,
@@ -174,6 +176,17 @@ BaseTrackPlayerImpl::BaseTrackPlayerImpl(
             this,
             &BaseTrackPlayerImpl::slotCloneFromSampler);
 
+    // Loop capture: clone the deck's track and loop and start looping
+    // immediately, e.g. to keep a live loop running on a sampler while
+    // the source deck moves on.
+    m_pCaptureLoopFromDeck = std::make_unique<ControlObject>(
+            ConfigKey(getGroup(), "CaptureLoopFromDeck"),
+            false);
+    connect(m_pCaptureLoopFromDeck.get(),
+            &ControlObject::valueChanged,
+            this,
+            &BaseTrackPlayerImpl::slotCaptureLoopFromDeck);
+
     // Load track from other deck/sampler
     m_pLoadTrackFromDeck = std::make_unique<ControlObject>(
             ConfigKey(getGroup(), "LoadTrackFromDeck"),
@@ -536,6 +549,13 @@ void BaseTrackPlayerImpl::connectLoadedTrack() {
             this,
             &BaseTrackPlayerImpl::slotAdjustReplayGain);
 
+    // The loudness analyzer may attach the envelope only after the track
+    // has been loaded into the deck
+    connect(m_pLoadedTrack.get(),
+            &Track::loudnessEnvelopeUpdated,
+            this,
+            &BaseTrackPlayerImpl::pushLoudnessEnvelopeToEngine);
+
     connect(m_pLoadedTrack.get(),
             &Track::colorUpdated,
             this,
@@ -617,6 +637,7 @@ void BaseTrackPlayerImpl::slotLoadFailed(TrackPointer pTrack, const QString& rea
         qDebug() << "Failed to load track (NULL track object)" << reason;
     }
     m_pChannelToCloneFrom = nullptr;
+    m_bCaptureLoopOnLoad = false;
 
     // Alert user.
     // The QMessageBox blocks the event loop (and the GUI since it's modal dialog),
@@ -651,6 +672,7 @@ void BaseTrackPlayerImpl::slotTrackLoaded(TrackPointer pNewTrack,
         m_pLoopInPoint->set(kNoTrigger);
         m_pLoopOutPoint->set(kNoTrigger);
         m_pLoadedTrack.reset();
+        pushLoudnessEnvelopeToEngine();
         emit playerEmpty();
         emit trackRatingChanged(0);
     } else if (pNewTrack && pNewTrack == m_pLoadedTrack) {
@@ -667,6 +689,7 @@ void BaseTrackPlayerImpl::slotTrackLoaded(TrackPointer pNewTrack,
         m_pFileBPM->set(m_pLoadedTrack->getBpm());
         m_pKey->set(m_pLoadedTrack->getKey());
         slotSetTrackColor(m_pLoadedTrack->getColor());
+        pushLoudnessEnvelopeToEngine();
 
         if(m_pConfig->getValue(
                 ConfigKey("[Mixer Profile]", "EqAutoReset"), false)) {
@@ -728,6 +751,15 @@ void BaseTrackPlayerImpl::slotTrackLoaded(TrackPointer pNewTrack,
             if (ControlObject::get(ConfigKey(m_pChannelToCloneFrom->getGroup(), "loop_enabled")) == 1.0) {
                 ControlObject::set(ConfigKey(getGroup(), "reloop_toggle"), 1.0);
             }
+
+            if (m_bCaptureLoopOnLoad) {
+                m_bCaptureLoopOnLoad = false;
+                // Jump to the start of the captured loop, enable it and
+                // start playing so the loop keeps running here while the
+                // source deck is free to move on.
+                ControlObject::set(ConfigKey(getGroup(), "reloop_andstop"), 1.0);
+                m_pPlay->set(1.0);
+            }
         }
 
 #ifdef __STEM__
@@ -755,6 +787,7 @@ void BaseTrackPlayerImpl::slotTrackLoaded(TrackPointer pNewTrack,
     }
 
     m_pChannelToCloneFrom = nullptr;
+    m_bCaptureLoopOnLoad = false;
 
     // Update the PlayerInfo class that is used in EngineBroadcast to replace
     // the metadata of a stream
@@ -797,6 +830,47 @@ void BaseTrackPlayerImpl::slotCloneFromSampler(double d) {
     }
 }
 
+void BaseTrackPlayerImpl::slotCaptureLoopFromDeck(double d) {
+    int deck = static_cast<int>(d);
+    if (deck < 1) {
+        return;
+    }
+    captureLoopFromGroup(PlayerManager::groupForDeck(deck - 1));
+}
+
+void BaseTrackPlayerImpl::captureLoopFromGroup(const QString& group) {
+    EngineChannel* pChannel = m_pEngineMixer->getChannel(group);
+    // Don't capture from ourselves.
+    if (!pChannel || pChannel == m_pChannel) {
+        return;
+    }
+
+    // Without a loop set on the source deck there is nothing to capture.
+    if (ControlObject::get(ConfigKey(group, "loop_start_position")) ==
+                    kNoTrigger ||
+            ControlObject::get(ConfigKey(group, "loop_end_position")) ==
+                    kNoTrigger) {
+        return;
+    }
+
+    TrackPointer pTrack = pChannel->getEngineBuffer()->getLoadedTrack();
+    if (!pTrack) {
+        return;
+    }
+
+    // Clone the source deck. The decoded chunks of the track are reused
+    // from the shared chunk cache, so the captured loop is playable
+    // right away without reading the file again. The loop is started in
+    // slotTrackLoaded() once the clone has finished loading.
+    m_bCaptureLoopOnLoad = true;
+    m_pChannelToCloneFrom = pChannel;
+    slotLoadTrack(pTrack,
+#ifdef __STEM__
+            pChannel->getEngineBuffer()->getStemMask(),
+#endif
+            false);
+}
+
 void BaseTrackPlayerImpl::slotCloneChannel(EngineChannel* pChannel) {
     // don't clone from ourselves
     if (!pChannel || pChannel == m_pChannel) {
@@ -881,6 +955,17 @@ void BaseTrackPlayerImpl::slotSetAndConfirmTrackMenuControl(bool visible) {
     m_pShowTrackMenuControl->setAndConfirm(visible ? 1.0 : 0.0);
 }
 
+void BaseTrackPlayerImpl::pushLoudnessEnvelopeToEngine() {
+    mixxx::LoudnessEnvelopePointer pEnvelope;
+    // Keep the engine neutral when the feature is disabled, even if
+    // previously analyzed tracks still have envelopes stored.
+    if (m_pLoadedTrack &&
+            ReplayGainSettings(m_pConfig).getLoudnessEnvelopeEnabled()) {
+        pEnvelope = m_pLoadedTrack->getLoudnessEnvelope();
+    }
+    m_pChannel->setLoudnessEnvelope(pEnvelope);
+}
+
 void BaseTrackPlayerImpl::slotSetReplayGain(mixxx::ReplayGain replayGain) {
     // Do not change replay gain when track is playing because
     // this may lead to an unexpected volume change.
@@ -140,6 +140,8 @@ class BaseTrackPlayerImpl : public BaseTrackPlayer {
     void slotCloneChannel(EngineChannel* pChannel);
     void slotCloneFromDeck(double deck);
     void slotCloneFromSampler(double sampler);
+    void slotCaptureLoopFromDeck(double deck);
+    void captureLoopFromGroup(const QString& group);
     void loadTrackFromGroup(const QString& group);
     void slotLoadTrackFromDeck(double deck);
     void slotLoadTrackFromSampler(double sampler);
@@ -157,6 +159,7 @@ class BaseTrackPlayerImpl : public BaseTrackPlayer {
 
   private:
     void setReplayGain(double value);
+    void pushLoudnessEnvelopeToEngine();
 
     void loadTrack(TrackPointer pTrack);
     TrackPointer unloadTrack();
@@ -172,6 +175,9 @@ class BaseTrackPlayerImpl : public BaseTrackPlayer {
     EngineDeck* m_pChannel;
     bool m_replaygainPending;
     EngineChannel* m_pChannelToCloneFrom;
+    // Start the cloned loop right after the pending clone load, see
+    // slotCaptureLoopFromDeck().
+    bool m_bCaptureLoopOnLoad;
 
     PerformanceTimer m_ejectTimer;
 
@@ -181,6 +187,9 @@ class BaseTrackPlayerImpl : public BaseTrackPlayer {
     std::unique_ptr<ControlObject> m_pCloneFromDeck;
     std::unique_ptr<ControlObject> m_pCloneFromSampler;
 
+    // Loop capture control
+    std::unique_ptr<ControlObject> m_pCaptureLoopFromDeck;
+
     // Load track from other deck/sampler
     std::unique_ptr<ControlObject> m_pLoadTrackFromDeck;
     std::unique_ptr<ControlObject> m_pLoadTrackFromSampler;
@@ -49,6 +49,11 @@ PlayerInfo& PlayerInfo::instance() {
     return *s_pPlayerInfo;
 }
 
+// static
+bool PlayerInfo::exists() {
+    return s_pPlayerInfo != nullptr;
+}
+
 // static
 void PlayerInfo::destroy() {
     delete s_pPlayerInfo;
@@ -14,6 +14,9 @@ class PlayerInfo : public QObject {
   public:
     static PlayerInfo& create();
     static PlayerInfo& instance();
+    // Whether instance() can be called without creating one, e.g. from
+    // code that also runs in tests without a player setup.
+    static bool exists();
     static void destroy();
     TrackPointer getTrackInfo(const QString& group);
     void setTrackInfo(const QString& group, const TrackPointer& trackInfoObj);
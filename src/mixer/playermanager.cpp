@@ -15,6 +15,7 @@
 #include "mixer/previewdeck.h"
 #include "mixer/sampler.h"
 #include "mixer/samplerbank.h"
+#include "mixer/sessionrecovery.h"
 #include "moc_playermanager.cpp"
 #include "preferences/dialog/dlgprefdeck.h"
 #include "soundio/soundmanager.h"
@@ -135,6 +136,9 @@ PlayerManager::PlayerManager(UserSettingsPointer pConfig,
     // This is parented to the PlayerManager so does not need to be deleted
     m_pSamplerBank = new SamplerBank(m_pConfig, this);
 
+    // This is parented to the PlayerManager so does not need to be deleted
+    m_pSessionRecovery = new SessionRecovery(m_pConfig, this);
+
     m_cloneTimer.start();
 }
 
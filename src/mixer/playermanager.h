@@ -25,6 +25,7 @@ class Microphone;
 class PreviewDeck;
 class Sampler;
 class SamplerBank;
+class SessionRecovery;
 class SoundManager;
 class ControlProxy;
 
@@ -291,6 +292,7 @@ class PlayerManager : public PlayerManagerInterface {
     EffectsManager* m_pEffectsManager;
     EngineMixer* m_pEngine;
     SamplerBank* m_pSamplerBank;
+    SessionRecovery* m_pSessionRecovery;
     std::unique_ptr<ControlObject> m_pCONumDecks;
     std::unique_ptr<ControlObject> m_pCONumSamplers;
     std::unique_ptr<ControlObject> m_pCONumPreviewDecks;
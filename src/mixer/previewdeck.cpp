@@ -1,6 +1,28 @@
 #include "mixer/previewdeck.h"
 
+#include "control/controlobject.h"
+#include "mixer/playerinfo.h"
+#include "mixer/playermanager.h"
 #include "moc_previewdeck.cpp"
+#include "track/track.h"
+
+namespace {
+
+// Fold the raw bpm ratio towards 1.0 by octaves, like a DJ would
+// beatmatch a double or half tempo track. Without folding, auditioning
+// e.g. a 175 bpm track against an 87 bpm deck would play the preview at
+// half speed instead of treating the tempos as equivalent.
+double foldBpmRatio(double ratio) {
+    while (ratio > 1.5) {
+        ratio /= 2;
+    }
+    while (ratio < 0.75) {
+        ratio *= 2;
+    }
+    return ratio;
+}
+
+} // anonymous namespace
 
 PreviewDeck::PreviewDeck(PlayerManager* pParent,
         UserSettingsPointer pConfig,
@@ -17,4 +39,36 @@ PreviewDeck::PreviewDeck(PlayerManager* pParent,
                   /*defaultMainMix*/ false,
                   /*defaultHeadphones*/ true,
                   /*primaryDeck*/ false) {
+    m_pBeatmatchOnLoad = std::make_unique<ControlPushButton>(
+            ConfigKey(getGroup(), QStringLiteral("beatmatch_on_load")),
+            /*bPersist*/ true);
+    m_pBeatmatchOnLoad->setButtonMode(mixxx::control::ButtonMode::Toggle);
+    connect(this,
+            &BaseTrackPlayer::newTrackLoaded,
+            this,
+            &PreviewDeck::slotBeatmatchNewTrack);
+}
+
+void PreviewDeck::slotBeatmatchNewTrack(TrackPointer pLoadedTrack) {
+    if (!m_pBeatmatchOnLoad->toBool() || !pLoadedTrack) {
+        return;
+    }
+    const int playingDeck = PlayerInfo::instance().getCurrentPlayingDeck();
+    if (playingDeck < 0) {
+        // Nothing to match against, keep the rate as is.
+        return;
+    }
+    // The bpm control of the playing deck already includes its current
+    // playback rate, while the preview track's own bpm is its file tempo
+    // at rate 1.0.
+    const double playingBpm = ControlObject::get(ConfigKey(
+            PlayerManager::groupForDeck(playingDeck), QStringLiteral("bpm")));
+    const double previewBpm = pLoadedTrack->getBpm();
+    if (playingBpm <= 0 || previewBpm <= 0) {
+        return;
+    }
+    // With keylock enabled on the preview deck this matches the tempo
+    // without transposing the key.
+    ControlObject::set(ConfigKey(getGroup(), QStringLiteral("rate_ratio")),
+            foldBpmRatio(playingBpm / previewBpm));
 }
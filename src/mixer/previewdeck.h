@@ -1,5 +1,8 @@
 #pragma once
 
+#include <memory>
+
+#include "control/controlpushbutton.h"
 #include "mixer/basetrackplayer.h"
 
 class PreviewDeck : public BaseTrackPlayerImpl {
@@ -12,4 +15,13 @@ class PreviewDeck : public BaseTrackPlayerImpl {
             EngineChannel::ChannelOrientation defaultOrientation,
             const ChannelHandleAndGroup& handleGroup);
     ~PreviewDeck() override = default;
+
+  private slots:
+    void slotBeatmatchNewTrack(TrackPointer pLoadedTrack);
+
+  private:
+    // Toggles matching the tempo of newly loaded tracks to the currently
+    // playing deck, so that auditioning a library track starts in sync
+    // without loading it into a primary deck first.
+    std::unique_ptr<ControlPushButton> m_pBeatmatchOnLoad;
 };
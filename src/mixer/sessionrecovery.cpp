@@ -0,0 +1,244 @@
+#include "mixer/sessionrecovery.h"
+
+#include <QDomDocument>
+#include <QFile>
+
+#include "control/controlobject.h"
+#include "control/controlpushbutton.h"
+#include "mixer/deck.h"
+#include "mixer/playermanager.h"
+#include "moc_sessionrecovery.cpp"
+#include "track/track.h"
+#include "util/assert.h"
+#include "util/logger.h"
+
+namespace {
+
+const mixxx::Logger kLogger("SessionRecovery");
+
+// Interval between two snapshots of the deck states
+constexpr int kSnapshotIntervalMillis = 5000;
+
+const QString kSnapshotFileName = QStringLiteral("session_snapshot.xml");
+
+} // anonymous namespace
+
+SessionRecovery::SessionRecovery(UserSettingsPointer pConfig,
+        PlayerManager* pPlayerManager)
+        : QObject(pPlayerManager),
+          m_pConfig(pConfig),
+          m_pPlayerManager(pPlayerManager) {
+    DEBUG_ASSERT(m_pPlayerManager);
+
+    m_pCORestoreSession = std::make_unique<ControlPushButton>(
+            ConfigKey(QStringLiteral("[App]"), QStringLiteral("restore_session")), this);
+    connect(m_pCORestoreSession.get(),
+            &ControlObject::valueChanged,
+            this,
+            &SessionRecovery::slotRestoreSession);
+
+    connect(&m_snapshotTimer,
+            &QTimer::timeout,
+            this,
+            &SessionRecovery::slotSaveSnapshot);
+    m_snapshotTimer.start(kSnapshotIntervalMillis);
+}
+
+QString SessionRecovery::defaultSnapshotPath() const {
+    return m_pConfig->getSettingsPath() + QChar('/') + kSnapshotFileName;
+}
+
+void SessionRecovery::slotSaveSnapshot() {
+    saveSnapshotToPath(defaultSnapshotPath());
+}
+
+void SessionRecovery::slotRestoreSession(double v) {
+    if (v <= 0.0) {
+        return;
+    }
+
+    if (!restoreSnapshotFromPath(defaultSnapshotPath())) {
+        kLogger.warning()
+                << "Could not restore session from"
+                << defaultSnapshotPath();
+    }
+}
+
+bool SessionRecovery::saveSnapshotToPath(const QString& snapshotPath) {
+    VERIFY_OR_DEBUG_ASSERT(m_pPlayerManager) {
+        return false;
+    }
+
+    QDomDocument doc(QStringLiteral("SessionSnapshot"));
+
+    QDomElement root = doc.createElement(QStringLiteral("session"));
+    doc.appendChild(root);
+
+    for (int i = 0; i < m_pPlayerManager->numberOfDecks(); ++i) {
+        Deck* pDeck = m_pPlayerManager->getDeck(i);
+        if (!pDeck) {
+            continue;
+        }
+        TrackPointer pTrack = pDeck->getLoadedTrack();
+        if (!pTrack) {
+            continue;
+        }
+        const QString group = pDeck->getGroup();
+
+        QDomElement deckNode = doc.createElement(QStringLiteral("deck"));
+        deckNode.setAttribute(QStringLiteral("group"), group);
+        deckNode.setAttribute(QStringLiteral("location"), pTrack->getLocation());
+        // All deck controls are atomic doubles and safe to read from
+        // the main thread without blocking the engine
+        deckNode.setAttribute(QStringLiteral("playposition"),
+                ControlObject::get(ConfigKey(group, QStringLiteral("playposition"))));
+        deckNode.setAttribute(QStringLiteral("rate_ratio"),
+                ControlObject::get(ConfigKey(group, QStringLiteral("rate_ratio"))));
+        deckNode.setAttribute(QStringLiteral("loop_start_position"),
+                ControlObject::get(ConfigKey(group, QStringLiteral("loop_start_position"))));
+        deckNode.setAttribute(QStringLiteral("loop_end_position"),
+                ControlObject::get(ConfigKey(group, QStringLiteral("loop_end_position"))));
+        deckNode.setAttribute(QStringLiteral("loop_enabled"),
+                ControlObject::get(ConfigKey(group, QStringLiteral("loop_enabled"))));
+        deckNode.setAttribute(QStringLiteral("play"),
+                ControlObject::get(ConfigKey(group, QStringLiteral("play"))));
+        root.appendChild(deckNode);
+    }
+
+    QString docStr = doc.toString();
+    if (docStr == m_lastSavedSnapshot) {
+        // Nothing changed since the last snapshot
+        return true;
+    }
+
+    QFile file(snapshotPath);
+    if (!file.open(QIODevice::WriteOnly)) {
+        kLogger.warning()
+                << "Could not write session snapshot to file"
+                << snapshotPath;
+        return false;
+    }
+    file.write(docStr.toUtf8().constData());
+    file.close();
+
+    m_lastSavedSnapshot = docStr;
+    return true;
+}
+
+bool SessionRecovery::restoreSnapshotFromPath(const QString& snapshotPath) {
+    VERIFY_OR_DEBUG_ASSERT(m_pPlayerManager) {
+        return false;
+    }
+
+    QFile file(snapshotPath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        kLogger.warning()
+                << "Could not read session snapshot file"
+                << snapshotPath;
+        return false;
+    }
+
+    QDomDocument doc;
+    if (!doc.setContent(file.readAll())) {
+        kLogger.warning()
+                << "Could not parse session snapshot file"
+                << snapshotPath;
+        return false;
+    }
+    file.close();
+
+    QDomElement root = doc.documentElement();
+    if (root.tagName() != QStringLiteral("session")) {
+        kLogger.warning()
+                << "Could not parse session snapshot file"
+                << snapshotPath;
+        return false;
+    }
+
+    QDomNode n = root.firstChild();
+    while (!n.isNull()) {
+        QDomElement e = n.toElement();
+        n = n.nextSibling();
+
+        if (e.isNull() || e.tagName() != QStringLiteral("deck")) {
+            continue;
+        }
+        const QString group = e.attribute(QStringLiteral("group"));
+        const QString location = e.attribute(QStringLiteral("location"));
+        int deckNum;
+        if (location.isEmpty() || !PlayerManager::isDeckGroup(group, &deckNum)) {
+            continue;
+        }
+        if (m_pPlayerManager->numberOfDecks() < deckNum) {
+            ControlObject::set(
+                    ConfigKey(QStringLiteral("[App]"), QStringLiteral("num_decks")),
+                    deckNum);
+        }
+        BaseTrackPlayer* pPlayer = m_pPlayerManager->getPlayer(group);
+        if (!pPlayer) {
+            continue;
+        }
+
+        DeckSnapshot deckSnapshot;
+        deckSnapshot.playPosition =
+                e.attribute(QStringLiteral("playposition")).toDouble();
+        deckSnapshot.rateRatio =
+                e.attribute(QStringLiteral("rate_ratio"), QStringLiteral("1")).toDouble();
+        deckSnapshot.loopStartPosition =
+                e.attribute(QStringLiteral("loop_start_position"), QStringLiteral("-1"))
+                        .toDouble();
+        deckSnapshot.loopEndPosition =
+                e.attribute(QStringLiteral("loop_end_position"), QStringLiteral("-1"))
+                        .toDouble();
+        deckSnapshot.loopEnabled =
+                e.attribute(QStringLiteral("loop_enabled")).toDouble() > 0.0;
+        m_pendingRestore.insert(group, deckSnapshot);
+
+        // Apply the snapshotted deck state once the track has finished
+        // loading, since loading is asynchronous
+        connect(pPlayer,
+                &BaseTrackPlayer::newTrackLoaded,
+                this,
+                &SessionRecovery::slotTrackLoaded,
+                Qt::UniqueConnection);
+        m_pPlayerManager->slotLoadLocationToPlayer(location, group, false);
+    }
+
+    return true;
+}
+
+void SessionRecovery::slotTrackLoaded(TrackPointer pTrack) {
+    Q_UNUSED(pTrack);
+    BaseTrackPlayer* pPlayer = qobject_cast<BaseTrackPlayer*>(sender());
+    VERIFY_OR_DEBUG_ASSERT(pPlayer) {
+        return;
+    }
+    const QString group = pPlayer->getGroup();
+    const auto it = m_pendingRestore.constFind(group);
+    if (it == m_pendingRestore.constEnd()) {
+        // Not a restored track, e.g. loaded by the user after the restore
+        return;
+    }
+    const DeckSnapshot deckSnapshot = it.value();
+    m_pendingRestore.erase(it);
+
+    ControlObject::set(ConfigKey(group, QStringLiteral("rate_ratio")),
+            deckSnapshot.rateRatio);
+    if (deckSnapshot.loopStartPosition >= 0 &&
+            deckSnapshot.loopEndPosition > deckSnapshot.loopStartPosition) {
+        ControlObject::set(ConfigKey(group, QStringLiteral("loop_start_position")),
+                deckSnapshot.loopStartPosition);
+        ControlObject::set(ConfigKey(group, QStringLiteral("loop_end_position")),
+                deckSnapshot.loopEndPosition);
+        if (deckSnapshot.loopEnabled) {
+            // Activate the loop between the restored loop points
+            ControlObject::set(ConfigKey(group, QStringLiteral("reloop_toggle")), 1);
+            ControlObject::set(ConfigKey(group, QStringLiteral("reloop_toggle")), 0);
+        }
+    }
+    // Seek last so that neither the loop nor any cue seek-on-load wins
+    // over the snapshotted position. The deck is left paused, a tap on
+    // play continues the set.
+    ControlObject::set(ConfigKey(group, QStringLiteral("playposition")),
+            deckSnapshot.playPosition);
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <QHash>
+#include <QObject>
+#include <QTimer>
+#include <memory>
+
+#include "preferences/usersettings.h"
+#include "track/track_decl.h"
+
+class ControlObject;
+class PlayerManager;
+
+// Periodically snapshots the state of all decks (loaded track, play
+// position, rate and loop) to an XML file in the settings directory, so
+// that a set interrupted by a crash or power loss can be resumed quickly.
+// The snapshot is taken from the main thread by reading the deck controls,
+// which are atomic, so neither the engine nor the GUI is ever blocked.
+//
+// Pushing the [App],restore_session control (mappable to a keyboard or
+// controller shortcut) reloads the snapshotted tracks into their decks and
+// seeks them to the snapshotted position with the loop re-enabled. The
+// decks are left paused, one tap on play continues the set.
+class SessionRecovery : public QObject {
+    Q_OBJECT
+  public:
+    SessionRecovery(UserSettingsPointer pConfig,
+            PlayerManager* pPlayerManager);
+
+    bool saveSnapshotToPath(const QString& snapshotPath);
+    bool restoreSnapshotFromPath(const QString& snapshotPath);
+
+    QString defaultSnapshotPath() const;
+
+  private slots:
+    void slotSaveSnapshot();
+    void slotRestoreSession(double v);
+    void slotTrackLoaded(TrackPointer pTrack);
+
+  private:
+    // The deck state restored after the track has been loaded
+    struct DeckSnapshot {
+        double playPosition;
+        double rateRatio;
+        double loopStartPosition;
+        double loopEndPosition;
+        bool loopEnabled;
+    };
+
+    UserSettingsPointer m_pConfig;
+    PlayerManager* m_pPlayerManager;
+    std::unique_ptr<ControlObject> m_pCORestoreSession;
+    QTimer m_snapshotTimer;
+    // The last written document, used to skip the write when nothing changed
+    QString m_lastSavedSnapshot;
+    // Deck states waiting for their track to finish loading, by group
+    QHash<QString, DeckSnapshot> m_pendingRestore;
+};
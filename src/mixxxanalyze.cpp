@@ -0,0 +1,192 @@
+#include <QCoreApplication>
+#include <QList>
+#include <QSqlDatabase>
+#include <QThread>
+#include <QtDebug>
+#include <QtGlobal>
+#include <memory>
+
+#include "analyzer/analyzerprogress.h"
+#include "analyzer/analyzerscheduledtrack.h"
+#include "analyzer/trackanalysisscheduler.h"
+#include "database/mixxxdb.h"
+#include "library/dao/trackdao.h"
+#include "library/trackcollection.h"
+#include "library/trackcollectionmanager.h"
+#include "preferences/settingsmanager.h"
+#include "sources/soundsourceproxy.h"
+#include "util/cmdlineargs.h"
+#include "util/db/dbconnectionpooled.h"
+#include "util/logging.h"
+#include "util/math.h"
+#include "util/versionstore.h"
+
+// Headless batch analysis of the Mixxx library. Links the same analyzer
+// stack (TrackAnalysisScheduler/AnalyzerThread) and track collection code
+// as the desktop application and shares its settings and database, so all
+// results (beats, keys, ReplayGain, waveforms) are picked up by the GUI
+// without any import step. Intended for pre-analyzing large libraries on
+// machines without a display or audio device.
+
+namespace {
+
+// Exit codes
+constexpr int kParseCmdlineArgsErrorExitCode = 1;
+constexpr int kStartupErrorExitCode = 2;
+
+// Utilize all available cores for batch analysis, mirroring AnalysisFeature.
+const int kNumberOfAnalyzerThreads = math_max(1, QThread::idealThreadCount());
+
+AnalyzerModeFlags analyzerModeFlags(const UserSettingsPointer& pConfig) {
+    // Same analyzer selection as the desktop batch analysis, but without
+    // the LowPriority flag: on a dedicated analysis machine there is no
+    // audio engine to yield to.
+    int modeFlags = AnalyzerModeFlags::WithBeats;
+    if (pConfig->getValue<bool>(
+                ConfigKey("[Library]", "EnableWaveformGenerationWithAnalysis"),
+                true)) {
+        modeFlags |= AnalyzerModeFlags::WithWaveform;
+    }
+    if (pConfig->getValue<bool>(
+                ConfigKey("[Library]", "ParallelTrackAnalysis"), false)) {
+        modeFlags |= AnalyzerModeFlags::ParallelAnalyzers;
+    }
+    return static_cast<AnalyzerModeFlags>(modeFlags);
+}
+
+class BatchAnalysisEnvironment final : public TrackAnalysisSchedulerEnvironment {
+  public:
+    explicit BatchAnalysisEnvironment(
+            const TrackCollectionManager* pTrackCollectionManager)
+            : m_pTrackCollectionManager(pTrackCollectionManager) {
+        DEBUG_ASSERT(m_pTrackCollectionManager);
+    }
+    ~BatchAnalysisEnvironment() final = default;
+
+    TrackPointer loadTrackById(TrackId trackId) const final {
+        return m_pTrackCollectionManager->getTrackById(trackId);
+    }
+
+  private:
+    const TrackCollectionManager* const m_pTrackCollectionManager;
+};
+
+} // anonymous namespace
+
+int main(int argc, char** argv) {
+    // Share the application identity with the desktop build so that the
+    // default settings path (and with it the library database) match.
+    QCoreApplication::setOrganizationDomain("mixxx.org");
+    QCoreApplication::setApplicationName(VersionStore::applicationName());
+    QCoreApplication::setApplicationVersion(VersionStore::version());
+
+    CmdlineArgs& args = CmdlineArgs::Instance();
+    if (!args.parse(argc, argv)) {
+        return kParseCmdlineArgsErrorExitCode;
+    }
+
+    QCoreApplication app(argc, argv);
+
+    mixxx::LogFlags logFlags = mixxx::LogFlag::LogToFile;
+    if (args.getDebugAssertBreak()) {
+        logFlags.setFlag(mixxx::LogFlag::DebugAssertBreak);
+    }
+    mixxx::Logging::initialize(
+            args.getSettingsPath(),
+            args.getLogLevel(),
+            args.getLogFlushLevel(),
+            logFlags);
+
+    VERIFY_OR_DEBUG_ASSERT(SoundSourceProxy::registerProviders()) {
+        qCritical() << "Failed to register any SoundSource providers";
+        return kStartupErrorExitCode;
+    }
+
+    const auto pSettingsManager =
+            std::make_unique<SettingsManager>(args.getSettingsPath());
+    const UserSettingsPointer pConfig = pSettingsManager->settings();
+
+    const mixxx::DbConnectionPoolPtr pDbConnectionPool =
+            MixxxDb(pConfig).connectionPool();
+    if (!pDbConnectionPool || !pDbConnectionPool->createThreadLocalConnection()) {
+        qCritical() << "Failed to open the library database";
+        return kStartupErrorExitCode;
+    }
+    const QSqlDatabase dbConnection = mixxx::DbConnectionPooled(pDbConnectionPool);
+    if (!dbConnection.isOpen() || !MixxxDb::initDatabaseSchema(dbConnection)) {
+        qCritical() << "Failed to initialize the library database schema";
+        return kStartupErrorExitCode;
+    }
+
+    int exitCode = 0;
+    {
+        const auto pTrackCollectionManager =
+                std::make_unique<TrackCollectionManager>(
+                        nullptr,
+                        pConfig,
+                        pDbConnectionPool);
+
+        const QList<TrackId> trackIds =
+                pTrackCollectionManager->internalCollection()
+                        ->getTrackDAO()
+                        .getAllTrackIds();
+        QList<AnalyzerScheduledTrack> tracks;
+        tracks.reserve(trackIds.size());
+        for (const TrackId& trackId : trackIds) {
+            tracks.append(AnalyzerScheduledTrack(trackId));
+        }
+
+        qInfo() << "Scheduling"
+                << tracks.size()
+                << "library tracks for analysis using"
+                << kNumberOfAnalyzerThreads
+                << "analyzer threads";
+
+        TrackAnalysisScheduler::Pointer pTrackAnalysisScheduler =
+                TrackAnalysisScheduler::createInstance(
+                        std::make_unique<const BatchAnalysisEnvironment>(
+                                pTrackCollectionManager.get()),
+                        kNumberOfAnalyzerThreads,
+                        pDbConnectionPool,
+                        pConfig,
+                        analyzerModeFlags(pConfig));
+        QObject::connect(pTrackAnalysisScheduler.get(),
+                &TrackAnalysisScheduler::progress,
+                &app,
+                [](AnalyzerProgress currentTrackProgress,
+                        int currentTrackNumber,
+                        int totalTracksCount) {
+                    if (currentTrackProgress >= kAnalyzerProgressNone) {
+                        qInfo("Analyzing track %d of %d (%d%%)",
+                                currentTrackNumber,
+                                totalTracksCount,
+                                analyzerProgressPercent(currentTrackProgress));
+                    } else {
+                        qInfo("Analyzing track %d of %d",
+                                currentTrackNumber,
+                                totalTracksCount);
+                    }
+                });
+        QObject::connect(pTrackAnalysisScheduler.get(),
+                &TrackAnalysisScheduler::finished,
+                &app,
+                &QCoreApplication::quit);
+
+        if (pTrackAnalysisScheduler->scheduleTracks(tracks) > 0) {
+            pTrackAnalysisScheduler->resume();
+            exitCode = app.exec();
+            qInfo() << "Analysis finished";
+        } else {
+            qInfo() << "No tracks to analyze";
+        }
+        pTrackAnalysisScheduler->stop();
+
+        // The TrackCollectionManager flushes all pending track saves
+        // on destruction before the database connection goes away.
+    }
+    pDbConnectionPool->destroyThreadLocalConnection();
+
+    mixxx::Logging::shutdown();
+
+    return exitCode;
+}
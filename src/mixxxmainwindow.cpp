@@ -59,6 +59,7 @@
 #include "waveform/sharedglcontext.h"
 #include "waveform/visualsmanager.h"
 #include "waveform/waveformwidgetfactory.h"
+#include "widget/paintable.h"
 #include "widget/wglwidget.h"
 #include "widget/wmainmenubar.h"
 
@@ -88,6 +89,10 @@ inline bool supportsGlobalMenu() {
 
 const ConfigKey kHideMenuBarConfigKey = ConfigKey("[Config]", "hide_menubar");
 const ConfigKey kMenuBarHintConfigKey = ConfigKey("[Config]", "show_menubar_hint");
+
+// An interactive resize is considered settled when no resize event has
+// arrived for this long.
+constexpr int kResizeSettleMillis = 200;
 } // namespace
 
 MixxxMainWindow::MixxxMainWindow(std::shared_ptr<mixxx::CoreServices> pCoreServices)
@@ -132,6 +137,15 @@ MixxxMainWindow::MixxxMainWindow(std::shared_ptr<mixxx::CoreServices> pCoreServi
             this,
             &MixxxMainWindow::slotLibraryScanSummaryDlg);
 
+    m_resizeSettleTimer.setSingleShot(true);
+    m_resizeSettleTimer.setInterval(kResizeSettleMillis);
+    connect(&m_resizeSettleTimer, &QTimer::timeout, this, [this] {
+        Paintable::setResizeInProgress(false);
+        // Repaint everything so the scaled stand-ins drawn during the
+        // resize are replaced by crisp renderings at the final size.
+        update();
+    });
+
     createMenuBar();
     m_pMenuBar->hide();
 
@@ -1513,6 +1527,17 @@ void MixxxMainWindow::closeEvent(QCloseEvent *event) {
     QMainWindow::closeEvent(event);
 }
 
+void MixxxMainWindow::resizeEvent(QResizeEvent* event) {
+    // While the user drags the window border resize events arrive in
+    // rapid succession and skin graphics would be re-rasterized at
+    // every intermediate size. Let them render scaled stand-ins until
+    // the size has settled; the timer then triggers one full repaint
+    // at the final size.
+    Paintable::setResizeInProgress(true);
+    m_resizeSettleTimer.start();
+    QMainWindow::resizeEvent(event);
+}
+
 void MixxxMainWindow::checkDirectRendering() {
     // IF
     //  * A waveform viewer exists
@@ -2,6 +2,7 @@
 
 #include <QMainWindow>
 #include <QString>
+#include <QTimer>
 #include <memory>
 
 #include "preferences/constants.h"
@@ -103,6 +104,7 @@ class MixxxMainWindow : public QMainWindow {
     /// Event filter to block certain events (eg. tooltips if tooltips are disabled)
     bool eventFilter(QObject *obj, QEvent *event) override;
     void closeEvent(QCloseEvent *event) override;
+    void resizeEvent(QResizeEvent* event) override;
 
   private:
     void initializeWindow();
@@ -161,5 +163,9 @@ class MixxxMainWindow : public QMainWindow {
 
     mixxx::preferences::ScreenSaver m_inhibitScreensaver;
 
+    // Detects the end of an interactive resize to re-enable crisp
+    // rendering of scaled skin graphics, see resizeEvent().
+    QTimer m_resizeSettleTimer;
+
     QSet<ControlObject*> m_skinCreatedControls;
 };
@@ -0,0 +1,299 @@
+#include "network/lansync.h"
+
+#include <QDataStream>
+#include <QNetworkDatagram>
+#include <cmath>
+
+#include "control/controlproxy.h"
+#include "moc_lansync.cpp"
+#include "util/logger.h"
+
+namespace mixxx {
+
+namespace {
+
+const Logger kLogger("LanSync");
+
+const QString kConfigGroup = QStringLiteral("[LanSync]");
+const QString kInternalClockGroup = QStringLiteral("[InternalClock]");
+
+constexpr int kDefaultPort = 28472;
+
+// All packets start with this magic and a protocol version so that
+// stray datagrams and incompatible versions are dropped silently.
+constexpr quint32 kProtocolMagic = 0x4D584C53; // "MXLS"
+constexpr quint8 kProtocolVersion = 1;
+
+// Fixed serialization format for wire compatibility across Qt versions
+constexpr QDataStream::Version kStreamVersion = QDataStream::Qt_5_15;
+
+enum class PacketType : quint8 {
+    Beacon = 0,
+    Probe = 1,
+    ProbeReply = 2,
+};
+
+// The beacon rate bounds how long a follower extrapolates the leader's
+// phase from the last beacon, the probe rate how quickly the clock
+// offset estimation converges and recovers from drift.
+constexpr int kBeaconIntervalMillis = 100;
+constexpr int kProbeIntervalMillis = 1000;
+
+// Phase errors below one millisecond are inaudible and left to the
+// free-running local clock, larger errors snap the beat distance.
+constexpr double kPhaseToleranceSeconds = 0.001;
+
+constexpr double kBpmEpsilon = 0.001;
+
+} // anonymous namespace
+
+LanSync::LanSync(UserSettingsPointer pConfig, QObject* parent)
+        : QObject(parent),
+          m_mode(Mode::Disabled),
+          m_port(kDefaultPort),
+          m_leaderPort(0),
+          m_clockSamples{},
+          m_nextClockSample(0),
+          m_validClockSamples(0) {
+    const QString mode = pConfig->getValue(
+            ConfigKey(kConfigGroup, QStringLiteral("Mode")),
+            QString());
+    if (mode.compare(QStringLiteral("leader"), Qt::CaseInsensitive) == 0) {
+        m_mode = Mode::Leader;
+    } else if (mode.compare(QStringLiteral("follower"), Qt::CaseInsensitive) == 0) {
+        m_mode = Mode::Follower;
+    } else {
+        return;
+    }
+
+    m_port = static_cast<quint16>(pConfig->getValue(
+            ConfigKey(kConfigGroup, QStringLiteral("Port")),
+            kDefaultPort));
+    // Both roles bind the replication port: the leader to answer clock
+    // probes, the follower to receive the broadcast beacons. Sharing
+    // the address allows running a leader and a follower on the same
+    // machine for testing.
+    if (!m_socket.bind(QHostAddress::AnyIPv4,
+                m_port,
+                QUdpSocket::ShareAddress | QUdpSocket::ReuseAddressHint)) {
+        kLogger.warning()
+                << "Failed to bind UDP port" << m_port
+                << "- LAN sync is disabled:"
+                << m_socket.errorString();
+        m_mode = Mode::Disabled;
+        return;
+    }
+    connect(&m_socket,
+            &QUdpSocket::readyRead,
+            this,
+            &LanSync::slotReadPendingDatagrams);
+
+    m_uptime.start();
+
+    m_pClockBpm = std::make_unique<ControlProxy>(
+            kInternalClockGroup, QStringLiteral("bpm"), this);
+    m_pClockBeatDistance = std::make_unique<ControlProxy>(
+            kInternalClockGroup, QStringLiteral("beat_distance"), this);
+
+    if (m_mode == Mode::Leader) {
+        connect(&m_timer,
+                &QTimer::timeout,
+                this,
+                &LanSync::slotSendBeacon);
+        m_timer.start(kBeaconIntervalMillis);
+        kLogger.info()
+                << "Replicating the internal clock as leader on UDP port"
+                << m_port;
+    } else {
+        connect(&m_timer,
+                &QTimer::timeout,
+                this,
+                &LanSync::slotSendProbe);
+        m_timer.start(kProbeIntervalMillis);
+        kLogger.info()
+                << "Following a replicated internal clock on UDP port"
+                << m_port;
+    }
+}
+
+LanSync::~LanSync() = default;
+
+void LanSync::slotSendBeacon() {
+    QByteArray packet;
+    QDataStream stream(&packet, QIODevice::WriteOnly);
+    stream.setVersion(kStreamVersion);
+    stream << kProtocolMagic
+           << kProtocolVersion
+           << static_cast<quint8>(PacketType::Beacon)
+           << localTimeUs()
+           << m_pClockBpm->get()
+           << m_pClockBeatDistance->get();
+    m_socket.writeDatagram(packet, QHostAddress::Broadcast, m_port);
+}
+
+void LanSync::slotSendProbe() {
+    if (m_leaderAddress.isNull()) {
+        // No beacon received yet, so the leader's address is unknown
+        return;
+    }
+    QByteArray packet;
+    QDataStream stream(&packet, QIODevice::WriteOnly);
+    stream.setVersion(kStreamVersion);
+    stream << kProtocolMagic
+           << kProtocolVersion
+           << static_cast<quint8>(PacketType::Probe)
+           << localTimeUs();
+    m_socket.writeDatagram(packet, m_leaderAddress, m_leaderPort);
+}
+
+void LanSync::slotReadPendingDatagrams() {
+    while (m_socket.hasPendingDatagrams()) {
+        const QNetworkDatagram datagram = m_socket.receiveDatagram();
+        if (!datagram.isValid()) {
+            continue;
+        }
+        const QByteArray payload = datagram.data();
+        QDataStream stream(payload);
+        stream.setVersion(kStreamVersion);
+        quint32 magic = 0;
+        quint8 version = 0;
+        quint8 type = 0;
+        stream >> magic >> version >> type;
+        if (stream.status() != QDataStream::Ok ||
+                magic != kProtocolMagic ||
+                version != kProtocolVersion) {
+            continue;
+        }
+        switch (static_cast<PacketType>(type)) {
+        case PacketType::Beacon:
+            if (m_mode == Mode::Follower) {
+                // The follower learns (and follows) whoever broadcasts
+                // beacons, so the leader's address does not have to be
+                // configured.
+                m_leaderAddress = datagram.senderAddress();
+                m_leaderPort = static_cast<quint16>(datagram.senderPort());
+                handleBeacon(&stream);
+            }
+            break;
+        case PacketType::Probe:
+            if (m_mode == Mode::Leader) {
+                handleProbe(&stream,
+                        datagram.senderAddress(),
+                        static_cast<quint16>(datagram.senderPort()));
+            }
+            break;
+        case PacketType::ProbeReply:
+            if (m_mode == Mode::Follower) {
+                handleProbeReply(&stream);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+}
+
+void LanSync::handleProbe(QDataStream* pStream,
+        const QHostAddress& senderAddress,
+        quint16 senderPort) {
+    qint64 followerTimeUs = 0;
+    *pStream >> followerTimeUs;
+    if (pStream->status() != QDataStream::Ok) {
+        return;
+    }
+    // Reply immediately so that a single leader timestamp stands in for
+    // both the receive and the send time of the round trip.
+    QByteArray packet;
+    QDataStream stream(&packet, QIODevice::WriteOnly);
+    stream.setVersion(kStreamVersion);
+    stream << kProtocolMagic
+           << kProtocolVersion
+           << static_cast<quint8>(PacketType::ProbeReply)
+           << followerTimeUs
+           << localTimeUs();
+    m_socket.writeDatagram(packet, senderAddress, senderPort);
+}
+
+void LanSync::handleProbeReply(QDataStream* pStream) {
+    qint64 sendTimeUs = 0;
+    qint64 leaderTimeUs = 0;
+    *pStream >> sendTimeUs >> leaderTimeUs;
+    if (pStream->status() != QDataStream::Ok) {
+        return;
+    }
+    const qint64 receiveTimeUs = localTimeUs();
+    const qint64 roundTripUs = receiveTimeUs - sendTimeUs;
+    if (roundTripUs < 0) {
+        return;
+    }
+    // Assuming a symmetric path, the leader's timestamp was taken at
+    // the midpoint of the round trip.
+    const qint64 offsetUs = leaderTimeUs - (sendTimeUs + roundTripUs / 2);
+    m_clockSamples[m_nextClockSample] = ClockSample{offsetUs, roundTripUs};
+    m_nextClockSample = (m_nextClockSample + 1) % kClockSampleCount;
+    if (m_validClockSamples < kClockSampleCount) {
+        ++m_validClockSamples;
+        if (m_validClockSamples == 1) {
+            kLogger.info()
+                    << "Clock offset to leader"
+                    << m_leaderAddress.toString()
+                    << "estimated as" << offsetUs << "us"
+                    << "(round trip" << roundTripUs << "us)";
+        }
+    }
+}
+
+bool LanSync::estimateClockOffsetUs(qint64* pOffsetUs) const {
+    if (m_validClockSamples == 0) {
+        return false;
+    }
+    // The sample with the smallest round trip suffered the least
+    // queueing delay and bounds the offset error most tightly.
+    const ClockSample* pBest = &m_clockSamples[0];
+    for (int i = 1; i < m_validClockSamples; ++i) {
+        if (m_clockSamples[i].roundTripUs < pBest->roundTripUs) {
+            pBest = &m_clockSamples[i];
+        }
+    }
+    *pOffsetUs = pBest->offsetUs;
+    return true;
+}
+
+void LanSync::handleBeacon(QDataStream* pStream) {
+    qint64 leaderTimeUs = 0;
+    double bpm = 0.0;
+    double beatDistance = 0.0;
+    *pStream >> leaderTimeUs >> bpm >> beatDistance;
+    if (pStream->status() != QDataStream::Ok) {
+        return;
+    }
+    if (bpm <= 0.0 || beatDistance < 0.0 || beatDistance > 1.0) {
+        return;
+    }
+    qint64 offsetUs = 0;
+    if (!estimateClockOffsetUs(&offsetUs)) {
+        // The clock offset is still unknown, probing has just started
+        return;
+    }
+
+    // Project the leader's beat distance from its send time to now
+    const qint64 beaconLocalTimeUs = leaderTimeUs - offsetUs;
+    const double ageSeconds =
+            static_cast<double>(localTimeUs() - beaconLocalTimeUs) / 1e6;
+    double projectedBeatDistance = beatDistance + ageSeconds * bpm / 60.0;
+    projectedBeatDistance -= std::floor(projectedBeatDistance);
+
+    if (std::abs(m_pClockBpm->get() - bpm) > kBpmEpsilon) {
+        m_pClockBpm->set(bpm);
+    }
+
+    double phaseError = projectedBeatDistance - m_pClockBeatDistance->get();
+    // Wrap into [-0.5, 0.5) so that errors across the beat boundary are
+    // corrected along the short way
+    phaseError -= std::round(phaseError);
+    if (std::abs(phaseError) * 60.0 / bpm > kPhaseToleranceSeconds) {
+        m_pClockBeatDistance->set(projectedBeatDistance);
+    }
+}
+
+} // namespace mixxx
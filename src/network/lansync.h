@@ -0,0 +1,98 @@
+#pragma once
+
+#include <QElapsedTimer>
+#include <QHostAddress>
+#include <QTimer>
+#include <QUdpSocket>
+#include <array>
+#include <memory>
+
+#include "preferences/usersettings.h"
+
+class ControlProxy;
+
+namespace mixxx {
+
+/// Opt-in replication of the internal clock between Mixxx instances on
+/// the local network, so that decks synced to the internal clock run
+/// phase-locked across machines, e.g. for back-to-back sets with two
+/// operators.
+///
+/// The leader instance broadcasts a small UDP beacon several times per
+/// second containing its monotonic send time together with the current
+/// [InternalClock] bpm and beat distance. A follower estimates the
+/// offset between its own monotonic clock and the leader's with
+/// NTP-style probe round trips (the sample with the smallest round trip
+/// time wins), projects each received beat distance to the local time
+/// of arrival and steers its own internal clock: the bpm is copied and
+/// the beat distance is snapped whenever the phase error exceeds one
+/// millisecond. Decks on the follower that sync to the internal clock
+/// thereby follow the leader's clock without any audio connection
+/// between the machines.
+///
+/// The follower learns the leader's address from the received beacons,
+/// so besides the role no addressing has to be configured. Beat phase,
+/// bpm and the offset estimation are exchanged stateless over UDP;
+/// a vanished leader simply leaves the follower's clock free-running
+/// at the last replicated tempo.
+///
+/// Configuration ([LanSync] group): Mode ("leader", "follower", default
+/// off) and Port (default 28472).
+class LanSync : public QObject {
+    Q_OBJECT
+  public:
+    explicit LanSync(UserSettingsPointer pConfig, QObject* parent = nullptr);
+    ~LanSync() override;
+
+  private slots:
+    void slotReadPendingDatagrams();
+    void slotSendBeacon();
+    void slotSendProbe();
+
+  private:
+    enum class Mode {
+        Disabled,
+        Leader,
+        Follower,
+    };
+
+    /// One completed probe round trip. The offset is only trustworthy
+    /// when the round trip was fast, so the round trip time is kept for
+    /// selecting the best sample.
+    struct ClockSample {
+        qint64 offsetUs;
+        qint64 roundTripUs;
+    };
+
+    static constexpr int kClockSampleCount = 8;
+
+    qint64 localTimeUs() const {
+        return m_uptime.nsecsElapsed() / 1000;
+    }
+
+    void handleBeacon(QDataStream* pStream);
+    void handleProbe(QDataStream* pStream,
+            const QHostAddress& senderAddress,
+            quint16 senderPort);
+    void handleProbeReply(QDataStream* pStream);
+    bool estimateClockOffsetUs(qint64* pOffsetUs) const;
+
+    Mode m_mode;
+    quint16 m_port;
+    QUdpSocket m_socket;
+    QTimer m_timer;
+    QElapsedTimer m_uptime;
+
+    std::unique_ptr<ControlProxy> m_pClockBpm;
+    std::unique_ptr<ControlProxy> m_pClockBeatDistance;
+
+    // Follower state: the leader as learned from received beacons and
+    // the ring buffer of completed probe round trips.
+    QHostAddress m_leaderAddress;
+    quint16 m_leaderPort;
+    std::array<ClockSample, kClockSampleCount> m_clockSamples;
+    int m_nextClockSample;
+    int m_validClockSamples;
+};
+
+} // namespace mixxx
@@ -0,0 +1,271 @@
+#include "network/osctelemetry.h"
+
+#include <QNetworkDatagram>
+#include <QtEndian>
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include "control/controlproxy.h"
+#include "mixer/playermanager.h"
+#include "moc_osctelemetry.cpp"
+#include "util/assert.h"
+#include "util/logger.h"
+#include "util/math.h"
+#include "waveform/visualplayposition.h"
+
+namespace mixxx {
+
+namespace {
+
+const Logger kLogger("OscTelemetry");
+
+constexpr int kDefaultPort = 9301;
+constexpr int kDefaultUpdateRateHz = 30;
+constexpr int kMinUpdateRateHz = 1;
+constexpr int kMaxUpdateRateHz = 60;
+
+// Subscriptions are refreshed by any datagram from the client and
+// expire when the client stays silent.
+constexpr qint64 kSubscriptionTimeoutMillis = 60 * 1000;
+constexpr int kMaxSubscribers = 8;
+
+// Upper bound for one serialized bundle: 16 bytes of bundle header
+// plus a size-prefixed message of at most 52 bytes per deck easily
+// fits for any realistic deck count.
+constexpr int kMaxBundleBytes = 2048;
+
+/// Minimal writer for OSC 1.0 payloads: scalars are big-endian,
+/// strings are NUL-terminated and padded to a multiple of four bytes.
+/// Appends into a fixed caller-provided buffer; the buffer is sized
+/// for the largest possible bundle, so running out of space is a
+/// programming error.
+class OscWriter {
+  public:
+    OscWriter(char* pData, int capacity)
+            : m_pData(pData),
+              m_capacity(capacity),
+              m_size(0) {
+    }
+
+    int size() const {
+        return m_size;
+    }
+
+    void writeString(const char* pString) {
+        const int length = static_cast<int>(std::strlen(pString)) + 1;
+        const int padded = (length + 3) & ~3;
+        VERIFY_OR_DEBUG_ASSERT(m_size + padded <= m_capacity) {
+            return;
+        }
+        std::memcpy(m_pData + m_size, pString, length);
+        std::memset(m_pData + m_size + length, 0, padded - length);
+        m_size += padded;
+    }
+
+    void writeInt32(qint32 value) {
+        VERIFY_OR_DEBUG_ASSERT(m_size + 4 <= m_capacity) {
+            return;
+        }
+        qToBigEndian(value, m_pData + m_size);
+        m_size += 4;
+    }
+
+    void writeUInt64(quint64 value) {
+        VERIFY_OR_DEBUG_ASSERT(m_size + 8 <= m_capacity) {
+            return;
+        }
+        qToBigEndian(value, m_pData + m_size);
+        m_size += 8;
+    }
+
+    void writeFloat32(float value) {
+        // OSC floats are the IEEE 754 bit pattern in big-endian order.
+        quint32 bits;
+        std::memcpy(&bits, &value, sizeof bits);
+        VERIFY_OR_DEBUG_ASSERT(m_size + 4 <= m_capacity) {
+            return;
+        }
+        qToBigEndian(bits, m_pData + m_size);
+        m_size += 4;
+    }
+
+    /// Patches a previously written int32, used for the size prefix of
+    /// bundle elements whose length is only known after serialization.
+    void patchInt32(int offset, qint32 value) {
+        VERIFY_OR_DEBUG_ASSERT(offset >= 0 && offset + 4 <= m_size) {
+            return;
+        }
+        qToBigEndian(value, m_pData + offset);
+    }
+
+  private:
+    char* m_pData;
+    int m_capacity;
+    int m_size;
+};
+
+} // anonymous namespace
+
+OscTelemetry::OscTelemetry(UserSettingsPointer pConfig,
+        PlayerManager* pPlayerManager,
+        QObject* parent)
+        : QObject(parent),
+          m_pPlayerManager(pPlayerManager) {
+    if (!pConfig->getValue(
+                ConfigKey(QStringLiteral("[Telemetry]"),
+                        QStringLiteral("OscEnabled")),
+                false)) {
+        return;
+    }
+
+    const int port = pConfig->getValue(
+            ConfigKey(QStringLiteral("[Telemetry]"), QStringLiteral("OscPort")),
+            kDefaultPort);
+    if (!m_socket.bind(QHostAddress::Any, static_cast<quint16>(port))) {
+        kLogger.warning()
+                << "Failed to bind UDP port" << port
+                << "- OSC telemetry is disabled:"
+                << m_socket.errorString();
+        return;
+    }
+    connect(&m_socket,
+            &QUdpSocket::readyRead,
+            this,
+            &OscTelemetry::slotReadPendingDatagrams);
+
+    const int updateRateHz = math_clamp(
+            pConfig->getValue(
+                    ConfigKey(QStringLiteral("[Telemetry]"),
+                            QStringLiteral("OscUpdateRateHz")),
+                    kDefaultUpdateRateHz),
+            kMinUpdateRateHz,
+            kMaxUpdateRateHz);
+
+    m_uptime.start();
+    connect(&m_timer,
+            &QTimer::timeout,
+            this,
+            &OscTelemetry::slotSendUpdate);
+    m_timer.start(1000 / updateRateHz);
+
+    kLogger.info()
+            << "Streaming OSC deck telemetry on UDP port" << port
+            << "at" << updateRateHz << "Hz";
+}
+
+OscTelemetry::~OscTelemetry() = default;
+
+void OscTelemetry::slotReadPendingDatagrams() {
+    const qint64 now = m_uptime.elapsed();
+    while (m_socket.hasPendingDatagrams()) {
+        const QNetworkDatagram datagram = m_socket.receiveDatagram();
+        if (!datagram.isValid()) {
+            continue;
+        }
+        auto it = std::find_if(m_subscribers.begin(),
+                m_subscribers.end(),
+                [&datagram](const Subscriber& subscriber) {
+                    return subscriber.address == datagram.senderAddress() &&
+                            subscriber.port == datagram.senderPort();
+                });
+        if (it != m_subscribers.end()) {
+            it->lastSeenMillis = now;
+            continue;
+        }
+        if (static_cast<int>(m_subscribers.size()) >= kMaxSubscribers) {
+            kLogger.warning()
+                    << "Ignoring subscription from"
+                    << datagram.senderAddress().toString()
+                    << "- the subscriber limit of" << kMaxSubscribers
+                    << "has been reached";
+            continue;
+        }
+        kLogger.info()
+                << "Client" << datagram.senderAddress().toString()
+                << "port" << datagram.senderPort()
+                << "subscribed to deck telemetry";
+        m_subscribers.push_back(Subscriber{datagram.senderAddress(),
+                static_cast<quint16>(datagram.senderPort()),
+                now});
+    }
+}
+
+void OscTelemetry::updateDeckStates() {
+    const int numDecks = m_pPlayerManager->numberOfDecks();
+    while (static_cast<int>(m_deckStates.size()) < numDecks) {
+        const int deckIndex = static_cast<int>(m_deckStates.size());
+        const QString group = PlayerManager::groupForDeck(deckIndex);
+        DeckState state;
+        state.oscAddress = (QStringLiteral("/mixxx/deck/%1")
+                                    .arg(deckIndex + 1))
+                                   .toUtf8();
+        state.pVisualPlayPosition =
+                VisualPlayPosition::getVisualPlayPosition(group);
+        state.pBpm = std::make_unique<ControlProxy>(
+                group, QStringLiteral("bpm"), this);
+        state.pKey = std::make_unique<ControlProxy>(
+                group, QStringLiteral("key"), this);
+        state.pVuMeter = std::make_unique<ControlProxy>(
+                group, QStringLiteral("vu_meter"), this);
+        m_deckStates.push_back(std::move(state));
+    }
+}
+
+void OscTelemetry::slotSendUpdate() {
+    const qint64 now = m_uptime.elapsed();
+    m_subscribers.erase(
+            std::remove_if(m_subscribers.begin(),
+                    m_subscribers.end(),
+                    [now](const Subscriber& subscriber) {
+                        return now - subscriber.lastSeenMillis >
+                                kSubscriptionTimeoutMillis;
+                    }),
+            m_subscribers.end());
+    if (m_subscribers.empty()) {
+        return;
+    }
+
+    updateDeckStates();
+
+    std::array<char, kMaxBundleBytes> buffer;
+    OscWriter writer(buffer.data(), static_cast<int>(buffer.size()));
+    writer.writeString("#bundle");
+    writer.writeUInt64(1); // Immediate time tag
+
+    for (const DeckState& state : m_deckStates) {
+        float playPosition = 0.0f;
+        float trackSeconds = 0.0f;
+        VisualPlayPositionData data;
+        if (state.pVisualPlayPosition->getSnapshot(&data)) {
+            playPosition = static_cast<float>(data.m_playPos);
+            trackSeconds = static_cast<float>(data.m_tempoTrackSeconds);
+        }
+        const float beatDistance = static_cast<float>(
+                state.pVisualPlayPosition->getBeatDistanceNow());
+
+        // The element size is only known after serializing the
+        // message, so write a placeholder and patch it afterwards.
+        const int sizeOffset = writer.size();
+        writer.writeInt32(0);
+        const int messageStart = writer.size();
+        writer.writeString(state.oscAddress.constData());
+        writer.writeString(",ffffff");
+        writer.writeFloat32(playPosition);
+        writer.writeFloat32(trackSeconds);
+        writer.writeFloat32(static_cast<float>(state.pBpm->get()));
+        writer.writeFloat32(static_cast<float>(state.pKey->get()));
+        writer.writeFloat32(beatDistance);
+        writer.writeFloat32(static_cast<float>(state.pVuMeter->get()));
+        writer.patchInt32(sizeOffset, writer.size() - messageStart);
+    }
+
+    for (const Subscriber& subscriber : m_subscribers) {
+        m_socket.writeDatagram(buffer.data(),
+                writer.size(),
+                subscriber.address,
+                subscriber.port);
+    }
+}
+
+} // namespace mixxx
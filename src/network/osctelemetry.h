@@ -0,0 +1,77 @@
+#pragma once
+
+#include <QElapsedTimer>
+#include <QHostAddress>
+#include <QSharedPointer>
+#include <QTimer>
+#include <QUdpSocket>
+#include <memory>
+#include <vector>
+
+#include "preferences/usersettings.h"
+
+class ControlProxy;
+class PlayerManager;
+class VisualPlayPosition;
+
+namespace mixxx {
+
+/// Opt-in OSC telemetry service for driving external visuals from the
+/// engine's state.
+///
+/// Once per update interval one OSC bundle is sent over UDP to every
+/// subscribed client, containing one message per deck:
+///
+///     /mixxx/deck/<n> ,ffffff <play position [0..1]> <track seconds>
+///                             <bpm> <key> <beat phase [0..1]> <vu>
+///
+/// Play position, track time and beat phase come from the deck's
+/// VisualPlayPosition snapshot, i.e. the same lock-free feed the
+/// waveforms render from, so no additional engine-side work is needed.
+/// Clients subscribe by sending an arbitrary datagram to the service's
+/// port and are dropped again after one minute of silence. Bundles are
+/// serialized into a fixed stack buffer, so steady-state operation does
+/// not allocate.
+///
+/// Configuration ([Telemetry] group): OscEnabled (default off), OscPort
+/// (default 9301) and OscUpdateRateHz (default 30, clamped to 1..60).
+class OscTelemetry : public QObject {
+    Q_OBJECT
+  public:
+    OscTelemetry(UserSettingsPointer pConfig,
+            PlayerManager* pPlayerManager,
+            QObject* parent = nullptr);
+    ~OscTelemetry() override;
+
+  private slots:
+    void slotReadPendingDatagrams();
+    void slotSendUpdate();
+
+  private:
+    struct Subscriber {
+        QHostAddress address;
+        quint16 port;
+        qint64 lastSeenMillis;
+    };
+
+    struct DeckState {
+        QByteArray oscAddress;
+        QSharedPointer<VisualPlayPosition> pVisualPlayPosition;
+        std::unique_ptr<ControlProxy> pBpm;
+        std::unique_ptr<ControlProxy> pKey;
+        std::unique_ptr<ControlProxy> pVuMeter;
+    };
+
+    /// Creates the per-deck proxies lazily, so that decks added after
+    /// startup are picked up on the next update.
+    void updateDeckStates();
+
+    PlayerManager* const m_pPlayerManager;
+    QUdpSocket m_socket;
+    QTimer m_timer;
+    QElapsedTimer m_uptime;
+    std::vector<DeckState> m_deckStates;
+    std::vector<Subscriber> m_subscribers;
+};
+
+} // namespace mixxx
@@ -2,6 +2,7 @@
 
 #include <QApplication>
 #include <QDir>
+#include <QFile>
 #include <QIODevice>
 #include <QTextStream>
 #include <QtDebug>
@@ -14,6 +15,12 @@
 // TODO(rryan): Move to a utility file.
 namespace {
 const QString kTempFilenameExtension = QStringLiteral(".tmp");
+const QString kJournalFilenameExtension = QStringLiteral(".journal");
+
+// One full rewrite per this many journaled changes keeps the journal (and
+// thus the startup replay) bounded without rewriting the whole file on
+// every change.
+constexpr int kMaxJournalRecords = 1000;
 const QString kCMakeCacheFile = QStringLiteral("CMakeCache.txt");
 const QLatin1String kSourceDirLine = QLatin1String("mixxx_SOURCE_DIR:STATIC=");
 
@@ -166,8 +173,24 @@ ConfigObject<ValueType>::~ConfigObject() {
 
 template<class ValueType>
 void ConfigObject<ValueType>::set(const ConfigKey& k, const ValueType& v) {
-    QWriteLocker lock(&m_valuesLock);
-    m_values.insert(k, v);
+    bool compactJournal = false;
+    {
+        QWriteLocker lock(&m_valuesLock);
+        const auto it = m_values.constFind(k);
+        if (it != m_values.constEnd() && it.value().value == v.value) {
+            // Unchanged, don't grow the journal.
+            return;
+        }
+        m_values.insert(k, v);
+        appendJournalRecord(QChar('+') + k.group + QChar(' ') +
+                k.item + QChar(' ') + v.value);
+        compactJournal = m_journalRecordCount >= kMaxJournalRecords;
+    }
+    if (compactJournal) {
+        // Fold the journal back into the config file outside of the lock,
+        // save() acquires it for reading itself.
+        save();
+    }
 }
 
 template<class ValueType>
@@ -185,7 +208,11 @@ bool ConfigObject<ValueType>::exists(const ConfigKey& k) const {
 template<class ValueType>
 bool ConfigObject<ValueType>::remove(const ConfigKey& k) {
     QWriteLocker lock(&m_valuesLock);
-    return m_values.remove(k) > 0;
+    const bool removed = m_values.remove(k) > 0;
+    if (removed) {
+        appendJournalRecord(QChar('-') + k.group + QChar(' ') + k.item);
+    }
+    return removed;
 }
 
 template<class ValueType>
@@ -239,9 +266,15 @@ bool ConfigObject<ValueType>::parse() {
 
 template<class ValueType>
 void ConfigObject<ValueType>::reopen(const QString& file) {
+    // Parsing and replaying go through set(), which must not journal the
+    // records it is just reading back.
+    m_journalEnabled = false;
+    m_pJournalFile.reset();
     m_filename = file;
     if (!m_filename.isEmpty()) {
         parse();
+        m_journalRecordCount = replayJournal();
+        m_journalEnabled = true;
     }
 }
 
@@ -315,9 +348,108 @@ bool ConfigObject<ValueType>::save() {
         return false;
     }
 
+    // The file just written contains every journaled change, so the journal
+    // can start over empty.
+    discardJournal();
+
     return true;
 }
 
+template<class ValueType>
+void ConfigObject<ValueType>::appendJournalRecord(const QString& record) {
+    if (!m_journalEnabled || m_filename.isEmpty()) {
+        return;
+    }
+    if (!m_pJournalFile) {
+        m_pJournalFile = std::make_unique<QFile>(m_filename + kJournalFilenameExtension);
+        if (!m_pJournalFile->open(QIODevice::Append | QIODevice::Text)) {
+            qWarning() << "Could not write config journal file:"
+                       << m_pJournalFile->fileName() << ":"
+                       << m_pJournalFile->errorString();
+            m_pJournalFile.reset();
+            return;
+        }
+    }
+    QTextStream stream(m_pJournalFile.get());
+    // UTF-8 is the default in Qt6.
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+    DEBUG_ASSERT(stream.encoding() == QStringConverter::Utf8);
+#else
+    stream.setCodec("UTF-8");
+#endif
+    stream << record << '\n';
+    stream.flush();
+    // Hand the record to the OS immediately so it survives a crash of the
+    // application. We deliberately do not fsync() here; durability against
+    // power loss is provided by the atomically replaced full file written
+    // by save().
+    m_pJournalFile->flush();
+    m_journalRecordCount++;
+}
+
+template<class ValueType>
+int ConfigObject<ValueType>::replayJournal() {
+    QFile journalFile(m_filename + kJournalFilenameExtension);
+    if (!journalFile.exists()) {
+        return 0;
+    }
+    if (!journalFile.open(QIODevice::ReadOnly)) {
+        qWarning() << "Could not read config journal file:"
+                   << journalFile.fileName() << ":" << journalFile.errorString();
+        return 0;
+    }
+    QTextStream text(&journalFile);
+    // UTF-8 is the default in Qt6.
+#if QT_VERSION >= QT_VERSION_CHECK(6, 0, 0)
+    DEBUG_ASSERT(text.encoding() == QStringConverter::Utf8);
+#else
+    text.setCodec("UTF-8");
+#endif
+    int recordCount = 0;
+    while (!text.atEnd()) {
+        const QString line = text.readLine().trimmed();
+        if (line.isEmpty()) {
+            continue;
+        }
+        const QChar opcode = line.at(0);
+        QString body = line.mid(1);
+        const int groupEnd = body.indexOf(']');
+        if ((opcode != '+' && opcode != '-') ||
+                !body.startsWith('[') || groupEnd < 0) {
+            // A torn final record is expected after a crash, skip it.
+            qWarning() << "Skipping malformed config journal record:" << line;
+            continue;
+        }
+        const QString group = body.left(groupEnd + 1);
+        body = body.mid(groupEnd + 1).trimmed();
+        QString item;
+        QTextStream(&body) >> item;
+        const ConfigKey key(group, item);
+        if (!key.isValid()) {
+            qWarning() << "Skipping malformed config journal record:" << line;
+            continue;
+        }
+        if (opcode == '+') {
+            const QString value = body.mid(item.length()).trimmed();
+            set(key, ValueType(value));
+        } else {
+            QWriteLocker lock(&m_valuesLock);
+            m_values.remove(key);
+        }
+        recordCount++;
+    }
+    qDebug() << "ConfigObject: Replayed" << recordCount
+             << "journal records from" << journalFile.fileName();
+    return recordCount;
+}
+
+template<class ValueType>
+void ConfigObject<ValueType>::discardJournal() {
+    m_pJournalFile.reset();
+    QFile::remove(m_filename + kJournalFilenameExtension);
+    m_journalRecordCount = 0;
+}
+
 template<class ValueType>
 QSet<QString> ConfigObject<ValueType>::getGroups() {
     QWriteLocker lock(&m_valuesLock);
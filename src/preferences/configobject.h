@@ -7,12 +7,15 @@
 #include <QMetaType>
 #include <QReadWriteLock>
 #include <QString>
+#include <memory>
 #include <type_traits>
 
 #include "util/assert.h"
 #include "util/compatibility/qhash.h"
 #include "util/debug.h"
 
+class QFile;
+
 // Class for the key for a specific configuration element. A key consists of a
 // group and an item.
 //
@@ -223,6 +226,26 @@ class ConfigObject {
     // Loads and parses the configuration file. Returns false if the file could
     // not be opened; otherwise true.
     bool parse();
+
+  private:
+    // Appends a single change record to the journal file next to the config
+    // file. Must be called with m_valuesLock held for writing.
+    void appendJournalRecord(const QString& record);
+    // Replays change records that were journaled after the last full save(),
+    // e.g. because the previous session crashed before its shutdown save.
+    // Returns the number of replayed records.
+    int replayJournal();
+    // Deletes the journal file. All journaled changes must already be part of
+    // the config file written by save().
+    void discardJournal();
+
+    // The journal makes individual set()/remove() calls crash-safe without
+    // rewriting the whole config file: each change is appended as one line
+    // and flushed, while save() remains the compaction point that folds the
+    // journal back into an atomically replaced config file.
+    std::unique_ptr<QFile> m_pJournalFile;
+    int m_journalRecordCount{};
+    bool m_journalEnabled{};
 };
 
 // Specialization must be declared before the first use that would cause
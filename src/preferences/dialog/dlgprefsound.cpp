@@ -156,6 +156,7 @@ DlgPrefSound::DlgPrefSound(QWidget* pParent,
 
     latencyCompensationSpinBox->setValue(m_pLatencyCompensation.get());
     latencyCompensationWarningLabel->setWordWrap(true);
+    sampleRateMismatchWarningLabel->hide();
     mainDelaySpinBox->setValue(m_pMainDelay.get());
     headDelaySpinBox->setValue(m_pHeadDelay.get());
     boothDelaySpinBox->setValue(m_pBoothDelay.get());
@@ -1080,6 +1081,52 @@ void DlgPrefSound::checkLatencyCompensation() {
         latencyCompensationSpinBox->setEnabled(false);
         latencyCompensationWarningLabel->hide();
     }
+
+    updateSampleRateMismatchWarning();
+}
+
+/// Warns when a selected device does not run natively at the configured
+/// sample rate. The sound API then resamples every stream of that device
+/// separately in the background, which costs CPU and adds latency that is
+/// invisible in the buffer size setting.
+void DlgPrefSound::updateSampleRateMismatchWarning() {
+    const mixxx::audio::SampleRate engineRate = m_config.getSampleRate();
+    const QSet<SoundDeviceId> selectedIds = m_config.getDevices();
+    QStringList mismatched;
+    auto collectMismatched = [&](const QList<SoundDevicePointer>& devices) {
+        for (const auto& pDevice : devices) {
+            if (!selectedIds.contains(pDevice->getDeviceId())) {
+                continue;
+            }
+            const mixxx::audio::SampleRate defaultRate = pDevice->getDefaultSampleRate();
+            if (!defaultRate.isValid() || defaultRate == engineRate) {
+                continue;
+            }
+            const QString entry = tr("%1 (%2 Hz)")
+                                          .arg(pDevice->getDisplayName(),
+                                                  QString::number(defaultRate.value()));
+            // A duplex device shows up in both the output and input list.
+            if (!mismatched.contains(entry)) {
+                mismatched.append(entry);
+            }
+        }
+    };
+    collectMismatched(m_outputDevices);
+    collectMismatched(m_inputDevices);
+
+    if (mismatched.isEmpty() || !engineRate.isValid()) {
+        sampleRateMismatchWarningLabel->hide();
+    } else {
+        sampleRateMismatchWarningLabel->setText(kWarningIconHtmlString +
+                tr("These devices do not run at %1 Hz natively: %2.")
+                        .arg(QString::number(engineRate.value()),
+                                mismatched.join(QStringLiteral(", "))) +
+                QStringLiteral("<br/>") +
+                tr("The sound API resamples each of their streams, which "
+                   "costs CPU and adds latency. Match the sample rate above "
+                   "to your devices to avoid this."));
+        sampleRateMismatchWarningLabel->show();
+    }
 }
 
 bool DlgPrefSound::okayToClose() const {
@@ -14,6 +14,7 @@ const char* kReplayGainAnalyzerVersion = "ReplayGainAnalyserVersion";
 const char* kReplayGainReanalyze = "ReplayGainReanalyze";
 
 const char* kReplayGainEnabled = "ReplayGainEnabled";
+const char* kLoudnessEnvelopeEnabled = "LoudnessEnvelopeEnabled";
 
 constexpr int kInitialDefaultBoostDefault = -6;
 } // anonymous namespace
@@ -85,6 +86,16 @@ void ReplayGainSettings::setReplayGainReanalyze(bool value) {
                 ConfigValue(value));
 }
 
+bool ReplayGainSettings::getLoudnessEnvelopeEnabled() const {
+    return m_pConfig->getValue(
+            ConfigKey(kConfigKey, kLoudnessEnvelopeEnabled), false);
+}
+
+void ReplayGainSettings::setLoudnessEnvelopeEnabled(bool value) {
+    m_pConfig->set(ConfigKey(kConfigKey, kLoudnessEnvelopeEnabled),
+            ConfigValue(value));
+}
+
 bool ReplayGainSettings::isAnalyzerEnabled(int version) const {
     return getReplayGainAnalyzerEnabled()
             && (version == getReplayGainAnalyzerVersion());
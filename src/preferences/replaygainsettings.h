@@ -19,6 +19,8 @@ class ReplayGainSettings {
     void setReplayGainAnalyzerVersion(int value);
     bool getReplayGainReanalyze() const;
     void setReplayGainReanalyze(bool value);
+    bool getLoudnessEnvelopeEnabled() const;
+    void setLoudnessEnvelopeEnabled(bool value);
 
     bool isAnalyzerEnabled(int version) const;
     bool isAnalyzerDisabled(int version, TrackPointer tio) const;
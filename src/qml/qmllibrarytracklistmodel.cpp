@@ -46,7 +46,9 @@ QmlLibraryTrackListModel::QmlLibraryTrackListModel(
         QAbstractItemModel* pModel,
         QObject* pParent)
         : QIdentityProxyModel(pParent),
-          m_columns() {
+          m_columns(),
+          m_pTrackModel(nullptr),
+          m_pTrackTableModel(nullptr) {
     m_columns.reserve(librarySource.size());
     for (const auto* pColumn : std::as_const(librarySource)) {
         m_columns.emplace_back(make_parented<QmlLibraryTrackListColumn>(this,
@@ -65,6 +67,8 @@ QmlLibraryTrackListModel::QmlLibraryTrackListModel(
     }
     pTrackModel->select();
     setSourceModel(pModel);
+    m_pTrackModel = pTrackModel;
+    m_pTrackTableModel = qobject_cast<BaseTrackTableModel*>(pModel);
 }
 
 QVariant QmlLibraryTrackListModel::data(const QModelIndex& proxyIndex, int role) const {
@@ -80,8 +84,8 @@ QVariant QmlLibraryTrackListModel::data(const QModelIndex& proxyIndex, int role)
         return {};
     }
 
-    auto* const pTrackTableModel = qobject_cast<BaseTrackTableModel*>(sourceModel());
-    auto* const pTrackModel = dynamic_cast<TrackModel*>(sourceModel());
+    auto* const pTrackTableModel = m_pTrackTableModel;
+    auto* const pTrackModel = m_pTrackModel;
 
     const auto& pColumn = m_columns[columnIdx];
 
@@ -168,7 +172,7 @@ QHash<int, QByteArray> QmlLibraryTrackListModel::roleNames() const {
 }
 
 QUrl QmlLibraryTrackListModel::getUrl(int row) const {
-    auto* const pTrackModel = dynamic_cast<TrackModel*>(sourceModel());
+    auto* const pTrackModel = m_pTrackModel;
 
     if (pTrackModel == nullptr) {
         // TODO search for column with role
@@ -178,7 +182,7 @@ QUrl QmlLibraryTrackListModel::getUrl(int row) const {
 }
 
 QmlTrackProxy* QmlLibraryTrackListModel::getTrack(int row) const {
-    auto* const pTrackModel = dynamic_cast<TrackModel*>(sourceModel());
+    auto* const pTrackModel = m_pTrackModel;
 
     if (pTrackModel == nullptr) {
         // TODO search for column with role
@@ -188,7 +192,7 @@ QmlTrackProxy* QmlLibraryTrackListModel::getTrack(int row) const {
 }
 
 TrackModel::Capabilities QmlLibraryTrackListModel::getCapabilities() const {
-    auto* const pTrackModel = dynamic_cast<TrackModel*>(sourceModel());
+    auto* const pTrackModel = m_pTrackModel;
 
     if (pTrackModel != nullptr) {
         return pTrackModel->getCapabilities();
@@ -207,9 +211,12 @@ void QmlLibraryTrackListModel::sort(int column, Qt::SortOrder order) {
             QAbstractItemModel::VerticalSortHint);
     if (pColumn->columnIdx() < 0) {
         // Use proxyIndex.column()
-        return sourceModel()->sort(column, order);
+        sourceModel()->sort(column, order);
+        emit layoutChanged(QList<QPersistentModelIndex>(),
+                QAbstractItemModel::VerticalSortHint);
+        return;
     }
-    auto* const pTrackTableModel = qobject_cast<BaseTrackTableModel*>(sourceModel());
+    auto* const pTrackTableModel = m_pTrackTableModel;
     sourceModel()->sort(pTrackTableModel != nullptr
                     ? pTrackTableModel->fieldIndex(
                               static_cast<ColumnCache::Column>(
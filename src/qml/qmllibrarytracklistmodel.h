@@ -6,6 +6,8 @@
 #include "qml/qmllibrarytracklistcolumn.h"
 #include "qml/qmltrackproxy.h"
 
+class BaseTrackTableModel;
+
 namespace mixxx {
 namespace qml {
 
@@ -79,6 +81,12 @@ class QmlLibraryTrackListModel : public QIdentityProxyModel {
   private:
     std::vector<parented_ptr<QmlLibraryTrackListColumn>> m_columns;
 
+    // Downcasts of sourceModel(), resolved once at construction. data() is
+    // called for every role of every delegate while scrolling, so it must
+    // not pay for RTTI lookups per call.
+    TrackModel* m_pTrackModel;
+    BaseTrackTableModel* m_pTrackTableModel;
+
     static void parent_qlist_append(
             QQmlListProperty<QmlLibraryTrackListColumn>* p,
             QmlLibraryTrackListColumn* v) {
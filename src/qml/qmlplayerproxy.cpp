@@ -7,6 +7,7 @@
 #include "moc_qmlplayerproxy.cpp"
 #include "qmltrackproxy.h"
 #include "track/track.h"
+#include "waveform/visualplayposition.h"
 
 namespace mixxx {
 namespace qml {
@@ -104,5 +105,14 @@ bool QmlPlayerProxy::isLoaded() const {
     return m_pCurrentTrack != nullptr;
 }
 
+double QmlPlayerProxy::beatDistance() const {
+    if (m_pTrackPlayer.isNull()) {
+        return -1.0;
+    }
+    // QML runs on the main thread, so getVisualPlayPosition() is safe here.
+    return VisualPlayPosition::getVisualPlayPosition(m_pTrackPlayer->getGroup())
+            ->getBeatDistanceNow();
+}
+
 } // namespace qml
 } // namespace mixxx
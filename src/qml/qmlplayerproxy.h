@@ -29,6 +29,12 @@ class QmlPlayerProxy : public QObject {
         return m_pTrackPlayer;
     }
 
+    /// Interpolated beat phase [0, 1) of this deck at the current time,
+    /// or -1.0 if no track with beats is loaded. Derived from
+    /// VisualPlayPosition, so per-frame animations can poll it without
+    /// any control traffic.
+    Q_INVOKABLE double beatDistance() const;
+
     Q_INVOKABLE void loadTrack(mixxx::qml::QmlTrackProxy* track, bool play = false);
     Q_INVOKABLE void loadTrackFromLocation(const QString& trackLocation, bool play = false);
     Q_INVOKABLE void loadTrackFromLocationUrl(const QUrl& trackLocationUrl, bool play = false);
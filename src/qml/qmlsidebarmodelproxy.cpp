@@ -43,6 +43,7 @@ void QmlSidebarModelProxy::activate(const QModelIndex& index) {
         VERIFY_OR_DEBUG_ASSERT(index.row() >= 0 && index.row() < m_sFeatures.length()) {
             return;
         }
+        m_sFeatures[index.row()]->ensureInitialized();
         m_sFeatures[index.row()]->activate();
     } else {
         TreeItem* pTreeItem = static_cast<TreeItem*>(index.internalPointer());
@@ -51,6 +52,7 @@ void QmlSidebarModelProxy::activate(const QModelIndex& index) {
         }
         LibraryFeature* pFeature = pTreeItem->feature();
         DEBUG_ASSERT(pFeature);
+        pFeature->ensureInitialized();
         pFeature->activateChild(index);
         pFeature->onLazyChildExpandation(index);
     }
@@ -73,8 +73,13 @@ std::chrono::microseconds QmlWaveformDisplay::fromTimerToNextSync(const Performa
 void QmlWaveformDisplay::slotFrameSwapped() {
     m_timer.restart();
 
-    // continuous redraw
-    update();
+    // Continuous redraw to follow the playback position, but only while a
+    // track is loaded. Without a track nothing position-dependent can change
+    // and the track load and waveform signals schedule the next update,
+    // which resumes the redraw loop.
+    if (getTrackInfo()) {
+        update();
+    }
 }
 
 void QmlWaveformDisplay::geometryChange(const QRectF& newGeometry, const QRectF& oldGeometry) {
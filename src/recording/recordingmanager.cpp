@@ -57,7 +57,7 @@ RecordingManager::RecordingManager(UserSettingsPointer pConfig, EngineMixer* pEn
                 &EngineRecord::durationRecorded,
                 this,
                 &RecordingManager::slotDurationRecorded);
-        pSidechain->addSideChainWorker(pEngineRecord);
+        pSidechain->addSideChainWorker(pEngineRecord, QStringLiteral("EngineRecord"));
     }
 }
 
@@ -0,0 +1,34 @@
+#include "offsetunicolormaterial.h"
+
+#include <QVector2D>
+
+#include "rendergraph/materialshader.h"
+#include "rendergraph/materialtype.h"
+#include "rendergraph/uniformset.h"
+
+using namespace rendergraph;
+
+OffsetUniColorMaterial::OffsetUniColorMaterial()
+        : Material(uniforms()) {
+}
+
+/* static */ const AttributeSet& OffsetUniColorMaterial::attributes() {
+    static AttributeSet set = makeAttributeSet<QVector2D>({"position"});
+    return set;
+}
+
+/* static */ const UniformSet& OffsetUniColorMaterial::uniforms() {
+    static UniformSet set = makeUniformSet<QMatrix4x4, QVector4D, QVector2D>(
+            {"ubuf.matrix", "ubuf.color", "ubuf.offset"});
+    return set;
+}
+
+MaterialType* OffsetUniColorMaterial::type() const {
+    static MaterialType type;
+    return &type;
+}
+
+std::unique_ptr<MaterialShader> OffsetUniColorMaterial::createShader() const {
+    return std::make_unique<MaterialShader>(
+            "offsetunicolor.vert", "offsetunicolor.frag", uniforms(), attributes());
+}
@@ -0,0 +1,23 @@
+#include "rendergraph/attributeset.h"
+#include "rendergraph/material.h"
+
+namespace rendergraph {
+class OffsetUniColorMaterial;
+}
+
+/// Like UniColorMaterial, but with an additional offset uniform that is
+/// added to the vertex positions in the vertex shader. This allows reuse
+/// of static geometry for content that merely scrolls: the vertices are
+/// uploaded once and only the offset uniform is updated per frame.
+class rendergraph::OffsetUniColorMaterial : public rendergraph::Material {
+  public:
+    OffsetUniColorMaterial();
+
+    static const AttributeSet& attributes();
+
+    static const UniformSet& uniforms();
+
+    MaterialType* type() const override;
+
+    std::unique_ptr<MaterialShader> createShader() const override;
+};
@@ -45,13 +45,17 @@ void Engine::remove(BaseNode* pNode) {
     }
 }
 
-void Engine::render() {
+void Engine::initialize() {
     if (!m_pInitializeNodes.empty()) {
         for (auto* pNode : m_pInitializeNodes) {
             pNode->initialize();
         }
         m_pInitializeNodes.clear();
     }
+}
+
+void Engine::render() {
+    initialize();
     if (m_pRootNode && !m_pRootNode->isSubtreeBlocked()) {
         render(m_pRootNode.get());
     }
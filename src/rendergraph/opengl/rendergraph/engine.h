@@ -15,6 +15,11 @@ class rendergraph::Engine {
     ~Engine();
 
     void render();
+    /// Initialize all nodes that have been added but not yet initialized.
+    /// This is called implicitly by render(), but can also be called
+    /// eagerly (with the OpenGL context current) to compile the shaders
+    /// of all materials used by the node tree ahead of the first render.
+    void initialize();
     void resize(int w, int h);
     void preprocess();
     void add(BaseNode* pNode);
@@ -1,5 +1,7 @@
 set(
   generated_shaders_gl
+  offsetunicolor.frag.gl
+  offsetunicolor.vert.gl
   pattern.frag.gl
   pattern.vert.gl
   rgb.frag.gl
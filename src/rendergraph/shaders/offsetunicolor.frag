@@ -0,0 +1,14 @@
+#version 440
+
+layout(std140, binding = 0) uniform buf {
+    highp mat4 matrix;
+    highp vec4 color;
+    highp vec2 offset;
+}
+ubuf;
+
+layout(location = 0) out vec4 fragColor;
+
+void main() {
+    fragColor = vec4(ubuf.color.xyz * ubuf.color.w, ubuf.color.w); // premultiply alpha
+}
@@ -0,0 +1,14 @@
+#version 440
+
+layout(std140, binding = 0) uniform buf {
+    highp mat4 matrix;
+    highp vec4 color;
+    highp vec2 offset;
+}
+ubuf;
+
+layout(location = 0) in vec4 position;
+
+void main() {
+    gl_Position = ubuf.matrix * (position + vec4(ubuf.offset, 0.0, 0.0));
+}
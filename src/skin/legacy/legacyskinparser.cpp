@@ -1,7 +1,10 @@
 #include "skin/legacy/legacyskinparser.h"
 
+#include <QDateTime>
 #include <QDir>
+#include <QFileInfo>
 #include <QGridLayout>
+#include <QHash>
 #include <QLabel>
 #include <QSplitter>
 #include <QStackedWidget>
@@ -23,6 +26,7 @@
 #include "moc_legacyskinparser.cpp"
 #include "skin/legacy/colorschemeparser.h"
 #include "skin/legacy/launchimage.h"
+#include "skin/legacy/skinassetpreloader.h"
 #include "skin/legacy/skincontext.h"
 #include "track/track.h"
 #include "util/assert.h"
@@ -102,6 +106,26 @@ QSet<QString> LegacySkinParser::s_sharedGroupStrings;
 
 static bool sDebug = false;
 
+namespace {
+
+// The parsed skin.xml document is requested several times while loading a
+// skin (launch image, scheme list, manifest, the actual widget parse) and
+// the template files are parsed again on every skin or scheme change.
+// Cache the parsed documents per file path and revalidate them against the
+// file's size and modification time, so only the first request pays for
+// reading and parsing the XML. QDom nodes are implicitly shared, so the
+// stored element keeps the whole document alive, just like the per-load
+// template cache.
+struct CachedSkinDocument {
+    QDateTime lastModified;
+    qint64 fileSize;
+    QDomElement documentElement;
+};
+
+QHash<QString, CachedSkinDocument> s_skinDocumentCache;
+
+} // namespace
+
 ControlObject* LegacySkinParser::controlFromConfigKey(
         const ConfigKey& key, bool bPersist, bool* pCreated) {
     if (!key.isValid()) {
@@ -226,6 +250,14 @@ QDomElement LegacySkinParser::openSkin(const QString& skinPath) {
     }
 
     QString skinXmlPath = skinDir.filePath("skin.xml");
+    const QFileInfo skinXmlInfo(skinXmlPath);
+    const auto it = s_skinDocumentCache.constFind(skinXmlPath);
+    if (it != s_skinDocumentCache.constEnd() &&
+            it->lastModified == skinXmlInfo.lastModified() &&
+            it->fileSize == skinXmlInfo.size()) {
+        return it->documentElement;
+    }
+
     QFile skinXmlFile(skinXmlPath);
 
     if (!skinXmlFile.open(QIODevice::ReadOnly)) {
@@ -256,6 +288,10 @@ QDomElement LegacySkinParser::openSkin(const QString& skinPath) {
     }
 
     skinXmlFile.close();
+    s_skinDocumentCache.insert(skinXmlPath,
+            CachedSkinDocument{skinXmlInfo.lastModified(),
+                    skinXmlInfo.size(),
+                    skin.documentElement()});
     return skin.documentElement();
 }
 
@@ -420,6 +456,11 @@ QWidget* LegacySkinParser::parseSkin(const QString& skinPath, QWidget* pParent)
 
     ColorSchemeParser::setupLegacyColorSchemes(skinDocument, m_pConfig, &m_style, m_pContext.get());
 
+    // Warm the image cache on a thread pool after the color scheme has
+    // installed its image loader, so the preloaded images already carry
+    // the scheme's color correction.
+    SkinAssetPreloader::preload(skinDocument, skinPath, m_pContext->getScaleFactor());
+
     // don't parent till here so the first opengl waveform doesn't screw
     // up --bkgood
     // I'm disregarding this return value because I want to return the
@@ -428,6 +469,9 @@ QWidget* LegacySkinParser::parseSkin(const QString& skinPath, QWidget* pParent)
     m_pParent = pParent;
     QList<QWidget*> widgets = parseNode(skinDocument);
 
+    // The preloaded images have been converted to pixmaps by now.
+    WPixmapStore::clearPreloadedImages();
+
     if (widgets.empty()) {
         SKIN_WARNING(skinDocument, *m_pContext, QStringLiteral("Skin produced no widgets!"));
         return nullptr;
@@ -1849,6 +1893,19 @@ QDomElement LegacySkinParser::loadTemplate(const QString& path) {
         return it.value();
     }
 
+    // A previous skin load may have parsed this template already. The shared
+    // cache outlives this parser instance, but unlike the per-instance cache
+    // above it is revalidated against the file on disk, so edited templates
+    // are picked up on the next skin reload.
+    const auto sharedIt = s_skinDocumentCache.constFind(absolutePath);
+    if (sharedIt != s_skinDocumentCache.constEnd() &&
+            sharedIt->lastModified == templateFileInfo.lastModified() &&
+            sharedIt->fileSize == templateFileInfo.size()) {
+        m_templateCache[absolutePath] = sharedIt->documentElement;
+        m_pContext->setSkinTemplatePath(templateFileInfo.absoluteDir().absolutePath());
+        return sharedIt->documentElement;
+    }
+
     QFile templateFile(absolutePath);
 
     if (!templateFile.open(QIODevice::ReadOnly)) {
@@ -1880,6 +1937,10 @@ QDomElement LegacySkinParser::loadTemplate(const QString& path) {
     }
 
     m_templateCache[absolutePath] = tmpl.documentElement();
+    s_skinDocumentCache.insert(absolutePath,
+            CachedSkinDocument{templateFileInfo.lastModified(),
+                    templateFileInfo.size(),
+                    tmpl.documentElement()});
     m_pContext->setSkinTemplatePath(templateFileInfo.absoluteDir().absolutePath());
     return tmpl.documentElement();
 }
@@ -0,0 +1,104 @@
+#include "skin/legacy/skinassetpreloader.h"
+
+#include <QDirIterator>
+#include <QDomDocument>
+#include <QFile>
+#include <QSet>
+#include <QtConcurrentMap>
+#include <QtDebug>
+
+#include "util/timer.h"
+#include "widget/wpixmapstore.h"
+
+namespace {
+
+// Only bitmap formats are preloaded. SVG sources are not decoded by
+// WPixmapStore but rendered lazily by QSvgRenderer at their target size.
+bool looksLikeBitmapPath(const QString& text) {
+    return text.endsWith(QStringLiteral(".png"), Qt::CaseInsensitive) ||
+            text.endsWith(QStringLiteral(".jpg"), Qt::CaseInsensitive) ||
+            text.endsWith(QStringLiteral(".jpeg"), Qt::CaseInsensitive) ||
+            text.endsWith(QStringLiteral(".bmp"), Qt::CaseInsensitive) ||
+            text.endsWith(QStringLiteral(".gif"), Qt::CaseInsensitive);
+}
+
+// Mirrors SkinContext::makeSkinPath() so that the preloaded images are
+// stored under exactly the path string the widgets will request later.
+QString makeSkinPath(const QString& relativePath) {
+    if (relativePath.isEmpty() || relativePath.startsWith("/") ||
+            relativePath.contains(":")) {
+        return relativePath;
+    }
+    return QString("skin:").append(relativePath);
+}
+
+// Collects the text of all leaf elements that look like bitmap paths.
+// Paths that are composed from skin variables contain child elements
+// (e.g. <Variable name="..."/>) and are skipped on purpose, since their
+// value is only known at parse time.
+void collectImagePaths(const QDomElement& element, QSet<QString>* pPaths) {
+    QDomElement child = element.firstChildElement();
+    if (child.isNull()) {
+        const QString text = element.text().trimmed();
+        if (looksLikeBitmapPath(text)) {
+            const QString path = makeSkinPath(text);
+            if (QFile::exists(path)) {
+                pPaths->insert(path);
+            }
+        }
+        return;
+    }
+    while (!child.isNull()) {
+        collectImagePaths(child, pPaths);
+        child = child.nextSiblingElement();
+    }
+}
+
+} // namespace
+
+// static
+void SkinAssetPreloader::preload(const QDomElement& skinDocument,
+        const QString& skinPath,
+        double scaleFactor) {
+    ScopedTimer timer(QStringLiteral("SkinAssetPreloader::preload"));
+
+    // The QSet deduplicates assets that are referenced once per deck.
+    QSet<QString> paths;
+    collectImagePaths(skinDocument, &paths);
+
+    // Templates are only pulled in while their <Template> nodes are
+    // parsed, which is too late for preloading. Scan all template files
+    // of the skin up front instead. Files that are never instantiated
+    // merely waste a decode, they do not affect correctness.
+    QDirIterator it(skinPath,
+            QStringList{QStringLiteral("*.xml")},
+            QDir::Files,
+            QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        const QString filePath = it.next();
+        if (it.fileName() == QStringLiteral("skin.xml")) {
+            // Already covered by the parsed skin document.
+            continue;
+        }
+        QFile file(filePath);
+        if (!file.open(QIODevice::ReadOnly)) {
+            continue;
+        }
+        QDomDocument document;
+        if (document.setContent(&file)) {
+            collectImagePaths(document.documentElement(), &paths);
+        }
+    }
+
+    if (paths.isEmpty()) {
+        return;
+    }
+
+    const QStringList pathList(paths.begin(), paths.end());
+    QtConcurrent::blockingMap(pathList,
+            [scaleFactor](const QString& path) {
+                WPixmapStore::preloadImage(path, scaleFactor);
+            });
+    qDebug() << "SkinAssetPreloader preloaded" << pathList.size()
+             << "skin images";
+}
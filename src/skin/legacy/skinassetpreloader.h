@@ -0,0 +1,27 @@
+#pragma once
+
+#include <QDomElement>
+#include <QString>
+
+/// Decodes the bitmap assets referenced by a skin on a thread pool before
+/// the widgets are constructed.
+///
+/// LegacySkinParser builds widgets serially and each widget decodes its
+/// pixmaps on creation, so image decoding accounts for a large share of
+/// the skin-load wall time. The preloader scans the skin document and all
+/// template files for image paths and warms the WPixmapStore image cache
+/// in parallel, deduplicating assets that are shared across decks. Widget
+/// construction then only converts the preloaded images to pixmaps.
+///
+/// The scan is a best effort: paths that are assembled from skin
+/// variables at parse time cannot be predicted and simply fall back to
+/// the synchronous load in WPixmapStore.
+class SkinAssetPreloader {
+  public:
+    static void preload(const QDomElement& skinDocument,
+            const QString& skinPath,
+            double scaleFactor);
+
+  private:
+    SkinAssetPreloader() = delete;
+};
@@ -0,0 +1,129 @@
+#include "skin/skinbindinggraph.h"
+
+#include "moc_skinbindinggraph.cpp"
+#include "util/assert.h"
+#include "util/valuetransformer.h"
+
+SkinBindingGraph::SkinBindingGraph(QObject* pParent)
+        : QObject(pParent),
+          m_sweepPending(false),
+          m_sweepCount(0) {
+}
+
+SkinBindingGraph::NodeId SkinBindingGraph::addInput(const ConfigKey& key) {
+    const NodeId id = static_cast<NodeId>(m_nodes.size());
+    Node node;
+    node.pInput = make_parented<ControlProxy>(key, this);
+    node.value = node.pInput->get();
+    node.pInput->connectValueChanged(this, [this, id](double value) {
+        Node& inputNode = m_nodes[id];
+        if (value == inputNode.value) {
+            return;
+        }
+        inputNode.value = value;
+        markDependentsDirty(id);
+        scheduleSweep();
+    });
+    m_nodes.push_back(std::move(node));
+    return id;
+}
+
+SkinBindingGraph::NodeId SkinBindingGraph::addBinding(
+        std::vector<NodeId> dependencies,
+        Expression expression,
+        std::function<void(double)> onValueChanged) {
+    DEBUG_ASSERT(expression);
+    const NodeId id = static_cast<NodeId>(m_nodes.size());
+    for (const NodeId dependency : dependencies) {
+        // Dependencies must already exist, which keeps the graph
+        // acyclic and the insertion order topological.
+        VERIFY_OR_DEBUG_ASSERT(dependency >= 0 && dependency < id) {
+            return -1;
+        }
+    }
+    Node node;
+    node.dependencies = std::move(dependencies);
+    node.expression = std::move(expression);
+    node.onValueChanged = std::move(onValueChanged);
+    for (const NodeId dependency : node.dependencies) {
+        m_nodes[dependency].dependents.push_back(id);
+    }
+    // Evaluate once so that the initial value is consistent with the
+    // current input values.
+    m_dependencyValues.clear();
+    for (const NodeId dependency : node.dependencies) {
+        m_dependencyValues.push_back(m_nodes[dependency].value);
+    }
+    node.value = node.expression(m_dependencyValues);
+    m_nodes.push_back(std::move(node));
+    m_bindingOrder.push_back(id);
+    return id;
+}
+
+SkinBindingGraph::NodeId SkinBindingGraph::addTransformedBinding(
+        NodeId input,
+        std::shared_ptr<ValueTransformer> pTransformer,
+        std::function<void(double)> onValueChanged) {
+    DEBUG_ASSERT(pTransformer);
+    return addBinding(
+            {input},
+            [pTransformer = std::move(pTransformer)](
+                    std::span<const double> values) {
+                return pTransformer->transform(values.front());
+            },
+            std::move(onValueChanged));
+}
+
+double SkinBindingGraph::value(NodeId node) const {
+    VERIFY_OR_DEBUG_ASSERT(node >= 0 &&
+            node < static_cast<NodeId>(m_nodes.size())) {
+        return 0.0;
+    }
+    return m_nodes[node].value;
+}
+
+void SkinBindingGraph::markDependentsDirty(NodeId node) {
+    for (const NodeId dependent : m_nodes[node].dependents) {
+        m_nodes[dependent].dirty = true;
+        // Transitive dependents are only marked during the sweep if the
+        // re-evaluated value actually changed.
+    }
+}
+
+void SkinBindingGraph::scheduleSweep() {
+    if (m_sweepPending) {
+        return;
+    }
+    m_sweepPending = true;
+    // Queued behind the signal deliveries that are already pending in
+    // this event loop iteration, so a burst of control changes is
+    // collapsed into a single sweep.
+    QMetaObject::invokeMethod(this, &SkinBindingGraph::sweep, Qt::QueuedConnection);
+}
+
+void SkinBindingGraph::sweep() {
+    m_sweepPending = false;
+    ++m_sweepCount;
+    for (const NodeId id : m_bindingOrder) {
+        Node& node = m_nodes[id];
+        if (!node.dirty) {
+            continue;
+        }
+        node.dirty = false;
+        m_dependencyValues.clear();
+        for (const NodeId dependency : node.dependencies) {
+            m_dependencyValues.push_back(m_nodes[dependency].value);
+        }
+        const double newValue = node.expression(m_dependencyValues);
+        if (newValue == node.value) {
+            continue;
+        }
+        node.value = newValue;
+        // Dependents come later in the topological order and are
+        // re-evaluated within this very sweep.
+        markDependentsDirty(id);
+        if (node.onValueChanged) {
+            node.onValueChanged(newValue);
+        }
+    }
+}
@@ -0,0 +1,195 @@
+#include "soundio/loopbacklatencytest.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "moc_loopbacklatencytest.cpp"
+#include "util/logger.h"
+#include "util/math.h"
+
+namespace {
+
+const mixxx::Logger kLogger("LoopbackLatencyTest");
+
+const QString kAppGroup = QStringLiteral("[App]");
+
+// 1 kHz sits in the passband of every loopback path. The burst is a
+// cosine, so it starts at full amplitude and its onset crosses the
+// detection threshold on the very first sample.
+constexpr double kBurstFreqHz = 1000.0;
+constexpr double kBurstSeconds = 0.005;
+constexpr CSAMPLE kBurstAmplitude = 0.5f;
+// Well below the burst amplitude even after moderate attenuation in the
+// loopback path, well above the noise floor of a line connection.
+constexpr CSAMPLE kDetectionThreshold = 0.1f;
+// A burst that has not come back after a second never will.
+constexpr double kTrialTimeoutSeconds = 1.0;
+// Pause between bursts so echoes of the previous one have died down
+// before the next onset is awaited.
+constexpr double kTrialGapSeconds = 0.5;
+
+} // anonymous namespace
+
+LoopbackLatencyTest::LoopbackLatencyTest()
+        : m_startControl(ConfigKey(kAppGroup, QStringLiteral("loopback_latency_test"))),
+          m_latencyMillisControl(ConfigKey(kAppGroup, QStringLiteral("loopback_latency_ms"))),
+          m_state(kStateIdle),
+          m_detectedLatencyFrames(-1),
+          m_inputFramesSinceEmit(0),
+          m_emitPosFrames(0),
+          m_burstFrames(0),
+          m_outputFramesSinceEmit(0),
+          m_timeoutFrames(0),
+          m_gapFramesRemaining(0),
+          m_completedTrials(0),
+          m_numSuccesses(0) {
+    m_latencyMillisControl.set(-1.0);
+    connect(&m_startControl,
+            &ControlObject::valueChanged,
+            this,
+            &LoopbackLatencyTest::slotStartRequested);
+    // The result is set from the output callback thread; log it from the
+    // main thread where blocking I/O is harmless.
+    connect(&m_latencyMillisControl,
+            &ControlObject::valueChanged,
+            this,
+            &LoopbackLatencyTest::slotLatencyChanged);
+}
+
+void LoopbackLatencyTest::slotStartRequested(double v) {
+    if (v <= 0) {
+        return;
+    }
+    if (isActive()) {
+        kLogger.warning() << "Measurement already running, ignoring trigger";
+        return;
+    }
+    if (!m_sampleRate.isValid()) {
+        kLogger.warning() << "No sound devices are open, cannot measure";
+        return;
+    }
+    kLogger.info() << "Starting loopback latency measurement, route the main"
+                   << "output into any configured input";
+    m_completedTrials = 0;
+    m_numSuccesses = 0;
+    m_state.storeRelease(kStateStartTrial);
+}
+
+void LoopbackLatencyTest::slotLatencyChanged(double latencyMillis) {
+    if (latencyMillis < 0) {
+        kLogger.warning() << "Loopback latency measurement failed, no burst"
+                          << "detected on any input";
+        return;
+    }
+    kLogger.info() << "Measured output-to-input round trip latency of"
+                   << latencyMillis << "ms";
+}
+
+void LoopbackLatencyTest::abort() {
+    if (!isActive()) {
+        return;
+    }
+    kLogger.info() << "Devices closed, aborting loopback latency measurement";
+    m_state.storeRelease(kStateIdle);
+}
+
+void LoopbackLatencyTest::finishTrial(double latencyMillis) {
+    if (latencyMillis >= 0) {
+        m_trialLatenciesMillis[m_numSuccesses++] = latencyMillis;
+    }
+    m_completedTrials++;
+    if (m_completedTrials < kNumTrials) {
+        m_gapFramesRemaining = static_cast<SINT>(m_sampleRate * kTrialGapSeconds);
+        m_state.storeRelease(kStateGap);
+        return;
+    }
+    double result = -1.0;
+    if (m_numSuccesses > 0) {
+        std::sort(m_trialLatenciesMillis, m_trialLatenciesMillis + m_numSuccesses);
+        result = m_trialLatenciesMillis[m_numSuccesses / 2];
+    }
+    m_latencyMillisControl.set(result);
+    m_state.storeRelease(kStateIdle);
+}
+
+void LoopbackLatencyTest::processOutput(
+        std::span<CSAMPLE> mainBuffer, SINT framesPerBuffer) {
+    int state = m_state.loadAcquire();
+    if (state == kStateIdle) {
+        // The measurement may have been aborted after the caller's
+        // isActive() check.
+        return;
+    }
+    if (state == kStateGap) {
+        m_gapFramesRemaining -= framesPerBuffer;
+        if (m_gapFramesRemaining > 0) {
+            return;
+        }
+        state = kStateStartTrial;
+    }
+    if (state == kStateStartTrial) {
+        m_emitPosFrames = 0;
+        m_burstFrames = static_cast<SINT>(m_sampleRate * kBurstSeconds);
+        m_outputFramesSinceEmit = 0;
+        m_timeoutFrames = static_cast<SINT>(m_sampleRate * kTrialTimeoutSeconds);
+        m_detectedLatencyFrames.storeRelease(-1);
+        // Publish the counter reset before the input callbacks may see
+        // the emitting state.
+        m_inputFramesSinceEmit.storeRelease(0);
+        m_state.storeRelease(kStateEmitting);
+        state = kStateEmitting;
+    }
+    if (state == kStateEmitting) {
+        const SINT burstFramesInBuffer = math_min(
+                m_burstFrames - m_emitPosFrames, framesPerBuffer);
+        for (SINT frame = 0; frame < burstFramesInBuffer; ++frame) {
+            const CSAMPLE sample = kBurstAmplitude *
+                    static_cast<CSAMPLE>(std::cos(2.0 * M_PI * kBurstFreqHz *
+                            (m_emitPosFrames + frame) / m_sampleRate));
+            mainBuffer[frame * 2] += sample;
+            mainBuffer[frame * 2 + 1] += sample;
+        }
+        m_emitPosFrames += burstFramesInBuffer;
+        if (m_emitPosFrames >= m_burstFrames) {
+            m_state.storeRelease(kStateListening);
+        }
+    }
+    // The burst may already come back while the tail of it is still being
+    // emitted, so poll for a detection in both states.
+    const int detectedFrames = m_detectedLatencyFrames.loadAcquire();
+    if (detectedFrames >= 0) {
+        finishTrial(detectedFrames * 1000.0 / m_sampleRate);
+        return;
+    }
+    m_outputFramesSinceEmit += framesPerBuffer;
+    if (m_outputFramesSinceEmit > m_timeoutFrames) {
+        finishTrial(-1.0);
+    }
+}
+
+void LoopbackLatencyTest::processInput(
+        const QList<AudioInputBuffer>& inputs, SINT framesPerBuffer) {
+    const int state = m_state.loadAcquire();
+    if (state != kStateEmitting && state != kStateListening) {
+        return;
+    }
+    if (m_detectedLatencyFrames.loadAcquire() >= 0) {
+        // Already detected, maybe on another input.
+        return;
+    }
+    const SINT framesSinceEmit = m_inputFramesSinceEmit.loadAcquire();
+    for (const AudioInputBuffer& in : inputs) {
+        const CSAMPLE* pBuffer = in.getBuffer(); // Always stereo
+        for (SINT i = 0; i < framesPerBuffer * 2; ++i) {
+            if (std::abs(pBuffer[i]) >= kDetectionThreshold) {
+                m_detectedLatencyFrames.storeRelease(
+                        static_cast<int>(framesSinceEmit + i / 2));
+                return;
+            }
+        }
+    }
+    // All input buffers of one device cover the same frames, so advance
+    // once per callback, not once per input.
+    m_inputFramesSinceEmit.storeRelease(
+            static_cast<int>(framesSinceEmit + framesPerBuffer));
+}
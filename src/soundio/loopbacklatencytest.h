@@ -0,0 +1,111 @@
+#pragma once
+
+#include <QAtomicInt>
+#include <QObject>
+#include <span>
+
+#include "audio/types.h"
+#include "control/controlobject.h"
+#include "control/controlpushbutton.h"
+#include "soundio/soundmanagerutil.h"
+#include "util/types.h"
+
+/// Measures the end-to-end output-to-input latency of the active sound
+/// configuration through a physical loopback connection (a cable or mixer
+/// routing from the main output into any configured input): a short sine
+/// burst is overlaid onto the main output and the input frames until its
+/// onset reappears are counted. The round trip covers the engine buffer,
+/// both driver buffers and the converters of the device, i.e. everything
+/// between Mixxx and the air except the engine's processing itself.
+///
+/// The measurement is started with the [App],loopback_latency_test push
+/// button and runs several bursts; the median round trip is published in
+/// milliseconds as [App],loopback_latency_ms (-1.0 while unknown or when
+/// no burst came back). Counting input frames is sample accurate for a
+/// loopback on a single (e.g. duplex) device; with inputs open on several
+/// devices the frame counter advances for each device's callback and the
+/// result is not meaningful.
+///
+/// The onset detection is a plain threshold, so the measurement has to
+/// run while the decks are silent and no signal is present on the other
+/// inputs: anything above the threshold is taken for the burst.
+class LoopbackLatencyTest : public QObject {
+    Q_OBJECT
+  public:
+    LoopbackLatencyTest();
+
+    /// Sample rate of the active configuration, set by SoundManager after
+    /// the devices have been opened. Must not be called while a
+    /// measurement is running (SoundManager closes the devices and calls
+    /// abort() before any reconfiguration).
+    void setSampleRate(mixxx::audio::SampleRate sampleRate) {
+        m_sampleRate = sampleRate;
+    }
+
+    /// Cancels a running measurement without publishing a result. Called
+    /// when the devices are closed and the remaining bursts could never
+    /// come back.
+    void abort();
+
+    /// Cheap check for the audio callbacks to skip all test work in the
+    /// common idle case.
+    bool isActive() const {
+        return m_state.loadAcquire() != kStateIdle;
+    }
+
+    /// Called by SoundManager from the clock reference output callback
+    /// with the freshly mixed main output buffer (interleaved stereo).
+    /// Overlays the burst and sequences the trials.
+    void processOutput(std::span<CSAMPLE> mainBuffer, SINT framesPerBuffer);
+
+    /// Called by SoundManager from an input callback with the device's
+    /// input buffers (interleaved stereo each) before they are routed to
+    /// their destinations. Scans for the burst onset.
+    void processInput(const QList<AudioInputBuffer>& inputs, SINT framesPerBuffer);
+
+  private slots:
+    void slotStartRequested(double v);
+    void slotLatencyChanged(double latencyMillis);
+
+  private:
+    // Trial sequencing states, owned by the output callback thread except
+    // for the Idle -> StartTrial transition in slotStartRequested().
+    enum State {
+        kStateIdle = 0,
+        kStateStartTrial,
+        kStateEmitting,
+        kStateListening,
+        kStateGap,
+    };
+
+    // Bursts per measurement; the published latency is their median, so a
+    // single burst lost in a glitch or detected early on a noisy line
+    // does not spoil the result.
+    static constexpr int kNumTrials = 5;
+
+    void finishTrial(double latencyMillis);
+
+    ControlPushButton m_startControl;
+    ControlObject m_latencyMillisControl;
+
+    mixxx::audio::SampleRate m_sampleRate;
+
+    QAtomicInt m_state;
+    // Round trip of the current trial in frames, published by the input
+    // callback thread and consumed by the output callback thread.
+    // -1 while no onset has been detected.
+    QAtomicInt m_detectedLatencyFrames;
+    // Input frames elapsed since the first burst sample was emitted.
+    QAtomicInt m_inputFramesSinceEmit;
+
+    // State below is only touched by the output callback thread while a
+    // measurement is running and by slotStartRequested() while idle.
+    SINT m_emitPosFrames;
+    SINT m_burstFrames;
+    SINT m_outputFramesSinceEmit;
+    SINT m_timeoutFrames;
+    SINT m_gapFramesRemaining;
+    int m_completedTrials;
+    int m_numSuccesses;
+    double m_trialLatenciesMillis[kNumTrials];
+};
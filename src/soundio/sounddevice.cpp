@@ -15,7 +15,8 @@ SoundDevice::SoundDevice(UserSettingsPointer config, SoundManager* sm)
           m_numInputChannels(mixxx::audio::ChannelCount::stereo()),
           m_sampleRate(SoundManagerConfig::kMixxxDefaultSampleRate),
           m_hostAPI("Unknown API"),
-          m_configFramesPerBuffer(0) {
+          m_configFramesPerBuffer(0),
+          m_headphoneMonitorMode(false) {
 }
 
 mixxx::audio::ChannelCount SoundDevice::getNumInputChannels() const {
@@ -41,6 +42,10 @@ void SoundDevice::setConfigFramesPerBuffer(unsigned int framesPerBuffer) {
     m_configFramesPerBuffer = framesPerBuffer;
 }
 
+void SoundDevice::setHeadphoneMonitorMode(bool enabled) {
+    m_headphoneMonitorMode = enabled;
+}
+
 SoundDeviceStatus SoundDevice::addOutput(const AudioOutputBuffer& out) {
     // Check if the output channels are already used
     foreach (AudioOutputBuffer myOut, m_audioOutputs) {
@@ -101,8 +106,23 @@ void SoundDevice::composeOutputBuffer(CSAMPLE* outputBuffer,
         SampleUtil::copyClampBuffer(outputBuffer, pAudioOutputBuffer,
                framesToCompose * 2);
     } else {
-        // Reset sample for each open channel
-        SampleUtil::clear(outputBuffer, framesToCompose * iFrameSize);
+        // Only clear channels that no output is routed to. In the common
+        // multi-output case (e.g. main + headphone on one 4-channel card)
+        // every channel is written below anyway and clearing the whole
+        // buffer first just burns memory bandwidth in the callback.
+        // addOutput() rejects overlapping channel groups, so the outputs
+        // cover the whole frame iff their channel counts sum up to the
+        // frame size.
+        SINT routedChannels = 0;
+        for (auto i = m_audioOutputs.constBegin(),
+                     e = m_audioOutputs.constEnd();
+                i != e;
+                ++i) {
+            routedChannels += i->getChannelGroup().getChannelCount();
+        }
+        if (routedChannels != iFrameSize) {
+            SampleUtil::clear(outputBuffer, framesToCompose * iFrameSize);
+        }
 
         for (QList<AudioOutputBuffer>::iterator i = m_audioOutputs.begin(),
                      e = m_audioOutputs.end(); i != e; ++i) {
@@ -126,6 +146,21 @@ void SoundDevice::composeOutputBuffer(CSAMPLE* outputBuffer,
                             (pAudioOutputBuffer[iFrameNo * 2] +
                                     pAudioOutputBuffer[iFrameNo * 2 + 1]) / 2.0f);
                 }
+            } else if (iChannelCount == 2) {
+                // Nearly all outputs are stereo buses (main, booth,
+                // headphone, deck outputs), so interleave them with a
+                // dedicated strided loop the compiler can vectorize
+                // instead of the generic per-channel loop below.
+                for (SINT iFrameNo = 0; iFrameNo < framesToCompose; ++iFrameNo) {
+                    const SINT iFrameBase = iFrameNo * iFrameSize;
+                    const SINT iLocalFrameBase = iFrameNo * 2;
+                    outputBuffer[iFrameBase + iChannelBase] =
+                            SampleUtil::clampSample(
+                                    pAudioOutputBuffer[iLocalFrameBase]);
+                    outputBuffer[iFrameBase + iChannelBase + 1] =
+                            SampleUtil::clampSample(
+                                    pAudioOutputBuffer[iLocalFrameBase + 1]);
+                }
             } else {
                 for (SINT iFrameNo = 0; iFrameNo < framesToCompose; ++iFrameNo) {
                     // iFrameBase is the "base sample" in a frame (ie. the first
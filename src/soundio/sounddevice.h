@@ -31,6 +31,7 @@ class SoundDevice {
     }
     void setSampleRate(mixxx::audio::SampleRate sampleRate);
     void setConfigFramesPerBuffer(unsigned int framesPerBuffer);
+    void setHeadphoneMonitorMode(bool enabled);
     virtual SoundDeviceStatus open(bool isClkRefDevice, int syncBuffers) = 0;
     virtual bool isOpen() const = 0;
     virtual SoundDeviceStatus close() = 0;
@@ -88,6 +89,11 @@ class SoundDevice {
     // configuring the audio devices. The actual runtime buffer size should be
     // used for any computations working with audio.
     SINT m_configFramesPerBuffer;
+    // True if this device carries only the headphone output and is synced
+    // to the clock reference device, in which case the device may run its
+    // stream on a smaller buffer than the engine to tighten monitoring
+    // latency. See SoundDevicePortAudio::open().
+    bool m_headphoneMonitorMode;
     QList<AudioOutputBuffer> m_audioOutputs;
     QList<AudioInputBuffer> m_audioInputs;
 };
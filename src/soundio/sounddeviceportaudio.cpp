@@ -12,11 +12,13 @@
 #include "soundio/sounddevice.h"
 #include "soundio/soundmanager.h"
 #include "soundio/soundmanagerutil.h"
+#include "util/allocationguard.h"
 #include "util/defs.h"
 #include "util/denormalsarezero.h"
 #include "util/fifo.h"
 #include "util/math.h"
 #include "util/sample.h"
+#include "util/threadtopology.h"
 #include "util/timer.h"
 #include "util/trace.h"
 #include "waveform/visualplayposition.h"
@@ -43,6 +45,15 @@ constexpr int kFifoSize = 2 * kDriftReserve + 1;
 
 constexpr int kCpuUsageUpdateRate = 30; // in 1/s, fits to display frame rate
 
+// A headphone-only output device that is synced to the clock reference via
+// the drift-compensated FIFO runs its stream on this fraction of the
+// engine's configured buffer size to tighten monitoring latency.
+constexpr SINT kHeadphoneBufferDivisor = 4;
+
+// Do not let the reduced headphone monitoring buffer drop below this size;
+// tiny buffers only increase the callback rate without a latency benefit.
+constexpr SINT kMinHeadphoneFramesPerBuffer = 16;
+
 // We warn only at invalid timing 3, since the first two
 // callbacks can be always wrong due to a setup/open jitter
 constexpr int m_invalidTimeInfoWarningCount = 3;
@@ -235,6 +246,19 @@ SoundDeviceStatus SoundDevicePortAudio::open(bool isClkRefDevice, int syncBuffer
     } else {
         qDebug() << "framesPerBuffer:" << framesPerBuffer;
     }
+    if (m_headphoneMonitorMode && !isClkRefDevice && syncBuffers == 2 &&
+            framesPerBuffer != static_cast<SINT>(paFramesPerBufferUnspecified)) {
+        // This device carries only the headphone output and is fed through
+        // the drift-compensated FIFO below, which decouples its stream from
+        // the clock reference device. Open the stream on a fraction of the
+        // engine's buffer size so the device-side output latency shrinks
+        // accordingly. The FIFO keeps being written in engine-sized chunks,
+        // see callbackProcessDrift().
+        framesPerBuffer = math_max(kMinHeadphoneFramesPerBuffer,
+                framesPerBuffer / kHeadphoneBufferDivisor);
+        qDebug() << "Headphone monitoring, reduced framesPerBuffer:"
+                 << framesPerBuffer;
+    }
     double bufferMSec = framesPerBuffer / m_sampleRate.toDouble() * 1000;
     qDebug() << "Requested sample rate: " << m_sampleRate << "Hz and buffer size:"
              << bufferMSec << "ms";
@@ -301,14 +325,19 @@ SoundDeviceStatus SoundDevicePortAudio::open(bool isClkRefDevice, int syncBuffer
         // to avoid overflows when one callback overtakes the other or
         // when there is a clock drift compared to the clock reference device
         // we need an additional artificial delay
+        //
+        // The FIFO is written by the clock reference callback in chunks of
+        // the engine's configured buffer size, so it is sized in those
+        // chunks even when this stream was opened on a smaller headphone
+        // monitoring buffer above.
         if (m_outputParams.channelCount > 0) {
             // On chunk for reading one for writing and on for drift correction
             m_outputFifo = std::make_unique<FIFO<CSAMPLE>>(
-                    m_outputParams.channelCount * framesPerBuffer * kFifoSize);
+                    m_outputParams.channelCount * m_configFramesPerBuffer * kFifoSize);
             // Clear first 1.5 chunks on for the required artificial delaly to
             // a allow jitter and a half, because we can't predict which
             // callback fires first.
-            int writeCount = m_outputParams.channelCount * framesPerBuffer *
+            int writeCount = m_outputParams.channelCount * m_configFramesPerBuffer *
                     kFifoSize / 2;
             CSAMPLE* dataPtr1;
             ring_buffer_size_t size1;
@@ -775,6 +804,8 @@ int SoundDevicePortAudio::callbackProcessDrift(
     Q_UNUSED(timeInfo);
     Trace trace("SoundDevicePortAudio::callbackProcessDrift %1",
             m_deviceId.debugName());
+    // No-op unless the build has been configured with ALLOC_AUDIT
+    mixxx::ScopedAllocAudit allocAudit;
 
     if (statusFlags & (paOutputUnderflow | paInputOverflow)) {
         m_pSoundManager->underflowHappened(7);
@@ -852,9 +883,19 @@ int SoundDevicePortAudio::callbackProcessDrift(
 
     if (m_outputParams.channelCount > 0) {
         int outChunkSize = framesPerBuffer * m_outputParams.channelCount;
+        // The FIFO is written in chunks of the engine's configured buffer
+        // size, which is larger than our own chunk when this stream runs on
+        // a reduced headphone monitoring buffer. The fill level then
+        // legitimately sweeps through one engine chunk between two writes,
+        // so treat that whole range as on target and only correct for
+        // actual clock drift. With matching buffer sizes the band collapses
+        // to the single on-target fill level as before.
+        int engineChunkSize = static_cast<int>(m_configFramesPerBuffer) *
+                m_outputParams.channelCount;
+        int targetFill = outChunkSize * kDriftReserve + engineChunkSize;
         int readAvailable = m_outputFifo->readAvailable();
 
-        if (readAvailable > outChunkSize * (kDriftReserve + 1)) {
+        if (readAvailable > targetFill) {
             m_outputFifo->read(out, outChunkSize);
             if (m_outputDrift) {
                 // Risk of overflow, skip one frame
@@ -864,7 +905,7 @@ int SoundDevicePortAudio::callbackProcessDrift(
                 m_outputDrift = true;
                 //qDebug() << "callbackProcessDrift read:" << (float)readAvailable / outChunkSize << "Jitter Skip";
             }
-        } else if (readAvailable == outChunkSize * (kDriftReserve + 1)) {
+        } else if (readAvailable >= targetFill - (engineChunkSize - outChunkSize)) {
             m_outputFifo->read(out, outChunkSize);
             m_outputDrift = false;
             //qDebug() << "callbackProcessDrift read:" << (float)readAvailable / outChunkSize << "Normal";
@@ -907,6 +948,8 @@ int SoundDevicePortAudio::callbackProcess(const SINT framesPerBuffer,
         PaStreamCallbackFlags statusFlags) {
     Q_UNUSED(timeInfo);
     Trace trace("SoundDevicePortAudio::callbackProcess %1", m_deviceId.debugName());
+    // No-op unless the build has been configured with ALLOC_AUDIT
+    mixxx::ScopedAllocAudit allocAudit;
 
     if (statusFlags & (paOutputUnderflow | paInputOverflow)) {
         m_pSoundManager->underflowHappened(1);
@@ -982,6 +1025,12 @@ int SoundDevicePortAudio::callbackProcessClkRef(
         // the SCHED_OTHER policy in which case the call also wouldn't do anything.
         QThread::currentThread()->setPriority(QThread::TimeCriticalPriority);
 #endif
+        // On hybrid CPUs keep the callback thread on the performance
+        // cores. The scheduler may otherwise migrate it to an
+        // efficiency core under low load, where a sudden burst of
+        // engine work no longer fits into the callback deadline.
+        mixxx::ThreadTopology::pinCurrentThread(
+                mixxx::ThreadTopology::CoreClass::Performance);
         m_bSetThreadPriority = true;
 
         // This disables the denormals calculations, to avoid a
@@ -1050,6 +1099,11 @@ int SoundDevicePortAudio::callbackProcessClkRef(
 #endif
 #endif
 
+    // Report any heap allocation made while processing the engine callback.
+    // Installed after the one-time thread setup above, which is allowed to
+    // allocate. No-op unless the build has been configured with ALLOC_AUDIT
+    mixxx::ScopedAllocAudit allocAudit;
+
     if (statusFlags & (paOutputUnderflow | paInputOverflow)) {
         m_pSoundManager->underflowHappened(6);
     }
@@ -20,6 +20,7 @@
 #include "util/compatibility/qatomic.h"
 #include "util/defs.h"
 #include "util/sample.h"
+#include "util/threadtopology.h"
 #include "util/versionstore.h"
 #include "vinylcontrol/defs_vinylcontrol.h"
 
@@ -31,8 +32,6 @@
 #include <android/log.h>
 #include <jni.h>
 #include <pa_oboe.h>
-#include <pthread.h>
-#include <sys/syscall.h>
 
 #include <QJniObject>
 #endif
@@ -54,6 +53,13 @@ struct DeviceMode {
 #ifdef __LINUX__
 constexpr unsigned int kSleepSecondsAfterClosingDevice = 5;
 #endif
+
+// Poll interval of the stream liveness watchdog and how long the audio
+// callbacks may stall before a failover is attempted. The timeout is
+// generous enough to never trigger on an xrun or a driver hiccup; a
+// stream whose interface has disappeared stays silent forever anyway.
+constexpr int kStreamLivenessIntervalMillis = 500;
+constexpr int kStreamStallTimeoutMillis = 2000;
 } // anonymous namespace
 
 SoundManager::SoundManager(UserSettingsPointer pConfig,
@@ -66,7 +72,9 @@ SoundManager::SoundManager(UserSettingsPointer pConfig,
           m_underflowHappened(0),
           m_underflowUpdateCount(0),
           m_audioLatencyOverloadCount(kAppGroup, QStringLiteral("audio_latency_overload_count")),
-          m_audioLatencyOverload(kAppGroup, QStringLiteral("audio_latency_overload")) {
+          m_audioLatencyOverload(kAppGroup, QStringLiteral("audio_latency_overload")),
+          m_lastOutputCallbackCount(0),
+          m_inFailover(false) {
     // TODO(xxx) some of these ControlObject are not needed by soundmanager, or are unused here.
     // It is possible to take them out?
     m_pControlObjectSoundStatusCO = new ControlObject(
@@ -86,6 +94,20 @@ SoundManager::SoundManager(UserSettingsPointer pConfig,
 
     queryDevices();
 
+    // Watch the active configuration for stalled audio callbacks so a
+    // dying interface does not stop the music mid-set. Opt-out via config
+    // for setups where the stream is legitimately paused from outside,
+    // e.g. JACK freewheeling.
+    if (m_pConfig->getValue(
+                ConfigKey(kAppGroup, QStringLiteral("audio_device_failover")),
+                true)) {
+        connect(&m_streamLivenessTimer,
+                &QTimer::timeout,
+                this,
+                &SoundManager::slotCheckStreamLiveness);
+        m_streamLivenessTimer.start(kStreamLivenessIntervalMillis);
+    }
+
     if (!m_config.readFromDisk()) {
         m_config.loadDefaults(this, SoundManagerConfig::ALL);
     }
@@ -163,6 +185,9 @@ void SoundManager::closeDevices(
     // sleepAfterClosing and async maybe unused depending on platform support
     // qDebug() << "SoundManager::closeDevices()";
 
+    // Any loopback latency bursts still in flight will never come back.
+    m_loopbackLatencyTest.abort();
+
 #ifdef __LINUX__
     bool closed = false;
 #endif
@@ -279,7 +304,19 @@ void SoundManager::queryDevices() {
 }
 
 void SoundManager::clearAndQueryDevices() {
-    const bool sleepAfterClosing = true;
+    // Closing open devices usually blocks for several seconds to allow
+    // asynchronous sound APIs like "pulse" to free their resources, see
+    // closeDevices(). Re-enumerating does not reopen any device, so instead
+    // of blocking the GUI here we remember when the devices were closed and
+    // let setupDevices() wait out the remainder of the grace period before
+    // the devices are reopened.
+    for (const auto& pDevice : std::as_const(m_devices)) {
+        if (pDevice->isOpen()) {
+            m_deviceClosedTimer.start();
+            break;
+        }
+    }
+    const bool sleepAfterClosing = false;
     clearDeviceList(sleepAfterClosing);
     queryDevices();
 }
@@ -410,20 +447,15 @@ void SoundManager::queryDevicesPortaudio() {
         }).waitForFinished();
         PaOboe_SetNumberOfBuffers(4);
 
-        // The following snippets pins the audio thread to a performance core
-        int32_t thread32 = gettid();
-        uint mask = 0b10000;
-        cpu_set_t cpuset;
-        CPU_ZERO(&cpuset);
-        for (uint32_t i = 0; i < 32; ++i) {
-            if ((mask >> i) & 1) {
-                CPU_SET(i, &cpuset);
-            }
-        }
-        if (sched_setaffinity(thread32, sizeof(cpu_set_t), &cpuset) != 0) {
-            __android_log_print(ANDROID_LOG_WARN, "mixxx", "Error setting CPU affinity: %d", errno);
-        } else {
+        // Keep the thread that drives the Oboe audio stream off the
+        // efficiency cores. The audio callback thread itself pins
+        // to the performance cores on its first invocation, see
+        // SoundDevicePortAudio::callbackProcessClkRef().
+        if (mixxx::ThreadTopology::pinCurrentThread(
+                    mixxx::ThreadTopology::CoreClass::Performance)) {
             __android_log_print(ANDROID_LOG_VERBOSE, "mixxx", "CPU affinity set");
+        } else {
+            __android_log_print(ANDROID_LOG_WARN, "mixxx", "CPU affinity not set");
         }
 #endif
         err = Pa_Initialize();
@@ -451,10 +483,14 @@ void SoundManager::queryDevicesPortaudio() {
     // unique identifier for the API. So, build a QHash to do that and pass
     // it to the SoundDevicePortAudio constructor.
     QHash<PaHostApiIndex, PaHostApiTypeId> paApiIndexToTypeId;
+    PaHostApiIndex jackApiIndex = paHostApiNotFound;
     for (PaHostApiIndex i = 0; i < Pa_GetHostApiCount(); i++) {
         const PaHostApiInfo* api = Pa_GetHostApiInfo(i);
         if (api && QString(api->name) != "skeleton implementation") {
             paApiIndexToTypeId.insert(i, api->type);
+            if (!strcmp(api->name, MIXXX_PORTAUDIO_JACK_STRING)) {
+                jackApiIndex = i;
+            }
         }
     }
 
@@ -481,8 +517,7 @@ void SoundManager::queryDevicesPortaudio() {
         auto currentDevice = SoundDevicePointer(new SoundDevicePortAudio(
                 m_pConfig, this, deviceInfo, deviceTypeId, i));
         m_devices.push_back(currentDevice);
-        if (!strcmp(Pa_GetHostApiInfo(deviceInfo->hostApi)->name,
-                    MIXXX_PORTAUDIO_JACK_STRING)) {
+        if (deviceInfo->hostApi == jackApiIndex) {
             m_jackSampleRate = static_cast<mixxx::audio::SampleRate::value_t>(
                     deviceInfo->defaultSampleRate);
         }
@@ -627,6 +662,22 @@ SoundDeviceStatus SoundManager::setupDevices() {
         }
     }
 
+#ifdef __LINUX__
+    // If the devices were closed without the usual blocking sleep (see
+    // clearAndQueryDevices()), asynchronous sound APIs like "pulse" may not
+    // have freed their resources yet. Wait out the remainder of the grace
+    // period before reopening any device.
+    if (m_deviceClosedTimer.isValid()) {
+        const qint64 remainingMillis =
+                kSleepSecondsAfterClosingDevice * 1000 -
+                m_deviceClosedTimer.elapsed();
+        if (remainingMillis > 0) {
+            QThread::msleep(static_cast<unsigned long>(remainingMillis));
+        }
+        m_deviceClosedTimer.invalidate();
+    }
+#endif
+
     for (const auto& mode: toOpen) {
         SoundDevicePointer pDevice = mode.pDevice;
         m_pErrorDevice = pDevice;
@@ -646,6 +697,26 @@ SoundDeviceStatus SoundManager::setupDevices() {
         if (CmdlineArgs::Instance().getSafeMode() && syncBuffers == 0) {
             syncBuffers = 2;
         }
+
+        // A device that carries only the headphone output and is not the
+        // clock reference is fed through the drift-compensated FIFO, which
+        // decouples its stream buffer size from the engine's. Such a device
+        // may open its stream on a smaller buffer to tighten monitoring
+        // latency. See SoundDevicePortAudio::open().
+        bool headphoneMonitorMode = false;
+        if (m_config.getHeadphoneLowLatency() &&
+                pNewMainClockRef != pDevice &&
+                mode.isOutput && !mode.isInput) {
+            headphoneMonitorMode = true;
+            for (const auto& out : pDevice->outputs()) {
+                if (out.getType() != AudioPathType::Headphones) {
+                    headphoneMonitorMode = false;
+                    break;
+                }
+            }
+        }
+        pDevice->setHeadphoneMonitorMode(headphoneMonitorMode);
+
         status = pDevice->open(pNewMainClockRef == pDevice, syncBuffers);
         if (status != SoundDeviceStatus::Ok) {
             goto closeAndError;
@@ -676,6 +747,10 @@ SoundDeviceStatus SoundManager::setupDevices() {
             outputDevicesOpened > 0 ?
                     SOUNDMANAGER_CONNECTED : SOUNDMANAGER_DISCONNECTED);
 
+    m_loopbackLatencyTest.setSampleRate(outputDevicesOpened > 0
+                    ? m_config.getSampleRate()
+                    : mixxx::audio::SampleRate());
+
     // returns OK if we were able to open all the devices the user wanted
     if (devicesNotFound.isEmpty()) {
         emit devicesSetup();
@@ -766,13 +841,70 @@ void SoundManager::checkConfig() {
 }
 
 void SoundManager::onDeviceOutputCallback(const SINT iFramesPerBuffer) {
+    // Feed the liveness watchdog, see slotCheckStreamLiveness().
+    m_outputCallbackCount.ref();
     // Produce a block of samples for output. EngineMixer expects stereo
     // samples so multiply iFramesPerBuffer by 2.
     m_pEngineMixer->process(iFramesPerBuffer * 2);
+
+    if (m_loopbackLatencyTest.isActive()) {
+        m_loopbackLatencyTest.processOutput(
+                m_pEngineMixer->getWritableMainBuffer(), iFramesPerBuffer);
+    }
+}
+
+void SoundManager::slotCheckStreamLiveness() {
+    if (m_pControlObjectSoundStatusCO->get() != SOUNDMANAGER_CONNECTED ||
+            m_inFailover) {
+        m_streamStalledSince.invalidate();
+        return;
+    }
+    const int callbackCount = atomicLoadRelaxed(m_outputCallbackCount);
+    if (callbackCount != m_lastOutputCallbackCount) {
+        m_lastOutputCallbackCount = callbackCount;
+        m_streamStalledSince.invalidate();
+        return;
+    }
+    if (!m_streamStalledSince.isValid()) {
+        m_streamStalledSince.start();
+        return;
+    }
+    if (m_streamStalledSince.elapsed() < kStreamStallTimeoutMillis) {
+        return;
+    }
+    m_streamStalledSince.invalidate();
+    m_inFailover = true;
+    qWarning() << "Audio callbacks stalled for" << kStreamStallTimeoutMillis
+               << "ms while connected, attempting device failover";
+    // The stalled interface may have disappeared entirely, so re-enumerate
+    // the devices before reopening. This blocks the GUI for the PulseAudio
+    // grace period, which is acceptable for a stream that is already dead.
+    clearAndQueryDevices();
+    SoundDeviceStatus status = setupDevices();
+    if (status != SoundDeviceStatus::Ok) {
+        // The configured devices cannot be reopened. Fall back to the
+        // default configuration (builtin device) so the music resumes.
+        // The fallback is deliberately not written to disk; the user's
+        // configuration is restored on the next start or when the
+        // interface comes back and the user re-applies it.
+        qWarning() << "Reopening the configured devices failed, falling back"
+                   << "to the default audio configuration";
+        m_config.loadDefaults(this, SoundManagerConfig::ALL);
+        checkConfig();
+        status = setupDevices();
+    }
+    if (status != SoundDeviceStatus::Ok) {
+        qWarning() << "Audio device failover failed:"
+                   << getLastErrorMessage(status);
+    }
+    m_inFailover = false;
 }
 
 void SoundManager::pushInputBuffers(const QList<AudioInputBuffer>& inputs,
                                     const SINT iFramesPerBuffer) {
+    if (m_loopbackLatencyTest.isActive()) {
+        m_loopbackLatencyTest.processInput(inputs, iFramesPerBuffer);
+    }
    for (QList<AudioInputBuffer>::ConstIterator i = inputs.begin(),
                  e = inputs.end(); i != e; ++i) {
         const AudioInputBuffer& in = *i;
@@ -1,18 +1,22 @@
 #pragma once
 
+#include <QElapsedTimer>
 #include <QHash>
 #include <QList>
 #include <QObject>
 #include <QSharedPointer>
 #include <QString>
+#include <QTimer>
 
 #include "audio/types.h"
 #include "control/pollingcontrolproxy.h"
 #include "engine/sidechain/enginenetworkstream.h"
 #include "preferences/usersettings.h"
+#include "soundio/loopbacklatencytest.h"
 #include "soundio/sounddevice.h"
 #include "soundio/soundmanagerconfig.h"
 #include "util/cmdlineargs.h"
+#include "util/flightrecorder.h"
 #include "util/types.h"
 
 class EngineMixer;
@@ -103,6 +107,10 @@ class SoundManager : public QObject {
 
     void underflowHappened(int code) {
         m_underflowHappened = 1;
+        // Dump the flight recorder rings so the engine activity leading up
+        // to this xrun can be inspected post-hoc. Only sets a flag and
+        // wakes the low-priority writer thread.
+        FlightRecorder::requestDumpOnXrun();
         // Disable the engine warnings by default, because printing a warning is a
         // locking function that will make the problem worse
         if (CmdlineArgs::Instance().getDeveloper()) {
@@ -126,6 +134,12 @@ class SoundManager : public QObject {
   private slots:
     void completeDevicesClosing();
 
+    // Watchdog slot that notices when the audio callbacks of the active
+    // configuration have stalled (e.g. the interface died mid-set) and
+    // reopens the configured devices, falling back to the default audio
+    // configuration if they cannot be reopened.
+    void slotCheckStreamLiveness();
+
   private:
     // Closes all the devices and empties the list of devices we have.
     void clearDeviceList(bool sleepAfterClosing);
@@ -144,6 +158,12 @@ class SoundManager : public QObject {
     EngineMixer* m_pEngineMixer;
     UserSettingsPointer m_pConfig;
     bool m_paInitialized;
+    // Measures how long ago open devices were closed without the usual
+    // blocking sleep (see clearAndQueryDevices()). setupDevices() waits for
+    // the remainder of the grace period before reopening devices, so that
+    // asynchronous sound servers like PulseAudio have freed their resources
+    // by then. Invalid if no such close happened.
+    QElapsedTimer m_deviceClosedTimer;
     mixxx::audio::SampleRate m_jackSampleRate;
     QList<SoundDevicePointer> m_devices;
     QList<mixxx::audio::SampleRate> m_samplerates;
@@ -160,6 +180,20 @@ class SoundManager : public QObject {
 
     QAtomicInt m_underflowHappened;
     int m_underflowUpdateCount;
+
+    // Mid-set failover, see slotCheckStreamLiveness(). The callback count
+    // is bumped by the clock reference device on every buffer; the watchdog
+    // timer polls it from the main thread.
+    QTimer m_streamLivenessTimer;
+    QAtomicInt m_outputCallbackCount;
+    int m_lastOutputCallbackCount;
+    QElapsedTimer m_streamStalledSince;
+    bool m_inFailover;
     PollingControlProxy m_audioLatencyOverloadCount;
     PollingControlProxy m_audioLatencyOverload;
+
+    // End-to-end latency measurement through a physical loopback
+    // connection, see loopbacklatencytest.h. Fed from the audio callbacks
+    // in onDeviceOutputCallback() and pushInputBuffers().
+    LoopbackLatencyTest m_loopbackLatencyTest;
 };
@@ -23,6 +23,7 @@ const QString xmlAttributeSampleRate = "samplerate";
 const QString xmlAttributeBufferSize = "latency";
 const QString xmlAttributeSyncBuffers = "sync_buffers";
 const QString xmlAttributeForceNetworkClock = "force_network_clock";
+const QString xmlAttributeHeadphoneLowLatency = "headphone_low_latency";
 const QString xmlAttributeDeckCount = "deck_count";
 
 const QString xmlElementSoundDevice = "SoundDevice";
@@ -43,6 +44,7 @@ SoundManagerConfig::SoundManagerConfig(SoundManager* pSoundManager)
       m_audioBufferSizeIndex(kDefaultAudioBufferSizeIndex),
       m_syncBuffers(2),
       m_forceNetworkClock(false),
+      m_headphoneLowLatency(false),
       m_iNumMicInputs(0),
       m_bExternalRecordBroadcastConnected(false),
       m_pSoundManager(pSoundManager) {
@@ -75,6 +77,8 @@ bool SoundManagerConfig::readFromDisk() {
     setSyncBuffers(rootElement.attribute(xmlAttributeSyncBuffers, "2").toUInt());
     setForceNetworkClock(rootElement.attribute(xmlAttributeForceNetworkClock,
             "0").toUInt() != 0);
+    setHeadphoneLowLatency(rootElement.attribute(xmlAttributeHeadphoneLowLatency,
+            "0").toUInt() != 0);
     setDeckCount(rootElement.attribute(xmlAttributeDeckCount,
                                     QString::number(kDefaultDeckCount))
                          .toUInt());
@@ -229,6 +233,7 @@ bool SoundManagerConfig::writeToDisk() const {
     docElement.setAttribute(xmlAttributeBufferSize, m_audioBufferSizeIndex);
     docElement.setAttribute(xmlAttributeSyncBuffers, m_syncBuffers);
     docElement.setAttribute(xmlAttributeForceNetworkClock, m_forceNetworkClock);
+    docElement.setAttribute(xmlAttributeHeadphoneLowLatency, m_headphoneLowLatency);
     docElement.setAttribute(xmlAttributeDeckCount, m_deckCount);
     doc.appendChild(docElement);
 
@@ -320,6 +325,14 @@ void SoundManagerConfig::setForceNetworkClock(bool force) {
     m_forceNetworkClock = force;
 }
 
+bool SoundManagerConfig::getHeadphoneLowLatency() const {
+    return m_headphoneLowLatency;
+}
+
+void SoundManagerConfig::setHeadphoneLowLatency(bool enabled) {
+    m_headphoneLowLatency = enabled;
+}
+
 /**
  * Checks that the sample rate in the object is valid according to the list of
  * sample rates given by SoundManager.
@@ -543,6 +556,7 @@ void SoundManagerConfig::loadDefaults(SoundManager* soundManager, unsigned int f
 
     m_syncBuffers = kDefaultSyncBuffers;
     m_forceNetworkClock = false;
+    m_headphoneLowLatency = false;
 }
 
 QSet<SoundDeviceId> SoundManagerConfig::getDevices() const {
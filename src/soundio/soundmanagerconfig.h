@@ -86,6 +86,8 @@ class SoundManagerConfig {
     void setSyncBuffers(unsigned int syncBuffers);
     bool getForceNetworkClock() const;
     void setForceNetworkClock(bool force);
+    bool getHeadphoneLowLatency() const;
+    void setHeadphoneLowLatency(bool enabled);
     void addOutput(const SoundDeviceId& device, const AudioOutput& out);
     void addInput(const SoundDeviceId& device, const AudioInput& in);
     QMultiHash<SoundDeviceId, AudioOutput> getOutputs() const;
@@ -110,6 +112,7 @@ class SoundManagerConfig {
     unsigned int m_audioBufferSizeIndex;
     unsigned int m_syncBuffers;
     bool m_forceNetworkClock;
+    bool m_headphoneLowLatency;
     QMultiHash<SoundDeviceId, AudioOutput> m_outputs;
     QMultiHash<SoundDeviceId, AudioInput> m_inputs;
     int m_iNumMicInputs;
@@ -9,6 +9,10 @@ extern "C" {
 
 } // extern "C"
 
+#include <QCache>
+#include <QMap>
+
+#include "util/compatibility/qmutex.h"
 #include "util/logger.h"
 #include "util/sample.h"
 
@@ -53,8 +57,102 @@ constexpr int64_t kavStreamDecoderFrameDelayAAC = 2112;
 
 constexpr SINT kMaxSamplesPerMP3Frame = 1152;
 
+// Formats without an embedded seek table (e.g. VBR MP3 files without
+// a Xing TOC) force FFmpeg's generic seek code to scan the stream
+// linearly past the last known index entry, which becomes noticeable
+// when seeking near the end of long files. To avoid these scans the
+// positions of packets observed while decoding are recorded as index
+// entries, both in the opened stream and in a process-wide cache that
+// is replayed when the same file is opened again, e.g. when loading
+// a track into a deck after it has already been analyzed.
+
+// Minimum distance between two recorded index entries. Keeps the
+// recorded index sparse, the generic seek code only needs to read
+// forward from the preceding entry.
+constexpr int64_t kSeekIndexMinByteDistance = 64 * 1024;
+
+// Upper bounds for the process-wide cache to limit memory usage.
+constexpr int kSeekIndexMaxCachedFiles = 16;
+constexpr int kSeekIndexMaxEntriesPerFile = 8192;
+
 const Logger kLogger("SoundSourceFFmpeg");
 
+// Process-wide cache of stream seek index entries, keyed by local
+// file name. Thread-safe, because sound sources for the same file
+// may be opened concurrently from different threads.
+class SeekIndexCache {
+  public:
+    static SeekIndexCache& instance() {
+        static SeekIndexCache s_instance;
+        return s_instance;
+    }
+
+    /// Records a packet position unless a nearby entry is already known.
+    void record(
+            const QString& fileName,
+            AVRational timeBase,
+            int64_t bytePos,
+            int64_t streamTimestamp) {
+        const auto locked = lockMutex(&m_mutex);
+        FileIndex* pFileIndex = m_fileIndexes.object(fileName);
+        if (!pFileIndex) {
+            pFileIndex = new FileIndex{{}, timeBase};
+            m_fileIndexes.insert(fileName, pFileIndex);
+        } else if (av_cmp_q(pFileIndex->timeBase, timeBase) != 0) {
+            // The stream properties have changed, e.g. after the
+            // file has been re-encoded. Discard the stale index.
+            pFileIndex->timestampsByBytePos.clear();
+            pFileIndex->timeBase = timeBase;
+        }
+        auto& entries = pFileIndex->timestampsByBytePos;
+        if (entries.size() >= kSeekIndexMaxEntriesPerFile) {
+            return;
+        }
+        const auto it = entries.lowerBound(
+                bytePos - (kSeekIndexMinByteDistance - 1));
+        if (it != entries.end() &&
+                it.key() < bytePos + kSeekIndexMinByteDistance) {
+            // A nearby entry already exists
+            return;
+        }
+        entries.insert(bytePos, streamTimestamp);
+    }
+
+    /// Adds all cached entries for the given file to the seek index
+    /// of a newly opened stream.
+    void replayInto(const QString& fileName, AVStream* pavStream) {
+        const auto locked = lockMutex(&m_mutex);
+        const FileIndex* pFileIndex = m_fileIndexes.object(fileName);
+        if (!pFileIndex ||
+                av_cmp_q(pFileIndex->timeBase, pavStream->time_base) != 0) {
+            return;
+        }
+        for (auto it = pFileIndex->timestampsByBytePos.constBegin();
+                it != pFileIndex->timestampsByBytePos.constEnd();
+                ++it) {
+            av_add_index_entry(pavStream,
+                    it.key(),
+                    it.value(),
+                    /*size*/ 0,
+                    /*distance*/ 0,
+                    AVINDEX_KEYFRAME);
+        }
+    }
+
+  private:
+    struct FileIndex {
+        QMap<int64_t, int64_t> timestampsByBytePos;
+        AVRational timeBase;
+    };
+
+    SeekIndexCache()
+            : m_fileIndexes(kSeekIndexMaxCachedFiles) {
+    }
+
+    QMutex m_mutex;
+    QCache<QString, FileIndex> m_fileIndexes;
+};
+
 int64_t getStreamStartTime(const AVStream& avStream) {
     auto start_time = avStream.start_time;
     if (start_time == AV_NOPTS_VALUE) {
@@ -487,6 +585,7 @@ SoundSourceFFmpeg::SoundSourceFFmpeg(const QUrl& url)
           m_pavDecodedFrame(nullptr),
           m_seekPrerollFrameCount(0),
           m_pavPacket(av_packet_alloc()),
+          m_lastIndexedPacketPos(-1),
           m_pavResampledFrame(nullptr),
           m_avutilVersion(avutil_version()) {
     DEBUG_ASSERT(m_pavPacket);
@@ -658,6 +757,11 @@ SoundSource::OpenResult SoundSourceFFmpeg::tryOpen(
     m_pavCodecContext = std::move(pavCodecContext);
     m_pavStream = pavStream;
 
+    // Pre-populate the stream's seek index with packet positions that
+    // have been recorded while decoding this file before, e.g. during
+    // the analysis pass. See recordSeekIndexEntry().
+    SeekIndexCache::instance().replayInto(getLocalFileName(), m_pavStream);
+
     if (kLogger.debugEnabled()) {
 #if LIBAVUTIL_VERSION_INT >= AV_VERSION_INT(57, 28, 100) // FFmpeg 5.1
         AVChannelLayout fixedChannelLayout;
@@ -1035,6 +1139,7 @@ bool SoundSourceFFmpeg::consumeNextAVPacket(
             m_frameBuffer.invalidate();
             return false;
         }
+        recordSeekIndexEntry(*m_pavPacket);
         *ppavNextPacket = m_pavPacket;
     }
     auto* pavNextPacket = *ppavNextPacket;
@@ -1075,6 +1180,37 @@ bool SoundSourceFFmpeg::consumeNextAVPacket(
     return true;
 }
 
+void SoundSourceFFmpeg::recordSeekIndexEntry(const AVPacket& avPacket) {
+    if (!avPacket.data ||
+            avPacket.pos < 0 ||
+            avPacket.pts == AV_NOPTS_VALUE) {
+        // Drain-mode packets and packets without a known position
+        // or timestamp cannot be indexed
+        return;
+    }
+    if (m_lastIndexedPacketPos >= 0 &&
+            avPacket.pos >= m_lastIndexedPacketPos &&
+            avPacket.pos < m_lastIndexedPacketPos + kSeekIndexMinByteDistance) {
+        // Too close to the preceding entry
+        return;
+    }
+    m_lastIndexedPacketPos = avPacket.pos;
+    // Extend the seek index of the opened stream that is consulted
+    // by av_seek_frame(). Entries are deduplicated and kept sorted
+    // by av_add_index_entry().
+    av_add_index_entry(m_pavStream,
+            avPacket.pos,
+            avPacket.pts,
+            /*size*/ 0,
+            /*distance*/ 0,
+            AVINDEX_KEYFRAME);
+    SeekIndexCache::instance().record(
+            getLocalFileName(),
+            m_pavStream->time_base,
+            avPacket.pos,
+            avPacket.pts);
+}
+
 const CSAMPLE* SoundSourceFFmpeg::resampleDecodedAVFrame() {
     if (m_pSwrContext) {
         // Decoded frame must be resampled before reading
@@ -41,6 +41,11 @@ class SoundSourceFFmpeg : public SoundSource {
     bool consumeNextAVPacket(
             AVPacket** ppavNextPacket);
 
+    // Records the position of a freshly read packet in the stream's
+    // seek index and in a process-wide seek index cache to speed up
+    // subsequent seeks in streams without an embedded seek table.
+    void recordSeekIndexEntry(const AVPacket& avPacket);
+
     // Takes ownership of an input format context and ensures that
     // the corresponding AVFormatContext is closed, either explicitly
     // or implicitly by the destructor. The wrapper can only be
@@ -211,6 +216,11 @@ class SoundSourceFFmpeg : public SoundSource {
 
     AVPacket* m_pavPacket;
 
+    // Byte position of the most recently recorded seek index entry
+    // or -1 if nothing has been recorded yet. Used to keep the
+    // recorded index sparse, see recordSeekIndexEntry().
+    int64_t m_lastIndexedPacketPos;
+
     AVFrame* m_pavResampledFrame;
 
     const unsigned int m_avutilVersion;
@@ -93,6 +93,9 @@ SoundSourceFLAC::SoundSourceFLAC(const QUrl& url)
           m_decoder(nullptr),
           m_maxBlocksize(0),
           m_bitsPerSample(kBitsPerSampleDefault),
+          m_pDirectWriteSampleBuffer(nullptr),
+          m_directWritableFrameCount(0),
+          m_directWrittenFrameCount(0),
           m_curFrameIndex(0) {
 }
 
@@ -261,11 +264,28 @@ ReadableSampleFrames SoundSourceFLAC::readSampleFramesClamped(
         if (m_sampleBuffer.empty()) {
             // Save the current frame index
             const SINT curFrameIndexBeforeProcessing = m_curFrameIndex;
+            // Arm the direct-write path: If the next decoded block starts
+            // at the current position and fits entirely into the remaining
+            // writable sample frames then flacWrite() interleaves it
+            // directly into the output buffer, bypassing m_sampleBuffer.
+            if (writableSampleFrames.writableData()) {
+                m_pDirectWriteSampleBuffer =
+                        writableSampleFrames.writableData(outputSampleOffset);
+                m_directWritableFrameCount =
+                        getSignalInfo().samples2frames(numberOfSamplesRemaining);
+            }
+            m_directWrittenFrameCount = 0;
             // Documentation of FLAC__stream_decoder_process_single():
             // "Depending on what was decoded, the metadata or write callback
             // will be called with the decoded metadata block or audio frame."
             // See also: https://xiph.org/flac/api/group__flac__stream__decoder.html#ga9d6df4a39892c05955122cf7f987f856
-            if (!FLAC__stream_decoder_process_single(m_decoder)) {
+            const bool processSingleSucceeded =
+                    FLAC__stream_decoder_process_single(m_decoder);
+            // Disarm before the error handling below, which may recursively
+            // re-enter this function to skip frames.
+            m_pDirectWriteSampleBuffer = nullptr;
+            m_directWritableFrameCount = 0;
+            if (!processSingleSucceeded) {
                 kLogger.warning()
                         << "Failed to decode FLAC file"
                         << m_file.fileName();
@@ -301,6 +321,18 @@ ReadableSampleFrames SoundSourceFLAC::readSampleFramesClamped(
                 }
             }
             DEBUG_ASSERT(curFrameIndexBeforeProcessing == m_curFrameIndex);
+            if (m_directWrittenFrameCount > 0) {
+                // The decoded block has been written directly into the
+                // output buffer and m_sampleBuffer remained untouched.
+                DEBUG_ASSERT(m_sampleBuffer.empty());
+                const SINT numberOfSamplesWritten =
+                        getSignalInfo().frames2samples(m_directWrittenFrameCount);
+                outputSampleOffset += numberOfSamplesWritten;
+                m_curFrameIndex += m_directWrittenFrameCount;
+                numberOfSamplesRemaining -= numberOfSamplesWritten;
+                m_directWrittenFrameCount = 0;
+                continue;
+            }
         }
         if (m_sampleBuffer.empty()) {
             break; // EOF
@@ -460,24 +492,40 @@ FLAC__StreamDecoderWriteStatus SoundSourceFLAC::flacWrite(
     // According to the API docs the decoder will always report the current
     // position in "FLAC samples" (= "Mixxx frames") for convenience
     DEBUG_ASSERT(frame->header.number_type == FLAC__FRAME_NUMBER_TYPE_SAMPLE_NUMBER);
+    // The decoded block can be written directly into the output buffer
+    // if it starts at the expected position and fits entirely into the
+    // remaining writable sample frames. Otherwise it is buffered in
+    // m_sampleBuffer and copied out (partially) on demand.
+    const bool directWrite = m_pDirectWriteSampleBuffer &&
+            m_curFrameIndex ==
+                    static_cast<SINT>(frame->header.number.sample_number) &&
+            numReadableFrames <= m_directWritableFrameCount;
     m_curFrameIndex = frame->header.number.sample_number;
 
     // Decode buffer should be empty before decoding the next frame
     DEBUG_ASSERT(m_sampleBuffer.empty());
-    const SampleBuffer::WritableSlice writableSlice(
-            m_sampleBuffer.growForWriting(
-                    getSignalInfo().frames2samples(numReadableFrames)));
-
-    const SINT numWritableFrames =
-            getSignalInfo().samples2frames(writableSlice.length());
-    DEBUG_ASSERT(numWritableFrames <= numReadableFrames);
-    if (numWritableFrames < numReadableFrames) {
-        kLogger.warning()
-                << "Sample buffer has not enough free space for all decoded FLAC samples:"
-                << numWritableFrames << "<" << numReadableFrames;
-    }
+    CSAMPLE* pSampleBuffer;
+    SINT numWritableFrames;
+    if (directWrite) {
+        pSampleBuffer = m_pDirectWriteSampleBuffer;
+        numWritableFrames = numReadableFrames;
+        m_directWrittenFrameCount = numReadableFrames;
+    } else {
+        const SampleBuffer::WritableSlice writableSlice(
+                m_sampleBuffer.growForWriting(
+                        getSignalInfo().frames2samples(numReadableFrames)));
+
+        numWritableFrames =
+                getSignalInfo().samples2frames(writableSlice.length());
+        DEBUG_ASSERT(numWritableFrames <= numReadableFrames);
+        if (numWritableFrames < numReadableFrames) {
+            kLogger.warning()
+                    << "Sample buffer has not enough free space for all decoded FLAC samples:"
+                    << numWritableFrames << "<" << numReadableFrames;
+        }
 
-    CSAMPLE* pSampleBuffer = writableSlice.data();
+        pSampleBuffer = writableSlice.data();
+    }
     DEBUG_ASSERT(getSignalInfo().getChannelCount() <= channelCount);
     switch (getSignalInfo().getChannelCount()) {
     case 1: {
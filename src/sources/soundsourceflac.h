@@ -49,6 +49,16 @@ class SoundSourceFLAC final : public SoundSource {
 
     ReadAheadSampleBuffer m_sampleBuffer;
 
+    // Direct-write destination for decoded sample data, armed by
+    // readSampleFramesClamped() around FLAC__stream_decoder_process_single().
+    // If the decoded block starts at the expected frame index and fits
+    // entirely into the remaining writable frames then flacWrite()
+    // interleaves the decoded samples directly into this buffer instead
+    // of taking a detour through m_sampleBuffer.
+    CSAMPLE* m_pDirectWriteSampleBuffer;
+    SINT m_directWritableFrameCount;
+    SINT m_directWrittenFrameCount;
+
     void invalidateCurFrameIndex() {
         m_curFrameIndex = frameIndexMax();
     }
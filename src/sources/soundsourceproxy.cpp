@@ -43,6 +43,7 @@
 #include "library/coverartutils.h"
 #include "track/globaltrackcache.h"
 #include "track/track.h"
+#include "util/compatibility/qmutex.h"
 #include "util/logger.h"
 #include "util/regex.h"
 
@@ -51,6 +52,8 @@
 /*static*/ QStringList SoundSourceProxy::s_supportedFileNamePatterns;
 /*static*/ QRegularExpression SoundSourceProxy::s_supportedFileNamesRegex;
 /*static*/ QHash<QMimeType, QString> SoundSourceProxy::s_fileTypeByMimeType;
+/*static*/ QMutex SoundSourceProxy::s_fallbackProvidersMutex;
+/*static*/ QHash<QUrl, mixxx::SoundSourceProviderPointer> SoundSourceProxy::s_fallbackProviders;
 
 namespace {
 
@@ -501,9 +504,52 @@ SoundSourceProxy::nextProviderWithOpenMode(
     }
 }
 
+// static
+mixxx::SoundSourceProviderPointer SoundSourceProxy::lookupFallbackProvider(
+        const QUrl& url) {
+    const auto locked = lockMutex(&s_fallbackProvidersMutex);
+    return s_fallbackProviders.value(url);
+}
+
+void SoundSourceProxy::rememberFallbackProvider() const {
+    DEBUG_ASSERT(m_pProvider);
+    if (m_providerRegistrations.isEmpty()) {
+        // Explicitly provided during tests
+        return;
+    }
+    const auto pPrimaryProvider =
+            m_providerRegistrations.first().getProvider();
+    const auto locked = lockMutex(&s_fallbackProvidersMutex);
+    if (m_pProvider != pPrimaryProvider) {
+        s_fallbackProviders.insert(m_url, m_pProvider);
+    } else {
+        // Drop a stale entry if the primary provider works (again),
+        // e.g. after the file contents have been fixed.
+        s_fallbackProviders.remove(m_url);
+    }
+}
+
 void SoundSourceProxy::findProviderAndInitSoundSource() {
     DEBUG_ASSERT(!m_pProvider);
     DEBUG_ASSERT(!m_pSoundSource);
+    // Start with the provider that managed to open this file before if
+    // the primary provider is known to fail for it. All remaining
+    // providers are still tried in turn if it fails again.
+    const auto pFallbackProvider = lookupFallbackProvider(m_url);
+    if (pFallbackProvider) {
+        for (m_providerRegistrationIndex = 0;
+                m_providerRegistrationIndex < m_providerRegistrations.size();
+                ++m_providerRegistrationIndex) {
+            if (m_providerRegistrations[m_providerRegistrationIndex]
+                            .getProvider() == pFallbackProvider) {
+                if (initSoundSourceWithProvider(
+                            mixxx::SoundSourceProviderPointer(pFallbackProvider))) {
+                    return; // Success
+                }
+                break;
+            }
+        }
+    }
     for (m_providerRegistrationIndex = 0;
             m_providerRegistrationIndex < m_providerRegistrations.size();
             ++m_providerRegistrationIndex) {
@@ -891,6 +937,7 @@ bool SoundSourceProxy::openSoundSource(
                 m_pSoundSource->open(openMode, params);
         if (openResult == mixxx::SoundSource::OpenResult::Succeeded) {
             if (m_pSoundSource->verifyReadable()) {
+                rememberFallbackProvider();
                 return true;
             }
             kLogger.warning()
@@ -3,6 +3,7 @@
 #include <gtest/gtest_prod.h>
 
 #include <QMimeType>
+#include <QMutex>
 
 #include "sources/soundsourceproviderregistry.h"
 #include "track/track_decl.h"
@@ -202,6 +203,21 @@ class SoundSourceProxy {
     static QRegularExpression s_supportedFileNamesRegex;
     static QHash<QMimeType, QString> s_fileTypeByMimeType;
 
+    // Remembers for each URL the provider that most recently succeeded
+    // in opening the file when it was not the primary provider for the
+    // file type. Subsequent openings of such files start directly with
+    // the remembered provider instead of repeating the failing open
+    // attempts of all preceding providers, which may each probe the
+    // file contents. Guarded by a mutex because sound sources are
+    // opened from multiple threads, e.g. for deck loading, analysis,
+    // and metadata import.
+    static QMutex s_fallbackProvidersMutex;
+    static QHash<QUrl, mixxx::SoundSourceProviderPointer> s_fallbackProviders;
+
+    static mixxx::SoundSourceProviderPointer lookupFallbackProvider(
+            const QUrl& url);
+    void rememberFallbackProvider() const;
+
     friend class TrackCollectionManager;
     FRIEND_TEST(TrackMetadataExportTest, keepWithespaceKey);
     static ExportTrackMetadataResult exportTrackMetadataBeforeSaving(
@@ -3,6 +3,7 @@
 #include <QDir>
 
 #include "util/logger.h"
+#include "util/sample.h"
 #include "util/semanticversion.h"
 
 namespace mixxx {
@@ -68,6 +69,8 @@ SoundSourceProviderPriority SoundSourceProviderSndFile::getPriorityHint(
 SoundSourceSndFile::SoundSourceSndFile(const QUrl& url)
         : SoundSource(url),
           m_pSndFile(nullptr),
+          m_pMappedSampleData(nullptr),
+          m_mappedSampleDataIsFloat(false),
           m_curFrameIndex(0) {
 }
 
@@ -122,10 +125,86 @@ SoundSource::OpenResult SoundSourceSndFile::tryOpen(
 
     m_curFrameIndex = frameIndexMin();
 
+    tryOpenDirectRead(sfInfo);
+
     return OpenResult::Succeeded;
 }
 
+void SoundSourceSndFile::tryOpenDirectRead(const SF_INFO& sfInfo) {
+    DEBUG_ASSERT(!m_pMappedFile);
+    if ((sfInfo.format & SF_FORMAT_TYPEMASK) != SF_FORMAT_WAV) {
+        return;
+    }
+    const int subFormat = sfInfo.format & SF_FORMAT_SUBMASK;
+    if (subFormat != SF_FORMAT_PCM_16 && subFormat != SF_FORMAT_FLOAT) {
+        return;
+    }
+    const SINT bytesPerSample = (subFormat == SF_FORMAT_FLOAT) ? 4 : 2;
+
+    auto pFile = std::make_unique<QFile>(getLocalFileName());
+    if (!pFile->open(QIODevice::ReadOnly)) {
+        return;
+    }
+    const qint64 fileSize = pFile->size();
+    const uchar* pMapped = pFile->map(0, fileSize);
+    if (!pMapped) {
+        return;
+    }
+
+    // Locate the 'data' chunk. libsndfile has already validated the
+    // container, so this only needs to walk the RIFF chunk list and can
+    // simply bail out on anything unexpected.
+    if (fileSize < 12 ||
+            memcmp(pMapped, "RIFF", 4) != 0 ||
+            memcmp(pMapped + 8, "WAVE", 4) != 0) {
+        return;
+    }
+    qint64 chunkOffset = 12;
+    qint64 dataOffset = -1;
+    qint64 dataSize = 0;
+    while (chunkOffset + 8 <= fileSize) {
+        const quint32 chunkSize = pMapped[chunkOffset + 4] |
+                (pMapped[chunkOffset + 5] << 8) |
+                (pMapped[chunkOffset + 6] << 16) |
+                (static_cast<quint32>(pMapped[chunkOffset + 7]) << 24);
+        if (memcmp(pMapped + chunkOffset, "data", 4) == 0) {
+            dataOffset = chunkOffset + 8;
+            dataSize = chunkSize;
+            break;
+        }
+        // Chunks are padded to an even number of bytes.
+        chunkOffset += 8 + chunkSize + (chunkSize & 1);
+    }
+    if (dataOffset < 0) {
+        return;
+    }
+
+    // The sample data must cover all frames reported by libsndfile and
+    // must be naturally aligned for the direct conversion.
+    const qint64 sampleDataSize =
+            static_cast<qint64>(getSignalInfo().frames2samples(frameLength())) *
+            bytesPerSample;
+    if (dataOffset + sampleDataSize > fileSize ||
+            sampleDataSize > dataSize ||
+            (dataOffset % bytesPerSample) != 0) {
+        return;
+    }
+
+    if (kLogger.debugEnabled()) {
+        kLogger.debug()
+                << "Using direct-read fast path for"
+                << getUrlString();
+    }
+    m_pMappedFile = std::move(pFile);
+    m_pMappedSampleData = pMapped + dataOffset;
+    m_mappedSampleDataIsFloat = (subFormat == SF_FORMAT_FLOAT);
+}
+
 void SoundSourceSndFile::close() {
+    // Destroying the file object releases the mapping.
+    m_pMappedFile.reset();
+    m_pMappedSampleData = nullptr;
+    m_mappedSampleDataIsFloat = false;
     if (m_pSndFile != nullptr) {
         const int closeResult = sf_close(m_pSndFile);
         if (0 == closeResult) {
@@ -143,6 +222,33 @@ ReadableSampleFrames SoundSourceSndFile::readSampleFramesClamped(
         const WritableSampleFrames& writableSampleFrames) {
     const SINT firstFrameIndex = writableSampleFrames.frameIndexRange().start();
 
+    if (m_pMappedSampleData != nullptr) {
+        // Direct-read fast path: convert the samples straight from the
+        // mapped file into the destination buffer. No seeks, no syscalls
+        // and no libsndfile buffering involved.
+        const SINT numberOfFrames = writableSampleFrames.frameLength();
+        const SINT firstSampleOffset =
+                getSignalInfo().frames2samples(firstFrameIndex);
+        const SINT numberOfSamples =
+                getSignalInfo().frames2samples(numberOfFrames);
+        CSAMPLE* pDest = writableSampleFrames.writableData();
+        if (m_mappedSampleDataIsFloat) {
+            const CSAMPLE* pSrc =
+                    reinterpret_cast<const CSAMPLE*>(m_pMappedSampleData) +
+                    firstSampleOffset;
+            SampleUtil::copy(pDest, pSrc, numberOfSamples);
+        } else {
+            const SAMPLE* pSrc =
+                    reinterpret_cast<const SAMPLE*>(m_pMappedSampleData) +
+                    firstSampleOffset;
+            SampleUtil::convertS16ToFloat32(pDest, pSrc, numberOfSamples);
+        }
+        m_curFrameIndex = firstFrameIndex + numberOfFrames;
+        return ReadableSampleFrames(
+                IndexRange::forward(firstFrameIndex, numberOfFrames),
+                SampleBuffer::ReadableSlice(pDest, numberOfSamples));
+    }
+
     if (m_curFrameIndex != firstFrameIndex) {
         const sf_count_t seekResult = sf_seek(m_pSndFile, firstFrameIndex, SEEK_SET);
         if (seekResult == firstFrameIndex) {
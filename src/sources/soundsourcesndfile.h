@@ -1,5 +1,8 @@
 #pragma once
 
+#include <QFile>
+#include <memory>
+
 #include "sources/soundsourceprovider.h"
 
 #ifdef Q_OS_WIN
@@ -28,8 +31,24 @@ class SoundSourceSndFile final : public SoundSource {
             OpenMode mode,
             const OpenParams& params) override;
 
+    /// Try to set up the direct-read fast path for plain PCM WAV files,
+    /// see m_pMappedSampleData. Leaves the regular libsndfile read path
+    /// in place when the file does not qualify.
+    void tryOpenDirectRead(const SF_INFO& sfInfo);
+
     SNDFILE* m_pSndFile;
 
+    // Direct-read fast path: For WAV files with 16-bit integer or 32-bit
+    // float PCM samples the decoded audio equals the file content, so the
+    // file is memory mapped and samples are converted straight from the
+    // mapped 'data' chunk into the destination buffer, bypassing the
+    // libsndfile read layers and the per-read syscalls. The mapping stays
+    // valid until m_pMappedFile is destroyed. m_pMappedSampleData is
+    // nullptr when the fast path is not available.
+    std::unique_ptr<QFile> m_pMappedFile;
+    const quint8* m_pMappedSampleData;
+    bool m_mappedSampleDataIsFloat;
+
     SINT m_curFrameIndex;
 };
 
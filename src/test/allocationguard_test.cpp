@@ -0,0 +1,60 @@
+#include "util/allocationguard.h"
+
+#include <gtest/gtest.h>
+
+#include "control/controlobject.h"
+#include "test/signalpathtest.h"
+
+namespace {
+
+// Exercises the full engine signal path (EngineMixer::process including
+// the per-deck EngineBuffer scalers and the builtin EQ/effects units in
+// the mixer chain) under the real-time allocation audit and expects it
+// to complete without a single heap allocation. The tests are skipped
+// unless the build has been configured with -DALLOC_AUDIT=ON.
+class AllocationGuardTest : public SignalPathTest {
+  protected:
+    // The first buffers after a parameter change are allowed to allocate,
+    // e.g. for sizing scaler buffers or instantiating RubberBand.
+    static constexpr int kWarmupBuffers = 32;
+    static constexpr int kAuditedBuffers = 64;
+
+    void processBuffersUnderAudit() {
+        // Intentionally not using ProcessBuffer(), which logs (and thereby
+        // allocates) on every call.
+        for (int i = 0; i < kWarmupBuffers; ++i) {
+            m_pEngineMixer->process(kProcessBufferSize);
+        }
+        mixxx::ScopedAllocAudit::resetViolationCount();
+        {
+            mixxx::ScopedAllocAudit audit;
+            for (int i = 0; i < kAuditedBuffers; ++i) {
+                m_pEngineMixer->process(kProcessBufferSize);
+            }
+        }
+        EXPECT_EQ(0, mixxx::ScopedAllocAudit::violationCount());
+    }
+};
+
+TEST_F(AllocationGuardTest, LinearScalerDoesNotAllocate) {
+    if (!mixxx::ScopedAllocAudit::isEnabled()) {
+        GTEST_SKIP() << "built without ALLOC_AUDIT, allocations are not intercepted";
+    }
+    ControlObject::set(ConfigKey(m_sGroup1, "keylock"), 0.0);
+    ControlObject::set(ConfigKey(m_sGroup1, "rate"), getRateSliderValue(1.05));
+    ControlObject::set(ConfigKey(m_sGroup1, "play"), 1.0);
+    processBuffersUnderAudit();
+}
+
+TEST_F(AllocationGuardTest, KeylockScalerDoesNotAllocate) {
+    if (!mixxx::ScopedAllocAudit::isEnabled()) {
+        GTEST_SKIP() << "built without ALLOC_AUDIT, allocations are not intercepted";
+    }
+    // Keylock with a non-unity rate engages the time stretching scaler
+    ControlObject::set(ConfigKey(m_sGroup1, "keylock"), 1.0);
+    ControlObject::set(ConfigKey(m_sGroup1, "rate"), getRateSliderValue(1.05));
+    ControlObject::set(ConfigKey(m_sGroup1, "play"), 1.0);
+    processBuffersUnderAudit();
+}
+
+} // anonymous namespace
@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include <QDir>
+#include <QTemporaryDir>
 #include <QtDebug>
 #include <vector>
 
@@ -130,4 +131,48 @@ TEST_F(AnalyzerWaveformTest, canary) {
     EXPECT_DOUBLE_EQ(pWaveformSummary->getAudioVisualRatio(), 1.0);
 }
 
+// Saving a waveform as a flat binary file and memory-mapping it again
+// must yield the identical visual sample data and metadata.
+TEST_F(AnalyzerWaveformTest, flatFileRoundTrip) {
+    m_aw.initialize(AnalyzerTrack(m_pTrack),
+            m_pTrack->getSampleRate(),
+            m_pTrack->getChannels(),
+            kBigBufSize / kChannelCount);
+    m_aw.processSamples(&m_canaryBigBuf[kCanarySize], kBigBufSize);
+    m_aw.storeResults(m_pTrack);
+    m_aw.cleanup();
+
+    ConstWaveformPointer pWaveform = m_pTrack->getWaveform();
+    ASSERT_NE(pWaveform, nullptr);
+
+    QTemporaryDir tempDir;
+    ASSERT_TRUE(tempDir.isValid());
+    const QString flatFilePath = QDir(tempDir.path()).filePath("1.wfm");
+
+    EXPECT_FALSE(Waveform::isValidFlatFile(flatFilePath));
+    ASSERT_TRUE(pWaveform->saveToFlatFile(flatFilePath));
+    EXPECT_TRUE(Waveform::isValidFlatFile(flatFilePath));
+
+    Waveform mappedWaveform;
+    ASSERT_TRUE(mappedWaveform.mapFlatFile(flatFilePath));
+
+    ASSERT_EQ(mappedWaveform.getDataSize(), pWaveform->getDataSize());
+    EXPECT_EQ(mappedWaveform.getTextureSize(), pWaveform->getTextureSize());
+    EXPECT_EQ(mappedWaveform.getTextureStride(), pWaveform->getTextureStride());
+    EXPECT_EQ(mappedWaveform.getCompletion(), pWaveform->getDataSize());
+    EXPECT_DOUBLE_EQ(mappedWaveform.getAudioVisualRatio(),
+            pWaveform->getAudioVisualRatio());
+    for (int i = 0; i < pWaveform->getDataSize(); ++i) {
+        EXPECT_EQ(mappedWaveform.getLow(i), pWaveform->getLow(i));
+        EXPECT_EQ(mappedWaveform.getMid(i), pWaveform->getMid(i));
+        EXPECT_EQ(mappedWaveform.getHigh(i), pWaveform->getHigh(i));
+        EXPECT_EQ(mappedWaveform.getAll(i), pWaveform->getAll(i));
+    }
+
+    // A truncated file must be rejected by the header validation.
+    QFile flatFile(flatFilePath);
+    ASSERT_TRUE(flatFile.resize(flatFile.size() / 2));
+    EXPECT_FALSE(Waveform::isValidFlatFile(flatFilePath));
+}
+
 } // namespace
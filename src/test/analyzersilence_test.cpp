@@ -217,6 +217,39 @@ TEST_F(AnalyzerSilenceTest, RespectUserEdits) {
     EXPECT_DOUBLE_EQ(kManualOutroPosition.value(), pOutroCue->getLengthFrames());
 }
 
+TEST_F(AnalyzerSilenceTest, QuietIntroAndOutroTransitionHints) {
+    // 60 seconds of tone: 15 s quiet intro, 30 s at full level and
+    // 15 s quiet outro. The energy profile should place the intro end
+    // where the full level starts and the outro start where it drops.
+    const int sampleRate = 44100;
+    const SINT trackLengthFrames = 60 * sampleRate;
+    nTrackSampleDataLength = kChannelCount * trackLengthFrames;
+    pTrackSampleData.resize(nTrackSampleDataLength);
+
+    const double omega = 2.0 * M_PI * kTonePitchHz / sampleRate;
+    for (SINT i = 0; i < nTrackSampleDataLength; i++) {
+        const SINT frame = i / kChannelCount;
+        const bool fullLevel = frame >= 15 * sampleRate && frame < 45 * sampleRate;
+        const CSAMPLE amplitude = fullLevel ? 1.0f : 0.1f;
+        pTrackSampleData[i] = amplitude * static_cast<CSAMPLE>(cos(frame * omega));
+    }
+
+    analyzeTrack();
+
+    CuePointer pIntroCue = pTrack->findCueByType(mixxx::CueType::Intro);
+    ASSERT_NE(nullptr, pIntroCue);
+    EXPECT_EQ(mixxx::audio::kStartFramePos, pIntroCue->getPosition());
+    // Within the resolution of the energy profile
+    EXPECT_NEAR(15.0 * sampleRate, pIntroCue->getEndPosition().value(), sampleRate);
+
+    CuePointer pOutroCue = pTrack->findCueByType(mixxx::CueType::Outro);
+    ASSERT_NE(nullptr, pOutroCue);
+    EXPECT_NEAR(45.0 * sampleRate, pOutroCue->getPosition().value(), sampleRate);
+    // The last sound may fall slightly short of the end of the buffer,
+    // depending on where the final tone cycle crosses the threshold.
+    EXPECT_NEAR(60.0 * sampleRate, pOutroCue->getEndPosition().value(), 100);
+}
+
 TEST_F(AnalyzerSilenceTest, verifyFirstSound) {
     const CSAMPLE s[] = {
             0.0000f,
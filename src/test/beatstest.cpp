@@ -538,6 +538,58 @@ TEST(BeatsTest, ConstTempoFindPrevNextBeatWhenNotOnBeat) {
     EXPECT_NEAR(nextBeat.value(), foundNextBeat.value(), kMaxBeatError);
 }
 
+TEST(BeatsTest, CursorMatchesStatelessLookup) {
+    const auto pBeats = Beats::fromBeatMarkers(
+            kSampleRate,
+            std::vector<BeatMarker>{
+                    BeatMarker{kStartPosition, 8},
+                    BeatMarker{kStartPosition + 8 * kSampleRate.value() / 2, 16},
+            },
+            kStartPosition + 8 * kSampleRate.value() / 2 + 16 * kSampleRate.value(),
+            kBpm,
+            QString());
+
+    Beats::Cursor cursor;
+    const audio::FrameDiff_t stepFrames = kSampleRate.value() / 10.0;
+
+    // Sweep monotonically over the whole beats range (the cursor fast path)
+    // and verify that the cursor returns the same results as the stateless
+    // lookup.
+    for (audio::FramePos position = kStartPosition - 4 * kSampleRate.value();
+            position < kEndPosition;
+            position += stepFrames) {
+        audio::FramePos expectedPrev, expectedNext;
+        const bool expectedResult = pBeats->findPrevNextBeats(
+                position, &expectedPrev, &expectedNext, false);
+
+        audio::FramePos cursorPrev, cursorNext;
+        const bool cursorResult = cursor.findPrevNextBeats(
+                pBeats, position, &cursorPrev, &cursorNext, false);
+
+        EXPECT_EQ(expectedResult, cursorResult);
+        EXPECT_EQ(expectedPrev, cursorPrev);
+        EXPECT_EQ(expectedNext, cursorNext);
+    }
+
+    // A backwards jump (seek) falls back to the regular lookup and re-primes
+    // the cursor.
+    const audio::FramePos seekPosition = kStartPosition + 3 * kSampleRate.value();
+    audio::FramePos expectedPrev, expectedNext;
+    pBeats->findPrevNextBeats(seekPosition, &expectedPrev, &expectedNext, false);
+    audio::FramePos cursorPrev, cursorNext;
+    cursor.findPrevNextBeats(pBeats, seekPosition, &cursorPrev, &cursorNext, false);
+    EXPECT_EQ(expectedPrev, cursorPrev);
+    EXPECT_EQ(expectedNext, cursorNext);
+
+    // Replacing the beats object discards the cached iterator.
+    const auto pOtherBeats = Beats::fromConstTempo(
+            kSampleRate, kStartPosition, kBpm, QString());
+    pOtherBeats->findPrevNextBeats(seekPosition, &expectedPrev, &expectedNext, false);
+    cursor.findPrevNextBeats(pOtherBeats, seekPosition, &cursorPrev, &cursorNext, false);
+    EXPECT_EQ(expectedPrev, cursorPrev);
+    EXPECT_EQ(expectedNext, cursorNext);
+}
+
 TEST(BeatsTest, roundBpm) {
     // Integer Bpm
     mixxx::Bpm roundBpm = BeatUtils::roundBpmWithinRange(
@@ -1,5 +1,6 @@
 #include "preferences/configobject.h"
 
+#include <QFile>
 #include <QString>
 
 #include "test/mixxxtest.h"
@@ -152,6 +153,39 @@ TEST_F(ConfigObjectTest, GetValueString) {
     EXPECT_QSTRING_EQ("6", config()->getValue(ck2, "6"));
 }
 
+TEST_F(ConfigObjectTest, JournalReplay) {
+    auto ck = ConfigKey("[Test]", "journaled");
+    auto ckRemoved = ConfigKey("[Test]", "removed");
+    config()->setValue(ck, QString("asdf"));
+    config()->setValue(ckRemoved, QString("zxcv"));
+    config()->remove(ckRemoved);
+
+    // Reload without save(), as if the previous session had crashed. The
+    // changes must be restored from the journal.
+    m_pConfig = UserSettingsPointer(
+            new UserSettings(getTestDataDir().filePath("test.cfg")));
+
+    EXPECT_QSTRING_EQ("asdf", config()->getValue<QString>(ck));
+    EXPECT_FALSE(config()->exists(ckRemoved));
+}
+
+TEST_F(ConfigObjectTest, JournalCompactedBySave) {
+    auto ck = ConfigKey("[Test]", "journaled");
+    config()->setValue(ck, QString("asdf"));
+
+    const QString journalFilename =
+            getTestDataDir().filePath("test.cfg.journal");
+    EXPECT_TRUE(QFile::exists(journalFilename));
+
+    // save() folds the journal into the config file and discards it.
+    m_pConfig->save();
+    EXPECT_FALSE(QFile::exists(journalFilename));
+
+    m_pConfig = UserSettingsPointer(
+            new UserSettings(getTestDataDir().filePath("test.cfg")));
+    EXPECT_QSTRING_EQ("asdf", config()->getValue<QString>(ck));
+}
+
 TEST_F(ConfigObjectTest, Save) {
     for (int i = 0; i < 10; ++i) {
         config()->setValue(ConfigKey(QString("[Test%1]").arg(i),
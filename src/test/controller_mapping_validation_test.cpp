@@ -164,6 +164,7 @@ void LegacyControllerMappingValidationTest::SetUp() {
             nullptr,
             m_pConfig,
             dbConnectionPooler(),
+            /*pReadOnlyDbConnectionPool*/ nullptr,
             [](Track* pTrack) { delete pTrack; });
 
     m_pRecordingManager = std::make_shared<RecordingManager>(m_pConfig, m_pEngine.get());
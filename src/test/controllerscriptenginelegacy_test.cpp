@@ -115,6 +115,7 @@ class ControllerScriptEngineLegacyTest : public ControllerScriptEngineLegacy,
                 nullptr,
                 config(),
                 dbConnectionPooler(),
+                /*pReadOnlyDbConnectionPool*/ nullptr,
                 [](Track* pTrack) { delete pTrack; });
 
         m_pRecordingManager = std::make_shared<RecordingManager>(config(), m_pEngine.get());
@@ -320,6 +321,58 @@ TEST_F(ControllerScriptEngineLegacyTest, getSetParameter) {
     EXPECT_DOUBLE_EQ(2.0, co->get());
 }
 
+TEST_F(ControllerScriptEngineLegacyTest, controlBatch_ReadSnapshot) {
+    auto co1 = std::make_unique<ControlObject>(ConfigKey("[Test]", "co1"));
+    auto co2 = std::make_unique<ControlObject>(ConfigKey("[Test]", "co2"));
+    co1->set(2.0);
+    co2->set(3.0);
+    EXPECT_TRUE(evaluateAndAssert(
+            "var batch = engine.createControlBatch(["
+            "  {group: '[Test]', name: 'co1'},"
+            "  {group: '[Test]', name: 'co2'}]);"
+            "var values = new Float64Array(engine.readControlBatch(batch));"
+            "engine.setValue('[Test]', 'co1', values[0] + values[1]);"));
+    EXPECT_DOUBLE_EQ(5.0, co1->get());
+}
+
+TEST_F(ControllerScriptEngineLegacyTest, controlBatch_WriteFlush) {
+    auto co1 = std::make_unique<ControlObject>(ConfigKey("[Test]", "co1"));
+    auto co2 = std::make_unique<ControlObject>(ConfigKey("[Test]", "co2"));
+    EXPECT_TRUE(evaluateAndAssert(
+            "var batch = engine.createControlBatch(["
+            "  {group: '[Test]', name: 'co1'},"
+            "  {group: '[Test]', name: 'co2'}]);"
+            "engine.writeControlBatch(batch, new Float64Array([4.0, 5.0]));"));
+    EXPECT_DOUBLE_EQ(4.0, co1->get());
+    EXPECT_DOUBLE_EQ(5.0, co2->get());
+    // Plain arrays are accepted as well
+    EXPECT_TRUE(evaluateAndAssert("engine.writeControlBatch(batch, [6.0, 7.0]);"));
+    EXPECT_DOUBLE_EQ(6.0, co1->get());
+    EXPECT_DOUBLE_EQ(7.0, co2->get());
+}
+
+TEST_F(ControllerScriptEngineLegacyTest, controlBatch_WriteSkipsNaN) {
+    auto co1 = std::make_unique<ControlObject>(ConfigKey("[Test]", "co1"));
+    auto co2 = std::make_unique<ControlObject>(ConfigKey("[Test]", "co2"));
+    co1->set(10.0);
+    EXPECT_TRUE(evaluateAndAssert(
+            "var batch = engine.createControlBatch(["
+            "  {group: '[Test]', name: 'co1'},"
+            "  {group: '[Test]', name: 'co2'}]);"
+            "engine.writeControlBatch(batch, new Float64Array([NaN, 7.0]));"));
+    EXPECT_DOUBLE_EQ(10.0, co1->get());
+    EXPECT_DOUBLE_EQ(7.0, co2->get());
+}
+
+TEST_F(ControllerScriptEngineLegacyTest, controlBatch_InvalidControl) {
+    EXPECT_TRUE(evaluateAndAssert(
+            "var batch = engine.createControlBatch(["
+            "  {group: '[Nothing]', name: 'nothing'}]);"
+            "if (batch !== -1) {"
+            "  throw 'expected -1 for a batch with a non-existent control';"
+            "}"));
+}
+
 TEST_F(ControllerScriptEngineLegacyTest, softTakeover_setValue) {
     auto co = std::make_unique<ControlPotmeter>(ConfigKey("[Test]", "co"),
             -10.0,
@@ -37,6 +37,33 @@ TEST_F(ControlObjectTest, getControl) {
             (ControlObject*)nullptr);
 }
 
+TEST_F(ControlObjectTest, GetByIndex) {
+    const ControlIndex index1 = co1->getIndex();
+    const ControlIndex index2 = co2->getIndex();
+    ASSERT_TRUE(index1.valid());
+    ASSERT_TRUE(index2.valid());
+    EXPECT_NE(index1, index2);
+
+    co1->set(1.0);
+    co2->set(2.0);
+    EXPECT_DOUBLE_EQ(1.0, ControlObject::getByIndex(index1));
+    EXPECT_DOUBLE_EQ(2.0, ControlObject::getByIndex(index2));
+
+    // Reads through a released index return the default value instead of
+    // crashing or observing a stale slot.
+    co2.reset();
+    EXPECT_DOUBLE_EQ(ControlDoublePrivate::kDefaultValue,
+            ControlObject::getByIndex(index2));
+
+    // Invalid (default constructed) indices are tolerated as well.
+    EXPECT_DOUBLE_EQ(ControlDoublePrivate::kDefaultValue,
+            ControlObject::getByIndex(ControlIndex()));
+
+    // Released indices are recycled for new controls.
+    auto co3 = std::make_unique<ControlObject>(ConfigKey("[Channel1]", "co3"));
+    EXPECT_EQ(index2, co3->getIndex());
+}
+
 TEST_F(ControlObjectTest, AliasRetrieval) {
     ConfigKey ck("[Microphone1]", "volume");
     ConfigKey ckAlias("[Microphone]", "volume");
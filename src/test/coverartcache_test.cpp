@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
+#include <QDir>
 #include <QFileInfo>
+#include <QTemporaryDir>
 
 #include "library/coverartcache.h"
 #include "library/coverartutils.h"
@@ -88,3 +90,70 @@ TEST_F(CoverArtCacheTest, loadCoverFromFileAbsolute) {
             getTestDir().filePath(kCoverLocationTest),
             getTestDir().filePath(kCoverLocationTest));
 }
+
+TEST_F(CoverArtCacheTest, loadCoverFromDiskThumbnail) {
+    QTemporaryDir thumbnailDir;
+    ASSERT_TRUE(thumbnailDir.isValid());
+    CoverArtCache::setThumbnailCacheDirForTests(thumbnailDir.path());
+
+    const QString coverLocation = getTestDir().filePath(kCoverLocationTest);
+    const QImage img(coverLocation);
+    ASSERT_FALSE(img.isNull());
+
+    CoverInfo info;
+    info.type = CoverInfo::FILE;
+    info.source = CoverInfo::GUESSED;
+    info.coverLocation = coverLocation;
+    info.setImageDigest(img);
+
+    // The first load decodes the full-size image and is supposed to
+    // populate the disk-backed thumbnail cache.
+    constexpr int kDesiredWidth = 100;
+    CoverArtCache::FutureResult res =
+            CoverArtCache::loadCover(TrackPointer(), info, kDesiredWidth);
+    EXPECT_EQ(CoverInfo::LoadedImage::Result::Ok, res.coverArt.loadedImage.result);
+    EXPECT_EQ(kDesiredWidth, res.coverArt.loadedImage.image.width());
+    EXPECT_FALSE(QDir(thumbnailDir.path()).entryList(QDir::Files).isEmpty());
+
+    // A second request with the same digest must be served from the
+    // thumbnail cache without touching the image decoder. The source
+    // file of this cover info does not even exist.
+    CoverInfo thumbnailOnly = info;
+    thumbnailOnly.coverLocation = thumbnailDir.filePath("no-such-cover.jpg");
+    res = CoverArtCache::loadCover(TrackPointer(), thumbnailOnly, kDesiredWidth);
+    EXPECT_EQ(CoverInfo::LoadedImage::Result::Ok, res.coverArt.loadedImage.result);
+    EXPECT_EQ(kDesiredWidth, res.coverArt.loadedImage.image.width());
+
+    CoverArtCache::setThumbnailCacheDirForTests(QString());
+}
+
+TEST_F(CoverArtCacheTest, prefetchThumbnails) {
+    QTemporaryDir thumbnailDir;
+    ASSERT_TRUE(thumbnailDir.isValid());
+    CoverArtCache::setThumbnailCacheDirForTests(thumbnailDir.path());
+
+    const QString coverLocation = getTestDir().filePath(kCoverLocationTest);
+    const QImage img(coverLocation);
+    ASSERT_FALSE(img.isNull());
+
+    CoverInfo info;
+    info.type = CoverInfo::FILE;
+    info.source = CoverInfo::GUESSED;
+    info.coverLocation = coverLocation;
+    info.setImageDigest(img);
+
+    CoverArtCache::prefetchThumbnails(info);
+    // One thumbnail file per mip level (64/128/256)
+    EXPECT_EQ(3, QDir(thumbnailDir.path()).entryList(QDir::Files).size());
+
+    // Covers without a stable cache key must not be stored on disk
+    QTemporaryDir legacyDir;
+    ASSERT_TRUE(legacyDir.isValid());
+    CoverArtCache::setThumbnailCacheDirForTests(legacyDir.path());
+    CoverInfo legacyInfo = info;
+    legacyInfo.setImageDigest(QByteArray());
+    CoverArtCache::prefetchThumbnails(legacyInfo);
+    EXPECT_TRUE(QDir(legacyDir.path()).entryList(QDir::Files).isEmpty());
+
+    CoverArtCache::setThumbnailCacheDirForTests(QString());
+}
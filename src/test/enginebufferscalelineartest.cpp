@@ -272,6 +272,46 @@ TEST_F(EngineBufferScaleLinearTest, TestHalfSpeedSmoothlyDoublesSamples) {
     SampleUtil::free(pOutput);
 }
 
+TEST_F(EngineBufferScaleLinearTest, TestHalfSpeedUsesHermiteInterpolation) {
+    SetRateNoLerp(0.5);
+
+    // A signal whose Hermite midpoints differ from the linear ones so the
+    // test fails if the interpolation silently degrades to linear. The
+    // second channel is the negated first channel to prove the channels
+    // don't touch each other. All values and intermediate results are
+    // exactly representable as floats.
+    CSAMPLE readBuffer[] = { 0.0, 0.0,
+                             8.0, -8.0,
+                             0.0, 0.0,
+                             -8.0, 8.0 };
+    m_pReadAheadMock->setReadBuffer(readBuffer, 8);
+
+    // Tell the RAMAN mock to invoke getNextSamplesFake
+    EXPECT_CALL(*m_pReadAheadMock, getNextSamples(_, _, _, _))
+            .WillRepeatedly(Invoke(m_pReadAheadMock, &ReadAheadManagerMock::getNextSamplesFake));
+
+    CSAMPLE* pOutput = SampleUtil::alloc(kiLinearScaleReadAheadLength);
+    m_pScaler->scaleBuffer(pOutput, 64);
+
+    // The 4-point Hermite midpoint between 0 and 8 of this cycle is 5
+    // (the linear one would be 4).
+    CSAMPLE expectedResult[] = { 0.0, 0.0,
+                                 5.0, -5.0,
+                                 8.0, -8.0,
+                                 5.0, -5.0,
+                                 0.0, 0.0,
+                                 -5.0, 5.0,
+                                 -8.0, 8.0,
+                                 -5.0, 5.0 };
+
+    // The first frames come from the cached samples of the previous
+    // (empty) buffer and the last frames lack their upper neighbor frame;
+    // both fall back to linear interpolation, so only assert the interior.
+    AssertBufferCycles(pOutput + 16, 32, expectedResult, 16);
+
+    SampleUtil::free(pOutput);
+}
+
 TEST_F(EngineBufferScaleLinearTest, TestRepeatedScaleCalls) {
     SetRateNoLerp(0.5);
 
@@ -0,0 +1,183 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "effects/backends/builtin/bessel4lvmixeqeffect.h"
+#include "effects/backends/builtin/bessel8lvmixeqeffect.h"
+#include "engine/bufferscalers/enginebufferscalelinear.h"
+#include "engine/engine.h"
+#include "engine/filters/enginefilterbessel4.h"
+#include "engine/filters/enginefilterbessel8.h"
+#include "engine/filters/enginefilterbutterworth4.h"
+#include "engine/readaheadmanager.h"
+#include "util/sample.h"
+#include "util/types.h"
+
+// Microbenchmarks for the DSP kernels running in the audio callback, at
+// the buffer sizes and sample rates used in production (64/128/256
+// frames at 44.1 and 96 kHz). Run them with `mixxx-test --benchmark` or
+// the mixxx-benchmark target; tools/benchmark_compare.py can compare the
+// JSON output of two runs to catch regressions per commit.
+
+namespace {
+
+// Benchmark arguments: frames per buffer and sample rate.
+#define FOR_CALLBACK_BUFFER_SIZES(bm) \
+    bm->ArgsProduct({{64, 128, 256}, {44100, 96000}})
+
+// Fills a buffer with a deterministic full-spectrum test signal so that
+// the filter state does not denormalize to zero during the benchmark.
+void fillTestSignal(CSAMPLE* pBuffer, SINT numSamples) {
+    for (SINT i = 0; i < numSamples; ++i) {
+        pBuffer[i] = static_cast<CSAMPLE>(
+                std::sin(0.03 * i) + 0.3 * std::sin(0.5 * i));
+    }
+}
+
+template<class FilterType>
+void runFilterBenchmark(benchmark::State& state, double freqCorner) {
+    const SINT numSamples = static_cast<SINT>(state.range(0)) *
+            mixxx::kEngineChannelOutputCount;
+    const auto sampleRate = mixxx::audio::SampleRate(
+            static_cast<mixxx::audio::SampleRate::value_t>(state.range(1)));
+
+    FilterType filter(sampleRate, freqCorner);
+    CSAMPLE* pInput = SampleUtil::alloc(numSamples);
+    CSAMPLE* pOutput = SampleUtil::alloc(numSamples);
+    fillTestSignal(pInput, numSamples);
+
+    while (state.KeepRunning()) {
+        filter.process(pInput, pOutput, numSamples);
+        benchmark::ClobberMemory();
+    }
+
+    SampleUtil::free(pInput);
+    SampleUtil::free(pOutput);
+}
+
+static void BM_EngineFilterBessel4Low(benchmark::State& state) {
+    runFilterBenchmark<EngineFilterBessel4Low>(state, 246);
+}
+FOR_CALLBACK_BUFFER_SIZES(BENCHMARK(BM_EngineFilterBessel4Low));
+
+static void BM_EngineFilterBessel8Low(benchmark::State& state) {
+    runFilterBenchmark<EngineFilterBessel8Low>(state, 246);
+}
+FOR_CALLBACK_BUFFER_SIZES(BENCHMARK(BM_EngineFilterBessel8Low));
+
+static void BM_EngineFilterButterworth4Low(benchmark::State& state) {
+    runFilterBenchmark<EngineFilterButterworth4Low>(state, 246);
+}
+FOR_CALLBACK_BUFFER_SIZES(BENCHMARK(BM_EngineFilterButterworth4Low));
+
+template<class GroupState>
+void runLVMixEQBenchmark(benchmark::State& state) {
+    const SINT framesPerBuffer = static_cast<SINT>(state.range(0));
+    const auto sampleRate = mixxx::audio::SampleRate(
+            static_cast<mixxx::audio::SampleRate::value_t>(state.range(1)));
+    const mixxx::EngineParameters engineParameters(sampleRate, framesPerBuffer);
+    const SINT numSamples = engineParameters.samplesPerBuffer();
+
+    GroupState eqState(engineParameters);
+    CSAMPLE* pInput = SampleUtil::alloc(numSamples);
+    CSAMPLE* pOutput = SampleUtil::alloc(numSamples);
+    fillTestSignal(pInput, numSamples);
+
+    while (state.KeepRunning()) {
+        // Distinct non-unity gains keep all three bands (and therefore
+        // both low pass filters and both delays) active.
+        eqState.processChannel(pInput,
+                pOutput,
+                numSamples,
+                sampleRate,
+                0.5,
+                1.0,
+                0.75,
+                LVMixEQEffectGroupStateConstants::kStartupLoFreq,
+                LVMixEQEffectGroupStateConstants::kStartupHiFreq);
+        benchmark::ClobberMemory();
+    }
+
+    SampleUtil::free(pInput);
+    SampleUtil::free(pOutput);
+}
+
+static void BM_Bessel4LVMixEQ(benchmark::State& state) {
+    runLVMixEQBenchmark<Bessel4LVMixEQEffectGroupState>(state);
+}
+FOR_CALLBACK_BUFFER_SIZES(BENCHMARK(BM_Bessel4LVMixEQ));
+
+static void BM_Bessel8LVMixEQ(benchmark::State& state) {
+    runLVMixEQBenchmark<Bessel8LVMixEQEffectGroupState>(state);
+}
+FOR_CALLBACK_BUFFER_SIZES(BENCHMARK(BM_Bessel8LVMixEQ));
+
+// Serves a cyclic test signal to the scaler without the reader and
+// EngineBuffer machinery that a real ReadAheadManager depends on.
+class FakeReadAheadManager : public ReadAheadManager {
+  public:
+    FakeReadAheadManager(const CSAMPLE* pSource, SINT sourceSize)
+            : ReadAheadManager(),
+              m_pSource(pSource),
+              m_sourceSize(sourceSize),
+              m_readPosition(0) {
+    }
+
+    SINT getNextSamples(double dRate,
+            CSAMPLE* pBuffer,
+            SINT requestedSamples,
+            mixxx::audio::ChannelCount channelCount) override {
+        Q_UNUSED(dRate);
+        Q_UNUSED(channelCount);
+        for (SINT i = 0; i < requestedSamples; ++i) {
+            pBuffer[i] = m_pSource[m_readPosition++ % m_sourceSize];
+        }
+        return requestedSamples;
+    }
+
+  private:
+    const CSAMPLE* m_pSource;
+    const SINT m_sourceSize;
+    SINT m_readPosition;
+};
+
+void runScaleLinearBenchmark(benchmark::State& state, double rate) {
+    const SINT framesPerBuffer = static_cast<SINT>(state.range(0));
+    const auto sampleRate = mixxx::audio::SampleRate(
+            static_cast<mixxx::audio::SampleRate::value_t>(state.range(1)));
+    const SINT numSamples = framesPerBuffer * mixxx::kEngineChannelOutputCount;
+
+    CSAMPLE* pSource = SampleUtil::alloc(numSamples);
+    CSAMPLE* pOutput = SampleUtil::alloc(numSamples);
+    fillTestSignal(pSource, numSamples);
+
+    FakeReadAheadManager readAheadManager(pSource, numSamples);
+    EngineBufferScaleLinear scaler(&readAheadManager);
+    scaler.setSignal(sampleRate, mixxx::audio::ChannelCount::stereo());
+    // Set the rate twice to skip the initial rate ramp.
+    for (int i = 0; i < 2; ++i) {
+        double tempoRatio = rate;
+        double pitchRatio = rate;
+        scaler.setScaleParameters(1.0, &tempoRatio, &pitchRatio);
+    }
+
+    while (state.KeepRunning()) {
+        scaler.scaleBuffer(pOutput, numSamples);
+        benchmark::ClobberMemory();
+    }
+
+    SampleUtil::free(pSource);
+    SampleUtil::free(pOutput);
+}
+
+static void BM_EngineBufferScaleLinearFaster(benchmark::State& state) {
+    runScaleLinearBenchmark(state, 1.25);
+}
+FOR_CALLBACK_BUFFER_SIZES(BENCHMARK(BM_EngineBufferScaleLinearFaster));
+
+static void BM_EngineBufferScaleLinearSlower(benchmark::State& state) {
+    runScaleLinearBenchmark(state, 0.75);
+}
+FOR_CALLBACK_BUFFER_SIZES(BENCHMARK(BM_EngineBufferScaleLinearSlower));
+
+} // namespace
@@ -0,0 +1,82 @@
+#include "engine/enginelimiter.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "control/controlobject.h"
+#include "control/controlproxy.h"
+#include "test/mixxxtest.h"
+#include "util/sample.h"
+#include "util/samplebuffer.h"
+#include "util/types.h"
+
+namespace {
+
+constexpr int kBufferSize = 2048;
+constexpr double kSampleRate = 44100.0;
+const QString kMainGroup = QStringLiteral("[Master]");
+
+class EngineLimiterTest : public MixxxTest {
+  protected:
+    EngineLimiterTest()
+            : m_sampleRate(ConfigKey(QStringLiteral("[App]"),
+                                   QStringLiteral("samplerate")),
+                      true,
+                      true),
+              m_buffer(kBufferSize) {
+        m_sampleRate.set(kSampleRate);
+        m_pLimiter = std::make_unique<EngineLimiter>(kMainGroup);
+        m_pEnabled = std::make_unique<ControlProxy>(
+                kMainGroup, QStringLiteral("limiter_enabled"));
+        m_pGainReduction = std::make_unique<ControlProxy>(
+                kMainGroup, QStringLiteral("limiter_gain_reduction"));
+    }
+
+    // Processes enough buffers filled with the given value to flush the
+    // lookahead delay and returns the last processed buffer.
+    std::span<const CSAMPLE> processSteadyState(CSAMPLE value) {
+        for (int i = 0; i < 2; ++i) {
+            SampleUtil::fill(m_buffer.data(), value, kBufferSize);
+            m_pLimiter->process(m_buffer.data(), kBufferSize);
+        }
+        return m_buffer.span();
+    }
+
+    ControlObject m_sampleRate;
+    std::unique_ptr<EngineLimiter> m_pLimiter;
+    std::unique_ptr<ControlProxy> m_pEnabled;
+    std::unique_ptr<ControlProxy> m_pGainReduction;
+    mixxx::SampleBuffer m_buffer;
+};
+
+TEST_F(EngineLimiterTest, DisabledPassesThroughUntouched) {
+    SampleUtil::fill(m_buffer.data(), 2.0f, kBufferSize);
+    m_pLimiter->process(m_buffer.data(), kBufferSize);
+    for (const CSAMPLE sample : m_buffer.span()) {
+        EXPECT_FLOAT_EQ(2.0f, sample);
+    }
+    EXPECT_DOUBLE_EQ(0.0, m_pGainReduction->get());
+}
+
+TEST_F(EngineLimiterTest, EnabledIsTransparentBelowCeiling) {
+    m_pEnabled->set(1.0);
+    const auto buffer = processSteadyState(0.5f);
+    for (const CSAMPLE sample : buffer) {
+        EXPECT_FLOAT_EQ(0.5f, sample);
+    }
+    EXPECT_DOUBLE_EQ(0.0, m_pGainReduction->get());
+}
+
+TEST_F(EngineLimiterTest, EnabledLimitsOvershootToCeiling) {
+    m_pEnabled->set(1.0);
+    const auto buffer = processSteadyState(2.0f);
+    for (const CSAMPLE sample : buffer) {
+        EXPECT_LE(sample, CSAMPLE_PEAK);
+    }
+    // A constant overdrive of 6 dB settles at a gain of 0.5.
+    EXPECT_NEAR(0.5, m_pGainReduction->get(), 1e-3);
+    EXPECT_NEAR(CSAMPLE_PEAK, buffer[kBufferSize - 1], 1e-3f);
+}
+
+} // namespace
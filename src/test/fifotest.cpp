@@ -0,0 +1,98 @@
+#include "util/fifo.h"
+
+#include <gtest/gtest.h>
+
+class FifoTest : public testing::Test {
+};
+
+TEST_F(FifoTest, SizeRoundedUpToPowerOf2) {
+    FIFO<int> fifo(5);
+    EXPECT_EQ(0, fifo.readAvailable());
+    EXPECT_EQ(8, fifo.writeAvailable());
+}
+
+TEST_F(FifoTest, ReadWrite) {
+    FIFO<int> fifo(4);
+    const int writeData[4] = {10, 20, 30, 40};
+    EXPECT_EQ(4, fifo.write(writeData, 4));
+    EXPECT_EQ(4, fifo.readAvailable());
+    EXPECT_EQ(0, fifo.writeAvailable());
+
+    // Writing to a full FIFO must not succeed.
+    EXPECT_EQ(0, fifo.write(writeData, 4));
+
+    int readData[4] = {0, 0, 0, 0};
+    EXPECT_EQ(4, fifo.read(readData, 4));
+    for (int i = 0; i < 4; ++i) {
+        EXPECT_EQ(writeData[i], readData[i]);
+    }
+    EXPECT_EQ(0, fifo.readAvailable());
+    EXPECT_EQ(4, fifo.writeAvailable());
+}
+
+TEST_F(FifoTest, PartialRead) {
+    FIFO<int> fifo(4);
+    const int writeData[2] = {1, 2};
+    EXPECT_EQ(2, fifo.write(writeData, 2));
+
+    int readData[4] = {0, 0, 0, 0};
+    // Reading more elements than available returns only the available ones.
+    EXPECT_EQ(2, fifo.read(readData, 4));
+    EXPECT_EQ(1, readData[0]);
+    EXPECT_EQ(2, readData[1]);
+}
+
+TEST_F(FifoTest, WrapAroundRegions) {
+    FIFO<int> fifo(4);
+    const int writeData[3] = {1, 2, 3};
+    int readData[3] = {0, 0, 0};
+
+    // Advance the indices so that the next 3-element write wraps around
+    // the end of the 4-element buffer.
+    EXPECT_EQ(3, fifo.write(writeData, 3));
+    EXPECT_EQ(3, fifo.read(readData, 3));
+
+    int* dataPtr1;
+    int* dataPtr2;
+    ring_buffer_size_t size1;
+    ring_buffer_size_t size2;
+    EXPECT_EQ(3, fifo.aquireWriteRegions(3, &dataPtr1, &size1, &dataPtr2, &size2));
+    EXPECT_EQ(1, size1);
+    EXPECT_EQ(2, size2);
+    dataPtr1[0] = 4;
+    dataPtr2[0] = 5;
+    dataPtr2[1] = 6;
+    EXPECT_EQ(3, fifo.releaseWriteRegions(3));
+    EXPECT_EQ(3, fifo.readAvailable());
+
+    EXPECT_EQ(3, fifo.aquireReadRegions(3, &dataPtr1, &size1, &dataPtr2, &size2));
+    EXPECT_EQ(1, size1);
+    EXPECT_EQ(2, size2);
+    EXPECT_EQ(4, dataPtr1[0]);
+    EXPECT_EQ(5, dataPtr2[0]);
+    EXPECT_EQ(6, dataPtr2[1]);
+    EXPECT_EQ(3, fifo.releaseReadRegions(3));
+    EXPECT_EQ(0, fifo.readAvailable());
+}
+
+TEST_F(FifoTest, ContiguousRegion) {
+    FIFO<int> fifo(4);
+    int* dataPtr1;
+    int* dataPtr2;
+    ring_buffer_size_t size1;
+    ring_buffer_size_t size2;
+    EXPECT_EQ(2, fifo.aquireWriteRegions(2, &dataPtr1, &size1, &dataPtr2, &size2));
+    EXPECT_EQ(2, size1);
+    EXPECT_EQ(nullptr, dataPtr2);
+    EXPECT_EQ(0, size2);
+}
+
+TEST_F(FifoTest, FlushReadData) {
+    FIFO<int> fifo(4);
+    const int writeData[3] = {1, 2, 3};
+    EXPECT_EQ(3, fifo.write(writeData, 3));
+    // Flushing more elements than available only drops the available ones.
+    EXPECT_EQ(3, fifo.flushReadData(4));
+    EXPECT_EQ(0, fifo.readAvailable());
+    EXPECT_EQ(4, fifo.writeAvailable());
+}
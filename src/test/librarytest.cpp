@@ -25,6 +25,7 @@ std::unique_ptr<TrackCollectionManager> newTrackCollectionManager(
             nullptr,
             std::move(userSettings),
             std::move(dbConnectionPool),
+            /*pReadOnlyDbConnectionPool*/ nullptr,
             deleteTrack);
 }
 
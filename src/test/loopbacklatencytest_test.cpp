@@ -0,0 +1,109 @@
+#include "soundio/loopbacklatencytest.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+#include "control/controlproxy.h"
+#include "test/mixxxtest.h"
+#include "util/sample.h"
+
+namespace {
+
+constexpr SINT kFramesPerBuffer = 1024;
+constexpr mixxx::audio::SampleRate kSampleRate(48000);
+
+class LoopbackLatencyTestTest : public MixxxTest {
+  protected:
+    void SetUp() override {
+        m_pTest = std::make_unique<LoopbackLatencyTest>();
+        m_pTest->setSampleRate(kSampleRate);
+        m_trigger = std::make_unique<ControlProxy>(
+                ConfigKey("[App]", "loopback_latency_test"));
+        m_result = std::make_unique<ControlProxy>(
+                ConfigKey("[App]", "loopback_latency_ms"));
+    }
+
+    // Runs output and input callbacks with the main output fed back into
+    // a single input through a delay of the given number of frames, until
+    // the measurement finishes.
+    void runLoopback(SINT delayFrames) {
+        // Stereo samples, pre-filled with the silence that is "in flight"
+        // on the loopback connection at the start.
+        std::vector<CSAMPLE> delayLine(delayFrames * 2, 0.0f);
+        std::vector<CSAMPLE> outputBuffer(kFramesPerBuffer * 2);
+        std::vector<CSAMPLE> inputBuffer(kFramesPerBuffer * 2);
+        const QList<AudioInputBuffer> inputs = {AudioInputBuffer(
+                AudioInput(AudioPathType::Auxiliary,
+                        0,
+                        mixxx::audio::ChannelCount::stereo()),
+                inputBuffer.data())};
+
+        m_trigger->set(1.0);
+        ASSERT_TRUE(m_pTest->isActive());
+
+        // A measurement is over in well under a minute of audio.
+        const int maxCallbacks =
+                static_cast<int>(60 * kSampleRate / kFramesPerBuffer);
+        for (int i = 0; i < maxCallbacks && m_pTest->isActive(); ++i) {
+            SampleUtil::clear(outputBuffer.data(),
+                static_cast<SINT>(outputBuffer.size()));
+            m_pTest->processOutput(
+                    std::span<CSAMPLE>(outputBuffer), kFramesPerBuffer);
+            delayLine.insert(delayLine.end(),
+                    outputBuffer.begin(),
+                    outputBuffer.end());
+            std::copy(delayLine.begin(),
+                    delayLine.begin() + inputBuffer.size(),
+                    inputBuffer.begin());
+            delayLine.erase(delayLine.begin(),
+                    delayLine.begin() + inputBuffer.size());
+            m_pTest->processInput(inputs, kFramesPerBuffer);
+        }
+        ASSERT_FALSE(m_pTest->isActive());
+    }
+
+    std::unique_ptr<LoopbackLatencyTest> m_pTest;
+    std::unique_ptr<ControlProxy> m_trigger;
+    std::unique_ptr<ControlProxy> m_result;
+};
+
+TEST_F(LoopbackLatencyTestTest, MeasuresDelayLineRoundTrip) {
+    // 480 frames at 48 kHz are exactly 10 ms.
+    runLoopback(480);
+    EXPECT_DOUBLE_EQ(10.0, m_result->get());
+}
+
+TEST_F(LoopbackLatencyTestTest, MeasuresDelayLongerThanBuffer) {
+    // Spans several callback buffers: 4800 frames are 100 ms.
+    runLoopback(4800);
+    EXPECT_DOUBLE_EQ(100.0, m_result->get());
+}
+
+TEST_F(LoopbackLatencyTestTest, ReportsFailureWithoutLoopback) {
+    std::vector<CSAMPLE> outputBuffer(kFramesPerBuffer * 2);
+
+    m_trigger->set(1.0);
+    ASSERT_TRUE(m_pTest->isActive());
+
+    const int maxCallbacks =
+            static_cast<int>(60 * kSampleRate / kFramesPerBuffer);
+    for (int i = 0; i < maxCallbacks && m_pTest->isActive(); ++i) {
+        SampleUtil::clear(outputBuffer.data(),
+                static_cast<SINT>(outputBuffer.size()));
+        m_pTest->processOutput(
+                std::span<CSAMPLE>(outputBuffer), kFramesPerBuffer);
+        // No input callbacks at all, every trial times out.
+    }
+    ASSERT_FALSE(m_pTest->isActive());
+    EXPECT_DOUBLE_EQ(-1.0, m_result->get());
+}
+
+TEST_F(LoopbackLatencyTestTest, IgnoresTriggerWithoutDevices) {
+    m_pTest->setSampleRate(mixxx::audio::SampleRate());
+    m_trigger->set(1.0);
+    EXPECT_FALSE(m_pTest->isActive());
+}
+
+} // namespace
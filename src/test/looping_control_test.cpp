@@ -1329,3 +1329,34 @@ TEST_F(LoopingControlTest, LoopBeatloopReverse) {
         EXPECT_EQ(0.0, m_pSlipEnabled->get());
     }
 }
+
+TEST_F(LoopingControlTest, BeatLoopActiveBits) {
+    m_pTrack1->trySetBpm(120.0);
+    PollingControlProxy activeBits(m_sGroup1, "beatloop_active_bits");
+    EXPECT_EQ(0.0, activeBits.get());
+
+    m_pButtonBeatLoop4Activate->set(1.0);
+    m_pButtonBeatLoop4Activate->set(0.0);
+    ProcessBuffer();
+    EXPECT_TRUE(m_pBeatLoop4Enabled->toBool());
+    const int index4 = LoopingControl::getBeatSizes().indexOf(4.0);
+    ASSERT_GE(index4, 0);
+    EXPECT_EQ(static_cast<double>(quint64(1) << index4), activeBits.get());
+
+    // Switching to another size moves the bit.
+    m_pButtonBeatLoop2Activate->set(1.0);
+    m_pButtonBeatLoop2Activate->set(0.0);
+    ProcessBuffer();
+    EXPECT_TRUE(m_pBeatLoop2Enabled->toBool());
+    EXPECT_FALSE(m_pBeatLoop4Enabled->toBool());
+    const int index2 = LoopingControl::getBeatSizes().indexOf(2.0);
+    ASSERT_GE(index2, 0);
+    EXPECT_EQ(static_cast<double>(quint64(1) << index2), activeBits.get());
+
+    // Disabling looping clears all bits.
+    m_pButtonReloopToggle->set(1.0);
+    m_pButtonReloopToggle->set(0.0);
+    ProcessBuffer();
+    EXPECT_FALSE(isLoopEnabled());
+    EXPECT_EQ(0.0, activeBits.get());
+}
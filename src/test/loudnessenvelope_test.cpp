@@ -0,0 +1,57 @@
+#include "track/loudnessenvelope.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+TEST(LoudnessEnvelopeTest, EmptyEnvelopeIsNeutral) {
+    const mixxx::LoudnessEnvelope envelope{QVector<float>()};
+    EXPECT_TRUE(envelope.isEmpty());
+    EXPECT_FLOAT_EQ(1.0f, envelope.gainAtSeconds(0.0));
+    EXPECT_FLOAT_EQ(1.0f, envelope.gainAtSeconds(123.4));
+}
+
+TEST(LoudnessEnvelopeTest, InterpolatesBetweenEntries) {
+    const mixxx::LoudnessEnvelope envelope{QVector<float>{1.0f, 2.0f, 0.5f}};
+    EXPECT_FLOAT_EQ(1.0f, envelope.gainAtSeconds(0.0));
+    EXPECT_FLOAT_EQ(1.5f, envelope.gainAtSeconds(
+                                  0.5 * mixxx::kLoudnessEnvelopeIntervalSeconds));
+    EXPECT_FLOAT_EQ(2.0f, envelope.gainAtSeconds(
+                                  1.0 * mixxx::kLoudnessEnvelopeIntervalSeconds));
+    EXPECT_FLOAT_EQ(1.25f, envelope.gainAtSeconds(
+                                   1.5 * mixxx::kLoudnessEnvelopeIntervalSeconds));
+}
+
+TEST(LoudnessEnvelopeTest, ClampsOutsideAnalyzedRange) {
+    const mixxx::LoudnessEnvelope envelope{QVector<float>{0.5f, 2.0f}};
+    EXPECT_FLOAT_EQ(0.5f, envelope.gainAtSeconds(-1.0));
+    EXPECT_FLOAT_EQ(2.0f, envelope.gainAtSeconds(
+                                  100.0 * mixxx::kLoudnessEnvelopeIntervalSeconds));
+}
+
+TEST(LoudnessEnvelopeTest, SerializationRoundTrip) {
+    const QVector<float> gains{0.5f, 1.0f, 2.0f, 1.5f};
+    const mixxx::LoudnessEnvelope envelope{gains};
+
+    const QByteArray data = envelope.toByteArray();
+    EXPECT_EQ(gains.size() * static_cast<int>(sizeof(float)), data.size());
+
+    const mixxx::LoudnessEnvelopePointer pRestored =
+            mixxx::LoudnessEnvelope::fromByteArray(data);
+    ASSERT_NE(nullptr, pRestored);
+    EXPECT_EQ(gains.size(), pRestored->size());
+    for (int i = 0; i < gains.size(); ++i) {
+        EXPECT_FLOAT_EQ(gains[i],
+                pRestored->gainAtSeconds(
+                        i * mixxx::kLoudnessEnvelopeIntervalSeconds));
+    }
+}
+
+TEST(LoudnessEnvelopeTest, RejectsMalformedData) {
+    EXPECT_EQ(nullptr, mixxx::LoudnessEnvelope::fromByteArray(QByteArray()));
+    EXPECT_EQ(nullptr,
+            mixxx::LoudnessEnvelope::fromByteArray(
+                    QByteArray("\x01\x02\x03", 3)));
+}
+
+} // namespace
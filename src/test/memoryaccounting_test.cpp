@@ -0,0 +1,45 @@
+#include "util/memoryaccounting.h"
+
+#include <gtest/gtest.h>
+
+namespace {
+
+using mixxx::AccountedMemory;
+using mixxx::MemoryAccounting;
+
+// The Effects tag has no in-tree reporters yet, so these tests see
+// exclusive use of it. The counters are process-global, hence all
+// expectations are relative to the initial values.
+constexpr auto kTag = MemoryAccounting::Tag::Effects;
+
+TEST(MemoryAccountingTest, TracksCurrentAndPeakBytes) {
+    const std::size_t base = MemoryAccounting::currentBytes(kTag);
+
+    MemoryAccounting::trackAlloc(kTag, 1000);
+    EXPECT_EQ(base + 1000, MemoryAccounting::currentBytes(kTag));
+    EXPECT_LE(base + 1000, MemoryAccounting::peakBytes(kTag));
+
+    MemoryAccounting::trackAlloc(kTag, 500);
+    const std::size_t peak = MemoryAccounting::peakBytes(kTag);
+    EXPECT_LE(base + 1500, peak);
+
+    MemoryAccounting::trackFree(kTag, 1500);
+    EXPECT_EQ(base, MemoryAccounting::currentBytes(kTag));
+    // Releases do not lower the high watermark.
+    EXPECT_EQ(peak, MemoryAccounting::peakBytes(kTag));
+}
+
+TEST(MemoryAccountingTest, AccountedMemoryFollowsOwnerLifetime) {
+    const std::size_t base = MemoryAccounting::currentBytes(kTag);
+    {
+        AccountedMemory accounted(kTag, 500);
+        EXPECT_EQ(base + 500, MemoryAccounting::currentBytes(kTag));
+
+        // Resizing the owned buffer replaces the accounted size.
+        accounted.reset(200);
+        EXPECT_EQ(base + 200, MemoryAccounting::currentBytes(kTag));
+    }
+    EXPECT_EQ(base, MemoryAccounting::currentBytes(kTag));
+}
+
+} // namespace
@@ -0,0 +1,107 @@
+#include "waveform/overviewstrip.h"
+
+#include <gtest/gtest.h>
+
+#include "waveform/renderers/waveformsignalcolors.h"
+
+namespace {
+
+WaveformPointer createWaveform(int numFrames) {
+    return WaveformPointer(new Waveform(
+            /*audioSampleRate*/ 1,
+            /*frameLength*/ numFrames,
+            /*desiredVisualSampleRate*/ 1,
+            /*maxVisualSamples*/ -1,
+            /*stemCount*/ 0));
+}
+
+void fillWaveform(const WaveformPointer& pWaveform,
+        unsigned char all,
+        unsigned char low,
+        unsigned char mid,
+        unsigned char high) {
+    WaveformData* pData = pWaveform->data();
+    for (int i = 0; i < pWaveform->getDataSize(); ++i) {
+        pData[i].filtered.all = all;
+        pData[i].filtered.low = low;
+        pData[i].filtered.mid = mid;
+        pData[i].filtered.high = high;
+    }
+    pWaveform->setCompletion(pWaveform->getDataSize());
+}
+
+TEST(OverviewStripTest, StripFromUniformWaveform) {
+    WaveformPointer pWaveform = createWaveform(1920);
+    fillWaveform(pWaveform, 40, 10, 20, 30);
+
+    const QByteArray strip = mixxx::makeOverviewStrip(pWaveform);
+    ASSERT_EQ(mixxx::kOverviewStripNumBytes, strip.size());
+
+    const unsigned char* pStripData =
+            reinterpret_cast<const unsigned char*>(strip.constData());
+    for (int column = 0; column < mixxx::kOverviewStripLength; ++column) {
+        const unsigned char* pColumn =
+                pStripData + column * mixxx::kOverviewStripBytesPerColumn;
+        EXPECT_EQ(40, pColumn[0]);
+        EXPECT_EQ(10, pColumn[1]);
+        EXPECT_EQ(20, pColumn[2]);
+        EXPECT_EQ(30, pColumn[3]);
+    }
+}
+
+TEST(OverviewStripTest, StripFoldsChannelsIntoMono) {
+    WaveformPointer pWaveform = createWaveform(64);
+    WaveformData* pData = pWaveform->data();
+    for (int frame = 0; frame < pWaveform->getDataSize() / 2; ++frame) {
+        // Louder left than right channel
+        pData[frame * 2].filtered.all = 200;
+        pData[frame * 2 + 1].filtered.all = 100;
+    }
+    pWaveform->setCompletion(pWaveform->getDataSize());
+
+    const QByteArray strip = mixxx::makeOverviewStrip(pWaveform);
+    ASSERT_EQ(mixxx::kOverviewStripNumBytes, strip.size());
+    const unsigned char* pStripData =
+            reinterpret_cast<const unsigned char*>(strip.constData());
+    for (int column = 0; column < mixxx::kOverviewStripLength; ++column) {
+        EXPECT_EQ(200,
+                pStripData[column * mixxx::kOverviewStripBytesPerColumn]);
+    }
+}
+
+TEST(OverviewStripTest, EmptyWaveformYieldsEmptyStrip) {
+    EXPECT_TRUE(mixxx::makeOverviewStrip(ConstWaveformPointer()).isEmpty());
+    EXPECT_TRUE(mixxx::makeOverviewStrip(
+            ConstWaveformPointer(new Waveform()))
+                        .isEmpty());
+}
+
+TEST(OverviewStripTest, RenderRejectsInvalidStripSize) {
+    const WaveformSignalColors signalColors;
+    EXPECT_TRUE(mixxx::renderOverviewStrip(QByteArray(),
+            mixxx::OverviewType::RGB,
+            signalColors)
+                        .isNull());
+    EXPECT_TRUE(mixxx::renderOverviewStrip(QByteArray(10, '\x7f'),
+            mixxx::OverviewType::RGB,
+            signalColors)
+                        .isNull());
+}
+
+TEST(OverviewStripTest, RenderStrip) {
+    WaveformPointer pWaveform = createWaveform(1920);
+    fillWaveform(pWaveform, 40, 10, 20, 30);
+    const QByteArray strip = mixxx::makeOverviewStrip(pWaveform);
+
+    const WaveformSignalColors signalColors;
+    for (const auto type : {
+                 mixxx::OverviewType::Filtered,
+                 mixxx::OverviewType::HSV,
+                 mixxx::OverviewType::RGB,
+         }) {
+        const QImage image = mixxx::renderOverviewStrip(strip, type, signalColors);
+        EXPECT_FALSE(image.isNull());
+    }
+}
+
+} // namespace
@@ -59,6 +59,7 @@ class MockPortMidiDevice : public PortMidiDevice {
     MOCK_METHOD2(read, int(PmEvent*, int32_t));
     MOCK_METHOD1(writeShort, PmError(int32_t));
     MOCK_METHOD1(writeSysEx, PmError(unsigned char*));
+    MOCK_METHOD2(write, PmError(PmEvent*, int32_t));
 };
 
 class PortMidiControllerTest : public MixxxTest {
@@ -125,6 +126,16 @@ MATCHER_P(ByteArrayEquals, value,
     return true;
 }
 
+MATCHER_P(EventMessagesEqual, value,
+          "Checks that the PmEvent argument array carries exactly the "
+          "provided message words.") {
+    for (size_t i = 0; i < value.size(); ++i) {
+        if (arg[i].message != value.at(i))
+            return false;
+    }
+    return true;
+}
+
 TEST_F(PortMidiControllerTest, OpenClose) {
     Sequence input;
     ON_CALL(*m_mockInput, isOpen())
@@ -157,26 +168,50 @@ TEST_F(PortMidiControllerTest, OpenClose) {
     EXPECT_FALSE(m_pController->isOpen());
 };
 
-TEST_F(PortMidiControllerTest, WriteShort) {
-    // Note that Pm_WriteShort takes an int32_t formatted as 0x00B2B1SS where SS
+TEST_F(PortMidiControllerTest, WriteShort_BatchedPerPoll) {
+    // Note that a PmMessage is an int32_t formatted as 0x00B2B1SS where SS
     // is the status byte, B1 is the first message byte and B2 is the second
-    // message byte.
+    // message byte. Short messages queued within one poll tick are sent as
+    // a single multi-event write.
+    std::vector<PmMessage> messages = {0x403C90, 0xFFFFFF, 0x403C80};
+
+    EXPECT_CALL(*m_mockInput, isOpen())
+            .WillRepeatedly(Return(false));
+    EXPECT_CALL(*m_mockOutput, isOpen())
+            .WillRepeatedly(Return(true));
+    EXPECT_CALL(*m_mockOutput,
+            write(EventMessagesEqual(messages), static_cast<int32_t>(messages.size())))
+            .WillOnce(Return(pmNoError));
+
+    m_pController->sendShortMsg(0x90, 0x3C, 0x40);
+    m_pController->sendShortMsg(0xFF, 0xFF, 0xFF);
+    m_pController->sendShortMsg(0x80, 0x3C, 0x40);
+    pollDevice();
+    // A tick with nothing queued must not touch the device.
+    pollDevice();
+};
+
+TEST_F(PortMidiControllerTest, WriteShort_FlushedBeforeSysEx) {
+    // A SysEx message must not overtake short messages queued before it.
+    QList<int> sysex;
+    sysex.append(0xF0);
+    sysex.append(0x12);
+    sysex.append(0xF7);
+
+    std::vector<PmMessage> messages = {0x403C90};
+
     Sequence output;
     EXPECT_CALL(*m_mockOutput, isOpen())
             .WillRepeatedly(Return(true));
-    EXPECT_CALL(*m_mockOutput, writeShort(0x403C90))
+    EXPECT_CALL(*m_mockOutput, write(EventMessagesEqual(messages), 1))
             .InSequence(output)
             .WillOnce(Return(pmNoError));
-    EXPECT_CALL(*m_mockOutput, writeShort(0xFFFFFF))
-            .InSequence(output)
-            .WillOnce(Return(pmBadData));
-    EXPECT_CALL(*m_mockOutput, writeShort(0x403C80))
+    EXPECT_CALL(*m_mockOutput, writeSysEx(ByteArrayEquals(sysex)))
             .InSequence(output)
             .WillOnce(Return(pmNoError));
 
     m_pController->sendShortMsg(0x90, 0x3C, 0x40);
-    m_pController->sendShortMsg(0xFF, 0xFF, 0xFF);
-    m_pController->sendShortMsg(0x80, 0x3C, 0x40);
+    m_pController->sendSysexMsg(sysex, sysex.length());
 };
 
 TEST_F(PortMidiControllerTest, WriteSysex) {
@@ -24,6 +24,18 @@ TEST(Rotary, noQuantization) {
     EXPECT_DOUBLE_EQ(rot.filter(0.0), 0.0);
 }
 
+TEST(Rotary, zeroHistoryStaysZero) {
+    Rotary rot(3);
+    // All-zero history takes the fast path and must behave like the
+    // regular filter path.
+    EXPECT_DOUBLE_EQ(rot.filter(0.0), 0.0);
+    EXPECT_DOUBLE_EQ(rot.filter(1.5), 0.5);
+    EXPECT_DOUBLE_EQ(rot.filter(0.0), 0.5);
+    EXPECT_DOUBLE_EQ(rot.filter(0.0), 0.5);
+    EXPECT_DOUBLE_EQ(rot.filter(0.0), 0.0);
+    EXPECT_DOUBLE_EQ(rot.filter(0.0), 0.0);
+}
+
 TEST(Rotary, hugeFilterSequential) {
     static constexpr int size = 200;
     Rotary rot(size);
@@ -4,9 +4,11 @@
 #include <QList>
 #include <QPair>
 #include <QtDebug>
+#include <limits>
 #include <vector>
 
 #include "util/sample.h"
+#include "util/samplesimd.h"
 #include "util/timer.h"
 
 namespace {
@@ -289,6 +291,36 @@ TEST_F(SampleUtilTest, convertS16ToFloat32) {
     }
 }
 
+TEST_F(SampleUtilTest, convertFloat32ToS16WithGain) {
+    for (int i = 0; i < buffers.size(); ++i) {
+        CSAMPLE* buffer = buffers[i];
+        int size = sizes[i];
+        auto s16 = std::vector<SAMPLE>(size);
+        // Unity gain matches the plain conversion.
+        FillBuffer(buffer, 0.5f, size);
+        SampleUtil::convertFloat32ToS16WithGain(s16.data(), buffer, 1.0f, size);
+        for (int j = 0; j < size; ++j) {
+            EXPECT_EQ(static_cast<SAMPLE>(0.5f * -SAMPLE_MINIMUM), s16[j]);
+        }
+        // The gain is applied before the conversion.
+        SampleUtil::convertFloat32ToS16WithGain(s16.data(), buffer, 0.5f, size);
+        for (int j = 0; j < size; ++j) {
+            EXPECT_EQ(static_cast<SAMPLE>(0.25f * -SAMPLE_MINIMUM), s16[j]);
+        }
+        // Samples exceeding the valid range after applying the gain are
+        // clamped.
+        SampleUtil::convertFloat32ToS16WithGain(s16.data(), buffer, 4.0f, size);
+        for (int j = 0; j < size; ++j) {
+            EXPECT_EQ(SAMPLE_MAXIMUM, s16[j]);
+        }
+        FillBuffer(buffer, -0.5f, size);
+        SampleUtil::convertFloat32ToS16WithGain(s16.data(), buffer, 4.0f, size);
+        for (int j = 0; j < size; ++j) {
+            EXPECT_EQ(SAMPLE_MINIMUM, s16[j]);
+        }
+    }
+}
+
 TEST_F(SampleUtilTest, sumAbsPerChannel) {
     for (int i = 0; i < evenBuffers.size(); ++i) {
         int j = evenBuffers[i];
@@ -303,6 +335,20 @@ TEST_F(SampleUtilTest, sumAbsPerChannel) {
     }
 }
 
+TEST_F(SampleUtilTest, maxAbsPerChannel) {
+    for (int i = 0; i < evenBuffers.size(); ++i) {
+        int j = evenBuffers[i];
+        CSAMPLE* buffer = buffers[j];
+        int size = sizes[j];
+        FillBuffer(buffer, -1.0f, size);
+        CSAMPLE fMaxL = 0, fMaxR = 0;
+        SampleUtil::applyAlternatingGain(buffer, 1.0, 2.0, size);
+        SampleUtil::maxAbsPerChannel(&fMaxL, &fMaxR, buffer, size);
+        EXPECT_FLOAT_EQ(fMaxL, 1.0);
+        EXPECT_FLOAT_EQ(fMaxR, 2.0);
+    }
+}
+
 TEST_F(SampleUtilTest, interleaveBuffer) {
     for (int i = 0; i < buffers.size(); ++i) {
         CSAMPLE* buffer = buffers[i];
@@ -373,6 +419,37 @@ TEST_F(SampleUtilTest, reverse) {
     }
 }
 
+TEST_F(SampleUtilTest, scrubDenormalsAndNaNs) {
+    CSAMPLE* buffer = buffers[0];
+    const int size = sizes[0];
+    for (int i = 0; i < size; ++i) {
+        buffer[i] = i * 0.1f;
+    }
+    EXPECT_EQ(0, SampleUtil::scrubDenormalsAndNaNs(buffer, size));
+    // Normal samples, zeros and the limits of the normal range pass
+    // unmodified.
+    buffer[0] = 0.0f;
+    buffer[1] = -0.0f;
+    buffer[2] = std::numeric_limits<CSAMPLE>::min();
+    buffer[3] = -std::numeric_limits<CSAMPLE>::min();
+    buffer[4] = std::numeric_limits<CSAMPLE>::max();
+    EXPECT_EQ(0, SampleUtil::scrubDenormalsAndNaNs(buffer, size));
+    EXPECT_FLOAT_EQ(std::numeric_limits<CSAMPLE>::min(), buffer[2]);
+    EXPECT_FLOAT_EQ(0.5f, buffer[5]);
+    // NaNs, infinities and denormals are flushed to zero and counted.
+    buffer[0] = std::numeric_limits<CSAMPLE>::quiet_NaN();
+    buffer[1] = std::numeric_limits<CSAMPLE>::infinity();
+    buffer[2] = -std::numeric_limits<CSAMPLE>::infinity();
+    buffer[3] = std::numeric_limits<CSAMPLE>::denorm_min();
+    buffer[4] = -std::numeric_limits<CSAMPLE>::denorm_min();
+    EXPECT_EQ(5, SampleUtil::scrubDenormalsAndNaNs(buffer, size));
+    for (int i = 0; i < 5; ++i) {
+        EXPECT_FLOAT_EQ(0.0f, buffer[i]);
+    }
+    EXPECT_FLOAT_EQ(0.5f, buffer[5]);
+    EXPECT_EQ(0, SampleUtil::scrubDenormalsAndNaNs(buffer, size));
+}
+
 TEST_F(SampleUtilTest, copyReverseStereo) {
     EXPECT_TRUE(buffers.size() > 1 && sizes[0] > 10 && sizes[1] > 10);
 
@@ -466,6 +543,112 @@ TEST_F(SampleUtilTest, mixMultichannelToStereo) {
     EXPECT_FLOAT_EQ(destination[3], 0.9f + 1.1f + 1.3f /* + 1.5f*/);
 }
 
+TEST_F(SampleUtilTest, mixWithRampingGainMatchesSequentialAdds) {
+    // The fused multi-source kernel must produce the same mix as one
+    // addWithRampingGain() call per source. Use 6 sources to cover both
+    // the fused group of four and the single-source tail, and an odd
+    // gain mix of constant, ramping and silent sources.
+    constexpr int kNumSrcs = 6;
+    constexpr int kNumSamples = 256;
+    const CSAMPLE_GAIN oldGains[kNumSrcs] = {1.0f, 0.0f, 0.5f, 1.0f, 0.25f, 0.0f};
+    const CSAMPLE_GAIN newGains[kNumSrcs] = {1.0f, 0.0f, 0.75f, 0.0f, 0.25f, 1.0f};
+
+    std::vector<CSAMPLE> sources(kNumSrcs * kNumSamples);
+    const CSAMPLE* sourcePtrs[kNumSrcs];
+    for (int c = 0; c < kNumSrcs; ++c) {
+        for (int i = 0; i < kNumSamples; ++i) {
+            sources[c * kNumSamples + i] = 0.01f * i - 0.3f * c;
+        }
+        sourcePtrs[c] = &sources[c * kNumSamples];
+    }
+
+    std::vector<CSAMPLE> expected(kNumSamples, 0.0f);
+    for (int c = 0; c < kNumSrcs; ++c) {
+        SampleUtil::addWithRampingGain(expected.data(),
+                sourcePtrs[c],
+                oldGains[c],
+                newGains[c],
+                kNumSamples);
+    }
+
+    std::vector<CSAMPLE> actual(kNumSamples, 0.0f);
+    SampleUtil::mixWithRampingGain(actual.data(),
+            sourcePtrs,
+            oldGains,
+            newGains,
+            kNumSrcs,
+            kNumSamples);
+
+    for (int i = 0; i < kNumSamples; ++i) {
+        // The fused kernel sums the four products of a group in one
+        // expression, which may round differently than sequential adds.
+        EXPECT_NEAR(expected[i], actual[i], 1e-6);
+    }
+}
+
+TEST_F(SampleUtilTest, simdKernelsMatchScalar) {
+    // Cross-check the runtime-selected SIMD backend against the scalar
+    // reference kernels, including the odd sizes that exercise the scalar
+    // tail loops. The sum kernels accumulate in a different order than the
+    // scalar reference, so those comparisons use a relative tolerance.
+    const SampleUtilSimd::Kernels& simd = SampleUtilSimd::kernels();
+    const SampleUtilSimd::Kernels& scalar = SampleUtilSimd::scalarKernels();
+    qDebug() << "Testing SIMD backend"
+             << SampleUtilSimd::backendName(SampleUtilSimd::backend());
+    for (int i = 0; i < buffers.size(); ++i) {
+        CSAMPLE* buffer = buffers[i];
+        int size = sizes[i];
+        for (int j = 0; j < size; j++) {
+            // Pseudo-random samples in [-1.25, 1.25] so that some samples
+            // clip and the sign handling is exercised.
+            buffer[j] = static_cast<CSAMPLE>((j * 2654435761u % 1000) - 500) / 400.0f;
+        }
+        CSAMPLE* pExpected = SampleUtil::alloc(size * 2);
+        CSAMPLE* pActual = SampleUtil::alloc(size * 2);
+
+        scalar.copyWithGain(pExpected, buffer, 0.7f, size);
+        simd.copyWithGain(pActual, buffer, 0.7f, size);
+        for (int j = 0; j < size; j++) {
+            EXPECT_FLOAT_EQ(pExpected[j], pActual[j]);
+        }
+
+        scalar.addWithGain(pExpected, buffer, -0.3f, size);
+        simd.addWithGain(pActual, buffer, -0.3f, size);
+        for (int j = 0; j < size; j++) {
+            EXPECT_FLOAT_EQ(pExpected[j], pActual[j]);
+        }
+
+        scalar.interleaveStereo(pExpected, buffer, buffer, size);
+        simd.interleaveStereo(pActual, buffer, buffer, size);
+        for (int j = 0; j < size * 2; j++) {
+            EXPECT_FLOAT_EQ(pExpected[j], pActual[j]);
+        }
+
+        if (size % 2 == 0) {
+            scalar.deinterleaveStereo(pExpected, pExpected + size / 2, buffer, size / 2);
+            simd.deinterleaveStereo(pActual, pActual + size / 2, buffer, size / 2);
+            for (int j = 0; j < size; j++) {
+                EXPECT_FLOAT_EQ(pExpected[j], pActual[j]);
+            }
+        }
+
+        CSAMPLE absLExpected = 0;
+        CSAMPLE absRExpected = 0;
+        CSAMPLE absLActual = 0;
+        CSAMPLE absRActual = 0;
+        SampleUtil::CLIP_STATUS clipExpected = scalar.sumAbsPerChannel(
+                &absLExpected, &absRExpected, buffer, size);
+        SampleUtil::CLIP_STATUS clipActual = simd.sumAbsPerChannel(
+                &absLActual, &absRActual, buffer, size);
+        EXPECT_EQ(clipExpected, clipActual);
+        EXPECT_NEAR(absLExpected, absLActual, fabs(absLExpected) * 1e-5);
+        EXPECT_NEAR(absRExpected, absRActual, fabs(absRExpected) * 1e-5);
+
+        SampleUtil::free(pExpected);
+        SampleUtil::free(pActual);
+    }
+}
+
 static void BM_MemCpy(benchmark::State& state) {
     SINT size = static_cast<SINT>(state.range(0));
     CSAMPLE* buffer = SampleUtil::alloc(size);
@@ -1127,6 +1127,68 @@ TEST_F(SearchQueryParserTest, SplitQueryIntoWords) {
     EXPECT_EQ(rv4, ex4);
 }
 
+TEST_F(SearchQueryParserTest, QueryIsRefinement) {
+    // Appending characters to a plain text term narrows the result set
+    EXPECT_TRUE(SearchQueryParser::queryIsRefinement(
+            QStringLiteral("searchm"),
+            QStringLiteral("searchme")));
+
+    // Identical queries match the identical result set
+    EXPECT_TRUE(SearchQueryParser::queryIsRefinement(
+            QStringLiteral("abc def"),
+            QStringLiteral("abc def")));
+
+    // Additional terms narrow the conjunction further
+    EXPECT_TRUE(SearchQueryParser::queryIsRefinement(
+            QStringLiteral("abc"),
+            QStringLiteral("abc def")));
+
+    // Term containment is case insensitive like the search itself
+    EXPECT_TRUE(SearchQueryParser::queryIsRefinement(
+            QStringLiteral("abc"),
+            QStringLiteral("ABCD")));
+
+    // An empty previous query matches the whole table
+    EXPECT_FALSE(SearchQueryParser::queryIsRefinement(
+            QLatin1String(""),
+            QStringLiteral("abc")));
+
+    // Removing or replacing a term widens the result set
+    EXPECT_FALSE(SearchQueryParser::queryIsRefinement(
+            QStringLiteral("abc def"),
+            QStringLiteral("abc")));
+    EXPECT_FALSE(SearchQueryParser::queryIsRefinement(
+            QStringLiteral("abc"),
+            QStringLiteral("abd")));
+
+    // Extending a negated term widens the result set
+    EXPECT_FALSE(SearchQueryParser::queryIsRefinement(
+            QStringLiteral("-ab"),
+            QStringLiteral("-abc")));
+
+    // Extending the argument of a comparison filter may widen the
+    // result set, e.g. bpm:<12 matches more tracks than bpm:<1
+    EXPECT_FALSE(SearchQueryParser::queryIsRefinement(
+            QStringLiteral("bpm:<1"),
+            QStringLiteral("bpm:<12")));
+    EXPECT_FALSE(SearchQueryParser::queryIsRefinement(
+            QStringLiteral("crate:abc"),
+            QStringLiteral("crate:abcd")));
+
+    // OR groups may widen the result set when extended
+    EXPECT_FALSE(SearchQueryParser::queryIsRefinement(
+            QStringLiteral("abc"),
+            QStringLiteral("abc|def")));
+    EXPECT_FALSE(SearchQueryParser::queryIsRefinement(
+            QStringLiteral("abc OR def"),
+            QStringLiteral("abc OR defg")));
+
+    // Fuzzy terms are not plain substring matches
+    EXPECT_FALSE(SearchQueryParser::queryIsRefinement(
+            QStringLiteral("~abc"),
+            QStringLiteral("~abcd")));
+}
+
 TEST_F(SearchQueryParserTest, QueryIsLessSpecific) {
     // Generate a file name for the temporary file
     EXPECT_TRUE(SearchQueryParser::queryIsLessSpecific(
@@ -1391,3 +1453,20 @@ TEST_F(SearchQueryParserTest, QuotedOrOperator) {
     pTrackI->setComment("house");
     EXPECT_TRUE(pQuery->match(pTrackI));
 }
+
+TEST_F(SearchQueryParserTest, RepeatedParseUsesCachedTokenClassification) {
+    m_parser.setSearchColumns({"artist", "album"});
+
+    // The second parse of the same query hits the memoized token
+    // classifications and must produce an identical query.
+    auto pQueryFirst = m_parser.parseQuery("title:house bpm:128 asdf", QString());
+    auto pQuerySecond = m_parser.parseQuery("title:house bpm:128 asdf", QString());
+    EXPECT_STREQ(qPrintable(pQueryFirst->toSql()),
+            qPrintable(pQuerySecond->toSql()));
+
+    // Appending to a token must not be short-circuited by the cache
+    // entry of its prefix.
+    auto pQueryExtended = m_parser.parseQuery("title:housemusic bpm:128 asdf", QString());
+    EXPECT_STRNE(qPrintable(pQueryFirst->toSql()),
+            qPrintable(pQueryExtended->toSql()));
+}
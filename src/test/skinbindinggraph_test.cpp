@@ -0,0 +1,108 @@
+#include "skin/skinbindinggraph.h"
+
+#include <gtest/gtest.h>
+
+#include "control/controlobject.h"
+#include "test/mixxxtest.h"
+
+namespace {
+
+class SkinBindingGraphTest : public MixxxTest {
+  protected:
+    SkinBindingGraphTest()
+            : m_volume(ConfigKey(QStringLiteral("[Channel1]"),
+                      QStringLiteral("volume"))),
+              m_pregain(ConfigKey(QStringLiteral("[Channel1]"),
+                      QStringLiteral("pregain"))) {
+    }
+
+    void processEvents() {
+        // Process the pending signal deliveries and the sweep that was
+        // queued behind them.
+        application()->processEvents();
+        application()->processEvents();
+    }
+
+    ControlObject m_volume;
+    ControlObject m_pregain;
+    SkinBindingGraph m_graph;
+};
+
+TEST_F(SkinBindingGraphTest, BatchesInputChangesIntoOneSweep) {
+    const auto volume = m_graph.addInput(m_volume.getKey());
+    const auto pregain = m_graph.addInput(m_pregain.getKey());
+    int evaluations = 0;
+    const auto product = m_graph.addBinding(
+            {volume, pregain},
+            [&evaluations](std::span<const double> values) {
+                ++evaluations;
+                return values[0] * values[1];
+            });
+    // The initial evaluation happens synchronously in addBinding().
+    EXPECT_EQ(1, evaluations);
+
+    m_volume.set(0.5);
+    m_pregain.set(4.0);
+    processEvents();
+
+    // Both changes are collapsed into a single sweep with a single
+    // re-evaluation of the dependent binding.
+    EXPECT_EQ(1, m_graph.sweepCount());
+    EXPECT_EQ(2, evaluations);
+    EXPECT_DOUBLE_EQ(2.0, m_graph.value(product));
+}
+
+TEST_F(SkinBindingGraphTest, ChainedBindingsEvaluateInOneSweep) {
+    const auto volume = m_graph.addInput(m_volume.getKey());
+    const auto scaled = m_graph.addBinding(
+            {volume},
+            [](std::span<const double> values) {
+                return values.front() * 100;
+            });
+    double notified = -1.0;
+    const auto offset = m_graph.addBinding(
+            {scaled},
+            [](std::span<const double> values) {
+                return values.front() + 1;
+            },
+            [&notified](double value) {
+                notified = value;
+            });
+
+    m_volume.set(0.25);
+    processEvents();
+
+    EXPECT_EQ(1, m_graph.sweepCount());
+    EXPECT_DOUBLE_EQ(25.0, m_graph.value(scaled));
+    EXPECT_DOUBLE_EQ(26.0, m_graph.value(offset));
+    EXPECT_DOUBLE_EQ(26.0, notified);
+}
+
+TEST_F(SkinBindingGraphTest, UnchangedValueDoesNotNotifyDependents) {
+    const auto volume = m_graph.addInput(m_volume.getKey());
+    const auto clamped = m_graph.addBinding(
+            {volume},
+            [](std::span<const double> values) {
+                return values.front() > 0 ? 1.0 : 0.0;
+            });
+    int dependentEvaluations = 0;
+    m_graph.addBinding(
+            {clamped},
+            [&dependentEvaluations](std::span<const double> values) {
+                ++dependentEvaluations;
+                return values.front();
+            });
+    EXPECT_EQ(1, dependentEvaluations);
+
+    m_volume.set(0.5);
+    processEvents();
+    EXPECT_EQ(2, dependentEvaluations);
+
+    // Another change that leaves the clamped value at 1.0 must not
+    // re-evaluate the transitive dependent.
+    m_volume.set(0.75);
+    processEvents();
+    EXPECT_EQ(2, dependentEvaluations);
+}
+
+} // namespace
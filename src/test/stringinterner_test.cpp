@@ -0,0 +1,54 @@
+#include "util/stringinterner.h"
+
+#include <gtest/gtest.h>
+
+#include <QString>
+
+namespace {
+
+class StringInternerTest : public testing::Test {
+  protected:
+    void SetUp() override {
+        mixxx::StringInterner::clear();
+    }
+
+    void TearDown() override {
+        mixxx::StringInterner::clear();
+    }
+};
+
+TEST_F(StringInternerTest, RepeatedValuesShareStorage) {
+    // Build the strings separately so they do not share storage already
+    // through the literal.
+    const QString first = QStringLiteral("Artist ") + QString::number(1);
+    const QString second = QStringLiteral("Artist ") + QString::number(1);
+    ASSERT_EQ(first, second);
+    ASSERT_NE(first.constData(), second.constData());
+
+    const QString firstInterned = mixxx::StringInterner::intern(first);
+    const QString secondInterned = mixxx::StringInterner::intern(second);
+    EXPECT_EQ(first, firstInterned);
+    EXPECT_EQ(firstInterned.constData(), secondInterned.constData());
+    EXPECT_EQ(1, mixxx::StringInterner::count());
+}
+
+TEST_F(StringInternerTest, EditingDetachesFromPool) {
+    const QString value = QStringLiteral("Album ") + QString::number(1);
+    QString interned = mixxx::StringInterner::intern(value);
+    QString other = mixxx::StringInterner::intern(value);
+    ASSERT_EQ(interned.constData(), other.constData());
+
+    // Copy-on-write: editing one holder must not affect the others.
+    interned.append(QStringLiteral(" (Remastered)"));
+    EXPECT_NE(interned, other);
+    EXPECT_EQ(value, other);
+    EXPECT_EQ(value, mixxx::StringInterner::intern(value));
+}
+
+TEST_F(StringInternerTest, EmptyStringsAreNotPooled) {
+    EXPECT_EQ(QString(), mixxx::StringInterner::intern(QString()));
+    EXPECT_EQ(QStringLiteral(""), mixxx::StringInterner::intern(QStringLiteral("")));
+    EXPECT_EQ(0, mixxx::StringInterner::count());
+}
+
+} // namespace
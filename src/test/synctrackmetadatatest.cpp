@@ -3,6 +3,7 @@
 #include <QFile>
 #include <QFileInfo>
 #include <QTemporaryDir>
+#include <QThreadPool>
 #include <memory>
 
 #include "library/library_prefs.h"
@@ -139,6 +140,12 @@ class SyncTrackMetadataTest : public LibraryTest {
     TrackPointer loadTrack() const {
         const auto pTrack = trackCollectionManager()->getTrackById(m_trackId);
         DEBUG_ASSERT(pTrack);
+        // Materializing an already synchronized track from the database
+        // schedules a partial metadata import on the global thread pool
+        // that temporarily holds another reference to the track. Wait
+        // until it has finished to keep the use_count and cache eviction
+        // assertions below deterministic.
+        QThreadPool::globalInstance()->waitForDone();
         return pTrack;
     }
 
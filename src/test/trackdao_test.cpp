@@ -56,3 +56,30 @@ TEST_F(TrackDAOTest, detectMovedTracks) {
     QSet<QString> trackLocations = trackDAO.getAllTrackLocations();
     EXPECT_THAT(trackLocations, UnorderedElementsAre(newFile.location(), otherFile.location()));
 }
+
+TEST_F(TrackDAOTest, getOrCreatePreviewTrack) {
+    const QString trackLocation =
+            QDir(MixxxTest::getOrInitTestDir().filePath(
+                         QStringLiteral("id3-test-data")))
+                    .absoluteFilePath(QStringLiteral("artist.mp3"));
+
+    const TrackPointer pPreviewTrack =
+            trackCollectionManager()->getOrCreatePreviewTrack(
+                    TrackRef::fromFilePath(trackLocation));
+    ASSERT_NE(nullptr, pPreviewTrack);
+
+    // The track is resolved without writing a library row
+    EXPECT_FALSE(pPreviewTrack->getId().isValid());
+    EXPECT_TRUE(internalCollection()->getTrackDAO().getAllTrackLocations().isEmpty());
+
+    // Resolving the same file again returns the same cached object
+    EXPECT_EQ(pPreviewTrack,
+            trackCollectionManager()->getOrCreatePreviewTrack(
+                    TrackRef::fromFilePath(trackLocation)));
+
+    // Adding the track to the library afterwards promotes the same
+    // object to a library track instead of creating a second instance
+    const TrackPointer pAddedTrack = getOrAddTrackByLocation(trackLocation);
+    EXPECT_EQ(pPreviewTrack, pAddedTrack);
+    EXPECT_TRUE(pPreviewTrack->getId().isValid());
+}
@@ -5,6 +5,8 @@
 #include <unordered_map>
 #include <vector>
 
+#include <google/protobuf/arena.h>
+
 #include "audio/frame.h"
 #include "proto/beats.pb.h"
 #include "track/beats.h"
@@ -322,15 +324,20 @@ BeatsPointer Beats::fromBeatMapByteArray(
         return nullptr;
     }
 
-    track::io::BeatMap map;
-    if (!map.ParseFromArray(byteArray.constData(), byteArray.size())) {
+    // Parse on a protobuf arena: a long track stores thousands of Beat
+    // submessages and heap parsing performs one allocation per beat.
+    // The arena serves them from a few larger blocks that are freed all
+    // at once when parsing is done. The wire format is unchanged.
+    google::protobuf::Arena arena;
+    auto* pMap = google::protobuf::Arena::Create<track::io::BeatMap>(&arena);
+    if (!pMap->ParseFromArray(byteArray.constData(), byteArray.size())) {
         return nullptr;
     }
 
     QVector<audio::FramePos> beatPositions;
-    beatPositions.reserve(map.beat_size());
-    for (int i = 0; i < map.beat_size(); i++) {
-        beatPositions.append(audio::FramePos(map.beat(i).frame_position()));
+    beatPositions.reserve(pMap->beat_size());
+    for (int i = 0; i < pMap->beat_size(); i++) {
+        beatPositions.append(audio::FramePos(pMap->beat(i).frame_position()));
     }
 
     if (beatPositions.size() < 2) {
@@ -368,9 +375,8 @@ QByteArray Beats::toBeatMapByteArray() const {
     mixxx::track::io::BeatMap map;
     for (auto it = cfirstmarker(); it != clastmarker() + 1; it++) {
         const auto position = (*it).toLowerFrameBoundary();
-        track::io::Beat beat;
-        beat.set_frame_position(static_cast<google::protobuf::int32>(position.value()));
-        map.add_beat()->CopyFrom(beat);
+        map.add_beat()->set_frame_position(
+                static_cast<google::protobuf::int32>(position.value()));
     }
 
     std::string output;
@@ -390,7 +396,18 @@ bool Beats::findPrevNextBeats(audio::FramePos position,
         audio::FramePos* prevBeatPosition,
         audio::FramePos* nextBeatPosition,
         bool snapToNearBeats) const {
-    auto it = iteratorFrom(position);
+    return findPrevNextBeatsFromIterator(iteratorFrom(position),
+            position,
+            prevBeatPosition,
+            nextBeatPosition,
+            snapToNearBeats);
+}
+
+bool Beats::findPrevNextBeatsFromIterator(ConstIterator it,
+        audio::FramePos position,
+        audio::FramePos* prevBeatPosition,
+        audio::FramePos* nextBeatPosition,
+        bool snapToNearBeats) const {
     if (it == cend()) {
         *prevBeatPosition = *it;
         *nextBeatPosition = audio::kInvalidFramePos;
@@ -472,6 +489,67 @@ Beats::ConstIterator Beats::iteratorFrom(audio::FramePos position) const {
     return it;
 }
 
+Beats::ConstIterator Beats::iteratorFrom(
+        audio::FramePos position, const ConstIterator& hint) const {
+    DEBUG_ASSERT(isValid());
+    // During playback, consecutive lookups either stay inside the beat
+    // interval of the previous lookup or advance by one beat, so checking a
+    // couple of beats ahead of the hint covers the common case. Anything
+    // further away (i.e. a seek) is cheaper to resolve with the regular
+    // lookup right away.
+    constexpr int kMaxBeatsAfterHint = 2;
+    if (hint != cbegin() && hint != cend()) {
+        auto it = hint;
+        for (int i = 0; i <= kMaxBeatsAfterHint && it != cend(); ++i, ++it) {
+            if (*it >= position) {
+                if (*std::prev(it) < position) {
+                    // `it` is the first beat at or after the lookup
+                    // position, matching the regular lookup result.
+                    return it;
+                }
+                // The lookup position moved backwards past the hint.
+                break;
+            }
+        }
+    }
+    return iteratorFrom(position);
+}
+
+bool Beats::Cursor::findPrevNextBeats(const BeatsPointer& pBeats,
+        audio::FramePos position,
+        audio::FramePos* prevBeatPosition,
+        audio::FramePos* nextBeatPosition,
+        bool snapToNearBeats) {
+    VERIFY_OR_DEBUG_ASSERT(pBeats) {
+        invalidate();
+        *prevBeatPosition = audio::kInvalidFramePos;
+        *nextBeatPosition = audio::kInvalidFramePos;
+        return false;
+    }
+    const ConstIterator it = iteratorFrom(pBeats, position);
+    return pBeats->findPrevNextBeatsFromIterator(it,
+            position,
+            prevBeatPosition,
+            nextBeatPosition,
+            snapToNearBeats);
+}
+
+Beats::ConstIterator Beats::Cursor::iteratorFrom(
+        const BeatsPointer& pBeats, audio::FramePos position) {
+    DEBUG_ASSERT(pBeats);
+    if (m_pBeats != pBeats) {
+        // The track's beats have been replaced, the cached iterator points
+        // into the previous Beats object.
+        m_pBeats = pBeats;
+        m_it = std::nullopt;
+    }
+    const ConstIterator it = m_it
+            ? pBeats->iteratorFrom(position, *m_it)
+            : pBeats->iteratorFrom(position);
+    m_it = it;
+    return it;
+}
+
 audio::FramePos Beats::findNthBeat(audio::FramePos position, int n) const {
     if (n == 0) {
         return audio::kInvalidFramePos;
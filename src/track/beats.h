@@ -153,6 +153,49 @@ class Beats : private std::enable_shared_from_this<Beats> {
         int m_beatOffset;
     };
 
+    /// A stateful cursor for consumers that query beat positions on every
+    /// engine callback (e.g. QuantizeControl, ClockControl) or render pass.
+    /// During regular playback consecutive lookup positions fall into the
+    /// same or the directly following beat interval, so the cursor caches
+    /// the iterator of the previous query and resolves such lookups in O(1)
+    /// instead of repeating the search from scratch.
+    ///
+    /// The cursor remembers the Beats object it was primed with and discards
+    /// the cached iterator when the track's beats are replaced. Seeking does
+    /// not require explicit invalidation either: if the cached beat interval
+    /// no longer matches the lookup position, the query falls back to the
+    /// regular lookup and re-primes the cursor.
+    ///
+    /// Each consumer is supposed to keep its own cursor, since interleaving
+    /// queries from different positions would defeat the cache.
+    class Cursor {
+      public:
+        Cursor() = default;
+
+        /// Drop the cached position, e.g. when the track is ejected.
+        void invalidate() {
+            m_pBeats = nullptr;
+            m_it = std::nullopt;
+        }
+
+        /// Same as Beats::findPrevNextBeats(), but resolves monotonic
+        /// lookups via the cached iterator.
+        bool findPrevNextBeats(const BeatsPointer& pBeats,
+                audio::FramePos position,
+                audio::FramePos* prevBeatPosition,
+                audio::FramePos* nextBeatPosition,
+                bool snapToNearBeats);
+
+        /// Same as Beats::iteratorFrom(), but resolves monotonic lookups
+        /// via the cached iterator.
+        ConstIterator iteratorFrom(const BeatsPointer& pBeats,
+                audio::FramePos position);
+
+      private:
+        BeatsPointer m_pBeats;
+        std::optional<ConstIterator> m_it;
+    };
+
     Beats(std::vector<BeatMarker> markers,
             mixxx::audio::FramePos lastMarkerPosition,
             mixxx::Bpm lastMarkerBpm,
@@ -213,6 +256,13 @@ class Beats : private std::enable_shared_from_this<Beats> {
 
     ConstIterator iteratorFrom(audio::FramePos position) const;
 
+    /// Overload that checks whether `hint` (the result of a previous lookup)
+    /// or one of the directly following beats is the first beat at or after
+    /// `position` before falling back to the regular lookup. This turns the
+    /// repeated queries issued during monotonic playback into O(1).
+    ConstIterator iteratorFrom(audio::FramePos position,
+            const ConstIterator& hint) const;
+
     friend bool operator==(const Beats& lhs, const Beats& rhs) {
         return lhs.m_markers == rhs.m_markers &&
                 lhs.m_lastMarkerPosition == rhs.m_lastMarkerPosition &&
@@ -433,6 +483,14 @@ class Beats : private std::enable_shared_from_this<Beats> {
     QByteArray toBeatGridByteArray() const;
     QByteArray toBeatMapByteArray() const;
 
+    /// Implementation of findPrevNextBeats() with the iterator lookup
+    /// factored out, so that Cursor can supply a cached iterator.
+    bool findPrevNextBeatsFromIterator(ConstIterator it,
+            audio::FramePos position,
+            audio::FramePos* prevBeatPosition,
+            audio::FramePos* nextBeatPosition,
+            bool snapToNearBeats) const;
+
     mixxx::audio::FrameDiff_t firstBeatLengthFrames() const;
     mixxx::audio::FrameDiff_t lastBeatLengthFrames() const;
 
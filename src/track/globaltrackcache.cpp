@@ -5,8 +5,10 @@
 #include "moc_globaltrackcache.cpp"
 #include "track/track.h"
 #include "util/assert.h"
+#include "util/counter.h"
 #include "util/logger.h"
 #include "util/thread_affinity.h"
+#include "util/timer.h"
 
 namespace {
 
@@ -86,7 +88,7 @@ void GlobalTrackCacheLocker::lockCache() {
     if (traceLogEnabled()) {
         kLogger.trace() << "Locking cache";
     }
-    s_pInstance->m_mutex.lock();
+    s_pInstance->lockMutex();
     if (traceLogEnabled()) {
         kLogger.trace() << "Cache is locked";
     }
@@ -178,7 +180,7 @@ GlobalTrackCacheResolver::~GlobalTrackCacheResolver() {
         // Temporarily obtain the lock to guard access to m_isTrackCompleted.
         // Will be released by the parent class destructor
         // ~GlobalTrackCacheLocker().
-        m_pInstance->m_mutex.lock();
+        m_pInstance->lockMutex();
         // Only one GlobalTrackCacheResolver has access to the unique
         // incomplete Track. Others are suspended during construction.
         // This call wakes them up.
@@ -203,7 +205,7 @@ void GlobalTrackCacheResolver::initTrackIdAndUnlockCache(TrackId trackId) {
     DEBUG_ASSERT(GlobalTrackCacheLookupResult::None != m_lookupResult);
     DEBUG_ASSERT(m_strongPtr);
     DEBUG_ASSERT(trackId.isValid());
-    m_pInstance->m_mutex.lock();
+    m_pInstance->lockMutex();
     if (m_trackRef.getId().isValid()) {
         // Ignore initializing the same id twice
         DEBUG_ASSERT(m_trackRef.getId() == trackId);
@@ -313,6 +315,27 @@ GlobalTrackCache::~GlobalTrackCache() {
     deactivate();
 }
 
+void GlobalTrackCache::lockMutex() {
+    // Fast path: the cache is not contended most of the time.
+    if (m_mutex.tryLock()) {
+        return;
+    }
+    // Another thread currently holds the lock, e.g. an analysis
+    // worker resolving tracks while the GUI thread evicts them.
+    // Count the contention and measure how long this thread is
+    // blocked so that the impact shows up in the stats collected
+    // by StatsManager.
+    static const QString kContendedTag =
+            QStringLiteral("GlobalTrackCache::lockMutex() contended");
+    static const QString kWaitTag =
+            QStringLiteral("GlobalTrackCache::lockMutex() wait");
+    Counter(kContendedTag).increment();
+    Timer waitTimer(kWaitTag, kHistogramComputeFlags);
+    waitTimer.start();
+    m_mutex.lock();
+    waitTimer.elapsed(true);
+}
+
 void GlobalTrackCache::relocateTracks(
         GlobalTrackCacheRelocator* pRelocator) {
     if (debugLogEnabled()) {
@@ -227,6 +227,11 @@ class GlobalTrackCache : public QObject {
             deleteTrackFn_t deleteTrackFn);
     ~GlobalTrackCache() override;
 
+    // Acquires m_mutex and reports lock contention to StatsManager.
+    // All lock acquisitions must go through this function instead of
+    // locking m_mutex directly.
+    void lockMutex();
+
     void relocateTracks(
             GlobalTrackCacheRelocator* /*nullable*/ pRelocator);
 
@@ -0,0 +1,43 @@
+#include "track/loudnessenvelope.h"
+
+#include <cstring>
+
+namespace mixxx {
+
+float LoudnessEnvelope::gainAtSeconds(double seconds) const {
+    if (m_gains.isEmpty()) {
+        return 1.0f;
+    }
+    const double pos = seconds / kLoudnessEnvelopeIntervalSeconds;
+    if (pos <= 0.0) {
+        return m_gains.first();
+    }
+    const int index = static_cast<int>(pos);
+    if (index >= m_gains.size() - 1) {
+        return m_gains.last();
+    }
+    const float frac = static_cast<float>(pos - index);
+    return m_gains[index] * (1.0f - frac) + m_gains[index + 1] * frac;
+}
+
+QByteArray LoudnessEnvelope::toByteArray() const {
+    // The gain table is stored as raw 32-bit floats. The blob is only
+    // ever read back on the machine that wrote it and the version tag
+    // stored alongside guards against format changes.
+    return QByteArray(
+            reinterpret_cast<const char*>(m_gains.constData()),
+            m_gains.size() * static_cast<qsizetype>(sizeof(float)));
+}
+
+// static
+LoudnessEnvelopePointer LoudnessEnvelope::fromByteArray(const QByteArray& data) {
+    constexpr auto bytesPerGain = static_cast<qsizetype>(sizeof(float));
+    if (data.isEmpty() || data.size() % bytesPerGain != 0) {
+        return nullptr;
+    }
+    QVector<float> gains(data.size() / bytesPerGain);
+    std::memcpy(gains.data(), data.constData(), data.size());
+    return std::make_shared<LoudnessEnvelope>(std::move(gains));
+}
+
+} // namespace mixxx
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <QByteArray>
+#include <QVector>
+#include <memory>
+
+/// Per-track loudness normalization envelope computed by the loudness
+/// analyzer (see analyzer/analyzerebur128.cpp).
+///
+/// The envelope holds one linear gain factor per second of audio that
+/// nudges the short-term loudness of the track towards its integrated
+/// loudness, so that quiet intros and loud drops of the same track play
+/// back at a consistent level. All curve math (loudness measurement,
+/// clamping, smoothing, dB conversion) happens at analysis time; the
+/// audio callback only interpolates linearly between two adjacent
+/// table entries.
+
+namespace mixxx {
+
+/// Seconds of audio covered by one envelope entry.
+constexpr double kLoudnessEnvelopeIntervalSeconds = 1.0;
+
+/// Limit of the per-segment correction in dB. Without the limit long
+/// silent or near-silent passages would be boosted to full level.
+constexpr double kLoudnessEnvelopeMaxCorrectionDb = 6.0;
+
+/// Width of the centered moving average that smooths the correction
+/// curve, in envelope entries. Matches the 3 s short-term loudness
+/// window so the envelope does not chase single beats.
+constexpr int kLoudnessEnvelopeSmoothingEntries = 5;
+
+/// Version tag stored with each envelope in the database. Bump when the
+/// serialized format changes; envelopes with a stale version are
+/// ignored and regenerated on the next analysis.
+constexpr int kLoudnessEnvelopeVersion = 1;
+
+class LoudnessEnvelope;
+typedef std::shared_ptr<const LoudnessEnvelope> LoudnessEnvelopePointer;
+
+/// Immutable per-track gain table, shared between the analyzer, the
+/// track and the engine via LoudnessEnvelopePointer.
+class LoudnessEnvelope {
+  public:
+    explicit LoudnessEnvelope(QVector<float> gains)
+            : m_gains(std::move(gains)) {
+    }
+
+    /// Linear gain at the given track position, interpolated between
+    /// the two adjacent table entries and clamped to the first/last
+    /// entry outside of the analyzed range. Returns a neutral 1.0 for
+    /// an empty envelope.
+    float gainAtSeconds(double seconds) const;
+
+    int size() const {
+        return m_gains.size();
+    }
+    bool isEmpty() const {
+        return m_gains.isEmpty();
+    }
+
+    /// Serializes the gain table into the blob format stored in the
+    /// track_loudness_envelope table.
+    QByteArray toByteArray() const;
+
+    /// Deserializes an envelope stored by toByteArray(). Returns
+    /// nullptr for empty or malformed data.
+    static LoudnessEnvelopePointer fromByteArray(const QByteArray& data);
+
+  private:
+    QVector<float> m_gains;
+};
+
+} // namespace mixxx
@@ -176,6 +176,10 @@ void Track::replaceMetadataFromSource(
         // enter locking scope
         auto locked = lockMutex(&m_qMutex);
 
+        // Keep a copy of the current record for determining which change
+        // signals need to be emitted after all modifications are done.
+        const mixxx::TrackRecord oldRecord = m_record;
+
         // Preserve current bpm and key temporarily to avoid
         // overwriting with an inconsistent value. The bpm must always be
         // set together with the beat grid and the key text must be parsed
@@ -184,13 +188,9 @@ void Track::replaceMetadataFromSource(
         importedMetadata.refTrackInfo().setKeyText(
                 m_record.getMetadata().getTrackInfo().getKeyText());
 
-        const auto oldReplayGain =
-                m_record.getMetadata().getTrackInfo().getReplayGain();
         bool modified = m_record.replaceMetadataFromSource(
                 std::move(importedMetadata),
                 sourceSynchronizedAt);
-        const auto newReplayGain =
-                m_record.getMetadata().getTrackInfo().getReplayGain();
 
         // Need to set BPM after sample rate since beat grid creation depends on
         // knowing the sample rate #6559.
@@ -233,24 +233,27 @@ void Track::replaceMetadataFromSource(
             // Unmodified, nothing todo
             return;
         }
-        // Explicitly unlock before emitting signals
-        markDirtyAndUnlock(&locked);
 
+        // Collect the change signals while still locked and emit each of
+        // them at most once after unlocking. This avoids flooding the
+        // connected widgets and controls with redundant notifications
+        // for unmodified properties.
+        ChangedSignals changedSignals =
+                compareChangedSignalsWhileLocked(oldRecord);
         if (beatsAndBpmModified) {
-            emitBeatsAndBpmUpdated();
+            // The beat grid may have been replaced even if the resulting
+            // bpm value is unchanged.
+            changedSignals |= ChangedSignal::Bpm;
+            changedSignals |= ChangedSignal::Beats;
         }
         if (keysModified) {
-            emit keyChanged();
-        }
-        if (oldReplayGain != newReplayGain) {
-            emit replayGainUpdated(newReplayGain);
-        }
-        if (colorModified) {
-            DEBUG_ASSERT(newColor);
-            emit colorUpdated(*newColor);
+            changedSignals |= ChangedSignal::Key;
         }
 
-        emitChangedSignalsForAllMetadata();
+        // Explicitly unlock before emitting signals
+        markDirtyAndUnlock(&locked);
+
+        emitChangedSignals(changedSignals);
     }
 
     // TODO: Import Serato metadata within the locking scope and not
@@ -268,13 +271,16 @@ void Track::replaceMetadataFromSource(
 bool Track::mergeExtraMetadataFromSource(
         const mixxx::TrackMetadata& importedMetadata) {
     auto locked = lockMutex(&m_qMutex);
+    const mixxx::TrackRecord oldRecord = m_record;
     if (!m_record.mergeExtraMetadataFromSource(importedMetadata)) {
         // Not modified
         return false;
     }
+    const ChangedSignals changedSignals =
+            compareChangedSignalsWhileLocked(oldRecord);
     markDirtyAndUnlock(&locked);
     // Modified
-    emitChangedSignalsForAllMetadata();
+    emitChangedSignals(changedSignals);
     return true;
 }
 
@@ -300,19 +306,15 @@ mixxx::TrackRecord Track::getRecord(
 bool Track::replaceRecord(
         mixxx::TrackRecord newRecord,
         mixxx::BeatsPointer pOptionalBeats) {
-    const auto newReplayGain = newRecord.getMetadata().getTrackInfo().getReplayGain();
-    const auto newColor = newRecord.getColor();
-    const auto newRating = newRecord.getRating();
-
     auto locked = lockMutex(&m_qMutex);
     const bool recordUnchanged = m_record == newRecord;
     if (recordUnchanged && !pOptionalBeats) {
         return false;
     }
 
-    const auto oldReplayGain = m_record.getMetadata().getTrackInfo().getReplayGain();
-    const auto oldColor = m_record.getColor();
-    const auto oldRating = m_record.getRating();
+    // Keep a copy of the current record for determining which change
+    // signals need to be emitted after it has been replaced.
+    const mixxx::TrackRecord oldRecord = m_record;
 
     bool bpmUpdatedFlag;
     if (pOptionalBeats) {
@@ -333,23 +335,18 @@ bool Track::replaceRecord(
     // Finally replace the current with the new record
     m_record = std::move(newRecord);
 
-    // Unlock before emitting signals
-    markDirtyAndUnlock(&locked);
-
+    // Collect the change signals while still locked and emit each of
+    // them at most once after unlocking.
+    ChangedSignals changedSignals =
+            compareChangedSignalsWhileLocked(oldRecord);
     if (bpmUpdatedFlag) {
-        emit beatsUpdated();
-    }
-    if (oldReplayGain != newReplayGain) {
-        emit replayGainUpdated(newReplayGain);
-    }
-    if (oldColor != newColor) {
-        emit colorUpdated(newColor);
-    }
-    if (oldRating != newRating) {
-        emit ratingUpdated(newRating);
+        changedSignals |= ChangedSignal::Beats;
     }
 
-    emitChangedSignalsForAllMetadata();
+    // Unlock before emitting signals
+    markDirtyAndUnlock(&locked);
+
+    emitChangedSignals(changedSignals);
     return true;
 }
 
@@ -525,23 +522,139 @@ void Track::emitBeatsAndBpmUpdated() {
     emit beatsUpdated();
 }
 
-void Track::emitChangedSignalsForAllMetadata() {
-    emit artistChanged(getArtist());
-    emit titleChanged(getTitle());
-    emit albumChanged(getAlbum());
-    emit albumArtistChanged(getAlbumArtist());
-    emit genreChanged(getGenre());
-    emit composerChanged(getComposer());
-    emit groupingChanged(getGrouping());
-    emit yearChanged(getYear());
-    emit trackNumberChanged(getTrackNumber());
-    emit trackTotalChanged(getTrackTotal());
-    emit commentChanged(getComment());
-    emit bpmChanged();
-    emit timesPlayedChanged();
-    emit durationChanged();
-    emit infoChanged();
-    emit keyChanged();
+Track::ChangedSignals Track::compareChangedSignalsWhileLocked(
+        const mixxx::TrackRecord& oldRecord) const {
+    ChangedSignals changedSignals;
+    const mixxx::TrackInfo& oldTrackInfo =
+            oldRecord.getMetadata().getTrackInfo();
+    const mixxx::TrackInfo& newTrackInfo =
+            m_record.getMetadata().getTrackInfo();
+    const mixxx::AlbumInfo& oldAlbumInfo =
+            oldRecord.getMetadata().getAlbumInfo();
+    const mixxx::AlbumInfo& newAlbumInfo =
+            m_record.getMetadata().getAlbumInfo();
+    if (oldTrackInfo.getArtist() != newTrackInfo.getArtist()) {
+        changedSignals |= ChangedSignal::Artist;
+    }
+    if (oldTrackInfo.getTitle() != newTrackInfo.getTitle()) {
+        changedSignals |= ChangedSignal::Title;
+    }
+    if (oldAlbumInfo.getTitle() != newAlbumInfo.getTitle()) {
+        changedSignals |= ChangedSignal::Album;
+    }
+    if (oldAlbumInfo.getArtist() != newAlbumInfo.getArtist()) {
+        changedSignals |= ChangedSignal::AlbumArtist;
+    }
+    if (oldTrackInfo.getGenre() != newTrackInfo.getGenre()) {
+        changedSignals |= ChangedSignal::Genre;
+    }
+    if (oldTrackInfo.getComposer() != newTrackInfo.getComposer()) {
+        changedSignals |= ChangedSignal::Composer;
+    }
+    if (oldTrackInfo.getGrouping() != newTrackInfo.getGrouping()) {
+        changedSignals |= ChangedSignal::Grouping;
+    }
+    if (oldTrackInfo.getYear() != newTrackInfo.getYear()) {
+        changedSignals |= ChangedSignal::Year;
+    }
+    if (oldTrackInfo.getTrackNumber() != newTrackInfo.getTrackNumber()) {
+        changedSignals |= ChangedSignal::TrackNumber;
+    }
+    if (oldTrackInfo.getTrackTotal() != newTrackInfo.getTrackTotal()) {
+        changedSignals |= ChangedSignal::TrackTotal;
+    }
+    if (oldTrackInfo.getComment() != newTrackInfo.getComment()) {
+        changedSignals |= ChangedSignal::Comment;
+    }
+    if (oldTrackInfo.getBpm() != newTrackInfo.getBpm()) {
+        changedSignals |= ChangedSignal::Bpm;
+    }
+    if (oldTrackInfo.getKeyText() != newTrackInfo.getKeyText()) {
+        changedSignals |= ChangedSignal::Key;
+    }
+    if (oldRecord.getPlayCounter().getTimesPlayed() !=
+            m_record.getPlayCounter().getTimesPlayed()) {
+        changedSignals |= ChangedSignal::TimesPlayed;
+    }
+    if (oldRecord.getMetadata().getStreamInfo().getDuration() !=
+            m_record.getMetadata().getStreamInfo().getDuration()) {
+        changedSignals |= ChangedSignal::Duration;
+    }
+    if (oldTrackInfo.getReplayGain() != newTrackInfo.getReplayGain()) {
+        changedSignals |= ChangedSignal::ReplayGain;
+    }
+    if (oldRecord.getColor() != m_record.getColor()) {
+        changedSignals |= ChangedSignal::Color;
+    }
+    if (oldRecord.getRating() != m_record.getRating()) {
+        changedSignals |= ChangedSignal::Rating;
+    }
+    return changedSignals;
+}
+
+void Track::emitChangedSignals(ChangedSignals changedSignals) {
+    if (changedSignals.testFlag(ChangedSignal::Artist)) {
+        emit artistChanged(getArtist());
+    }
+    if (changedSignals.testFlag(ChangedSignal::Title)) {
+        emit titleChanged(getTitle());
+    }
+    if (changedSignals.testFlag(ChangedSignal::Album)) {
+        emit albumChanged(getAlbum());
+    }
+    if (changedSignals.testFlag(ChangedSignal::AlbumArtist)) {
+        emit albumArtistChanged(getAlbumArtist());
+    }
+    if (changedSignals.testFlag(ChangedSignal::Genre)) {
+        emit genreChanged(getGenre());
+    }
+    if (changedSignals.testFlag(ChangedSignal::Composer)) {
+        emit composerChanged(getComposer());
+    }
+    if (changedSignals.testFlag(ChangedSignal::Grouping)) {
+        emit groupingChanged(getGrouping());
+    }
+    if (changedSignals.testFlag(ChangedSignal::Year)) {
+        emit yearChanged(getYear());
+    }
+    if (changedSignals.testFlag(ChangedSignal::TrackNumber)) {
+        emit trackNumberChanged(getTrackNumber());
+    }
+    if (changedSignals.testFlag(ChangedSignal::TrackTotal)) {
+        emit trackTotalChanged(getTrackTotal());
+    }
+    if (changedSignals.testFlag(ChangedSignal::Comment)) {
+        emit commentChanged(getComment());
+    }
+    if (changedSignals.testFlag(ChangedSignal::Bpm)) {
+        emit bpmChanged();
+    }
+    if (changedSignals.testFlag(ChangedSignal::Beats)) {
+        emit beatsUpdated();
+    }
+    if (changedSignals.testFlag(ChangedSignal::Key)) {
+        emit keyChanged();
+    }
+    if (changedSignals.testFlag(ChangedSignal::TimesPlayed)) {
+        emit timesPlayedChanged();
+    }
+    if (changedSignals.testFlag(ChangedSignal::Duration)) {
+        emit durationChanged();
+    }
+    if (changedSignals.testFlag(ChangedSignal::ReplayGain)) {
+        emit replayGainUpdated(getReplayGain());
+    }
+    if (changedSignals.testFlag(ChangedSignal::Color)) {
+        emit colorUpdated(getColor());
+    }
+    if (changedSignals.testFlag(ChangedSignal::Rating)) {
+        emit ratingUpdated(getRating());
+    }
+    // getInfo() is composed of artist and title.
+    if (changedSignals.testFlag(ChangedSignal::Artist) ||
+            changedSignals.testFlag(ChangedSignal::Title)) {
+        emit infoChanged();
+    }
 }
 
 bool Track::checkSourceSynchronized() const {
@@ -940,6 +1053,15 @@ void Track::setWaveformSummary(ConstWaveformPointer pWaveform) {
     emit waveformSummaryUpdated();
 }
 
+mixxx::LoudnessEnvelopePointer Track::getLoudnessEnvelope() const {
+    return m_pLoudnessEnvelope;
+}
+
+void Track::setLoudnessEnvelope(mixxx::LoudnessEnvelopePointer pLoudnessEnvelope) {
+    m_pLoudnessEnvelope = pLoudnessEnvelope;
+    emit loudnessEnvelopeUpdated();
+}
+
 void Track::setMainCuePosition(mixxx::audio::FramePos position) {
     auto locked = lockMutex(&m_qMutex);
 
@@ -993,6 +1115,23 @@ void Track::shiftCuePositionsMillis(double milliseconds) {
     markDirtyAndUnlock(&locked);
 }
 
+void Track::shiftCuePositionsFrames(mixxx::audio::FrameDiff_t frames) {
+    auto locked = lockMutex(&m_qMutex);
+
+    for (const CuePointer& pCue : std::as_const(m_cuePoints)) {
+        pCue->shiftPositionFrames(frames);
+    }
+    // The main cue position is stored in the track record in addition
+    // to the MainCue cue shifted above and must be kept in sync.
+    const auto mainCuePosition = m_record.getMainCuePosition();
+    if (mainCuePosition.isValid()) {
+        compareAndSet(m_record.ptrMainCuePosition(), mainCuePosition + frames);
+    }
+
+    markDirtyAndUnlock(&locked);
+    emit cuesUpdated();
+}
+
 void Track::setHotcueIndicesSortedByPosition(HotcueSortMode sortMode) {
     auto locked = lockMutex(&m_qMutex);
 
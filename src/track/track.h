@@ -11,6 +11,7 @@
 #include "track/beats.h"
 #include "track/cue.h"
 #include "track/cueinfoimporter.h"
+#include "track/loudnessenvelope.h"
 #ifdef __STEM__
 #include "track/steminfo.h"
 #include "track/steminfoimporter.h"
@@ -299,12 +300,18 @@ class Track : public QObject {
     ConstWaveformPointer getWaveformSummary() const;
     void setWaveformSummary(ConstWaveformPointer pWaveform);
 
+    mixxx::LoudnessEnvelopePointer getLoudnessEnvelope() const;
+    void setLoudnessEnvelope(mixxx::LoudnessEnvelopePointer pLoudnessEnvelope);
+
     /// Get the track's main cue point
     mixxx::audio::FramePos getMainCuePosition() const;
     // Set the track's main cue point
     void setMainCuePosition(mixxx::audio::FramePos position);
     /// Shift all cues by a constant offset
     void shiftCuePositionsMillis(mixxx::audio::FrameDiff_t milliseconds);
+    /// Shift all cues by a constant offset given in frames, including the
+    /// main cue position mirrored in the track record
+    void shiftCuePositionsFrames(mixxx::audio::FrameDiff_t frames);
     /// Set hoctues' indices sorted by their frame position.
     /// If compress is true, indices are consecutive and start at 0.
     /// Set false to sort only, ie. keep empty hotcues before and in between.
@@ -486,6 +493,7 @@ class Track : public QObject {
 
     void waveformUpdated();
     void waveformSummaryUpdated();
+    void loudnessEnvelopeUpdated();
     void coverArtUpdated();
     void beatsUpdated();
     void replayGainUpdated(mixxx::ReplayGain replayGain);
@@ -531,8 +539,43 @@ class Track : public QObject {
     void afterBeatsAndBpmUpdated(QT_RECURSIVE_MUTEX_LOCKER* pLock);
     void emitBeatsAndBpmUpdated();
 
-    /// Emits a changed signal for each Q_PROPERTY
-    void emitChangedSignalsForAllMetadata();
+    /// Bit flags identifying the change signals that a bulk update
+    /// of m_record needs to emit. Collected while the track is locked
+    /// and flushed by emitChangedSignals() after unlocking, so that
+    /// each signal is emitted at most once per update instead of
+    /// emitting a changed signal for each Q_PROPERTY unconditionally.
+    enum class ChangedSignal {
+        Artist = 1 << 0,
+        Title = 1 << 1,
+        Album = 1 << 2,
+        AlbumArtist = 1 << 3,
+        Genre = 1 << 4,
+        Composer = 1 << 5,
+        Grouping = 1 << 6,
+        Year = 1 << 7,
+        TrackNumber = 1 << 8,
+        TrackTotal = 1 << 9,
+        Comment = 1 << 10,
+        Bpm = 1 << 11,
+        Beats = 1 << 12,
+        Key = 1 << 13,
+        TimesPlayed = 1 << 14,
+        Duration = 1 << 15,
+        ReplayGain = 1 << 16,
+        Color = 1 << 17,
+        Rating = 1 << 18,
+    };
+    Q_DECLARE_FLAGS(ChangedSignals, ChangedSignal)
+
+    /// Compares the current m_record against a copy taken before a bulk
+    /// update and collects the change signals that need to be emitted.
+    /// Only supposed to be called while the caller guards this with a lock.
+    ChangedSignals compareChangedSignalsWhileLocked(
+            const mixxx::TrackRecord& oldRecord) const;
+
+    /// Emits each collected changed signal at most once.
+    /// Must only be called while the track is NOT locked.
+    void emitChangedSignals(ChangedSignals changedSignals);
 
     /// Sets beats and returns a boolean to indicate if BPM/Beats were updated.
     /// Only supposed to be called while the caller guards this a lock.
@@ -632,6 +675,9 @@ class Track : public QObject {
     ConstWaveformPointer m_waveform;
     ConstWaveformPointer m_waveformSummary;
 
+    // Loudness normalization envelope from the loudness analyzer
+    mixxx::LoudnessEnvelopePointer m_pLoudnessEnvelope;
+
     mixxx::BeatsImporterPointer m_pBeatsImporterPending;
     std::unique_ptr<mixxx::CueInfoImporter> m_pCueInfoImporterPending;
 
@@ -0,0 +1,138 @@
+#include "util/allocationguard.h"
+
+#ifdef MIXXX_ALLOC_AUDIT
+
+#include <QtDebug>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include "util/counter.h"
+
+#if defined(__GLIBC__) || defined(__APPLE__)
+#define MIXXX_ALLOC_AUDIT_BACKTRACE
+#include <execinfo.h>
+#endif
+
+namespace {
+
+// Number of nested ScopedAllocAudit scopes on this thread. The audit is
+// active while the depth is positive.
+thread_local int t_auditDepth = 0;
+
+// Suppresses recursive reports while a violation is being reported,
+// because the reporting itself allocates.
+thread_local bool t_reporting = false;
+
+std::atomic<int> s_violationCount(0);
+
+constexpr int kMaxStackFrames = 32;
+
+void reportViolation(std::size_t size) {
+    s_violationCount.fetch_add(1, std::memory_order_relaxed);
+    t_reporting = true;
+    // The counter shows up in the StatsManager report (--developer mode)
+    // and allows correlating allocation spikes with xruns.
+    Counter("ScopedAllocAudit violations").increment();
+    qWarning() << "Heap allocation of"
+               << size
+               << "bytes from a thread marked as real-time";
+#ifdef MIXXX_ALLOC_AUDIT_BACKTRACE
+    void* frames[kMaxStackFrames];
+    const int numFrames = backtrace(frames, kMaxStackFrames);
+    char** symbols = backtrace_symbols(frames, numFrames);
+    if (symbols) {
+        for (int i = 0; i < numFrames; ++i) {
+            qWarning() << "   " << symbols[i];
+        }
+        std::free(symbols);
+    }
+#endif
+    t_reporting = false;
+}
+
+void* auditedAlloc(std::size_t size) {
+    if (t_auditDepth > 0 && !t_reporting) {
+        reportViolation(size);
+    }
+    return std::malloc(size);
+}
+
+} // anonymous namespace
+
+// Global allocation operators. Overriding operator new/delete covers all
+// C++ allocations in Mixxx and its statically linked dependencies. Raw
+// malloc() calls from C libraries are not intercepted, they would require
+// platform-specific symbol interposition.
+
+void* operator new(std::size_t size) {
+    void* ptr = auditedAlloc(size);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new[](std::size_t size) {
+    void* ptr = auditedAlloc(size);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return auditedAlloc(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return auditedAlloc(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept {
+    std::free(ptr);
+}
+
+namespace mixxx {
+
+ScopedAllocAudit::ScopedAllocAudit() {
+    ++t_auditDepth;
+}
+
+ScopedAllocAudit::~ScopedAllocAudit() {
+    --t_auditDepth;
+}
+
+// static
+int ScopedAllocAudit::violationCount() {
+    return s_violationCount.load(std::memory_order_relaxed);
+}
+
+// static
+void ScopedAllocAudit::resetViolationCount() {
+    s_violationCount.store(0, std::memory_order_relaxed);
+}
+
+} // namespace mixxx
+
+#endif // MIXXX_ALLOC_AUDIT
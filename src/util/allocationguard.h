@@ -0,0 +1,50 @@
+#pragma once
+
+namespace mixxx {
+
+/// Scope guard that marks the current thread as real-time for the duration
+/// of the scope. While at least one guard is active on a thread, every heap
+/// allocation performed by that thread is reported as a violation with a
+/// captured call stack and counted in StatsManager. This turns sporadic
+/// xruns caused by hidden allocations in the engine callback into
+/// actionable reports.
+///
+/// Only functional in builds configured with -DALLOC_AUDIT=ON. In all other
+/// builds the guard is an empty object and the global allocation operators
+/// remain untouched, i.e. instantiating it in the real-time path is free.
+class ScopedAllocAudit {
+  public:
+#ifdef MIXXX_ALLOC_AUDIT
+    ScopedAllocAudit();
+    ~ScopedAllocAudit();
+
+    /// Total number of reported violations in this process since startup
+    /// or since the last call to resetViolationCount(). Only for testing.
+    static int violationCount();
+    static void resetViolationCount();
+
+    static constexpr bool isEnabled() {
+        return true;
+    }
+#else
+    ScopedAllocAudit() {
+    }
+    ~ScopedAllocAudit() {
+    }
+
+    static int violationCount() {
+        return 0;
+    }
+    static void resetViolationCount() {
+    }
+
+    static constexpr bool isEnabled() {
+        return false;
+    }
+#endif
+
+    ScopedAllocAudit(const ScopedAllocAudit&) = delete;
+    ScopedAllocAudit& operator=(const ScopedAllocAudit&) = delete;
+};
+
+} // namespace mixxx
@@ -0,0 +1,124 @@
+#include "util/backgroundio.h"
+
+#include <QThread>
+#include <QtGlobal>
+#include <atomic>
+
+#ifdef Q_OS_LINUX
+#include <fcntl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+
+#include <QFile>
+#endif
+
+#ifdef Q_OS_MACOS
+#include <sys/resource.h>
+#endif
+
+#ifdef Q_OS_WIN
+#include <windows.h>
+#endif
+
+#include "util/logger.h"
+
+namespace {
+
+mixxx::Logger kLogger("BackgroundIo");
+
+std::atomic<bool> s_parkWhilePlaying(false);
+std::atomic<bool> s_anyDeckAudible(false);
+
+// PlayerInfo re-evaluates the audible deck every 2 s, polling faster
+// than that while parked would be pointless.
+constexpr unsigned long kParkPollIntervalMillis = 250;
+
+#ifdef Q_OS_LINUX
+// From linux/ioprio.h which is not part of the glibc headers.
+constexpr int kIoprioWhoProcess = 1;
+constexpr int kIoprioClassIdle = 3;
+constexpr int kIoprioClassShift = 13;
+#endif
+
+bool isParked() {
+    return s_parkWhilePlaying.load(std::memory_order_relaxed) &&
+            s_anyDeckAudible.load(std::memory_order_relaxed);
+}
+
+} // anonymous namespace
+
+namespace mixxx {
+
+namespace BackgroundIo {
+
+void lowerCurrentThreadDiskPriority() {
+    thread_local bool loweredForThisThread = false;
+    if (loweredForThisThread) {
+        return;
+    }
+    loweredForThisThread = true;
+#if defined(Q_OS_LINUX)
+    // ioprio_set(2) has no glibc wrapper. Thread id 0 addresses the
+    // calling thread. The idle class only receives disk time when no
+    // other process needs it, which is exactly the behavior of
+    // ionice -c idle.
+    if (syscall(SYS_ioprio_set,
+                kIoprioWhoProcess,
+                0,
+                kIoprioClassIdle << kIoprioClassShift) != 0) {
+        kLogger.debug() << "ioprio_set failed:" << errno;
+    }
+#elif defined(Q_OS_MACOS)
+    if (setiopolicy_np(IOPOL_TYPE_DISK, IOPOL_SCOPE_THREAD, IOPOL_THROTTLE) != 0) {
+        kLogger.debug() << "setiopolicy_np failed:" << errno;
+    }
+#elif defined(Q_OS_WIN)
+    // Background mode lowers the I/O and memory priority of the thread
+    // in addition to its CPU priority.
+    SetThreadPriority(GetCurrentThread(), THREAD_MODE_BACKGROUND_BEGIN);
+#endif
+}
+
+void dropFileFromPageCache(const QString& filePath) {
+#ifdef Q_OS_LINUX
+    const int fd = open(QFile::encodeName(filePath).constData(),
+            O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return;
+    }
+    // Only drops clean pages, so this cannot lose data. If the decoder
+    // happens to have the same file open, the pages are simply re-read.
+    posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    close(fd);
+#else
+    // macOS F_NOCACHE only affects reads issued through the file
+    // descriptor it is set on, which is hidden inside Qt and TagLib
+    // here, and Windows has no cache hint short of reopening with
+    // FILE_FLAG_NO_BUFFERING. Dropping pages is only an optimization,
+    // so both remain no-ops.
+    Q_UNUSED(filePath);
+#endif
+}
+
+void setParkWhilePlaying(bool park) {
+    s_parkWhilePlaying.store(park, std::memory_order_relaxed);
+}
+
+void setAnyDeckAudible(bool audible) {
+    s_anyDeckAudible.store(audible, std::memory_order_relaxed);
+}
+
+void throttle(const std::function<bool()>& shouldAbort) {
+    while (isParked()) {
+        if (shouldAbort && shouldAbort()) {
+            return;
+        }
+        QThread::msleep(kParkPollIntervalMillis);
+    }
+}
+
+} // namespace BackgroundIo
+
+} // namespace mixxx
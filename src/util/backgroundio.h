@@ -0,0 +1,45 @@
+#pragma once
+
+#include <QString>
+#include <functional>
+
+/// Shared I/O policy for background file access.
+///
+/// The library scanner and batch analysis read files and directory
+/// listings with default I/O priority and therefore compete with the
+/// audio decoder for the disk, which has caused dropouts on single-disk
+/// machines. These helpers let background threads lower their disk
+/// priority below the decoder's, drop files they have finished reading
+/// from the page cache, and optionally park entirely while a deck is
+/// audible. On platforms without the respective kernel interface the
+/// helpers degrade to no-ops.
+
+namespace mixxx {
+
+namespace BackgroundIo {
+
+/// Lower the disk I/O priority of the calling thread so that its reads
+/// are served after the audio decoder's. May be called repeatedly, only
+/// the first call per thread issues the system call.
+void lowerCurrentThreadDiskPriority();
+
+/// Advise the kernel to drop the cached pages of a file that background
+/// work has finished reading, so that bulk scans do not evict the
+/// decoder's working set from the page cache.
+void dropFileFromPageCache(const QString& filePath);
+
+/// Enable or disable parking of background I/O while a deck is audible.
+void setParkWhilePlaying(bool park);
+
+/// Updated from the main thread via PlayerInfo::currentPlayingDeckChanged.
+void setAnyDeckAudible(bool audible);
+
+/// Block the calling thread while background I/O is parked, i.e. while
+/// parking is enabled and a deck is audible. Returns immediately
+/// otherwise. The optional predicate aborts the wait, e.g. when the
+/// pending scan has been cancelled.
+void throttle(const std::function<bool()>& shouldAbort = {});
+
+} // namespace BackgroundIo
+
+} // namespace mixxx
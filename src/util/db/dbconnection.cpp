@@ -1,5 +1,6 @@
 #include <QSqlDriver>
 #include <QSqlError>
+#include <QSqlQuery>
 
 #ifdef __SQLITE3__
 #include <sqlite3.h>
@@ -311,6 +312,33 @@ bool initDatabase(const QSqlDatabase& database, mixxx::StringCollator* pCollator
     return true;
 }
 
+// Enable write-ahead logging for SQLite connections. In WAL mode writers
+// only append to the log file and do not block concurrent readers, which
+// keeps the UI responsive while the library scanner commits batches of
+// new tracks. synchronous=NORMAL is safe in WAL mode (the database cannot
+// be corrupted by a power loss, at most the last transactions are lost)
+// and avoids an fsync after every commit.
+void enableWriteAheadLogging(const QSqlDatabase& database) {
+    if (!database.driverName().startsWith(QStringLiteral("QSQLITE"))) {
+        return;
+    }
+    QSqlQuery query(database);
+    if (!query.exec(QStringLiteral("PRAGMA journal_mode=WAL")) ||
+            !query.next() ||
+            query.value(0).toString().compare(
+                    QStringLiteral("wal"), Qt::CaseInsensitive) != 0) {
+        kLogger.warning()
+                << "Failed to enable write-ahead logging:"
+                << query.lastError();
+        return;
+    }
+    if (!query.exec(QStringLiteral("PRAGMA synchronous=NORMAL"))) {
+        kLogger.warning()
+                << "Failed to relax synchronous mode:"
+                << query.lastError();
+    }
+}
+
 } // anonymous namespace
 
 DbConnection::DbConnection(
@@ -350,6 +378,10 @@ bool DbConnection::open() {
         m_sqlDatabase.close();
         return false; // abort
     }
+    // Not being able to switch the journal mode is unfortunate, but
+    // no reason to abort since all journal modes are functionally
+    // equivalent.
+    enableWriteAheadLogging(m_sqlDatabase);
     return true;
 }
 
@@ -1,37 +1,78 @@
 #pragma once
 
-#include "pa_ringbuffer.h"
+#include <atomic>
+#include <cstdint>
+#include <vector>
 
 #include "util/class.h"
 #include "util/math.h"
 
+/// Size type of the FIFO regions. The name is kept from the PortAudio ring
+/// buffer that this FIFO used to wrap, since the call sites declare their
+/// region sizes with it.
+typedef int32_t ring_buffer_size_t;
+
+/// Lock-free single-producer single-consumer FIFO.
+///
+/// The read and write indices are free running and masked into the
+/// power-of-2 sized buffer, so the full capacity is usable. Each index is
+/// aligned to its own cache line to prevent false sharing between the
+/// producer and the consumer core, which the previously used PortAudio
+/// ring buffer (with both indices in one struct) was prone to.
+///
+/// The aquire/release region API allows batched zero-copy access: the
+/// producer writes directly into the buffer and publishes the elements
+/// with a single release store, and likewise for the consumer. The current
+/// occupancy can be observed from either side via readAvailable() and
+/// writeAvailable().
 template <class DataType>
 class FIFO {
   public:
     explicit FIFO(int size)
-            : m_data(roundUpToPowerOf2(size)) {
-        // If we can't represent the next higher power of 2 then bail.
-        if (m_data.size() == 0) {
-            return;
-        }
-        PaUtil_InitializeRingBuffer(&m_ringBuffer,
-                static_cast<ring_buffer_size_t>(sizeof(DataType)),
-                static_cast<ring_buffer_size_t>(m_data.size()),
-                m_data.data());
+            : m_data(roundUpToPowerOf2(size)),
+              m_mask(static_cast<uint32_t>(m_data.size()) - 1),
+              m_readIndex(0),
+              m_writeIndex(0) {
     }
     virtual ~FIFO() {
     }
     int readAvailable() const {
-        return PaUtil_GetRingBufferReadAvailable(&m_ringBuffer);
+        return static_cast<int>(
+                m_writeIndex.load(std::memory_order_acquire) -
+                m_readIndex.load(std::memory_order_acquire));
     }
     int writeAvailable() const {
-        return PaUtil_GetRingBufferWriteAvailable(&m_ringBuffer);
+        return static_cast<int>(m_data.size()) - readAvailable();
     }
     int read(DataType* pData, int count) {
-        return PaUtil_ReadRingBuffer(&m_ringBuffer, pData, count);
+        DataType* dataPtr1;
+        DataType* dataPtr2;
+        ring_buffer_size_t size1;
+        ring_buffer_size_t size2;
+        count = aquireReadRegions(count, &dataPtr1, &size1, &dataPtr2, &size2);
+        for (ring_buffer_size_t i = 0; i < size1; ++i) {
+            pData[i] = dataPtr1[i];
+        }
+        for (ring_buffer_size_t i = 0; i < size2; ++i) {
+            pData[size1 + i] = dataPtr2[i];
+        }
+        releaseReadRegions(count);
+        return count;
     }
     int write(const DataType* pData, int count) {
-        return PaUtil_WriteRingBuffer(&m_ringBuffer, pData, count);
+        DataType* dataPtr1;
+        DataType* dataPtr2;
+        ring_buffer_size_t size1;
+        ring_buffer_size_t size2;
+        count = aquireWriteRegions(count, &dataPtr1, &size1, &dataPtr2, &size2);
+        for (ring_buffer_size_t i = 0; i < size1; ++i) {
+            dataPtr1[i] = pData[i];
+        }
+        for (ring_buffer_size_t i = 0; i < size2; ++i) {
+            dataPtr2[i] = pData[size1 + i];
+        }
+        releaseWriteRegions(count);
+        return count;
     }
     void writeBlocking(const DataType* pData, int count) {
         int written = 0;
@@ -42,28 +83,88 @@ class FIFO {
     int aquireWriteRegions(int count,
             DataType** dataPtr1, ring_buffer_size_t* sizePtr1,
             DataType** dataPtr2, ring_buffer_size_t* sizePtr2) {
-        return PaUtil_GetRingBufferWriteRegions(&m_ringBuffer, count,
-                (void**)dataPtr1, sizePtr1, (void**)dataPtr2, sizePtr2);
+        const uint32_t readIndex = m_readIndex.load(std::memory_order_acquire);
+        const uint32_t writeIndex = m_writeIndex.load(std::memory_order_relaxed);
+        const int available = static_cast<int>(m_data.size()) -
+                static_cast<int>(writeIndex - readIndex);
+        if (count > available) {
+            count = available;
+        }
+        const uint32_t offset = writeIndex & m_mask;
+        if (offset + count > m_data.size()) {
+            // The region wraps around the end of the buffer.
+            const auto firstHalf =
+                    static_cast<ring_buffer_size_t>(m_data.size() - offset);
+            *dataPtr1 = m_data.data() + offset;
+            *sizePtr1 = firstHalf;
+            *dataPtr2 = m_data.data();
+            *sizePtr2 = count - firstHalf;
+        } else {
+            *dataPtr1 = m_data.data() + offset;
+            *sizePtr1 = count;
+            *dataPtr2 = nullptr;
+            *sizePtr2 = 0;
+        }
+        return count;
     }
     int releaseWriteRegions(int count) {
-        return PaUtil_AdvanceRingBufferWriteIndex(&m_ringBuffer, count);
+        // Publish the elements written into the acquired regions.
+        m_writeIndex.store(
+                m_writeIndex.load(std::memory_order_relaxed) + count,
+                std::memory_order_release);
+        return count;
     }
     int aquireReadRegions(int count,
             DataType** dataPtr1, ring_buffer_size_t* sizePtr1,
             DataType** dataPtr2, ring_buffer_size_t* sizePtr2) {
-        return PaUtil_GetRingBufferReadRegions(&m_ringBuffer, count,
-                (void**)dataPtr1, sizePtr1, (void**)dataPtr2, sizePtr2);
+        const uint32_t writeIndex = m_writeIndex.load(std::memory_order_acquire);
+        const uint32_t readIndex = m_readIndex.load(std::memory_order_relaxed);
+        const int available = static_cast<int>(writeIndex - readIndex);
+        if (count > available) {
+            count = available;
+        }
+        const uint32_t offset = readIndex & m_mask;
+        if (offset + count > m_data.size()) {
+            // The region wraps around the end of the buffer.
+            const auto firstHalf =
+                    static_cast<ring_buffer_size_t>(m_data.size() - offset);
+            *dataPtr1 = m_data.data() + offset;
+            *sizePtr1 = firstHalf;
+            *dataPtr2 = m_data.data();
+            *sizePtr2 = count - firstHalf;
+        } else {
+            *dataPtr1 = m_data.data() + offset;
+            *sizePtr1 = count;
+            *dataPtr2 = nullptr;
+            *sizePtr2 = 0;
+        }
+        return count;
     }
     int releaseReadRegions(int count) {
-        return PaUtil_AdvanceRingBufferReadIndex(&m_ringBuffer, count);
+        // Free the space of the elements consumed from the acquired regions.
+        m_readIndex.store(
+                m_readIndex.load(std::memory_order_relaxed) + count,
+                std::memory_order_release);
+        return count;
     }
     int flushReadData(int count) {
-        int flush = math_min(readAvailable(), count);
-        return PaUtil_AdvanceRingBufferReadIndex(&m_ringBuffer, flush);
+        const int flush = math_min(readAvailable(), count);
+        return releaseReadRegions(flush);
     }
 
   private:
+    // Cache line size of all currently relevant architectures.
+    // std::hardware_destructive_interference_size is deliberately not used
+    // here, since its value may differ between translation units depending
+    // on the compiler's tuning flags.
+    static constexpr std::size_t kCacheLineSize = 64;
+
     std::vector<DataType> m_data;
-    PaUtilRingBuffer m_ringBuffer;
+    const uint32_t m_mask;
+    // The free running indices are only masked when accessing the buffer.
+    // Keeping them on separate cache lines prevents false sharing, since
+    // the producer only writes m_writeIndex and the consumer m_readIndex.
+    alignas(kCacheLineSize) std::atomic<uint32_t> m_readIndex;
+    alignas(kCacheLineSize) std::atomic<uint32_t> m_writeIndex;
     DISALLOW_COPY_AND_ASSIGN(FIFO);
 };
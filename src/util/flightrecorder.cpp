@@ -0,0 +1,189 @@
+#include "util/flightrecorder.h"
+
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QTextStream>
+#include <QtDebug>
+#include <algorithm>
+
+#include "moc_flightrecorder.cpp"
+#include "util/cmdlineargs.h"
+#include "util/compatibility/qmutex.h"
+
+namespace {
+
+// Repeated underflows within this period are coalesced into the first dump,
+// which already contains the history leading up to them.
+constexpr qint64 kDumpCooldownNanos = 30'000'000'000; // 30 s
+
+// Upper bound for the timed wait in run(). The timed wait makes sure that a
+// wakeup racing with the flag check is only delayed, never lost.
+constexpr unsigned long kDumpPollMillis = 1000;
+
+const char* eventTypeToString(FlightRecorderEventType type) {
+    switch (type) {
+    case FlightRecorderEventType::Enter:
+        return "enter";
+    case FlightRecorderEventType::Exit:
+        return "exit";
+    case FlightRecorderEventType::Marker:
+        return "marker";
+    }
+    return "unknown";
+}
+
+} // anonymous namespace
+
+// static
+std::atomic<FlightRecorder*> FlightRecorder::s_pInstance = nullptr;
+
+FlightRecorderRing::FlightRecorderRing(FlightRecorder* pRecorder)
+        : m_pRecorder(pRecorder),
+          m_threadName(QThread::currentThread()->objectName()),
+          m_entries(kRingSize, FlightRecorderEntry{0, nullptr, FlightRecorderEventType::Marker}),
+          m_writeIndex(0) {
+    if (m_threadName.isEmpty()) {
+        m_threadName = QStringLiteral("thread 0x") +
+                QString::number(reinterpret_cast<quintptr>(
+                                        QThread::currentThreadId()),
+                        16);
+    }
+}
+
+FlightRecorderRing::~FlightRecorderRing() {
+    if (m_pRecorder) {
+        m_pRecorder->onRingDestroyed(this);
+    }
+}
+
+std::vector<FlightRecorderEntry> FlightRecorderRing::snapshot() const {
+    const quint64 writeIndex = m_writeIndex.load(std::memory_order_acquire);
+    const quint64 count = qMin(writeIndex, static_cast<quint64>(kRingSize));
+    std::vector<FlightRecorderEntry> entries;
+    entries.reserve(count);
+    for (quint64 i = writeIndex - count; i < writeIndex; ++i) {
+        const FlightRecorderEntry& entry = m_entries[i % kRingSize];
+        // Entries the owning thread is overwriting right now may be torn;
+        // a null tag is the only state we cannot print at all.
+        if (entry.tag) {
+            entries.push_back(entry);
+        }
+    }
+    return entries;
+}
+
+FlightRecorder::FlightRecorder()
+        : QThread(),
+          m_dumpRequested(false),
+          m_lastDumpNanos(-kDumpCooldownNanos),
+          m_quit(0) {
+    setObjectName("FlightRecorder");
+    moveToThread(this);
+    start(QThread::LowPriority);
+    s_pInstance.store(this, std::memory_order_release);
+}
+
+FlightRecorder::~FlightRecorder() {
+    s_pInstance.store(nullptr, std::memory_order_release);
+    m_quit = 1;
+    m_dumpCondition.wakeAll();
+    wait();
+}
+
+FlightRecorderRing* FlightRecorder::getRingForThread() {
+    if (m_threadRings.hasLocalData()) {
+        return m_threadRings.localData();
+    }
+    FlightRecorderRing* pResult = new FlightRecorderRing(this);
+    m_threadRings.setLocalData(pResult);
+    const auto locker = lockMutex(&m_ringsLock);
+    m_rings.push_back(pResult);
+    return pResult;
+}
+
+void FlightRecorder::onRingDestroyed(FlightRecorderRing* pRing) {
+    const auto locker = lockMutex(&m_ringsLock);
+    m_rings.removeAll(pRing);
+}
+
+void FlightRecorder::run() {
+    qDebug() << "FlightRecorder thread starting up.";
+    while (true) {
+        m_ringsLock.lock();
+        m_dumpCondition.wait(&m_ringsLock, kDumpPollMillis);
+        m_ringsLock.unlock();
+
+        if (m_dumpRequested.exchange(false, std::memory_order_acq_rel)) {
+            const qint64 nowNanos = mixxx::Time::elapsed().toIntegerNanos();
+            if (nowNanos - m_lastDumpNanos >= kDumpCooldownNanos) {
+                m_lastDumpNanos = nowNanos;
+                writeDump();
+            }
+        }
+
+        if (m_quit.loadAcquire() == 1) {
+            qDebug() << "FlightRecorder thread shutting down.";
+            break;
+        }
+    }
+}
+
+void FlightRecorder::writeDump() {
+    struct DumpEntry {
+        FlightRecorderEntry entry;
+        QString threadName;
+    };
+
+    // Snapshot all rings first; the file is written after releasing the
+    // lock so that ring registration is never blocked on disk I/O. The
+    // thread name is copied because a ring may be destroyed by its exiting
+    // thread as soon as the lock is released.
+    std::vector<DumpEntry> dumpEntries;
+    {
+        const auto locker = lockMutex(&m_ringsLock);
+        for (const FlightRecorderRing* pRing : std::as_const(m_rings)) {
+            const std::vector<FlightRecorderEntry> entries = pRing->snapshot();
+            dumpEntries.reserve(dumpEntries.size() + entries.size());
+            for (const FlightRecorderEntry& entry : entries) {
+                dumpEntries.push_back(DumpEntry{entry, pRing->getThreadName()});
+            }
+        }
+    }
+    if (dumpEntries.empty()) {
+        qWarning() << "FlightRecorder: no events recorded, not writing a dump";
+        return;
+    }
+
+    std::sort(dumpEntries.begin(),
+            dumpEntries.end(),
+            [](const DumpEntry& a, const DumpEntry& b) {
+                return a.entry.timeNanos < b.entry.timeNanos;
+            });
+
+    const QString filename = QDir(CmdlineArgs::Instance().getSettingsPath())
+                                     .filePath(QStringLiteral("flightrecord_%1.csv")
+                                                     .arg(QDateTime::currentDateTime().toString(
+                                                             "yyyy-MM-dd_hh'h'mm'm'ss's'")));
+    QFile file(filename);
+    if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        qWarning() << "FlightRecorder: could not open dump file for writing:"
+                   << filename;
+        return;
+    }
+
+    QTextStream out(&file);
+    out << "time_ns,delta_ns,thread,type,tag\n";
+    qint64 lastTimeNanos = dumpEntries.front().entry.timeNanos;
+    for (const DumpEntry& dumpEntry : dumpEntries) {
+        out << dumpEntry.entry.timeNanos << ","
+            << dumpEntry.entry.timeNanos - lastTimeNanos << ","
+            << dumpEntry.threadName << ","
+            << eventTypeToString(dumpEntry.entry.type) << ","
+            << dumpEntry.entry.tag << "\n";
+        lastTimeNanos = dumpEntry.entry.timeNanos;
+    }
+    file.close();
+    qWarning() << "FlightRecorder: wrote" << dumpEntries.size()
+               << "events to" << filename;
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <QAtomicInt>
+#include <QList>
+#include <QMutex>
+#include <QString>
+#include <QThread>
+#include <QThreadStorage>
+#include <QWaitCondition>
+#include <atomic>
+#include <vector>
+
+#include "util/singleton.h"
+#include "util/time.h"
+
+class FlightRecorder;
+
+enum class FlightRecorderEventType : int {
+    Enter,
+    Exit,
+    Marker,
+};
+
+// One recorded event. Only the tag pointer is stored so that recording
+// stays allocation-free; tags must be string literals (or otherwise
+// outlive the recorder).
+struct FlightRecorderEntry {
+    qint64 timeNanos;
+    const char* tag;
+    FlightRecorderEventType type;
+};
+
+// Fixed-size ring of the most recent events of one thread. Written
+// lock-free by its owning thread; the recorder thread reads it racily
+// when dumping, which may yield a few torn entries around the current
+// write position. That is acceptable for forensics and keeps the hot
+// path free of synchronization.
+class FlightRecorderRing final {
+  public:
+    // A few seconds of engine history at a handful of events per callback.
+    static constexpr int kRingSize = 1 << 13;
+
+    explicit FlightRecorderRing(FlightRecorder* pRecorder);
+    ~FlightRecorderRing();
+
+    void append(const char* tag, FlightRecorderEventType type) {
+        const quint64 index = m_writeIndex.load(std::memory_order_relaxed);
+        FlightRecorderEntry& entry = m_entries[index % kRingSize];
+        entry.timeNanos = mixxx::Time::elapsed().toIntegerNanos();
+        entry.tag = tag;
+        entry.type = type;
+        m_writeIndex.store(index + 1, std::memory_order_release);
+    }
+
+    const QString& getThreadName() const {
+        return m_threadName;
+    }
+
+    // Copy the recorded events in chronological order. Called by the
+    // recorder thread while the owning thread may still be writing; see
+    // the class comment about torn entries.
+    std::vector<FlightRecorderEntry> snapshot() const;
+
+  private:
+    FlightRecorder* m_pRecorder;
+    QString m_threadName;
+    std::vector<FlightRecorderEntry> m_entries;
+    std::atomic<quint64> m_writeIndex;
+};
+
+// Always-on flight recorder for the audio hot path. Unlike Trace and Stat,
+// which aggregate, this keeps the raw sequence of recent events in
+// per-thread rings so that the engine activity immediately preceding an
+// xrun can be reconstructed. When SoundManager::underflowHappened() fires,
+// the rings are merged and written to a timestamped CSV file in the
+// settings directory by a low-priority thread.
+class FlightRecorder : public QThread, public Singleton<FlightRecorder> {
+    Q_OBJECT
+  public:
+    FlightRecorder();
+    ~FlightRecorder() override;
+
+    // Record an event into the calling thread's ring. Cheap and lock-free
+    // apart from the one-time ring registration, so it is safe to call
+    // from the engine callback. No-op before createInstance().
+    static void record(const char* tag, FlightRecorderEventType type) {
+        FlightRecorder* pRecorder = s_pInstance.load(std::memory_order_acquire);
+        if (pRecorder) {
+            pRecorder->getRingForThread()->append(tag, type);
+        }
+    }
+
+    // Ask the recorder thread to dump all rings to disk. Only sets a flag
+    // and wakes the writer thread, so it is safe to call from the engine
+    // callback when an underflow is detected. Requests arriving while a
+    // dump is pending or within the cooldown period are coalesced.
+    static void requestDumpOnXrun() {
+        FlightRecorder* pRecorder = s_pInstance.load(std::memory_order_acquire);
+        if (pRecorder) {
+            pRecorder->m_dumpRequested.store(true, std::memory_order_release);
+            pRecorder->m_dumpCondition.wakeAll();
+        }
+    }
+
+  protected:
+    void run() override;
+
+  private:
+    FlightRecorderRing* getRingForThread();
+    void onRingDestroyed(FlightRecorderRing* pRing);
+    void writeDump();
+
+    static std::atomic<FlightRecorder*> s_pInstance;
+
+    std::atomic<bool> m_dumpRequested;
+    qint64 m_lastDumpNanos;
+    QAtomicInt m_quit;
+    QWaitCondition m_dumpCondition;
+    QMutex m_ringsLock;
+    QList<FlightRecorderRing*> m_rings;
+    QThreadStorage<FlightRecorderRing*> m_threadRings;
+
+    friend class FlightRecorderRing;
+};
+
+// Records an Enter event on construction and an Exit event on destruction,
+// analogous to Trace but cheap enough for per-callback use.
+class FlightRecorderScope final {
+  public:
+    explicit FlightRecorderScope(const char* tag)
+            : m_tag(tag) {
+        FlightRecorder::record(m_tag, FlightRecorderEventType::Enter);
+    }
+    ~FlightRecorderScope() {
+        FlightRecorder::record(m_tag, FlightRecorderEventType::Exit);
+    }
+
+  private:
+    const char* m_tag;
+};
@@ -0,0 +1,78 @@
+#include "util/memoryaccounting.h"
+
+#include <array>
+#include <atomic>
+
+#include "util/assert.h"
+#include "util/stat.h"
+
+namespace {
+
+constexpr std::size_t kNumTags =
+        static_cast<std::size_t>(mixxx::MemoryAccounting::Tag::NumTags);
+
+// Stat tags, indexed by MemoryAccounting::Tag.
+const QString kStatTags[kNumTags] = {
+        QStringLiteral("Memory library bytes"),
+        QStringLiteral("Memory waveforms bytes"),
+        QStringLiteral("Memory chunks bytes"),
+        QStringLiteral("Memory GUI bytes"),
+        QStringLiteral("Memory effects bytes"),
+};
+
+std::array<std::atomic<std::size_t>, kNumTags> s_currentBytes = {};
+std::array<std::atomic<std::size_t>, kNumTags> s_peakBytes = {};
+
+void publish(std::size_t index, std::size_t current) {
+    // MIN/MAX show the low and high watermark of the session in the
+    // Developer Tools stats view; the reported value is the live usage.
+    Stat::track(kStatTags[index],
+            Stat::UNSPECIFIED,
+            Stat::experimentFlags(Stat::AVERAGE | Stat::MIN | Stat::MAX),
+            static_cast<double>(current));
+}
+
+} // namespace
+
+namespace mixxx {
+
+// static
+void MemoryAccounting::trackAlloc(Tag tag, std::size_t bytes) {
+    const auto index = static_cast<std::size_t>(tag);
+    DEBUG_ASSERT(index < kNumTags);
+    const std::size_t current =
+            s_currentBytes[index].fetch_add(bytes, std::memory_order_relaxed) +
+            bytes;
+    std::size_t peak = s_peakBytes[index].load(std::memory_order_relaxed);
+    while (current > peak &&
+            !s_peakBytes[index].compare_exchange_weak(
+                    peak, current, std::memory_order_relaxed)) {
+    }
+    publish(index, current);
+}
+
+// static
+void MemoryAccounting::trackFree(Tag tag, std::size_t bytes) {
+    const auto index = static_cast<std::size_t>(tag);
+    DEBUG_ASSERT(index < kNumTags);
+    const std::size_t previous =
+            s_currentBytes[index].fetch_sub(bytes, std::memory_order_relaxed);
+    DEBUG_ASSERT(previous >= bytes);
+    publish(index, previous - bytes);
+}
+
+// static
+std::size_t MemoryAccounting::currentBytes(Tag tag) {
+    const auto index = static_cast<std::size_t>(tag);
+    DEBUG_ASSERT(index < kNumTags);
+    return s_currentBytes[index].load(std::memory_order_relaxed);
+}
+
+// static
+std::size_t MemoryAccounting::peakBytes(Tag tag) {
+    const auto index = static_cast<std::size_t>(tag);
+    DEBUG_ASSERT(index < kNumTags);
+    return s_peakBytes[index].load(std::memory_order_relaxed);
+}
+
+} // namespace mixxx
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+
+namespace mixxx {
+
+/// Explicit byte accounting for the big memory owners.
+///
+/// Subsystems report the bytes they allocate and release under one of
+/// the tags below. The current usage of every tag is published through
+/// the Stat system, so live values and high watermarks show up in the
+/// Developer Tools stats view when running with --developer, and the
+/// peak is also tracked here for direct queries.
+///
+/// This is deliberate accounting at the owning subsystem, not an
+/// allocator hook: the handful of places that own large buffers know
+/// their sizes exactly, and reporting them explicitly works with any
+/// allocator and costs nothing on untracked paths.
+class MemoryAccounting {
+  public:
+    enum class Tag {
+        Library = 0,
+        Waveforms,
+        Chunks,
+        Gui,
+        Effects,
+        // Keep last
+        NumTags,
+    };
+
+    /// Safe to call from any thread.
+    static void trackAlloc(Tag tag, std::size_t bytes);
+    static void trackFree(Tag tag, std::size_t bytes);
+
+    static std::size_t currentBytes(Tag tag);
+    static std::size_t peakBytes(Tag tag);
+};
+
+/// Accounts a single allocation owned by an object. Reports the given
+/// size under the tag and releases it when reset, reassigned or
+/// destroyed along with the owning allocation.
+class AccountedMemory final {
+  public:
+    explicit AccountedMemory(MemoryAccounting::Tag tag, std::size_t bytes = 0)
+            : m_tag(tag),
+              m_bytes(0) {
+        reset(bytes);
+    }
+    AccountedMemory(const AccountedMemory& other)
+            : AccountedMemory(other.m_tag, other.m_bytes) {
+    }
+    AccountedMemory& operator=(const AccountedMemory& other) {
+        reset(0);
+        m_tag = other.m_tag;
+        reset(other.m_bytes);
+        return *this;
+    }
+    ~AccountedMemory() {
+        reset(0);
+    }
+
+    /// Replaces the accounted size, e.g. after resizing the owned buffer.
+    void reset(std::size_t bytes) {
+        if (m_bytes > 0) {
+            MemoryAccounting::trackFree(m_tag, m_bytes);
+        }
+        m_bytes = bytes;
+        if (m_bytes > 0) {
+            MemoryAccounting::trackAlloc(m_tag, m_bytes);
+        }
+    }
+
+  private:
+    MemoryAccounting::Tag m_tag;
+    std::size_t m_bytes;
+};
+
+} // namespace mixxx
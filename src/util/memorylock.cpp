@@ -0,0 +1,104 @@
+#include "util/memorylock.h"
+
+#include <QtGlobal>
+
+#ifdef Q_OS_WIN
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#include <atomic>
+
+#include "util/logger.h"
+
+namespace mixxx {
+
+namespace {
+
+Logger kLogger("MemoryLock");
+
+std::atomic<bool> s_enabled{false};
+std::atomic<std::size_t> s_lockedBytes{0};
+std::atomic<std::size_t> s_prefaultedBytes{0};
+
+std::size_t pageSize() {
+#ifdef Q_OS_WIN
+    SYSTEM_INFO systemInfo;
+    GetSystemInfo(&systemInfo);
+    return systemInfo.dwPageSize;
+#else
+    const long pageSize = sysconf(_SC_PAGESIZE);
+    return pageSize > 0 ? static_cast<std::size_t>(pageSize) : 4096;
+#endif
+}
+
+// Touch every page of the region so the initial soft page faults are
+// taken here instead of in the audio callback. Unlike a locked region
+// the pages may still be evicted again under memory pressure.
+void prefault(void* pRegion, std::size_t sizeBytes) {
+    const std::size_t page = pageSize();
+    volatile unsigned char* pBytes = static_cast<volatile unsigned char*>(pRegion);
+    for (std::size_t offset = 0; offset < sizeBytes; offset += page) {
+        pBytes[offset] = pBytes[offset];
+    }
+}
+
+} // namespace
+
+// static
+void MemoryLock::setEnabled(bool enabled) {
+    s_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+// static
+bool MemoryLock::isEnabled() {
+    return s_enabled.load(std::memory_order_relaxed);
+}
+
+// static
+bool MemoryLock::lockAndPrefault(void* pRegion, std::size_t sizeBytes, const char* tag) {
+    if (!isEnabled() || !pRegion || sizeBytes == 0) {
+        return false;
+    }
+#ifdef Q_OS_WIN
+    const bool locked = VirtualLock(pRegion, sizeBytes) != 0;
+#else
+    const bool locked = mlock(pRegion, sizeBytes) == 0;
+#endif
+    if (locked) {
+        // A successful lock implies that all pages of the region are
+        // resident, so no separate prefault pass is needed.
+        s_lockedBytes.fetch_add(sizeBytes, std::memory_order_relaxed);
+        kLogger.debug() << "Locked" << sizeBytes << "bytes for" << tag;
+        return true;
+    }
+    // Locking is typically refused because the memlock resource limit
+    // is lower than the requested region. Fall back to prefaulting so
+    // the region at least starts out resident.
+    kLogger.info() << "Could not lock" << sizeBytes << "bytes for" << tag
+                   << "- prefaulting only. Raise the memlock resource limit"
+                   << "to allow locking.";
+    prefault(pRegion, sizeBytes);
+    s_prefaultedBytes.fetch_add(sizeBytes, std::memory_order_relaxed);
+    return false;
+}
+
+// static
+std::size_t MemoryLock::lockedBytes() {
+    return s_lockedBytes.load(std::memory_order_relaxed);
+}
+
+// static
+void MemoryLock::logReport() {
+    if (!isEnabled()) {
+        return;
+    }
+    kLogger.info() << "Locked" << lockedBytes()
+                   << "bytes of engine-critical memory,"
+                   << s_prefaultedBytes.load(std::memory_order_relaxed)
+                   << "bytes prefaulted without locking";
+}
+
+} // namespace mixxx
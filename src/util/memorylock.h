@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+
+namespace mixxx {
+
+/// Optional locking of engine-critical allocations into physical memory.
+///
+/// When enabled via the [App] lock_engine_memory config key, the large
+/// long-lived buffers of the engine (the CachingReader chunk arenas, the
+/// EngineBuffer scratch buffers, the callback arena and the flat control
+/// value table) are locked with mlock()/VirtualLock() where they are
+/// allocated. Locking guarantees that the pages are resident, so the
+/// audio callback never takes a page fault on them, e.g. after the
+/// system has been swapping under memory pressure.
+///
+/// Locking degrades gracefully: when the lock is refused (typically
+/// because the memlock resource limit is too low) the region is merely
+/// prefaulted by touching every page, which avoids the initial soft
+/// faults but does not prevent later eviction.
+class MemoryLock {
+  public:
+    /// Must be called once at startup, before the engine allocates its
+    /// buffers. Locking is disabled by default.
+    static void setEnabled(bool enabled);
+    static bool isEnabled();
+
+    /// Locks the given region into physical memory, which faults in all
+    /// of its pages as a side effect. Falls back to prefaulting without
+    /// locking when the lock is refused. Returns true if the region is
+    /// locked, false otherwise. No-op when locking is disabled.
+    static bool lockAndPrefault(void* pRegion, std::size_t sizeBytes, const char* tag);
+
+    /// Total number of bytes locked so far.
+    static std::size_t lockedBytes();
+
+    /// Logs a summary of the locked and prefaulted byte counts.
+    static void logReport();
+};
+
+} // namespace mixxx
@@ -0,0 +1,29 @@
+#pragma once
+
+/// Compile-time real-time-safety analysis for the engine call graph.
+///
+/// MIXXX_RT_NONBLOCKING expands to Clang's [[clang::nonblocking]] function
+/// effect when the build is configured with -DRT_EFFECT_ANALYSIS=ON on a
+/// compiler that implements it (Clang >= 20). Functions carrying the effect
+/// are verified not to allocate, lock, throw or call any function that may
+/// do so; -Wfunction-effects reports every violation together with the
+/// offending call chain. In all other builds the macro expands to nothing
+/// and does not change the function type.
+///
+/// The annotation is attached to the roots of the real-time call graph
+/// (EngineObject::process() and friends). The analysis then requires every
+/// callee to be provably nonblocking, so newly introduced locks, heap
+/// allocations and blocking syscalls in engine and builtin effect code
+/// surface as compiler diagnostics instead of xruns at a gig. It is the
+/// static complement of the runtime ScopedAllocAudit guard, which only
+/// reports allocations on code paths that actually execute.
+
+#if defined(MIXXX_RT_EFFECT_ANALYSIS) && defined(__clang__)
+#if __has_cpp_attribute(clang::nonblocking)
+#define MIXXX_RT_NONBLOCKING [[clang::nonblocking]]
+#endif
+#endif
+
+#ifndef MIXXX_RT_NONBLOCKING
+#define MIXXX_RT_NONBLOCKING
+#endif
@@ -11,6 +11,12 @@ Rotary::index_type Rotary::nextIndex(Rotary::index_type i) const {
 
 void Rotary::append(double v) {
     m_headIndex = nextIndex(m_headIndex);
+    if (m_filterHistory[m_headIndex] != 0.0) {
+        m_nonZeroCount--;
+    }
+    if (v != 0.0) {
+        m_nonZeroCount++;
+    }
     m_filterHistory[m_headIndex] = v;
 }
 
@@ -31,6 +37,12 @@ double Rotary::calculate() const {
     - Albert (March 13, 2007)
 */
 double Rotary::filter(double v) {
+    if (v == 0.0 && m_nonZeroCount == 0) {
+        // The history is all zero, so appending another zero cannot change
+        // the moving average. Skipping the buffer keeps the per-callback
+        // cost of an idle jog wheel negligible.
+        return 0.0;
+    }
     append(v);
     return calculate();
 }
@@ -12,7 +12,8 @@ class Rotary {
   public:
     Rotary(qsizetype filterLength)
             : m_filterHistory(filterLength, 0.0),
-              m_headIndex{0} {
+              m_headIndex{0},
+              m_nonZeroCount{0} {
         DEBUG_ASSERT(filterLength > 0);
     };
     // Low pass filtered rotary event
@@ -24,4 +25,8 @@ class Rotary {
     double calculate() const;
     Buffer m_filterHistory;
     index_type m_headIndex;
+    // Number of non-zero entries in m_filterHistory. Allows filter() to
+    // skip the buffer entirely while the history is all zero, which is
+    // the common case for an idle jog wheel.
+    index_type m_nonZeroCount;
 };
@@ -1,10 +1,12 @@
 #include "util/sample.h"
 
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 
 #include "engine/engine.h"
 #include "util/math.h"
+#include "util/samplesimd.h"
 
 #ifdef __WINDOWS__
 #include <QtGlobal>
@@ -249,10 +251,7 @@ void SampleUtil::addWithGain(CSAMPLE* M_RESTRICT pDest,
         return;
     }
 
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < numSamples; ++i) {
-        pDest[i] += pSrc[i] * gain;
-    }
+    SampleUtilSimd::kernels().addWithGain(pDest, pSrc, gain, numSamples);
 }
 
 void SampleUtil::addWithRampingGain(CSAMPLE* M_RESTRICT pDest,
@@ -281,6 +280,56 @@ void SampleUtil::addWithRampingGain(CSAMPLE* M_RESTRICT pDest,
     }
 }
 
+// static
+void SampleUtil::mixWithRampingGain(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* const* pSrcs,
+        const CSAMPLE_GAIN* pOldGains,
+        const CSAMPLE_GAIN* pNewGains,
+        int numSrcs,
+        SINT numSamples) {
+    int c = 0;
+    // Process four sources per pass over the destination buffer. Compared
+    // to one addWithRampingGain() call per source this traverses pDest
+    // (and the cache lines behind it) a quarter as often, which matters
+    // once several decks, samplers, mic and aux are active at once.
+    for (; c + 4 <= numSrcs; c += 4) {
+        const CSAMPLE* M_RESTRICT pSrc0 = pSrcs[c];
+        const CSAMPLE* M_RESTRICT pSrc1 = pSrcs[c + 1];
+        const CSAMPLE* M_RESTRICT pSrc2 = pSrcs[c + 2];
+        const CSAMPLE* M_RESTRICT pSrc3 = pSrcs[c + 3];
+        // A delta of zero yields a constant gain of old_gain, so constant
+        // and ramped sources share the same loop below.
+        const CSAMPLE_GAIN delta0 =
+                (pNewGains[c] - pOldGains[c]) / CSAMPLE_GAIN(numSamples / 2);
+        const CSAMPLE_GAIN delta1 =
+                (pNewGains[c + 1] - pOldGains[c + 1]) / CSAMPLE_GAIN(numSamples / 2);
+        const CSAMPLE_GAIN delta2 =
+                (pNewGains[c + 2] - pOldGains[c + 2]) / CSAMPLE_GAIN(numSamples / 2);
+        const CSAMPLE_GAIN delta3 =
+                (pNewGains[c + 3] - pOldGains[c + 3]) / CSAMPLE_GAIN(numSamples / 2);
+        const CSAMPLE_GAIN start0 = pOldGains[c] + delta0;
+        const CSAMPLE_GAIN start1 = pOldGains[c + 1] + delta1;
+        const CSAMPLE_GAIN start2 = pOldGains[c + 2] + delta2;
+        const CSAMPLE_GAIN start3 = pOldGains[c + 3] + delta3;
+        // note: LOOP VECTORIZED.
+        for (int i = 0; i < numSamples / 2; ++i) {
+            const CSAMPLE_GAIN gain0 = start0 + delta0 * i;
+            const CSAMPLE_GAIN gain1 = start1 + delta1 * i;
+            const CSAMPLE_GAIN gain2 = start2 + delta2 * i;
+            const CSAMPLE_GAIN gain3 = start3 + delta3 * i;
+            pDest[i * 2] += pSrc0[i * 2] * gain0 + pSrc1[i * 2] * gain1 +
+                    pSrc2[i * 2] * gain2 + pSrc3[i * 2] * gain3;
+            pDest[i * 2 + 1] += pSrc0[i * 2 + 1] * gain0 +
+                    pSrc1[i * 2 + 1] * gain1 + pSrc2[i * 2 + 1] * gain2 +
+                    pSrc3[i * 2 + 1] * gain3;
+        }
+    }
+    // Remaining sources use the single-source kernel
+    for (; c < numSrcs; ++c) {
+        addWithRampingGain(pDest, pSrcs[c], pOldGains[c], pNewGains[c], numSamples);
+    }
+}
+
 // static
 void SampleUtil::add2WithGain(CSAMPLE* M_RESTRICT pDest,
         const CSAMPLE* M_RESTRICT pSrc1, CSAMPLE_GAIN gain1,
@@ -336,14 +385,7 @@ void SampleUtil::copyWithGain(CSAMPLE* M_RESTRICT pDest,
         return;
     }
 
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < numSamples; ++i) {
-        pDest[i] = pSrc[i] * gain;
-    }
-
-    // OR! need to test which fares better
-    // copy(pDest, pSrc, iNumSamples);
-    // applyGain(pDest, gain);
+    SampleUtilSimd::kernels().copyWithGain(pDest, pSrc, gain, numSamples);
 }
 
 // static
@@ -412,35 +454,26 @@ void SampleUtil::convertFloat32ToS16(SAMPLE* pDest, const CSAMPLE* pSrc,
     }
 }
 
+//static
+void SampleUtil::convertFloat32ToS16WithGain(SAMPLE* pDest,
+        const CSAMPLE* pSrc,
+        CSAMPLE_GAIN gain,
+        SINT numSamples) {
+    DEBUG_ASSERT(-SAMPLE_MINIMUM >= SAMPLE_MAXIMUM);
+    const CSAMPLE kConversionFactor = SAMPLE_MINIMUM * -1.0f * gain;
+    // note: LOOP VECTORIZED only with "int i" (not SINT i).
+    for (int i = 0; i < numSamples; ++i) {
+        pDest[i] = static_cast<SAMPLE>(math_clamp(pSrc[i] * kConversionFactor,
+                static_cast<CSAMPLE>(SAMPLE_MINIMUM),
+                static_cast<CSAMPLE>(SAMPLE_MAXIMUM)));
+    }
+}
+
 // static
 SampleUtil::CLIP_STATUS SampleUtil::sumAbsPerChannel(CSAMPLE* pfAbsL,
         CSAMPLE* pfAbsR, const CSAMPLE* pBuffer, SINT numSamples) {
-    CSAMPLE fAbsL = CSAMPLE_ZERO;
-    CSAMPLE fAbsR = CSAMPLE_ZERO;
-    CSAMPLE clippedL = 0;
-    CSAMPLE clippedR = 0;
-
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < numSamples / 2; ++i) {
-        CSAMPLE absl = fabs(pBuffer[i * 2]);
-        fAbsL += absl;
-        clippedL += absl > CSAMPLE_PEAK ? 1 : 0;
-        CSAMPLE absr = fabs(pBuffer[i * 2 + 1]);
-        fAbsR += absr;
-        // Replacing the code with a bool clipped will prevent vetorizing
-        clippedR += absr > CSAMPLE_PEAK ? 1 : 0;
-    }
-
-    *pfAbsL = fAbsL;
-    *pfAbsR = fAbsR;
-    SampleUtil::CLIP_STATUS clipping = SampleUtil::NO_CLIPPING;
-    if (clippedL > 0) {
-        clipping |= SampleUtil::CLIPPING_LEFT;
-    }
-    if (clippedR > 0) {
-        clipping |= SampleUtil::CLIPPING_RIGHT;
-    }
-    return clipping;
+    return SampleUtilSimd::kernels().sumAbsPerChannel(
+            pfAbsL, pfAbsR, pBuffer, numSamples);
 }
 
 // static
@@ -472,6 +505,26 @@ CSAMPLE SampleUtil::maxAbsAmplitude(const CSAMPLE* pBuffer, SINT numSamples) {
     return max;
 }
 
+// static
+void SampleUtil::maxAbsPerChannel(CSAMPLE* pfMaxL, CSAMPLE* pfMaxR,
+        const CSAMPLE* pBuffer, SINT numSamples) {
+    CSAMPLE maxL = CSAMPLE_ZERO;
+    CSAMPLE maxR = CSAMPLE_ZERO;
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numSamples / 2; ++i) {
+        const CSAMPLE absL = abs(pBuffer[i * 2]);
+        if (absL > maxL) {
+            maxL = absL;
+        }
+        const CSAMPLE absR = abs(pBuffer[i * 2 + 1]);
+        if (absR > maxR) {
+            maxR = absR;
+        }
+    }
+    *pfMaxL = maxL;
+    *pfMaxR = maxR;
+}
+
 // static
 void SampleUtil::copyClampBuffer(CSAMPLE* M_RESTRICT pDest,
         const CSAMPLE* M_RESTRICT pSrc, SINT iNumSamples) {
@@ -481,16 +534,33 @@ void SampleUtil::copyClampBuffer(CSAMPLE* M_RESTRICT pDest,
     }
 }
 
+// static
+SINT SampleUtil::scrubDenormalsAndNaNs(CSAMPLE* pBuffer, SINT numSamples) {
+    SINT scrubbed = 0;
+    // Classify the samples via their IEEE 754 bit pattern instead of
+    // std::fpclassify(), which would prevent vectorization of the loop.
+    // An exponent of all ones marks a NaN or infinity, a zero exponent
+    // with a nonzero mantissa marks a denormal.
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numSamples; ++i) {
+        uint32_t bits;
+        std::memcpy(&bits, &pBuffer[i], sizeof(bits));
+        const uint32_t exponent = bits & 0x7f800000u;
+        const uint32_t mantissa = bits & 0x007fffffu;
+        if (exponent == 0x7f800000u || (exponent == 0u && mantissa != 0u)) {
+            pBuffer[i] = CSAMPLE_ZERO;
+            ++scrubbed;
+        }
+    }
+    return scrubbed;
+}
+
 // static
 void SampleUtil::interleaveBuffer(CSAMPLE* M_RESTRICT pDest,
         const CSAMPLE* M_RESTRICT pSrc1,
         const CSAMPLE* M_RESTRICT pSrc2,
         SINT numFrames) {
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < numFrames; ++i) {
-        pDest[2 * i] = pSrc1[i];
-        pDest[2 * i + 1] = pSrc2[i];
-    }
+    SampleUtilSimd::kernels().interleaveStereo(pDest, pSrc1, pSrc2, numFrames);
 }
 
 // static
@@ -522,11 +592,7 @@ void SampleUtil::deinterleaveBuffer(CSAMPLE* M_RESTRICT pDest1,
         CSAMPLE* M_RESTRICT pDest2,
         const CSAMPLE* M_RESTRICT pSrc,
         SINT numFrames) {
-    // note: LOOP VECTORIZED.
-    for (SINT i = 0; i < numFrames; ++i) {
-        pDest1[i] = pSrc[i * 2];
-        pDest2[i] = pSrc[i * 2 + 1];
-    }
+    SampleUtilSimd::kernels().deinterleaveStereo(pDest1, pDest2, pSrc, numFrames);
 }
 
 // static
@@ -1026,6 +1092,37 @@ void SampleUtil::copy2WithRampingGain(CSAMPLE* M_RESTRICT pDest,
     }
 }
 // static
+void SampleUtil::add2WithRampingGain(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc0,
+        CSAMPLE_GAIN gain0in,
+        CSAMPLE_GAIN gain0out,
+        const CSAMPLE* M_RESTRICT pSrc1,
+        CSAMPLE_GAIN gain1in,
+        CSAMPLE_GAIN gain1out,
+        int iNumSamples) {
+    if (gain0in == CSAMPLE_GAIN_ZERO && gain0out == CSAMPLE_GAIN_ZERO) {
+        addWithRampingGain(pDest, pSrc1, gain1in, gain1out, iNumSamples);
+        return;
+    }
+    if (gain1in == CSAMPLE_GAIN_ZERO && gain1out == CSAMPLE_GAIN_ZERO) {
+        addWithRampingGain(pDest, pSrc0, gain0in, gain0out, iNumSamples);
+        return;
+    }
+    const CSAMPLE_GAIN gain_delta0 = (gain0out - gain0in) / (iNumSamples / 2);
+    const CSAMPLE_GAIN start_gain0 = gain0in + gain_delta0;
+    const CSAMPLE_GAIN gain_delta1 = (gain1out - gain1in) / (iNumSamples / 2);
+    const CSAMPLE_GAIN start_gain1 = gain1in + gain_delta1;
+    // note: LOOP VECTORIZED.
+    for (int i = 0; i < iNumSamples / 2; ++i) {
+        const CSAMPLE_GAIN gain0 = start_gain0 + gain_delta0 * i;
+        const CSAMPLE_GAIN gain1 = start_gain1 + gain_delta1 * i;
+        pDest[i * 2] += pSrc0[i * 2] * gain0 +
+                pSrc1[i * 2] * gain1;
+        pDest[i * 2 + 1] += pSrc0[i * 2 + 1] * gain0 +
+                pSrc1[i * 2 + 1] * gain1;
+    }
+}
+// static
 void SampleUtil::copy3WithGain(CSAMPLE* M_RESTRICT pDest,
         const CSAMPLE* M_RESTRICT pSrc0,
         CSAMPLE_GAIN gain0,
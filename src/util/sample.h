@@ -199,12 +199,39 @@ class SampleUtil {
             CSAMPLE_GAIN old_gain, CSAMPLE_GAIN new_gain,
             SINT numSamples);
 
+    // Fused multi-source variant of addWithRampingGain(): add numSrcs
+    // source buffers, each multiplied by its own gain ramp, to pDest in
+    // as few passes over pDest as possible. The gain state is passed as
+    // structure-of-arrays; entry c of pOldGains/pNewGains belongs to
+    // pSrcs[c]. Equivalent to calling addWithRampingGain() once per
+    // source, but traverses the destination buffer only once per group
+    // of four sources.
+    static void mixWithRampingGain(CSAMPLE* pDest,
+            const CSAMPLE* const* pSrcs,
+            const CSAMPLE_GAIN* pOldGains,
+            const CSAMPLE_GAIN* pNewGains,
+            int numSrcs,
+            SINT numSamples);
+
     // Add to each sample of pDest, pSrc1 multiplied by gain1 plus pSrc2
     // multiplied by gain2
     static void add2WithGain(CSAMPLE* pDest, const CSAMPLE* pSrc1,
             CSAMPLE_GAIN gain1, const CSAMPLE* pSrc2, CSAMPLE_GAIN gain2,
             SINT numSamples);
 
+    // Add to each sample of pDest, pSrc0 multiplied by a gain ramping
+    // from gain0in to gain0out plus pSrc1 multiplied by a gain ramping
+    // from gain1in to gain1out. Accumulating variant of
+    // copy2WithRampingGain().
+    static void add2WithRampingGain(CSAMPLE* M_RESTRICT pDest,
+            const CSAMPLE* M_RESTRICT pSrc0,
+            CSAMPLE_GAIN gain0in,
+            CSAMPLE_GAIN gain0out,
+            const CSAMPLE* M_RESTRICT pSrc1,
+            CSAMPLE_GAIN gain1in,
+            CSAMPLE_GAIN gain1out,
+            int iNumSamples);
+
     // Add to each sample of pDest, pSrc1 multiplied by gain1 plus pSrc2
     // multiplied by gain2 plus pSrc3 multiplied by gain3
     static void add3WithGain(CSAMPLE* pDest, const CSAMPLE* pSrc1,
@@ -221,6 +248,14 @@ class SampleUtil {
     static void convertFloat32ToS16(SAMPLE* pDest, const CSAMPLE* pSrc,
             SINT numSamples);
 
+    // Same as convertFloat32ToS16, but applies the given gain before the
+    // conversion. Input samples that exceed the valid range after applying
+    // the gain are clamped.
+    static void convertFloat32ToS16WithGain(SAMPLE* pDest,
+            const CSAMPLE* pSrc,
+            CSAMPLE_GAIN gain,
+            SINT numSamples);
+
     // For each pair of samples in pBuffer (l,r) -- stores the sum of the
     // absolute values of l in pfAbsL, and the sum of the absolute values of r
     // in pfAbsR.
@@ -236,11 +271,24 @@ class SampleUtil {
 
     static CSAMPLE maxAbsAmplitude(const CSAMPLE* pBuffer, SINT numSamples);
 
+    // For each pair of samples in pBuffer (l,r) -- stores the maximum of the
+    // absolute values of l in pfMaxL, and the maximum of the absolute values
+    // of r in pfMaxR.
+    static void maxAbsPerChannel(CSAMPLE* pfMaxL, CSAMPLE* pfMaxR,
+            const CSAMPLE* pBuffer, SINT numSamples);
+
     // Copies every sample in pSrc to pDest, limiting the values in pDest
     // to the valid range of CSAMPLE. pDest and pSrc must not overlap.
     static void copyClampBuffer(CSAMPLE* pDest, const CSAMPLE* pSrc,
             SINT numSamples);
 
+    // Replaces every NaN, infinity and denormal sample in pBuffer with zero
+    // and returns the number of samples that were replaced. The audio threads
+    // run with denormals flushed to zero (see util/denormalsarezero.h), but
+    // NaNs and infinities escaping from a buggy effect would propagate
+    // through delay lines and the mix indefinitely.
+    static SINT scrubDenormalsAndNaNs(CSAMPLE* pBuffer, SINT numSamples);
+
     // Interleave the samples in pSrc1 and pSrc2 into pDest (stereo). iNumSamples must be
     // the number of samples in pSrc1 and pSrc2, and pDest must have at least
     // space for numFrames*2 samples. pDest must not be an alias of pSrc1 or
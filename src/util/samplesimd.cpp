@@ -0,0 +1,497 @@
+#include "util/samplesimd.h"
+
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SAMPLESIMD_BUILD_SSE2
+#include <emmintrin.h>
+#endif
+
+#if defined(__ARM_NEON)
+#define SAMPLESIMD_BUILD_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+#include "util/logger.h"
+
+// Defined in samplesimd_avx2.cpp, which is compiled with AVX2 code
+// generation enabled on x86 targets (see CMakeLists.txt). Returns nullptr
+// when the build target cannot emit AVX2 instructions.
+const SampleUtilSimd::Kernels* sampleUtilSimdAvx2Kernels();
+
+namespace {
+
+const mixxx::Logger kLogger("SampleUtilSimd");
+
+// The scalar kernels below are the loops that used to live in SampleUtil.
+// They are kept bit-identical as the portable fallback and as the reference
+// implementation that the SIMD backends are validated against.
+namespace scalar {
+
+void copyWithGain(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN gain,
+        SINT numSamples) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numSamples; ++i) {
+        pDest[i] = pSrc[i] * gain;
+    }
+}
+
+void addWithGain(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc,
+        CSAMPLE_GAIN gain,
+        SINT numSamples) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numSamples; ++i) {
+        pDest[i] += pSrc[i] * gain;
+    }
+}
+
+void interleaveStereo(CSAMPLE* M_RESTRICT pDest,
+        const CSAMPLE* M_RESTRICT pSrc1,
+        const CSAMPLE* M_RESTRICT pSrc2,
+        SINT numFrames) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numFrames; ++i) {
+        pDest[2 * i] = pSrc1[i];
+        pDest[2 * i + 1] = pSrc2[i];
+    }
+}
+
+void deinterleaveStereo(CSAMPLE* M_RESTRICT pDest1,
+        CSAMPLE* M_RESTRICT pDest2,
+        const CSAMPLE* M_RESTRICT pSrc,
+        SINT numFrames) {
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numFrames; ++i) {
+        pDest1[i] = pSrc[i * 2];
+        pDest2[i] = pSrc[i * 2 + 1];
+    }
+}
+
+SampleUtil::CLIP_STATUS sumAbsPerChannel(CSAMPLE* pfAbsL,
+        CSAMPLE* pfAbsR,
+        const CSAMPLE* pBuffer,
+        SINT numSamples) {
+    CSAMPLE fAbsL = CSAMPLE_ZERO;
+    CSAMPLE fAbsR = CSAMPLE_ZERO;
+    CSAMPLE clippedL = 0;
+    CSAMPLE clippedR = 0;
+
+    // note: LOOP VECTORIZED.
+    for (SINT i = 0; i < numSamples / 2; ++i) {
+        CSAMPLE absl = fabs(pBuffer[i * 2]);
+        fAbsL += absl;
+        clippedL += absl > CSAMPLE_PEAK ? 1 : 0;
+        CSAMPLE absr = fabs(pBuffer[i * 2 + 1]);
+        fAbsR += absr;
+        // Replacing the code with a bool clipped will prevent vetorizing
+        clippedR += absr > CSAMPLE_PEAK ? 1 : 0;
+    }
+
+    *pfAbsL = fAbsL;
+    *pfAbsR = fAbsR;
+    SampleUtil::CLIP_STATUS clipping = SampleUtil::NO_CLIPPING;
+    if (clippedL > 0) {
+        clipping |= SampleUtil::CLIPPING_LEFT;
+    }
+    if (clippedR > 0) {
+        clipping |= SampleUtil::CLIPPING_RIGHT;
+    }
+    return clipping;
+}
+
+} // namespace scalar
+
+#ifdef SAMPLESIMD_BUILD_SSE2
+
+// SSE2 kernels process 4 samples (2 stereo frames) per iteration with
+// unaligned loads/stores. SampleUtil::alloc() aligns engine buffers, but
+// callers may pass offsets into them, so we must not assume alignment.
+namespace sse2 {
+
+void copyWithGain(CSAMPLE* pDest,
+        const CSAMPLE* pSrc,
+        CSAMPLE_GAIN gain,
+        SINT numSamples) {
+    const __m128 vGain = _mm_set1_ps(gain);
+    SINT i = 0;
+    for (; i + 4 <= numSamples; i += 4) {
+        _mm_storeu_ps(pDest + i,
+                _mm_mul_ps(_mm_loadu_ps(pSrc + i), vGain));
+    }
+    for (; i < numSamples; ++i) {
+        pDest[i] = pSrc[i] * gain;
+    }
+}
+
+void addWithGain(CSAMPLE* pDest,
+        const CSAMPLE* pSrc,
+        CSAMPLE_GAIN gain,
+        SINT numSamples) {
+    const __m128 vGain = _mm_set1_ps(gain);
+    SINT i = 0;
+    for (; i + 4 <= numSamples; i += 4) {
+        _mm_storeu_ps(pDest + i,
+                _mm_add_ps(_mm_loadu_ps(pDest + i),
+                        _mm_mul_ps(_mm_loadu_ps(pSrc + i), vGain)));
+    }
+    for (; i < numSamples; ++i) {
+        pDest[i] += pSrc[i] * gain;
+    }
+}
+
+void interleaveStereo(CSAMPLE* pDest,
+        const CSAMPLE* pSrc1,
+        const CSAMPLE* pSrc2,
+        SINT numFrames) {
+    SINT i = 0;
+    for (; i + 4 <= numFrames; i += 4) {
+        const __m128 l = _mm_loadu_ps(pSrc1 + i);
+        const __m128 r = _mm_loadu_ps(pSrc2 + i);
+        _mm_storeu_ps(pDest + 2 * i, _mm_unpacklo_ps(l, r));
+        _mm_storeu_ps(pDest + 2 * i + 4, _mm_unpackhi_ps(l, r));
+    }
+    for (; i < numFrames; ++i) {
+        pDest[2 * i] = pSrc1[i];
+        pDest[2 * i + 1] = pSrc2[i];
+    }
+}
+
+void deinterleaveStereo(CSAMPLE* pDest1,
+        CSAMPLE* pDest2,
+        const CSAMPLE* pSrc,
+        SINT numFrames) {
+    SINT i = 0;
+    for (; i + 4 <= numFrames; i += 4) {
+        const __m128 lo = _mm_loadu_ps(pSrc + 2 * i);
+        const __m128 hi = _mm_loadu_ps(pSrc + 2 * i + 4);
+        _mm_storeu_ps(pDest1 + i, _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(pDest2 + i, _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1)));
+    }
+    for (; i < numFrames; ++i) {
+        pDest1[i] = pSrc[i * 2];
+        pDest2[i] = pSrc[i * 2 + 1];
+    }
+}
+
+SampleUtil::CLIP_STATUS sumAbsPerChannel(CSAMPLE* pfAbsL,
+        CSAMPLE* pfAbsR,
+        const CSAMPLE* pBuffer,
+        SINT numSamples) {
+    // Clear the sign bit to take the absolute value without branching.
+    const __m128 vAbsMask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+    const __m128 vPeak = _mm_set1_ps(CSAMPLE_PEAK);
+    const __m128 vOne = _mm_set1_ps(1.0f);
+    // Lanes alternate [L R L R]; both stereo channels share the vectors.
+    __m128 vAbsSum = _mm_setzero_ps();
+    __m128 vClipCount = _mm_setzero_ps();
+    SINT i = 0;
+    for (; i + 4 <= numSamples; i += 4) {
+        const __m128 vAbs = _mm_and_ps(_mm_loadu_ps(pBuffer + i), vAbsMask);
+        vAbsSum = _mm_add_ps(vAbsSum, vAbs);
+        vClipCount = _mm_add_ps(vClipCount,
+                _mm_and_ps(_mm_cmpgt_ps(vAbs, vPeak), vOne));
+    }
+    float absSum[4];
+    float clipCount[4];
+    _mm_storeu_ps(absSum, vAbsSum);
+    _mm_storeu_ps(clipCount, vClipCount);
+    CSAMPLE fAbsL = absSum[0] + absSum[2];
+    CSAMPLE fAbsR = absSum[1] + absSum[3];
+    CSAMPLE clippedL = clipCount[0] + clipCount[2];
+    CSAMPLE clippedR = clipCount[1] + clipCount[3];
+    for (; i + 2 <= numSamples; i += 2) {
+        const CSAMPLE absl = fabs(pBuffer[i]);
+        fAbsL += absl;
+        clippedL += absl > CSAMPLE_PEAK ? 1 : 0;
+        const CSAMPLE absr = fabs(pBuffer[i + 1]);
+        fAbsR += absr;
+        clippedR += absr > CSAMPLE_PEAK ? 1 : 0;
+    }
+
+    *pfAbsL = fAbsL;
+    *pfAbsR = fAbsR;
+    SampleUtil::CLIP_STATUS clipping = SampleUtil::NO_CLIPPING;
+    if (clippedL > 0) {
+        clipping |= SampleUtil::CLIPPING_LEFT;
+    }
+    if (clippedR > 0) {
+        clipping |= SampleUtil::CLIPPING_RIGHT;
+    }
+    return clipping;
+}
+
+} // namespace sse2
+
+#endif // SAMPLESIMD_BUILD_SSE2
+
+#ifdef SAMPLESIMD_BUILD_NEON
+
+// NEON kernels process 4 samples (2 stereo frames) per iteration. The
+// structured vld2q/vst2q loads give us the stereo (de)interleave for free.
+namespace neon {
+
+void copyWithGain(CSAMPLE* pDest,
+        const CSAMPLE* pSrc,
+        CSAMPLE_GAIN gain,
+        SINT numSamples) {
+    const float32x4_t vGain = vdupq_n_f32(gain);
+    SINT i = 0;
+    for (; i + 4 <= numSamples; i += 4) {
+        vst1q_f32(pDest + i, vmulq_f32(vld1q_f32(pSrc + i), vGain));
+    }
+    for (; i < numSamples; ++i) {
+        pDest[i] = pSrc[i] * gain;
+    }
+}
+
+void addWithGain(CSAMPLE* pDest,
+        const CSAMPLE* pSrc,
+        CSAMPLE_GAIN gain,
+        SINT numSamples) {
+    const float32x4_t vGain = vdupq_n_f32(gain);
+    SINT i = 0;
+    for (; i + 4 <= numSamples; i += 4) {
+        vst1q_f32(pDest + i,
+                vmlaq_f32(vld1q_f32(pDest + i), vld1q_f32(pSrc + i), vGain));
+    }
+    for (; i < numSamples; ++i) {
+        pDest[i] += pSrc[i] * gain;
+    }
+}
+
+void interleaveStereo(CSAMPLE* pDest,
+        const CSAMPLE* pSrc1,
+        const CSAMPLE* pSrc2,
+        SINT numFrames) {
+    SINT i = 0;
+    for (; i + 4 <= numFrames; i += 4) {
+        float32x4x2_t frames;
+        frames.val[0] = vld1q_f32(pSrc1 + i);
+        frames.val[1] = vld1q_f32(pSrc2 + i);
+        vst2q_f32(pDest + 2 * i, frames);
+    }
+    for (; i < numFrames; ++i) {
+        pDest[2 * i] = pSrc1[i];
+        pDest[2 * i + 1] = pSrc2[i];
+    }
+}
+
+void deinterleaveStereo(CSAMPLE* pDest1,
+        CSAMPLE* pDest2,
+        const CSAMPLE* pSrc,
+        SINT numFrames) {
+    SINT i = 0;
+    for (; i + 4 <= numFrames; i += 4) {
+        const float32x4x2_t frames = vld2q_f32(pSrc + 2 * i);
+        vst1q_f32(pDest1 + i, frames.val[0]);
+        vst1q_f32(pDest2 + i, frames.val[1]);
+    }
+    for (; i < numFrames; ++i) {
+        pDest1[i] = pSrc[i * 2];
+        pDest2[i] = pSrc[i * 2 + 1];
+    }
+}
+
+SampleUtil::CLIP_STATUS sumAbsPerChannel(CSAMPLE* pfAbsL,
+        CSAMPLE* pfAbsR,
+        const CSAMPLE* pBuffer,
+        SINT numSamples) {
+    const float32x4_t vPeak = vdupq_n_f32(CSAMPLE_PEAK);
+    const uint32x4_t vOneBits = vreinterpretq_u32_f32(vdupq_n_f32(1.0f));
+    // val[0] holds the left, val[1] the right channel lanes.
+    float32x4_t vAbsSumL = vdupq_n_f32(0.0f);
+    float32x4_t vAbsSumR = vdupq_n_f32(0.0f);
+    float32x4_t vClipCountL = vdupq_n_f32(0.0f);
+    float32x4_t vClipCountR = vdupq_n_f32(0.0f);
+    SINT i = 0;
+    for (; i + 8 <= numSamples; i += 8) {
+        const float32x4x2_t frames = vld2q_f32(pBuffer + i);
+        const float32x4_t vAbsL = vabsq_f32(frames.val[0]);
+        const float32x4_t vAbsR = vabsq_f32(frames.val[1]);
+        vAbsSumL = vaddq_f32(vAbsSumL, vAbsL);
+        vAbsSumR = vaddq_f32(vAbsSumR, vAbsR);
+        vClipCountL = vaddq_f32(vClipCountL,
+                vreinterpretq_f32_u32(vandq_u32(vcgtq_f32(vAbsL, vPeak), vOneBits)));
+        vClipCountR = vaddq_f32(vClipCountR,
+                vreinterpretq_f32_u32(vandq_u32(vcgtq_f32(vAbsR, vPeak), vOneBits)));
+    }
+    float absSumL[4];
+    float absSumR[4];
+    float clipCountL[4];
+    float clipCountR[4];
+    vst1q_f32(absSumL, vAbsSumL);
+    vst1q_f32(absSumR, vAbsSumR);
+    vst1q_f32(clipCountL, vClipCountL);
+    vst1q_f32(clipCountR, vClipCountR);
+    CSAMPLE fAbsL = absSumL[0] + absSumL[1] + absSumL[2] + absSumL[3];
+    CSAMPLE fAbsR = absSumR[0] + absSumR[1] + absSumR[2] + absSumR[3];
+    CSAMPLE clippedL = clipCountL[0] + clipCountL[1] + clipCountL[2] + clipCountL[3];
+    CSAMPLE clippedR = clipCountR[0] + clipCountR[1] + clipCountR[2] + clipCountR[3];
+    for (; i + 2 <= numSamples; i += 2) {
+        const CSAMPLE absl = fabs(pBuffer[i]);
+        fAbsL += absl;
+        clippedL += absl > CSAMPLE_PEAK ? 1 : 0;
+        const CSAMPLE absr = fabs(pBuffer[i + 1]);
+        fAbsR += absr;
+        clippedR += absr > CSAMPLE_PEAK ? 1 : 0;
+    }
+
+    *pfAbsL = fAbsL;
+    *pfAbsR = fAbsR;
+    SampleUtil::CLIP_STATUS clipping = SampleUtil::NO_CLIPPING;
+    if (clippedL > 0) {
+        clipping |= SampleUtil::CLIPPING_LEFT;
+    }
+    if (clippedR > 0) {
+        clipping |= SampleUtil::CLIPPING_RIGHT;
+    }
+    return clipping;
+}
+
+} // namespace neon
+
+#endif // SAMPLESIMD_BUILD_NEON
+
+constexpr SampleUtilSimd::Kernels kScalarKernels = {
+        scalar::copyWithGain,
+        scalar::addWithGain,
+        scalar::interleaveStereo,
+        scalar::deinterleaveStereo,
+        scalar::sumAbsPerChannel,
+};
+
+#ifdef SAMPLESIMD_BUILD_SSE2
+constexpr SampleUtilSimd::Kernels kSse2Kernels = {
+        sse2::copyWithGain,
+        sse2::addWithGain,
+        sse2::interleaveStereo,
+        sse2::deinterleaveStereo,
+        sse2::sumAbsPerChannel,
+};
+#endif
+
+#ifdef SAMPLESIMD_BUILD_NEON
+constexpr SampleUtilSimd::Kernels kNeonKernels = {
+        neon::copyWithGain,
+        neon::addWithGain,
+        neon::interleaveStereo,
+        neon::deinterleaveStereo,
+        neon::sumAbsPerChannel,
+};
+#endif
+
+bool cpuSupportsAvx2() {
+    // The AVX2 kernels use fused multiply-add, so require FMA as well.
+    // Every CPU that ships AVX2 also ships FMA, but be defensive.
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+    // Also verifies OS support for saving the YMM registers (OSXSAVE).
+    return __builtin_cpu_supports("avx2") != 0 &&
+            __builtin_cpu_supports("fma") != 0;
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    int regs[4];
+    __cpuid(regs, 0);
+    if (regs[0] < 7) {
+        return false;
+    }
+    __cpuid(regs, 1);
+    const bool osxsave = (regs[2] & (1 << 27)) != 0;
+    const bool fma = (regs[2] & (1 << 12)) != 0;
+    if (!osxsave || !fma) {
+        return false;
+    }
+    // The OS must save/restore the full YMM state on context switches.
+    if ((_xgetbv(0) & 0x6) != 0x6) {
+        return false;
+    }
+    __cpuidex(regs, 7, 0);
+    return (regs[1] & (1 << 5)) != 0;
+#else
+    return false;
+#endif
+}
+
+SampleUtilSimd::Backend detectBackend() {
+#if defined(SAMPLESIMD_BUILD_NEON)
+    // NEON is part of the baseline on all our ARM build targets.
+    return SampleUtilSimd::Backend::Neon;
+#else
+    if (cpuSupportsAvx2() && sampleUtilSimdAvx2Kernels() != nullptr) {
+        return SampleUtilSimd::Backend::Avx2;
+    }
+#ifdef SAMPLESIMD_BUILD_SSE2
+    // SSE2 is part of the baseline of all our x86 build targets
+    // (see OPTIMIZE=portable in CMakeLists.txt), no runtime check needed.
+    return SampleUtilSimd::Backend::Sse2;
+#else
+    return SampleUtilSimd::Backend::Scalar;
+#endif
+#endif
+}
+
+const SampleUtilSimd::Kernels* kernelsForBackend(SampleUtilSimd::Backend backend) {
+    switch (backend) {
+#ifdef SAMPLESIMD_BUILD_SSE2
+    case SampleUtilSimd::Backend::Sse2:
+        return &kSse2Kernels;
+#endif
+#ifdef SAMPLESIMD_BUILD_NEON
+    case SampleUtilSimd::Backend::Neon:
+        return &kNeonKernels;
+#endif
+    case SampleUtilSimd::Backend::Avx2: {
+        const SampleUtilSimd::Kernels* pKernels = sampleUtilSimdAvx2Kernels();
+        if (pKernels != nullptr) {
+            return pKernels;
+        }
+        break;
+    }
+    default:
+        break;
+    }
+    return &kScalarKernels;
+}
+
+} // anonymous namespace
+
+// static
+SampleUtilSimd::Backend SampleUtilSimd::backend() {
+    static const Backend s_backend = []() {
+        const Backend backend = detectBackend();
+        kLogger.info() << "Selected SIMD backend:" << backendName(backend);
+        return backend;
+    }();
+    return s_backend;
+}
+
+// static
+const SampleUtilSimd::Kernels& SampleUtilSimd::kernels() {
+    static const Kernels* s_pKernels = kernelsForBackend(backend());
+    return *s_pKernels;
+}
+
+// static
+const SampleUtilSimd::Kernels& SampleUtilSimd::scalarKernels() {
+    return kScalarKernels;
+}
+
+// static
+const char* SampleUtilSimd::backendName(Backend backend) {
+    switch (backend) {
+    case Backend::Scalar:
+        return "Scalar";
+    case Backend::Sse2:
+        return "SSE2";
+    case Backend::Avx2:
+        return "AVX2";
+    case Backend::Neon:
+        return "NEON";
+    }
+    return "Unknown";
+}
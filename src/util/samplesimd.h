@@ -0,0 +1,62 @@
+#pragma once
+
+#include "util/sample.h"
+#include "util/types.h"
+
+// Runtime-dispatched SIMD kernels for the hottest SampleUtil loops on the
+// per-callback mixing path (copy/add with gain, stereo (de)interleave and
+// sumAbsPerChannel). The best backend available on the host CPU is selected
+// exactly once, before the audio callback starts pulling samples, so the
+// hot path pays only for one indirect call per kernel instead of relying on
+// the compiler autovectorizing for the baseline -msse2 target.
+//
+// The scalar kernels are bit-identical to the loops that used to live in
+// SampleUtil and remain the fallback on CPUs (or builds) without SIMD
+// support. New backends must produce results that match the scalar kernels
+// within floating point reassociation tolerance; see sampleutiltest.cpp.
+class SampleUtilSimd {
+  public:
+    enum class Backend {
+        Scalar,
+        Sse2,
+        Avx2,
+        Neon,
+    };
+
+    struct Kernels {
+        void (*copyWithGain)(CSAMPLE* pDest,
+                const CSAMPLE* pSrc,
+                CSAMPLE_GAIN gain,
+                SINT numSamples);
+        void (*addWithGain)(CSAMPLE* pDest,
+                const CSAMPLE* pSrc,
+                CSAMPLE_GAIN gain,
+                SINT numSamples);
+        void (*interleaveStereo)(CSAMPLE* pDest,
+                const CSAMPLE* pSrc1,
+                const CSAMPLE* pSrc2,
+                SINT numFrames);
+        void (*deinterleaveStereo)(CSAMPLE* pDest1,
+                CSAMPLE* pDest2,
+                const CSAMPLE* pSrc,
+                SINT numFrames);
+        SampleUtil::CLIP_STATUS (*sumAbsPerChannel)(CSAMPLE* pfAbsL,
+                CSAMPLE* pfAbsR,
+                const CSAMPLE* pBuffer,
+                SINT numSamples);
+    };
+
+    // The kernel table for the backend selected at startup. The first call
+    // performs the CPU feature detection; all subsequent calls are a plain
+    // load of the already initialized table.
+    static const Kernels& kernels();
+
+    // The backend backing kernels(). Exposed for logging and tests.
+    static Backend backend();
+    static const char* backendName(Backend backend);
+
+    // Kernel tables for a specific backend, independent of the detected
+    // CPU features. Used by tests to cross-check SIMD backends against the
+    // scalar reference; do not use on the hot path.
+    static const Kernels& scalarKernels();
+};
@@ -2,12 +2,26 @@
 
 #include <QStringList>
 #include <chrono>
+#include <cmath>
 #include <limits>
 
 #include "util/math.h"
 #include "util/statsmanager.h"
 #include "util/time.h"
 
+namespace {
+
+int bucketIndexForValue(double value) {
+    if (value < 1.0) {
+        return 0;
+    }
+    return math_clamp(static_cast<int>(std::log2(value)),
+            0,
+            Stat::kNumDurationBuckets - 1);
+}
+
+} // namespace
+
 Stat::Stat()
         : m_type(UNSPECIFIED),
           m_compute(NONE),
@@ -65,11 +79,48 @@ void Stat::processReport(const StatReport& report) {
         m_histogram[report.value] += 1.0;
     }
 
+    if (m_compute & Stat::BUCKET_HISTOGRAM) {
+        if (m_bucketCounts.size() != kNumDurationBuckets) {
+            m_bucketCounts.resize(kNumDurationBuckets);
+        }
+        m_bucketCounts[bucketIndexForValue(report.value)] += 1.0;
+    }
+
     if (m_compute & Stat::VALUES) {
         m_values.push_back(report.value);
     }
 }
 
+double Stat::percentile(double fraction) const {
+    DEBUG_ASSERT(fraction >= 0.0 && fraction <= 1.0);
+    double total = 0.0;
+    for (double count : m_bucketCounts) {
+        total += count;
+    }
+    if (total <= 0.0) {
+        return 0.0;
+    }
+    const double target = fraction * total;
+    double cumulative = 0.0;
+    for (int i = 0; i < m_bucketCounts.size(); ++i) {
+        if (m_bucketCounts[i] <= 0.0) {
+            continue;
+        }
+        cumulative += m_bucketCounts[i];
+        if (cumulative >= target) {
+            // Interpolate linearly within the bucket. Bucket 0 also
+            // covers all values below its lower bound of 1.
+            const double lowerBound = i == 0 ? 0.0 : std::exp2(i);
+            const double upperBound = std::exp2(i + 1);
+            const double fractionInBucket =
+                    1.0 - (cumulative - target) / m_bucketCounts[i];
+            return lowerBound + fractionInBucket * (upperBound - lowerBound);
+        }
+    }
+    // Unreachable since cumulative reaches total >= target.
+    return m_max;
+}
+
 QDebug operator<<(QDebug dbg, const Stat& stat) {
     QStringList stats;
 
@@ -143,6 +194,11 @@ QDebug operator<<(QDebug dbg, const Stat& stat) {
         // TODO(rryan): implement
     }
 
+    if (stat.m_compute & Stat::BUCKET_HISTOGRAM) {
+        stats << "p99=" + formatTime(stat.percentile(0.99));
+        stats << "p999=" + formatTime(stat.percentile(0.999));
+    }
+
     if (stat.m_compute & Stat::HISTOGRAM) {
         QStringList histogram;
         for (auto it = stat.m_histogram.constBegin(); it != stat.m_histogram.constEnd(); ++it) {
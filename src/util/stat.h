@@ -75,6 +75,10 @@ class Stat {
         STATS_EXPERIMENT = 0x0800,
         // Used for marking stats recorded in BASE mode.
         STATS_BASE = 0x1000,
+        // O(1) in time, fixed space. Collects values into log2-spaced
+        // buckets, suitable for estimating tail percentiles of duration
+        // reports (in nanoseconds) without unbounded memory usage.
+        BUCKET_HISTOGRAM = 0x2000,
     };
     Q_DECLARE_FLAGS(ComputeFlags, ComputeTypes);
 
@@ -99,10 +103,21 @@ class Stat {
         }
     }
 
+    // Number of log2-spaced buckets collected for BUCKET_HISTOGRAM.
+    // Bucket i counts values in [2^i, 2^(i+1)), except bucket 0 which
+    // also covers all values below 1.
+    static constexpr int kNumDurationBuckets = 64;
+
     explicit Stat();
     void processReport(const StatReport& report);
     QString valueUnits() const;
 
+    // Estimates the value at the given fraction (0.0..1.0) of the
+    // distribution collected with BUCKET_HISTOGRAM by interpolating
+    // within the log2-spaced buckets. Returns 0.0 if no reports have
+    // been collected.
+    double percentile(double fraction) const;
+
     double variance() const {
         return m_report_count > 1 ? m_variance_sk / (m_report_count - 1) : 0.0;
     }
@@ -118,6 +133,7 @@ class Stat {
     double m_variance_mk;
     double m_variance_sk;
     QMap<double, double> m_histogram;
+    QVector<double> m_bucketCounts;
 
     static bool track(QString tag,
             Stat::StatType type,
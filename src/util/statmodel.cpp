@@ -18,6 +18,8 @@ StatModel::StatModel(QObject* pParent)
     setHeaderData(STAT_COLUMN_MEAN, Qt::Horizontal, tr("Mean"));
     setHeaderData(STAT_COLUMN_VARIANCE, Qt::Horizontal, tr("Variance"));
     setHeaderData(STAT_COLUMN_STDDEV, Qt::Horizontal, tr("Standard Deviation"));
+    setHeaderData(STAT_COLUMN_P99, Qt::Horizontal, tr("99th Percentile"));
+    setHeaderData(STAT_COLUMN_P999, Qt::Horizontal, tr("99.9th Percentile"));
 }
 
 StatModel::~StatModel() {
@@ -91,6 +93,12 @@ QVariant StatModel::data(const QModelIndex& index,
             return stat.variance();
         case STAT_COLUMN_STDDEV:
             return sqrt(stat.variance());
+        case STAT_COLUMN_P99:
+            return stat.m_compute & Stat::BUCKET_HISTOGRAM ?
+                    QVariant(stat.percentile(0.99)) : QVariant();
+        case STAT_COLUMN_P999:
+            return stat.m_compute & Stat::BUCKET_HISTOGRAM ?
+                    QVariant(stat.percentile(0.999)) : QVariant();
         case STAT_COLUMN_UNITS:
             return stat.valueUnits();
     }
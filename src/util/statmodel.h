@@ -24,6 +24,8 @@ class StatModel final : public QAbstractTableModel {
         STAT_COLUMN_MEAN,
         STAT_COLUMN_VARIANCE,
         STAT_COLUMN_STDDEV,
+        STAT_COLUMN_P99,
+        STAT_COLUMN_P999,
         NUM_STAT_COLUMNS
     };
 
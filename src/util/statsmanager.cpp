@@ -2,8 +2,10 @@
 
 #include <QFile>
 #include <QMetaType>
+#include <QStringList>
 #include <QTextStream>
 #include <QtDebug>
+#include <cmath>
 
 #include "moc_statsmanager.cpp"
 #include "util/cmdlineargs.h"
@@ -162,6 +164,55 @@ void StatsManager::writeTimeline(const QString& filename) {
     timeline.close();
 }
 
+void StatsManager::writeStatsCsv(const QString& filename) {
+    QFile csvFile(filename);
+    if (!csvFile.open(QIODevice::WriteOnly | QIODevice::Text)) {
+        qWarning() << "Could not open stats CSV file for writing:"
+                   << csvFile.fileName();
+        return;
+    }
+
+    QTextStream out(&csvFile);
+    out << "tag,units,count,sum,min,max,mean,stddev,p99,p999,buckets\n";
+
+    // m_stats is only modified by processIncomingStatReports() which is
+    // always called while holding m_statsPipeLock.
+    const auto locker = lockMutex(&m_statsPipeLock);
+    for (auto it = m_stats.constBegin(); it != m_stats.constEnd(); ++it) {
+        const Stat& stat = it.value();
+        // TODO(rryan): CSV escaping
+        out << stat.m_tag << ","
+            << stat.valueUnits() << ","
+            << stat.m_report_count << ","
+            << stat.m_sum << ",";
+        if (stat.m_report_count > 0) {
+            out << stat.m_min << ","
+                << stat.m_max << ","
+                << stat.m_sum / stat.m_report_count << ",";
+        } else {
+            out << ",,,";
+        }
+        out << std::sqrt(stat.variance()) << ",";
+        if (stat.m_compute & Stat::BUCKET_HISTOGRAM) {
+            out << stat.percentile(0.99) << ","
+                << stat.percentile(0.999) << ",";
+            // One lower_bound:count pair per non-empty bucket.
+            QStringList buckets;
+            for (int i = 0; i < stat.m_bucketCounts.size(); ++i) {
+                if (stat.m_bucketCounts[i] <= 0.0) {
+                    continue;
+                }
+                buckets << QString::number(i == 0 ? 0.0 : std::exp2(i)) +
+                                ":" + QString::number(stat.m_bucketCounts[i]);
+            }
+            out << buckets.join(";");
+        } else {
+            out << ",,";
+        }
+        out << "\n";
+    }
+}
+
 void StatsManager::onStatsPipeDestroyed(StatsPipe* pPipe) {
     const auto locker = lockMutex(&m_statsPipeLock);
     processIncomingStatReports();
@@ -67,6 +67,11 @@ class StatsManager : public QThread, public Singleton<StatsManager> {
         m_statsPipeCondition.wakeAll();
     }
 
+    // Writes all aggregated stats including their bucketed latency
+    // histograms and tail percentiles to a CSV file. May be called from
+    // any thread.
+    void writeStatsCsv(const QString& filename);
+
   signals:
     void statUpdated(const Stat& stat);
 
@@ -29,6 +29,14 @@ class StringCollator {
         return m_collator.compare(s1, s2);
     }
 
+    /// Precomputed binary key that sorts in the same order as compare().
+    /// Comparing keys is much cheaper than collating the strings again,
+    /// so keys pay off whenever the same strings are compared repeatedly,
+    /// e.g. while sorting.
+    QCollatorSortKey sortKey(const QString& s) const {
+        return m_collator.sortKey(s);
+    }
+
   private:
     QCollator m_collator;
 };
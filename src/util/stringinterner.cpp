@@ -0,0 +1,58 @@
+#include "util/stringinterner.h"
+
+#include <QHash>
+#include <QMutex>
+
+#include "util/compatibility/qmutex.h"
+
+namespace mixxx {
+
+namespace {
+
+// Upper bound on the number of distinct pooled strings. Even large
+// libraries only contain a moderate number of distinct artist, album and
+// genre values, but pathological inputs (e.g. a unique value in every
+// row) must not grow the pool indefinitely. When the bound is hit the
+// pool is flushed entirely instead of maintaining an eviction order, the
+// frequent values are re-collected after a few lookups.
+constexpr int kMaxPoolSize = 1 << 16;
+
+QMutex s_poolMutex;
+
+// The key and the mapped value of each entry share a single QString
+// allocation, so the pool itself only costs one string per distinct
+// value plus the hash buckets.
+QHash<QString, QString> s_pool;
+
+} // anonymous namespace
+
+//static
+QString StringInterner::intern(const QString& value) {
+    if (value.isEmpty()) {
+        return value;
+    }
+    const QT_MUTEX_LOCKER locked(&s_poolMutex);
+    const auto it = s_pool.constFind(value);
+    if (it != s_pool.constEnd()) {
+        return it.value();
+    }
+    if (s_pool.size() >= kMaxPoolSize) {
+        s_pool.clear();
+    }
+    s_pool.insert(value, value);
+    return value;
+}
+
+//static
+int StringInterner::count() {
+    const QT_MUTEX_LOCKER locked(&s_poolMutex);
+    return s_pool.size();
+}
+
+//static
+void StringInterner::clear() {
+    const QT_MUTEX_LOCKER locked(&s_poolMutex);
+    s_pool.clear();
+}
+
+} // namespace mixxx
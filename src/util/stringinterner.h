@@ -0,0 +1,43 @@
+#pragma once
+
+#include <QString>
+
+namespace mixxx {
+
+/// Process-wide interning pool for short, frequently repeated metadata
+/// strings like artist, album or genre names.
+///
+/// A library with hundreds of thousands of tracks stores the same artist
+/// and album values over and over, both in the Track/TrackRecord objects
+/// hydrated by TrackDAO and in the row cache of BaseTrackCache. Routing
+/// those values through intern() makes all repeated occurrences share a
+/// single allocation.
+///
+/// Since QString is implicitly shared, copy-on-write semantics are fully
+/// preserved: assigning or editing an interned string detaches it from
+/// the pool without affecting any other holder.
+class StringInterner {
+  public:
+    StringInterner() = delete;
+
+    /// Returns a copy of value that shares its storage with all other
+    /// interned copies of the same string. Null and empty strings are
+    /// returned unchanged, they already share Qt's global empty string
+    /// data.
+    ///
+    /// Thread-safe.
+    static QString intern(const QString& value);
+
+    /// The number of distinct strings currently held by the pool.
+    ///
+    /// Thread-safe.
+    static int count();
+
+    /// Drops all pooled strings. Shared copies handed out earlier remain
+    /// valid and keep their storage alive until the last holder is gone.
+    ///
+    /// Thread-safe.
+    static void clear();
+};
+
+} // namespace mixxx
@@ -0,0 +1,150 @@
+#include "util/threadtopology.h"
+
+#include <QtGlobal>
+
+#ifdef Q_OS_LINUX
+#include <sched.h>
+#include <unistd.h>
+
+#include <cerrno>
+
+#include <QFile>
+#include <QString>
+#include <vector>
+#endif
+
+#include "util/logger.h"
+
+namespace {
+
+mixxx::Logger kLogger("ThreadTopology");
+
+#ifdef Q_OS_LINUX
+
+struct CpuTopology {
+    cpu_set_t performanceCores;
+    cpu_set_t efficiencyCores;
+    int numPerformanceCores = 0;
+    int numEfficiencyCores = 0;
+};
+
+/// Read the maximum frequency of a single core in kHz, or 0 for
+/// offline cores and cores without cpufreq support.
+long readMaxFreqKhz(long cpu) {
+    QFile file(QStringLiteral(
+            "/sys/devices/system/cpu/cpu%1/cpufreq/cpuinfo_max_freq")
+                       .arg(cpu));
+    if (!file.open(QIODevice::ReadOnly)) {
+        return 0;
+    }
+    return file.readAll().trimmed().toLong();
+}
+
+/// Classify the online cores by their maximum frequency: on hybrid
+/// CPUs (Intel P/E-cores, ARM big.LITTLE) the performance cores clock
+/// higher than the efficiency cores, which is also how the kernel
+/// derives its capacity-aware scheduling domains. When all cores
+/// report the same maximum frequency the topology is homogeneous and
+/// both sets stay empty.
+CpuTopology detectTopology() {
+    CpuTopology topology;
+    CPU_ZERO(&topology.performanceCores);
+    CPU_ZERO(&topology.efficiencyCores);
+
+    const long numCpus = sysconf(_SC_NPROCESSORS_CONF);
+    if (numCpus < 2 || numCpus > CPU_SETSIZE) {
+        return topology;
+    }
+
+    std::vector<long> maxFreqKhz(numCpus);
+    long highestFreqKhz = 0;
+    for (long cpu = 0; cpu < numCpus; ++cpu) {
+        maxFreqKhz[cpu] = readMaxFreqKhz(cpu);
+        if (maxFreqKhz[cpu] > highestFreqKhz) {
+            highestFreqKhz = maxFreqKhz[cpu];
+        }
+    }
+    if (highestFreqKhz <= 0) {
+        return topology;
+    }
+
+    for (long cpu = 0; cpu < numCpus; ++cpu) {
+        if (maxFreqKhz[cpu] <= 0) {
+            // Offline or unknown, not eligible for pinning
+            continue;
+        }
+        if (maxFreqKhz[cpu] == highestFreqKhz) {
+            CPU_SET(cpu, &topology.performanceCores);
+            ++topology.numPerformanceCores;
+        } else {
+            CPU_SET(cpu, &topology.efficiencyCores);
+            ++topology.numEfficiencyCores;
+        }
+    }
+
+    if (topology.numEfficiencyCores == 0) {
+        // Homogeneous topology, pinning would only restrict the
+        // scheduler without any benefit.
+        CPU_ZERO(&topology.performanceCores);
+        topology.numPerformanceCores = 0;
+        kLogger.debug() << "Homogeneous CPU topology detected,"
+                        << "thread pinning disabled";
+    } else {
+        kLogger.info() << "Hybrid CPU topology detected:"
+                       << topology.numPerformanceCores << "performance and"
+                       << topology.numEfficiencyCores << "efficiency cores";
+    }
+    return topology;
+}
+
+const CpuTopology& cpuTopology() {
+    static const CpuTopology s_topology = detectTopology();
+    return s_topology;
+}
+
+#endif // Q_OS_LINUX
+
+} // anonymous namespace
+
+namespace mixxx {
+
+namespace ThreadTopology {
+
+int coreCount(CoreClass coreClass) {
+#ifdef Q_OS_LINUX
+    const CpuTopology& topology = cpuTopology();
+    return coreClass == CoreClass::Performance
+            ? topology.numPerformanceCores
+            : topology.numEfficiencyCores;
+#else
+    // Neither macOS nor Windows expose a portable thread affinity API
+    // that is safe to combine with their own hybrid-aware schedulers,
+    // so thread placement is left to the OS there.
+    Q_UNUSED(coreClass);
+    return 0;
+#endif
+}
+
+bool pinCurrentThread(CoreClass coreClass) {
+    if (coreCount(coreClass) == 0) {
+        return false;
+    }
+#ifdef Q_OS_LINUX
+    const CpuTopology& topology = cpuTopology();
+    const cpu_set_t& cores = coreClass == CoreClass::Performance
+            ? topology.performanceCores
+            : topology.efficiencyCores;
+    if (sched_setaffinity(0, sizeof(cores), &cores) != 0) {
+        kLogger.warning()
+                << "Failed to set thread affinity:" << errno;
+        return false;
+    }
+    return true;
+#else
+    return false;
+#endif
+}
+
+} // namespace ThreadTopology
+
+} // namespace mixxx
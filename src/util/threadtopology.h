@@ -0,0 +1,34 @@
+#pragma once
+
+/// Placement of threads on heterogeneous (hybrid) CPU topologies.
+///
+/// On hybrid CPUs the scheduler is free to migrate threads between
+/// performance and efficiency cores. For the real-time audio callback
+/// such a migration mid-set can cause audible dropouts, while batch
+/// workers like track analysis needlessly occupy performance cores.
+/// These helpers classify the online cores once and allow threads to
+/// opt into one of the two classes. On homogeneous CPUs and on
+/// platforms without a thread affinity API they are no-ops.
+
+namespace mixxx {
+
+namespace ThreadTopology {
+
+enum class CoreClass {
+    Performance,
+    Efficiency,
+};
+
+/// Number of online cores of the given class, or 0 when the topology
+/// is homogeneous or unknown.
+int coreCount(CoreClass coreClass);
+
+/// Pin the calling native thread to all cores of the given class.
+/// Returns false when the platform has no thread affinity support,
+/// the topology is homogeneous, or the kernel rejected the mask; the
+/// thread then keeps its inherited affinity.
+bool pinCurrentThread(CoreClass coreClass);
+
+} // namespace ThreadTopology
+
+} // namespace mixxx
@@ -12,6 +12,10 @@
 
 static constexpr Stat::ComputeFlags kDefaultComputeFlags = Stat::COUNT | Stat::SUM | Stat::AVERAGE |
         Stat::MAX | Stat::MIN | Stat::SAMPLE_VARIANCE;
+// For timers whose tail latency matters (e.g. the audio callback), so
+// that p99/p999 can be estimated from the collected buckets.
+static constexpr Stat::ComputeFlags kHistogramComputeFlags =
+        kDefaultComputeFlags | Stat::BUCKET_HISTOGRAM;
 
 // A Timer that is instrumented for reporting elapsed times to StatsManager
 // under a certain key. Construct with custom compute flags to get custom values
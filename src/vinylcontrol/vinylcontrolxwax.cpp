@@ -8,6 +8,7 @@
 #include "moc_vinylcontrolxwax.cpp"
 #include "util/defs.h"
 #include "util/math.h"
+#include "util/sample.h"
 #include "util/timer.h"
 #include "vinylcontrol/defs_vinylcontrol.h"
 #include "vinylcontrol/steadypitch.h"
@@ -250,18 +251,13 @@ void VinylControlXwax::analyzeSamples(CSAMPLE* pSamples, size_t nFrames) {
         m_workBufferSize = samplesSize;
     }
 
-    // Convert CSAMPLE samples to shorts, preventing overflow.
-    for (int i = 0; i < static_cast<int>(samplesSize); ++i) {
-        CSAMPLE sample = pSamples[i] * gain * SAMPLE_MAXIMUM;
-
-        if (sample > SAMPLE_MAXIMUM) {
-            m_pWorkBuffer[i] = SAMPLE_MAXIMUM;
-        } else if (sample < SAMPLE_MINIMUM) {
-            m_pWorkBuffer[i] = SAMPLE_MINIMUM;
-        } else {
-            m_pWorkBuffer[i] = static_cast<short>(sample);
-        }
-    }
+    // Convert CSAMPLE samples to shorts, preventing overflow. The vectorized
+    // conversion scales by -SAMPLE_MINIMUM instead of SAMPLE_MAXIMUM, which
+    // is irrelevant for the threshold-based timecode decoding.
+    SampleUtil::convertFloat32ToS16WithGain(m_pWorkBuffer.data(),
+            pSamples,
+            gain,
+            static_cast<SINT>(samplesSize));
 
     // Submit the samples to the xwax timecode processor. The size argument is
     // in stereo frames.
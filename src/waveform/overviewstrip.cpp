@@ -0,0 +1,87 @@
+#include "waveform/overviewstrip.h"
+
+#include "util/math.h"
+#include "waveform/renderers/waveformoverviewrenderer.h"
+
+namespace mixxx {
+
+QByteArray makeOverviewStrip(ConstWaveformPointer pWaveform) {
+    if (!pWaveform) {
+        return QByteArray();
+    }
+    const int numFrames = pWaveform->getDataSize() / 2;
+    if (numFrames <= 0) {
+        return QByteArray();
+    }
+
+    QByteArray strip(kOverviewStripNumBytes, '\0');
+    unsigned char* pStripData = reinterpret_cast<unsigned char*>(strip.data());
+    for (int column = 0; column < kOverviewStripLength; ++column) {
+        int firstFrame = static_cast<int>(
+                static_cast<qint64>(column) * numFrames / kOverviewStripLength);
+        firstFrame = math_min(firstFrame, numFrames - 1);
+        int endFrame = static_cast<int>(static_cast<qint64>(column + 1) *
+                numFrames / kOverviewStripLength);
+        endFrame = math_clamp(endFrame, firstFrame + 1, numFrames);
+        const WaveformSummaryData bandMax =
+                pWaveform->absMaxBandsInRange(firstFrame, endFrame);
+        // Fold the channels into mono, matching the mono rendering of
+        // the library's overview column.
+        unsigned char* pColumn = pStripData + column * kOverviewStripBytesPerColumn;
+        pColumn[0] = math_max(bandMax.all[Left], bandMax.all[Right]);
+        pColumn[1] = math_max(bandMax.low[Left], bandMax.low[Right]);
+        pColumn[2] = math_max(bandMax.mid[Left], bandMax.mid[Right]);
+        pColumn[3] = math_max(bandMax.high[Left], bandMax.high[Right]);
+    }
+    return strip;
+}
+
+QImage renderOverviewStrip(const QByteArray& strip,
+        OverviewType type,
+        const WaveformSignalColors& signalColors) {
+    if (strip.size() != kOverviewStripNumBytes) {
+        return QImage();
+    }
+
+    // Expand the strip into a minimal stereo waveform and reuse the
+    // overview renderer, so that strips are visually indistinguishable
+    // from overviews rendered from the full waveform summary. With only
+    // kOverviewStripLength frames this is orders of magnitude cheaper
+    // than deserializing the summary it was made from.
+    WaveformPointer pWaveform(new Waveform(
+            /*audioSampleRate*/ 1,
+            /*frameLength*/ kOverviewStripLength,
+            /*desiredVisualSampleRate*/ 1,
+            /*maxVisualSamples*/ -1,
+            /*stemCount*/ 0));
+    const int numFrames = pWaveform->getDataSize() / 2;
+    VERIFY_OR_DEBUG_ASSERT(numFrames >= kOverviewStripLength) {
+        return QImage();
+    }
+    const unsigned char* pStripData =
+            reinterpret_cast<const unsigned char*>(strip.constData());
+    WaveformData* pWaveformData = pWaveform->data();
+    for (int frame = 0; frame < numFrames; ++frame) {
+        // The constructor may round the frame count up, repeat the last
+        // column for the padding frames.
+        const int column = math_min(frame, kOverviewStripLength - 1);
+        const unsigned char* pColumn =
+                pStripData + column * kOverviewStripBytesPerColumn;
+        for (int channel = 0; channel < ChannelCount; ++channel) {
+            WaveformFilteredData& filtered =
+                    pWaveformData[frame * 2 + channel].filtered;
+            filtered.all = pColumn[0];
+            filtered.low = pColumn[1];
+            filtered.mid = pColumn[2];
+            filtered.high = pColumn[3];
+        }
+    }
+    pWaveform->setCompletion(pWaveform->getDataSize());
+
+    return waveformOverviewRenderer::render(pWaveform,
+            type,
+            signalColors,
+            true /* mono, bottom-aligned */);
+}
+
+} // namespace mixxx
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <QByteArray>
+#include <QImage>
+
+#include "waveform/overviewtype.h"
+#include "waveform/waveform.h"
+
+class WaveformSignalColors;
+
+/// Compact per-track overview format for the library's overview column.
+///
+/// A strip is a fixed number of columns with the quantized band maxima
+/// (all/low/mid/high, one byte each) of the mono-folded waveform summary,
+/// i.e. 400 bytes per track. Unlike the full waveform summary the strips
+/// of the whole library can be bulk-loaded from a single database table
+/// into one packed array, so that library rows can be painted without
+/// loading and deserializing any per-track analysis files.
+
+namespace mixxx {
+
+/// Number of columns of a strip. More than the ~50-150 px that the
+/// library column is typically wide would only add dead weight.
+constexpr int kOverviewStripLength = 100;
+
+/// Bytes per column: all/low/mid/high.
+constexpr int kOverviewStripBytesPerColumn = 4;
+
+/// Total size of a serialized strip in bytes.
+constexpr int kOverviewStripNumBytes =
+        kOverviewStripLength * kOverviewStripBytesPerColumn;
+
+/// Version tag stored with each strip in the database. Bump when the
+/// serialized format changes; strips with a stale version are ignored
+/// and regenerated on demand.
+constexpr int kOverviewStripVersion = 1;
+
+/// Downsamples the given waveform (summary) into a strip. Returns an
+/// empty array for empty waveforms.
+QByteArray makeOverviewStrip(ConstWaveformPointer pWaveform);
+
+/// Renders a strip into the normalized fullsize overview image, visually
+/// equivalent to rendering the waveform summary the strip was made from.
+/// Returns a null image for invalid strip data.
+QImage renderOverviewStrip(const QByteArray& strip,
+        OverviewType type,
+        const WaveformSignalColors& signalColors);
+
+} // namespace mixxx
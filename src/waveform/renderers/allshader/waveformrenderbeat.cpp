@@ -1,10 +1,11 @@
 #include "waveform/renderers/allshader/waveformrenderbeat.h"
 
 #include <QDomNode>
+#include <QVector2D>
 
 #include "moc_waveformrenderbeat.cpp"
 #include "rendergraph/geometry.h"
-#include "rendergraph/material/unicolormaterial.h"
+#include "rendergraph/material/offsetunicolormaterial.h"
 #include "rendergraph/vertexupdaters/vertexupdater.h"
 #include "skin/legacy/skincontext.h"
 #include "track/track.h"
@@ -18,8 +19,14 @@ namespace allshader {
 WaveformRenderBeat::WaveformRenderBeat(WaveformWidgetRenderer* waveformWidget,
         ::WaveformRendererAbstract::PositionSource type)
         : ::WaveformRendererAbstract(waveformWidget),
-          m_isSlipRenderer(type == ::WaveformRendererAbstract::Slip) {
-    initForRectangles<UniColorMaterial>(0);
+          m_isSlipRenderer(type == ::WaveformRendererAbstract::Slip),
+          m_epochAudioSamplePerPixel(0.0),
+          m_epochDevicePixelRatio(0.f),
+          m_epochBreadth(0.f),
+          m_epochStartSamplePosition(0.0),
+          m_epochEndSamplePosition(0.0),
+          m_epochValid(false) {
+    initForRectangles<OffsetUniColorMaterial>(0);
     setUsePreprocess(true);
 }
 
@@ -36,6 +43,7 @@ void WaveformRenderBeat::draw(QPainter* painter, QPaintEvent* event) {
 
 void WaveformRenderBeat::preprocess() {
     if (!preprocessInner()) {
+        m_epochValid = false;
         geometry().allocate(0);
         markDirtyGeometry();
     }
@@ -92,45 +100,86 @@ bool WaveformRenderBeat::preprocessInner() {
 
     const float rendererBreadth = m_waveformRenderer->getBreadth();
 
-    const int numVerticesPerLine = 6; // 2 triangles
-
-    // Count the number of beats in the range to reserve space in the m_vertices vector.
-    // Note that we could also use
-    //   int numBearsInRange = trackBeats->numBeatsInRange(startPosition, endPosition);
-    // for this, but there have been reports of that method failing with a DEBUG_ASSERT.
-    int numBeatsInRange = 0;
-    for (auto it = trackBeats->iteratorFrom(startPosition);
-            it != trackBeats->cend() && *it <= endPosition;
-            ++it) {
-        numBeatsInRange++;
+    const double audioSamplePerPixel = m_waveformRenderer->getAudioSamplePerPixel();
+    if (audioSamplePerPixel <= 0.0) {
+        return false;
     }
 
-    const int reserved = numBeatsInRange * numVerticesPerLine;
-    geometry().allocate(reserved);
-
-    VertexUpdater vertexUpdater{geometry().vertexDataAs<Geometry::Point2D>()};
-
-    for (auto it = trackBeats->iteratorFrom(startPosition);
-            it != trackBeats->cend() && *it <= endPosition;
-            ++it) {
-        double beatPosition = it->toEngineSamplePos();
-        double xBeatPoint =
-                m_waveformRenderer->transformSamplePositionInRendererWorld(
-                        beatPosition, positionType);
-
-        xBeatPoint = qRound(xBeatPoint * devicePixelRatio) / devicePixelRatio;
-
-        const float x1 = static_cast<float>(xBeatPoint);
-        const float x2 = x1 + 1.f;
+    const double startSamplePosition = firstDisplayedPosition * trackSamples;
+    const double endSamplePosition = lastDisplayedPosition * trackSamples;
+
+    if (!m_epochValid ||
+            m_epochBeats != trackBeats ||
+            m_epochAudioSamplePerPixel != audioSamplePerPixel ||
+            m_epochDevicePixelRatio != devicePixelRatio ||
+            m_epochBreadth != rendererBreadth ||
+            startSamplePosition < m_epochStartSamplePosition ||
+            endSamplePosition > m_epochEndSamplePosition) {
+        // Rebuild the cached geometry. Cover the displayed range plus one
+        // viewport of margin on both sides, so that scrolling at constant
+        // zoom does not require a rebuild on every frame.
+        const double marginSamples = endSamplePosition - startSamplePosition;
+        m_epochBeats = trackBeats;
+        m_epochAudioSamplePerPixel = audioSamplePerPixel;
+        m_epochDevicePixelRatio = devicePixelRatio;
+        m_epochBreadth = rendererBreadth;
+        m_epochStartSamplePosition = startSamplePosition - marginSamples;
+        m_epochEndSamplePosition = endSamplePosition + marginSamples;
+        m_epochValid = true;
+
+        const auto epochStartPosition = mixxx::audio::FramePos::fromEngineSamplePos(
+                m_epochStartSamplePosition);
+        const auto epochEndPosition = mixxx::audio::FramePos::fromEngineSamplePos(
+                m_epochEndSamplePosition);
+
+        const int numVerticesPerLine = 6; // 2 triangles
+
+        // Count the number of beats in the range to reserve space in the m_vertices vector.
+        // Note that we could also use
+        //   int numBearsInRange = trackBeats->numBeatsInRange(startPosition, endPosition);
+        // for this, but there have been reports of that method failing with a DEBUG_ASSERT.
+        int numBeatsInRange = 0;
+        for (auto it = m_beatCursor.iteratorFrom(trackBeats, epochStartPosition);
+                it != trackBeats->cend() && *it <= epochEndPosition;
+                ++it) {
+            numBeatsInRange++;
+        }
+
+        const int reserved = numBeatsInRange * numVerticesPerLine;
+        geometry().allocate(reserved);
+
+        VertexUpdater vertexUpdater{geometry().vertexDataAs<Geometry::Point2D>()};
+
+        for (auto it = m_beatCursor.iteratorFrom(trackBeats, epochStartPosition);
+                it != trackBeats->cend() && *it <= epochEndPosition;
+                ++it) {
+            const double beatPosition = it->toEngineSamplePos();
+            // Position relative to the epoch start. The per-frame offset
+            // uniform translates this into the renderer world. Both the
+            // relative position and the offset are snapped to the device
+            // pixel grid, so their sum stays on that grid, too.
+            double xBeatPoint = (beatPosition - m_epochStartSamplePosition) /
+                    2 / audioSamplePerPixel;
+
+            xBeatPoint = qRound(xBeatPoint * devicePixelRatio) / devicePixelRatio;
+
+            const float x1 = static_cast<float>(xBeatPoint);
+            const float x2 = x1 + 1.f;
+
+            vertexUpdater.addRectangle({x1, 0.f},
+                    {x2, m_isSlipRenderer ? rendererBreadth / 2 : rendererBreadth});
+        }
+        markDirtyGeometry();
 
-        vertexUpdater.addRectangle({x1, 0.f},
-                {x2, m_isSlipRenderer ? rendererBreadth / 2 : rendererBreadth});
+        DEBUG_ASSERT(reserved == vertexUpdater.index());
     }
-    markDirtyGeometry();
 
-    DEBUG_ASSERT(reserved == vertexUpdater.index());
+    double offsetX = (m_epochStartSamplePosition - startSamplePosition) /
+            2 / audioSamplePerPixel;
+    offsetX = qRound(offsetX * devicePixelRatio) / devicePixelRatio;
 
     material().setUniform(1, m_color);
+    material().setUniform(2, QVector2D(static_cast<float>(offsetX), 0.f));
     markDirtyMaterial();
 
     return true;
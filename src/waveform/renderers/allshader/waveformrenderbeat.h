@@ -3,6 +3,7 @@
 #include <QColor>
 
 #include "rendergraph/geometrynode.h"
+#include "track/beats.h"
 #include "util/class.h"
 #include "waveform/renderers/waveformrendererabstract.h"
 
@@ -40,6 +41,24 @@ class allshader::WaveformRenderBeat final
     QColor m_color;
     bool m_isSlipRenderer;
 
+    // Cached beat-line geometry ("epoch"). The vertices cover the displayed
+    // range plus one viewport of margin on both sides and are positioned
+    // relative to m_epochStartSamplePosition. They are only rebuilt when the
+    // beats, the zoom or the widget size change, or when the displayed range
+    // leaves the covered range. While scrolling at constant zoom only the
+    // offset uniform of the material is updated per frame.
+    mixxx::BeatsPointer m_epochBeats;
+    double m_epochAudioSamplePerPixel;
+    float m_epochDevicePixelRatio;
+    float m_epochBreadth;
+    double m_epochStartSamplePosition;
+    double m_epochEndSamplePosition;
+    bool m_epochValid;
+
+    // Caches the beat interval of the last epoch rebuild, so consecutive
+    // rebuilds while scrolling do not search the beats from scratch
+    mixxx::Beats::Cursor m_beatCursor;
+
     bool preprocessInner();
 
     DISALLOW_COPY_AND_ASSIGN(WaveformRenderBeat);
@@ -26,6 +26,7 @@ void WaveformRendererFiltered::onSetup(const QDomNode&) {
 
 void WaveformRendererFiltered::preprocess() {
     if (!preprocessInner()) {
+        invalidatePreprocessState();
         if (geometry().vertexCount() != 0) {
             geometry().allocate(0);
             markDirtyGeometry();
@@ -87,6 +88,23 @@ bool WaveformRendererFiltered::preprocessInner() {
     const float breadth = static_cast<float>(m_waveformRenderer->getBreadth());
     const float halfBreadth = breadth / 2.0f;
 
+    if (!updatePreprocessState({data,
+                dataSize,
+                firstVisualFrame,
+                lastVisualFrame,
+                allGain,
+                bandGain[0],
+                bandGain[1],
+                bandGain[2],
+                length,
+                breadth,
+                devicePixelRatio})) {
+        // Nothing that affects the vertex data has changed since the
+        // last frame (e.g. the deck is paused). The geometry uploaded
+        // previously is still valid.
+        return true;
+    }
+
     const float heightFactor = allGain * halfBreadth / m_maxValue;
 
     // Effective visual frame for x
@@ -24,6 +24,7 @@ void WaveformRendererHSV::onSetup(const QDomNode&) {
 
 void WaveformRendererHSV::preprocess() {
     if (!preprocessInner()) {
+        invalidatePreprocessState();
         if (geometry().vertexCount() != 0) {
             geometry().allocate(0);
             markDirtyGeometry();
@@ -88,6 +89,23 @@ bool WaveformRendererHSV::preprocessInner() {
     const float breadth = static_cast<float>(m_waveformRenderer->getBreadth());
     const float halfBreadth = breadth / 2.0f;
 
+    if (!updatePreprocessState({data,
+                dataSize,
+                firstVisualFrame,
+                lastVisualFrame,
+                allGain,
+                lowGain,
+                midGain,
+                highGain,
+                length,
+                breadth,
+                devicePixelRatio})) {
+        // Nothing that affects the vertex data has changed since the
+        // last frame (e.g. the deck is paused). The geometry uploaded
+        // previously is still valid.
+        return true;
+    }
+
     const float heightFactor = allGain * halfBreadth / m_maxValue;
 
     // Effective visual frame for x
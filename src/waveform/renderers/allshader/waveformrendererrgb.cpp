@@ -27,6 +27,7 @@ void WaveformRendererRGB::onSetup(const QDomNode&) {
 
 void WaveformRendererRGB::preprocess() {
     if (!preprocessInner()) {
+        invalidatePreprocessState();
         if (geometry().vertexCount() != 0) {
             geometry().allocate(0);
             markDirtyGeometry();
@@ -98,19 +99,40 @@ bool WaveformRendererRGB::preprocessInner() {
     const float breadth = static_cast<float>(m_waveformRenderer->getBreadth());
     const float halfBreadth = breadth / 2.0f;
 
+    if (!updatePreprocessState({data,
+                dataSize,
+                firstVisualFrame,
+                lastVisualFrame,
+                allGain,
+                lowGain,
+                midGain,
+                highGain,
+                length,
+                breadth,
+                devicePixelRatio})) {
+        // Nothing that affects the vertex data has changed since the
+        // last frame (e.g. the deck is paused). The geometry uploaded
+        // previously is still valid.
+        return true;
+    }
+
     const float heightFactorAbs = allGain * halfBreadth / m_maxValue;
     const float heightFactor[2] = {-heightFactorAbs, heightFactorAbs};
     const bool splitLeftRight = m_options & ::WaveformRendererSignalBase::Option::SplitStereoSignal;
 
-    const float low_r = static_cast<float>(m_rgbLowColor_r);
-    const float mid_r = static_cast<float>(m_rgbMidColor_r);
-    const float high_r = static_cast<float>(m_rgbHighColor_r);
-    const float low_g = static_cast<float>(m_rgbLowColor_g);
-    const float mid_g = static_cast<float>(m_rgbMidColor_g);
-    const float high_g = static_cast<float>(m_rgbHighColor_g);
-    const float low_b = static_cast<float>(m_rgbLowColor_b);
-    const float mid_b = static_cast<float>(m_rgbMidColor_b);
-    const float high_b = static_cast<float>(m_rgbHighColor_b);
+    // Rebuilds the palette only when the gains or colors have changed
+    m_bandPalette.update(lowGain,
+            midGain,
+            highGain,
+            m_rgbLowColor_r,
+            m_rgbLowColor_g,
+            m_rgbLowColor_b,
+            m_rgbMidColor_r,
+            m_rgbMidColor_g,
+            m_rgbMidColor_b,
+            m_rgbHighColor_r,
+            m_rgbHighColor_g,
+            m_rgbHighColor_b);
 
     // Effective visual frame for x
     double xVisualFrame = qRound(firstVisualFrame / visualIncrementPerPixel) *
@@ -141,12 +163,14 @@ bool WaveformRendererRGB::preprocessInner() {
         const int visualFrameStart = std::lround(xVisualFrame - maxSamplingRange);
         const int visualFrameStop = std::lround(xVisualFrame + maxSamplingRange);
 
-        const int visualIndexStart = std::max(visualFrameStart * 2, 0);
-        const int visualIndexStop =
-                std::min(std::max(visualFrameStop, visualFrameStart + 1) * 2, dataSize - 1);
-
         const float fpos = static_cast<float>(pos) * invDevicePixelRatio;
 
+        // Per-channel maxima of each band over the frames covered by this
+        // pixel. Reads the decimated summary pyramid shared by all widgets
+        // that display this waveform instead of scanning every raw frame.
+        const WaveformSummaryData maxBands = waveform->absMaxBandsInRange(
+                visualFrameStart, std::max(visualFrameStop, visualFrameStart + 1));
+
         // Find the max values for low, mid, high and all in the waveform data.
         // - Max of left and right
         uchar u8maxLow[2]{};
@@ -154,20 +178,20 @@ bool WaveformRendererRGB::preprocessInner() {
         uchar u8maxHigh[2]{};
         // - Per channel
         uchar u8maxAllChn[2]{};
-        for (int chn = 0; chn < 2; chn++) {
-            // In case we don't render individual color per channel, we use only
-            // the first field of the arrays to perform signal max
-            int signalChn = splitLeftRight ? chn : 0;
-            // data is interleaved left / right
-            for (int i = visualIndexStart + chn; i < visualIndexStop + chn; i += 2) {
-                const WaveformData& waveformData = data[i];
-
-                u8maxLow[signalChn] = math_max(u8maxLow[signalChn], waveformData.filtered.low);
-                u8maxMid[signalChn] = math_max(u8maxMid[signalChn], waveformData.filtered.mid);
-                u8maxHigh[signalChn] = math_max(u8maxHigh[signalChn], waveformData.filtered.high);
-                u8maxAllChn[signalChn] = math_max(
-                        u8maxAllChn[signalChn], waveformData.filtered.all);
+        if (splitLeftRight) {
+            for (int chn = 0; chn < 2; chn++) {
+                u8maxLow[chn] = maxBands.low[chn];
+                u8maxMid[chn] = maxBands.mid[chn];
+                u8maxHigh[chn] = maxBands.high[chn];
+                u8maxAllChn[chn] = maxBands.all[chn];
             }
+        } else {
+            // In case we don't render individual color per channel, we use
+            // only the first field of the arrays to perform signal max
+            u8maxLow[0] = math_max(maxBands.low[0], maxBands.low[1]);
+            u8maxMid[0] = math_max(maxBands.mid[0], maxBands.mid[1]);
+            u8maxHigh[0] = math_max(maxBands.high[0], maxBands.high[1]);
+            u8maxAllChn[0] = math_max(maxBands.all[0], maxBands.all[1]);
         }
         float maxAllChn[2]{static_cast<float>(u8maxAllChn[0]), static_cast<float>(u8maxAllChn[1])};
 
@@ -178,26 +202,27 @@ bool WaveformRendererRGB::preprocessInner() {
         for (int chn = 0;
                 chn < (splitLeftRight && !m_isSlipRenderer ? 2 : 1);
                 chn++) {
-            // Cast to float
-            float maxLowU = static_cast<float>(u8maxLow[chn]);
-            float maxMidU = static_cast<float>(u8maxMid[chn]);
-            float maxHighU = static_cast<float>(u8maxHigh[chn]);
-
-            // Apply the gains
-            float maxLow = maxLowU * lowGain;
-            float maxMid = maxMidU * midGain;
-            float maxHigh = maxHighU * highGain;
-
-            float allUnscaled = maxLowU + maxMidU + maxHighU;
+            // Look up the gained band magnitudes and their weighted color
+            // contributions instead of recomputing them with float math
+            // for every column
+            const WaveformRgbBandPalette::Entry& lowEntry =
+                    m_bandPalette.low(u8maxLow[chn]);
+            const WaveformRgbBandPalette::Entry& midEntry =
+                    m_bandPalette.mid(u8maxMid[chn]);
+            const WaveformRgbBandPalette::Entry& highEntry =
+                    m_bandPalette.high(u8maxHigh[chn]);
+
+            const float allUnscaled = static_cast<float>(
+                    u8maxLow[chn] + u8maxMid[chn] + u8maxHigh[chn]);
             float eqGain = 1.0f;
             if (allUnscaled > 0.0f) {
-                eqGain = (maxLow + maxMid + maxHigh) / allUnscaled;
+                eqGain = (lowEntry.gained + midEntry.gained + highEntry.gained) /
+                        allUnscaled;
             }
 
-            // Use the gained maxLow, maxMid and maxHigh values to calculate the color components
-            float red = maxLow * low_r + maxMid * mid_r + maxHigh * high_r;
-            float green = maxLow * low_g + maxMid * mid_g + maxHigh * high_g;
-            float blue = maxLow * low_b + maxMid * mid_b + maxHigh * high_b;
+            float red = lowEntry.red + midEntry.red + highEntry.red;
+            float green = lowEntry.green + midEntry.green + highEntry.green;
+            float blue = lowEntry.blue + midEntry.blue + highEntry.blue;
 
             // Normalize the color components using the maximum of the three
             const float maxComponent = math_max3(red, green, blue);
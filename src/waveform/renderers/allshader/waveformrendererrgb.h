@@ -3,6 +3,7 @@
 #include "rendergraph/geometrynode.h"
 #include "util/class.h"
 #include "waveform/renderers/allshader/waveformrenderersignalbase.h"
+#include "waveform/renderers/waveformrgbbandpalette.h"
 
 namespace allshader {
 class WaveformRendererRGB;
@@ -31,6 +32,7 @@ class allshader::WaveformRendererRGB final
   private:
     bool m_isSlipRenderer;
     ::WaveformRendererSignalBase::Options m_options;
+    WaveformRgbBandPalette m_bandPalette;
 
     bool preprocessInner();
 
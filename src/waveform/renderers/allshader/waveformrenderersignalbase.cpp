@@ -16,26 +16,31 @@ void WaveformRendererSignalBase::draw(QPainter*, QPaintEvent*) {
 
 void WaveformRendererSignalBase::setAxesColor(const QColor& axesColor) {
     getRgbF(axesColor, &m_axesColor_r, &m_axesColor_g, &m_axesColor_b, &m_axesColor_a);
+    invalidatePreprocessState();
 }
 
 void WaveformRendererSignalBase::setColor(const QColor& color) {
     getRgbF(color, &m_signalColor_r, &m_signalColor_g, &m_signalColor_b);
     getHsvF(color, &m_signalColor_h, &m_signalColor_s, &m_signalColor_v);
+    invalidatePreprocessState();
 }
 
 void WaveformRendererSignalBase::setLowColor(const QColor& lowColor) {
     getRgbF(lowColor, &m_rgbLowColor_r, &m_rgbLowColor_g, &m_rgbLowColor_b);
     getRgbF(lowColor, &m_lowColor_r, &m_lowColor_g, &m_lowColor_b);
+    invalidatePreprocessState();
 }
 
 void WaveformRendererSignalBase::setMidColor(const QColor& midColor) {
     getRgbF(midColor, &m_rgbMidColor_r, &m_rgbMidColor_g, &m_rgbMidColor_b);
     getRgbF(midColor, &m_midColor_r, &m_midColor_g, &m_midColor_b);
+    invalidatePreprocessState();
 }
 
 void WaveformRendererSignalBase::setHighColor(const QColor& highColor) {
     getRgbF(highColor, &m_rgbHighColor_r, &m_rgbHighColor_g, &m_rgbHighColor_b);
     getRgbF(highColor, &m_highColor_r, &m_highColor_g, &m_highColor_b);
+    invalidatePreprocessState();
 }
 
 } // namespace allshader
@@ -8,6 +8,7 @@
 #include "waveform/renderers/waveformrenderersignalbase.h"
 
 class WaveformWidgetRenderer;
+struct WaveformData;
 
 namespace allshader {
 class WaveformRendererSignalBase;
@@ -35,10 +36,56 @@ class allshader::WaveformRendererSignalBase : public ::WaveformRendererSignalBas
 
     void setIgnoreStem(bool value) {
         m_ignoreStem = value;
+        invalidatePreprocessState();
     }
 
   protected:
+    // Fingerprint of the inputs that determine the vertex data
+    // generated by preprocess(). While the fingerprint is unchanged
+    // (e.g. on a paused deck, or when the display refresh rate exceeds
+    // the rate of position updates) the geometry uploaded for the
+    // previous frame is still valid and the rebuild can be skipped
+    // entirely. Color changes are tracked separately by the setters
+    // above.
+    struct PreprocessState {
+        const WaveformData* data;
+        int dataSize;
+        double firstVisualFrame;
+        double lastVisualFrame;
+        float allGain;
+        float lowGain;
+        float midGain;
+        float highGain;
+        int length;
+        float breadth;
+        float devicePixelRatio;
+
+        bool operator==(const PreprocessState&) const = default;
+    };
+
+    // Returns true and stores the fingerprint if it differs from the
+    // one of the last generated geometry, i.e. the vertex data has to
+    // be rebuilt.
+    bool updatePreprocessState(const PreprocessState& state) {
+        if (m_preprocessStateValid && state == m_lastPreprocessState) {
+            return false;
+        }
+        m_lastPreprocessState = state;
+        m_preprocessStateValid = true;
+        return true;
+    }
+
+    // Discards the stored fingerprint so that the next preprocess()
+    // call rebuilds the geometry unconditionally.
+    void invalidatePreprocessState() {
+        m_preprocessStateValid = false;
+    }
+
     bool m_ignoreStem;
 
+  private:
+    PreprocessState m_lastPreprocessState{};
+    bool m_preprocessStateValid{false};
+
     DISALLOW_COPY_AND_ASSIGN(WaveformRendererSignalBase);
 };
@@ -215,6 +215,14 @@ void WaveformRendererTextured::createFrameBuffers() {
             static_cast<int>(
                     m_waveformRenderer->getHeight() * devicePixelRatio);
 
+    if (bufferWidth <= 0 || bufferHeight <= 0) {
+        // The widget has not been resized to its final dimensions yet, e.g.
+        // when the node is initialized eagerly while the context is being
+        // set up. resizeGL will create the framebuffer once the dimensions
+        // are known.
+        return;
+    }
+
     m_framebuffer = std::make_unique<QOpenGLFramebufferObject>(bufferWidth,
             bufferHeight);
 
@@ -322,6 +330,12 @@ void WaveformRendererTextured::paintGL() {
         return;
     }
 
+    if (!m_framebuffer || !m_framebuffer->isValid()) {
+        // Framebuffer creation is deferred until the widget has been
+        // resized to its final dimensions, see createFrameBuffers().
+        return;
+    }
+
     // NOTE(vRince): completion can change during loadTexture
     // do not remove currentCompletion temp variable !
     const int currentCompletion = pWaveform->getCompletion();
@@ -1,6 +1,8 @@
 #include "waveform/renderers/allshader/waveformrendermark.h"
 
 #include <QPainterPath>
+#include <algorithm>
+#include <vector>
 
 #include "moc_waveformrendermark.cpp"
 #include "rendergraph/context.h"
@@ -124,6 +126,50 @@ class WaveformMarkNodeGraphics : public WaveformMark::Graphics {
     std::unique_ptr<rendergraph::BaseNode> m_pNode;
 };
 
+// Graphics for the marks themselves, which are drawn batched from a single
+// texture atlas. The rasterized image of the mark is kept here until it is
+// packed into the atlas (in updateMarkAtlasTexture), together with the
+// texture coordinates of the mark within the atlas.
+class WaveformMarkAtlasGraphics : public WaveformMark::Graphics {
+  public:
+    explicit WaveformMarkAtlasGraphics(QImage&& image) {
+        setImage(std::move(image));
+    }
+    void setImage(QImage&& image) {
+        m_image = std::move(image);
+        const auto devicePixelRatio = m_image.devicePixelRatio();
+        m_size = QSizeF(m_image.width() / devicePixelRatio,
+                m_image.height() / devicePixelRatio);
+    }
+    const QImage& image() const {
+        return m_image;
+    }
+    // The size of the mark in logical pixels
+    const QSizeF& size() const {
+        return m_size;
+    }
+    void setTexCoords(const QVector2D& min, const QVector2D& max) {
+        m_texCoordMin = min;
+        m_texCoordMax = max;
+    }
+    const QVector2D& texCoordMin() const {
+        return m_texCoordMin;
+    }
+    const QVector2D& texCoordMax() const {
+        return m_texCoordMax;
+    }
+
+  private:
+    QImage m_image;
+    QSizeF m_size;
+    QVector2D m_texCoordMin;
+    QVector2D m_texCoordMax;
+};
+
+// Transparent spacing between the mark images in the texture atlas, to
+// avoid sampling bleed from the adjacent mark with linear filtering.
+constexpr int kMarkAtlasSpacing{1};
+
 constexpr float kPlayPosWidth{11.f};
 constexpr float kPlayPosOffset{-(kPlayPosWidth - 1.f) / 2.f};
 
@@ -173,6 +219,17 @@ allshader::WaveformRenderMark::WaveformRenderMark(
     }
 
     {
+        // Single node that draws all marks as textured quads from the
+        // shared texture atlas
+        auto pNode = std::make_unique<GeometryNode>();
+        m_pMarkAtlasNode = pNode.get();
+        m_pMarkAtlasNode->initForRectangles<TextureMaterial>(0);
+        appendChildNode(std::move(pNode));
+    }
+
+    {
+        // Parent for the per-mark end nodes, which need an individual
+        // opacity and are therefore not drawn from the atlas
         auto pNode = std::make_unique<Node>();
         m_pMarkNodesParent = pNode.get();
         appendChildNode(std::move(pNode));
@@ -282,8 +339,8 @@ void allshader::WaveformRenderMark::update() {
         return;
     }
 
-    // For each WaveformMark we create a GeometryNode with Texture
-    // (in updateMarkImage). Of these GeometryNodes, we append the
+    // For each WaveformMark end we create a GeometryNode with Texture
+    // (in updateEndMarkImage). Of these GeometryNodes, we append the
     // the ones that need to be shown on screen as children to
     // m_pMarkNodesParent (transferring ownership).
     //
@@ -291,14 +348,17 @@ void allshader::WaveformRenderMark::update() {
     // from m_pMarkNodesParent and store each with their mark
     // (transferring ownership). Later in this function we move the
     // visible nodes back to m_pMarkNodesParent children.
+    //
+    // The marks themselves are drawn as quads from the shared texture
+    // atlas by m_pMarkAtlasNode and need no per-mark nodes.
     while (auto* pChild = m_pMarkNodesParent->firstChild()) {
         auto pNode = m_pMarkNodesParent->detachChildNode(pChild);
         WaveformMarkNode* pWaveformMarkNode = static_cast<WaveformMarkNode*>(pNode.get());
+        DEBUG_ASSERT(pWaveformMarkNode->m_isEndMark);
         // Determine its WaveformMark
         auto* pMark = pWaveformMarkNode->m_pOwner;
         auto* pGraphics = static_cast<WaveformMarkNodeGraphics*>(
-                pWaveformMarkNode->m_isEndMark ? pMark->m_pEndGraphics.get()
-                                               : pMark->m_pGraphics.get());
+                pMark->m_pEndGraphics.get());
         // Store the nodes with the WaveformMark
         pGraphics->attachNode(std::move(pNode));
     }
@@ -319,14 +379,41 @@ void allshader::WaveformRenderMark::update() {
 
     updatePlayPosMarkTexture(m_waveformRenderer->getContext());
 
-    // Generate initial node or update its texture if needed for each of
+    // Generate the initial image or update it if needed for each of
     // the WaveformMarks (in which case updateMarkImage is called)
-    // (Will create textures so requires OpenGL context)
     updateMarkImages();
+    if (!m_markAtlasDirty) {
+        // The atlas also needs repacking when the set of marks to render
+        // has changed without any image change, e.g. when a hotcue has
+        // been cleared, as the remaining marks would otherwise keep their
+        // texture coordinates into the old atlas.
+        m_markAtlasDirty = !std::equal(m_marksInAtlas.cbegin(),
+                m_marksInAtlas.cend(),
+                m_marks.cbegin(),
+                m_marks.cend(),
+                [](const WaveformMark* pMarkInAtlas,
+                        const WaveformMarkPointer& pMark) {
+                    return pMarkInAtlas == pMark.get();
+                });
+    }
+    if (m_markAtlasDirty) {
+        // One or more mark images have changed, repack them into the
+        // texture atlas (will create a texture so requires OpenGL context)
+        updateMarkAtlasTexture(m_waveformRenderer->getContext());
+    }
 
     const double playPosition = m_waveformRenderer->getTruePosSample(positionType);
     double nextMarkPosition = std::numeric_limits<double>::max();
 
+    // The positioned quads of the visible marks, drawn batched from the
+    // texture atlas by m_pMarkAtlasNode
+    struct MarkQuad {
+        WaveformMarkAtlasGraphics* pGraphics;
+        float x;
+        float y;
+    };
+    std::vector<MarkQuad> markQuads;
+
     GeometryNode* pRangeChild = static_cast<GeometryNode*>(m_pRangeNodesParent->firstChild());
 
     for (const auto& pMark : std::as_const(m_marks)) {
@@ -340,9 +427,8 @@ void allshader::WaveformRenderMark::update() {
             continue;
         }
 
-        auto* pMarkGraphics = pMark->m_pGraphics.get();
-        auto* pMarkNodeGraphics = static_cast<WaveformMarkNodeGraphics*>(pMarkGraphics);
-        if (!pMarkNodeGraphics) { // is this even possible?
+        auto* pMarkGraphics = static_cast<WaveformMarkAtlasGraphics*>(pMark->m_pGraphics.get());
+        if (!pMarkGraphics) { // is this even possible?
             continue;
         }
 
@@ -362,22 +448,18 @@ void allshader::WaveformRenderMark::update() {
         }
         const double sampleEndPosition = pMark->getSampleEndPosition();
 
-        const float markWidth = pMarkNodeGraphics->textureWidth() / devicePixelRatio;
+        const float markWidth = static_cast<float>(pMarkGraphics->size().width());
         const float drawOffset = currentMarkPos + pMark->getOffset();
 
         bool visible = false;
         // Check if the current point needs to be displayed.
         if (drawOffset > -markWidth &&
                 drawOffset < m_waveformRenderer->getLength()) {
-            pMarkNodeGraphics->update(
+            markQuads.push_back(MarkQuad{pMarkGraphics,
                     roundToPixel(drawOffset),
                     !m_isSlipRenderer && slipActive
                             ? roundToPixel(m_waveformRenderer->getBreadth() / 2.f)
-                            : 0,
-                    devicePixelRatio);
-
-            // transfer back to m_pMarkNodesParent children, for rendering
-            m_pMarkNodesParent->appendChildNode(pMarkNodeGraphics->detachNode());
+                            : 0});
 
             visible = true;
         }
@@ -442,6 +524,26 @@ void allshader::WaveformRenderMark::update() {
         pRangeChild = pNextChild;
     }
 
+    {
+        // Update the batched geometry with a quad for each visible mark,
+        // textured with the mark's region of the atlas
+        const int numVerticesPerRectangle = 6;
+        m_pMarkAtlasNode->geometry().allocate(
+                static_cast<int>(markQuads.size()) * numVerticesPerRectangle);
+        TexturedVertexUpdater vertexUpdater{
+                m_pMarkAtlasNode->geometry()
+                        .vertexDataAs<Geometry::TexturedPoint2D>()};
+        for (const auto& quad : markQuads) {
+            vertexUpdater.addRectangle({quad.x, quad.y},
+                    {quad.x + static_cast<float>(quad.pGraphics->size().width()),
+                            quad.y +
+                                    static_cast<float>(
+                                            quad.pGraphics->size().height())},
+                    quad.pGraphics->texCoordMin(),
+                    quad.pGraphics->texCoordMax());
+        }
+    }
+
     m_waveformRenderer->setMarkPositions(marksOnScreen);
 
     const float playMarkerPos = static_cast<float>(m_waveformRenderer->getPlayMarkerPosition() *
@@ -600,19 +702,74 @@ void allshader::WaveformRenderMark::drawTriangle(QPainter* painter,
 }
 
 void allshader::WaveformRenderMark::updateMarkImage(WaveformMarkPointer pMark) {
+    QImage image = pMark->generateImage(m_waveformRenderer->getDevicePixelRatio());
     if (!pMark->m_pGraphics) {
         pMark->m_pGraphics =
-                std::make_unique<WaveformMarkNodeGraphics>(pMark.get(),
-                        false,
-                        m_waveformRenderer->getContext(),
-                        pMark->generateImage(
-                                m_waveformRenderer->getDevicePixelRatio()));
+                std::make_unique<WaveformMarkAtlasGraphics>(std::move(image));
     } else {
-        auto* pGraphics = static_cast<WaveformMarkNodeGraphics*>(pMark->m_pGraphics.get());
-        pGraphics->updateTexture(m_waveformRenderer->getContext(),
-                pMark->generateImage(
-                        m_waveformRenderer->getDevicePixelRatio()));
+        auto* pGraphics = static_cast<WaveformMarkAtlasGraphics*>(pMark->m_pGraphics.get());
+        pGraphics->setImage(std::move(image));
+    }
+    m_markAtlasDirty = true;
+}
+
+void allshader::WaveformRenderMark::updateMarkAtlasTexture(rendergraph::Context* pContext) {
+    m_markAtlasDirty = false;
+    m_marksInAtlas.clear();
+
+    // Pack the mark images into a single row, with some transparent
+    // spacing in between. All images are rasterized at the same device
+    // pixel ratio and share the breadth of the waveform as height, apart
+    // from marks with a custom pixmap.
+    int totalWidth = 0;
+    int maxHeight = 0;
+    for (const auto& pMark : std::as_const(m_marks)) {
+        const auto* pGraphics =
+                static_cast<WaveformMarkAtlasGraphics*>(pMark->m_pGraphics.get());
+        if (!pGraphics || pGraphics->image().isNull()) {
+            continue;
+        }
+        totalWidth += pGraphics->image().width() + kMarkAtlasSpacing;
+        maxHeight = std::max(maxHeight, pGraphics->image().height());
     }
+
+    if (totalWidth == 0 || maxHeight == 0) {
+        m_pMarkAtlasNode->geometry().allocate(0);
+        return;
+    }
+
+    QImage atlas(totalWidth, maxHeight, QImage::Format_ARGB32_Premultiplied);
+    VERIFY_OR_DEBUG_ASSERT(!atlas.isNull()) {
+        return;
+    }
+    atlas.fill(Qt::transparent);
+
+    // See comment on use of QPainter at top of file
+    QPainter painter(&atlas);
+    int x = 0;
+    for (const auto& pMark : std::as_const(m_marks)) {
+        auto* pGraphics =
+                static_cast<WaveformMarkAtlasGraphics*>(pMark->m_pGraphics.get());
+        if (!pGraphics || pGraphics->image().isNull()) {
+            continue;
+        }
+        const QImage& image = pGraphics->image();
+        // Use explicit target and source rects to copy the pixels one to
+        // one, regardless of the device pixel ratio of the image
+        painter.drawImage(QRect(x, 0, image.width(), image.height()),
+                image,
+                image.rect());
+        pGraphics->setTexCoords(
+                QVector2D(static_cast<float>(x) / totalWidth, 0.f),
+                QVector2D(static_cast<float>(x + image.width()) / totalWidth,
+                        static_cast<float>(image.height()) / maxHeight));
+        m_marksInAtlas.push_back(pMark.get());
+        x += image.width() + kMarkAtlasSpacing;
+    }
+    painter.end();
+
+    dynamic_cast<TextureMaterial&>(m_pMarkAtlasNode->material())
+            .setTexture(std::make_unique<Texture>(pContext, atlas));
 }
 void allshader::WaveformRenderMark::updateEndMarkImage(WaveformMarkPointer pMark) {
     if (!pMark->m_pEndGraphics) {
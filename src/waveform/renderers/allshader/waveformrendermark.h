@@ -1,6 +1,7 @@
 #pragma once
 
 #include <QColor>
+#include <vector>
 
 #include "rendergraph/geometrynode.h"
 #include "rendergraph/node.h"
@@ -64,6 +65,7 @@ class allshader::WaveformRenderMark : public ::WaveformRenderMarkBase,
     void updateMarkImage(WaveformMarkPointer pMark) override;
     void updateEndMarkImage(WaveformMarkPointer pMark) override;
 
+    void updateMarkAtlasTexture(rendergraph::Context* pContext);
     void updatePlayPosMarkTexture(rendergraph::Context* pContext);
 
     void drawTriangle(QPainter* painter,
@@ -88,6 +90,13 @@ class allshader::WaveformRenderMark : public ::WaveformRenderMarkBase,
     bool m_isSlipRenderer;
 
     rendergraph::Node* m_pRangeNodesParent{};
+    // Draws all marks as textured quads from the shared texture atlas
+    rendergraph::GeometryNode* m_pMarkAtlasNode{};
+    bool m_markAtlasDirty{};
+    // The marks packed into the atlas, in packing order, used to detect
+    // when the atlas needs repacking
+    std::vector<const WaveformMark*> m_marksInAtlas;
+    // Parent of the per-mark end nodes
     rendergraph::Node* m_pMarkNodesParent{};
 
     rendergraph::GeometryNode* m_pPlayPosNode;
@@ -5,6 +5,7 @@
 #include "util/colorcomponents.h"
 #include "util/math.h"
 #include "util/timer.h"
+#include "waveform/renderers/waveformrgbbandpalette.h"
 #include "waveform/renderers/waveformsignalcolors.h"
 
 namespace waveformOverviewRenderer {
@@ -104,6 +105,22 @@ void drawWaveformPartRGB(
     getRgbF(midColor, &midColor_r, &midColor_g, &midColor_b);
     getRgbF(highColor, &highColor_r, &highColor_g, &highColor_b);
 
+    // The overview is rendered without EQ gains, so the palette maps the
+    // plain band magnitudes to their weighted color contributions.
+    WaveformRgbBandPalette bandPalette;
+    bandPalette.update(1.0f,
+            1.0f,
+            1.0f,
+            lowColor_r,
+            lowColor_g,
+            lowColor_b,
+            midColor_r,
+            midColor_g,
+            midColor_b,
+            highColor_r,
+            highColor_g,
+            highColor_b);
+
     if (mono) {
         // Mono means we're going to paint from bottom to top with l+r.
         const qreal dy = pPainter->deviceTransform().dy();
@@ -113,6 +130,8 @@ void drawWaveformPartRGB(
         // flip y-axis
         pPainter->scale(1, -1);
         for (int i = startVal, x = startVal / 2; i < end; i += 2, ++x) {
+            // The summed left+right magnitudes exceed the 8-bit domain of
+            // the palette, so the mono path keeps the scalar color math.
             // Left
             all = pWaveform->getAll(i) + pWaveform->getAll(i + 1);
             low = pWaveform->getLow(i) + pWaveform->getLow(i + 1);
@@ -135,44 +154,57 @@ void drawWaveformPartRGB(
         }
     } else { // stereo
         for (int i = startVal, x = startVal / 2; i < end; i += 2, ++x) {
+            // Look up the weighted color contributions of the band
+            // magnitudes instead of recomputing them with float math
+            // for every column
             // Left
-            all = pWaveform->getAll(i);
-            low = pWaveform->getLow(i);
-            mid = pWaveform->getMid(i);
-            high = pWaveform->getHigh(i);
-
-            red = low * lowColor_r + mid * midColor_r + high * highColor_r;
-            green = low * lowColor_g + mid * midColor_g + high * highColor_g;
-            blue = low * lowColor_b + mid * midColor_b + high * highColor_b;
-            // Normalize
-            max = math_max3(red, green, blue);
-            // Draw
-            if (max > 0.0) {
-                color.setRgbF(static_cast<float>(low / max),
-                        static_cast<float>(mid / max),
-                        static_cast<float>(high / max));
-                pPainter->setPen(color);
-                pPainter->drawLine(x, static_cast<int>(-all), x, 0);
+            {
+                all = pWaveform->getAll(i);
+                const WaveformRgbBandPalette::Entry& lowEntry =
+                        bandPalette.low(pWaveform->getLow(i));
+                const WaveformRgbBandPalette::Entry& midEntry =
+                        bandPalette.mid(pWaveform->getMid(i));
+                const WaveformRgbBandPalette::Entry& highEntry =
+                        bandPalette.high(pWaveform->getHigh(i));
+
+                red = lowEntry.red + midEntry.red + highEntry.red;
+                green = lowEntry.green + midEntry.green + highEntry.green;
+                blue = lowEntry.blue + midEntry.blue + highEntry.blue;
+                // Normalize
+                max = math_max3(red, green, blue);
+                // Draw
+                if (max > 0.0) {
+                    color.setRgbF(lowEntry.gained / max,
+                            midEntry.gained / max,
+                            highEntry.gained / max);
+                    pPainter->setPen(color);
+                    pPainter->drawLine(x, static_cast<int>(-all), x, 0);
+                }
             }
 
             // Right
-            all = pWaveform->getAll(i + 1);
-            low = pWaveform->getLow(i + 1);
-            mid = pWaveform->getMid(i + 1);
-            high = pWaveform->getHigh(i + 1);
-
-            red = low * lowColor_r + mid * midColor_r + high * highColor_r;
-            green = low * lowColor_g + mid * midColor_g + high * highColor_g;
-            blue = low * lowColor_b + mid * midColor_b + high * highColor_b;
-
-            max = math_max3(red, green, blue);
-
-            if (max > 0.0) {
-                color.setRgbF(static_cast<float>(low / max),
-                        static_cast<float>(mid / max),
-                        static_cast<float>(high / max));
-                pPainter->setPen(color);
-                pPainter->drawLine(x, 0, x, static_cast<int>(all));
+            {
+                all = pWaveform->getAll(i + 1);
+                const WaveformRgbBandPalette::Entry& lowEntry =
+                        bandPalette.low(pWaveform->getLow(i + 1));
+                const WaveformRgbBandPalette::Entry& midEntry =
+                        bandPalette.mid(pWaveform->getMid(i + 1));
+                const WaveformRgbBandPalette::Entry& highEntry =
+                        bandPalette.high(pWaveform->getHigh(i + 1));
+
+                red = lowEntry.red + midEntry.red + highEntry.red;
+                green = lowEntry.green + midEntry.green + highEntry.green;
+                blue = lowEntry.blue + midEntry.blue + highEntry.blue;
+
+                max = math_max3(red, green, blue);
+
+                if (max > 0.0) {
+                    color.setRgbF(lowEntry.gained / max,
+                            midEntry.gained / max,
+                            highEntry.gained / max);
+                    pPainter->setPen(color);
+                    pPainter->drawLine(x, 0, x, static_cast<int>(all));
+                }
             }
         }
     }
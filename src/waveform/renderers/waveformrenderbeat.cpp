@@ -67,7 +67,7 @@ void WaveformRenderBeat::draw(QPainter* painter, QPaintEvent* /*event*/) {
             firstDisplayedPosition * trackSamples);
     const auto endPosition = mixxx::audio::FramePos::fromEngineSamplePos(
             lastDisplayedPosition * trackSamples);
-    auto it = trackBeats->iteratorFrom(startPosition);
+    auto it = m_beatCursor.iteratorFrom(trackBeats, startPosition);
 
     // if no beat do not waste time saving/restoring painter
     if (it == trackBeats->cend() || *it > endPosition) {
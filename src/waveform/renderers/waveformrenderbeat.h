@@ -3,6 +3,7 @@
 #include <QColor>
 
 #include "skin/legacy/skincontext.h"
+#include "track/beats.h"
 #include "util/class.h"
 #include "waveform/renderers/waveformrendererabstract.h"
 
@@ -17,6 +18,9 @@ class WaveformRenderBeat : public WaveformRendererAbstract {
   private:
     QColor m_beatColor;
     QVector<QLineF> m_beats;
+    // Caches the beat interval of the last draw, so consecutive draws
+    // during playback do not search the beats from scratch
+    mixxx::Beats::Cursor m_beatCursor;
 
     DISALLOW_COPY_AND_ASSIGN(WaveformRenderBeat);
 };
@@ -47,8 +47,7 @@ void WaveformRendererFilteredSignal::draw(QPainter* painter,
         return;
     }
 
-    const WaveformData* data = pWaveform->data();
-    if (data == nullptr) {
+    if (pWaveform->data() == nullptr) {
         return;
     }
 
@@ -139,9 +138,6 @@ void WaveformRendererFilteredSignal::draw(QPainter* painter,
         visualFrameStart = math_clamp(visualFrameStart, 0, lastVisualFrame);
         visualFrameStop = math_clamp(visualFrameStop, 0, lastVisualFrame);
 
-        int visualIndexStart = visualFrameStart * 2;
-        int visualIndexStop = visualFrameStop * 2;
-
         // if (x == static_cast<int>(length) / 2) {
         //     qDebug() << "audioVisualRatio" << waveform->getAudioVisualRatio();
         //     qDebug() << "visualSampleRate" << waveform->getVisualSampleRate();
@@ -153,21 +149,15 @@ void WaveformRendererFilteredSignal::draw(QPainter* painter,
         //     qDebug() << "Sampling pixel " << x << "over [" << visualIndexStart << visualIndexStop << "]";
         // }
 
-        unsigned char maxLow[2] = {0, 0};
-        unsigned char maxMid[2] = {0, 0};
-        unsigned char maxHigh[2] = {0, 0};
-
-        for (int i = visualIndexStart;
-             i >= 0 && i + 1 < dataSize && i + 1 <= visualIndexStop; i += 2) {
-            const WaveformData& waveformData = *(data + i);
-            const WaveformData& waveformDataNext = *(data + i + 1);
-            maxLow[0] = math_max(maxLow[0], waveformData.filtered.low);
-            maxLow[1] = math_max(maxLow[1], waveformDataNext.filtered.low);
-            maxMid[0] = math_max(maxMid[0], waveformData.filtered.mid);
-            maxMid[1] = math_max(maxMid[1], waveformDataNext.filtered.mid);
-            maxHigh[0] = math_max(maxHigh[0], waveformData.filtered.high);
-            maxHigh[1] = math_max(maxHigh[1], waveformDataNext.filtered.high);
-        }
+        // Per-channel maxima of each band over the frames covered by this
+        // pixel. Reads the decimated summary pyramid instead of scanning
+        // every raw frame, except at the unaligned range edges and while
+        // the pyramid has not been built yet during a running analysis.
+        const WaveformSummaryData maxBands =
+                pWaveform->absMaxBandsInRange(visualFrameStart, visualFrameStop);
+        const unsigned char* maxLow = maxBands.low;
+        const unsigned char* maxMid = maxBands.mid;
+        const unsigned char* maxHigh = maxBands.high;
 
         if (maxLow[0] && maxLow[1]) {
             switch (m_alignment) {
@@ -133,34 +133,20 @@ void WaveformRendererHSV::draw(
         visualFrameStart = math_clamp(visualFrameStart, 0, lastVisualFrame);
         visualFrameStop = math_clamp(visualFrameStop, 0, lastVisualFrame);
 
-        int visualIndexStart = visualFrameStart * 2;
-        int visualIndexStop = visualFrameStop * 2;
-
-        float maxLow[2] = {0.0f, 0.0f};
-        float maxHigh[2] = {0.0f, 0.0f};
-        float maxMid[2] = {0.0f, 0.0f};
-        float maxAll[2] = {0.0f, 0.0f};
-
-        for (int i = visualIndexStart;
-                i >= 0 && i + 1 < dataSize && i + 1 <= visualIndexStop;
-                i += 2) {
-            const WaveformData& waveformDataLeft = *(data + i);
-            const WaveformData& waveformDataRight = *(data + i + 1);
-            maxLow[0] = math_max(maxLow[0],
-                    static_cast<float>(waveformDataLeft.filtered.low));
-            maxLow[1] = math_max(maxLow[1],
-                    static_cast<float>(waveformDataRight.filtered.low));
-            maxMid[0] = math_max(maxMid[0],
-                    static_cast<float>(waveformDataLeft.filtered.mid));
-            maxMid[1] = math_max(maxMid[1],
-                    static_cast<float>(waveformDataRight.filtered.mid));
-            maxHigh[0] = math_max(maxHigh[0],
-                    static_cast<float>(waveformDataLeft.filtered.high));
-            maxHigh[1] = math_max(maxHigh[1],
-                    static_cast<float>(waveformDataRight.filtered.high));
-            maxAll[0] = math_max(maxAll[0], static_cast<float>(waveformDataLeft.filtered.all));
-            maxAll[1] = math_max(maxAll[1], static_cast<float>(waveformDataRight.filtered.all));
-        }
+        // Per-channel maxima of each band over the frames covered by this
+        // pixel. Reads the decimated summary pyramid shared by all widgets
+        // that display this waveform instead of scanning every raw frame.
+        const WaveformSummaryData maxBands =
+                pWaveform->absMaxBandsInRange(visualFrameStart, visualFrameStop);
+
+        float maxLow[2] = {static_cast<float>(maxBands.low[0]),
+                static_cast<float>(maxBands.low[1])};
+        float maxMid[2] = {static_cast<float>(maxBands.mid[0]),
+                static_cast<float>(maxBands.mid[1])};
+        float maxHigh[2] = {static_cast<float>(maxBands.high[0]),
+                static_cast<float>(maxBands.high[1])};
+        float maxAll[2] = {static_cast<float>(maxBands.all[0]),
+                static_cast<float>(maxBands.all[1])};
 
         float allUnscaledLeft = maxLow[0] + maxMid[0] + maxHigh[0];
         float allUnscaledRight = maxLow[1] + maxMid[1] + maxHigh[1];
@@ -95,6 +95,20 @@ void WaveformRendererRGB::draw(
     // A reference full scale pink noise has value 60 for each band
     float heightFactor = allGain * halfBreadth / 255;
 
+    // Rebuilds the palette only when the gains or colors have changed
+    m_bandPalette.update(lowGain,
+            midGain,
+            highGain,
+            m_rgbLowColor_r,
+            m_rgbLowColor_g,
+            m_rgbLowColor_b,
+            m_rgbMidColor_r,
+            m_rgbMidColor_g,
+            m_rgbMidColor_b,
+            m_rgbHighColor_r,
+            m_rgbHighColor_g,
+            m_rgbHighColor_b);
+
     // Draw reference line
     painter->setPen(m_waveformRenderer->getWaveformSignalColors()->getAxesColor());
     painter->drawLine(QLineF(0, halfBreadth, m_waveformRenderer->getLength(), halfBreadth));
@@ -127,51 +141,34 @@ void WaveformRendererRGB::draw(
         visualFrameStart = math_clamp(visualFrameStart, 0, lastVisualFrame);
         visualFrameStop = math_clamp(visualFrameStop, 0, lastVisualFrame);
 
-        int visualIndexStart = visualFrameStart * 2;
-        int visualIndexStop  = visualFrameStop * 2;
-
-        unsigned char maxLow  = 0;
-        unsigned char maxMid  = 0;
-        unsigned char maxHigh = 0;
-        float maxAllLeft = 0.;
-        float maxAllRight = 0.;
-
-        for (int i = visualIndexStart;
-             i >= 0 && i + 1 < dataSize && i + 1 <= visualIndexStop; i += 2) {
-            const WaveformData& waveformDataLeft = data[i];
-            const WaveformData& waveformDataRight = data[i + 1];
-
-            maxLow = math_max3(maxLow,
-                    waveformDataLeft.filtered.low,
-                    waveformDataRight.filtered.low);
-            maxMid = math_max3(maxMid,
-                    waveformDataLeft.filtered.mid,
-                    waveformDataRight.filtered.mid);
-            maxHigh = math_max3(maxHigh,
-                    waveformDataLeft.filtered.high,
-                    waveformDataRight.filtered.high);
-            float allLeft = waveformDataLeft.filtered.all;
-            maxAllLeft = math_max(maxAllLeft, allLeft);
-            float allRight = waveformDataRight.filtered.all;
-            maxAllRight = math_max(maxAllRight, allRight);
-        }
-
-        float maxLowF = maxLow * lowGain;
-        float maxMidF = maxMid * midGain;
-        float maxHighF = maxHigh * highGain;
-
-        float allUnscaled = maxLow + maxMid + maxHigh;
+        // Per-channel maxima of each band over the frames covered by this
+        // pixel. Reads the decimated summary pyramid shared by all widgets
+        // that display this waveform instead of scanning every raw frame.
+        const WaveformSummaryData maxBands =
+                pWaveform->absMaxBandsInRange(visualFrameStart, visualFrameStop);
+        const unsigned char maxLow = math_max(maxBands.low[0], maxBands.low[1]);
+        const unsigned char maxMid = math_max(maxBands.mid[0], maxBands.mid[1]);
+        const unsigned char maxHigh = math_max(maxBands.high[0], maxBands.high[1]);
+        const float maxAllLeft = maxBands.all[0];
+        const float maxAllRight = maxBands.all[1];
+
+        // Look up the gained band magnitudes and their weighted color
+        // contributions instead of recomputing them with float math for
+        // every column
+        const WaveformRgbBandPalette::Entry& lowEntry = m_bandPalette.low(maxLow);
+        const WaveformRgbBandPalette::Entry& midEntry = m_bandPalette.mid(maxMid);
+        const WaveformRgbBandPalette::Entry& highEntry = m_bandPalette.high(maxHigh);
+
+        const float allUnscaled = static_cast<float>(maxLow + maxMid + maxHigh);
         float eqGain = 1.0f;
         if (allUnscaled > 0.0f) {
-            eqGain = (maxLowF + maxMidF + maxHighF) / allUnscaled;
+            eqGain = (lowEntry.gained + midEntry.gained + highEntry.gained) /
+                    allUnscaled;
         }
 
-        float red = maxLowF * m_rgbLowColor_r + maxMidF * m_rgbMidColor_r +
-                maxHighF * m_rgbHighColor_r;
-        float green = maxLowF * m_rgbLowColor_g + maxMidF * m_rgbMidColor_g +
-                maxHighF * m_rgbHighColor_g;
-        float blue = maxLowF * m_rgbLowColor_b + maxMidF * m_rgbMidColor_b +
-                maxHighF * m_rgbHighColor_b;
+        float red = lowEntry.red + midEntry.red + highEntry.red;
+        float green = lowEntry.green + midEntry.green + highEntry.green;
+        float blue = lowEntry.blue + midEntry.blue + highEntry.blue;
 
         // Compute maximum (needed for value normalization)
         float max = math_max3(red, green, blue);
@@ -2,6 +2,7 @@
 
 #include "util/class.h"
 #include "waveformrenderersignalbase.h"
+#include "waveformrgbbandpalette.h"
 
 class WaveformRendererRGB : public WaveformRendererSignalBase {
   public:
@@ -13,5 +14,7 @@ class WaveformRendererRGB : public WaveformRendererSignalBase {
     virtual void draw(QPainter* painter, QPaintEvent* event);
 
   private:
+    WaveformRgbBandPalette m_bandPalette;
+
     DISALLOW_COPY_AND_ASSIGN(WaveformRendererRGB);
 };
@@ -100,9 +100,18 @@ void WaveformRenderMarkBase::updateMarkImages() {
     for (const auto& pMark : m_marks) {
         if (pMark->needsImageUpdate()) {
             updateMarkImage(pMark);
+            // The image is up-to-date now. Without resetting the flag here,
+            // renderers that update the existing graphics in-place would
+            // regenerate the image again on every frame.
+            if (pMark->m_pGraphics) {
+                pMark->m_pGraphics->m_obsolete = false;
+            }
         }
         if (pMark->needsEndImageUpdate()) {
             updateEndMarkImage(pMark);
+            if (pMark->m_pEndGraphics) {
+                pMark->m_pEndGraphics->m_obsolete = false;
+            }
         }
     }
 }
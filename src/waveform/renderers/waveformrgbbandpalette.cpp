@@ -0,0 +1,52 @@
+#include "waveform/renderers/waveformrgbbandpalette.h"
+
+void WaveformRgbBandPalette::update(float lowGain,
+        float midGain,
+        float highGain,
+        float lowRed,
+        float lowGreen,
+        float lowBlue,
+        float midRed,
+        float midGreen,
+        float midBlue,
+        float highRed,
+        float highGreen,
+        float highBlue) {
+    const std::array<float, 12> inputs{lowGain,
+            midGain,
+            highGain,
+            lowRed,
+            lowGreen,
+            lowBlue,
+            midRed,
+            midGreen,
+            midBlue,
+            highRed,
+            highGreen,
+            highBlue};
+    if (m_valid && inputs == m_inputs) {
+        return;
+    }
+    m_inputs = inputs;
+    m_valid = true;
+
+    fillBand(&m_low, lowGain, lowRed, lowGreen, lowBlue);
+    fillBand(&m_mid, midGain, midRed, midGreen, midBlue);
+    fillBand(&m_high, highGain, highRed, highGreen, highBlue);
+}
+
+// static
+void WaveformRgbBandPalette::fillBand(BandTable* pBand,
+        float gain,
+        float red,
+        float green,
+        float blue) {
+    for (int magnitude = 0; magnitude < static_cast<int>(pBand->size()); ++magnitude) {
+        const float gained = static_cast<float>(magnitude) * gain;
+        (*pBand)[magnitude] = Entry{
+                gained * red,
+                gained * green,
+                gained * blue,
+                gained};
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <array>
+
+/// Lookup table mapping the unsigned 8-bit band magnitudes of the
+/// waveform data to their precomputed color contributions.
+///
+/// The RGB waveform renderers derive the color of each column from the
+/// low/mid/high band maxima by scaling each band with its EQ gain and
+/// accumulating the weighted band colors. Doing this with scalar float
+/// math costs a dozen multiplications per column on every repaint. The
+/// palette precomputes the products for all 256 magnitudes of each band
+/// once, so that the per-column work reduces to three table lookups and
+/// a few additions. The entries are computed with the same operations
+/// and in the same order as the previous per-column math, so the
+/// resulting colors are bit-identical.
+///
+/// update() only rebuilds the tables when the gains or colors have
+/// changed since the last call, which makes it cheap to call once per
+/// rendered frame.
+class WaveformRgbBandPalette {
+  public:
+    struct Entry {
+        /// The weighted color contributions of the band magnitude
+        float red;
+        float green;
+        float blue;
+        /// The band magnitude with the band gain applied
+        float gained;
+    };
+
+    void update(float lowGain,
+            float midGain,
+            float highGain,
+            float lowRed,
+            float lowGreen,
+            float lowBlue,
+            float midRed,
+            float midGreen,
+            float midBlue,
+            float highRed,
+            float highGreen,
+            float highBlue);
+
+    const Entry& low(unsigned char magnitude) const {
+        return m_low[magnitude];
+    }
+    const Entry& mid(unsigned char magnitude) const {
+        return m_mid[magnitude];
+    }
+    const Entry& high(unsigned char magnitude) const {
+        return m_high[magnitude];
+    }
+
+  private:
+    typedef std::array<Entry, 256> BandTable;
+
+    static void fillBand(BandTable* pBand,
+            float gain,
+            float red,
+            float green,
+            float blue);
+
+    BandTable m_low;
+    BandTable m_mid;
+    BandTable m_high;
+
+    // Inputs of the last rebuild for change detection
+    std::array<float, 12> m_inputs;
+    bool m_valid{false};
+};
@@ -221,6 +221,33 @@ void WaveformWidgetRenderer::onPreRender(VSyncTimeProvider* vsyncThread) {
     //         "m_gain" << m_gain;
 }
 
+WaveformWidgetRenderer::VisualState WaveformWidgetRenderer::currentVisualState() const {
+    VisualState state;
+    state.pTrack = m_pTrack.get();
+    for (int type = ::WaveformRendererAbstract::Play;
+            type <= ::WaveformRendererAbstract::Slip;
+            type++) {
+        state.pos[type] = m_pos[type];
+    }
+    state.visualSamplePerPixel = m_visualSamplePerPixel;
+    state.gain = m_gain;
+    state.trackSamples = m_trackSamples;
+    state.playMarkerPosition = m_playMarkerPosition;
+    state.width = m_width;
+    state.height = m_height;
+    state.alphaBeatGrid = m_alphaBeatGrid;
+    state.passthroughEnabled = m_passthroughEnabled;
+    return state;
+}
+
+bool WaveformWidgetRenderer::visualStateChanged() const {
+    return !(m_renderedState == currentVisualState());
+}
+
+void WaveformWidgetRenderer::markRendered() {
+    m_renderedState = currentVisualState();
+}
+
 void WaveformWidgetRenderer::draw(QPainter* painter, QPaintEvent* event) {
 #ifdef WAVEFORMWIDGETRENDERER_DEBUG
     m_lastSystemFrameTime = m_timer->restart().toIntegerNanos();
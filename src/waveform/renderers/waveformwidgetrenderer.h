@@ -206,6 +206,16 @@ class WaveformWidgetRenderer {
         return m_trackSamples <= 0.0 || m_pos[::WaveformRendererAbstract::Play] == -1;
     }
 
+    /// True if the state computed by the last onPreRender() call differs
+    /// from the frame that was last rendered, i.e. redrawing the widget
+    /// now would display something new. Used by the factory to skip
+    /// redraws of idle widgets, e.g. paused decks.
+    bool visualStateChanged() const;
+
+    /// Records the visual state of the frame that is about to be rendered
+    /// for later visualStateChanged() calls.
+    void markRendered();
+
     void setContext(rendergraph::Context* pContext) {
         m_pContext = pContext;
     }
@@ -280,4 +290,28 @@ private:
     bool m_passthroughEnabled;
     double m_pos[2];
     double m_truePosSample[2];
+
+    // Visual state that determines the rendered image, apart from overlay
+    // details like cue or loop markers that may be edited while a deck is
+    // paused. The factory repaints idle widgets at a low rate to pick up
+    // such edits.
+    struct VisualState {
+        const Track* pTrack = nullptr;
+        double pos[2] = {-2.0, -2.0};
+        double visualSamplePerPixel = 0.0;
+        double gain = 0.0;
+        double trackSamples = -1.0;
+        double playMarkerPosition = -1.0;
+        int width = 0;
+        int height = 0;
+        int alphaBeatGrid = 0;
+        bool passthroughEnabled = false;
+
+        bool operator==(const VisualState&) const = default;
+    };
+
+    VisualState currentVisualState() const;
+
+    // State of the last rendered frame.
+    VisualState m_renderedState;
 };
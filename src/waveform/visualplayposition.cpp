@@ -35,7 +35,9 @@ void VisualPlayPosition::set(
         double loopStartPosition,
         double loopEndPosition,
         double tempoTrackSeconds,
-        double audioBufferMicroS) {
+        double audioBufferMicroS,
+        double beatDistance,
+        double beatsPerBuffer) {
     VisualPlayPositionData data;
     data.m_referenceTime = m_timeInfoTime;
     data.m_callbackEntrytoDac = static_cast<int>(m_dCallbackEntryToDacSecs * 1000000); // s to µs
@@ -52,6 +54,8 @@ void VisualPlayPosition::set(
     data.m_loopEndPos = loopEndPosition;
     data.m_tempoTrackSeconds = tempoTrackSeconds;
     data.m_audioBufferMicroS = audioBufferMicroS;
+    data.m_beatDistance = beatDistance;
+    data.m_beatsPerBuffer = beatsPerBuffer;
 
     // Atomic write
     m_data.setValue(data);
@@ -182,6 +186,54 @@ void VisualPlayPosition::getPlaySlipAtNextVSync(
     }
 }
 
+double VisualPlayPosition::getBeatDistanceAtNextVSync(
+        VSyncTimeProvider* pSyncTimeProvider) {
+    if (!m_valid.load()) {
+        return -1.0;
+    }
+    const VisualPlayPositionData data = m_data.getValue();
+    if (data.m_beatDistance < 0.0) {
+        return -1.0;
+    }
+    // calcOffsetAtNextVSync() scales the time offset by m_positionStep,
+    // rescale it to beats.
+    double beatOffset = 0.0;
+    const double offset = calcOffsetAtNextVSync(pSyncTimeProvider, data);
+    if (data.m_positionStep != 0.0) {
+        beatOffset = offset / data.m_positionStep * data.m_beatsPerBuffer;
+    }
+    const double beatDistance = data.m_beatDistance + beatOffset;
+    // Wrap into [0, 1), also for reverse playback
+    return beatDistance - std::floor(beatDistance);
+}
+
+double VisualPlayPosition::getBeatDistanceNow() {
+    if (!m_valid.load()) {
+        return -1.0;
+    }
+    const VisualPlayPositionData data = m_data.getValue();
+    if (data.m_beatDistance < 0.0) {
+        return -1.0;
+    }
+    double beatOffset = 0.0;
+    if (data.m_audioBufferMicroS != 0.0) {
+        const double sinceDacMicros =
+                data.m_referenceTime.elapsed().toDoubleMicros() -
+                data.m_callbackEntrytoDac;
+        beatOffset = data.m_beatsPerBuffer * sinceDacMicros / data.m_audioBufferMicroS;
+    }
+    const double beatDistance = data.m_beatDistance + beatOffset;
+    return beatDistance - std::floor(beatDistance);
+}
+
+bool VisualPlayPosition::getSnapshot(VisualPlayPositionData* pData) {
+    if (!m_valid.load()) {
+        return false;
+    }
+    *pData = m_data.getValue();
+    return true;
+}
+
 double VisualPlayPosition::getEnginePlayPos() {
     if (m_valid.load()) {
         VisualPlayPositionData data = m_data.getValue();
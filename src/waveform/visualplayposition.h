@@ -43,6 +43,10 @@ class VisualPlayPositionData {
     double m_loopEndPos;
     double m_tempoTrackSeconds; // total track time, taking the current tempo into account
     double m_audioBufferMicroS;
+    double m_beatDistance;   // Beat phase [0, 1) of the first sample in the
+                             // buffer, or -1 if the track has no beats
+    double m_beatsPerBuffer; // Beats advanced per audio buffer at the current
+                             // tempo, negative when playing in reverse
 };
 
 
@@ -66,7 +70,9 @@ class VisualPlayPosition : public QObject {
             double loopStartPos,
             double loopEndPos,
             double tempoTrackSeconds,
-            double audioBufferMicroS);
+            double audioBufferMicroS,
+            double beatDistance,
+            double beatsPerBuffer);
 
     double getAtNextVSync(VSyncTimeProvider* pSyncTimeProvider);
     void getPlaySlipAtNextVSync(VSyncTimeProvider* pSyncTimeProvider,
@@ -77,6 +83,23 @@ class VisualPlayPosition : public QObject {
     double getEnginePlayPos();
     void getTrackTime(double* pPlayPosition, double* pTempoTrackSeconds);
 
+    // Copies the most recent snapshot published by the engine callback into
+    // *pData, so that related fields (position, rate, loop state, track
+    // time) can be read consistently with a single atomic read instead of
+    // separate control lookups that may tear between callbacks. Returns
+    // false and leaves *pData untouched if the engine has not published a
+    // snapshot yet.
+    bool getSnapshot(VisualPlayPositionData* pData);
+
+    // Interpolated beat phase [0, 1) at the time of the next VSync, or
+    // -1.0 if no track with beats is loaded. This is the beat clock for
+    // animated widgets: one extrapolated value per frame instead of
+    // per-widget control reads of the engine's beat_distance.
+    double getBeatDistanceAtNextVSync(VSyncTimeProvider* pSyncTimeProvider);
+    // The same clock extrapolated to the current time, for callers
+    // without a VSync time provider (e.g. QML).
+    double getBeatDistanceNow();
+
     // WARNING: Not thread safe. This function must only be called from the main
     // thread.
     static QSharedPointer<VisualPlayPosition> getVisualPlayPosition(const QString& group);
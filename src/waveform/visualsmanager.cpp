@@ -8,7 +8,6 @@ DeckVisuals::DeckVisuals(const QString& group)
           m_SlowTickCnt(0),
           m_trackLoaded(false),
           m_pPlayButton(std::make_unique<ControlProxy>(ConfigKey(group, "play"))),
-          m_pLoopEnabled(std::make_unique<ControlProxy>(ConfigKey(group, "loop_enabled"))),
           m_pEngineBpm(std::make_unique<ControlProxy>(ConfigKey(group, "bpm"))),
           m_pVisualBpm(std::make_unique<ControlProxy>(ConfigKey(m_group, "visual_bpm"))),
           m_pEngineKey(std::make_unique<ControlProxy>(ConfigKey(group, "key"))),
@@ -23,22 +22,28 @@ DeckVisuals::DeckVisuals(const QString& group)
 // this is called from WaveformWidgetFactory::render in the main thread with the
 // configured waveform frame rate
 void DeckVisuals::process(double remainingTimeTriggerSeconds) {
-    double playPosition;
-    double tempoTrackSeconds;
-    m_pVisualPlayPos->getTrackTime(&playPosition, &tempoTrackSeconds);
-    bool trackLoaded = (tempoTrackSeconds != 0.0);
+    // One consistent engine snapshot instead of separate control reads that
+    // may tear between audio callbacks.
+    VisualPlayPositionData snapshot;
+    if (!m_pVisualPlayPos->getSnapshot(&snapshot)) {
+        snapshot.m_playPos = 0.0;
+        snapshot.m_tempoTrackSeconds = 0.0;
+        snapshot.m_loopEnabled = false;
+    }
+    bool trackLoaded = (snapshot.m_tempoTrackSeconds != 0.0);
     if (!m_trackLoaded && !trackLoaded) {
         return;
     }
 
-    double timeRemaining = (1.0 - playPosition) * tempoTrackSeconds;
+    double timeRemaining = (1.0 - snapshot.m_playPos) * snapshot.m_tempoTrackSeconds;
     m_pTimeRemaining->set(timeRemaining);
-    m_pTimeElapsed->set(tempoTrackSeconds - timeRemaining);
+    m_pTimeElapsed->set(snapshot.m_tempoTrackSeconds - timeRemaining);
 
-    if (!m_pPlayButton->toBool() ||                             // not playing
-            m_pLoopEnabled->toBool() ||                         // in loop
-            tempoTrackSeconds <= remainingTimeTriggerSeconds || // track too short
-            timeRemaining > remainingTimeTriggerSeconds) {      // before the trigger
+    if (!m_pPlayButton->toBool() ||   // not playing
+            snapshot.m_loopEnabled || // in loop
+            snapshot.m_tempoTrackSeconds <=
+                    remainingTimeTriggerSeconds ||         // track too short
+            timeRemaining > remainingTimeTriggerSeconds) { // before the trigger
         m_pEndOfTrack->set(0.0);
     } else {
         m_pEndOfTrack->set(1.0);
@@ -36,7 +36,6 @@ class DeckVisuals {
     bool m_trackLoaded;
 
     std::unique_ptr<ControlProxy> m_pPlayButton;
-    std::unique_ptr<ControlProxy> m_pLoopEnabled;
 
     std::unique_ptr<ControlProxy> m_pEngineBpm;
     std::unique_ptr<ControlProxy> m_pVisualBpm;
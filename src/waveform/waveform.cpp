@@ -1,13 +1,100 @@
 #include "waveform/waveform.h"
 
+#include <QFile>
 #include <QtDebug>
 
+#include <cstring>
+
 #include "analyzer/constants.h"
 #include "engine/engine.h"
 #include "proto/waveform.pb.h"
+#include "util/assert.h"
+#include "util/math.h"
 
 using namespace mixxx::track;
 
+namespace {
+
+// Header of the flat binary waveform file format. The header is followed
+// by textureSize fixed-stride WaveformData records (the visual samples
+// padded up to textureStride squared) that can be memory-mapped and
+// rendered without deserialization. All fields are stored in the native
+// byte order; the files are a local cache beside the database and are
+// not exchanged between machines.
+struct FlatWaveformHeader {
+    static constexpr char kMagic[8] = {'M', 'x', 'W', 'f', 'm', 'F', 'l', 't'};
+    static constexpr quint32 kVersion = 1;
+
+    char magic[8];
+    quint32 version;
+    quint32 recordSize;
+    quint32 dataSize;
+    quint32 textureStride;
+    quint32 stemCount;
+    quint32 reserved;
+    double visualSampleRate;
+    double audioVisualRatio;
+};
+
+bool readAndValidateFlatHeader(QFile* pFile, FlatWaveformHeader* pHeader) {
+    if (pFile->read(reinterpret_cast<char*>(pHeader), sizeof(*pHeader)) !=
+            sizeof(*pHeader)) {
+        return false;
+    }
+    if (std::memcmp(pHeader->magic,
+                FlatWaveformHeader::kMagic,
+                sizeof(pHeader->magic)) != 0) {
+        return false;
+    }
+    if (pHeader->version != FlatWaveformHeader::kVersion ||
+            pHeader->recordSize != sizeof(WaveformData)) {
+        return false;
+    }
+    // Limit the stride so that the texture size is guaranteed to fit
+    // into an int even for corrupt files.
+    if (pHeader->textureStride > (1 << 15)) {
+        return false;
+    }
+    const qint64 textureSize =
+            static_cast<qint64>(pHeader->textureStride) * pHeader->textureStride;
+    if (pHeader->dataSize > textureSize ||
+            pHeader->stemCount > static_cast<quint32>(mixxx::kMaxSupportedStems)) {
+        return false;
+    }
+    const qint64 expectedFileSize = static_cast<qint64>(sizeof(*pHeader)) +
+            textureSize * sizeof(WaveformData);
+    return pFile->size() == expectedFileSize;
+}
+
+// Accumulates the per-channel band values of one visual frame (a pair of
+// interleaved left/right visual samples) into the given maxima.
+inline void maxAccumulateFrame(
+        WaveformSummaryData* pMax,
+        const WaveformData* pData,
+        int frame) {
+    for (int channel = 0; channel < ChannelCount; ++channel) {
+        const WaveformFilteredData& filtered =
+                pData[frame * 2 + channel].filtered;
+        pMax->low[channel] = math_max(pMax->low[channel], filtered.low);
+        pMax->mid[channel] = math_max(pMax->mid[channel], filtered.mid);
+        pMax->high[channel] = math_max(pMax->high[channel], filtered.high);
+        pMax->all[channel] = math_max(pMax->all[channel], filtered.all);
+    }
+}
+
+inline void maxAccumulate(
+        WaveformSummaryData* pMax,
+        const WaveformSummaryData& other) {
+    for (int channel = 0; channel < ChannelCount; ++channel) {
+        pMax->low[channel] = math_max(pMax->low[channel], other.low[channel]);
+        pMax->mid[channel] = math_max(pMax->mid[channel], other.mid[channel]);
+        pMax->high[channel] = math_max(pMax->high[channel], other.high[channel]);
+        pMax->all[channel] = math_max(pMax->all[channel], other.all[channel]);
+    }
+}
+
+} // anonymous namespace
+
 // Return the smallest power of 2 which is greater than the desired size when
 // squared.
 int computeTextureStride(int size) {
@@ -22,10 +109,13 @@ Waveform::Waveform(const QByteArray& data)
         : m_id(-1),
           m_saveState(SaveState::NotSaved),
           m_dataSize(0),
+          m_pData(nullptr),
+          m_textureSize(0),
           m_visualSampleRate(0),
           m_audioVisualRatio(0),
           m_textureStride(computeTextureStride(0)),
-          m_completion(-1) {
+          m_completion(-1),
+          m_summaryLevelCount(0) {
     readByteArray(data);
 }
 
@@ -38,10 +128,13 @@ Waveform::Waveform(
         : m_id(-1),
           m_saveState(SaveState::NotSaved),
           m_dataSize(0),
+          m_pData(nullptr),
+          m_textureSize(0),
           m_visualSampleRate(0),
           m_audioVisualRatio(0),
           m_textureStride(1024),
           m_completion(-1),
+          m_summaryLevelCount(0),
           m_stemCount(stemCount) {
     int numberOfVisualSamples = 0;
     if (audioSampleRate > 0) {
@@ -236,18 +329,192 @@ void Waveform::readByteArray(const QByteArray& data) {
 
     m_completion = dataSize;
     m_saveState = SaveState::Saved;
+    rebuildSummaryPyramid();
+}
+
+bool Waveform::saveToFlatFile(const QString& filePath) const {
+    const auto locker = lockMutex(&m_mutex);
+    // Only waveforms built in memory can be written. A mapped waveform
+    // originates from a flat file and never needs to be saved again.
+    if (m_data.empty()) {
+        return false;
+    }
+
+    FlatWaveformHeader header = {};
+    std::memcpy(header.magic, FlatWaveformHeader::kMagic, sizeof(header.magic));
+    header.version = FlatWaveformHeader::kVersion;
+    header.recordSize = sizeof(WaveformData);
+    header.dataSize = m_dataSize;
+    header.textureStride = m_textureStride;
+    header.stemCount = m_stemCount;
+    header.visualSampleRate = m_visualSampleRate;
+    header.audioVisualRatio = m_audioVisualRatio;
+
+    // Write to a temporary file first and atomically rename it afterwards
+    // so that readers never observe a partially written file.
+    const QString tempFilePath = filePath + QStringLiteral(".tmp");
+    QFile tempFile(tempFilePath);
+    if (!tempFile.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    const qint64 recordBytes =
+            static_cast<qint64>(m_data.size()) * sizeof(WaveformData);
+    if (tempFile.write(reinterpret_cast<const char*>(&header),
+                sizeof(header)) != sizeof(header) ||
+            tempFile.write(reinterpret_cast<const char*>(m_data.data()),
+                    recordBytes) != recordBytes) {
+        tempFile.close();
+        tempFile.remove();
+        return false;
+    }
+    tempFile.close();
+    QFile::remove(filePath);
+    return tempFile.rename(filePath);
+}
+
+bool Waveform::mapFlatFile(const QString& filePath) {
+    DEBUG_ASSERT(m_data.empty());
+    auto pFile = std::make_unique<QFile>(filePath);
+    if (!pFile->open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    FlatWaveformHeader header;
+    if (!readAndValidateFlatHeader(pFile.get(), &header)) {
+        qDebug() << "ERROR: Invalid flat waveform file" << filePath;
+        return false;
+    }
+
+    const uchar* pMapped = pFile->map(0, pFile->size());
+    if (!pMapped) {
+        qDebug() << "ERROR: Could not map flat waveform file" << filePath;
+        return false;
+    }
+
+    m_dataSize = header.dataSize;
+    m_textureStride = header.textureStride;
+    m_textureSize = static_cast<int>(
+            static_cast<qint64>(header.textureStride) * header.textureStride);
+    m_stemCount = header.stemCount;
+    m_visualSampleRate = header.visualSampleRate;
+    m_audioVisualRatio = header.audioVisualRatio;
+    m_pData = reinterpret_cast<const WaveformData*>(pMapped + sizeof(header));
+    // The mapping stays valid until the file object is destroyed together
+    // with this waveform.
+    m_pMappedFile = std::move(pFile);
+
+    m_completion = m_dataSize;
+    m_saveState = SaveState::Saved;
+    rebuildSummaryPyramid();
+    return true;
+}
+
+void Waveform::rebuildSummaryPyramid() {
+    DEBUG_ASSERT(m_summaryLevelCount.loadAcquire() == 0);
+    constexpr int base = 1 << kSummaryBaseShift;
+    const int frameCount = m_dataSize / 2;
+    if (frameCount < 2 * base) {
+        // Too small for the decimation to pay off, readers keep scanning
+        // the raw data.
+        return;
+    }
+
+    const int baseEntryCount = (frameCount + base - 1) >> kSummaryBaseShift;
+    std::vector<WaveformSummaryData> baseLevel(baseEntryCount);
+    for (int entry = 0; entry < baseEntryCount; ++entry) {
+        WaveformSummaryData maxData = {};
+        const int endFrame =
+                math_min((entry + 1) << kSummaryBaseShift, frameCount);
+        for (int frame = entry << kSummaryBaseShift; frame < endFrame; ++frame) {
+            maxAccumulateFrame(&maxData, m_pData, frame);
+        }
+        baseLevel[entry] = maxData;
+    }
+    m_summaryPyramid.push_back(std::move(baseLevel));
+
+    // Every further level halves the previous one by pairwise maxima. The
+    // compiler turns these byte maxima into vectorized min/max operations.
+    while (m_summaryPyramid.back().size() > 1) {
+        const std::vector<WaveformSummaryData>& lowerLevel =
+                m_summaryPyramid.back();
+        const int lowerEntryCount = static_cast<int>(lowerLevel.size());
+        std::vector<WaveformSummaryData> upperLevel((lowerEntryCount + 1) / 2);
+        for (int entry = 0; entry < lowerEntryCount / 2; ++entry) {
+            WaveformSummaryData maxData = lowerLevel[entry * 2];
+            maxAccumulate(&maxData, lowerLevel[entry * 2 + 1]);
+            upperLevel[entry] = maxData;
+        }
+        if (lowerEntryCount % 2) {
+            upperLevel.back() = lowerLevel.back();
+        }
+        m_summaryPyramid.push_back(std::move(upperLevel));
+    }
+    m_summaryLevelCount.storeRelease(
+            static_cast<int>(m_summaryPyramid.size()));
+}
+
+WaveformSummaryData Waveform::absMaxBandsInRange(
+        int firstVisualFrame, int endVisualFrame) const {
+    WaveformSummaryData maxData = {};
+    const int frameCount = m_dataSize / 2;
+    firstVisualFrame = math_clamp(firstVisualFrame, 0, frameCount);
+    endVisualFrame = math_clamp(endVisualFrame, 0, frameCount);
+    int frame = firstVisualFrame;
+    const int levelCount = m_summaryLevelCount.loadAcquire();
+    if (levelCount > 0) {
+        constexpr int base = 1 << kSummaryBaseShift;
+        // Scan the raw data until the first entry boundary.
+        while (frame < endVisualFrame && (frame & (base - 1)) != 0) {
+            maxAccumulateFrame(&maxData, m_pData, frame++);
+        }
+        while (endVisualFrame - frame >= base) {
+            // Greedily pick the largest level whose entry starts at the
+            // current frame and is fully contained in the remaining range.
+            int level = 0;
+            while (level + 1 < levelCount &&
+                    (frame & ((base << (level + 1)) - 1)) == 0 &&
+                    endVisualFrame - frame >= (base << (level + 1))) {
+                ++level;
+            }
+            maxAccumulate(&maxData,
+                    m_summaryPyramid[level]
+                                    [frame >> (kSummaryBaseShift + level)]);
+            frame += base << level;
+        }
+    }
+    // The unaligned tail of the range, or the whole range while the
+    // pyramid has not been built yet.
+    while (frame < endVisualFrame) {
+        maxAccumulateFrame(&maxData, m_pData, frame++);
+    }
+    return maxData;
+}
+
+// static
+bool Waveform::isValidFlatFile(const QString& filePath) {
+    QFile file(filePath);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    FlatWaveformHeader header;
+    return readAndValidateFlatHeader(&file, &header);
 }
 
 void Waveform::resize(int size) {
     m_dataSize = size;
     m_textureStride = computeTextureStride(size);
     m_data.resize(m_textureStride * m_textureStride);
+    m_accountedMemory.reset(m_data.size() * sizeof(WaveformData));
+    m_pData = m_data.data();
+    m_textureSize = static_cast<int>(m_data.size());
 }
 
 void Waveform::assign(int size) {
     m_dataSize = size;
     m_textureStride = computeTextureStride(size);
     m_data.assign(m_textureStride * m_textureStride, {});
+    m_accountedMemory.reset(m_data.size() * sizeof(WaveformData));
+    m_pData = m_data.data();
+    m_textureSize = static_cast<int>(m_data.size());
     m_saveState = SaveState::SavePending;
 }
 
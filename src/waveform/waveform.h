@@ -5,12 +5,16 @@
 #include <QMutex>
 #include <QSharedPointer>
 #include <QString>
+#include <memory>
 #include <vector>
 
 #include "analyzer/constants.h"
 #include "audio/signalinfo.h"
 #include "util/class.h"
 #include "util/compatibility/qmutex.h"
+#include "util/memoryaccounting.h"
+
+class QFile;
 
 enum BandIndex { AllBand = 0,
     Low = 1,
@@ -31,6 +35,17 @@ struct WaveformData {
     unsigned char stems[mixxx::kMaxSupportedStems];
 };
 
+// Per-channel maxima of the filter bands over a range of visual frames.
+// Used for the entries of the decimated summary pyramid built by
+// Waveform::rebuildSummaryPyramid() and returned by
+// Waveform::absMaxBandsInRange().
+struct WaveformSummaryData {
+    unsigned char low[ChannelCount];
+    unsigned char mid[ChannelCount];
+    unsigned char high[ChannelCount];
+    unsigned char all[ChannelCount];
+};
+
 class Waveform {
   public:
     enum class SaveState {
@@ -81,6 +96,21 @@ class Waveform {
 
     QByteArray toByteArray() const;
 
+    // Writes the waveform as a versioned flat binary file of fixed-stride
+    // WaveformData records that can later be memory-mapped with
+    // mapFlatFile(). Returns false on I/O errors.
+    bool saveToFlatFile(const QString& filePath) const;
+
+    // Memory-maps the given flat binary waveform file and renders directly
+    // from the mapped records without a deserialize/copy step. Returns
+    // false and leaves the waveform empty if the file is missing or
+    // malformed.
+    bool mapFlatFile(const QString& filePath);
+
+    // Cheap validation that only inspects the fixed-size file header
+    // without reading any of the sample data.
+    static bool isValidFlatFile(const QString& filePath);
+
     SaveState saveState() const {
         return m_saveState;
     }
@@ -102,36 +132,60 @@ class Waveform {
     int getCompletion() const {
         return m_completion.loadAcquire();
     }
+    // The completion counter publishes the data elements written so far to
+    // readers in other threads, i.e. it allows painting the already analyzed
+    // prefix of a waveform while the analysis is still running. The release
+    // store pairs with the acquire load in getCompletion() and guarantees
+    // that all data elements below the stored completion are visible to the
+    // reader.
     void setCompletion(int completion) {
-        m_completion = completion;
+        m_completion.storeRelease(completion);
     }
 
     // We do not lock the mutex since m_textureStride is not changed after
     // the constructor runs.
     inline int getTextureStride() const { return m_textureStride; }
 
-    // We do not lock the mutex since m_data is not resized after the
+    // We do not lock the mutex since m_textureSize is not changed after the
     // constructor runs.
-    inline int getTextureSize() const { return static_cast<int>(m_data.size()); }
+    inline int getTextureSize() const { return m_textureSize; }
 
     // Atomically get the number of data elements in this Waveform. We do not
     // lock the mutex since m_dataSize is not changed after the constructor
     // runs.
     inline int getDataSize() const { return m_dataSize; }
 
-    inline const WaveformData& get(int i) const { return m_data[i];}
-    inline unsigned char getLow(int i) const { return m_data[i].filtered.low;}
-    inline unsigned char getMid(int i) const { return m_data[i].filtered.mid;}
-    inline unsigned char getHigh(int i) const { return m_data[i].filtered.high;}
-    inline unsigned char getAll(int i) const { return m_data[i].filtered.all;}
+    inline const WaveformData& get(int i) const { return m_pData[i];}
+    inline unsigned char getLow(int i) const { return m_pData[i].filtered.low;}
+    inline unsigned char getMid(int i) const { return m_pData[i].filtered.mid;}
+    inline unsigned char getHigh(int i) const { return m_pData[i].filtered.high;}
+    inline unsigned char getAll(int i) const { return m_pData[i].filtered.all;}
 
     // We do not lock the mutex since m_data is not resized after the
     // constructor runs.
     WaveformData* data() { return &m_data[0];}
 
-    // We do not lock the mutex since m_data is not resized after the
+    // We do not lock the mutex since m_pData is not changed after the
     // constructor runs.
-    const WaveformData* data() const { return &m_data[0];}
+    const WaveformData* data() const { return m_pData;}
+
+    // Number of visual frames covered by one entry of the lowest summary
+    // pyramid level. Every further level doubles the covered range.
+    static constexpr int kSummaryBaseShift = 3;
+
+    // Builds the hierarchical per-band maxima over the complete waveform
+    // data. Must be called once after all data elements have been written;
+    // the pyramid is published to readers in other threads with an atomic
+    // store analogous to setCompletion().
+    void rebuildSummaryPyramid();
+
+    // Returns the per-channel maxima of each filter band over the visual
+    // frame range [firstVisualFrame, endVisualFrame). Reads the summary
+    // pyramid for the aligned middle of the range and only scans the raw
+    // data at the unaligned edges, or over the whole range while the
+    // pyramid has not been built yet (i.e. during a running analysis).
+    WaveformSummaryData absMaxBandsInRange(
+            int firstVisualFrame, int endVisualFrame) const;
 
     bool hasStem() const {
         return m_stemCount > 0;
@@ -169,6 +223,20 @@ class Waveform {
     // TODO(XXX): In the future we should switch to QVector and use the raw data
     // pointer when performance matters.
     std::vector<WaveformData> m_data;
+    // Reports the size of m_data to the memory accounting, see
+    // MemoryAccounting.
+    mixxx::AccountedMemory m_accountedMemory{mixxx::MemoryAccounting::Tag::Waveforms};
+    // Read access goes through this pointer. It either points into m_data
+    // for waveforms built in memory or into the mapped region of a flat
+    // binary waveform file. Not allowed to change after the constructor
+    // (or mapFlatFile()) runs.
+    const WaveformData* m_pData;
+    // The number of WaveformData records available for reading through
+    // m_pData, including the padding up to m_textureStride squared.
+    int m_textureSize;
+    // Keeps the memory mapping of a flat binary waveform file alive.
+    // Destroying the file object releases the mapping.
+    std::unique_ptr<QFile> m_pMappedFile;
     // Not allowed to change after the constructor runs.
     double m_visualSampleRate;
     // Not allowed to change after the constructor runs.
@@ -182,6 +250,17 @@ class Waveform {
     // the mutex. The completion of the waveform calculation.
     QAtomicInt m_completion;
 
+    // Power-of-two decimated per-band maxima of the waveform data. Entry j
+    // of level l holds the maxima over the visual frames
+    // [j << (kSummaryBaseShift + l), (j + 1) << (kSummaryBaseShift + l)).
+    // Not allowed to change after rebuildSummaryPyramid() has published it.
+    std::vector<std::vector<WaveformSummaryData>> m_summaryPyramid;
+    // The number of built pyramid levels. The release store in
+    // rebuildSummaryPyramid() pairs with the acquire load in
+    // absMaxBandsInRange() and guarantees that all published levels are
+    // visible to the reader, analogous to m_completion.
+    QAtomicInt m_summaryLevelCount;
+
     // The number of stem contained in waveform samples. 0 if not a stem waveform
     int m_stemCount;
 
@@ -4,7 +4,21 @@
 // static
 Waveform* WaveformFactory::loadWaveformFromAnalysis(
         const AnalysisDao::AnalysisInfo& analysis) {
-    Waveform* pWaveform = new Waveform(analysis.data);
+    Waveform* pWaveform;
+    if (!analysis.flatDataPath.isEmpty()) {
+        // Fast path: Memory-map the flat binary waveform file beside the
+        // database instead of parsing the serialized protobuf blob.
+        pWaveform = new Waveform();
+        if (!pWaveform->mapFlatFile(analysis.flatDataPath)) {
+            // Fall back to the serialized blob, if available. AnalysisDao
+            // skips loading the blob after validating the flat file header,
+            // so this only happens when the file vanished in between.
+            delete pWaveform;
+            pWaveform = new Waveform(analysis.data);
+        }
+    } else {
+        pWaveform = new Waveform(analysis.data);
+    }
     pWaveform->setId(analysis.analysisId);
     pWaveform->setVersion(analysis.version);
     pWaveform->setDescription(analysis.description);
@@ -69,6 +69,12 @@ bool shouldRenderWaveform(WaveformWidgetAbstract* pWaveformWidget) {
     return glw->shouldRender();
 }
 
+// Idle waveform widgets (visible, but displaying an unchanged image, e.g.
+// paused decks) are only repainted every n-th frame, so that overlay edits
+// such as new cues or loops still show up promptly. At the default 60 fps
+// this is a 10 Hz refresh.
+constexpr int kIdleRedrawIntervalFrames = 6;
+
 const QRegularExpression openGLVersionRegex(QStringLiteral("^(\\d+)\\.(\\d+).*$"));
 
 const QString kWaveformGroup(QStringLiteral("[Waveform]"));
@@ -126,6 +132,7 @@ WaveformWidgetFactory::WaveformWidgetFactory()
           m_configType(WaveformWidgetType::Empty),
           m_config(nullptr),
           m_skipRender(false),
+          m_idleFrameCnt(0),
           m_frameRate(60),
           m_endOfTrackWarningTime(30),
           m_defaultZoom(WaveformWidgetRenderer::s_waveformDefaultZoom),
@@ -808,22 +815,35 @@ void WaveformWidgetFactory::renderSelf() {
 
     if (!m_skipRender) {
         if (m_type) {   // no regular updates for an empty waveform
+            // Idle widgets are only repainted on every n-th frame. The
+            // VSync test pattern animates every frame without any visual
+            // state, so it must never be considered idle.
+            const bool idleRedraw = m_idleFrameCnt == 0 ||
+                    m_type == WaveformWidgetType::VSyncTest;
+            m_idleFrameCnt = (m_idleFrameCnt + 1) % kIdleRedrawIntervalFrames;
+
             // next rendered frame is displayed after next buffer swap and than after VSync
-            QVarLengthArray<bool, 10> shouldRenderWaveforms(
-                    static_cast<int>(m_waveformWidgetHolders.size()));
+            m_renderedWaveforms.assign(m_waveformWidgetHolders.size(), false);
             for (decltype(m_waveformWidgetHolders)::size_type i = 0;
                     i < m_waveformWidgetHolders.size();
                     i++) {
                 WaveformWidgetAbstract* pWaveformWidget = m_waveformWidgetHolders[i].m_waveformWidget;
                 // Don't bother doing the pre-render work if we aren't going to
                 // render this widget.
-                bool shouldRender = shouldRenderWaveform(pWaveformWidget);
-                shouldRenderWaveforms[static_cast<int>(i)] = shouldRender;
-                if (!shouldRender) {
+                if (!shouldRenderWaveform(pWaveformWidget)) {
                     continue;
                 }
                 // Calculate play position for the new Frame in following run
                 pWaveformWidget->preRender(m_vsyncThread);
+                // An idle widget (e.g. a paused deck) would redraw the very
+                // same image. Skip it until the next idle redraw picks up
+                // overlay edits like cue or loop changes that are not part
+                // of the tracked visual state.
+                if (!idleRedraw && !pWaveformWidget->visualStateChanged()) {
+                    continue;
+                }
+                pWaveformWidget->markRendered();
+                m_renderedWaveforms[i] = true;
             }
             //qDebug() << "prerender" << m_vsyncThread->elapsed();
 
@@ -834,7 +854,7 @@ void WaveformWidgetFactory::renderSelf() {
                     i < m_waveformWidgetHolders.size();
                     i++) {
                 WaveformWidgetAbstract* pWaveformWidget = m_waveformWidgetHolders[i].m_waveformWidget;
-                if (!shouldRenderWaveforms[static_cast<int>(i)]) {
+                if (!m_renderedWaveforms[i]) {
                     continue;
                 }
                 pWaveformWidget->render();
@@ -885,8 +905,17 @@ void WaveformWidgetFactory::swapSelf() {
         if (m_type) {   // no regular updates for an empty waveform
             // Show rendered buffer from last render() run
             //qDebug() << "swap() start" << m_vsyncThread->elapsed();
-            for (const auto& holder : std::as_const(m_waveformWidgetHolders)) {
-                WaveformWidgetAbstract* pWaveformWidget = holder.m_waveformWidget;
+            for (decltype(m_waveformWidgetHolders)::size_type i = 0;
+                    i < m_waveformWidgetHolders.size();
+                    i++) {
+                WaveformWidgetAbstract* pWaveformWidget = m_waveformWidgetHolders[i].m_waveformWidget;
+
+                // Only swap widgets that the last render() run actually
+                // rendered, swapping an unrendered double-buffered widget
+                // would bring back the frame before the last one.
+                if (i < m_renderedWaveforms.size() && !m_renderedWaveforms[i]) {
+                    continue;
+                }
 
                 // Don't swap invalid / invisible widgets or widgets with an
                 // unexposed window. Prevents continuous log spew of
@@ -321,6 +321,13 @@ class WaveformWidgetFactory : public QObject,
     UserSettingsPointer m_config;
 
     bool m_skipRender;
+    // Counts frames between the periodic redraws of idle waveform widgets.
+    int m_idleFrameCnt;
+    // Which widgets in m_waveformWidgetHolders were rendered in the last
+    // renderSelf() run, so swapSelf() only swaps those. Swapping an
+    // unrendered double-buffered widget would bring back the frame before
+    // the last one.
+    std::vector<bool> m_renderedWaveforms;
     int m_frameRate;
     int m_endOfTrackWarningTime;
     double m_defaultZoom;
@@ -167,6 +167,14 @@ void WaveformWidget::castToQWidget() {
 }
 
 void WaveformWidget::initializeGL() {
+    // Warm up the render pipeline while the context is being set up, during
+    // skin loading: initializing the nodes compiles and links the shaders of
+    // all materials used by this widget type (cached process-wide, so each
+    // shader permutation is only compiled once across widgets). Without this
+    // the engine would initialize the nodes lazily on the first render, which
+    // causes a noticeable hitch on the first paint, e.g. when the first track
+    // is loaded after startup.
+    m_pEngine->initialize();
 }
 
 void WaveformWidget::resizeRenderer(int, int, float) {
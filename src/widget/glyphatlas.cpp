@@ -0,0 +1,112 @@
+#include "widget/glyphatlas.h"
+
+#include <QFontMetricsF>
+#include <QHash>
+#include <QPainter>
+
+#include <cmath>
+#include <memory>
+
+namespace {
+
+// The glyphs of the formats produced by mixxx::Duration and the numeric
+// widgets: digits, the time separators, sign, decimal point/comma,
+// percent and space.
+const QString kAtlasChars = QStringLiteral("0123456789:.-+%, ");
+
+} // namespace
+
+// static
+const GlyphAtlas* GlyphAtlas::obtain(
+        const QFont& font, const QColor& color, qreal devicePixelRatio) {
+    // A skin only uses a handful of font/color combinations for its
+    // numeric displays, so the cache stays small and is never pruned.
+    static QHash<QString, std::unique_ptr<GlyphAtlas>> s_atlases;
+    const QString key = QStringLiteral("%1|%2|%3")
+                                .arg(font.key(),
+                                        QString::number(color.rgba()),
+                                        QString::number(devicePixelRatio));
+    auto it = s_atlases.find(key);
+    if (it == s_atlases.end()) {
+        it = s_atlases.insert(key,
+                std::unique_ptr<GlyphAtlas>(
+                        new GlyphAtlas(font, color, devicePixelRatio)));
+    }
+    return it.value().get();
+}
+
+GlyphAtlas::GlyphAtlas(const QFont& font, const QColor& color, qreal devicePixelRatio)
+        : m_devicePixelRatio(devicePixelRatio) {
+    const QFontMetricsF metrics(font);
+    m_height = metrics.height();
+
+    qreal offset = 0;
+    m_glyphs.resize(kAtlasChars.size());
+    for (int i = 0; i < kAtlasChars.size(); ++i) {
+        Glyph& glyph = m_glyphs[i];
+        glyph.offset = offset;
+        glyph.advance = metrics.horizontalAdvance(kAtlasChars.at(i));
+        // Round each cell up to whole device pixels so that blitting
+        // never samples a neighboring glyph.
+        offset += std::ceil(glyph.advance * devicePixelRatio);
+    }
+
+    m_pixmap = QPixmap(static_cast<int>(offset),
+            static_cast<int>(std::ceil(m_height * devicePixelRatio)));
+    m_pixmap.setDevicePixelRatio(devicePixelRatio);
+    m_pixmap.fill(Qt::transparent);
+    m_accountedMemory.reset(static_cast<std::size_t>(m_pixmap.width()) *
+            m_pixmap.height() * m_pixmap.depth() / 8);
+
+    QPainter painter(&m_pixmap);
+    painter.setFont(font);
+    painter.setPen(color);
+    for (int i = 0; i < kAtlasChars.size(); ++i) {
+        painter.drawText(
+                QPointF(m_glyphs[i].offset / devicePixelRatio, metrics.ascent()),
+                kAtlasChars.at(i));
+    }
+}
+
+// static
+int GlyphAtlas::indexOf(QChar ch) {
+    return kAtlasChars.indexOf(ch);
+}
+
+bool GlyphAtlas::canRender(const QString& text) const {
+    for (const QChar ch : text) {
+        if (indexOf(ch) < 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+qreal GlyphAtlas::advance(const QString& text) const {
+    qreal advance = 0;
+    for (const QChar ch : text) {
+        const int index = indexOf(ch);
+        if (index >= 0) {
+            advance += m_glyphs[index].advance;
+        }
+    }
+    return advance;
+}
+
+void GlyphAtlas::draw(QPainter* pPainter, QPointF topLeft, const QString& text) const {
+    const qreal cellHeight = m_height * m_devicePixelRatio;
+    for (const QChar ch : text) {
+        const int index = indexOf(ch);
+        if (index < 0) {
+            continue;
+        }
+        const Glyph& glyph = m_glyphs[index];
+        pPainter->drawPixmap(topLeft,
+                m_pixmap,
+                QRectF(glyph.offset,
+                        0,
+                        std::ceil(glyph.advance * m_devicePixelRatio),
+                        cellHeight));
+        topLeft.rx() += glyph.advance;
+    }
+}
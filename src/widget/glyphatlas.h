@@ -0,0 +1,72 @@
+#pragma once
+
+#include <QColor>
+#include <QFont>
+#include <QPixmap>
+#include <QString>
+
+#include <vector>
+
+#include "util/memoryaccounting.h"
+
+class QPainter;
+
+/// Prerendered atlas of the glyphs used by numeric displays (digits and
+/// the few punctuation characters of time, BPM and dB formats) for one
+/// combination of font, text color and device pixel ratio.
+///
+/// Painting a label through QPainter::drawText() builds a QTextLayout
+/// and shapes the text on every single paint, which dominates the GUI
+/// profile for displays that repaint at the visual frame rate (elapsed/
+/// remaining time, BPM). Blitting the prerendered glyphs instead reduces
+/// a repaint to a handful of pixmap copies.
+///
+/// Atlases are shared between all widgets with the same font, color and
+/// device pixel ratio via obtain(). Must only be used from the GUI
+/// thread.
+class GlyphAtlas {
+  public:
+    /// Get the shared atlas for the given font, text color and device
+    /// pixel ratio, rendering it on first use.
+    static const GlyphAtlas* obtain(
+            const QFont& font, const QColor& color, qreal devicePixelRatio);
+
+    /// Returns true if the text consists only of glyphs contained in
+    /// the atlas. Texts with other characters have to be painted
+    /// through the regular text layout path.
+    bool canRender(const QString& text) const;
+
+    /// Horizontal advance of the text in logical pixels.
+    qreal advance(const QString& text) const;
+
+    /// Line height of the font in logical pixels.
+    qreal height() const {
+        return m_height;
+    }
+
+    /// Blit the glyphs of the text with its top-left corner at the
+    /// given position.
+    void draw(QPainter* pPainter, QPointF topLeft, const QString& text) const;
+
+  private:
+    GlyphAtlas(const QFont& font, const QColor& color, qreal devicePixelRatio);
+
+    struct Glyph {
+        // Horizontal offset into the atlas pixmap in device pixels
+        qreal offset;
+        // Advance in logical pixels
+        qreal advance;
+    };
+
+    // Index of a character in m_glyphs or -1 if it is not part of the
+    // atlas.
+    static int indexOf(QChar ch);
+
+    QPixmap m_pixmap;
+    // Reports the pixmap size to the memory accounting, see
+    // MemoryAccounting.
+    mixxx::AccountedMemory m_accountedMemory{mixxx::MemoryAccounting::Tag::Gui};
+    qreal m_devicePixelRatio;
+    qreal m_height;
+    std::vector<Glyph> m_glyphs;
+};
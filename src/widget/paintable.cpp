@@ -252,6 +252,19 @@ void Paintable::drawInternal(const QRectF& targetRect, QPainter* pPainter,
             if (!m_pPixmap ||
                     m_pPixmap->size() != targetRect.size().toSize() ||
                     m_lastSourceRect != sourceRect) {
+                if (s_resizeInProgress && m_pPixmap && !m_pPixmap->isNull() &&
+                        m_lastSourceRect == sourceRect) {
+                    // During an interactive resize every step would
+                    // re-rasterize the SVG at the new intermediate size,
+                    // which dominates the per-step layout cost of
+                    // SVG-heavy skins. Scale the previous rendering
+                    // instead; the final size is rendered crisply by the
+                    // repaint that MixxxMainWindow schedules once the
+                    // resize has settled.
+                    pPainter->drawPixmap(
+                            targetRect, *m_pPixmap, QRectF(m_pPixmap->rect()));
+                    return;
+                }
                 // qDebug() << "Paintable cache miss";
                 qreal devicePixelRatio = pPainter->device()->devicePixelRatio();
                 m_pPixmap = std::make_unique<QPixmap>(
@@ -49,6 +49,16 @@ class Paintable {
     static DrawMode DrawModeFromString(const QString& str);
     static QString DrawModeToString(DrawMode mode);
 
+    /// While an interactive window resize is in progress, SVG-backed
+    /// paintables serve cache misses by scaling their previously rendered
+    /// pixmap instead of re-rasterizing the SVG at every intermediate
+    /// size. MixxxMainWindow toggles this flag and schedules one full
+    /// repaint once the resize has settled, which replaces the scaled
+    /// stand-ins with crisp renderings at the final size.
+    static void setResizeInProgress(bool inProgress) {
+        s_resizeInProgress = inProgress;
+    }
+
   private:
     void drawInternal(const QRectF& targetRect, QPainter* pPainter,
                       const QRectF& sourceRect);
@@ -58,4 +68,6 @@ class Paintable {
     std::unique_ptr<QSvgRenderer> m_pSvg;
     DrawMode m_drawMode;
     QRectF m_lastSourceRect;
+
+    static inline bool s_resizeInProgress = false;
 };
@@ -103,8 +103,15 @@ void WLabel::setText(const QString& text) {
         m_widthHint = metrics.size(0, m_longText).width() + 2 * frameWidth();
         QString elidedText = metrics.elidedText(
                 m_longText, m_elideMode, width() - 2 * frameWidth());
-        QLabel::setText(elidedText);
-    } else {
+        if (elidedText != QLabel::text()) {
+            QLabel::setText(elidedText);
+        }
+    } else if (m_longText != QLabel::text()) {
+        // QLabel::setText() re-layouts and repaints unconditionally.
+        // Widgets that reformat on every update tick (time displays,
+        // BPM) frequently produce an unchanged text, e.g. with
+        // seconds precision, so skipping the no-op saves both the
+        // layout and the repaint.
         QLabel::setText(m_longText);
     }
 }
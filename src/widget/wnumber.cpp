@@ -1,7 +1,10 @@
 #include "widget/wnumber.h"
 
+#include <QPainter>
+
 #include "moc_wnumber.cpp"
 #include "skin/legacy/skincontext.h"
+#include "widget/glyphatlas.h"
 
 WNumber::WNumber(QWidget* pParent)
         : WLabel(pParent),
@@ -30,3 +33,32 @@ void WNumber::setValue(double dValue) {
         setText(m_skinText + QString::number(dValue, 'f', m_iNoDigits));
     }
 }
+
+void WNumber::paintEvent(QPaintEvent* pEvent) {
+    const QString displayText = QLabel::text();
+    const GlyphAtlas* pAtlas = GlyphAtlas::obtain(font(),
+            palette().color(foregroundRole()),
+            devicePixelRatioF());
+    if (!pAtlas->canRender(displayText)) {
+        // Texts with characters outside of the atlas (skin prefixes,
+        // unit suffixes) take the regular layout path.
+        QLabel::paintEvent(pEvent);
+        return;
+    }
+
+    QPainter painter(this);
+    // Draws the stylesheet background and border like QLabel::paintEvent
+    drawFrame(&painter);
+
+    const QRect cr = contentsRect().adjusted(margin(), margin(), -margin(), -margin());
+    qreal x = cr.left();
+    if (alignment() & Qt::AlignRight) {
+        x = cr.right() + 1 - pAtlas->advance(displayText);
+    } else if (alignment() & Qt::AlignHCenter) {
+        x = cr.left() + (cr.width() - pAtlas->advance(displayText)) / 2;
+    }
+    // Center the line height vertically like QStyle::drawItemText()
+    // does for Qt::AlignVCenter.
+    const qreal y = cr.top() + (cr.height() - pAtlas->height()) / 2;
+    pAtlas->draw(&painter, QPointF(x, y), displayText);
+}
@@ -15,6 +15,10 @@ class WNumber : public WLabel  {
     virtual void setValue(double dValue);
 
   protected:
+    // Blits numeric texts from a prerendered glyph atlas instead of
+    // laying them out on every repaint, see GlyphAtlas.
+    void paintEvent(QPaintEvent* pEvent) override;
+
     // Number of digits to round to.
     int m_iNoDigits;
 };
@@ -10,6 +10,7 @@ WNumberPos::WNumberPos(const QString& group, QWidget* parent)
         : WNumber(parent),
           m_displayFormat(TrackTime::DisplayFormat::TRADITIONAL),
           m_dOldTimeElapsed(0.0) {
+    m_pVisualPlayPos = VisualPlayPosition::getVisualPlayPosition(group);
     m_pTimeElapsed = new ControlProxy(group, "time_elapsed", this, ControlFlag::NoAssertIfMissing);
     m_pTimeElapsed->connectValueChanged(this, &WNumberPos::slotSetTimeElapsed);
     m_pTimeRemaining = new ControlProxy(
@@ -57,7 +58,18 @@ void WNumberPos::setValue(double dValue) {
 }
 
 void WNumberPos::slotSetTimeElapsed(double dTimeElapsed) {
-    double dTimeRemaining = m_pTimeRemaining->get();
+    // Derive both times from one engine snapshot so the displayed pair is
+    // always consistent. The control change merely triggers the update;
+    // reading time_remaining separately here could pick up a value from a
+    // later audio callback than the elapsed time we were signaled with.
+    double dTimeRemaining;
+    VisualPlayPositionData snapshot;
+    if (m_pVisualPlayPos->getSnapshot(&snapshot)) {
+        dTimeRemaining = (1.0 - snapshot.m_playPos) * snapshot.m_tempoTrackSeconds;
+        dTimeElapsed = snapshot.m_tempoTrackSeconds - dTimeRemaining;
+    } else {
+        dTimeRemaining = m_pTimeRemaining->get();
+    }
     QString (*timeFormat)(double dSeconds, mixxx::Duration::Precision precision);
 
     if (m_displayFormat == TrackTime::DisplayFormat::KILO_SECONDS) {
@@ -3,6 +3,7 @@
 
 #include "wnumber.h"
 #include "preferences/dialog/dlgprefdeck.h"
+#include "waveform/visualplayposition.h"
 
 class ControlProxy;
 
@@ -28,6 +29,7 @@ class WNumberPos : public WNumber {
     TrackTime::DisplayFormat m_displayFormat;
 
     double m_dOldTimeElapsed;
+    QSharedPointer<VisualPlayPosition> m_pVisualPlayPos;
     ControlProxy* m_pTimeElapsed;
     ControlProxy* m_pTimeRemaining;
     ControlProxy* m_pShowTrackTimeRemaining;
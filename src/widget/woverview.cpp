@@ -69,6 +69,9 @@ WOverview::WOverview(
           m_trackLoaded(false),
           m_pHoveredMark(nullptr),
           m_scaleFactor(1.0),
+          m_marksLayerDirty(true),
+          m_marksLayerGain(0.0f),
+          m_playPosSnapshotValid(false),
           m_trackSampleRateControl(
                   m_group,
                   QStringLiteral("track_samplerate")),
@@ -78,6 +81,7 @@ WOverview::WOverview(
           m_playpositionControl(
                   m_group,
                   QStringLiteral("playposition")) {
+    m_pVisualPlayPos = VisualPlayPosition::getVisualPlayPosition(m_group);
     m_endOfTrackControl = make_parented<ControlProxy>(
             m_group, QStringLiteral("end_of_track"), this, ControlFlag::NoAssertIfMissing);
     m_endOfTrackControl->connectValueChanged(this, &WOverview::onEndOfTrackChange);
@@ -232,6 +236,9 @@ void WOverview::setup(const QDomNode& node, const SkinContext& context) {
         child = child.nextSibling();
     }
 
+    // The skin may have replaced the marks, ranges and label colors.
+    m_marksLayerDirty = true;
+
     DEBUG_ASSERT(m_pPassthroughLabel.get() != nullptr);
     m_pPassthroughLabel->setAlignment(Qt::AlignLeft | Qt::AlignVCenter);
     // Shown on the overview waveform when vinyl passthrough is enabled
@@ -333,12 +340,16 @@ void WOverview::slotWaveformSummaryUpdated() {
     }
     m_pWaveform = pTrack->getWaveformSummary();
     if (m_pWaveform) {
-        // If the waveform is already complete, just draw it.
         if (m_pWaveform->getCompletion() == m_pWaveform->getDataSize()) {
+            // The waveform is already complete, repaint it from scratch.
             m_actualCompletion = 0;
-            if (drawNextPixmapPart()) {
-                update();
-            }
+        }
+        // Paint the already analyzed prefix immediately. If the analysis is
+        // still running, the remainder is painted incrementally by
+        // onTrackAnalyzerProgress() as the analyzer publishes further summary
+        // strides through the completion counter of the shared waveform.
+        if (drawNextPixmapPart()) {
+            update();
         }
     } else {
         // Null waveform pointer means waveform was cleared.
@@ -371,6 +382,7 @@ void WOverview::slotTrackLoaded(TrackPointer pTrack) {
     m_trackLoaded = true;
     if (m_pCurrentTrack) {
         updateCues(m_pCurrentTrack->getCuePoints());
+        m_marksLayerDirty = true;
     }
     update();
 }
@@ -429,6 +441,7 @@ void WOverview::onMarkChanged(double v) {
     //qDebug() << "WOverview::onMarkChanged()" << v;
     if (m_pCurrentTrack) {
         updateCues(m_pCurrentTrack->getCuePoints());
+        m_marksLayerDirty = true;
         update();
     }
 }
@@ -436,6 +449,7 @@ void WOverview::onMarkChanged(double v) {
 void WOverview::onMarkRangeChange(double v) {
     Q_UNUSED(v);
     //qDebug() << "WOverview::onMarkRangeChange()" << v;
+    m_marksLayerDirty = true;
     update();
 }
 
@@ -571,7 +585,13 @@ void WOverview::mouseMoveEvent(QMouseEvent* e) {
         return;
     }
 
+    const WaveformMarkPointer pPrevHoveredMark = m_pHoveredMark;
     m_pHoveredMark = m_marks.findHoveredMark(e->pos(), m_orientation);
+    if (m_pHoveredMark != pPrevHoveredMark) {
+        // The hovered mark's label is drawn un-elided, so the marks layer
+        // needs to be re-rendered.
+        m_marksLayerDirty = true;
+    }
 
     // qDebug() << "WOverview::mouseMoveEvent" << e->pos();
     update();
@@ -687,6 +707,7 @@ void WOverview::mousePressEvent(QMouseEvent* e) {
 
 void WOverview::slotCueMenuPopupAboutToHide() {
     m_pHoveredMark.clear();
+    m_marksLayerDirty = true;
     update();
 }
 
@@ -694,6 +715,7 @@ void WOverview::leaveEvent(QEvent* pEvent) {
     Q_UNUSED(pEvent);
     if (!m_pCueMenuPopup->isVisible()) {
         m_pHoveredMark.clear();
+        m_marksLayerDirty = true;
     }
     m_bLeftClickDragging = false;
     m_bTimeRulerActive = false;
@@ -704,6 +726,11 @@ void WOverview::paintEvent(QPaintEvent* pEvent) {
     Q_UNUSED(pEvent);
     ScopedTimer t(QStringLiteral("WOverview::paintEvent"));
 
+    // Take one engine snapshot for the whole frame. All time labels below
+    // are derived from it, so they can not mix values from different audio
+    // callbacks.
+    m_playPosSnapshotValid = m_pVisualPlayPos->getSnapshot(&m_playPosSnapshot);
+
     QPainter painter(this);
     painter.fillRect(rect(), m_backgroundColor);
 
@@ -729,8 +756,12 @@ void WOverview::paintEvent(QPaintEvent* pEvent) {
             const auto gain = static_cast<CSAMPLE_GAIN>(length() - 2) /
                     static_cast<CSAMPLE_GAIN>(trackSamples);
 
-            drawRangeMarks(&painter, offset, gain);
-            drawMarks(&painter, offset, gain);
+            if (m_marksLayerDirty || gain != m_marksLayerGain ||
+                    m_marksLayerPixmap.size() != size() * m_devicePixelRatio) {
+                updateMarksLayer(offset, gain);
+            }
+            painter.drawPixmap(rect(), m_marksLayerPixmap);
+            updateHoveredMarkLabels(offset, gain);
             drawPickupPosition(&painter);
             drawTimeRuler(&painter);
             drawMarkLabels(&painter, offset, gain);
@@ -1021,8 +1052,6 @@ void WOverview::drawMarks(QPainter* pPainter, const float offset, const float ga
     // drawMarkLabels function so it can be called after drawCurrentPosition so
     // the view of labels is not obscured by the playhead.
 
-    bool markHovered = false;
-
     for (auto it = m_marks.cbegin(); it != m_marks.cend(); ++it) {
         PainterScope painterScope(pPainter);
         const WaveformMarkPointer& pMark = *it;
@@ -1171,72 +1200,101 @@ void WOverview::drawMarks(QPainter* pPainter, const float offset, const float ga
                     width(),
                     devicePixelRatioF());
         }
+    }
+}
 
-        // Show cue position when hovered
-        // The area it will be drawn in needs to be calculated here
-        // before drawMarkLabels so drawMarkLabels can avoid drawing
-        // labels over the cue position.
-        // This can happen for example if the user shows the cue position
-        // of a hotcue which is near the intro end position because the
-        // intro_end_position WaveformMark label is drawn at the top.
-        // However, the drawing of this text needs to happen in
-        // drawMarkLabels so none of the WaveformMark lines are drawn
-        // on top of the position text.
-
-        // WaveformMark::m_align refers to the alignment of the label,
-        // so if the label is on bottom draw the position text on top and
-        // vice versa.
-        if (pMark == m_pHoveredMark) {
-            Qt::Alignment valign = pMark->m_align & Qt::AlignVertical_Mask;
-            QPointF positionTextPoint(markPosition + 1.5, 0);
-            if (valign == Qt::AlignTop) {
-                positionTextPoint.setY(float(height()) - 0.5f);
-            } else {
-                positionTextPoint.setY(fontMetrics.height());
-            }
-
-            double markSamples = pMark->getSamplePosition();
-            double trackSamples = getTrackSamples();
-            double currentPositionSamples = m_playpositionControl.get() * trackSamples;
-            double markTime = samplePositionToSeconds(markSamples);
-            double markTimeRemaining = samplePositionToSeconds(trackSamples - markSamples);
-            double markTimeDistance = samplePositionToSeconds(markSamples - currentPositionSamples);
-            const QString cuePositionText = mixxx::Duration::formatTime(markTime) + " -" +
-                    mixxx::Duration::formatTime(markTimeRemaining);
-            QString cueTimeDistanceText = mixxx::Duration::formatTime(fabs(markTimeDistance));
-            // Cast to int to avoid confusingly switching from -0:00 to 0:00 as
-            // the playhead passes the cue
-            if (static_cast<int>(markTimeDistance) < 0) {
-                cueTimeDistanceText = "-" + cueTimeDistanceText;
-            }
+void WOverview::updateMarksLayer(const float offset, const float gain) {
+    const QSize layerSize = size() * m_devicePixelRatio;
+    if (m_marksLayerPixmap.size() != layerSize) {
+        m_marksLayerPixmap = QPixmap(layerSize);
+        m_marksLayerPixmap.setDevicePixelRatio(m_devicePixelRatio);
+    }
+    m_marksLayerPixmap.fill(Qt::transparent);
 
-            m_cuePositionLabel.prerender(positionTextPoint,
-                    QPixmap(),
-                    cuePositionText,
-                    markerFont,
-                    m_labelTextColor,
-                    m_labelBackgroundColor,
-                    width(),
-                    devicePixelRatioF());
+    QPainter painter(&m_marksLayerPixmap);
+    // Use the widget font so the label metrics match those of a painter
+    // operating directly on the widget.
+    painter.setFont(font());
+    drawRangeMarks(&painter, offset, gain);
+    drawMarks(&painter, offset, gain);
 
-            QPointF timeDistancePoint(positionTextPoint.x(),
-                    (fontMetrics.height() + height()) / 2);
+    m_marksLayerGain = gain;
+    m_marksLayerDirty = false;
+}
 
-            m_cueTimeDistanceLabel.prerender(timeDistancePoint,
-                    QPixmap(),
-                    cueTimeDistanceText,
-                    markerFont,
-                    m_labelTextColor,
-                    m_labelBackgroundColor,
-                    width(),
-                    devicePixelRatioF());
-            markHovered = true;
-        }
-    }
-    if (!markHovered) {
+void WOverview::updateHoveredMarkLabels(const float offset, const float gain) {
+    // Show cue position when hovered
+    // The area it will be drawn in needs to be calculated here
+    // before drawMarkLabels so drawMarkLabels can avoid drawing
+    // labels over the cue position.
+    // This can happen for example if the user shows the cue position
+    // of a hotcue which is near the intro end position because the
+    // intro_end_position WaveformMark label is drawn at the top.
+    // However, the drawing of this text needs to happen in
+    // drawMarkLabels so none of the WaveformMark lines are drawn
+    // on top of the position text.
+    const WaveformMarkPointer pMark = m_pHoveredMark;
+    if (pMark == nullptr) {
         m_cuePositionLabel.clear();
         m_cueTimeDistanceLabel.clear();
+        return;
     }
+
+    QFont markerFont = font();
+    markerFont.setPixelSize(static_cast<int>(m_iLabelFontSize * m_scaleFactor));
+    QFontMetricsF fontMetrics(markerFont);
+
+    const float markPosition = math_clamp(
+            offset + static_cast<float>(pMark->getSamplePosition()) * gain,
+            0.0f,
+            static_cast<float>(width()));
+
+    // WaveformMark::m_align refers to the alignment of the label,
+    // so if the label is on bottom draw the position text on top and
+    // vice versa.
+    Qt::Alignment valign = pMark->m_align & Qt::AlignVertical_Mask;
+    QPointF positionTextPoint(markPosition + 1.5, 0);
+    if (valign == Qt::AlignTop) {
+        positionTextPoint.setY(float(height()) - 0.5f);
+    } else {
+        positionTextPoint.setY(fontMetrics.height());
+    }
+
+    double markSamples = pMark->getSamplePosition();
+    double trackSamples = getTrackSamples();
+    double currentPositionSamples = m_playpositionControl.get() * trackSamples;
+    double markTime = samplePositionToSeconds(markSamples);
+    double markTimeRemaining = samplePositionToSeconds(trackSamples - markSamples);
+    double markTimeDistance = samplePositionToSeconds(markSamples - currentPositionSamples);
+    const QString cuePositionText = mixxx::Duration::formatTime(markTime) + " -" +
+            mixxx::Duration::formatTime(markTimeRemaining);
+    QString cueTimeDistanceText = mixxx::Duration::formatTime(fabs(markTimeDistance));
+    // Cast to int to avoid confusingly switching from -0:00 to 0:00 as
+    // the playhead passes the cue
+    if (static_cast<int>(markTimeDistance) < 0) {
+        cueTimeDistanceText = "-" + cueTimeDistanceText;
+    }
+
+    m_cuePositionLabel.prerender(positionTextPoint,
+            QPixmap(),
+            cuePositionText,
+            markerFont,
+            m_labelTextColor,
+            m_labelBackgroundColor,
+            width(),
+            devicePixelRatioF());
+
+    QPointF timeDistancePoint(positionTextPoint.x(),
+            (fontMetrics.height() + height()) / 2);
+
+    m_cueTimeDistanceLabel.prerender(timeDistancePoint,
+            QPixmap(),
+            cueTimeDistanceText,
+            markerFont,
+            m_labelTextColor,
+            m_labelBackgroundColor,
+            width(),
+            devicePixelRatioF());
 }
 
 void WOverview::drawPickupPosition(QPainter* pPainter) {
@@ -1564,6 +1622,17 @@ void WOverview::paintText(const QString& text, QPainter* pPainter) {
 }
 
 double WOverview::samplePositionToSeconds(double sample) {
+    // Prefer the engine snapshot taken at the start of paintEvent(): it
+    // already contains the track time at the current tempo, consistent
+    // with the play position drawn in this frame, and saves the two
+    // control reads below for every label.
+    if (m_playPosSnapshotValid && m_playPosSnapshot.m_tempoTrackSeconds > 0.0) {
+        const double trackSamples = getTrackSamples();
+        if (trackSamples > 0.0) {
+            return sample / trackSamples * m_playPosSnapshot.m_tempoTrackSeconds;
+        }
+    }
+
     double rate = m_pRateRatioControl->get();
     VERIFY_OR_DEBUG_ASSERT(rate != 0.0) {
         return 1;
@@ -1582,6 +1651,7 @@ void WOverview::resizeEvent(QResizeEvent* pEvent) {
 
     m_waveformImageScaled = QImage();
     m_diffGain = 0;
+    m_marksLayerDirty = true;
     Init();
 }
 
@@ -12,6 +12,7 @@
 #include "waveform/renderers/waveformmarkrange.h"
 #include "waveform/renderers/waveformmarkset.h"
 #include "waveform/renderers/waveformsignalcolors.h"
+#include "waveform/visualplayposition.h"
 #include "waveform/waveform.h"
 #include "widget/trackdroptarget.h"
 #include "widget/wcuemenupopup.h"
@@ -96,6 +97,12 @@ class WOverview : public WWidget, public TrackDropTarget {
     void drawAnalyzerProgress(QPainter* pPainter);
     void drawRangeMarks(QPainter* pPainter, const float& offset, const float& gain);
     void drawMarks(QPainter* pPainter, const float offset, const float gain);
+    // Re-render the cached marks layer from drawRangeMarks() and drawMarks()
+    void updateMarksLayer(const float offset, const float gain);
+    // Prerender the position and time-distance labels of the hovered mark.
+    // They follow the play position, so they are updated every frame while
+    // a mark is hovered instead of being baked into the marks layer.
+    void updateHoveredMarkLabels(const float offset, const float gain);
     void drawPickupPosition(QPainter* pPainter);
     void drawTimeRuler(QPainter* pPainter);
     void drawMarkLabels(QPainter* pPainter, const float offset, const float gain);
@@ -188,8 +195,24 @@ class WOverview : public WWidget, public TrackDropTarget {
     QImage m_waveformSourceImage;
     QImage m_waveformImageScaled;
 
+    // Prerendered layer with all mark lines, loop/jump range rectangles and
+    // range marks, composited over the waveform pixmap in paintEvent().
+    // It is only rebuilt when a mark, the hover state or the widget geometry
+    // changes, so the frequent repaints during playback (moving play position)
+    // and cue edits on long tracks do not re-render every mark.
+    QPixmap m_marksLayerPixmap;
+    bool m_marksLayerDirty;
+    float m_marksLayerGain;
+
     WaveformSignalColors m_signalColors;
 
+    // One engine snapshot per paintEvent(): all time labels drawn in a
+    // frame are derived from the same callback instead of repeated
+    // control reads that may tear between callbacks.
+    QSharedPointer<VisualPlayPosition> m_pVisualPlayPos;
+    VisualPlayPositionData m_playPosSnapshot;
+    bool m_playPosSnapshotValid;
+
     parented_ptr<ControlProxy> m_endOfTrackControl;
     parented_ptr<ControlProxy> m_pRateRatioControl;
     PollingControlProxy m_trackSampleRateControl;
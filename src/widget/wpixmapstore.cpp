@@ -6,6 +6,8 @@
 // static
 QHash<PixmapKey, WeakPaintablePointer> WPixmapStore::m_paintableCache;
 std::shared_ptr<ImgSource> WPixmapStore::m_loader = std::make_shared<ImgLoader>();
+QHash<QString, std::shared_ptr<QImage>> WPixmapStore::m_preloadedImages;
+QMutex WPixmapStore::m_preloadedImagesMutex;
 
 // static
 PaintablePointer WPixmapStore::getPaintable(const PixmapSource& source,
@@ -33,6 +35,14 @@ PaintablePointer WPixmapStore::getPaintable(const PixmapSource& source,
 std::unique_ptr<QPixmap> WPixmapStore::getPixmapNoCache(
         const QString& fileName,
         double scaleFactor) {
+    {
+        const QMutexLocker lock(&m_preloadedImagesMutex);
+        const auto it = m_preloadedImages.constFind(
+                preloadKey(fileName, scaleFactor));
+        if (it != m_preloadedImages.constEnd()) {
+            return std::make_unique<QPixmap>(QPixmap::fromImage(**it));
+        }
+    }
     auto* pImage = m_loader->getImage(fileName, scaleFactor);
     if (!pImage || pImage->isNull()) {
         return nullptr;
@@ -40,6 +50,28 @@ std::unique_ptr<QPixmap> WPixmapStore::getPixmapNoCache(
     return std::make_unique<QPixmap>(QPixmap::fromImage(*pImage));
 }
 
+// static
+QString WPixmapStore::preloadKey(const QString& fileName, double scaleFactor) {
+    return fileName + QChar('@') + QString::number(scaleFactor);
+}
+
+// static
+void WPixmapStore::preloadImage(const QString& fileName, double scaleFactor) {
+    std::shared_ptr<QImage> pImage(m_loader->getImage(fileName, scaleFactor));
+    if (!pImage || pImage->isNull()) {
+        return;
+    }
+    const QMutexLocker lock(&m_preloadedImagesMutex);
+    m_preloadedImages.insert(
+            preloadKey(fileName, scaleFactor), std::move(pImage));
+}
+
+// static
+void WPixmapStore::clearPreloadedImages() {
+    const QMutexLocker lock(&m_preloadedImagesMutex);
+    m_preloadedImages.clear();
+}
+
 // static
 void WPixmapStore::correctImageColors(QImage* p) {
     m_loader->correctImageColors(p);
@@ -56,4 +88,5 @@ void WPixmapStore::setLoader(std::shared_ptr<ImgSource> ld) {
     // loader has changed. The pixmaps will get freed once all the widgets
     // referring to them are destroyed.
     m_paintableCache.clear();
+    clearPreloadedImages();
 }
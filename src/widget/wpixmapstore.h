@@ -2,6 +2,7 @@
 
 #include <QHash>
 #include <QImage>
+#include <QMutex>
 #include <QPainter>
 #include <QPixmap>
 #include <QRectF>
@@ -45,7 +46,21 @@ class WPixmapStore {
     static void correctImageColors(QImage* p);
     static bool willCorrectColors();
 
+    // Decode an image into the preload cache. Unlike the other methods
+    // this may be called from worker threads, see SkinAssetPreloader.
+    static void preloadImage(const QString& fileName, double scaleFactor);
+    // Drop the preloaded images after skin loading has finished.
+    static void clearPreloadedImages();
+
   private:
+    static QString preloadKey(const QString& fileName, double scaleFactor);
+
     static QHash<PixmapKey, WeakPaintablePointer> m_paintableCache;
     static std::shared_ptr<ImgSource> m_loader;
+
+    // Images decoded ahead of widget construction, keyed by path and
+    // scale factor. Guarded by a mutex because the preloader fills this
+    // cache from a thread pool.
+    static QHash<QString, std::shared_ptr<QImage>> m_preloadedImages;
+    static QMutex m_preloadedImagesMutex;
 };
@@ -30,6 +30,8 @@ WSpinnyBase::WSpinnyBase(
           WBaseWidget(this),
           m_group(group),
           m_pConfig(pConfig),
+          m_iPendingRenders(0),
+          m_bSwapNeeded(false),
           m_pVisualPlayPos(VisualPlayPosition::getVisualPlayPosition(m_group)),
           m_pPlayPos(PollingControlProxy(m_group, QStringLiteral("playposition"))),
           m_pTrackSamples(PollingControlProxy(m_group, QStringLiteral("track_samples"))),
@@ -130,6 +132,7 @@ void WSpinnyBase::onVinylSignalQualityUpdate(const VinylSignalQualityReport& rep
 
     updateVinylSignalQualityImage(qual_color, report.scope);
     m_bDrawVinylSignalQuality = true;
+    m_iPendingRenders = 2;
 #else
     Q_UNUSED(report);
 #endif
@@ -174,6 +177,7 @@ void WSpinnyBase::setup(const QDomNode& node,
                 this,
                 [this](double v) {
                     m_bShowCover = v > 0.0;
+                    m_iPendingRenders = 2;
                 });
         m_bShowCover = m_pShowCoverProxy->get() > 0.0;
     } else {
@@ -226,6 +230,7 @@ void WSpinnyBase::setup(const QDomNode& node,
 void WSpinnyBase::setLoadedCover(const QPixmap& pixmap) {
     m_loadedCover = pixmap;
     m_loadedCoverScaled = scaleToSize(pixmap);
+    m_iPendingRenders = 2;
 }
 
 void WSpinnyBase::slotLoadTrack(TrackPointer pTrack) {
@@ -301,6 +306,10 @@ void WSpinnyBase::slotReloadCoverArt() {
 
 void WSpinnyBase::paintEvent(QPaintEvent* e) {
     Q_UNUSED(e);
+    // Force rerendering when render is called from the vsync thread, e.g. to
+    // get rid of artifacts after hiding and showing the widget or incomplete
+    // initial drawing. Use 2 passes, in case triple buffering is used.
+    m_iPendingRenders = 2;
 }
 
 void WSpinnyBase::render(VSyncThread* vSyncThread) {
@@ -318,23 +327,33 @@ void WSpinnyBase::render(VSyncThread* vSyncThread) {
     if (m_dAngleCurrentPlaypos != m_dAngleLastPlaypos) {
         m_fAngle = static_cast<float>(calculateAngle(m_dAngleCurrentPlaypos));
         m_dAngleLastPlaypos = m_dAngleCurrentPlaypos;
+        m_iPendingRenders = 2;
     }
 
     if (m_dGhostAngleCurrentPlaypos != m_dGhostAngleLastPlaypos) {
         m_fGhostAngle = static_cast<float>(calculateAngle(m_dGhostAngleCurrentPlaypos));
         m_dGhostAngleLastPlaypos = m_dGhostAngleCurrentPlaypos;
+        m_iPendingRenders = 2;
+    }
+
+    if (m_iPendingRenders == 0) {
+        return;
     }
 
     draw();
+
+    m_iPendingRenders--;
+    m_bSwapNeeded = true;
 }
 
 void WSpinnyBase::swap() {
-    if (!shouldRender()) {
+    if (!m_bSwapNeeded || !shouldRender()) {
         return;
     }
     makeCurrentIfNeeded();
     swapBuffers();
     doneCurrent();
+    m_bSwapNeeded = false;
 }
 
 QImage WSpinnyBase::scaleToSize(const QImage& image) const {
@@ -367,6 +386,7 @@ void WSpinnyBase::resizeEvent(QResizeEvent* event) {
     m_loadedCoverScaled = scaleToSize(m_loadedCover);
     m_fgImageScaled = scaleToSize(m_pFgImage);
     m_ghostImageScaled = scaleToSize(m_pGhostImage);
+    m_iPendingRenders = 2;
 
     WGLWidget::resizeEvent(event);
 }
@@ -476,6 +496,7 @@ void WSpinnyBase::updateVinylControlSignalEnabled(double enabled) {
         m_pVCManager->removeSignalQualityListener(this);
         m_bDrawVinylSignalQuality = false;
     }
+    m_iPendingRenders = 2;
 #else
     Q_UNUSED(enabled);
 #endif
@@ -483,10 +504,12 @@ void WSpinnyBase::updateVinylControlSignalEnabled(double enabled) {
 
 void WSpinnyBase::updateVinylControlEnabled(double enabled) {
     m_bVinylActive = enabled != 0;
+    m_iPendingRenders = 2;
 }
 
 void WSpinnyBase::updateSlipEnabled(double enabled) {
     m_bGhostPlayback = static_cast<bool>(enabled);
+    m_iPendingRenders = 2;
 }
 
 void WSpinnyBase::mouseMoveEvent(QMouseEvent* e) {
@@ -612,6 +635,9 @@ void WSpinnyBase::showEvent(QShowEvent* event) {
         m_pVCManager->addSignalQualityListener(this);
     }
 #endif
+    // Force a rerender when exposed (needed when using QOpenGL)
+    // 2 pending renders, in case we have triple buffering
+    m_iPendingRenders = 2;
     WGLWidget::showEvent(event);
 }
 
@@ -101,6 +101,12 @@ class WSpinnyBase : public WGLWidget,
     const QString m_group;
     UserSettingsPointer m_pConfig;
 
+    // Render and swap only when the drawn state has changed, like
+    // WVuMeterBase. The mutators of the state read by draw() request a
+    // rerender by setting m_iPendingRenders.
+    int m_iPendingRenders;
+    bool m_bSwapNeeded;
+
   protected:
     std::shared_ptr<QImage> m_pBgImage;
     std::shared_ptr<QImage> m_pMaskImage;
@@ -97,6 +97,30 @@ void storeActionTextAndScaleInProperties(QAction* pAction, const double scale) {
     pAction->setProperty(kBpmScaleProperty, QVariant(scale));
 }
 
+// Snapshots the state of each track into the pending journal gesture
+// immediately before applying the actual operation.
+class JournalingTrackPointerOperation : public mixxx::TrackPointerOperation {
+  public:
+    JournalingTrackPointerOperation(
+            mixxx::TrackOperationJournal* pJournal,
+            const mixxx::TrackPointerOperation* pInnerOperation)
+            : m_pJournal(pJournal),
+              m_pInnerOperation(pInnerOperation) {
+        DEBUG_ASSERT(m_pJournal);
+        DEBUG_ASSERT(m_pInnerOperation);
+    }
+
+  private:
+    void doApply(
+            const TrackPointer& pTrack) const override {
+        m_pJournal->recordTrackState(pTrack);
+        m_pInnerOperation->apply(pTrack);
+    }
+
+    mixxx::TrackOperationJournal* const m_pJournal;
+    const mixxx::TrackPointerOperation* const m_pInnerOperation;
+};
+
 } // namespace
 
 bool WTrackMenu::s_showPurgeSuccessPopup = true;
@@ -381,6 +405,14 @@ void WTrackMenu::createActions() {
         connect(m_pSelectInLibraryAct, &QAction::triggered, this, &WTrackMenu::slotSelectInLibrary);
     }
 
+    if (featureIsEnabled(Feature::Undo)) {
+        m_pUndoLibraryOperationAct = make_parented<QAction>(tr("Undo"), this);
+        connect(m_pUndoLibraryOperationAct,
+                &QAction::triggered,
+                this,
+                &WTrackMenu::slotUndoLibraryOperation);
+    }
+
     if (featureIsEnabled(Feature::Metadata)) {
         m_pImportMetadataFromFileAct =
                 make_parented<QAction>(tr("Import From File Tags"), m_pMetadataMenu);
@@ -561,6 +593,12 @@ void WTrackMenu::createActions() {
                 &QAction::triggered,
                 this,
                 &WTrackMenu::slotReanalyzeWithVariableTempo);
+
+        m_pReanalyzeLoudnessAction = make_parented<QAction>(tr("Reanalyze (loudness only)"), this);
+        connect(m_pReanalyzeLoudnessAction,
+                &QAction::triggered,
+                this,
+                &WTrackMenu::slotReanalyzeLoudness);
     }
 
     // This action is only usable when m_deckGroup is set. That is true only
@@ -734,6 +772,7 @@ void WTrackMenu::setupActions() {
         m_pAnalyzeMenu->addAction(m_pReanalyzeAction);
         m_pAnalyzeMenu->addAction(m_pReanalyzeConstBpmAction);
         m_pAnalyzeMenu->addAction(m_pReanalyzeVarBpmAction);
+        m_pAnalyzeMenu->addAction(m_pReanalyzeLoudnessAction);
         addMenu(m_pAnalyzeMenu);
     }
 
@@ -774,6 +813,11 @@ void WTrackMenu::setupActions() {
         addSeparator();
         addAction(m_pPropertiesAct);
     }
+
+    if (featureIsEnabled(Feature::Undo)) {
+        addSeparator();
+        addAction(m_pUndoLibraryOperationAct);
+    }
 }
 
 std::pair<bool, bool> WTrackMenu::getTrackBpmLockStates() const {
@@ -1226,6 +1270,18 @@ void WTrackMenu::updateMenus() {
         m_pPropertiesAct->setEnabled(true);
     }
 
+    if (featureIsEnabled(Feature::Undo)) {
+        const mixxx::TrackOperationJournal* pJournal =
+                m_pLibrary->trackOperationJournal();
+        if (pJournal->canUndo()) {
+            m_pUndoLibraryOperationAct->setText(pJournal->undoActionText());
+            m_pUndoLibraryOperationAct->setEnabled(true);
+        } else {
+            m_pUndoLibraryOperationAct->setText(tr("Undo"));
+            m_pUndoLibraryOperationAct->setEnabled(false);
+        }
+    }
+
     if (featureIsEnabled(Feature::FindOnWeb)) {
         // We have a new Track
         m_pFindOnWebMenu->clear();
@@ -1372,12 +1428,32 @@ std::unique_ptr<mixxx::TrackPointerIterator> WTrackMenu::newTrackPointerIterator
 int WTrackMenu::applyTrackPointerOperation(
         const QString& progressLabelText,
         const mixxx::TrackPointerOperation* pTrackPointerOperation,
-        mixxx::ModalTrackBatchOperationProcessor::Mode operationMode) const {
+        mixxx::ModalTrackBatchOperationProcessor::Mode operationMode,
+        mixxx::JournalMode journalMode) const {
     const auto pTrackPointerIter = newTrackPointerIterator();
     if (!pTrackPointerIter) {
         // Empty, i.e. nothing to do
         return 0;
     }
+    mixxx::TrackOperationJournal* pJournal = nullptr;
+    if (journalMode == mixxx::JournalMode::Journaled) {
+        pJournal = m_pLibrary->trackOperationJournal();
+    }
+    if (pJournal) {
+        pJournal->beginGesture(progressLabelText);
+        const JournalingTrackPointerOperation journalingOperation(
+                pJournal,
+                pTrackPointerOperation);
+        mixxx::ModalTrackBatchOperationProcessor modalOperation(
+                &journalingOperation,
+                operationMode);
+        const int trackCount = modalOperation.processTracks(
+                progressLabelText,
+                m_pLibrary->trackCollectionManager(),
+                pTrackPointerIter.get());
+        pJournal->commitGesture();
+        return trackCount;
+    }
     mixxx::ModalTrackBatchOperationProcessor modalOperation(
             pTrackPointerOperation,
             operationMode);
@@ -1526,7 +1602,11 @@ void WTrackMenu::slotExportMetadataIntoFileTags() {
             ExportMetadataIntoFileTagsTrackPointerOperation();
     applyTrackPointerOperation(
             progressLabelText,
-            &trackOperator);
+            &trackOperator,
+            mixxx::ModalTrackBatchOperationProcessor::Mode::Apply,
+            // The deferred export of file tags cannot be undone by
+            // restoring a snapshot of the track objects.
+            mixxx::JournalMode::NotJournaled);
 }
 
 void WTrackMenu::slotUpdateExternalTrackCollection(
@@ -1799,6 +1879,12 @@ void WTrackMenu::slotReanalyzeWithVariableTempo() {
     addToAnalysis(options);
 }
 
+void WTrackMenu::slotReanalyzeLoudness() {
+    AnalyzerTrack::Options options;
+    options.loudnessOnly = true;
+    addToAnalysis(options);
+}
+
 void WTrackMenu::slotLockBpm() {
     lockBpm(true);
 }
@@ -2360,7 +2446,11 @@ void WTrackMenu::slotClearWaveform() {
             ResetWaveformTrackPointerOperation(analysisDao);
     applyTrackPointerOperation(
             progressLabelText,
-            &trackOperator);
+            &trackOperator,
+            mixxx::ModalTrackBatchOperationProcessor::Mode::Apply,
+            // Deletes the stored analysis data which a snapshot of
+            // the track objects cannot restore.
+            mixxx::JournalMode::NotJournaled);
 }
 
 namespace {
@@ -2416,7 +2506,12 @@ void WTrackMenu::slotClearAllMetadata() {
             ClearAllPerformanceMetadataTrackPointerOperation(analysisDao);
     applyTrackPointerOperation(
             progressLabelText,
-            &trackOperator);
+            &trackOperator,
+            mixxx::ModalTrackBatchOperationProcessor::Mode::Apply,
+            // Includes resetting the waveform, i.e. deletes stored
+            // analysis data which a snapshot of the track objects
+            // cannot restore.
+            mixxx::JournalMode::NotJournaled);
 }
 
 namespace {
@@ -2602,7 +2697,11 @@ void WTrackMenu::slotRemoveFromDisk() {
             RemoveTrackFilesFromDiskTrackPointerOperation();
     applyTrackPointerOperation(
             progressLabelText,
-            &trackOperator);
+            &trackOperator,
+            mixxx::ModalTrackBatchOperationProcessor::Mode::Apply,
+            // Removes the track files from disk which a snapshot of
+            // the track objects cannot restore.
+            mixxx::JournalMode::NotJournaled);
 
     // Purge deleted tracks and show deletion summary message.
     const QList<TrackRef> tracksToPurge(trackOperator.getTracksToPurge());
@@ -2729,6 +2828,8 @@ void WTrackMenu::slotShowDlgTrackInfo() {
         // Create a fresh dialog on invocation.
         m_pDlgTrackInfoMulti = std::make_unique<DlgTrackInfoMulti>(
                 m_pConfig);
+        m_pDlgTrackInfoMulti->setTrackOperationJournal(
+                m_pLibrary->trackOperationJournal());
         connect(m_pDlgTrackInfoMulti.get(),
                 &QDialog::finished,
                 this,
@@ -2946,6 +3047,15 @@ void WTrackMenu::slotPurge() {
     emit restoreCurrentViewStateOrIndex();
 }
 
+void WTrackMenu::slotUndoLibraryOperation() {
+    mixxx::TrackOperationJournal* pJournal =
+            m_pLibrary->trackOperationJournal();
+    if (!pJournal->canUndo()) {
+        return;
+    }
+    pJournal->undo(m_pLibrary->trackCollectionManager());
+}
+
 void WTrackMenu::clearTrackSelection() {
     m_pTrack = nullptr;
     m_deckGroup = QString();
@@ -3013,6 +3123,9 @@ bool WTrackMenu::featureIsEnabled(Feature flag) const {
         return m_pLibrary != nullptr;
     case Feature::SelectInLibrary:
         return m_pTrack != nullptr;
+    case Feature::Undo:
+        return m_pLibrary != nullptr &&
+                m_pTrackModel->hasCapabilities(TrackModel::Capability::EditMetadata);
     default:
         DEBUG_ASSERT(!"unreachable");
         return false;
@@ -9,6 +9,7 @@
 #include "control/pollingcontrolproxy.h"
 #include "library/coverart.h"
 #include "library/dao/playlistdao.h"
+#include "library/trackoperationjournal.h"
 #include "library/trackprocessing.h"
 #include "preferences/usersettings.h"
 #include "track/beats.h"
@@ -59,11 +60,12 @@ class WTrackMenu : public QMenu {
         SelectInLibrary = 1 << 15,
         Analyze = 1 << 16,
         FindOnWeb = 1 << 17,
+        Undo = 1 << 18,
         TrackModelFeatures = Remove | HideUnhidePurge,
         All = AutoDJ | LoadTo | Playlist | Crate | Remove | Metadata | Reset | Analyze |
                 BPM | Color | HideUnhidePurge | RemoveFromDisk | FileBrowser |
                 Properties | SearchRelated | UpdateReplayGainFromPregain | SelectInLibrary |
-                FindOnWeb
+                FindOnWeb | Undo
     };
     Q_DECLARE_FLAGS(Features, Feature)
 
@@ -161,6 +163,7 @@ class WTrackMenu : public QMenu {
     void slotReanalyze();
     void slotReanalyzeWithFixedTempo();
     void slotReanalyzeWithVariableTempo();
+    void slotReanalyzeLoudness();
 
     // BPM
     void slotLockBpm();
@@ -199,6 +202,9 @@ class WTrackMenu : public QMenu {
     void slotUnhide();
     void slotPurge();
 
+    // Undo journaled bulk edits
+    void slotUndoLibraryOperation();
+
   private:
     void closeEvent(QCloseEvent* event) override;
     // This getter verifies that m_pTrackModel is set when
@@ -221,7 +227,9 @@ class WTrackMenu : public QMenu {
             const QString& progressLabelText,
             const mixxx::TrackPointerOperation* pTrackPointerOperation,
             mixxx::ModalTrackBatchOperationProcessor::Mode operationMode =
-                    mixxx::ModalTrackBatchOperationProcessor::Mode::Apply) const;
+                    mixxx::ModalTrackBatchOperationProcessor::Mode::Apply,
+            mixxx::JournalMode journalMode =
+                    mixxx::JournalMode::Journaled) const;
 
     bool isEmpty() const {
         return getTrackCount() == 0;
@@ -331,6 +339,9 @@ class WTrackMenu : public QMenu {
     // Show track-editor action
     parented_ptr<QAction> m_pPropertiesAct;
 
+    // Undo the most recent journaled bulk edit
+    parented_ptr<QAction> m_pUndoLibraryOperationAct;
+
     // Open file in default file browser
     parented_ptr<QAction> m_pFileBrowserAct;
 
@@ -359,6 +370,7 @@ class WTrackMenu : public QMenu {
     parented_ptr<QAction> m_pReanalyzeAction;
     parented_ptr<QAction> m_pReanalyzeConstBpmAction;
     parented_ptr<QAction> m_pReanalyzeVarBpmAction;
+    parented_ptr<QAction> m_pReanalyzeLoudnessAction;
 
     // Clear track metadata actions
     parented_ptr<QAction> m_pClearBeatsAction;
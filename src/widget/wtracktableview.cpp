@@ -1498,7 +1498,14 @@ void WTrackTableView::loadSelectedTrackToGroup(const QString& group,
     auto index = indices.at(0);
     auto* pTrackModel = getTrackModel();
     TrackPointer pTrack;
-    if (pTrackModel && (pTrack = pTrackModel->getTrack(index))) {
+    if (pTrackModel) {
+        // Loads into the preview deck must not implicitly add browsed
+        // files to the library.
+        pTrack = PlayerManager::isPreviewDeckGroup(group)
+                ? pTrackModel->getTrackForPreview(index)
+                : pTrackModel->getTrack(index);
+    }
+    if (pTrack) {
 #ifdef __STEM__
         DEBUG_ASSERT(!stemMask || pTrack->hasStem());
         emit loadTrackToPlayer(pTrack, group, stemMask, play);
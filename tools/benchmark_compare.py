@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+"""Compare two Google Benchmark JSON result files.
+
+Run the benchmarks with JSON output before and after a change:
+
+    mixxx-test --benchmark --benchmark_out=baseline.json \
+        --benchmark_out_format=json
+    mixxx-test --benchmark --benchmark_out=contender.json \
+        --benchmark_out_format=json
+
+then compare them:
+
+    tools/benchmark_compare.py baseline.json contender.json
+
+The script prints the real time delta for every benchmark present in
+both files and exits with a non-zero status when any benchmark regressed
+by more than the threshold (5 % by default).
+"""
+import argparse
+import json
+import sys
+
+
+def load_benchmarks(filename):
+    """Return {benchmark name: benchmark dict} from a JSON result file."""
+    with open(filename) as fp:
+        data = json.load(fp)
+    benchmarks = {}
+    for benchmark in data.get("benchmarks", []):
+        # Skip aggregate rows (mean/median/stddev of repetitions), they
+        # would be compared separately from the raw iterations.
+        if benchmark.get("run_type") == "aggregate":
+            continue
+        benchmarks[benchmark["name"]] = benchmark
+    return benchmarks
+
+
+def format_time(value, unit):
+    return "%10.1f %s" % (value, unit)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Compare two Google Benchmark JSON result files."
+    )
+    parser.add_argument("baseline", help="JSON results of the baseline run")
+    parser.add_argument("contender", help="JSON results of the new run")
+    parser.add_argument(
+        "--threshold",
+        type=float,
+        default=5.0,
+        help="regression threshold in percent (default: %(default)s)",
+    )
+    parser.add_argument(
+        "--cpu-time",
+        action="store_true",
+        help="compare cpu_time instead of real_time",
+    )
+    args = parser.parse_args()
+
+    baseline = load_benchmarks(args.baseline)
+    contender = load_benchmarks(args.contender)
+    time_key = "cpu_time" if args.cpu_time else "real_time"
+
+    missing = sorted(set(baseline) ^ set(contender))
+    for name in missing:
+        print("only in %s: %s" % (
+            args.baseline if name in baseline else args.contender, name))
+
+    regressions = []
+    name_width = max((len(name) for name in baseline if name in contender),
+                     default=0)
+    for name in sorted(baseline):
+        if name not in contender:
+            continue
+        old = baseline[name]
+        new = contender[name]
+        if old["time_unit"] != new["time_unit"]:
+            print("%s: time unit mismatch (%s vs %s), skipping" % (
+                name, old["time_unit"], new["time_unit"]))
+            continue
+        old_time = old[time_key]
+        new_time = new[time_key]
+        delta_percent = (new_time - old_time) / old_time * 100.0
+        marker = ""
+        if delta_percent > args.threshold:
+            marker = "  REGRESSION"
+            regressions.append(name)
+        print("%-*s %s -> %s  %+6.1f%%%s" % (
+            name_width, name,
+            format_time(old_time, old["time_unit"]),
+            format_time(new_time, new["time_unit"]),
+            delta_percent, marker))
+
+    if regressions:
+        print()
+        print("%d benchmark(s) regressed by more than %g%%" % (
+            len(regressions), args.threshold))
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())